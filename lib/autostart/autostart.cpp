@@ -0,0 +1,145 @@
+#include "autostart.h"
+#include "link_frame.h"
+#include <algorithm>
+#include <vector>
+#include "modules.h"
+#include "module_cache.h"
+#include "wasm_runner.h"
+#include "console_args.h"
+
+extern int current_module;
+
+// Module ids in boot order
+static std::vector<int> autostart_list() {
+    std::vector<int> ids;
+    for (int id : module_ids()) {
+        if (get_module(id)->autostart > 0) ids.push_back(id);
+    }
+    std::stable_sort(ids.begin(), ids.end(), [](int a, int b) {
+        return get_module(a)->autostart < get_module(b)->autostart;
+    });
+    return ids;
+}
+
+static void renumber(const std::vector<int>& ids) {
+    for (size_t i = 0; i < ids.size(); i++) {
+        get_module(ids[i])->autostart = i + 1;
+    }
+}
+
+static bool load_from_flash(WasmModule* mod) {
+    if (mod->loaded) return true;
+    ByteBuffer buffer = {};
+    if (!cache_load(mod->url, &buffer, mod->sha256)) {
+        byte_buffer_free(&buffer);
+        return false;
+    }
+    size_t size;
+    uint8_t* bytecode = byte_buffer_release(&buffer, &size);
+    return install_module_bytecode(mod->id, bytecode, size);
+}
+
+void autostart_modules() {
+    std::vector<int> ids = autostart_list();
+    if (ids.empty()) return;
+
+    uint32_t started_at = millis();
+    for (int id : ids) {
+        WasmModule* mod = get_module(id);
+        if (!load_from_flash(mod)) {
+            Console.printf("⚠️  Autostart: %s has no usable flash copy\n", mod->name);
+            continue;
+        }
+        if (!mod->blob->info.has_start) {
+            Console.printf("⚠️  Autostart: %s has no _start\n", mod->name);
+            continue;
+        }
+        start_module(id);
+        if (current_module == id) {
+            Console.printf("🚀 Autostarted %s %lu ms after boot (%lu ms to load)\n", mod->name,
+                           (unsigned long)millis(), (unsigned long)(millis() - started_at));
+            return;
+        }
+    }
+    Console.println("❌ Autostart: no module could be started");
+}
+
+static const char* core_name(int8_t core) {
+    return core == 0 ? "core 0" : core == 1 ? "core 1" : "either core";
+}
+
+static void print_autostart() {
+    std::vector<int> ids = autostart_list();
+    Console.println("\n🚀 Autostart (first that loads wins):");
+    for (int id : ids) {
+        WasmModule* mod = get_module(id);
+        CacheEntry entry;
+        Console.printf("  %d. [%d] %s on %s%s\n", mod->autostart, id, mod->name, core_name(mod->core),
+                       cache_lookup(mod->url, &entry) ? "" : " ⚠️ no flash copy");
+    }
+    if (ids.empty()) {
+        Console.println("  None. Use 'b <n> [position] [core0|core1|any]' to add one.");
+    }
+}
+
+// Boot must not need the network, so the bytes have to be on flash
+static void ensure_flash_copy(WasmModule* mod) {
+    CacheEntry entry;
+    if (cache_lookup(mod->url, &entry)) return;
+    if (mod->loaded && cache_store(mod->url, mod->bytecode, mod->size, mod->blob->sha256)) {
+        Console.printf("💾 Stored %s on flash for boot\n", mod->name);
+        return;
+    }
+    Console.printf("⚠️  %s is not on flash yet; download it with 'l %d' or it won't start at boot\n",
+                   mod->name, mod->id);
+}
+
+bool handle_autostart_command(String args) {
+    String first = take_token(args);
+    if (first.isEmpty()) {
+        print_autostart();
+        return false;
+    }
+
+    WasmModule* mod = get_module(first.toInt());
+    if (mod == nullptr) {
+        Console.println("❌ Usage: b [<n> [position] [core0|core1|any] | <n> off]");
+        return false;
+    }
+
+    std::vector<int> ids = autostart_list();
+    ids.erase(std::remove(ids.begin(), ids.end(), mod->id), ids.end());
+
+    String option = take_token(args);
+    if (option == "off") {
+        mod->autostart = 0;
+        renumber(ids);
+        Console.printf("✅ %s no longer starts at boot\n", mod->name);
+        print_autostart();
+        return true;
+    }
+
+    size_t position = ids.size() + 1;
+    int8_t core = mod->core;
+    for (; !option.isEmpty(); option = take_token(args)) {
+        if (option == "core0") {
+            core = 0;
+        } else if (option == "core1") {
+            core = 1;
+        } else if (option == "any") {
+            core = -1;
+        } else if (option.toInt() > 0) {
+            position = min<size_t>(option.toInt(), ids.size() + 1);
+        } else {
+            Console.printf("❌ Unknown option '%s'\n", option.c_str());
+            return false;
+        }
+    }
+
+    ids.insert(ids.begin() + (position - 1), mod->id);
+    renumber(ids);
+    mod->core = core;
+    ensure_flash_copy(mod);
+    print_autostart();
+    return true;
+}
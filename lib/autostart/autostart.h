@@ -0,0 +1,16 @@
+#pragma once
+#include <Arduino.h>
+
+// Modules started at boot, straight from their flash copies, so a device
+// resumes its workload before WiFi or NTP are up. One module runs at a
+// time, so the list is an order of preference: the first entry whose
+// bytecode loads from flash and has a _start is started, the rest are
+// fallbacks. Positions and core affinity are saved with the module list.
+
+// In setup(), once the module list and the flash cache are ready and
+// before the remaining flash copies are loaded
+void autostart_modules();
+// Serial 'b': shows the list; 'b <n> [position] [core0|core1|any]' adds
+// or moves a module; 'b <n> off' takes it out. True when the module
+// list needs saving.
+bool handle_autostart_command(String args);
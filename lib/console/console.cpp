@@ -0,0 +1,134 @@
+#include "console.h"
+#include "serial_link.h"
+
+enum {
+    INPUT_TEXT,
+    INPUT_ESC,      // Got ESC, expecting '['
+    INPUT_CSI,      // Got ESC [, expecting the final byte
+};
+
+static ConsoleLineFn command_handler;
+static ConsoleLineFn continuation;     // Set while a prompt waits for its answer
+
+static String line;
+static int input_state = INPUT_TEXT;
+static bool after_cr = false;
+
+static String history[CONSOLE_HISTORY];
+static int history_count = 0;       // Lines stored, up to CONSOLE_HISTORY
+static int history_next = 0;        // Slot the next line goes into
+static int history_pos = -1;        // Lines back from the newest while browsing
+
+static void erase_line() {
+    for (size_t i = 0; i < line.length(); i++) {
+        Console.print("\b \b");
+    }
+}
+
+static void replace_line(const String& text) {
+    erase_line();
+    line = text;
+    Console.print(line);
+}
+
+static void remember(const String& text) {
+    int newest = (history_next + CONSOLE_HISTORY - 1) % CONSOLE_HISTORY;
+    if (text.isEmpty() || (history_count > 0 && history[newest] == text)) return;
+    history[history_next] = text;
+    history_next = (history_next + 1) % CONSOLE_HISTORY;
+    if (history_count < CONSOLE_HISTORY) history_count++;
+}
+
+static void browse_history(int step) {
+    int pos = history_pos + step;
+    if (pos < -1 || pos >= history_count) return;
+    history_pos = pos;
+    if (pos < 0) {
+        replace_line("");
+    } else {
+        replace_line(history[(history_next + CONSOLE_HISTORY - 1 - pos) % CONSOLE_HISTORY]);
+    }
+}
+
+static void finish_line() {
+    Console.println();
+    String text = line;
+    line = "";
+    history_pos = -1;
+    text.trim();
+
+    // A continuation may ask again, so it is cleared before it runs.
+    // Only commands go in the history, not answers to prompts.
+    if (continuation) {
+        ConsoleLineFn then = continuation;
+        continuation = nullptr;
+        then(text);
+    } else if (!text.isEmpty() && command_handler) {
+        remember(text);
+        command_handler(text);
+    }
+}
+
+static void handle_char(char c) {
+    switch (input_state) {
+        case INPUT_ESC:
+            input_state = (c == '[') ? INPUT_CSI : INPUT_TEXT;
+            return;
+        case INPUT_CSI:
+            // Parameters and intermediates until the final byte
+            if (c >= 0x40 && c <= 0x7E) {
+                input_state = INPUT_TEXT;
+                if (c == 'A') browse_history(1);
+                if (c == 'B') browse_history(-1);
+            }
+            return;
+    }
+
+    bool was_cr = after_cr;
+    after_cr = (c == '\r');
+    if (c == '\n' && was_cr) return;    // CR LF is one line end
+
+    if (c == '\r' || c == '\n') {
+        finish_line();
+    } else if (c == 0x1B) {
+        input_state = INPUT_ESC;
+    } else if (c == 8 || c == 127) {
+        if (line.length() > 0) {
+            line.remove(line.length() - 1);
+            Console.print("\b \b");
+        }
+    } else if (c == 0x15) {             // Ctrl-U
+        replace_line("");
+    } else if (c == 0x03) {             // Ctrl-C
+        erase_line();
+        line = "";
+        Console.println("^C");
+        if (continuation) {
+            continuation = nullptr;
+            Console.println("❌ Cancelled");
+        }
+    } else if (c >= 32 && c <= 126 && line.length() < CONSOLE_LINE_MAX) {
+        line += c;
+        Console.print(c);
+    }
+}
+
+void console_begin(ConsoleLineFn run_command) {
+    command_handler = run_command;
+}
+
+void console_poll() {
+    while (Serial.available() && Serial.peek() != 0) {
+        handle_char(Serial.read());
+    }
+}
+
+void console_prompt(const char* prompt, ConsoleLineFn then) {
+    if (serial_link_active()) {
+        serial_link_refuse_prompt(prompt);
+        then("");
+        return;
+    }
+    Console.print(prompt);
+    continuation = then;
+}
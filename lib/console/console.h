@@ -0,0 +1,24 @@
+#pragma once
+#include <Arduino.h>
+#include <functional>
+
+// Line editor for the serial console, fed from the console task; it only ever
+// handles what has already arrived, so typing never holds up the
+// display or WiFi. Echo, backspace, Ctrl-U (clear line), Ctrl-C (cancel
+// a prompt) and a command history on the up/down arrow keys.
+//
+// A finished line goes to the command handler, unless a command asked
+// for more with console_prompt(): then it goes to that continuation.
+#define CONSOLE_LINE_MAX   256
+#define CONSOLE_HISTORY    16
+
+typedef std::function<void(String line)> ConsoleLineFn;
+
+void console_begin(ConsoleLineFn run_command);
+// Takes the input that is waiting, up to a serial link frame (see
+// serial_link.h), which is left for the link to pick up
+void console_poll();
+// The next line goes to `then`, trimmed. Answered with "" at once while
+// a host drives the console, since nobody is there to type, and the
+// host's command fails (serial_link_refuse_prompt()).
+void console_prompt(const char* prompt, ConsoleLineFn then);
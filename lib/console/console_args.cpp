@@ -0,0 +1,13 @@
+#include "console_args.h"
+
+String take_token(String& line) {
+    line.trim();
+    int end = 0;
+    while (end < (int)line.length() && !isspace((unsigned char)line.charAt(end))) {
+        end++;
+    }
+    String token = line.substring(0, end);
+    line = line.substring(end);
+    line.trim();
+    return token;
+}
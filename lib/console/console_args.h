@@ -0,0 +1,6 @@
+#pragma once
+#include <Arduino.h>
+
+// Pops the next whitespace-separated token off the front of `line`.
+// Returns an empty string when no tokens are left.
+String take_token(String& line);
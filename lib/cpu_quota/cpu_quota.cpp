@@ -0,0 +1,183 @@
+#include "cpu_quota.h"
+#include "link_frame.h"
+#include <esp_freertos_hooks.h>
+#include "modules.h"
+#include "console_args.h"
+
+#define CPU_QUOTA_POLL_MS   10
+
+// One task whose CPU time is charged to a module
+struct QuotaMeter {
+    volatile TaskHandle_t task;
+    volatile uint32_t ticks;
+    int module_id;
+    uint32_t window_start;
+    uint32_t penalty_ms;     // Owed, slept off at the task's next host call
+};
+
+static QuotaMeter meters[CPU_QUOTA_METERS];
+static SemaphoreHandle_t quota_mutex = NULL;
+
+// Runs in the tick ISR of each core: charge the tick to the module whose
+// code the core was executing, if any
+static void IRAM_ATTR quota_tick_hook() {
+    TaskHandle_t current = xTaskGetCurrentTaskHandle();
+    for (int i = 0; i < CPU_QUOTA_METERS; i++) {
+        if (meters[i].task == current) {
+            meters[i].ticks++;
+            return;
+        }
+    }
+}
+
+// Called with quota_mutex held
+static QuotaMeter* find_meter(TaskHandle_t task) {
+    for (int i = 0; i < CPU_QUOTA_METERS; i++) {
+        if (meters[i].task == task) return &meters[i];
+    }
+    return nullptr;
+}
+
+static void check_window(QuotaMeter* meter, uint32_t now) {
+    // A penalty that is owed but not served yet keeps the window open
+    if (meter->penalty_ms > 0) return;
+    int32_t elapsed = (int32_t)(now - meter->window_start);
+    if (elapsed < CPU_QUOTA_WINDOW_MS) return;
+
+    uint32_t used = meter->ticks * portTICK_PERIOD_MS;
+    meter->ticks = 0;
+    meter->window_start = now;
+
+    WasmModule* mod = get_module(meter->module_id);
+    if (mod == nullptr) return;
+    mod->cpu_usage = min<uint32_t>(used * 100 / elapsed, 100);
+
+    if (mod->cpu_quota < 100 && mod->cpu_usage > mod->cpu_quota) {
+        // Sleep long enough that usage over window + penalty
+        // comes back down to the quota
+        uint32_t penalty = used * 100 / max<uint8_t>(mod->cpu_quota, 1) - elapsed;
+        meter->penalty_ms = min<uint32_t>(max<uint32_t>(penalty, 1), CPU_QUOTA_MAX_PENALTY_MS);
+        mod->throttle_count++;
+    }
+}
+
+static void quota_task(void* parameter) {
+    TickType_t last_wake = xTaskGetTickCount();
+
+    for (;;) {
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(CPU_QUOTA_POLL_MS));
+
+        xSemaphoreTake(quota_mutex, portMAX_DELAY);
+        uint32_t now = millis();
+        for (int i = 0; i < CPU_QUOTA_METERS; i++) {
+            if (meters[i].task != NULL) check_window(&meters[i], now);
+        }
+        xSemaphoreGive(quota_mutex);
+    }
+}
+
+void init_cpu_quota() {
+    quota_mutex = xSemaphoreCreateMutex();
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+        esp_register_freertos_tick_hook_for_cpu(quota_tick_hook, core);
+    }
+    // Only measures; the metered tasks throttle themselves
+    xTaskCreate(&quota_task, "cpu_quota", 3 * 1024, NULL, configMAX_PRIORITIES - 2, NULL);
+}
+
+void cpu_quota_attach(TaskHandle_t task, int module_id) {
+    xSemaphoreTake(quota_mutex, portMAX_DELAY);
+    QuotaMeter* meter = find_meter(task);
+    if (meter == nullptr) meter = find_meter(NULL);
+    if (meter != nullptr) {
+        // Ticks land in the meter from the moment `task` is set
+        meter->task = NULL;
+        meter->ticks = 0;
+        meter->module_id = module_id;
+        meter->window_start = millis();
+        meter->penalty_ms = 0;
+        meter->task = task;
+    }
+    xSemaphoreGive(quota_mutex);
+}
+
+void cpu_quota_detach(TaskHandle_t task) {
+    xSemaphoreTake(quota_mutex, portMAX_DELAY);
+    QuotaMeter* meter = find_meter(task);
+    if (meter != nullptr) meter->task = NULL;
+    xSemaphoreGive(quota_mutex);
+}
+
+uint32_t cpu_quota_take_penalty() {
+    xSemaphoreTake(quota_mutex, portMAX_DELAY);
+    QuotaMeter* meter = find_meter(xTaskGetCurrentTaskHandle());
+    uint32_t penalty = 0;
+    if (meter != nullptr && meter->penalty_ms > 0) {
+        penalty = meter->penalty_ms;
+        meter->penalty_ms = 0;
+        // The next window starts once the penalty is over
+        meter->ticks = 0;
+        meter->window_start = millis() + penalty;
+        WasmModule* mod = get_module(meter->module_id);
+        if (mod != nullptr) mod->throttled_ms += penalty;
+    }
+    xSemaphoreGive(quota_mutex);
+    return penalty;
+}
+
+static void show_cpu_usage() {
+    Console.println("\n⚙️  Module CPU Usage:");
+    Console.println("=====================");
+
+    std::vector<int> ids = module_ids();
+    for (int id : ids) {
+        WasmModule* mod = get_module(id);
+        if (mod == nullptr) continue;
+
+        bool running = false, throttled = false;
+        xSemaphoreTake(quota_mutex, portMAX_DELAY);
+        for (int i = 0; i < CPU_QUOTA_METERS; i++) {
+            if (meters[i].task != NULL && meters[i].module_id == id) {
+                running = true;
+                throttled |= meters[i].penalty_ms > 0;
+            }
+        }
+        xSemaphoreGive(quota_mutex);
+
+        Console.printf("%d. %s %s\n", id, mod->name, running ? "▶️  (running)" : "");
+        Console.printf("   Quota: %u%%", mod->cpu_quota);
+        if (running) {
+            Console.printf(", Usage: %u%%%s", mod->cpu_usage, throttled ? " (throttled)" : "");
+        }
+        Console.printf(", Throttled: %lu times / %lu ms\n",
+                       (unsigned long)mod->throttle_count,
+                       (unsigned long)mod->throttled_ms);
+    }
+
+    if (ids.empty()) {
+        Console.println("No modules configured.");
+    }
+}
+
+bool handle_quota_command(String args) {
+    String number = take_token(args);
+    if (number.isEmpty()) {
+        show_cpu_usage();
+        return false;
+    }
+
+    WasmModule* mod = get_module(number.toInt());
+    int percent = take_token(args).toInt();
+    if (mod == nullptr) {
+        Console.println("❌ Invalid module number");
+        return false;
+    }
+    if (percent < 1 || percent > 100) {
+        Console.println("❌ Usage: q <n> <percent 1-100>");
+        return false;
+    }
+
+    mod->cpu_quota = percent;
+    Console.printf("✅ CPU quota for %s set to %d%%\n", mod->name, percent);
+    return true;
+}
@@ -0,0 +1,23 @@
+#pragma once
+#include <Arduino.h>
+
+// CPU budgets for modules, as a percentage of one core. Usage is sampled
+// from the FreeRTOS tick hook (1 kHz on both cores) for every task running
+// module code: the module task and tasks inside an exported call. Once a
+// 100 ms window exceeds the quota, the task owes a penalty, which it
+// sleeps off at its next host call, where it holds no locks.
+#define CPU_QUOTA_DEFAULT     50
+#define CPU_QUOTA_WINDOW_MS   100
+#define CPU_QUOTA_MAX_PENALTY_MS 1000
+#define CPU_QUOTA_METERS      4
+
+void init_cpu_quota();
+void cpu_quota_attach(TaskHandle_t task, int module_id);
+void cpu_quota_detach(TaskHandle_t task);
+// Called from host bindings on the metered task: the penalty it owes in
+// ms (0 if none), counted as served, so the caller sleeps it off
+uint32_t cpu_quota_take_penalty();
+
+// Serial command 'q': show usage, or 'q <n> <percent>' to set a quota.
+// Returns true when a quota changed and the module list should be saved.
+bool handle_quota_command(String args);
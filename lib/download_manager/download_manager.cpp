@@ -0,0 +1,338 @@
+#include "download_manager.h"
+#include "link_frame.h"
+#include "modules.h"
+#include "module_cache.h"
+#include "console_args.h"
+
+#define DOWNLOAD_MAX_LISTENERS  4
+#define DOWNLOAD_WORKER_STACK   (12 * 1024)    // Room for a TLS handshake
+
+static DownloadJob jobs[DOWNLOAD_MAX_JOBS];
+static int next_job_id = 1;
+static QueueHandle_t job_queue = NULL;
+static SemaphoreHandle_t jobs_mutex = NULL;
+static DownloadListener listeners[DOWNLOAD_MAX_LISTENERS];
+static int num_listeners = 0;
+static volatile int worker_limit = DOWNLOAD_DEFAULT_WORKERS;
+static int num_workers = 0;
+
+static const char* state_name(DownloadState state) {
+    switch (state) {
+        case DOWNLOAD_QUEUED:    return "queued";
+        case DOWNLOAD_RUNNING:   return "running";
+        case DOWNLOAD_DONE:      return "done";
+        case DOWNLOAD_FAILED:    return "failed";
+        case DOWNLOAD_CANCELLED: return "cancelled";
+        default:                 return "idle";
+    }
+}
+
+static void notify(const DownloadJob& job) {
+    for (int i = 0; i < num_listeners; i++) {
+        listeners[i](job);
+    }
+}
+
+static void on_progress(size_t received, int total, void* arg) {
+    DownloadJob* job = (DownloadJob*)arg;
+    job->received = received;
+    job->total = total;
+    notify(*job);
+}
+
+static void run_job(DownloadJob* job, DownloadSession* session) {
+    WasmModule* mod = get_module(job->module_id);
+    job->state = DOWNLOAD_RUNNING;
+    job->started_ms = millis();
+    notify(*job);
+
+    DownloadRequest request;
+    request.progress = on_progress;
+    request.progress_arg = job;
+    request.cancel = &job->cancel;
+    request.session = session;
+
+    ByteBuffer buffer = {};
+    bool not_modified = false;
+    bool ok = mod != nullptr && fetch_module(job->module_id, request, &buffer, &not_modified);
+
+    if (ok) {
+        size_t size;
+        uint8_t* bytecode = byte_buffer_release(&buffer, &size);
+        SharedBytecode* blob = share_bytecode(bytecode, size);
+        ok = blob != nullptr;
+        // Never swaps bytecode under a running module; 'h' does that safely
+        if (ok && !install_shared_bytecode(job->module_id, blob)) {
+            Console.printf("⚠️  %s is running or being updated, downloaded copy kept on flash only\n", mod->name);
+        }
+    } else {
+        byte_buffer_free(&buffer);
+    }
+
+    job->state = ok ? DOWNLOAD_DONE : (job->cancel ? DOWNLOAD_CANCELLED : DOWNLOAD_FAILED);
+    notify(*job);
+}
+
+static void download_worker(void* parameter) {
+    int worker_index = (int)(intptr_t)parameter;
+    DownloadJob* job;
+
+    for (;;) {
+        // Workers above the current limit sit out until it is raised
+        while (worker_index >= worker_limit) {
+            vTaskDelay(pdMS_TO_TICKS(200));
+        }
+        if (xQueueReceive(job_queue, &job, portMAX_DELAY) != pdTRUE) continue;
+
+        DownloadSession session;
+        int count = 0;
+        while (job != nullptr) {
+            // Taken first: a finished slot can be reused for a new job
+            DownloadJob* next = job->next;
+            if (job->cancel) {
+                job->state = DOWNLOAD_CANCELLED;
+                notify(*job);
+            } else {
+                run_job(job, &session);
+            }
+            job = next;
+            count++;
+        }
+        download_session_close(&session);
+
+        if (count > 1) {
+            Console.printf("🔗 Batch: %d requests over %d connection%s\n", session.requests,
+                           session.connections, session.connections == 1 ? "" : "s");
+        }
+    }
+}
+
+// Default listener: one serial line per state change and every 25%
+static void serial_listener(const DownloadJob& job) {
+    static int last_quarter[DOWNLOAD_MAX_JOBS];
+    int slot = &job - jobs;
+
+    if (job.state == DOWNLOAD_RUNNING && job.received == 0) {
+        last_quarter[slot] = 0;
+        Console.printf("📥 [%d] Downloading %s\n", job.id, module_name(job.module_id));
+    } else if (job.state == DOWNLOAD_RUNNING && job.total > 0) {
+        int quarter = job.received * 4 / job.total;
+        if (quarter > last_quarter[slot]) {
+            last_quarter[slot] = quarter;
+            Console.printf("📊 [%d] %s: %d%%\n", job.id, module_name(job.module_id), quarter * 25);
+        }
+    } else if (job.state >= DOWNLOAD_DONE) {
+        Console.printf("%s [%d] %s %s (%u bytes, %lu ms)\n",
+                       job.state == DOWNLOAD_DONE ? "✅" : "❌", job.id,
+                       module_name(job.module_id), state_name(job.state),
+                       (unsigned)job.received, (unsigned long)(millis() - job.started_ms));
+    }
+}
+
+void init_download_manager() {
+    jobs_mutex = xSemaphoreCreateMutex();
+    job_queue = xQueueCreate(DOWNLOAD_MAX_JOBS, sizeof(DownloadJob*));
+    add_download_listener(serial_listener);
+    set_download_concurrency(DOWNLOAD_DEFAULT_WORKERS);
+}
+
+void add_download_listener(DownloadListener listener) {
+    if (num_listeners < DOWNLOAD_MAX_LISTENERS) {
+        listeners[num_listeners++] = listener;
+    }
+}
+
+void set_download_concurrency(int workers) {
+    workers = constrain(workers, 1, DOWNLOAD_MAX_WORKERS);
+    while (num_workers < workers) {
+        xTaskCreate(&download_worker, "download", DOWNLOAD_WORKER_STACK,
+                    (void*)(intptr_t)num_workers, 2, NULL);
+        num_workers++;
+    }
+    worker_limit = workers;
+}
+
+// Both called with jobs_mutex held
+// Module URLs are interned, so equal URLs are the same pointer
+static DownloadJob* find_pending(const char* url) {
+    for (int i = 0; i < DOWNLOAD_MAX_JOBS; i++) {
+        DownloadJob* j = &jobs[i];
+        bool pending = j->state == DOWNLOAD_QUEUED || j->state == DOWNLOAD_RUNNING;
+        if (pending && get_module(j->module_id)->url == url) return j;
+    }
+    return nullptr;
+}
+
+static DownloadJob* new_job(int module_id) {
+    for (int i = 0; i < DOWNLOAD_MAX_JOBS; i++) {
+        DownloadJob* job = &jobs[i];
+        if (job->state == DOWNLOAD_QUEUED || job->state == DOWNLOAD_RUNNING) continue;
+
+        job->id = next_job_id++;
+        job->module_id = module_id;
+        job->state = DOWNLOAD_QUEUED;
+        job->received = 0;
+        job->total = -1;
+        job->cancel = false;
+        job->started_ms = millis();
+        job->next = nullptr;
+        return job;
+    }
+    return nullptr;
+}
+
+int queue_download(int module_id) {
+    WasmModule* mod = get_module(module_id);
+    if (mod == nullptr) {
+        Console.println("❌ Invalid module number");
+        return -1;
+    }
+
+    xSemaphoreTake(jobs_mutex, portMAX_DELAY);
+    // Two transfers of one URL would race on the same cache file
+    DownloadJob* job = find_pending(mod->url);
+    if (job != nullptr) {
+        xSemaphoreGive(jobs_mutex);
+        Console.printf("ℹ️  %s is already being downloaded (job %d)\n", mod->name, job->id);
+        return job->id;
+    }
+
+    job = new_job(module_id);
+    if (job == nullptr) {
+        xSemaphoreGive(jobs_mutex);
+        Console.println("❌ Download queue is full");
+        return -1;
+    }
+    xQueueSend(job_queue, &job, 0);
+    xSemaphoreGive(jobs_mutex);
+
+    Console.printf("🕒 Queued download %d: %s\n", job->id, mod->name);
+    return job->id;
+}
+
+int queue_download_all(bool loaded_only) {
+    std::vector<int> selected;
+    for (int id : module_ids()) {
+        if (!loaded_only || get_module(id)->loaded) selected.push_back(id);
+    }
+    return queue_download_batch(selected);
+}
+
+int queue_download_batch(const std::vector<int>& module_ids) {
+    std::vector<bool> grouped(module_ids.size(), false);
+    int queued = 0;
+
+    xSemaphoreTake(jobs_mutex, portMAX_DELAY);
+    for (size_t i = 0; i < module_ids.size(); i++) {
+        if (grouped[i]) continue;
+
+        // Chain every remaining module from this module's host
+        String origin = url_origin(get_module(module_ids[i])->url);
+        DownloadJob* head = nullptr;
+        DownloadJob* tail = nullptr;
+        for (size_t k = i; k < module_ids.size(); k++) {
+            WasmModule* mod = get_module(module_ids[k]);
+            if (grouped[k] || url_origin(mod->url) != origin) continue;
+            grouped[k] = true;
+            if (find_pending(mod->url) != nullptr) continue;
+
+            DownloadJob* job = new_job(mod->id);
+            if (job == nullptr) break;
+            if (tail != nullptr) tail->next = job; else head = job;
+            tail = job;
+            queued++;
+        }
+
+        if (head != nullptr) {
+            xQueueSend(job_queue, &head, 0);
+            Console.printf("🕒 Queued batch for %s\n", origin.c_str());
+        }
+    }
+    xSemaphoreGive(jobs_mutex);
+
+    if (queued == 0) {
+        Console.println("ℹ️  Nothing to download");
+    }
+    return queued;
+}
+
+bool download_pending(int module_id) {
+    bool pending = false;
+    xSemaphoreTake(jobs_mutex, portMAX_DELAY);
+    for (int i = 0; i < DOWNLOAD_MAX_JOBS; i++) {
+        DownloadJob* j = &jobs[i];
+        if ((j->state == DOWNLOAD_QUEUED || j->state == DOWNLOAD_RUNNING) && j->module_id == module_id) {
+            pending = true;
+        }
+    }
+    xSemaphoreGive(jobs_mutex);
+    return pending;
+}
+
+bool cancel_download(int job_id) {
+    bool found = false;
+    xSemaphoreTake(jobs_mutex, portMAX_DELAY);
+    for (int i = 0; i < DOWNLOAD_MAX_JOBS; i++) {
+        DownloadJob* j = &jobs[i];
+        bool pending = j->state == DOWNLOAD_QUEUED || j->state == DOWNLOAD_RUNNING;
+        if (pending && (job_id < 0 || j->id == job_id)) {
+            j->cancel = true;
+            found = true;
+        }
+    }
+    xSemaphoreGive(jobs_mutex);
+    return found;
+}
+
+void list_downloads() {
+    Console.println("\n📥 Downloads:");
+    Console.println("=============");
+
+    int count = 0;
+    for (int i = 0; i < DOWNLOAD_MAX_JOBS; i++) {
+        DownloadJob* j = &jobs[i];
+        if (j->state == DOWNLOAD_IDLE) continue;
+        count++;
+        Console.printf("[%d] %s: %s", j->id, module_name(j->module_id), state_name(j->state));
+        if (j->total > 0) {
+            Console.printf(" %u/%d bytes\n", (unsigned)j->received, j->total);
+        } else {
+            Console.printf(" %u bytes\n", (unsigned)j->received);
+        }
+    }
+    if (count == 0) {
+        Console.println("No downloads.");
+    }
+    Console.printf("Workers: %d\n", worker_limit);
+}
+
+bool get_download_overview(size_t* received, size_t* total, int* active) {
+    *received = 0;
+    *total = 0;
+    *active = 0;
+    for (int i = 0; i < DOWNLOAD_MAX_JOBS; i++) {
+        DownloadJob* j = &jobs[i];
+        if (j->state != DOWNLOAD_QUEUED && j->state != DOWNLOAD_RUNNING) continue;
+        (*active)++;
+        *received += j->received;
+        *total += (j->total > 0) ? j->total : j->received;
+    }
+    return *active > 0;
+}
+
+void handle_download_command(String args) {
+    String sub = take_token(args);
+
+    if (sub.isEmpty() || sub == "list") {
+        list_downloads();
+    } else if (sub == "cancel") {
+        String which = take_token(args);
+        int id = (which == "all" || which.isEmpty()) ? -1 : which.toInt();
+        Console.println(cancel_download(id) ? "🚫 Cancelling..." : "❌ No such download");
+    } else if (sub == "workers") {
+        set_download_concurrency(take_token(args).toInt());
+        Console.printf("✅ Concurrent downloads: %d\n", worker_limit);
+    } else {
+        Console.println("❌ Usage: p [list] | p cancel <job|all> | p workers <n>");
+    }
+}
@@ -0,0 +1,54 @@
+#pragma once
+#include <Arduino.h>
+#include <vector>
+
+// Background module downloads. Jobs are queued from the console task and
+// run on worker tasks, so serial input and LVGL keep running meanwhile.
+#define DOWNLOAD_MAX_JOBS      16
+#define DOWNLOAD_MAX_WORKERS   3
+#define DOWNLOAD_DEFAULT_WORKERS 2
+
+enum DownloadState : uint8_t {
+    DOWNLOAD_IDLE,
+    DOWNLOAD_QUEUED,
+    DOWNLOAD_RUNNING,
+    DOWNLOAD_DONE,
+    DOWNLOAD_FAILED,
+    DOWNLOAD_CANCELLED,
+};
+
+struct DownloadJob {
+    int id;
+    int module_id;
+    volatile DownloadState state;
+    volatile size_t received;
+    volatile int total;         // -1 while unknown
+    volatile bool cancel;
+    uint32_t started_ms;
+    DownloadJob* next;          // Rest of a same-host batch
+};
+
+// Called from worker tasks on progress and state changes. Must not touch
+// LVGL directly; UI code polls get_download_overview() instead.
+typedef void (*DownloadListener)(const DownloadJob& job);
+
+void init_download_manager();
+void add_download_listener(DownloadListener listener);
+void set_download_concurrency(int workers);
+
+int queue_download(int module_id);     // Job id, or -1
+// Queues every module (or only the loaded ones, to refresh them) as one
+// batch per host, each fetched over a single keep-alive connection.
+// Returns the number of jobs queued.
+int queue_download_all(bool loaded_only);
+// Same, for the given module ids
+int queue_download_batch(const std::vector<int>& module_ids);
+bool download_pending(int module_id);  // Queued or running
+bool cancel_download(int job_id);      // -1 cancels everything
+void list_downloads();
+
+// Totals over queued and running jobs, for progress bars
+bool get_download_overview(size_t* received, size_t* total, int* active);
+
+// Serial command 'p': list | cancel <job|all> | workers <n>
+void handle_download_command(String args);
@@ -0,0 +1,170 @@
+#include "delta_patch.h"
+#include "link_frame.h"
+
+enum {
+    DELTA_HEADER,
+    DELTA_OP,
+    DELTA_ARGS,
+    DELTA_DATA,
+};
+
+enum {
+    OP_COPY = 1,
+    OP_INSERT = 2,
+    OP_ADD = 3,
+};
+
+static uint32_t read_le32(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+DeltaPatcher::DeltaPatcher(const uint8_t* base, size_t base_size, ByteBuffer* out)
+    : _base(base), _base_size(base_size), _out(out), _header_len(0), _new_size(0),
+      _state(DELTA_HEADER), _op(0), _arg(0), _varint(0), _shift(0), _offset(0), _remaining(0),
+      _failed(false), _hashed(0) {
+    mbedtls_sha256_init(&_sha);
+    mbedtls_sha256_starts_ret(&_sha, 0);
+}
+
+DeltaPatcher::~DeltaPatcher() {
+    mbedtls_sha256_free(&_sha);
+}
+
+bool DeltaPatcher::fail(const char* reason) {
+    Console.printf("❌ Delta patch: %s\n", reason);
+    _failed = true;
+    return false;
+}
+
+bool DeltaPatcher::parse_header() {
+    if (memcmp(_header, DELTA_MAGIC, 4) != 0) {
+        return fail("not a patch");
+    }
+    if (read_le32(_header + 4) != _base_size) {
+        return fail("made for a different base version");
+    }
+
+    uint8_t digest[SHA256_SIZE];
+    mbedtls_sha256_ret(_base, _base_size, digest, 0);
+    if (memcmp(digest, _header + 12, SHA256_SIZE) != 0) {
+        return fail("made for a different base version");
+    }
+
+    _new_size = read_le32(_header + 8);
+    if (!byte_buffer_reserve(_out, _new_size)) {
+        return fail("out of memory");
+    }
+    _state = DELTA_OP;
+    return true;
+}
+
+bool DeltaPatcher::start_op() {
+    size_t len = (_op == OP_INSERT) ? _args[0] : _args[1];
+    if (_out->size + len > _new_size) {
+        return fail("writes past the new image");
+    }
+
+    if (_op == OP_INSERT) {
+        _remaining = len;
+        _state = _remaining ? DELTA_DATA : DELTA_OP;
+        return true;
+    }
+
+    _offset = _args[0];
+    if (_offset > _base_size || len > _base_size - _offset) {
+        return fail("reads past the old image");
+    }
+    if (_op == OP_COPY) {
+        memcpy(_out->data + _out->size, _base + _offset, len);
+        _out->size += len;
+        _state = DELTA_OP;
+    } else {
+        _remaining = len;
+        _state = _remaining ? DELTA_DATA : DELTA_OP;
+    }
+    return true;
+}
+
+bool DeltaPatcher::write(const uint8_t* data, size_t len) {
+    if (_failed) return false;
+
+    while (len > 0) {
+        switch (_state) {
+            case DELTA_HEADER: {
+                size_t n = min<size_t>(len, DELTA_HEADER_SIZE - _header_len);
+                memcpy(_header + _header_len, data, n);
+                _header_len += n;
+                data += n;
+                len -= n;
+                if (_header_len == DELTA_HEADER_SIZE && !parse_header()) return false;
+                break;
+            }
+
+            case DELTA_OP:
+                _op = *data++;
+                len--;
+                if (_op != OP_COPY && _op != OP_INSERT && _op != OP_ADD) {
+                    return fail("unknown op");
+                }
+                _arg = 0;
+                _varint = 0;
+                _shift = 0;
+                _state = DELTA_ARGS;
+                break;
+
+            case DELTA_ARGS: {
+                uint8_t b = *data++;
+                len--;
+                _varint |= (uint32_t)(b & 0x7f) << _shift;
+                if (b & 0x80) {
+                    _shift += 7;
+                    if (_shift > 28) return fail("bad varint");
+                    break;
+                }
+                _args[_arg++] = _varint;
+                _varint = 0;
+                _shift = 0;
+                if (_arg == ((_op == OP_INSERT) ? 1 : 2) && !start_op()) return false;
+                break;
+            }
+
+            case DELTA_DATA: {
+                size_t n = min<size_t>(len, _remaining);
+                uint8_t* dst = _out->data + _out->size;
+                if (_op == OP_INSERT) {
+                    memcpy(dst, data, n);
+                } else {
+                    for (size_t i = 0; i < n; i++) {
+                        dst[i] = _base[_offset + i] + data[i];
+                    }
+                    _offset += n;
+                }
+                _out->size += n;
+                _remaining -= n;
+                data += n;
+                len -= n;
+                if (_remaining == 0) _state = DELTA_OP;
+                break;
+            }
+        }
+    }
+
+    // Hash what was produced while it is still in cache
+    mbedtls_sha256_update_ret(&_sha, _out->data + _hashed, _out->size - _hashed);
+    _hashed = _out->size;
+    return true;
+}
+
+bool DeltaPatcher::finish() {
+    if (_failed) return false;
+    if (_state != DELTA_OP || _out->size != _new_size) {
+        return fail("truncated");
+    }
+
+    uint8_t digest[SHA256_SIZE];
+    mbedtls_sha256_finish_ret(&_sha, digest);
+    if (memcmp(digest, new_sha256(), SHA256_SIZE) != 0) {
+        return fail("result does not match its SHA-256");
+    }
+    return true;
+}
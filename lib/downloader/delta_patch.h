@@ -0,0 +1,57 @@
+#pragma once
+#include <Arduino.h>
+#include "downloader.h"
+#include <mbedtls/sha256.h>
+
+// Rebuilds a module from the previous version plus a delta patch, so an
+// update only transfers what changed. Patches come from
+// tools/wasm_delta.py. Layout (integers are LEB128 varints unless noted):
+//
+//   "WDP1"  old size (u32 LE)  new size (u32 LE)
+//   SHA-256 of the old image   SHA-256 of the new image
+//   ops until the new image is complete:
+//     0x01 COPY    offset, len           old[offset..] verbatim
+//     0x02 INSERT  len, bytes            literal bytes
+//     0x03 ADD     offset, len, bytes    old[offset+i] + bytes[i] (bsdiff-style,
+//                                        for code that moved and got relocated)
+//
+// Input may arrive in chunks of any size. Besides the new image the
+// patcher keeps only a few bytes of parser state.
+#define DELTA_MAGIC         "WDP1"
+#define DELTA_HEADER_SIZE   (4 + 4 + 4 + SHA256_SIZE * 2)
+
+class DeltaPatcher {
+public:
+    DeltaPatcher(const uint8_t* base, size_t base_size, ByteBuffer* out);
+    ~DeltaPatcher();
+
+    bool write(const uint8_t* data, size_t len);
+    // True when the image is complete and hashes to what the header says
+    bool finish();
+    const uint8_t* new_sha256() const { return _header + 12 + SHA256_SIZE; }
+
+private:
+    bool parse_header();
+    bool start_op();
+    bool fail(const char* reason);
+
+    const uint8_t* _base;
+    size_t _base_size;
+    ByteBuffer* _out;
+    uint8_t _header[DELTA_HEADER_SIZE];
+    size_t _header_len;
+    size_t _new_size;
+
+    int _state;
+    uint8_t _op;
+    uint32_t _args[2];
+    int _arg;
+    uint32_t _varint;
+    int _shift;
+    uint32_t _offset;
+    uint32_t _remaining;
+    bool _failed;
+
+    mbedtls_sha256_context _sha;
+    size_t _hashed;
+};
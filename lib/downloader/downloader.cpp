@@ -0,0 +1,382 @@
+#include "downloader.h"
+#include "link_frame.h"
+#include "payload_decoder.h"
+#include <WiFi.h>
+#include <esp_heap_caps.h>
+#include <lwip/sockets.h>
+
+#define DOWNLOAD_TIMEOUT_MS     30000
+#define DOWNLOAD_MIN_GROWTH     4096
+#define DOWNLOAD_PROGRESS_STEP  (16 * 1024)
+
+bool byte_buffer_reserve(ByteBuffer* buffer, size_t extra) {
+    size_t needed = buffer->size + extra;
+    if (needed <= buffer->capacity) return true;
+
+    size_t capacity = max<size_t>(buffer->capacity * 2, DOWNLOAD_MIN_GROWTH);
+    while (capacity < needed) capacity *= 2;
+
+    uint8_t* data = (uint8_t*)heap_caps_realloc(buffer->data, capacity, MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT);
+    if (data == nullptr) {
+        // No PSRAM (or it is full): fall back to internal RAM
+        data = (uint8_t*)realloc(buffer->data, capacity);
+    }
+    if (data == nullptr) return false;
+
+    buffer->data = data;
+    buffer->capacity = capacity;
+    return true;
+}
+
+void byte_buffer_free(ByteBuffer* buffer) {
+    free(buffer->data);
+    buffer->data = nullptr;
+    buffer->size = 0;
+    buffer->capacity = 0;
+}
+
+uint8_t* byte_buffer_release(ByteBuffer* buffer, size_t* size) {
+    uint8_t* data = buffer->data;
+    *size = buffer->size;
+    buffer->data = nullptr;
+    buffer->size = 0;
+    buffer->capacity = 0;
+    return data;
+}
+
+String sha256_hex(const uint8_t digest[SHA256_SIZE]) {
+    char hex[SHA256_SIZE * 2 + 1];
+    for (int i = 0; i < SHA256_SIZE; i++) {
+        sprintf(hex + i * 2, "%02x", digest[i]);
+    }
+    return String(hex);
+}
+
+bool normalize_sha256_hex(String* hex) {
+    if (hex->length() != SHA256_SIZE * 2) return false;
+    for (size_t i = 0; i < hex->length(); i++) {
+        if (!isHexadecimalDigit((*hex)[i])) return false;
+    }
+    hex->toLowerCase();
+    return true;
+}
+
+String url_origin(const String& url) {
+    int start = url.indexOf("://");
+    start = (start < 0) ? 0 : start + 3;
+    int end = url.indexOf('/', start);
+    return url.substring(0, (end < 0) ? url.length() : end);
+}
+
+void download_session_close(DownloadSession* session) {
+    session->http.end();
+    session->plain.stop();
+    session->secure.stop();
+    session->origin = "";
+}
+
+// Ends a request. A connection with unread body bytes left on it
+// can't carry the next request, so it is closed instead of kept.
+static void end_request(HTTPClient& http, WiFiClient& client, bool drained) {
+    http.end();
+    if (!drained) {
+        client.stop();
+    }
+}
+
+// Blocks until the socket has data (or the peer closed), without polling.
+static bool wait_for_data(WiFiClient* stream, uint32_t timeout_ms) {
+    if (stream->available()) return true;
+
+    int fd = stream->fd();
+    if (fd < 0) return false;
+
+    fd_set readable;
+    FD_ZERO(&readable);
+    FD_SET(fd, &readable);
+    struct timeval tv = { (time_t)(timeout_ms / 1000), (suseconds_t)((timeout_ms % 1000) * 1000) };
+    return select(fd + 1, &readable, NULL, NULL, &tv) > 0 && stream->available();
+}
+
+static void report_progress(const DownloadRequest& request, size_t written, int total) {
+    if (request.progress != nullptr) {
+        request.progress(written, total, request.progress_arg);
+        return;
+    }
+
+    static size_t last_report = 0;
+    if (written < last_report) last_report = 0;
+    if (written - last_report < DOWNLOAD_PROGRESS_STEP && (int)written != total) return;
+    last_report = written;
+
+    if (total > 0) {
+        Console.printf("📊 Progress: %d/%d bytes (%.1f%%)\r", written, total, (float)written / total * 100);
+    } else {
+        Console.printf("📊 Progress: %d bytes\r", written);
+    }
+}
+
+// Reads exactly `len` payload bytes (or until close when len is
+// SIZE_MAX) straight into wherever the decoder wants them.
+static bool read_body(WiFiClient* stream, PayloadDecoder* decoder, const DownloadRequest& request,
+                      size_t len, int total) {
+    size_t remaining = len;
+    while (remaining > 0) {
+        if (request.cancel != nullptr && *request.cancel) {
+            Console.println("🚫 Download cancelled");
+            return false;
+        }
+
+        if (!wait_for_data(stream, DOWNLOAD_TIMEOUT_MS)) {
+            // A close-delimited body ends when the peer disconnects
+            return len == SIZE_MAX && !stream->connected();
+        }
+
+        size_t want = min<size_t>(stream->available(), remaining);
+        uint8_t* dst = decoder->reserve(&want);
+        if (dst == nullptr) {
+            Console.println("❌ Failed to allocate memory");
+            return false;
+        }
+
+        int c = stream->read(dst, want);
+        if (c <= 0) continue;
+        if (request.tee != nullptr && request.tee->write(dst, c) != (size_t)c) {
+            Console.println("❌ Failed to write download copy");
+            return false;
+        }
+        if (!decoder->commit(c)) {
+            return false;
+        }
+        if (request.max_bytes > 0 && decoder->decoded_bytes() > request.max_bytes) {
+            Console.printf("❌ Larger than the %u bytes allowed\n", (unsigned)request.max_bytes);
+            return false;
+        }
+        if (remaining != SIZE_MAX) remaining -= c;
+        report_progress(request, decoder->raw_bytes(), total);
+    }
+    return true;
+}
+
+// Feeds bytes kept from an interrupted attempt back through the decoder
+static bool replay_partial(Stream* source, PayloadDecoder* decoder, size_t len) {
+    size_t remaining = len;
+    while (remaining > 0) {
+        size_t want = remaining;
+        uint8_t* dst = decoder->reserve(&want);
+        if (dst == nullptr) {
+            Console.println("❌ Failed to allocate memory");
+            return false;
+        }
+        size_t n = source->readBytes((char*)dst, want);
+        if (n == 0 || !decoder->commit(n)) {
+            return false;
+        }
+        remaining -= n;
+    }
+    return true;
+}
+
+// Chunk extensions after ';' are ignored; the size itself must be
+// non-empty hex that fits in 32 bits
+static bool parse_chunk_size(const String& line, size_t* size) {
+    int end = line.indexOf(';');
+    String digits = end >= 0 ? line.substring(0, end) : line;
+    digits.trim();
+    if (digits.isEmpty() || digits.length() > 8) return false;
+    for (unsigned i = 0; i < digits.length(); i++) {
+        if (!isHexadecimalDigit(digits[i])) return false;
+    }
+    *size = strtoul(digits.c_str(), nullptr, 16);
+    return true;
+}
+
+static bool read_chunked_body(WiFiClient* stream, PayloadDecoder* decoder, const DownloadRequest& request) {
+    for (;;) {
+        String line = stream->readStringUntil('\n');
+        line.trim();
+        if (line.isEmpty() && !stream->connected()) {
+            Console.println("❌ Connection closed mid-chunk");
+            return false;
+        }
+
+        size_t chunk;
+        if (!parse_chunk_size(line, &chunk)) {
+            // A timeout reads as an empty line; neither may end the body
+            Console.printf("❌ Bad chunk size line: '%s'\n", line.c_str());
+            return false;
+        }
+        if (chunk == 0) {
+            // Skip trailers up to the terminating blank line
+            while (stream->connected() || stream->available()) {
+                String trailer = stream->readStringUntil('\n');
+                trailer.trim();
+                if (trailer.isEmpty()) break;
+            }
+            return true;
+        }
+
+        if (!read_body(stream, decoder, request, chunk, -1)) {
+            return false;
+        }
+        stream->readStringUntil('\n');  // CRLF after the chunk data
+    }
+}
+
+bool http_download(const DownloadRequest& request, ByteBuffer* out, DownloadStats* stats) {
+    *stats = DownloadStats();
+
+    if (WiFi.status() != WL_CONNECTED) {
+        Console.println("❌ WiFi not connected");
+        return false;
+    }
+
+    // Clients before the HTTPClient, which stops its client on destruction
+    DownloadSession* session = request.session;
+    bool https = request.url.startsWith("https://");
+    WiFiClient local_plain;
+    TlsSessionClient local_tls;
+    HTTPClient local_http;
+    HTTPClient& http = session ? session->http : local_http;
+    WiFiClient& client = https ? (session ? session->secure : local_tls)
+                               : (session ? session->plain : local_plain);
+    bool warm = false;
+    if (session != nullptr) {
+        String origin = url_origin(request.url);
+        if (origin != session->origin) {
+            download_session_close(session);
+            session->origin = origin;
+        }
+        warm = client.connected();
+    }
+    http.setReuse(session != nullptr);
+    http.begin(client, request.url);
+
+    const char* headers[] = { "Transfer-Encoding", "ETag", "Last-Modified", "Content-Range", "Accept-Ranges" };
+    http.setTimeout(DOWNLOAD_TIMEOUT_MS);
+    http.collectHeaders(headers, sizeof(headers) / sizeof(headers[0]));
+    // Compressed payloads are decoded on the fly, see PayloadDecoder
+    http.addHeader("Accept-Encoding", "gzip");
+    if (!request.if_none_match.isEmpty()) {
+        http.addHeader("If-None-Match", request.if_none_match);
+    }
+    if (!request.if_modified_since.isEmpty()) {
+        http.addHeader("If-Modified-Since", request.if_modified_since);
+    }
+    if (request.resume_from > 0) {
+        http.addHeader("Range", "bytes=" + String(request.resume_from) + "-");
+        if (!request.if_range.isEmpty()) {
+            http.addHeader("If-Range", request.if_range);
+        }
+    }
+
+    uint32_t start = millis();
+    int httpCode = http.GET();
+    if (httpCode < 0 && warm) {
+        // The server timed out the idle connection, open a new one
+        client.stop();
+        warm = false;
+        httpCode = http.GET();
+    }
+    if (session != nullptr) {
+        session->requests++;
+        if (!warm) session->connections++;
+        if (warm) Console.printf("🔗 Reusing connection to %s\n", session->origin.c_str());
+    }
+    stats->http_code = httpCode;
+
+    if (httpCode == HTTP_CODE_NOT_MODIFIED) {
+        Console.println("♻️  Not modified, using cached copy");
+        stats->not_modified = true;
+        end_request(http, client, true);
+        return true;
+    }
+
+    // A 206 must continue exactly where the kept bytes end
+    int total = -1;
+    bool resumed = false;
+    if (request.resume_from > 0 && httpCode == HTTP_CODE_PARTIAL_CONTENT) {
+        unsigned long first = 0, last = 0, full = 0;
+        int fields = sscanf(http.header("Content-Range").c_str(), "bytes %lu-%lu/%lu", &first, &last, &full);
+        resumed = fields >= 2 && first == request.resume_from;
+        if (fields == 3) total = full;
+    }
+    if (request.resume_from > 0 && !resumed &&
+        (httpCode == HTTP_CODE_OK || httpCode == HTTP_CODE_PARTIAL_CONTENT ||
+         httpCode == HTTP_CODE_RANGE_NOT_SATISFIABLE)) {
+        Console.println("⚠️  Server can't resume this download, starting over");
+        stats->range_ignored = true;
+        end_request(http, client, false);
+        return false;
+    }
+    if (httpCode != HTTP_CODE_OK && !resumed) {
+        Console.printf("❌ HTTP error: %d\n", httpCode);
+        end_request(http, client, false);
+        return false;
+    }
+
+    int len = http.getSize();
+    if (!resumed) total = len;
+    stats->chunked = http.header("Transfer-Encoding").equalsIgnoreCase("chunked");
+    stats->etag = http.header("ETag");
+    stats->last_modified = http.header("Last-Modified");
+    stats->resumable = !stats->chunked && len > 0 && !http.header("Accept-Ranges").equalsIgnoreCase("none");
+    WiFiClient* stream = http.getStreamPtr();
+    PayloadDecoder decoder(out, request.sink);
+
+    bool ok = true;
+    if (resumed) {
+        Console.printf("⏩ Resuming after %u bytes\n", (unsigned)request.resume_from);
+        stats->resumed_from = request.resume_from;
+        ok = replay_partial(request.resume_data, &decoder, request.resume_from);
+    }
+    bool replay_ok = ok;
+
+    if (!ok) {
+        Console.println("❌ Kept partial download is unreadable");
+    } else if (stats->chunked) {
+        Console.println("📦 Module size: unknown (chunked transfer)");
+        ok = read_chunked_body(stream, &decoder, request);
+    } else if (len > 0) {
+        Console.printf("📦 Module size: %d bytes\n", len);
+        size_t expect = total > 0 ? total : len;
+        if (request.max_bytes > 0) expect = min(expect, request.max_bytes);
+        if (request.sink != nullptr) expect = 0;   // Passes through
+        ok = byte_buffer_reserve(out, expect) && read_body(stream, &decoder, request, len, total);
+    } else {
+        Console.println("📦 Module size: unknown (reading until close)");
+        ok = read_body(stream, &decoder, request, SIZE_MAX, -1);
+    }
+    if (request.progress == nullptr) Console.println();
+    end_request(http, client, ok);
+
+    // Only a clean cut is worth resuming; bad data has to be fetched again
+    stats->interrupted = replay_ok && !ok && !decoder.failed() && decoder.raw_bytes() > 0;
+    ok = ok && decoder.finish();
+    decoder.digest(stats->sha256);
+    stats->format = decoder.format();
+    stats->raw_bytes = decoder.raw_bytes();
+    stats->bytes = decoder.decoded_bytes();
+    stats->elapsed_ms = max<uint32_t>(millis() - start, 1);
+
+    if (!ok || stats->bytes == 0) {
+        Console.printf("❌ Download incomplete: %d bytes received\n", stats->raw_bytes);
+        return false;
+    }
+
+    String digest = sha256_hex(stats->sha256);
+    if (!request.expected_sha256.isEmpty() && !request.expected_sha256.equalsIgnoreCase(digest)) {
+        Console.printf("❌ SHA-256 mismatch: expected %s, got %s\n", request.expected_sha256.c_str(), digest.c_str());
+        return false;
+    }
+
+    size_t transferred = stats->raw_bytes - stats->resumed_from;
+    Console.printf("⚡ %u bytes in %lu ms (%.1f KB/s)\n", (unsigned)transferred,
+                   (unsigned long)stats->elapsed_ms,
+                   transferred / 1024.0f / (stats->elapsed_ms / 1000.0f));
+    if (stats->format != PAYLOAD_RAW) {
+        Console.printf("🗜️  %s payload decoded to %u bytes\n",
+                       payload_format_name((PayloadFormat)stats->format), (unsigned)stats->bytes);
+    }
+    return true;
+}
@@ -0,0 +1,97 @@
+#pragma once
+#include <Arduino.h>
+#include <HTTPClient.h>
+#include <WiFiClient.h>
+#include "tls_client.h"
+
+// Growable download buffer. Prefers PSRAM and doubles its capacity as
+// data arrives, so responses without Content-Length need no second copy.
+struct ByteBuffer {
+    uint8_t* data;
+    size_t size;
+    size_t capacity;
+};
+
+bool byte_buffer_reserve(ByteBuffer* buffer, size_t extra);
+void byte_buffer_free(ByteBuffer* buffer);
+// Hands the data over to the caller (free() it) and resets the buffer
+uint8_t* byte_buffer_release(ByteBuffer* buffer, size_t* size);
+
+// A keep-alive connection shared by consecutive downloads, so a batch
+// from one server costs one TCP handshake. A request for another
+// origin closes it first; a body that wasn't read to the end does too.
+struct DownloadSession {
+    WiFiClient plain;
+    TlsSessionClient secure;
+    HTTPClient http;            // Declared last: it stops a client when destroyed
+    String origin;
+    int requests = 0;
+    int connections = 0;
+};
+
+void download_session_close(DownloadSession* session);
+// "scheme://host[:port]" part of a URL
+String url_origin(const String& url);
+
+#define SHA256_SIZE 32
+
+// Lowercase hex, the form digests are configured and stored in
+String sha256_hex(const uint8_t digest[SHA256_SIZE]);
+// True when `hex` is exactly 64 hex digits; lowercases it to that form
+bool normalize_sha256_hex(String* hex);
+
+// Called as payload bytes arrive; `total` is -1 when unknown
+typedef void (*DownloadProgressFn)(size_t received, int total, void* arg);
+
+struct DownloadRequest {
+    String url;
+    // Conditional GET validators from a cached copy, if any
+    String if_none_match;
+    String if_modified_since;
+    // Receives a copy of the raw payload as it streams in (e.g. a flash file)
+    Print* tee = nullptr;
+    // Takes the decoded bytes as they come out, instead of them piling up
+    // in `out` (which then only holds the decompression window)
+    Print* sink = nullptr;
+    // Progress reporting (defaults to a serial progress line)
+    DownloadProgressFn progress = nullptr;
+    void* progress_arg = nullptr;
+    // Set from another task to abort the transfer
+    volatile bool* cancel = nullptr;
+    // Resume: the first `resume_from` payload bytes, kept from an earlier
+    // attempt, are read back from `resume_data` and only the rest is
+    // requested (Range, guarded by If-Range). They are not teed again.
+    size_t resume_from = 0;
+    Stream* resume_data = nullptr;
+    String if_range;
+    // Keep-alive connection to reuse, if any
+    DownloadSession* session = nullptr;
+    // Hex SHA-256 the decoded bytecode must have; empty skips the check
+    String expected_sha256;
+    // Fails the transfer once more decoded bytes arrive; 0 is no limit
+    size_t max_bytes = 0;
+};
+
+struct DownloadStats {
+    int http_code;
+    size_t bytes;           // Decoded bytecode
+    size_t raw_bytes;       // Payload as transferred (maybe compressed)
+    uint8_t format;         // PayloadFormat of the payload
+    uint32_t elapsed_ms;
+    bool chunked;
+    bool not_modified;      // 304: the cached copy is still current
+    size_t resumed_from;    // Bytes replayed from `resume_data` on a 206
+    bool range_ignored;     // Resume refused (200/416/bad range), retry in full
+    bool resumable;         // Fixed-length body and ranges not refused
+    bool interrupted;       // Body cut short, but what arrived is valid
+    String etag;
+    String last_modified;
+    uint8_t sha256[SHA256_SIZE];  // Of the decoded bytecode
+};
+
+// GETs the request URL into `out` (or `sink`). Handles Content-Length, chunked
+// transfer encoding and close-delimited bodies, and decodes gzip/LZ4
+// payloads on the fly. `tee` sees the payload as transferred. Returns true for a
+// complete 200/206 body whose digest matches `expected_sha256`, or a 304
+// (stats->not_modified, `out` untouched).
+bool http_download(const DownloadRequest& request, ByteBuffer* out, DownloadStats* stats);
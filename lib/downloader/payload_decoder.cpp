@@ -0,0 +1,462 @@
+#include "payload_decoder.h"
+#include "link_frame.h"
+#include <esp_rom_crc.h>
+#if CONFIG_IDF_TARGET_ESP32S3
+#include "esp32s3/rom/miniz.h"
+#elif CONFIG_IDF_TARGET_ESP32
+#include "esp32/rom/miniz.h"
+#else
+#include "rom/miniz.h"
+#endif
+
+#define DECODER_SCRATCH_SIZE  4096
+#define DECODER_OUT_STEP      8192
+// How far back compressed data may refer, so what a sink has to leave in `out`
+#define DECODER_GZIP_WINDOW   (32 * 1024)
+#define DECODER_LZ4_WINDOW    (64 * 1024)
+
+// gzip header flags (RFC 1952)
+#define GZ_FHCRC     0x02
+#define GZ_FEXTRA    0x04
+#define GZ_FNAME     0x08
+#define GZ_FCOMMENT  0x10
+
+enum GzipState {
+    GZ_HEADER, GZ_EXTRA_LEN, GZ_EXTRA, GZ_NAME, GZ_COMMENT, GZ_HCRC, GZ_DEFLATE, GZ_TRAILER, GZ_DONE
+};
+
+// LZ4 frame flags
+#define LZ4_MAGIC            0x184D2204
+#define LZ4_FLG_BLOCK_CSUM   0x10
+#define LZ4_FLG_CONTENT_SIZE 0x08
+#define LZ4_FLG_CONTENT_CSUM 0x04
+#define LZ4_FLG_DICT_ID      0x01
+
+enum Lz4State {
+    LZ_HEADER, LZ_BLOCK_SIZE, LZ_BLOCK, LZ_BLOCK_CSUM, LZ_CONTENT_CSUM, LZ_DONE
+};
+
+const char* payload_format_name(PayloadFormat format) {
+    switch (format) {
+        case PAYLOAD_RAW:  return "raw";
+        case PAYLOAD_GZIP: return "gzip";
+        case PAYLOAD_LZ4:  return "lz4";
+        default:           return "unknown";
+    }
+}
+
+static uint32_t read_le32(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+PayloadDecoder::PayloadDecoder(ByteBuffer* out, Print* sink)
+    : _out(out), _sink(sink), _flushed(0), _dropped(0), _format(PAYLOAD_UNKNOWN), _raw_bytes(0), _failed(false), _scratch(nullptr), _hashed(0),
+      _inflate(nullptr), _gz_state(GZ_HEADER), _gz_flags(0), _gz_skip(10), _gz_trailer_len(0),
+      _crc(0), _gz_more_output(false),
+      _lz_state(LZ_HEADER), _lz_header_len(0), _lz_header_need(7), _lz_flags(0),
+      _lz_block_size(0), _lz_block_raw(false), _lz_block(), _lz_ended(false) {
+    mbedtls_sha256_init(&_sha);
+    mbedtls_sha256_starts_ret(&_sha, 0);
+}
+
+PayloadDecoder::~PayloadDecoder() {
+    mbedtls_sha256_free(&_sha);
+    free(_scratch);
+    free(_inflate);
+    byte_buffer_free(&_lz_block);
+}
+
+uint8_t* PayloadDecoder::reserve(size_t* want) {
+    if (_format == PAYLOAD_UNKNOWN || _format == PAYLOAD_RAW) {
+        // Raw bytecode is read straight into the output buffer
+        if (!byte_buffer_reserve(_out, *want)) return nullptr;
+        return _out->data + _out->size;
+    }
+    *want = min<size_t>(*want, DECODER_SCRATCH_SIZE);
+    return _scratch;
+}
+
+bool PayloadDecoder::commit(size_t len) {
+    if (_failed) return false;
+    _raw_bytes += len;
+
+    bool ok;
+    if (_format == PAYLOAD_UNKNOWN || _format == PAYLOAD_RAW) {
+        _out->size += len;
+        ok = (_format == PAYLOAD_UNKNOWN && _out->size >= 4) ? sniff() : true;
+    } else {
+        ok = decode(_scratch, len);
+    }
+    hash_output();
+    return ok && flush_output();
+}
+
+// Hashes output while it is still warm in cache, so verifying costs no
+// second pass. Nothing is hashed until sniff() has settled the format.
+void PayloadDecoder::hash_output() {
+    if (_format == PAYLOAD_UNKNOWN || _out->size <= _hashed) return;
+    mbedtls_sha256_update_ret(&_sha, _out->data + _hashed, _out->size - _hashed);
+    _hashed = _out->size;
+}
+
+// Hands new output to the sink, then drops all but the window compressed
+// input may still copy from. Dropping waits until twice the window is in,
+// so the window is only moved down once per window's worth of output.
+bool PayloadDecoder::flush_output() {
+    if (_sink == nullptr || _format == PAYLOAD_UNKNOWN) return true;
+    hash_output();
+    if (_out->size > _flushed) {
+        size_t len = _out->size - _flushed;
+        if (_sink->write(_out->data + _flushed, len) != len) {
+            Console.println("❌ Decoded output was refused");
+            _failed = true;
+            return false;
+        }
+        _flushed = _out->size;
+    }
+
+    size_t window = (_format == PAYLOAD_GZIP) ? DECODER_GZIP_WINDOW :
+                    (_format == PAYLOAD_LZ4)  ? DECODER_LZ4_WINDOW : 0;
+    if (_out->size == 0 || _out->size < 2 * window) return true;
+    size_t drop = _out->size - window;
+    memmove(_out->data, _out->data + drop, window);
+    _out->size = window;
+    _flushed -= drop;
+    _hashed -= drop;
+    _dropped += drop;
+    return true;
+}
+
+void PayloadDecoder::digest(uint8_t out[SHA256_SIZE]) {
+    hash_output();
+    mbedtls_sha256_finish_ret(&_sha, out);
+}
+
+bool PayloadDecoder::write(const uint8_t* data, size_t len) {
+    while (len > 0) {
+        size_t want = len;
+        uint8_t* dst = reserve(&want);
+        if (dst == nullptr) return false;
+        memcpy(dst, data, want);
+        if (!commit(want)) return false;
+        data += want;
+        len -= want;
+    }
+    return true;
+}
+
+// Decides the format once 4 bytes are in. Compressed bytes that were
+// read into the output buffer are moved out and decoded from the start.
+bool PayloadDecoder::sniff() {
+    const uint8_t* p = _out->data;
+    if (p[0] == 0x1f && p[1] == 0x8b) {
+        _format = PAYLOAD_GZIP;
+        _inflate = (tinfl_decompressor_tag*)malloc(sizeof(tinfl_decompressor));
+        if (_inflate == nullptr) {
+            _failed = true;
+            return false;
+        }
+        tinfl_init((tinfl_decompressor*)_inflate);
+    } else if (read_le32(p) == LZ4_MAGIC) {
+        _format = PAYLOAD_LZ4;
+    } else {
+        _format = PAYLOAD_RAW;
+        return true;
+    }
+
+    _scratch = (uint8_t*)malloc(DECODER_SCRATCH_SIZE);
+    size_t pending = _out->size;
+    uint8_t* copy = (uint8_t*)malloc(pending);
+    if (_scratch == nullptr || copy == nullptr) {
+        free(copy);
+        _failed = true;
+        return false;
+    }
+    memcpy(copy, _out->data, pending);
+    _out->size = 0;
+    bool ok = decode(copy, pending);
+    free(copy);
+    return ok;
+}
+
+bool PayloadDecoder::decode(const uint8_t* data, size_t len) {
+    bool ok = (_format == PAYLOAD_GZIP) ? decode_gzip(data, len) : decode_lz4(data, len);
+    if (!ok) _failed = true;
+    return ok;
+}
+
+// tinfl reads ahead into its bit buffer, and the ROM version doesn't put
+// what it read past the end of the deflate stream back: those bytes are
+// the start of the trailer. `in_bytes` counts them as consumed, so they
+// are taken from the bit buffer (whole bytes above the final partial
+// one, lowest first) rather than from the remaining input.
+void PayloadDecoder::take_lookahead() {
+    tinfl_decompressor* inflator = (tinfl_decompressor*)_inflate;
+    uint32_t bits = inflator->m_num_bits;
+    tinfl_bit_buf_t lookahead = inflator->m_bit_buf >> (bits & 7);
+    for (bits -= bits & 7; bits >= 8 && _gz_trailer_len < 8; bits -= 8) {
+        _gz_trailer[_gz_trailer_len++] = (uint8_t)lookahead;
+        lookahead >>= 8;
+    }
+}
+
+bool PayloadDecoder::decode_gzip(const uint8_t* data, size_t len) {
+    tinfl_decompressor* inflator = (tinfl_decompressor*)_inflate;
+
+    // Keep going while inflate still holds output, even with no input left
+    while (len > 0 || _gz_more_output) {
+        switch (_gz_state) {
+            case GZ_HEADER:
+                // Fixed 10-byte header; only the flags byte matters
+                if (_gz_skip == 7) _gz_flags = *data;
+                data++; len--;
+                if (--_gz_skip == 0) {
+                    _gz_state = (_gz_flags & GZ_FEXTRA) ? GZ_EXTRA_LEN : GZ_NAME;
+                    _gz_skip = 2;
+                }
+                break;
+
+            case GZ_EXTRA_LEN:
+                _gz_trailer[2 - _gz_skip] = *data;
+                data++; len--;
+                if (--_gz_skip == 0) {
+                    _gz_skip = _gz_trailer[0] | (_gz_trailer[1] << 8);
+                    _gz_state = _gz_skip ? GZ_EXTRA : GZ_NAME;
+                }
+                break;
+
+            case GZ_EXTRA: {
+                size_t n = min<size_t>(len, _gz_skip);
+                data += n; len -= n; _gz_skip -= n;
+                if (_gz_skip == 0) _gz_state = GZ_NAME;
+                break;
+            }
+
+            case GZ_NAME:
+            case GZ_COMMENT: {
+                uint8_t flag = (_gz_state == GZ_NAME) ? GZ_FNAME : GZ_FCOMMENT;
+                if (_gz_flags & flag) {
+                    uint8_t c = *data;
+                    data++; len--;
+                    if (c != 0) break;
+                }
+                _gz_state++;
+                _gz_skip = 2;
+                break;
+            }
+
+            case GZ_HCRC:
+                if (!(_gz_flags & GZ_FHCRC)) {
+                    _gz_state = GZ_DEFLATE;
+                    break;
+                }
+                data++; len--;
+                if (--_gz_skip == 0) _gz_state = GZ_DEFLATE;
+                break;
+
+            case GZ_DEFLATE: {
+                if (!byte_buffer_reserve(_out, DECODER_OUT_STEP)) return false;
+
+                size_t in_bytes = len;
+                size_t out_bytes = _out->capacity - _out->size;
+                tinfl_status status = tinfl_decompress(inflator, data, &in_bytes,
+                                                       _out->data, _out->data + _out->size, &out_bytes,
+                                                       TINFL_FLAG_HAS_MORE_INPUT | TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
+                data += in_bytes; len -= in_bytes;
+                _crc = esp_rom_crc32_le(_crc, _out->data + _out->size, out_bytes);
+                _out->size += out_bytes;
+                _gz_more_output = (status == TINFL_STATUS_HAS_MORE_OUTPUT);
+                if (!flush_output()) return false;
+
+                if (status == TINFL_STATUS_DONE) {
+                    take_lookahead();
+                    _gz_state = (_gz_trailer_len == 8) ? GZ_DONE : GZ_TRAILER;
+                } else if (status < 0) {
+                    Console.printf("❌ gzip: inflate failed (%d)\n", status);
+                    return false;
+                }
+                // HAS_MORE_OUTPUT loops back round and grows the buffer
+                break;
+            }
+
+            case GZ_TRAILER:
+                _gz_trailer[_gz_trailer_len++] = *data;
+                data++; len--;
+                if (_gz_trailer_len == 8) _gz_state = GZ_DONE;
+                break;
+
+            default:
+                // Trailing garbage after the member is ignored
+                return true;
+        }
+    }
+    return true;
+}
+
+bool PayloadDecoder::lz4_block(const uint8_t* src, size_t len) {
+    if (_lz_block_raw) {
+        if (!byte_buffer_reserve(_out, len)) return false;
+        memcpy(_out->data + _out->size, src, len);
+        _out->size += len;
+        return true;
+    }
+
+    // Matches may reach back into earlier blocks: they are all still in
+    // the contiguous output buffer
+    const uint8_t* end = src + len;
+    while (src < end) {
+        uint8_t token = *src++;
+
+        size_t literals = token >> 4;
+        if (literals == 15) {
+            uint8_t b;
+            do {
+                if (src >= end) return false;
+                b = *src++;
+                literals += b;
+            } while (b == 255);
+        }
+        if ((size_t)(end - src) < literals || !byte_buffer_reserve(_out, literals)) return false;
+        memcpy(_out->data + _out->size, src, literals);
+        _out->size += literals;
+        src += literals;
+
+        if (src >= end) break;  // Last sequence has no match
+
+        if (end - src < 2) return false;
+        size_t offset = src[0] | (src[1] << 8);
+        src += 2;
+        if (offset == 0 || offset > _out->size) return false;
+
+        size_t match = (token & 0x0f) + 4;
+        if ((token & 0x0f) == 15) {
+            uint8_t b;
+            do {
+                if (src >= end) return false;
+                b = *src++;
+                match += b;
+            } while (b == 255);
+        }
+
+        if (!byte_buffer_reserve(_out, match)) return false;
+        uint8_t* dst = _out->data + _out->size;
+        const uint8_t* from = dst - offset;
+        for (size_t i = 0; i < match; i++) {
+            dst[i] = from[i];  // Byte-wise: matches may overlap themselves
+        }
+        _out->size += match;
+    }
+    return true;
+}
+
+bool PayloadDecoder::decode_lz4(const uint8_t* data, size_t len) {
+    while (len > 0) {
+        switch (_lz_state) {
+            case LZ_HEADER:
+                _lz_header[_lz_header_len++] = *data;
+                data++; len--;
+                if (_lz_header_len == 5) {
+                    _lz_flags = _lz_header[4];
+                    if ((_lz_flags >> 6) != 1) {
+                        Console.println("❌ lz4: unsupported frame version");
+                        return false;
+                    }
+                    // magic + FLG + BD + HC, plus optional fields
+                    _lz_header_need = 7 + ((_lz_flags & LZ4_FLG_CONTENT_SIZE) ? 8 : 0)
+                                        + ((_lz_flags & LZ4_FLG_DICT_ID) ? 4 : 0);
+                }
+                if (_lz_header_len == _lz_header_need) {
+                    if (_lz_flags & LZ4_FLG_DICT_ID) {
+                        Console.println("❌ lz4: dictionaries are not supported");
+                        return false;
+                    }
+                    _lz_state = LZ_BLOCK_SIZE;
+                    _lz_header_len = 0;
+                }
+                break;
+
+            case LZ_BLOCK_SIZE:
+                _lz_header[_lz_header_len++] = *data;
+                data++; len--;
+                if (_lz_header_len == 4) {
+                    uint32_t size = read_le32(_lz_header);
+                    _lz_header_len = 0;
+                    if (size == 0) {
+                        _lz_ended = true;
+                        _lz_state = (_lz_flags & LZ4_FLG_CONTENT_CSUM) ? LZ_CONTENT_CSUM : LZ_DONE;
+                    } else {
+                        _lz_block_raw = size & 0x80000000;
+                        _lz_block_size = size & 0x7fffffff;
+                        _lz_block.size = 0;
+                        if (!byte_buffer_reserve(&_lz_block, _lz_block_size)) return false;
+                        _lz_state = LZ_BLOCK;
+                    }
+                }
+                break;
+
+            case LZ_BLOCK: {
+                size_t n = min<size_t>(len, _lz_block_size - _lz_block.size);
+                memcpy(_lz_block.data + _lz_block.size, data, n);
+                _lz_block.size += n;
+                data += n; len -= n;
+                if (_lz_block.size == _lz_block_size) {
+                    if (!lz4_block(_lz_block.data, _lz_block.size)) {
+                        Console.println("❌ lz4: corrupt block");
+                        return false;
+                    }
+                    if (!flush_output()) return false;
+                    _lz_state = (_lz_flags & LZ4_FLG_BLOCK_CSUM) ? LZ_BLOCK_CSUM : LZ_BLOCK_SIZE;
+                }
+                break;
+            }
+
+            case LZ_BLOCK_CSUM:
+            case LZ_CONTENT_CSUM:
+                // xxHash32 checksums are skipped; integrity comes from TCP
+                // and the content hash check on the decoded bytecode
+                data++; len--;
+                if (++_lz_header_len == 4) {
+                    _lz_header_len = 0;
+                    _lz_state = (_lz_state == LZ_BLOCK_CSUM) ? LZ_BLOCK_SIZE : LZ_DONE;
+                }
+                break;
+
+            default:
+                return true;
+        }
+    }
+    return true;
+}
+
+bool PayloadDecoder::finish() {
+    if (_failed) return false;
+
+    switch (_format) {
+        case PAYLOAD_UNKNOWN:
+            // Fewer than 4 bytes: nothing we could run anyway
+            _format = PAYLOAD_RAW;
+            hash_output();
+            return _out->size > 0 && flush_output();
+
+        case PAYLOAD_GZIP:
+            if (_gz_state != GZ_DONE) {
+                Console.println("❌ gzip: stream truncated");
+                return false;
+            }
+            if (read_le32(_gz_trailer) != _crc || read_le32(_gz_trailer + 4) != (uint32_t)decoded_bytes()) {
+                Console.println("❌ gzip: CRC or size mismatch");
+                return false;
+            }
+            return true;
+
+        case PAYLOAD_LZ4:
+            if (_lz_state != LZ_DONE) {
+                Console.println("❌ lz4: stream truncated");
+                return false;
+            }
+            return true;
+
+        default:
+            return true;
+    }
+}
@@ -0,0 +1,90 @@
+#pragma once
+#include <Arduino.h>
+#include "downloader.h"
+#include <mbedtls/sha256.h>
+
+// Turns a module payload into bytecode as it streams in. The format is
+// sniffed from the first bytes: gzip (1f 8b), LZ4 frame (04 22 4d 18),
+// anything else is taken as raw bytecode. Compressed input only ever
+// needs one small scratch buffer (or one LZ4 block), never the whole image.
+enum PayloadFormat : uint8_t {
+    PAYLOAD_UNKNOWN,
+    PAYLOAD_RAW,
+    PAYLOAD_GZIP,
+    PAYLOAD_LZ4,
+};
+
+const char* payload_format_name(PayloadFormat format);
+
+struct tinfl_decompressor_tag;
+
+class PayloadDecoder {
+public:
+    // With a `sink`, decoded bytes are handed to it as they come out and
+    // `out` only keeps what compressed formats still refer back to
+    explicit PayloadDecoder(ByteBuffer* out, Print* sink = nullptr);
+    ~PayloadDecoder();
+
+    // Zero-copy input: returns where up to `*want` raw bytes should be
+    // read to (possibly fewer, `*want` is updated), then commit() them.
+    uint8_t* reserve(size_t* want);
+    bool commit(size_t len);
+
+    // Copying input, for sources that can't read in place
+    bool write(const uint8_t* data, size_t len);
+
+    // True when the stream ended cleanly (trailers, checksums, end marks)
+    bool finish();
+
+    // SHA-256 of the decoded output, hashed as it is produced (on the
+    // SHA peripheral on the ESP32). Call once, after finish().
+    void digest(uint8_t out[SHA256_SIZE]);
+
+    PayloadFormat format() const { return _format; }
+    // The input so far is not a valid payload (as opposed to just short)
+    bool failed() const { return _failed; }
+    size_t raw_bytes() const { return _raw_bytes; }
+    size_t decoded_bytes() const { return _dropped + _out->size; }
+
+private:
+    bool sniff();
+    bool decode(const uint8_t* data, size_t len);
+    bool decode_gzip(const uint8_t* data, size_t len);
+    void take_lookahead();
+    bool decode_lz4(const uint8_t* data, size_t len);
+    bool lz4_block(const uint8_t* block, size_t len);
+    void hash_output();
+    bool flush_output();
+
+    ByteBuffer* _out;
+    Print* _sink;
+    size_t _flushed;        // Bytes of `_out` the sink has
+    size_t _dropped;        // Bytes handed on and no longer in `_out`
+    PayloadFormat _format;
+    size_t _raw_bytes;
+    bool _failed;
+    uint8_t* _scratch;
+    mbedtls_sha256_context _sha;
+    size_t _hashed;
+
+    // gzip
+    tinfl_decompressor_tag* _inflate;
+    int _gz_state;
+    uint8_t _gz_flags;
+    uint32_t _gz_skip;
+    uint8_t _gz_trailer[8];
+    uint32_t _gz_trailer_len;
+    uint32_t _crc;
+    bool _gz_more_output;
+
+    // LZ4 frame
+    int _lz_state;
+    uint8_t _lz_header[19];
+    uint32_t _lz_header_len;
+    uint32_t _lz_header_need;
+    uint8_t _lz_flags;
+    uint32_t _lz_block_size;
+    bool _lz_block_raw;
+    ByteBuffer _lz_block;
+    bool _lz_ended;
+};
@@ -0,0 +1,396 @@
+#include "tls_client.h"
+#include "link_frame.h"
+#include <LittleFS.h>
+#include <esp_system.h>
+#include <lwip/sockets.h>
+#include <mbedtls/x509_crt.h>
+#include <mbedtls/net_sockets.h>
+#include <mbedtls/error.h>
+#ifdef TLS_SESSION_PERSIST
+#include <Preferences.h>
+#endif
+
+#define TLS_SESSION_BLOB_MAX  1024
+
+struct TlsSessionSlot {
+    String host;            // "host:port"
+    mbedtls_ssl_session session;
+    uint32_t last_used;
+    bool used;
+};
+
+struct TlsStats {
+    uint32_t full;
+    uint32_t full_ms;
+    uint32_t resumed;
+    uint32_t resumed_ms;
+};
+
+static TlsSessionSlot slots[TLS_SESSION_SLOTS];
+static SemaphoreHandle_t slots_mutex = NULL;
+static uint32_t use_counter = 0;
+static TlsStats stats = {};
+
+static mbedtls_x509_crt ca_chain;
+static bool ca_loaded = false;
+
+// The hardware RNG is a true RNG while the radio is on, and unlike a
+// shared CTR-DRBG it is safe to call from several download tasks
+static int tls_random(void* ctx, unsigned char* out, size_t len) {
+    esp_fill_random(out, len);
+    return 0;
+}
+
+static void load_ca_chain() {
+    mbedtls_x509_crt_init(&ca_chain);
+    File file = LittleFS.open(TLS_CA_FILE, "r");
+    if (!file) {
+#ifdef TLS_ALLOW_INSECURE
+        Console.println("⚠️  No " TLS_CA_FILE ", HTTPS servers will not be authenticated");
+#else
+        Console.println("⚠️  No " TLS_CA_FILE ", HTTPS downloads are disabled");
+#endif
+        return;
+    }
+    String pem = file.readString();
+    file.close();
+
+    // PEM parsing wants the terminating NUL in the length
+    int ret = mbedtls_x509_crt_parse(&ca_chain, (const unsigned char*)pem.c_str(), pem.length() + 1);
+    if (ret != 0) {
+        Console.printf("❌ Failed to parse " TLS_CA_FILE " (-0x%04x)\n", -ret);
+        return;
+    }
+    ca_loaded = true;
+}
+
+#ifdef TLS_SESSION_PERSIST
+static void save_session(int index) {
+    Preferences prefs;
+    prefs.begin("tls-cache", false);
+    String key = "s" + String(index);
+    unsigned char blob[TLS_SESSION_BLOB_MAX];
+    size_t len = 0;
+    if (slots[index].used &&
+        mbedtls_ssl_session_save(&slots[index].session, blob, sizeof(blob), &len) == 0) {
+        prefs.putString(("h" + String(index)).c_str(), slots[index].host);
+        prefs.putBytes(key.c_str(), blob, len);
+    } else {
+        prefs.remove(("h" + String(index)).c_str());
+        prefs.remove(key.c_str());
+    }
+    prefs.end();
+}
+
+static void load_sessions() {
+    Preferences prefs;
+    prefs.begin("tls-cache", true);
+    unsigned char blob[TLS_SESSION_BLOB_MAX];
+    for (int i = 0; i < TLS_SESSION_SLOTS; i++) {
+        String host = prefs.getString(("h" + String(i)).c_str(), "");
+        size_t len = prefs.getBytes(("s" + String(i)).c_str(), blob, sizeof(blob));
+        if (host.isEmpty() || len == 0) continue;
+        if (mbedtls_ssl_session_load(&slots[i].session, blob, len) == 0) {
+            slots[i].host = host;
+            slots[i].used = true;
+        }
+    }
+    prefs.end();
+}
+#else
+static void save_session(int index) {}
+static void load_sessions() {}
+#endif
+
+void init_tls_client() {
+    slots_mutex = xSemaphoreCreateMutex();
+    for (int i = 0; i < TLS_SESSION_SLOTS; i++) {
+        mbedtls_ssl_session_init(&slots[i].session);
+        slots[i].used = false;
+    }
+    load_sessions();
+    load_ca_chain();
+}
+
+// Both called with slots_mutex held
+static TlsSessionSlot* find_slot(const String& host) {
+    for (int i = 0; i < TLS_SESSION_SLOTS; i++) {
+        if (slots[i].used && slots[i].host == host) return &slots[i];
+    }
+    return nullptr;
+}
+
+static TlsSessionSlot* claim_slot(const String& host) {
+    TlsSessionSlot* slot = find_slot(host);
+    if (slot == nullptr) {
+        // Least recently used one goes
+        slot = &slots[0];
+        for (int i = 0; i < TLS_SESSION_SLOTS; i++) {
+            if (!slots[i].used) { slot = &slots[i]; break; }
+            if (slots[i].last_used < slot->last_used) slot = &slots[i];
+        }
+    }
+    mbedtls_ssl_session_free(&slot->session);
+    mbedtls_ssl_session_init(&slot->session);
+    slot->host = host;
+    slot->used = true;
+    return slot;
+}
+
+void clear_tls_sessions() {
+    xSemaphoreTake(slots_mutex, portMAX_DELAY);
+    for (int i = 0; i < TLS_SESSION_SLOTS; i++) {
+        mbedtls_ssl_session_free(&slots[i].session);
+        mbedtls_ssl_session_init(&slots[i].session);
+        slots[i].used = false;
+        save_session(i);
+    }
+    xSemaphoreGive(slots_mutex);
+    Console.println("🧹 TLS sessions cleared, the next connections do full handshakes");
+}
+
+void print_tls_stats() {
+    Console.println("\n🔐 TLS Sessions:");
+    Console.println("================");
+    Console.printf("Full handshakes:    %lu", (unsigned long)stats.full);
+    if (stats.full) Console.printf(" (avg %lu ms)", (unsigned long)(stats.full_ms / stats.full));
+    Console.printf("\nResumed handshakes: %lu", (unsigned long)stats.resumed);
+    if (stats.resumed) Console.printf(" (avg %lu ms)", (unsigned long)(stats.resumed_ms / stats.resumed));
+    Console.println();
+
+    xSemaphoreTake(slots_mutex, portMAX_DELAY);
+    for (int i = 0; i < TLS_SESSION_SLOTS; i++) {
+        if (slots[i].used) Console.printf("  %s\n", slots[i].host.c_str());
+    }
+    xSemaphoreGive(slots_mutex);
+#ifdef TLS_ALLOW_INSECURE
+    Console.printf("Certificates: %s\n", ca_loaded ? "verified against " TLS_CA_FILE : "not verified");
+#else
+    Console.printf("Certificates: %s\n", ca_loaded ? "verified against " TLS_CA_FILE : "none, HTTPS refused");
+#endif
+}
+
+TlsSessionClient::TlsSessionClient() : _secure(false), _resumed(false), _peeked(-1) {
+    mbedtls_ssl_init(&_ssl);
+    mbedtls_ssl_config_init(&_conf);
+}
+
+TlsSessionClient::~TlsSessionClient() {
+    stop();
+}
+
+int TlsSessionClient::bio_send(void* ctx, const unsigned char* buf, size_t len) {
+    TlsSessionClient* client = (TlsSessionClient*)ctx;
+    size_t n = client->WiFiClient::write(buf, len);
+    return n > 0 ? (int)n : MBEDTLS_ERR_NET_SEND_FAILED;
+}
+
+int TlsSessionClient::bio_recv(void* ctx, unsigned char* buf, size_t len, uint32_t timeout_ms) {
+    TlsSessionClient* client = (TlsSessionClient*)ctx;
+    if (client->WiFiClient::available() == 0) {
+        int fd = client->fd();
+        if (fd < 0) return MBEDTLS_ERR_NET_RECV_FAILED;
+
+        fd_set readable;
+        FD_ZERO(&readable);
+        FD_SET(fd, &readable);
+        struct timeval tv = { (time_t)(timeout_ms / 1000), (suseconds_t)((timeout_ms % 1000) * 1000) };
+        if (select(fd + 1, &readable, NULL, NULL, &tv) <= 0) {
+            return MBEDTLS_ERR_SSL_TIMEOUT;
+        }
+        if (client->WiFiClient::available() == 0) {
+            return 0;   // Readable without data: the peer closed
+        }
+    }
+    int n = client->WiFiClient::read(buf, len);
+    return n > 0 ? n : MBEDTLS_ERR_NET_RECV_FAILED;
+}
+
+bool TlsSessionClient::handshake(const char* host, uint16_t port) {
+    _resumed = false;
+    if (!ca_loaded) {
+#ifdef TLS_ALLOW_INSECURE
+        Console.printf("⚠️  %s is not authenticated (TLS_ALLOW_INSECURE, no " TLS_CA_FILE ")\n", host);
+#else
+        Console.printf("❌ Refusing https://%s: no " TLS_CA_FILE " to verify it against\n", host);
+        return false;
+#endif
+    }
+
+    mbedtls_ssl_config_defaults(&_conf, MBEDTLS_SSL_IS_CLIENT, MBEDTLS_SSL_TRANSPORT_STREAM,
+                                MBEDTLS_SSL_PRESET_DEFAULT);
+    mbedtls_ssl_conf_rng(&_conf, tls_random, NULL);
+    mbedtls_ssl_conf_read_timeout(&_conf, TLS_TIMEOUT_MS);
+    if (ca_loaded) {
+        mbedtls_ssl_conf_ca_chain(&_conf, &ca_chain, NULL);
+        mbedtls_ssl_conf_authmode(&_conf, MBEDTLS_SSL_VERIFY_REQUIRED);
+    } else {
+        mbedtls_ssl_conf_authmode(&_conf, MBEDTLS_SSL_VERIFY_NONE);
+    }
+#ifdef MBEDTLS_SSL_SESSION_TICKETS
+    mbedtls_ssl_conf_session_tickets(&_conf, MBEDTLS_SSL_SESSION_TICKETS_ENABLED);
+#endif
+
+    if (mbedtls_ssl_setup(&_ssl, &_conf) != 0) {
+        Console.println("❌ TLS setup failed (out of memory?)");
+        return false;
+    }
+    mbedtls_ssl_set_hostname(&_ssl, host);
+    mbedtls_ssl_set_bio(&_ssl, this, bio_send, NULL, bio_recv);
+
+    // Offer the last session with this host, if there is one
+    String key = String(host) + ":" + String(port);
+    unsigned char offered_master[48];
+    bool offered = false;
+    xSemaphoreTake(slots_mutex, portMAX_DELAY);
+    TlsSessionSlot* slot = find_slot(key);
+    if (slot != nullptr && mbedtls_ssl_set_session(&_ssl, &slot->session) == 0) {
+        memcpy(offered_master, slot->session.master, sizeof(offered_master));
+        offered = true;
+    }
+    xSemaphoreGive(slots_mutex);
+
+    uint32_t start = millis();
+    int ret;
+    while ((ret = mbedtls_ssl_handshake(&_ssl)) != 0) {
+        if (ret != MBEDTLS_ERR_SSL_WANT_READ && ret != MBEDTLS_ERR_SSL_WANT_WRITE) {
+            char error[96];
+            mbedtls_strerror(ret, error, sizeof(error));
+            Console.printf("❌ TLS handshake with %s failed: %s\n", host, error);
+            return false;
+        }
+    }
+    uint32_t elapsed = millis() - start;
+
+    // Remember the (possibly new) session and ticket for next time. The
+    // copy comes through the public API rather than the context's
+    // internals; a resumed session carries the cached master secret over.
+    xSemaphoreTake(slots_mutex, portMAX_DELAY);
+    slot = claim_slot(key);
+    if (mbedtls_ssl_get_session(&_ssl, &slot->session) == 0) {
+        _resumed = offered && memcmp(slot->session.master, offered_master, sizeof(offered_master)) == 0;
+        slot->last_used = ++use_counter;
+        save_session(slot - slots);
+    } else {
+        slot->used = false;
+    }
+    xSemaphoreGive(slots_mutex);
+
+    if (_resumed) {
+        stats.resumed++;
+        stats.resumed_ms += elapsed;
+    } else {
+        stats.full++;
+        stats.full_ms += elapsed;
+    }
+    Console.printf("🔐 TLS handshake with %s: %lu ms (%s)\n", host, (unsigned long)elapsed,
+                   _resumed ? "resumed" : "full");
+    return true;
+}
+
+int TlsSessionClient::connect(IPAddress ip, uint16_t port) {
+    return connect(ip.toString().c_str(), port, TLS_TIMEOUT_MS);
+}
+
+int TlsSessionClient::connect(IPAddress ip, uint16_t port, int32_t timeout_ms) {
+    return connect(ip.toString().c_str(), port, timeout_ms);
+}
+
+int TlsSessionClient::connect(const char* host, uint16_t port) {
+    return connect(host, port, TLS_TIMEOUT_MS);
+}
+
+int TlsSessionClient::connect(const char* host, uint16_t port, int32_t timeout_ms) {
+    stop();
+    if (!WiFiClient::connect(host, port, timeout_ms)) {
+        return 0;
+    }
+    _secure = true;
+    if (!handshake(host, port)) {
+        stop();
+        return 0;
+    }
+    return 1;
+}
+
+size_t TlsSessionClient::write(uint8_t data) {
+    return write(&data, 1);
+}
+
+size_t TlsSessionClient::write(const uint8_t* buf, size_t size) {
+    if (!_secure) return 0;
+    size_t written = 0;
+    while (written < size) {
+        int ret = mbedtls_ssl_write(&_ssl, buf + written, size - written);
+        if (ret == MBEDTLS_ERR_SSL_WANT_READ || ret == MBEDTLS_ERR_SSL_WANT_WRITE) continue;
+        if (ret < 0) return written;
+        written += ret;
+    }
+    return written;
+}
+
+int TlsSessionClient::available() {
+    if (!_secure) return 0;
+    int pending = mbedtls_ssl_get_bytes_avail(&_ssl);
+    if (pending == 0 && WiFiClient::available() > 0) {
+        // Decrypt the next record without consuming any of it
+        mbedtls_ssl_read(&_ssl, NULL, 0);
+        pending = mbedtls_ssl_get_bytes_avail(&_ssl);
+    }
+    return pending + (_peeked >= 0 ? 1 : 0);
+}
+
+int TlsSessionClient::read() {
+    uint8_t c;
+    return read(&c, 1) == 1 ? c : -1;
+}
+
+int TlsSessionClient::read(uint8_t* buf, size_t size) {
+    if (size == 0 || available() == 0) return -1;
+
+    size_t n = 0;
+    if (_peeked >= 0) {
+        buf[n++] = (uint8_t)_peeked;
+        _peeked = -1;
+        if (n == size || mbedtls_ssl_get_bytes_avail(&_ssl) == 0) return n;
+    }
+    int ret = mbedtls_ssl_read(&_ssl, buf + n, size - n);
+    if (ret > 0) return n + ret;
+    return n > 0 ? (int)n : -1;
+}
+
+int TlsSessionClient::peek() {
+    if (_peeked < 0) {
+        uint8_t c;
+        if (read(&c, 1) != 1) return -1;
+        _peeked = c;
+    }
+    return _peeked;
+}
+
+void TlsSessionClient::flush() {
+    // Raw socket bytes are ciphertext; drop decrypted data instead
+    uint8_t scratch[64];
+    while (available() > 0 && read(scratch, sizeof(scratch)) > 0) {}
+}
+
+uint8_t TlsSessionClient::connected() {
+    return _secure && (available() > 0 || WiFiClient::connected());
+}
+
+void TlsSessionClient::release() {
+    mbedtls_ssl_free(&_ssl);
+    mbedtls_ssl_config_free(&_conf);
+    mbedtls_ssl_init(&_ssl);
+    mbedtls_ssl_config_init(&_conf);
+}
+
+void TlsSessionClient::stop() {
+    if (_secure && WiFiClient::connected()) {
+        mbedtls_ssl_close_notify(&_ssl);
+    }
+    _secure = false;
+    _peeked = -1;
+    release();
+    WiFiClient::stop();
+}
@@ -0,0 +1,63 @@
+#pragma once
+#include <Arduino.h>
+#include <WiFiClient.h>
+#include <mbedtls/ssl.h>
+
+// TLS on top of a plain WiFiClient socket that remembers the session of
+// every host it talked to, so the next connection resumes it (session
+// ticket or session ID) instead of running a full handshake. Usable
+// wherever a WiFiClient is, e.g. HTTPClient::begin(client, url).
+//
+// Server certificates are verified against TLS_CA_FILE on LittleFS.
+// Without it HTTPS is refused, unless the build has -D TLS_ALLOW_INSECURE,
+// which connects unauthenticated and says so at every connect.
+// To try it locally, tools/tls_standin.py serves a directory with a
+// self-signed certificate; copy its cert.pem to TLS_CA_FILE, fetch
+// https://<pc>:8443/module.wasm twice, then again after 'k clear' to
+// compare handshake times. test/test_tls_session does the same on target.
+//
+// Build with -D TLS_SESSION_PERSIST to keep sessions across reboots
+// (in NVS; they hold session secrets).
+#define TLS_CA_FILE         "/tls/ca.pem"
+#define TLS_SESSION_SLOTS   4
+#define TLS_TIMEOUT_MS      10000
+
+class TlsSessionClient : public WiFiClient {
+public:
+    TlsSessionClient();
+    ~TlsSessionClient();
+
+    int connect(IPAddress ip, uint16_t port);
+    int connect(IPAddress ip, uint16_t port, int32_t timeout_ms);
+    int connect(const char* host, uint16_t port);
+    int connect(const char* host, uint16_t port, int32_t timeout_ms);
+
+    size_t write(uint8_t data);
+    size_t write(const uint8_t* buf, size_t size);
+    int available();
+    int read();
+    int read(uint8_t* buf, size_t size);
+    int peek();
+    void flush();
+    void stop();
+    uint8_t connected();
+    // Whether the last handshake resumed a remembered session
+    bool resumed() const { return _resumed; }
+
+private:
+    bool handshake(const char* host, uint16_t port);
+    void release();
+
+    static int bio_send(void* ctx, const unsigned char* buf, size_t len);
+    static int bio_recv(void* ctx, unsigned char* buf, size_t len, uint32_t timeout_ms);
+
+    mbedtls_ssl_context _ssl;
+    mbedtls_ssl_config _conf;
+    bool _secure;
+    bool _resumed;
+    int _peeked;
+};
+
+void init_tls_client();
+void clear_tls_sessions();
+void print_tls_stats();
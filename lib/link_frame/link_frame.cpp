@@ -0,0 +1,94 @@
+#include "link_frame.h"
+#include <esp_rom_crc.h>
+
+ConsoleOutput Console;
+
+static uint32_t read_le32(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void write_le32(uint8_t* p, uint32_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+size_t cobs_encode(const uint8_t* in, size_t len, uint8_t* out) {
+    size_t code_at = 0;
+    size_t n = 1;
+    uint8_t code = 1;
+    for (size_t i = 0; i < len; i++) {
+        if (in[i] != 0) {
+            out[n++] = in[i];
+            code++;
+        }
+        if (in[i] == 0 || code == 0xFF) {
+            out[code_at] = code;
+            code_at = n++;
+            code = 1;
+        }
+    }
+    out[code_at] = code;
+    return n;
+}
+
+size_t cobs_decode(uint8_t* buf, size_t len) {
+    size_t in = 0;
+    size_t out = 0;
+    while (in < len) {
+        uint8_t code = buf[in++];
+        if (code == 0 || code - 1 > (int)(len - in)) return 0;
+        for (int i = 1; i < code; i++) {
+            buf[out++] = buf[in++];
+        }
+        if (code < 0xFF && in < len) buf[out++] = 0;
+    }
+    return out;
+}
+
+size_t link_frame_encode(uint8_t type, uint8_t seq, const uint8_t* payload, size_t len, uint8_t* out) {
+    uint8_t frame[LINK_HEADER_SIZE + LINK_REPLY_MAX + LINK_CRC_SIZE];
+    len = min<size_t>(len, LINK_REPLY_MAX);
+    frame[0] = type;
+    frame[1] = seq;
+    if (len) memcpy(frame + LINK_HEADER_SIZE, payload, len);
+    size_t n = LINK_HEADER_SIZE + len;
+    write_le32(frame + n, esp_rom_crc32_le(0, frame, n));
+    n += LINK_CRC_SIZE;
+
+    out[0] = 0;
+    size_t encoded = 1 + cobs_encode(frame, n, out + 1);
+    out[encoded++] = 0;
+    return encoded;
+}
+
+bool link_frame_decode(uint8_t* buf, size_t len, size_t* payload_len) {
+    size_t n = cobs_decode(buf, len);
+    if (n < LINK_HEADER_SIZE + LINK_CRC_SIZE ||
+        esp_rom_crc32_le(0, buf, n - LINK_CRC_SIZE) != read_le32(buf + n - LINK_CRC_SIZE)) {
+        return false;
+    }
+    *payload_len = n - LINK_HEADER_SIZE - LINK_CRC_SIZE;
+    return true;
+}
+
+size_t ConsoleOutput::write(const uint8_t* data, size_t len) {
+    if (!_framed) return Serial.write(data, len);
+
+    bool output = _request_task != nullptr && xTaskGetCurrentTaskHandle() == _request_task;
+    uint8_t type = output ? LINK_OUTPUT : LINK_LOG;
+    uint8_t seq = output ? _request_seq : 0;
+    // One write per frame, so frames from other tasks only land between them
+    uint8_t wire[LINK_WIRE_MAX(LINK_REPLY_MAX)];
+    for (size_t pos = 0; pos < len; pos += LINK_REPLY_MAX) {
+        size_t n = min<size_t>(len - pos, LINK_REPLY_MAX);
+        Serial.write(wire, link_frame_encode(type, seq, data + pos, n, wire));
+    }
+    return len;
+}
+
+void ConsoleOutput::begin_request(uint8_t seq) {
+    _request_seq = seq;
+    _request_task = xTaskGetCurrentTaskHandle();
+}
@@ -0,0 +1,67 @@
+#pragma once
+#include <Arduino.h>
+
+// Frames of the serial link protocol (serial_link.h), and Console, which
+// everything the firmware prints goes through. Decoded, a frame is
+//
+//   type (u8)  seq (u8)  payload  CRC-32 of the rest (u32)
+//
+// and on the wire it is COBS-encoded between two 0x00 bytes.
+#define LINK_HEADER_SIZE    2       // type, seq
+#define LINK_CRC_SIZE       4
+#define LINK_REPLY_MAX      96      // Payload of a device frame
+#define COBS_MAX_SIZE(n)    ((n) + (n) / 254 + 1)
+#define LINK_WIRE_MAX(n)    (COBS_MAX_SIZE(LINK_HEADER_SIZE + (n) + LINK_CRC_SIZE) + 2)
+
+enum LinkFrame {
+    LINK_HELLO = 0x01,
+    LINK_COMMAND = 0x02,
+    LINK_BEGIN = 0x03,
+    LINK_DATA = 0x04,
+    LINK_END = 0x05,
+    LINK_CLOSE = 0x06,
+
+    LINK_REPLY_HELLO = 0x81,
+    LINK_REPLY_DONE = 0x82,
+    LINK_REPLY_ACK = 0x83,
+    LINK_REPLY_MODULE = 0x85,
+    LINK_OUTPUT = 0x90,
+    LINK_LOG = 0x91,
+    LINK_REPLY_ERROR = 0xFF,
+};
+
+size_t cobs_encode(const uint8_t* in, size_t len, uint8_t* out);
+// In place; 0 when malformed
+size_t cobs_decode(uint8_t* buf, size_t len);
+
+// Writes the frame, delimiters included, to `out` (LINK_WIRE_MAX(len)
+// bytes) and returns its length
+size_t link_frame_encode(uint8_t type, uint8_t seq, const uint8_t* payload, size_t len, uint8_t* out);
+// Decodes `len` bytes received between delimiters in place; false when
+// malformed or the CRC is wrong. `*payload_len` excludes type, seq and CRC.
+bool link_frame_decode(uint8_t* buf, size_t len, size_t* payload_len);
+
+// Print that stands in for Serial in the firmware's output. Plain text
+// normally; while the serial link is active, what is printed while it
+// handles a request goes out in OUTPUT frames with that request's seq,
+// and everything printed by other tasks or between requests in LOG
+// frames, so the host can tell them apart from replies and each other.
+class ConsoleOutput : public Print {
+public:
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* data, size_t len) override;
+    using Print::write;
+
+    // From serial_link, as the link starts and stops and around each
+    // request, on the task that handles them
+    void set_framed(bool framed) { _framed = framed; }
+    void begin_request(uint8_t seq);
+    void end_request() { _request_task = nullptr; }
+
+private:
+    volatile bool _framed = false;
+    TaskHandle_t volatile _request_task = nullptr;
+    uint8_t _request_seq = 0;
+};
+
+extern ConsoleOutput Console;
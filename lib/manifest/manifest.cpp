@@ -0,0 +1,195 @@
+#include "manifest.h"
+#include "link_frame.h"
+#include <ArduinoJson.h>
+#include <Preferences.h>
+#include <set>
+#include "modules.h"
+#include "downloader.h"
+#include "download_manager.h"
+#include "console_args.h"
+#include "module_store.h"
+
+#define MANIFEST_TASK_STACK  (12 * 1024)    // Room for a TLS handshake
+
+extern int current_module;
+
+struct ManifestSync {
+    String url;
+    bool prune;
+};
+
+static volatile bool sync_running = false;
+static TaskHandle_t sync_task = NULL;
+static volatile bool save_pending = false;   // For the console task, see service_manifest_sync()
+
+static String resolve_url(const String& base, const String& url) {
+    if (url.indexOf("://") > 0) return url;
+    if (url.startsWith("/")) return url_origin(base) + url;
+    return base.substring(0, base.lastIndexOf('/') + 1) + url;
+}
+
+// A patch from the bytecode the module runs now, if the entry lists one
+static String pick_delta(int id, JsonArrayConst deltas, const String& base_url) {
+    uint8_t digest[SHA256_SIZE];
+    if (deltas.isNull() || !module_bytecode_sha256(id, digest)) return "";
+
+    String current = sha256_hex(digest);
+    for (JsonObjectConst delta : deltas) {
+        String from = delta["from"] | "";
+        String url = delta["url"] | "";
+        if (!url.isEmpty() && current.equalsIgnoreCase(from)) {
+            return resolve_url(base_url, url);
+        }
+    }
+    return "";
+}
+
+bool sync_manifest(const String& url, bool prune) {
+    Console.printf("📜 Fetching manifest: %s\n", url.c_str());
+
+    DownloadRequest request;
+    request.url = url;
+    request.max_bytes = MANIFEST_MAX_SIZE;
+    ByteBuffer buffer = {};
+    DownloadStats stats;
+    if (!http_download(request, &buffer, &stats)) {
+        byte_buffer_free(&buffer);
+        return false;
+    }
+
+    JsonDocument doc;
+    DeserializationError error = deserializeJson(doc, (const char*)buffer.data, buffer.size);
+    byte_buffer_free(&buffer);
+    if (error) {
+        Console.printf("❌ Manifest is not valid JSON: %s\n", error.c_str());
+        return false;
+    }
+
+    // Either {"modules": [...]} or a bare array
+    JsonArray entries = doc["modules"].is<JsonArray>() ? doc["modules"].as<JsonArray>() : doc.as<JsonArray>();
+    if (entries.isNull()) {
+        Console.println("❌ Manifest has no module list");
+        return false;
+    }
+
+    bool changed = false;
+    std::set<int> listed;
+    std::vector<int> selected;
+    int added = 0, updated = 0, unchanged = 0;
+
+    for (JsonObject entry : entries) {
+        String name = entry["name"] | "";
+        String module_url = entry["url"] | "";
+        String sha256 = entry["sha256"] | "";
+        String version = entry["version"] | "";
+        if (name.isEmpty() || module_url.isEmpty()) {
+            Console.println("⚠️  Skipping manifest entry without name or URL");
+            continue;
+        }
+        if (!sha256.isEmpty() && !normalize_sha256_hex(&sha256)) {
+            Console.printf("⚠️  Skipping %s: sha256 must be 64 hex digits\n", name.c_str());
+            continue;
+        }
+        module_url = resolve_url(url, module_url);
+
+        int id = find_module_by_name(name);
+        bool is_new = id < 0;
+        if (is_new) {
+            id = add_module(name, module_url);
+            if (id < 0) continue;
+        }
+
+        WasmModule* mod = get_module(id);
+        bool differs = is_new || module_url != mod->url || sha256 != mod->sha256 || version != mod->version;
+        listed.insert(id);
+        if (differs) {
+            String delta_url = pick_delta(id, entry["deltas"].as<JsonArrayConst>(), url);
+            set_module_delta(id, delta_url);
+            set_module_source(id, module_url, sha256, version);
+            changed = true;
+            if (is_new) added++; else updated++;
+            Console.printf("   %s %s%s%s (%d bytes%s)\n", is_new ? "➕" : "🔄", name.c_str(),
+                           version.isEmpty() ? "" : " v", version.c_str(), (int)(entry["size"] | 0),
+                           delta_url.isEmpty() ? "" : ", delta available");
+        } else {
+            unchanged++;
+        }
+        if (differs || !mod->loaded) selected.push_back(id);
+    }
+
+    int unlisted = 0;
+    for (int id : module_ids()) {
+        WasmModule* mod = get_module(id);
+        if (mod == nullptr || listed.count(id)) continue;
+        if (prune && id != current_module && !download_pending(id)) {
+            Console.printf("   ➖ %s\n", mod->name);
+            changed |= remove_module(id);
+        } else {
+            unlisted++;
+        }
+    }
+
+    Console.printf("📜 Manifest: %d new, %d updated, %d unchanged", added, updated, unchanged);
+    if (unlisted > 0) Console.printf(", %d not listed (kept)", unlisted);
+    Console.println();
+
+    queue_download_batch(selected);
+    return changed;
+}
+
+static void manifest_task(void* parameter) {
+    ManifestSync* sync = (ManifestSync*)parameter;
+    if (sync_manifest(sync->url, sync->prune)) {
+        save_pending = true;
+    }
+    delete sync;
+    sync_running = false;
+    vTaskDelete(NULL);
+}
+
+bool manifest_sync_active() {
+    return sync_running && xTaskGetCurrentTaskHandle() != sync_task;
+}
+
+void service_manifest_sync() {
+    if (save_pending) {
+        save_pending = false;
+        save_module_list();
+    }
+}
+
+void handle_manifest_command(String args) {
+    if (sync_running) {
+        Console.println("⏳ A manifest sync is already running");
+        return;
+    }
+
+    Preferences prefs;
+    prefs.begin("wasm-manifest", false);
+
+    String url = prefs.getString("url", "");
+    bool prune = false;
+    for (String token = take_token(args); !token.isEmpty(); token = take_token(args)) {
+        if (token == "prune") {
+            prune = true;
+        } else {
+            url = token;
+            prefs.putString("url", url);
+        }
+    }
+    prefs.end();
+
+    if (url.isEmpty()) {
+        Console.println("❌ Usage: u <manifest url> [prune]");
+        return;
+    }
+
+    // Off the console task, which must keep reading input meanwhile
+    sync_running = true;
+    ManifestSync* sync = new ManifestSync{url, prune};
+    if (xTaskCreate(&manifest_task, "manifest", MANIFEST_TASK_STACK, sync, 2, &sync_task) != pdPASS) {
+        Console.println("❌ Failed to start the manifest sync");
+        delete sync;
+        sync_running = false;
+    }
+}
@@ -0,0 +1,30 @@
+#pragma once
+#include <Arduino.h>
+
+// Module catalog: one JSON document lists every module a device should
+// have, so fleets are configured by publishing a file instead of typing
+// URLs into each device:
+//
+//   { "modules": [
+//       { "name": "blink", "url": "blink.wasm.gz", "version": "1.2",
+//         "size": 1834, "sha256": "9f86d0...",
+//         "deltas": [ { "from": "<sha256 of 1.1>", "url": "blink-1.1-1.2.wdp" } ] } ] }
+//
+// Relative URLs resolve against the manifest's own URL. Syncing adds
+// modules that are new, repoints the ones whose URL, digest or version
+// changed, and queues downloads for those (and for any not yet loaded)
+// in per-host batches. Modules missing from the manifest are only
+// removed when pruning. Blocks on the network: call it from a worker
+// task. Returns true when the module list changed and needs saving.
+#define MANIFEST_MAX_SIZE    (32 * 1024)   // Parsed whole, so kept small
+bool sync_manifest(const String& url, bool prune);
+
+// Serial command 'u': [url] [prune]. The URL is remembered for next time.
+// The sync runs on its own task and holds module entries meanwhile.
+void handle_manifest_command(String args);
+// True while a sync runs on another task than the caller's; nothing else
+// may remove modules then
+bool manifest_sync_active();
+// From the console task, which saves the module list for a sync that
+// changed it (module_store is not safe to save from two tasks)
+void service_manifest_sync();
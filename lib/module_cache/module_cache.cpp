@@ -0,0 +1,371 @@
+#include "module_cache.h"
+#include "link_frame.h"
+#include <LittleFS.h>
+#include <WiFi.h>
+#include "payload_decoder.h"
+#include "delta_patch.h"
+
+#define CACHE_FETCH_ATTEMPTS    3
+#define CACHE_WIFI_WAIT_MS      15000
+
+static bool cache_ready = false;
+
+// Bytes of an interrupted download (.part) and the validators of the
+// response they came from (.pmeta), so the rest can be fetched with If-Range
+struct PartialEntry {
+    String etag;
+    String last_modified;
+    size_t size;
+};
+
+// FNV-1a of the URL names the cache files
+static String cache_path(const String& url, const char* ext) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < url.length(); i++) {
+        hash = (hash ^ (uint8_t)url[i]) * 16777619u;
+    }
+    char path[48];
+    snprintf(path, sizeof(path), MODULE_CACHE_DIR "/%08lx.%s", (unsigned long)hash, ext);
+    return String(path);
+}
+
+bool init_module_cache() {
+    if (!LittleFS.begin(true)) {
+        Console.println("❌ Failed to mount LittleFS, module cache disabled");
+        return false;
+    }
+    if (!LittleFS.exists(MODULE_CACHE_DIR)) {
+        LittleFS.mkdir(MODULE_CACHE_DIR);
+    }
+    cache_ready = true;
+    Console.printf("💾 Module cache: %u/%u KB used\n",
+                   (unsigned)(LittleFS.usedBytes() / 1024), (unsigned)(LittleFS.totalBytes() / 1024));
+    return true;
+}
+
+bool cache_lookup(const String& url, CacheEntry* entry) {
+    if (!cache_ready) return false;
+
+    File meta = LittleFS.open(cache_path(url, "meta"), "r");
+    if (!meta) return false;
+
+    entry->url = meta.readStringUntil('\n');
+    entry->etag = meta.readStringUntil('\n');
+    entry->last_modified = meta.readStringUntil('\n');
+    entry->size = meta.readStringUntil('\n').toInt();
+    entry->sha256 = meta.readStringUntil('\n');
+    meta.close();
+
+    // Guard against hash collisions and half-written entries
+    return entry->url == url && LittleFS.exists(cache_path(url, "wasm"));
+}
+
+static void write_meta(const String& url, const DownloadStats& stats) {
+    File meta = LittleFS.open(cache_path(url, "meta"), "w");
+    if (!meta) return;
+    meta.printf("%s\n%s\n%s\n%u\n%s\n", url.c_str(), stats.etag.c_str(), stats.last_modified.c_str(),
+                (unsigned)stats.raw_bytes, sha256_hex(stats.sha256).c_str());
+    meta.close();
+}
+
+// Decodes a stored payload (raw, gzip or LZ4) into `out`
+static bool decode_file(const String& path, ByteBuffer* out, uint8_t digest[SHA256_SIZE]) {
+    File file = LittleFS.open(path, "r");
+    if (!file) return false;
+
+    PayloadDecoder decoder(out);
+    bool ok = true;
+    while (ok && file.available()) {
+        size_t want = file.available();
+        uint8_t* dst = decoder.reserve(&want);
+        int n = dst ? file.read(dst, want) : -1;
+        ok = n > 0 && decoder.commit(n);
+    }
+    file.close();
+    if (!ok || !decoder.finish()) return false;
+    decoder.digest(digest);
+    return true;
+}
+
+bool cache_load(const String& url, ByteBuffer* out, const String& expected_sha256) {
+    CacheEntry entry;
+    if (!cache_lookup(url, &entry)) return false;
+
+    // Stored as downloaded, so compressed payloads stay compressed on flash
+    uint8_t digest[SHA256_SIZE];
+    if (!decode_file(cache_path(url, "wasm"), out, digest)) return false;
+
+    String hex = sha256_hex(digest);
+    if ((!entry.sha256.isEmpty() && hex != entry.sha256) ||
+        (!expected_sha256.isEmpty() && !expected_sha256.equalsIgnoreCase(hex))) {
+        Console.printf("❌ Cached copy of %s fails its SHA-256 check\n", url.c_str());
+        return false;
+    }
+    return true;
+}
+
+static bool partial_lookup(const String& url, PartialEntry* partial) {
+    File meta = LittleFS.open(cache_path(url, "pmeta"), "r");
+    if (!meta) return false;
+    String stored_url = meta.readStringUntil('\n');
+    partial->etag = meta.readStringUntil('\n');
+    partial->last_modified = meta.readStringUntil('\n');
+    meta.close();
+
+    File part = LittleFS.open(cache_path(url, "part"), "r");
+    if (!part) return false;
+    partial->size = part.size();
+    part.close();
+    return stored_url == url && partial->size > 0;
+}
+
+static void partial_discard(const String& url) {
+    LittleFS.remove(cache_path(url, "pmeta"));
+    LittleFS.remove(cache_path(url, "part"));
+}
+
+// If-Range needs a strong ETag or a date; weak ETags never match
+static String range_validator(const String& etag, const String& last_modified) {
+    if (!etag.isEmpty() && !etag.startsWith("W/")) return etag;
+    return last_modified;
+}
+
+void cache_remove(const String& url) {
+    if (!cache_ready) return;
+    LittleFS.remove(cache_path(url, "meta"));
+    LittleFS.remove(cache_path(url, "wasm"));
+    partial_discard(url);
+}
+
+// One transfer, resuming from a kept .part file when there is one.
+// Leaves a .part behind only when a later attempt can pick it up.
+static bool fetch_once(DownloadRequest request, ByteBuffer* out, DownloadStats* stats) {
+    const String& url = request.url;
+    if (!cache_ready) {
+        return http_download(request, out, stats);
+    }
+
+    String part_path = cache_path(url, "part");
+    PartialEntry partial;
+    bool have_partial = partial_lookup(url, &partial);
+    File replay;
+    File part;
+    if (have_partial) {
+        replay = LittleFS.open(part_path, "r");
+        part = LittleFS.open(part_path, "a");
+        request.resume_from = partial.size;
+        request.resume_data = &replay;
+        request.if_range = range_validator(partial.etag, partial.last_modified);
+    } else {
+        part = LittleFS.open(part_path, "w");
+    }
+    if (part) request.tee = &part;
+
+    bool ok = http_download(request, out, stats);
+    if (part) part.close();
+    if (replay) replay.close();
+
+    // A 206 may leave out the validators; they are the kept ones then
+    if (have_partial && stats->etag.isEmpty() && stats->last_modified.isEmpty()) {
+        stats->etag = partial.etag;
+        stats->last_modified = partial.last_modified;
+    }
+
+    if (ok && stats->not_modified) {
+        partial_discard(url);
+        return true;
+    }
+
+    if (ok) {
+        LittleFS.remove(cache_path(url, "pmeta"));
+        if (part) {
+            String wasm_path = cache_path(url, "wasm");
+            LittleFS.remove(cache_path(url, "meta"));
+            LittleFS.remove(wasm_path);
+            if (LittleFS.rename(part_path, wasm_path)) {
+                write_meta(url, *stats);
+            }
+        }
+        return true;
+    }
+
+    bool validated = !range_validator(stats->etag, stats->last_modified).isEmpty();
+    if (stats->interrupted && stats->resumable && validated && part) {
+        File meta = LittleFS.open(cache_path(url, "pmeta"), "w");
+        if (meta) {
+            meta.printf("%s\n%s\n%s\n", url.c_str(), stats->etag.c_str(), stats->last_modified.c_str());
+            meta.close();
+            Console.printf("💾 Kept %u bytes, the next attempt resumes from there\n",
+                           (unsigned)stats->raw_bytes);
+            return false;
+        }
+    }
+
+    // Failing before any body arrived leaves an earlier .part as it was
+    if (!have_partial || stats->raw_bytes > 0 || stats->range_ignored) {
+        partial_discard(url);
+    }
+    return false;
+}
+
+// fetch_once() a few times in a row while the transfer can resume
+static bool fetch_with_retries(const DownloadRequest& request, ByteBuffer* out, DownloadStats* stats) {
+    bool ok = false;
+    for (int attempt = 1; attempt <= CACHE_FETCH_ATTEMPTS; attempt++) {
+        byte_buffer_free(out);
+        ok = fetch_once(request, out, stats);
+        if (ok) break;
+
+        bool cancelled = request.cancel != nullptr && *request.cancel;
+        bool retry = stats->range_ignored || (stats->interrupted && stats->resumable);
+        if (cancelled || !retry || attempt == CACHE_FETCH_ATTEMPTS) break;
+
+        // Give a dropped link a moment to come back before resuming
+        uint32_t start = millis();
+        while (WiFi.status() != WL_CONNECTED && millis() - start < CACHE_WIFI_WAIT_MS) {
+            delay(500);
+        }
+        Console.printf("🔁 Retrying download (attempt %d/%d)\n", attempt + 1, CACHE_FETCH_ATTEMPTS);
+    }
+    return ok;
+}
+
+bool cached_fetch(DownloadRequest request, ByteBuffer* out, bool* not_modified) {
+    *not_modified = false;
+    const String& url = request.url;
+
+    CacheEntry entry;
+    if (cache_lookup(url, &entry)) {
+        request.if_none_match = entry.etag;
+        request.if_modified_since = entry.last_modified;
+    }
+
+    DownloadStats stats;
+    bool ok = fetch_with_retries(request, out, &stats);
+    if (!ok || !stats.not_modified) return ok;
+
+    if (cache_load(url, out, request.expected_sha256)) {
+        *not_modified = true;
+        return true;
+    }
+
+    // The server says the flash copy is current, but it doesn't load (bad
+    // flash, wrong digest): drop it and fetch once more without validators
+    Console.printf("⚠️  Cached copy of %s is unusable, downloading it again\n", url.c_str());
+    cache_remove(url);
+    request.if_none_match = "";
+    request.if_modified_since = "";
+    ok = fetch_with_retries(request, out, &stats);
+    return ok && !stats.not_modified;
+}
+
+// Applies a patch as the download loop decodes it
+class PatchSink : public Print {
+public:
+    explicit PatchSink(DeltaPatcher* patcher) : _patcher(patcher) {}
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* data, size_t len) override {
+        return _patcher->write(data, len) ? len : 0;
+    }
+
+private:
+    DeltaPatcher* _patcher;
+};
+
+bool delta_fetch(DownloadRequest request, const String& patch_url,
+                 const uint8_t* base, size_t base_size, ByteBuffer* out) {
+    String url = request.url;
+    String expected_sha256 = request.expected_sha256;
+    Console.printf("🩹 Fetching delta: %s\n", patch_url.c_str());
+
+    // The patch streams into the patcher; only the rebuilt image (and a
+    // gzip/LZ4 window, if the patch is compressed) is held in memory
+    DeltaPatcher patcher(base, base_size, out);
+    PatchSink sink(&patcher);
+    ByteBuffer window = {};
+    DownloadStats stats;
+    request.url = patch_url;
+    request.expected_sha256 = "";
+    request.sink = &sink;
+    bool ok = http_download(request, &window, &stats) && patcher.finish();
+    size_t patch_size = stats.raw_bytes;
+    byte_buffer_free(&window);
+    if (!ok) return false;
+
+    String hex = sha256_hex(patcher.new_sha256());
+    if (!expected_sha256.isEmpty() && !expected_sha256.equalsIgnoreCase(hex)) {
+        Console.println("❌ Patched module does not match the expected SHA-256");
+        return false;
+    }
+    Console.printf("🩹 %u byte patch rebuilt %u bytes\n", (unsigned)patch_size, (unsigned)out->size);
+
+    // Becomes the flash copy of the new URL
+    cache_store(url, out->data, out->size, patcher.new_sha256());
+    return true;
+}
+
+bool cache_store(const String& url, const uint8_t* data, size_t size, const uint8_t* sha256) {
+    if (!cache_ready) return false;
+
+    DownloadStats stored = DownloadStats();
+    stored.raw_bytes = size;
+    memcpy(stored.sha256, sha256, SHA256_SIZE);
+    File file = LittleFS.open(cache_path(url, "wasm"), "w");
+    if (file && file.write(data, size) == size) {
+        file.close();
+        write_meta(url, stored);
+        return true;
+    }
+    if (file) file.close();
+    cache_remove(url);
+    return false;
+}
+
+// One upload at a time: the upload server handles a single client
+static File upload_file;
+static String upload_url;
+static DownloadStats upload_stats;
+
+bool cache_upload_begin(const String& url) {
+    if (!cache_ready) return false;
+    cache_upload_abort();
+    upload_url = url;
+    upload_stats = DownloadStats();
+    upload_file = LittleFS.open(cache_path(url, "upload"), "w");
+    return (bool)upload_file;
+}
+
+bool cache_upload_active() {
+    return !upload_url.isEmpty();
+}
+
+bool cache_upload_write(const uint8_t* data, size_t len) {
+    if (!upload_file || upload_file.write(data, len) != len) return false;
+    upload_stats.raw_bytes += len;
+    return true;
+}
+
+bool cache_upload_finish(ByteBuffer* out) {
+    if (!upload_file) return false;
+    upload_file.close();
+    return decode_file(cache_path(upload_url, "upload"), out, upload_stats.sha256);
+}
+
+bool cache_upload_commit() {
+    if (upload_url.isEmpty()) return false;
+    String wasm_path = cache_path(upload_url, "wasm");
+    LittleFS.remove(cache_path(upload_url, "meta"));
+    LittleFS.remove(wasm_path);
+    bool ok = LittleFS.rename(cache_path(upload_url, "upload"), wasm_path);
+    if (ok) write_meta(upload_url, upload_stats);
+    upload_url = "";
+    return ok;
+}
+
+void cache_upload_abort() {
+    if (upload_file) upload_file.close();
+    if (!upload_url.isEmpty()) {
+        LittleFS.remove(cache_path(upload_url, "upload"));
+        upload_url = "";
+    }
+}
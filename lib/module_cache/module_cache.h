@@ -0,0 +1,57 @@
+#pragma once
+#include <Arduino.h>
+#include "downloader.h"
+
+// On-flash (LittleFS) copies of downloaded modules, keyed by URL, with
+// the ETag/Last-Modified validators needed to revalidate them cheaply.
+// Payloads are stored exactly as served, so gzip/LZ4 modules stay
+// compressed on flash and are decoded while loading.
+#define MODULE_CACHE_DIR "/modules"
+
+struct CacheEntry {
+    String url;
+    String etag;
+    String last_modified;
+    size_t size;        // Stored (possibly compressed) size
+    String sha256;      // Of the decoded bytecode, hex
+};
+
+bool init_module_cache();
+bool cache_lookup(const String& url, CacheEntry* entry);
+// Decodes the flash copy and checks it against the digest recorded at
+// download time and, when given, the one the module entry expects
+bool cache_load(const String& url, ByteBuffer* out, const String& expected_sha256 = "");
+void cache_remove(const String& url);
+// Writes decoded bytecode as `url`'s flash copy, without validators: the
+// next fetch is unconditional but the bytes load at boot
+bool cache_store(const String& url, const uint8_t* data, size_t size, const uint8_t* sha256);
+
+// Fetches `request.url`, revalidating a cached copy with If-None-Match /
+// If-Modified-Since and refreshing the cache on a 200. The body streams
+// to flash while it downloads; if the link drops, what arrived is kept
+// and the transfer resumes with a Range request (a few times in a row,
+// or on the next call), starting over when the server can't resume.
+// On a 304 `out` is filled from flash; a flash copy that then fails to
+// load is dropped and fetched again in full. Progress and cancellation
+// are taken from `request`.
+bool cached_fetch(DownloadRequest request, ByteBuffer* out, bool* not_modified);
+
+// Builds `request.url`'s new version from `base` and the patch at
+// `patch_url` (see DeltaPatcher), checks it against the patch and
+// `request.expected_sha256`, and caches it as that URL's flash copy.
+// On false the caller falls back to a full download.
+bool delta_fetch(DownloadRequest request, const String& patch_url,
+                 const uint8_t* base, size_t base_size, ByteBuffer* out);
+
+// Modules pushed to the device (upload_server.h) stream into a file next
+// to `url`'s flash copy, so nothing module-sized is held in RAM while the
+// body arrives. finish() decodes it (raw, gzip or LZ4, like a download)
+// into `out`; commit() then makes it the flash copy, replacing the old
+// one, and abort() throws it away. One upload at a time; begin() drops
+// one still in progress.
+bool cache_upload_begin(const String& url);
+bool cache_upload_active();
+bool cache_upload_write(const uint8_t* data, size_t len);
+bool cache_upload_finish(ByteBuffer* out);
+bool cache_upload_commit();
+void cache_upload_abort();
@@ -0,0 +1,119 @@
+#include "module_arena.h"
+#include "link_frame.h"
+#include <esp_heap_caps.h>
+#include <vector>
+
+struct ArenaBlock {
+    size_t offset;
+    size_t size;            // Rounded up to ARENA_ALIGN
+    uint8_t** owner;
+};
+
+static uint8_t* arena_base = nullptr;
+static size_t arena_capacity = 0;
+static std::vector<ArenaBlock> blocks;     // Sorted by offset
+static size_t used_bytes = 0;
+static bool fragmented = false;
+
+static size_t round_up(size_t size) {
+    return (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+}
+
+bool arena_init() {
+    if (arena_base != nullptr) return true;
+
+    // Half of what PSRAM can give in one piece, so other users keep room
+    size_t largest = heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM);
+    size_t size = min<size_t>(ARENA_MAX_SIZE, largest / 2) & ~(size_t)(ARENA_ALIGN - 1);
+    if (size == 0) {
+        Console.println("ℹ️  No PSRAM, module images stay on the heap");
+        return false;
+    }
+
+    arena_base = (uint8_t*)heap_caps_malloc(size, MALLOC_CAP_SPIRAM);
+    if (arena_base == nullptr) return false;
+    arena_capacity = size;
+    Console.printf("🧱 Module arena: %u KB of PSRAM\n", (unsigned)(size / 1024));
+    return true;
+}
+
+uint8_t* arena_alloc(size_t size, uint8_t** owner) {
+    if (arena_base == nullptr || size == 0) return nullptr;
+    size = round_up(size);
+
+    // First fit: the gap before each block, then the tail
+    size_t start = 0;
+    size_t index = 0;
+    for (; index < blocks.size(); index++) {
+        if (blocks[index].offset - start >= size) break;
+        start = blocks[index].offset + blocks[index].size;
+    }
+    if (index == blocks.size() && arena_capacity - start < size) {
+        fragmented = arena_capacity - used_bytes >= size;
+        return nullptr;
+    }
+
+    blocks.insert(blocks.begin() + index, ArenaBlock{start, size, owner});
+    used_bytes += size;
+    return arena_base + start;
+}
+
+bool arena_owns(const void* ptr) {
+    return arena_base != nullptr && ptr >= arena_base && ptr < arena_base + arena_capacity;
+}
+
+void arena_free(void* ptr) {
+    if (!arena_owns(ptr)) {
+        free(ptr);
+        return;
+    }
+    size_t offset = (uint8_t*)ptr - arena_base;
+    for (size_t i = 0; i < blocks.size(); i++) {
+        if (blocks[i].offset == offset) {
+            used_bytes -= blocks[i].size;
+            blocks.erase(blocks.begin() + i);
+            return;
+        }
+    }
+}
+
+size_t arena_compact() {
+    size_t next = 0;
+    size_t moved = 0;
+    for (ArenaBlock& block : blocks) {
+        if (block.offset != next) {
+            memmove(arena_base + next, arena_base + block.offset, block.size);
+            block.offset = next;
+            *block.owner = arena_base + next;
+            moved += block.size;
+        }
+        next += block.size;
+    }
+    fragmented = false;
+    return moved;
+}
+
+bool arena_wants_compaction() {
+    return fragmented;
+}
+
+void arena_stats(ArenaStats* stats) {
+    *stats = ArenaStats();
+    stats->capacity = arena_capacity;
+    stats->blocks = blocks.size();
+
+    size_t start = 0;
+    for (const ArenaBlock& block : blocks) {
+        size_t gap = block.offset - start;
+        if (gap > 0) {
+            stats->gaps++;
+            stats->largest_free = max(stats->largest_free, gap);
+        }
+        stats->used += block.size;
+        start = block.offset + block.size;
+    }
+    if (arena_capacity > start) {
+        stats->gaps++;
+        stats->largest_free = max(stats->largest_free, arena_capacity - start);
+    }
+}
@@ -0,0 +1,34 @@
+#pragma once
+#include <Arduino.h>
+
+// One PSRAM region reserved at boot for module images, so the large,
+// long-lived bytecode buffers stop carving up the general heap. Images
+// are placed first-fit; compaction slides them together and rewrites
+// each owner's pointer, which is only safe while nothing executes from
+// or parses an image. Without PSRAM the arena stays empty and callers
+// keep using the heap.
+//
+// Not locked: the module registry serializes every call.
+#define ARENA_MAX_SIZE      (2 * 1024 * 1024)
+#define ARENA_ALIGN         16
+
+struct ArenaStats {
+    size_t capacity;
+    size_t used;
+    size_t largest_free;
+    int blocks;
+    int gaps;               // Free runs between or after blocks
+};
+
+bool arena_init();                  // Once; later calls are no-ops
+// Places `size` bytes and remembers `owner` (which must point at the
+// returned pointer for as long as the block lives) for compaction.
+// nullptr when the arena has no run that large.
+uint8_t* arena_alloc(size_t size, uint8_t** owner);
+bool arena_owns(const void* ptr);
+void arena_free(void* ptr);         // Also frees heap pointers
+// Moves every block down to close the gaps. Returns the bytes moved.
+size_t arena_compact();
+// Set when an allocation failed although enough space was free in total
+bool arena_wants_compaction();
+void arena_stats(ArenaStats* stats);
@@ -0,0 +1,236 @@
+#include "module_memory.h"
+#include "link_frame.h"
+#include <map>
+#include <esp_heap_caps.h>
+#include "modules.h"
+#include "module_cache.h"
+#include "download_manager.h"
+#include "module_arena.h"
+#include "wasm_runner.h"
+#include "console_args.h"
+
+extern int current_module;
+
+static SemaphoreHandle_t memory_mutex = NULL;
+
+// Free space where images are placed; true when that is PSRAM
+static bool image_memory(size_t* free_bytes, size_t* largest) {
+    ArenaStats arena;
+    bytecode_arena_stats(&arena);
+    if (arena.capacity == 0) {
+        *free_bytes = ESP.getFreeHeap();
+        *largest = ESP.getMaxAllocHeap();
+        return false;
+    }
+    *free_bytes = arena.capacity - arena.used + heap_caps_get_free_size(MALLOC_CAP_SPIRAM);
+    *largest = max(arena.largest_free, heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM));
+    return true;
+}
+
+static bool under_pressure() {
+    size_t free_bytes, largest;
+    if (image_memory(&free_bytes, &largest)) {
+        return free_bytes < MEMORY_MIN_FREE_PSRAM || largest < MEMORY_MIN_PSRAM_BLOCK;
+    }
+    return free_bytes < MEMORY_MIN_FREE_HEAP || largest < MEMORY_MIN_LARGEST_BLOCK;
+}
+
+// So the bytes can come back from flash. An existing copy is left alone
+// even if it differs: it is the newer version, downloaded while the
+// module was running.
+static void keep_flash_copy(WasmModule* mod) {
+    CacheEntry entry;
+    if (cache_lookup(mod->url, &entry)) return;
+    if (!cache_store(mod->url, mod->bytecode, mod->size, mod->blob->sha256)) {
+        Console.printf("⚠️  No flash copy of %s, it will be downloaded again\n", mod->name);
+    }
+}
+
+int relieve_memory_pressure() {
+    // Never waits: a caller may hold the runtime lock an eviction needs
+    if (xSemaphoreTake(memory_mutex, 0) != pdTRUE) return 0;
+    int evicted = 0;
+
+    // A hot reload isn't a download job, but may still be reading the
+    // loaded bytecode it replaces; compaction waits for it the same way
+    while (!hot_reload_active() && under_pressure()) {
+        std::vector<int> ids = module_ids();
+        WasmModule* running = get_module(current_module);
+        SharedBytecode* running_blob = running ? running->blob : nullptr;
+
+        // A shared buffer only frees once all its users go, so it counts
+        // as used as recently as its most recent user
+        std::map<SharedBytecode*, uint32_t> last_use;
+        for (int id : ids) {
+            WasmModule* mod = get_module(id);
+            if (mod == nullptr || !mod->loaded) continue;
+            auto it = last_use.find(mod->blob);
+            if (it == last_use.end() || (int32_t)(mod->last_used_ms - it->second) > 0) {
+                last_use[mod->blob] = mod->last_used_ms;
+            }
+        }
+
+        uint32_t now = millis();
+        SharedBytecode* victim = nullptr;
+        int victim_id = -1;
+        for (int id : ids) {
+            WasmModule* mod = get_module(id);
+            if (mod == nullptr || !mod->loaded || mod->blob == running_blob) continue;
+            // A delta download patches against the loaded bytecode
+            if (download_pending(id)) continue;
+            uint32_t used = last_use[mod->blob];
+            if (now - used < MEMORY_MIN_IDLE_MS) continue;
+            if (victim == nullptr || (int32_t)(used - last_use[victim]) < 0) {
+                victim = mod->blob;
+                victim_id = id;
+            }
+        }
+        if (victim == nullptr) break;
+
+        size_t size = victim->size;
+        for (int id : ids) {
+            WasmModule* mod = get_module(id);
+            if (mod != nullptr && mod->blob == victim) keep_flash_copy(mod);
+        }
+        if (!unload_module_bytecode(victim_id)) break;
+
+        evicted++;
+        size_t free_bytes, largest;
+        bool psram = image_memory(&free_bytes, &largest);
+        Console.printf("💤 Evicted %s (%u bytes idle %lu s), %s %u free / %u largest\n",
+                       module_name(victim_id), (unsigned)size,
+                       (unsigned long)((now - last_use[victim]) / 1000),
+                       psram ? "PSRAM" : "heap", (unsigned)free_bytes, (unsigned)largest);
+    }
+
+    xSemaphoreGive(memory_mutex);
+    return evicted;
+}
+
+bool pause_module_memory() {
+    return xSemaphoreTake(memory_mutex, 0) == pdTRUE;
+}
+
+void resume_module_memory() {
+    xSemaphoreGive(memory_mutex);
+}
+
+bool ensure_module_loaded(int id) {
+    WasmModule* mod = get_module(id);
+    if (mod == nullptr) return false;
+    if (mod->loaded) return true;
+    if (!mod->evicted) return false;
+
+    // Make room first; the reload needs a module-sized block
+    relieve_memory_pressure();
+
+    Console.printf("♻️  Reloading evicted module %s\n", mod->name);
+    ByteBuffer buffer = {};
+    if (cache_load(mod->url, &buffer, mod->sha256)) {
+        size_t size;
+        uint8_t* bytecode = byte_buffer_release(&buffer, &size);
+        return install_module_bytecode(id, bytecode, size);
+    }
+    byte_buffer_free(&buffer);
+
+    // Not on flash: a download needs a worker's stack (TLS), not the caller's
+    int job = queue_download(id);
+    if (job >= 0) {
+        Console.printf("📥 %s is not on flash, queued its download (job %d); try again when it is done\n",
+                       mod->name, job);
+    }
+    return false;
+}
+
+static void memory_task(void* parameter) {
+    for (;;) {
+        vTaskDelay(pdMS_TO_TICKS(MEMORY_CHECK_MS));
+        if (under_pressure()) {
+            relieve_memory_pressure();
+        }
+    }
+}
+
+void init_module_memory() {
+    memory_mutex = xSemaphoreCreateMutex();
+    // Room for LittleFS writes when a flash copy has to be made
+    xTaskCreate(&memory_task, "memory", 6 * 1024, NULL, 1, NULL);
+}
+
+static int fragmentation(size_t free_bytes, size_t largest) {
+    return free_bytes ? 100 - (int)(largest * 100 / free_bytes) : 0;
+}
+
+void print_memory_report() {
+    size_t heap_free = ESP.getFreeHeap();
+    size_t heap_largest = ESP.getMaxAllocHeap();
+    Console.printf("   Heap:  %u free, largest block %u (%d%% fragmented)\n",
+                   (unsigned)heap_free, (unsigned)heap_largest, fragmentation(heap_free, heap_largest));
+    Console.printf("   PSRAM: %u free, largest block %u\n",
+                   (unsigned)heap_caps_get_free_size(MALLOC_CAP_SPIRAM),
+                   (unsigned)heap_caps_get_largest_free_block(MALLOC_CAP_SPIRAM));
+
+    ArenaStats arena;
+    bytecode_arena_stats(&arena);
+    if (arena.capacity == 0) {
+        Console.println("   Arena: none (no PSRAM)");
+        return;
+    }
+    size_t arena_free = arena.capacity - arena.used;
+    Console.printf("   Arena: %u/%u KB used by %d images, %d gaps, largest %u KB (%d%% fragmented)\n",
+                   (unsigned)(arena.used / 1024), (unsigned)(arena.capacity / 1024), arena.blocks,
+                   arena.gaps, (unsigned)(arena.largest_free / 1024),
+                   fragmentation(arena_free, arena.largest_free));
+}
+
+bool compact_module_memory() {
+    size_t received, total;
+    int active;
+    if (current_module >= 0 || hot_reload_active() || get_download_overview(&received, &total, &active) ||
+        bytecode_pinned()) {
+        return false;
+    }
+
+    // Same order as eviction: memory lock, then runtimes
+    xSemaphoreTake(memory_mutex, portMAX_DELAY);
+    lock_module_runtimes();
+    for (int id : module_ids()) {
+        release_module_instance(id);   // Runtimes point into the images
+    }
+    uint32_t start = millis();
+    size_t moved;
+    int on_heap;
+    // A job may have pinned a blob since the check above; this one holds
+    bool compacted = compact_bytecode(&moved, &on_heap);
+    unlock_module_runtimes();
+    xSemaphoreGive(memory_mutex);
+    if (!compacted) return false;   // Instances come back on next use
+
+    Console.printf("🧱 Compacted: moved %u bytes in %lu ms", (unsigned)moved, (unsigned long)(millis() - start));
+    if (on_heap > 0) Console.printf(", %d images still on the heap", on_heap);
+    Console.println();
+    return true;
+}
+
+void service_module_memory() {
+    if (arena_wants_compaction()) {
+        compact_module_memory();
+    }
+}
+
+void handle_memory_command(String args) {
+    String sub = take_token(args);
+
+    Console.println("\n🧠 Memory:");
+    print_memory_report();
+    if (sub == "compact") {
+        if (!compact_module_memory()) {
+            Console.println("❌ Stop the module and wait for downloads and hot reloads first");
+            return;
+        }
+        Console.println("🧠 After:");
+        print_memory_report();
+    } else if (!sub.isEmpty()) {
+        Console.println("❌ Usage: g [compact]");
+    }
+}
@@ -0,0 +1,45 @@
+#pragma once
+#include <Arduino.h>
+
+// Keeps loaded bytecode within the memory images live in. When the free
+// space there or its largest free run drops below its threshold, the
+// bytecode of the least recently used idle modules is dropped (after
+// making sure a flash copy exists) until both recover. Evicted modules
+// reload on their next start or call, from flash or, failing that, by a
+// queued download.
+//
+// Images live in a PSRAM arena (module_arena.h) that is compacted when an
+// image no longer fits between the others; what doesn't fit goes to the
+// PSRAM heap. So with PSRAM, pressure is the arena plus the PSRAM heap;
+// without it, images and pressure are on the internal heap.
+#define MEMORY_MIN_FREE_HEAP      (64 * 1024)     // Without PSRAM
+#define MEMORY_MIN_LARGEST_BLOCK  (32 * 1024)
+#define MEMORY_MIN_FREE_PSRAM     (256 * 1024)    // Arena and PSRAM heap
+#define MEMORY_MIN_PSRAM_BLOCK    (128 * 1024)    // Room for another image
+#define MEMORY_CHECK_MS           2000
+#define MEMORY_MIN_IDLE_MS        30000    // Recently used modules are kept
+
+void init_module_memory();
+// Loads an evicted module back from flash; true when its bytecode is in
+// RAM. Without a flash copy it queues a download and returns false.
+bool ensure_module_loaded(int id);
+// Evicts idle modules, least recently used first, until memory is back
+// above the thresholds or nothing is left to evict. Returns the count,
+// 0 when another pass is already under way.
+int relieve_memory_pressure();
+// Holds off eviction and compaction while the caller frees modules. False
+// (nothing held) when a pass is running right now; otherwise undo it with
+// resume_module_memory().
+bool pause_module_memory();
+void resume_module_memory();
+
+// Compacts the module arena. Refused (false) while a module runs, a
+// download or hot reload is under way, since those use image pointers.
+bool compact_module_memory();
+// From the console task: compacts once an image did not fit and nothing
+// is using the images (see compact_module_memory())
+void service_module_memory();
+void print_memory_report();
+
+// Serial command 'g': report | compact
+void handle_memory_command(String args);
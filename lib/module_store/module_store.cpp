@@ -0,0 +1,261 @@
+#include "module_store.h"
+#include "link_frame.h"
+#include <map>
+#include <string>
+#include <vector>
+#include <Preferences.h>
+#include <esp_rom_crc.h>
+#include "modules.h"
+#include "cpu_quota.h"
+
+#define RECORD_SHA_PINNED 0x01
+#define SCHEMA_U16_INDEX  2     // Index under "ids", u16 per module
+
+struct __attribute__((packed)) ModuleRecord {
+    uint8_t version;            // MODULE_RECORD_VERSION
+    uint8_t flags;
+    uint8_t cpu_quota;
+    uint8_t autostart;          // Boot list position, 0 when not in it
+    uint16_t name_len;
+    uint16_t url_len;
+    uint16_t version_len;
+    uint8_t core;               // Pinned core + 1, 0 for either
+    uint8_t reserved;
+    uint32_t run_count;
+    uint32_t throttle_count;
+    uint32_t throttled_ms;
+    uint32_t image_size;        // 0 when never loaded
+    uint8_t image_sha256[SHA256_SIZE];
+    uint8_t pinned_sha256[SHA256_SIZE];
+};
+
+static Preferences store;
+// What flash holds, so saves can skip records that did not change
+static std::vector<uint32_t> saved_ids;
+static std::map<int, uint32_t> saved_crc;
+static uint32_t saved_next_id = 0;
+
+static String record_key(int id) {
+    return "m" + String(id);
+}
+
+static bool hex_to_digest(const char* hex, uint8_t digest[SHA256_SIZE]) {
+    if (strlen(hex) != SHA256_SIZE * 2) return false;
+    for (int i = 0; i < SHA256_SIZE; i++) {
+        char byte[3] = { hex[i * 2], hex[i * 2 + 1], '\0' };
+        char* end;
+        digest[i] = strtoul(byte, &end, 16);
+        if (*end != '\0') return false;
+    }
+    return true;
+}
+
+static void encode_record(const WasmModule* mod, std::vector<uint8_t>* out) {
+    ModuleRecord rec = {};
+    rec.version = MODULE_RECORD_VERSION;
+    rec.cpu_quota = mod->cpu_quota;
+    rec.autostart = mod->autostart;
+    rec.core = mod->core + 1;
+    rec.name_len = strlen(mod->name);
+    rec.url_len = strlen(mod->url);
+    rec.version_len = strlen(mod->version);
+    rec.run_count = mod->run_count;
+    rec.throttle_count = mod->throttle_count;
+    rec.throttled_ms = mod->throttled_ms;
+    rec.image_size = mod->image_size;
+    memcpy(rec.image_sha256, mod->image_sha256, SHA256_SIZE);
+    if (hex_to_digest(mod->sha256, rec.pinned_sha256)) {
+        rec.flags |= RECORD_SHA_PINNED;
+    }
+
+    const uint8_t* header = (const uint8_t*)&rec;
+    out->assign(header, header + sizeof(rec));
+    out->insert(out->end(), mod->name, mod->name + rec.name_len);
+    out->insert(out->end(), mod->url, mod->url + rec.url_len);
+    out->insert(out->end(), mod->version, mod->version + rec.version_len);
+}
+
+static bool restore_record(int saved_id, const std::vector<uint8_t>& data) {
+    ModuleRecord rec;
+    if (data.size() < sizeof(rec)) return false;
+    memcpy(&rec, data.data(), sizeof(rec));
+    if (rec.version != MODULE_RECORD_VERSION ||
+        data.size() != sizeof(rec) + rec.name_len + rec.url_len + rec.version_len) {
+        return false;
+    }
+
+    const char* text = (const char*)data.data() + sizeof(rec);
+    String name = std::string(text, rec.name_len).c_str();
+    String url = std::string(text + rec.name_len, rec.url_len).c_str();
+    String version = std::string(text + rec.name_len + rec.url_len, rec.version_len).c_str();
+
+    int id = add_module(name, url, saved_id);
+    if (id < 0) return false;
+    WasmModule* mod = get_module(id);
+    if (rec.cpu_quota > 0 && rec.cpu_quota <= 100) mod->cpu_quota = rec.cpu_quota;
+    mod->run_count = rec.run_count;
+    mod->autostart = rec.autostart;
+    mod->core = (rec.core == 1 || rec.core == 2) ? rec.core - 1 : -1;
+    mod->throttle_count = rec.throttle_count;
+    mod->throttled_ms = rec.throttled_ms;
+    mod->image_size = rec.image_size;
+    memcpy(mod->image_sha256, rec.image_sha256, SHA256_SIZE);
+    String pinned = (rec.flags & RECORD_SHA_PINNED) ? sha256_hex(rec.pinned_sha256) : "";
+    set_module_source(id, url, pinned, version);
+    return true;
+}
+
+// name|url[|quota[|sha256[|version[|id]]]] under "mod0".."mod<count-1>"
+static void load_legacy_list() {
+    int count = store.getInt("count", 0);
+    Console.printf("📂 Converting %d modules saved in the old format\n", count);
+
+    for (int i = 0; i < count; i++) {
+        String key = "mod" + String(i);
+        String value = store.getString(key.c_str(), "");
+        int sep = value.indexOf('|');
+        if (sep <= 0) continue;
+
+        String name = value.substring(0, sep);
+        String url = value.substring(sep + 1);
+        String fields[4];
+        int sep2 = url.indexOf('|');
+        if (sep2 > 0) {
+            String rest = url.substring(sep2 + 1);
+            url = url.substring(0, sep2);
+            for (int f = 0; f < 4 && !rest.isEmpty(); f++) {
+                int next = rest.indexOf('|');
+                fields[f] = (next < 0) ? rest : rest.substring(0, next);
+                rest = (next < 0) ? "" : rest.substring(next + 1);
+            }
+        }
+        int quota = fields[0].isEmpty() ? CPU_QUOTA_DEFAULT : fields[0].toInt();
+        // Lists saved before ids existed get them in saved order
+        int id = add_module(name, url, fields[3].toInt());
+        if (id >= 0) {
+            if (quota > 0 && quota <= 100) get_module(id)->cpu_quota = quota;
+            set_module_source(id, url, fields[1], fields[2]);
+        }
+    }
+}
+
+static void remove_legacy_list() {
+    int count = store.getInt("count", 0);
+    for (int i = 0; i < count; i++) {
+        store.remove(("mod" + String(i)).c_str());
+    }
+    store.remove("count");
+}
+
+// Reads the index under `key`, `width` bytes per id, then the records
+static void load_records(const char* key, size_t width) {
+    std::vector<uint8_t> index(store.getBytesLength(key));
+    if (!index.empty()) {
+        store.getBytes(key, index.data(), index.size());
+    }
+    saved_ids.clear();
+    for (size_t pos = 0; pos + width <= index.size(); pos += width) {
+        uint32_t id = 0;
+        for (size_t i = 0; i < width; i++) id |= (uint32_t)index[pos + i] << (8 * i);
+        saved_ids.push_back(id);
+    }
+    Console.printf("📂 Loading %d saved modules\n", (int)saved_ids.size());
+
+    std::vector<uint8_t> data;
+    for (uint32_t id : saved_ids) {
+        String key = record_key(id);
+        data.resize(store.getBytesLength(key.c_str()));
+        if (!data.empty()) {
+            store.getBytes(key.c_str(), data.data(), data.size());
+        }
+        // Remembered even when unusable, so the next save cleans it up
+        saved_crc[id] = esp_rom_crc32_le(0, data.data(), data.size());
+        if (!restore_record(id, data)) {
+            Console.printf("⚠️  Skipping unreadable module record %d\n", (int)id);
+        }
+    }
+}
+
+void load_module_list() {
+    store.begin("wasm-loader", false);
+
+    // Before the records: add_module() only raises it past restored ids
+    saved_next_id = store.getUInt("next", 1);
+    restore_next_module_id(saved_next_id);
+
+    uint32_t schema = store.getUInt("schema", 0);
+    if (schema == MODULE_STORE_SCHEMA) {
+        load_records("index", sizeof(uint32_t));
+        return;
+    }
+
+    bool short_index = schema == SCHEMA_U16_INDEX;
+    bool legacy = !short_index && store.isKey("count");
+    if (short_index) {
+        // Same records, so only the index is written again
+        load_records("ids", sizeof(uint16_t));
+        saved_ids.clear();
+    } else if (legacy) {
+        load_legacy_list();
+    }
+    // The old keys go only once the new ones are written
+    save_module_list();
+    store.putUInt("schema", MODULE_STORE_SCHEMA);
+    if (legacy) {
+        remove_legacy_list();
+    }
+    if (short_index) {
+        store.remove("ids");
+    }
+}
+
+void save_module_list() {
+    std::vector<int> ids = module_ids();
+    std::vector<uint32_t> index(ids.begin(), ids.end());
+    int written = 0;
+
+    std::vector<uint8_t> data;
+    std::map<int, uint32_t> crcs;
+    for (int id : ids) {
+        WasmModule* mod = get_module(id);
+        if (mod == nullptr) continue;
+        encode_record(mod, &data);
+        uint32_t crc = esp_rom_crc32_le(0, data.data(), data.size());
+        crcs[id] = crc;
+
+        auto saved = saved_crc.find(id);
+        if (saved != saved_crc.end() && saved->second == crc) continue;
+        if (store.putBytes(record_key(id).c_str(), data.data(), data.size()) != data.size()) {
+            Console.printf("❌ Could not save module %s\n", mod->name);
+            // Flash still holds the old record, so the next save retries
+            if (saved != saved_crc.end()) {
+                crcs[id] = saved->second;
+            } else {
+                crcs.erase(id);
+            }
+            continue;
+        }
+        written++;
+    }
+
+    for (auto& entry : saved_crc) {
+        if (!crcs.count(entry.first)) {
+            store.remove(record_key(entry.first).c_str());
+        }
+    }
+    if (index != saved_ids) {
+        if (index.empty()) {
+            store.remove("index");
+        } else {
+            store.putBytes("index", index.data(), index.size() * sizeof(uint32_t));
+        }
+        saved_ids = index;
+    }
+    uint32_t next_id = next_free_module_id();
+    if (next_id != saved_next_id && store.putUInt("next", next_id) == sizeof(uint32_t)) {
+        saved_next_id = next_id;
+    }
+    saved_crc = crcs;
+
+    Console.printf("💾 Saved %d modules (%d changed)\n", (int)ids.size(), written);
+}
@@ -0,0 +1,25 @@
+#pragma once
+#include <Arduino.h>
+
+// The module list in NVS (namespace "wasm-loader"). Each module is one
+// binary record under "m<id>", listed by a small "ids" index, so a save
+// rewrites only the records that changed and boot reads each one with a
+// single call. Records carry what the list shows without the bytecode
+// in RAM: the last image's size and hash and the run counters.
+//
+//   "schema"  u32, MODULE_STORE_SCHEMA
+//   "index"   u32 LE per module, ascending
+//   "next"    u32, the id the next new module gets (never reused)
+//   "m<id>"   ModuleRecord, then name, URL and version (not terminated)
+//
+// Lists saved by older firmware are converted on the first load: schema 2
+// kept the index as u16 under "ids", before that came "count" plus
+// "name|url|..." strings. The old keys go once the new ones are written.
+#define MODULE_STORE_SCHEMA   3
+#define MODULE_RECORD_VERSION 1
+
+// Opens the namespace and adds the saved modules; after init_modules()
+void load_module_list();
+// Writes the records that differ from what is on flash and drops the
+// ones of removed modules
+void save_module_list();
@@ -1,199 +1,680 @@
 #include "modules.h"
-#include <HTTPClient.h>
-#include <WiFi.h>
+#include "link_frame.h"
+#include "downloader.h"
+#include "module_cache.h"
+#include "wasm_runner.h"
+#include "cpu_quota.h"
+#include "download_manager.h"
+#include "module_arena.h"
+#include "module_memory.h"
+#include "manifest.h"
+#include <mbedtls/sha256.h>
+#include <map>
+#include <string>
+#include <unordered_map>
 
-// Dynamic module storage
-WasmModule modules[10];  // Support up to 10 dynamic modules
-const int MAX_MODULES = 10;
-int num_loaded_modules = 0;
+// Dynamic module storage. std::map keeps ids in order for listings; the
+// two hash indexes are keyed by interned pointers, so a lookup is one
+// string hash to find the pointer and one pointer hash after that.
+static std::map<int, WasmModule*> registry;
+static std::unordered_map<const char*, WasmModule*> by_name;
+static std::unordered_multimap<const char*, WasmModule*> by_url;
+static int next_module_id = 1;
+
+// Interned strings with reference counts. Node-based, so the key a
+// pointer refers to never moves while it is in use.
+static std::unordered_map<std::string, int> string_pool;
+
+// Loaded bytecode by SHA-256 (raw digest bytes as the key)
+static std::unordered_map<std::string, SharedBytecode*> bytecode_pool;
+
+// Download workers look modules up while the console task edits the list
+static SemaphoreHandle_t registry_mutex = NULL;
+
+extern int current_module;
+
+static void lock_registry() {
+    if (registry_mutex == NULL) registry_mutex = xSemaphoreCreateRecursiveMutex();
+    xSemaphoreTakeRecursive(registry_mutex, portMAX_DELAY);
+}
+
+static void unlock_registry() {
+    xSemaphoreGiveRecursive(registry_mutex);
+}
+
+// All three called with the registry locked
+static const char* intern(const String& s) {
+    if (s.isEmpty()) return "";
+    auto it = string_pool.emplace(std::string(s.c_str(), s.length()), 0).first;
+    it->second++;
+    return it->first.c_str();
+}
+
+static const char* find_interned(const String& s) {
+    auto it = string_pool.find(std::string(s.c_str(), s.length()));
+    return it == string_pool.end() ? nullptr : it->first.c_str();
+}
+
+static void release(const char* s) {
+    if (*s == '\0') return;
+    auto it = string_pool.find(s);
+    if (it != string_pool.end() && --it->second == 0) {
+        string_pool.erase(it);
+    }
+}
+
+static void unindex_url(WasmModule* mod) {
+    auto range = by_url.equal_range(mod->url);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second == mod) {
+            by_url.erase(it);
+            return;
+        }
+    }
+}
+
+SharedBytecode* share_bytecode(uint8_t* data, size_t size) {
+    uint8_t digest[SHA256_SIZE];
+    mbedtls_sha256_ret(data, size, digest, 0);
+    std::string key((const char*)digest, SHA256_SIZE);
+
+    lock_registry();
+    auto it = bytecode_pool.find(key);
+    SharedBytecode* blob = (it != bytecode_pool.end()) ? it->second : nullptr;
+    if (blob != nullptr) blob->refs++;
+    unlock_registry();
+    if (blob != nullptr) {
+        free(data);
+        return blob;
+    }
+
+    // New content: parsed once, outside the lock, before anything uses it
+    ModuleInfo info;
+    M3Result result = inspect_module(data, size, &info);
+    if (result) {
+        Console.printf("❌ Module rejected: %s\n", result);
+        free(data);
+        return nullptr;
+    }
+
+    lock_registry();
+    it = bytecode_pool.find(key);
+    if (it != bytecode_pool.end()) {
+        // Someone else loaded the same bytes meanwhile
+        blob = it->second;
+        free(data);
+    } else {
+        blob = new SharedBytecode{data, size, {}, 0, info};
+        memcpy(blob->sha256, digest, SHA256_SIZE);
+        // Kept images go to the arena; the download buffer was transient
+        uint8_t* placed = arena_alloc(size, &blob->data);
+        if (placed != nullptr) {
+            memcpy(placed, data, size);
+            free(data);
+            blob->data = placed;
+        }
+        bytecode_pool[key] = blob;
+    }
+    blob->refs++;
+    unlock_registry();
+    return blob;
+}
+
+void release_bytecode(SharedBytecode* blob) {
+    if (blob == nullptr) return;
+    lock_registry();
+    if (--blob->refs == 0) {
+        bytecode_pool.erase(std::string((const char*)blob->sha256, SHA256_SIZE));
+        arena_free(blob->data);
+        delete blob;
+    }
+    unlock_registry();
+}
+
+// Called with the registry locked; the cached runtime must already be
+// released since it points into the old bytecode
+static void set_blob(WasmModule* mod, SharedBytecode* blob) {
+    SharedBytecode* old = mod->blob;
+    if (blob != nullptr) blob->refs++;
+    mod->blob = blob;
+    mod->bytecode = blob ? blob->data : nullptr;
+    mod->size = blob ? blob->size : 0;
+    mod->loaded = blob != nullptr;
+    if (blob != nullptr) {
+        mod->evicted = false;
+        mod->last_used_ms = millis();
+        mod->image_size = blob->size;
+        memcpy(mod->image_sha256, blob->sha256, SHA256_SIZE);
+    }
+    release_bytecode(old);
+}
+
+// The cached runtime must already be released
+static void free_module(WasmModule* mod) {
+    set_blob(mod, nullptr);
+    delete mod;
+}
 
 void init_modules() {
+    // Runtimes first: their lock is taken before the registry's elsewhere
+    for (int id : module_ids()) {
+        release_module_instance(id);
+    }
+
     // Clear all modules first
-    for (int i = 0; i < MAX_MODULES; i++) {
-        modules[i].name = "";
-        modules[i].url = "";
-        modules[i].bytecode = nullptr;
-        modules[i].size = 0;
-        modules[i].loaded = false;
-    }
-    num_loaded_modules = 0;
-    
+    lock_registry();
+    for (auto& entry : registry) {
+        free_module(entry.second);
+    }
+    registry.clear();
+    by_name.clear();
+    by_url.clear();
+    string_pool.clear();
+    unlock_registry();
+
     // Don't add any default modules here!
     // They will be loaded from preferences or added manually
 }
 
 void cleanup_modules() {
-    for (int i = 0; i < MAX_MODULES; i++) {
-        if (modules[i].bytecode != nullptr) {
-            free(modules[i].bytecode);
-            modules[i].bytecode = nullptr;
+    for (int id : module_ids()) {
+        release_module_instance(id);
+        lock_registry();
+        set_blob(get_module(id), nullptr);
+        unlock_registry();
+    }
+}
+
+int add_module(const String& name, const String& url, int id) {
+    lock_registry();
+
+    // Names are unique; a URL may be listed under several names
+    const char* known_name = find_interned(name);
+    if (known_name != nullptr && by_name.count(known_name)) {
+        unlock_registry();
+        Console.printf("⚠️  Module '%s' already exists\n", name.c_str());
+        return -1;
+    }
+
+    WasmModule* mod = new (std::nothrow) WasmModule();
+    if (mod == nullptr) {
+        unlock_registry();
+        Console.println("❌ Out of memory for another module");
+        return -1;
+    }
+
+    if (id <= 0 || registry.count(id)) {
+        id = next_module_id;
+    }
+    next_module_id = max(next_module_id, id + 1);
+
+    mod->id = id;
+    mod->name = intern(name);
+    mod->url = intern(url);
+    mod->version = "";
+    mod->sha256[0] = '\0';
+    mod->blob = nullptr;
+    mod->bytecode = nullptr;
+    mod->size = 0;
+    mod->loaded = false;
+    mod->evicted = false;
+    mod->installing = false;
+    mod->last_used_ms = 0;
+    mod->instance = nullptr;
+    mod->cpu_quota = CPU_QUOTA_DEFAULT;
+    mod->cpu_usage = 0;
+    mod->throttle_count = 0;
+    mod->throttled_ms = 0;
+    mod->image_size = 0;
+    memset(mod->image_sha256, 0, SHA256_SIZE);
+    mod->run_count = 0;
+    mod->autostart = 0;
+    mod->core = -1;
+
+    registry[id] = mod;
+    by_name[mod->name] = mod;
+    by_url.emplace(mod->url, mod);
+
+    // Same binary as an entry that is already loaded
+    auto range = by_url.equal_range(mod->url);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (it->second->blob != nullptr) {
+            set_blob(mod, it->second->blob);
+            break;
         }
-        modules[i].loaded = false;
-        modules[i].size = 0;
     }
-    num_loaded_modules = 0;
+    unlock_registry();
+
+    Console.printf("✅ Added module %d: %s\n", id, name.c_str());
+    return id;
+}
+
+int next_free_module_id() {
+    lock_registry();
+    int id = next_module_id;
+    unlock_registry();
+    return id;
+}
+
+void restore_next_module_id(int id) {
+    lock_registry();
+    next_module_id = max(next_module_id, id);
+    unlock_registry();
+}
+
+// Drops the flash copy unless another entry uses the same URL.
+// Called with the registry locked.
+static void drop_cached_copy(WasmModule* mod) {
+    if (by_url.count(mod->url) > 1) return;
+    cache_remove(mod->url);
+}
+
+bool remove_module(int id) {
+    WasmModule* mod = get_module(id);
+    if (mod == nullptr) {
+        return false;
+    }
+    if (id == current_module) {
+        Console.println("❌ Module is running. Stop it first with 's'.");
+        return false;
+    }
+    if (download_pending(id) || mod->installing) {
+        Console.println("❌ Module is being downloaded. Cancel it first with 'p cancel'.");
+        return false;
+    }
+    if (manifest_sync_active()) {
+        Console.println("❌ A manifest sync is running, try again");
+        return false;
+    }
+    // Both walk the module list and hold entries while they do
+    if (hot_reload_active() || !pause_module_memory()) {
+        Console.println("❌ A hot reload or memory pass is running, try again");
+        return false;
+    }
+
+    release_module_instance(id);
+    lock_registry();
+    drop_cached_copy(mod);
+    registry.erase(id);
+    by_name.erase(mod->name);
+    unindex_url(mod);
+    release(mod->name);
+    release(mod->url);
+    release(mod->version);
+    unlock_registry();
+
+    free_module(mod);
+    resume_module_memory();
+    Console.printf("✅ Removed module %d\n", id);
+    return true;
+}
+
+WasmModule* get_module(int id) {
+    lock_registry();
+    auto it = registry.find(id);
+    WasmModule* mod = (it == registry.end()) ? nullptr : it->second;
+    unlock_registry();
+    return mod;
+}
+
+const char* module_name(int id) {
+    WasmModule* mod = get_module(id);
+    return mod != nullptr ? mod->name : "?";
+}
+
+int module_count() {
+    lock_registry();
+    int count = registry.size();
+    unlock_registry();
+    return count;
+}
+
+std::vector<int> module_ids() {
+    std::vector<int> ids;
+    lock_registry();
+    ids.reserve(registry.size());
+    for (auto& entry : registry) {
+        ids.push_back(entry.first);
+    }
+    unlock_registry();
+    return ids;
 }
 
-bool add_module(const String& name, const String& url) {
-    if (num_loaded_modules >= MAX_MODULES) {
-        Serial.println("❌ Module list is full");
+void set_module_source(int id, const String& url, const String& sha256, const String& version) {
+    WasmModule* mod = get_module(id);
+    if (mod == nullptr) return;
+
+    lock_registry();
+    if (url != mod->url) {
+        drop_cached_copy(mod);
+        unindex_url(mod);
+        release(mod->url);
+        mod->url = intern(url);
+        by_url.emplace(mod->url, mod);
+    }
+    if (version != mod->version) {
+        release(mod->version);
+        mod->version = intern(version);
+    }
+    strlcpy(mod->sha256, sha256.c_str(), sizeof(mod->sha256));
+    unlock_registry();
+}
+
+void set_module_delta(int id, const String& delta_url) {
+    lock_registry();
+    WasmModule* mod = get_module(id);
+    if (mod != nullptr) mod->delta_url = delta_url;
+    unlock_registry();
+}
+
+bool module_bytecode_sha256(int id, uint8_t digest[SHA256_SIZE]) {
+    lock_registry();
+    WasmModule* mod = get_module(id);
+    bool loaded = mod != nullptr && mod->blob != nullptr;
+    if (loaded) memcpy(digest, mod->blob->sha256, SHA256_SIZE);
+    unlock_registry();
+    return loaded;
+}
+
+bool fetch_module(int id, DownloadRequest request, ByteBuffer* out, bool* not_modified) {
+    WasmModule* mod = get_module(id);
+    *not_modified = false;
+    if (mod == nullptr) return false;
+
+    // Copied under the lock; a manifest sync may repoint the module meanwhile
+    lock_registry();
+    request.url = mod->url;
+    request.expected_sha256 = mod->sha256;
+    String delta_url = mod->delta_url;
+    mod->delta_url = "";    // One try; a failed patch won't get better
+    // The patch base, pinned so eviction or an install can't free it
+    // and compaction won't move it while the patch streams in
+    SharedBytecode* base = delta_url.isEmpty() ? nullptr : mod->blob;
+    if (base != nullptr) base->refs++;
+    unlock_registry();
+
+    // Nothing to fetch; "reloading" one means reading it back from flash
+    if (request.url.startsWith(LOCAL_MODULE_SCHEME)) {
+        release_bytecode(base);
+        *not_modified = true;
+        return cache_load(request.url, out, request.expected_sha256);
+    }
+
+    if (base != nullptr) {
+        bool patched = delta_fetch(request, delta_url, base->data, base->size, out);
+        release_bytecode(base);
+        if (patched) return true;
+        Console.println("↩️  Delta update failed, downloading the full module");
+        byte_buffer_free(out);
+    }
+    return cached_fetch(request, out, not_modified);
+}
+
+bool fetch_module_bytecode(int id, uint8_t** out, size_t* out_size, bool* not_modified) {
+    ByteBuffer buffer = {};
+    bool unchanged = false;
+
+    if (!fetch_module(id, DownloadRequest(), &buffer, &unchanged)) {
+        byte_buffer_free(&buffer);
+        *out = nullptr;
+        *out_size = 0;
         return false;
     }
-    
-    // Check for duplicates
-    for (int i = 0; i < MAX_MODULES; i++) {
-        if (!modules[i].name.isEmpty() && 
-            modules[i].name == name && 
-            modules[i].url == url) {
-            Serial.printf("⚠️  Module '%s' already exists\n", name.c_str());
-            return false;
+
+    if (not_modified != nullptr) *not_modified = unchanged;
+    *out = byte_buffer_release(&buffer, out_size);
+    return true;
+}
+
+bool install_module_bytecode(int id, uint8_t* bytecode, size_t size) {
+    SharedBytecode* blob = share_bytecode(bytecode, size);
+    if (blob == nullptr) return false;
+    return install_shared_bytecode(id, blob);
+}
+
+bool install_shared_bytecode(int id, SharedBytecode* blob, bool hot_swap) {
+    if (blob == nullptr) return false;
+    std::vector<WasmModule*> targets;
+    bool installed = false;
+    lock_registry();
+    WasmModule* mod = get_module(id);
+    if (mod != nullptr) {
+        auto range = by_url.equal_range(mod->url);
+        for (auto it = range.first; it != range.second; ++it) {
+            WasmModule* target = it->second;
+            // Marked under the lock, so from here until the new bytecode
+            // is in, mark_module_running() turns the target down
+            bool running = target->id == current_module && !(hot_swap && target == mod);
+            if (running || target->installing) continue;
+            target->installing = true;
+            targets.push_back(target);
+            installed |= target == mod;
         }
     }
-    
-    // Find first empty slot
-    for (int i = 0; i < MAX_MODULES; i++) {
-        if (modules[i].name.isEmpty()) {
-            modules[i].name = name;
-            modules[i].url = url;
-            modules[i].bytecode = nullptr;
-            modules[i].size = 0;
-            modules[i].loaded = false;
-            num_loaded_modules++;
-            Serial.printf("✅ Added module: %s\n", name.c_str());
-            return true;
+    unlock_registry();
+
+    // Cached runtimes point into the old bytecode
+    for (WasmModule* target : targets) {
+        release_module_instance(target->id);
+    }
+
+    lock_registry();
+    for (WasmModule* target : targets) {
+        set_blob(target, blob);
+        target->installing = false;
+    }
+    unlock_registry();
+    release_bytecode(blob);
+    return installed;
+}
+
+bool mark_module_running(int id) {
+    lock_registry();
+    WasmModule* mod = get_module(id);
+    bool ok = mod != nullptr && !mod->installing;
+    if (ok) current_module = id;
+    unlock_registry();
+    return ok;
+}
+
+bool unload_module_bytecode(int id) {
+    std::vector<WasmModule*> holders;
+    lock_registry();
+    WasmModule* mod = get_module(id);
+    if (mod != nullptr && mod->blob != nullptr) {
+        for (auto& entry : registry) {
+            if (entry.second->blob != mod->blob) continue;
+            if (entry.first == current_module) {
+                unlock_registry();
+                return false;
+            }
+            holders.push_back(entry.second);
         }
     }
-    return false;
+    unlock_registry();
+    if (holders.empty()) return false;
+
+    for (WasmModule* holder : holders) {
+        release_module_instance(holder->id);
+    }
+    lock_registry();
+    for (WasmModule* holder : holders) {
+        set_blob(holder, nullptr);
+        holder->evicted = true;
+    }
+    unlock_registry();
+    return true;
+}
+
+void bytecode_arena_stats(ArenaStats* stats) {
+    lock_registry();
+    arena_stats(stats);
+    unlock_registry();
 }
 
-bool remove_module(int index) {
-    if (index < 0 || index >= MAX_MODULES || modules[index].name.isEmpty()) {
+bool bytecode_pinned() {
+    lock_registry();
+    std::unordered_map<SharedBytecode*, int> holders;
+    for (auto& entry : registry) {
+        if (entry.second->blob != nullptr) holders[entry.second->blob]++;
+    }
+    bool pinned = false;
+    for (auto& entry : bytecode_pool) {
+        if (entry.second->refs > holders[entry.second]) pinned = true;
+    }
+    unlock_registry();
+    return pinned;
+}
+
+bool compact_bytecode(size_t* moved_bytes, int* on_heap) {
+    lock_registry();
+    // Recursive lock: no new pin can be taken between this and the move
+    if (bytecode_pinned()) {
+        unlock_registry();
         return false;
     }
-    
-    if (modules[index].bytecode != nullptr) {
-        free(modules[index].bytecode);
-    }
-    
-    modules[index].name = "";
-    modules[index].url = "";
-    modules[index].bytecode = nullptr;
-    modules[index].size = 0;
-    modules[index].loaded = false;
-    num_loaded_modules--;
-    
-    Serial.printf("✅ Removed module at index %d\n", index);
+    size_t moved = arena_compact();
+
+    // Images that did not fit before may now
+    *on_heap = 0;
+    for (auto& entry : bytecode_pool) {
+        SharedBytecode* blob = entry.second;
+        if (arena_owns(blob->data)) continue;
+        uint8_t* heap_copy = blob->data;
+        uint8_t* placed = arena_alloc(blob->size, &blob->data);
+        if (placed == nullptr) {
+            (*on_heap)++;
+            continue;
+        }
+        memcpy(placed, heap_copy, blob->size);
+        free(heap_copy);
+        blob->data = placed;
+        moved += blob->size;
+    }
+
+    for (auto& entry : registry) {
+        WasmModule* mod = entry.second;
+        mod->bytecode = mod->blob ? mod->blob->data : nullptr;
+    }
+    unlock_registry();
+    *moved_bytes = moved;
     return true;
 }
 
-bool download_module(int index) {
-    if (index < 0 || index >= MAX_MODULES || modules[index].name.isEmpty()) {
-        Serial.println("❌ Invalid module index");
+void touch_module(int id) {
+    WasmModule* mod = get_module(id);
+    if (mod != nullptr) mod->last_used_ms = millis();
+}
+
+bool download_module(int id) {
+    WasmModule* mod = get_module(id);
+    if (mod == nullptr) {
+        Console.println("❌ Invalid module number");
         return false;
     }
-    
-    if (WiFi.status() != WL_CONNECTED) {
-        Serial.println("❌ WiFi not connected");
+
+    if (id == current_module) {
+        Console.println("❌ Module is running. Stop it first or hot reload it with 'h'.");
         return false;
     }
-    
-    WasmModule* mod = &modules[index];
-    
-    // Clean up previous data if exists
-    if (mod->bytecode != nullptr) {
-        free(mod->bytecode);
-        mod->bytecode = nullptr;
-    }
-    
-    Serial.printf("📥 Downloading: %s from %s\n", mod->name.c_str(), mod->url.c_str());
-    
-    HTTPClient http;
-    http.begin(mod->url);
-    http.setTimeout(30000); // 30 second timeout
-    
-    int httpCode = http.GET();
-    
-    if (httpCode == HTTP_CODE_OK) {
-        int len = http.getSize();
-        
-        if (len <= 0) {
-            Serial.println("❌ Invalid content length");
-            http.end();
-            return false;
-        }
-        
-        Serial.printf("📦 Module size: %d bytes\n", len);
-        
-        // Allocate memory for module
-        mod->bytecode = (uint8_t*)malloc(len);
-        if (mod->bytecode == nullptr) {
-            Serial.println("❌ Failed to allocate memory");
-            http.end();
-            return false;
-        }
-        
-        // Download data
-        WiFiClient* stream = http.getStreamPtr();
-        size_t written = 0;
-        uint8_t buff[512];
-        
-        while (http.connected() && (written < len)) {
-            size_t available = stream->available();
-            if (available) {
-                int c = stream->readBytes(buff, ((available > sizeof(buff)) ? sizeof(buff) : available));
-                if (c > 0) {
-                    memcpy(mod->bytecode + written, buff, c);
-                    written += c;
-                    
-                    // Progress indicator
-                    if (written % 4096 == 0 || written == len) {
-                        Serial.printf("📊 Progress: %d/%d bytes (%.1f%%)\r", 
-                                    written, len, (float)written/len * 100);
-                    }
-                }
-            }
-            delay(1);
-        }
-        Serial.println();
-        
-        if (written == len) {
-            mod->size = len;
-            mod->loaded = true;
-            Serial.printf("✅ Successfully downloaded %s (%d bytes)\n", mod->name.c_str(), len);
-            http.end();
-            return true;
+
+    Console.printf("📥 Downloading: %s from %s\n", mod->name, mod->url);
+
+    uint8_t* bytecode;
+    size_t size;
+    if (!fetch_module_bytecode(id, &bytecode, &size)) {
+        return false;
+    }
+
+    SharedBytecode* blob = share_bytecode(bytecode, size);
+    if (blob == nullptr) {
+        return false;
+    }
+    // Started while the download ran
+    if (!install_shared_bytecode(id, blob)) {
+        Console.printf("⚠️  %s is running or being updated, downloaded copy kept on flash only\n", mod->name);
+        return false;
+    }
+    Console.printf("✅ Successfully downloaded %s (%d bytes)\n", mod->name, size);
+    return true;
+}
+
+void load_cached_modules() {
+    int loaded = 0;
+    for (int id : module_ids()) {
+        WasmModule* mod = get_module(id);
+        if (mod == nullptr || mod->loaded) continue;   // Shares a URL with one loaded earlier
+
+        ByteBuffer buffer = {};
+        if (cache_load(mod->url, &buffer, mod->sha256)) {
+            size_t size;
+            uint8_t* bytecode = byte_buffer_release(&buffer, &size);
+            if (install_module_bytecode(id, bytecode, size)) loaded++;
         } else {
-            Serial.printf("❌ Download incomplete: %d/%d bytes\n", written, len);
-            free(mod->bytecode);
-            mod->bytecode = nullptr;
+            byte_buffer_free(&buffer);
         }
-    } else {
-        Serial.printf("❌ HTTP error: %d\n", httpCode);
     }
-    
-    http.end();
-    return false;
+    Console.printf("💾 Loaded %d modules from flash cache\n", loaded);
+}
+
+int find_module_by_name(const String& name) {
+    lock_registry();
+    const char* key = find_interned(name);
+    auto it = (key != nullptr) ? by_name.find(key) : by_name.end();
+    int id = (it == by_name.end()) ? -1 : it->second->id;
+    unlock_registry();
+    return id;
 }
 
 void list_modules() {
-    Serial.println("\n📦 Available WASM Modules:");
-    Serial.println("==========================");
-    
-    int count = 0;
-    for (int i = 0; i < MAX_MODULES; i++) {
-        if (!modules[i].name.isEmpty()) {
-            count++;
-            Serial.printf("%d. %s %s\n", count,  // Use count, not i+1
-                         modules[i].name.c_str(),
-                         modules[i].loaded ? "✅ (loaded)" : "⏳ (not loaded)");
-            Serial.printf("   URL: %s\n", modules[i].url.c_str());
-            if (modules[i].loaded) {
-                Serial.printf("   Size: %d bytes\n", modules[i].size);
+    Console.println("\n📦 Available WASM Modules:");
+    Console.println("==========================");
+
+    std::vector<int> ids = module_ids();
+    for (int id : ids) {
+        WasmModule* mod = get_module(id);
+        if (mod == nullptr) continue;   // Removed since the snapshot
+
+        // A download worker may swap the blob meanwhile, so copy what is shown
+        lock_registry();
+        bool loaded = mod->loaded && mod->blob != nullptr;
+        size_t size = loaded ? mod->blob->size : 0;
+        int refs = loaded ? mod->blob->refs : 0;
+        String exports = loaded ? mod->blob->info.exports : String();
+        unsigned memory_pages = loaded ? mod->blob->info.memory_pages : 0;
+        unlock_registry();
+
+        Console.printf("%d. %s%s%s %s\n", id,
+                     mod->name,
+                     *mod->version ? " v" : "", mod->version,
+                     loaded ? "✅ (loaded)" : mod->evicted ? "💤 (evicted, reloads on use)" : "⏳ (not loaded)");
+        Console.printf("   URL: %s\n", mod->url);
+        if (mod->sha256[0]) {
+            Console.printf("   🔒 SHA-256: %s\n", mod->sha256);
+        }
+        if (loaded) {
+            Console.printf("   Size: %u bytes", (unsigned)size);
+            if (refs > 1) {
+                Console.printf(", 🔗 shared by %d entries", refs);
             }
+            Console.println();
+            Console.printf("   Exports: %s (memory %u pages)\n",
+                         exports.isEmpty() ? "none" : exports.c_str(), memory_pages);
+        } else if (mod->image_size > 0) {
+            Console.printf("   Last image: %u bytes, SHA-256 %.16s...\n",
+                         (unsigned)mod->image_size, sha256_hex(mod->image_sha256).c_str());
+        }
+        if (mod->run_count > 0) {
+            Console.printf("   Runs: %lu\n", (unsigned long)mod->run_count);
+        }
+        CacheEntry entry;
+        if (cache_lookup(mod->url, &entry)) {
+            Console.printf("   💾 Cached on flash%s%s\n",
+                         entry.etag.isEmpty() ? "" : ", ETag ", entry.etag.c_str());
         }
     }
-    
-    if (count == 0) {
-        Serial.println("No modules configured. Use 'a' to add modules.");
+
+    if (ids.empty()) {
+        Console.println("No modules configured. Use 'a' to add modules.");
     }
-}
\ No newline at end of file
+}
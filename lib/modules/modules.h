@@ -1,22 +1,139 @@
 #pragma once
 #include <Arduino.h>
+#include <vector>
+#include "downloader.h"
 
+struct WasmInstance;
+struct ArenaStats;
+
+// URL of modules uploaded to the device (upload_server.h) rather than
+// fetched; their only source is the flash copy
+#define LOCAL_MODULE_SCHEME "local://"
+
+// What parsing the bytecode found, see inspect_module()
+struct ModuleInfo {
+    String imports;          // "env.arduino_delay env.arduino_print"
+    String exports;          // "_start blink"
+    uint32_t memory_pages;   // Initial linear memory, in 64 KB pages
+    uint32_t max_pages;      // 0 when the module sets no maximum
+    bool has_start;
+};
+
+// Loaded bytecode, shared by every entry whose bytes hash the same, so a
+// binary listed under several names sits in RAM once. Freed when the
+// last entry lets go of it.
+struct SharedBytecode {
+    uint8_t* data;
+    size_t size;
+    uint8_t sha256[SHA256_SIZE];
+    int refs;
+    ModuleInfo info;
+};
+
+// Modules live in a registry keyed by a stable id (1, 2, ... never
+// reused), which is what serial commands and the saved list refer to.
+// Name, URL and version are interned: every distinct string is stored
+// once, so entries sharing a URL share the pointer and compare with ==.
 struct WasmModule {
-    String name;
-    String url;
-    uint8_t* bytecode;
+    int id;
+    const char* name;
+    const char* url;
+    const char* version;     // As published in the manifest, informational
+    char sha256[SHA256_SIZE * 2 + 1];  // Expected digest (hex) of the bytecode, empty if not pinned
+    String delta_url;        // Patch from the loaded bytecode to the next version, if offered
+    SharedBytecode* blob;    // nullptr until loaded
+    uint8_t* bytecode;       // blob->data and blob->size, for readers
     size_t size;
     bool loaded;
-};
+    bool evicted;            // Unloaded for memory; reloads on next use
+    bool installing;         // New bytecode going in: can't start meanwhile
+    uint32_t last_used_ms;   // Last start, call or install, for eviction
+    WasmInstance* instance;  // Cached runtime for exported-function calls
+
+    // Last image installed, kept after eviction; saved with the list
+    uint32_t image_size;
+    uint8_t image_sha256[SHA256_SIZE];
+    uint32_t run_count;      // Starts, across reboots
 
-extern WasmModule modules[];
-extern const int MAX_MODULES;
-extern int num_loaded_modules;
+    uint8_t autostart;       // Position in the boot list (autostart.h), 0 when not in it
+    int8_t core;             // Core the module task is pinned to, -1 for either
+
+    // CPU budget (percent of one core) and usage counters
+    uint8_t cpu_quota;
+    uint8_t cpu_usage;
+    uint32_t throttle_count;
+    uint32_t throttled_ms;
+};
 
 // Module management functions
 void init_modules();
 void cleanup_modules();
-bool add_module(const String& name, const String& url);
-bool remove_module(int index);
-bool download_module(int index);
-void list_modules();
\ No newline at end of file
+// Returns the new module's id, or -1. `id` restores a saved id when free.
+int add_module(const String& name, const String& url, int id = 0);
+// Ids are never handed out twice, across reboots too: the module list
+// saves the next one and restores it before adding the saved modules
+int next_free_module_id();
+void restore_next_module_id(int id);
+// Refused while the module runs, has a download or install in flight, or
+// while a hot reload, an eviction/compaction pass or a manifest sync on
+// another task is running
+bool remove_module(int id);
+// nullptr when no such module. Nothing pins the entry: remove_module()
+// or 'z' on another task frees it, so keep ids, not entries, across
+// anything that blocks.
+WasmModule* get_module(int id);
+// "?" for ids that no longer exist, for log lines about past jobs
+const char* module_name(int id);
+int module_count();
+std::vector<int> module_ids();   // Ascending, a snapshot
+// Points a module at a new source; a flash copy of the old URL is dropped
+void set_module_source(int id, const String& url, const String& sha256, const String& version);
+// Patch to try on the next download of `id`, see fetch_module()
+void set_module_delta(int id, const String& delta_url);
+// Digest of the bytecode `id` has loaded; false when it has none
+bool module_bytecode_sha256(int id, uint8_t digest[SHA256_SIZE]);
+bool download_module(int id);
+// Delta first when one is offered for the loaded bytecode, otherwise
+// (or when that fails) the full module through the flash cache;
+// `not_modified` reports a 304
+bool fetch_module(int id, DownloadRequest request, ByteBuffer* out, bool* not_modified);
+bool fetch_module_bytecode(int id, uint8_t** out, size_t* out_size, bool* not_modified = nullptr);
+void load_cached_modules();
+// Takes ownership of `bytecode` and installs it on `id` and on every
+// other entry with the same URL, except a running one. False when the
+// bytecode fails validation or `id` itself is running (or already being
+// installed to); `id` is left as it was then.
+bool install_module_bytecode(int id, uint8_t* bytecode, size_t size);
+// Takes ownership of `data` and returns a reference to the pooled copy
+// with the same content, which is `data` unless it was already loaded.
+// New content is validated first (see inspect_module()); nullptr when
+// it would not run.
+SharedBytecode* share_bytecode(uint8_t* data, size_t size);
+void release_bytecode(SharedBytecode* blob);
+// Same as install_module_bytecode(), handing over a reference from
+// share_bytecode(). `hot_swap` is for the module task replacing its own
+// bytecode, the one case where the running `id` is installed to.
+bool install_shared_bytecode(int id, SharedBytecode* blob, bool hot_swap = false);
+// Makes `id` the running module (current_module) unless bytecode is being
+// installed to it. Checked and set under the registry lock, the same one
+// install_shared_bytecode() checks current_module under, so no install
+// can swap bytecode under a module that is starting.
+bool mark_module_running(int id);
+// Drops the bytecode of `id` and of every entry sharing it, marking them
+// evicted. Refused (false) when one of them is running.
+bool unload_module_bytecode(int id);
+void touch_module(int id);
+// True when a blob has more references than entries holding it: a
+// fetch is patching against it, or a download or hot reload has it in
+// hand before installing it. Those read the image without the lock.
+bool bytecode_pinned();
+// Closes the gaps in the module arena and moves heap-held images into
+// it, then repoints every entry. Nothing may run from or parse an image
+// meanwhile. Refused (false) while bytecode_pinned(), checked under the
+// same lock the move runs under. `moved` is the bytes moved; `on_heap`
+// counts images that still did not fit.
+bool compact_bytecode(size_t* moved, int* on_heap);
+// arena_stats() under the registry lock, which the arena relies on
+void bytecode_arena_stats(ArenaStats* stats);
+int find_module_by_name(const String& name);   // Id, or -1
+void list_modules();
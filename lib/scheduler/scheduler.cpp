@@ -0,0 +1,496 @@
+#include "scheduler.h"
+#include "link_frame.h"
+#include <Preferences.h>
+#include <esp_timer.h>
+#include <sys/time.h>
+#include <time.h>
+#include "modules.h"
+#include "wasm_runner.h"
+#include "console_args.h"
+
+#define SCHED_TICK_US       ((int64_t)SCHED_TICK_MS * 1000)
+#define SCHED_WHEEL_SLOTS   (1 << SCHED_WHEEL_BITS)
+#define SCHED_WHEEL_MASK    (SCHED_WHEEL_SLOTS - 1)
+#define SCHED_WHEEL_SPAN    (1ULL << (SCHED_WHEEL_BITS * SCHED_WHEEL_LEVELS))
+#define SCHED_TIME_RETRY_MS 1000
+// A failing call backs off, doubling from one period up to this
+#define SCHED_WORK_QUEUE    4
+#define SCHED_BACKOFF_MAX_US ((int64_t)5 * 60 * 1000 * 1000)
+
+struct TimerEntry {
+    bool used;
+    uint32_t generation;     // Bumped on removal so in-flight fires are dropped
+    String module_name;
+    String function;
+    ScheduleKind kind;
+    uint32_t value;
+    bool waiting_for_time;   // Daily schedule parked until NTP has synced
+
+    int64_t due_us;          // esp_timer time the entry should fire at
+    uint64_t due_tick;
+    TimerEntry* next;
+    TimerEntry* prev;
+    TimerEntry** slot;
+
+    // Jitter statistics (lateness relative to due_us)
+    uint32_t runs;
+    uint32_t failures;
+    uint32_t failing;        // Consecutive failures, backing off while > 0
+    uint32_t missed;
+    int32_t jitter_min_us;
+    int32_t jitter_max_us;
+    int64_t jitter_sum_us;
+};
+
+static TimerEntry entries[SCHED_MAX_ENTRIES];
+static TimerEntry* wheel[SCHED_WHEEL_LEVELS][SCHED_WHEEL_SLOTS];
+static uint64_t wheel_tick = 0;     // Next tick to be processed
+static SemaphoreHandle_t sched_mutex = NULL;
+static TaskHandle_t sched_task_handle = NULL;
+static QueueHandle_t work_queue = NULL;
+static Preferences sched_prefs;
+
+static void save_schedules();
+
+static void wheel_unlink(TimerEntry* e) {
+    if (e->slot == nullptr) return;
+    if (e->prev) e->prev->next = e->next;
+    else *e->slot = e->next;
+    if (e->next) e->next->prev = e->prev;
+    e->next = e->prev = nullptr;
+    e->slot = nullptr;
+}
+
+static void wheel_insert(TimerEntry* e) {
+    uint64_t expires = e->due_tick;
+    TimerEntry** slot;
+
+    if (expires < wheel_tick) {
+        // Already due: fire on the next processed tick
+        slot = &wheel[0][wheel_tick & SCHED_WHEEL_MASK];
+    } else {
+        uint64_t delta = expires - wheel_tick;
+        if (delta >= SCHED_WHEEL_SPAN) {
+            // Beyond the wheel: park in the top level, re-inserted when cascaded
+            expires = wheel_tick + SCHED_WHEEL_SPAN - 1;
+            delta = SCHED_WHEEL_SPAN - 1;
+        }
+        int level = 0;
+        while (delta >= (1ULL << (SCHED_WHEEL_BITS * (level + 1)))) {
+            level++;
+        }
+        slot = &wheel[level][(expires >> (SCHED_WHEEL_BITS * level)) & SCHED_WHEEL_MASK];
+    }
+
+    e->prev = nullptr;
+    e->next = *slot;
+    if (e->next) e->next->prev = e;
+    *slot = e;
+    e->slot = slot;
+}
+
+// Moves every entry of one upper-level slot down to where it now belongs.
+static int wheel_cascade(int level) {
+    int index = (wheel_tick >> (SCHED_WHEEL_BITS * level)) & SCHED_WHEEL_MASK;
+    TimerEntry* e = wheel[level][index];
+    wheel[level][index] = nullptr;
+    while (e) {
+        TimerEntry* next = e->next;
+        e->slot = nullptr;
+        wheel_insert(e);
+        e = next;
+    }
+    return index;
+}
+
+static void set_due(TimerEntry* e, int64_t due_us) {
+    e->due_us = due_us;
+    e->due_tick = (due_us + SCHED_TICK_US - 1) / SCHED_TICK_US;
+}
+
+// Computes the next local-time occurrence of a daily schedule.
+static bool next_daily_due(uint32_t minute_of_day, int64_t* due_us) {
+    struct timeval tv;
+    gettimeofday(&tv, nullptr);
+    if (tv.tv_sec < 1000000000) {
+        return false;  // Time not synchronized yet
+    }
+
+    struct tm local;
+    localtime_r(&tv.tv_sec, &local);
+    int64_t now_sec = local.tm_hour * 3600 + local.tm_min * 60 + local.tm_sec;
+    int64_t wait_sec = (int64_t)minute_of_day * 60 - now_sec;
+    if (wait_sec <= 0) wait_sec += 24 * 3600;
+
+    *due_us = esp_timer_get_time() + wait_sec * 1000000 - tv.tv_usec;
+    return true;
+}
+
+static void arm_entry(TimerEntry* e, int64_t now_us) {
+    if (e->kind == SCHEDULE_EVERY) {
+        set_due(e, now_us + (int64_t)e->value * 1000);
+    } else {
+        int64_t due;
+        e->waiting_for_time = !next_daily_due(e->value, &due);
+        set_due(e, e->waiting_for_time ? now_us + SCHED_TIME_RETRY_MS * 1000 : due);
+    }
+    wheel_insert(e);
+}
+
+static void rearm_after_fire(TimerEntry* e, int64_t now_us) {
+    if (e->kind == SCHEDULE_EVERY && e->failing > 0) {
+        // A module that is gone or keeps trapping is retried less and
+        // less often instead of failing every period
+        int64_t period = (int64_t)e->value * 1000;
+        int64_t backoff = min(period << min<uint32_t>(e->failing, 16), SCHED_BACKOFF_MAX_US);
+        set_due(e, now_us + max(period, backoff));
+        wheel_insert(e);
+    } else if (e->kind == SCHEDULE_EVERY) {
+        // Keep the original phase so periods don't drift; skip whole
+        // periods that were overrun instead of firing a burst
+        int64_t period = (int64_t)e->value * 1000;
+        int64_t due = e->due_us + period;
+        if (due <= now_us) {
+            int64_t skipped = (now_us - due) / period + 1;
+            e->missed += skipped;
+            due += skipped * period;
+        }
+        set_due(e, due);
+        wheel_insert(e);
+    } else {
+        arm_entry(e, now_us);
+    }
+}
+
+static void record_jitter(TimerEntry* e, int64_t lateness_us, bool ok) {
+    int32_t jitter = (int32_t)lateness_us;
+    if (e->runs == 0 || jitter < e->jitter_min_us) e->jitter_min_us = jitter;
+    if (e->runs == 0 || jitter > e->jitter_max_us) e->jitter_max_us = jitter;
+    e->jitter_sum_us += jitter;
+    e->runs++;
+    if (!ok) e->failures++;
+    e->failing = ok ? 0 : e->failing + 1;
+}
+
+// Modules without bytecode are skipped rather than downloaded on the spot
+static bool module_callable(int module_id) {
+    WasmModule* mod = get_module(module_id);
+    return mod != nullptr && (mod->loaded || mod->evicted);
+}
+
+static void fire_entry(int id, int64_t fired_us) {
+    TimerEntry* e = &entries[id];
+
+    xSemaphoreTake(sched_mutex, portMAX_DELAY);
+    if (!e->used) {
+        xSemaphoreGive(sched_mutex);
+        return;
+    }
+    if (e->waiting_for_time) {
+        arm_entry(e, fired_us);
+        xSemaphoreGive(sched_mutex);
+        return;
+    }
+    uint32_t generation = e->generation;
+    String module_name = e->module_name;
+    String function = e->function;
+    int64_t lateness = fired_us - e->due_us;
+    xSemaphoreGive(sched_mutex);
+
+    // The call runs unlocked so serial commands stay usable meanwhile
+    int module_id = find_module_by_name(module_name);
+    M3Result result = "module not loaded";
+    if (module_callable(module_id)) {
+        result = call_module_function(module_id, function.c_str(), nullptr, 0, nullptr, nullptr);
+    }
+    bool ok = result == m3Err_none;
+
+    uint32_t failing = 0;
+    xSemaphoreTake(sched_mutex, portMAX_DELAY);
+    if (e->used && e->generation == generation) {
+        failing = e->failing;
+        record_jitter(e, lateness, ok);
+        rearm_after_fire(e, esp_timer_get_time());
+    }
+    xSemaphoreGive(sched_mutex);
+
+    // Reported when a failure streak starts and ends, not on every retry
+    if (!ok && failing == 0) {
+        Console.printf("❌ Schedule %d: %s.%s failed: %s (backing off)\n", id,
+                       module_name.c_str(), function.c_str(), result);
+    } else if (ok && failing > 0) {
+        Console.printf("✅ Schedule %d: %s.%s works again after %lu failures\n", id,
+                       module_name.c_str(), function.c_str(), (unsigned long)failing);
+    }
+}
+
+static void scheduler_task(void* parameter) {
+    TickType_t last_wake = xTaskGetTickCount();
+    int fired[SCHED_MAX_ENTRIES];
+
+    for (;;) {
+        vTaskDelayUntil(&last_wake, pdMS_TO_TICKS(SCHED_TICK_MS));
+        uint64_t target = esp_timer_get_time() / SCHED_TICK_US;
+
+        while (wheel_tick <= target) {
+            int count = 0;
+
+            xSemaphoreTake(sched_mutex, portMAX_DELAY);
+            int index = wheel_tick & SCHED_WHEEL_MASK;
+            if (index == 0) {
+                for (int level = 1; level < SCHED_WHEEL_LEVELS; level++) {
+                    if (wheel_cascade(level) != 0) break;
+                }
+            }
+
+            TimerEntry* e = wheel[0][index];
+            wheel[0][index] = nullptr;
+            while (e) {
+                TimerEntry* next = e->next;
+                e->slot = nullptr;
+                e->next = e->prev = nullptr;
+                if (e->due_tick > wheel_tick) {
+                    wheel_insert(e);  // Clamped entry, not due yet
+                } else {
+                    fired[count++] = e - entries;
+                }
+                e = next;
+            }
+            wheel_tick++;
+            xSemaphoreGive(sched_mutex);
+
+            for (int i = 0; i < count; i++) {
+                fire_entry(fired[i], esp_timer_get_time());
+            }
+        }
+
+        std::function<void()>* work;
+        while (xQueueReceive(work_queue, &work, 0) == pdTRUE) {
+            (*work)();
+            delete work;
+        }
+    }
+}
+
+bool run_on_scheduler(std::function<void()> work) {
+    std::function<void()>* item = new std::function<void()>(std::move(work));
+    if (xQueueSend(work_queue, &item, 0) != pdTRUE) {
+        delete item;
+        return false;
+    }
+    return true;
+}
+
+int add_schedule(const String& module_name, const String& function, ScheduleKind kind, uint32_t value) {
+    if (kind == SCHEDULE_EVERY && value < SCHED_TICK_MS) {
+        Console.printf("❌ Period must be at least %d ms\n", SCHED_TICK_MS);
+        return -1;
+    }
+    if (kind == SCHEDULE_DAILY && value >= 24 * 60) {
+        Console.println("❌ Invalid time of day");
+        return -1;
+    }
+
+    xSemaphoreTake(sched_mutex, portMAX_DELAY);
+    int id = -1;
+    for (int i = 0; i < SCHED_MAX_ENTRIES; i++) {
+        if (!entries[i].used) {
+            id = i;
+            break;
+        }
+    }
+    if (id < 0) {
+        xSemaphoreGive(sched_mutex);
+        Console.println("❌ Schedule table is full");
+        return -1;
+    }
+
+    TimerEntry* e = &entries[id];
+    uint32_t generation = e->generation;
+    *e = TimerEntry();
+    e->used = true;
+    e->generation = generation;
+    e->module_name = module_name;
+    e->function = function;
+    e->kind = kind;
+    e->value = value;
+    arm_entry(e, esp_timer_get_time());
+    xSemaphoreGive(sched_mutex);
+
+    return id;
+}
+
+bool remove_schedule(int id) {
+    if (id < 0 || id >= SCHED_MAX_ENTRIES) return false;
+
+    xSemaphoreTake(sched_mutex, portMAX_DELAY);
+    bool removed = entries[id].used;
+    if (removed) {
+        wheel_unlink(&entries[id]);
+        entries[id].used = false;
+        entries[id].generation++;
+        entries[id].module_name = "";
+        entries[id].function = "";
+    }
+    xSemaphoreGive(sched_mutex);
+    return removed;
+}
+
+void list_schedules() {
+    Console.println("\n⏱️  Module Schedules:");
+    Console.println("====================");
+
+    xSemaphoreTake(sched_mutex, portMAX_DELAY);
+    int count = 0;
+    int64_t now = esp_timer_get_time();
+    for (int i = 0; i < SCHED_MAX_ENTRIES; i++) {
+        TimerEntry* e = &entries[i];
+        if (!e->used) continue;
+        count++;
+
+        if (e->kind == SCHEDULE_EVERY) {
+            Console.printf("[%d] %s.%s every %lu ms\n", i, e->module_name.c_str(),
+                           e->function.c_str(), (unsigned long)e->value);
+        } else {
+            Console.printf("[%d] %s.%s daily at %02lu:%02lu%s\n", i, e->module_name.c_str(),
+                           e->function.c_str(), (unsigned long)(e->value / 60),
+                           (unsigned long)(e->value % 60),
+                           e->waiting_for_time ? " (waiting for NTP)" : "");
+        }
+        Console.printf("    Next in: %lld ms, runs: %lu, failures: %lu, missed: %lu%s\n",
+                       (long long)((e->due_us - now) / 1000), (unsigned long)e->runs,
+                       (unsigned long)e->failures, (unsigned long)e->missed,
+                       e->failing > 0 ? " (failing, backing off)" : "");
+        if (e->runs > 0) {
+            Console.printf("    Jitter: min %.2f / avg %.2f / max %.2f ms\n",
+                           e->jitter_min_us / 1000.0f,
+                           (float)e->jitter_sum_us / e->runs / 1000.0f,
+                           e->jitter_max_us / 1000.0f);
+        }
+    }
+    xSemaphoreGive(sched_mutex);
+
+    if (count == 0) {
+        Console.println("No schedules. Use 'e every <n> <func> <ms>' to add one.");
+    }
+}
+
+static void save_schedules() {
+    sched_prefs.clear();
+    int saved = 0;
+
+    xSemaphoreTake(sched_mutex, portMAX_DELAY);
+    for (int i = 0; i < SCHED_MAX_ENTRIES; i++) {
+        TimerEntry* e = &entries[i];
+        if (!e->used) continue;
+        String key = "s" + String(saved);
+        String value = e->module_name + "|" + e->function + "|" + String(e->kind) + "|" + String(e->value);
+        sched_prefs.putString(key.c_str(), value);
+        saved++;
+    }
+    xSemaphoreGive(sched_mutex);
+
+    sched_prefs.putInt("count", saved);
+    Console.printf("💾 Saved %d schedules to preferences\n", saved);
+}
+
+static void load_schedules() {
+    int count = sched_prefs.getInt("count", 0);
+    Console.printf("📂 Loading %d saved schedules\n", count);
+
+    for (int i = 0; i < count; i++) {
+        String key = "s" + String(i);
+        String value = sched_prefs.getString(key.c_str(), "");
+        int sep1 = value.indexOf('|');
+        int sep2 = value.indexOf('|', sep1 + 1);
+        int sep3 = value.indexOf('|', sep2 + 1);
+        if (sep1 <= 0 || sep2 <= sep1 || sep3 <= sep2) continue;
+
+        add_schedule(value.substring(0, sep1),
+                     value.substring(sep1 + 1, sep2),
+                     (ScheduleKind)value.substring(sep2 + 1, sep3).toInt(),
+                     value.substring(sep3 + 1).toInt());
+    }
+}
+
+void init_scheduler() {
+    sched_mutex = xSemaphoreCreateMutex();
+    work_queue = xQueueCreate(SCHED_WORK_QUEUE, sizeof(std::function<void()>*));
+    wheel_tick = esp_timer_get_time() / SCHED_TICK_US;
+
+    sched_prefs.begin("wasm-sched", false);
+    load_schedules();
+
+    // Scheduled and console calls run module code on this task
+    xTaskCreate(&scheduler_task, "scheduler", NATIVE_STACK_SIZE, NULL, WASM_TASK_PRIORITY, &sched_task_handle);
+}
+
+// Strict HH:MM, 00:00 to 23:59, as minute of day; -1 when malformed
+static int parse_time_of_day(const String& text) {
+    int colon = text.indexOf(':');
+    if (colon < 1 || colon > 2 || text.length() != (unsigned)colon + 3) return -1;
+    for (unsigned i = 0; i < text.length(); i++) {
+        if (i != (unsigned)colon && !isDigit(text[i])) return -1;
+    }
+    int hour = text.substring(0, colon).toInt();
+    int minute = text.substring(colon + 1).toInt();
+    if (hour > 23 || minute > 59) return -1;
+    return hour * 60 + minute;
+}
+
+// Resolves a module number as shown by the module list.
+static String module_name_from_number(const String& number) {
+    WasmModule* mod = get_module(number.toInt());
+    return mod != nullptr ? mod->name : "";
+}
+
+void handle_schedule_command(String args) {
+    String sub = take_token(args);
+
+    if (sub.isEmpty() || sub == "list") {
+        list_schedules();
+        return;
+    }
+
+    if (sub == "del") {
+        String id = take_token(args);
+        if (!id.isEmpty() && remove_schedule(id.toInt())) {
+            save_schedules();
+            Console.println("✅ Schedule removed");
+        } else {
+            Console.println("❌ No such schedule");
+        }
+        return;
+    }
+
+    if (sub == "every" || sub == "at") {
+        String module_name = module_name_from_number(take_token(args));
+        String function = take_token(args);
+        String when = take_token(args);
+
+        if (module_name.isEmpty() || function.isEmpty() || when.isEmpty()) {
+            Console.println("❌ Usage: e every <n> <func> <ms> | e at <n> <func> <HH:MM>");
+            return;
+        }
+
+        int id;
+        if (sub == "every") {
+            id = add_schedule(module_name, function, SCHEDULE_EVERY, when.toInt());
+        } else {
+            int minute = parse_time_of_day(when);
+            if (minute < 0) {
+                Console.println("❌ Time must be HH:MM, 00:00 to 23:59");
+                return;
+            }
+            id = add_schedule(module_name, function, SCHEDULE_DAILY, minute);
+        }
+
+        if (id >= 0) {
+            save_schedules();
+            Console.printf("✅ Schedule %d added for %s.%s\n", id, module_name.c_str(), function.c_str());
+        }
+        return;
+    }
+
+    Console.println("❌ Usage: e [list] | e every <n> <func> <ms> | e at <n> <func> <HH:MM> | e del <id>");
+}
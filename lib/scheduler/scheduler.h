@@ -0,0 +1,31 @@
+#pragma once
+#include <Arduino.h>
+#include <functional>
+
+// Hierarchical timer wheel: 4 levels of 64 slots at a 10 ms tick cover
+// roughly 46 hours, so daily wall-clock schedules fit without overflow.
+#define SCHED_TICK_MS        10
+#define SCHED_WHEEL_BITS     6
+#define SCHED_WHEEL_LEVELS   4
+#define SCHED_MAX_ENTRIES    16
+
+enum ScheduleKind : uint8_t {
+    SCHEDULE_EVERY = 0,   // value = period in ms
+    SCHEDULE_DAILY = 1,   // value = minute of day, local time from NTP
+};
+
+// Module functions are resolved by module name when they fire, so
+// schedules survive modules being removed and re-added in another slot.
+// Periodic calls that fail (module gone, not loaded, trapping) back off,
+// doubling the wait up to 5 minutes until one succeeds again.
+void init_scheduler();
+// Runs `work` on the scheduler task, between timer ticks. Module code
+// called from elsewhere goes through here, so it gets a module-sized stack
+// at the console's priority. False when the queue is full.
+bool run_on_scheduler(std::function<void()> work);
+int add_schedule(const String& module_name, const String& function, ScheduleKind kind, uint32_t value);
+bool remove_schedule(int id);
+void list_schedules();
+
+// Serial command 'e': list | every <n> <func> <ms> | at <n> <func> <HH:MM> | del <id>
+void handle_schedule_command(String args);
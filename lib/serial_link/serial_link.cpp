@@ -0,0 +1,278 @@
+#include "serial_link.h"
+#include "modules.h"
+#include "module_cache.h"
+#include "upload_server.h"
+#include "wasm_runner.h"
+
+#define LINK_FRAME_MAX      (SERIAL_LINK_CHUNK + 64)
+#define LINK_QUIET_MS       20      // Input gap that hands the console task back
+
+static bool link_active = false;
+static uint32_t last_frame_ms = 0;
+static uint32_t text_baud = 0;      // Restored when the link closes
+static uint8_t rx_seq = 0;
+static const char* refused_prompt = nullptr;   // Set when the running command wanted input
+
+// Encoded bytes since the last delimiter, decoded in place
+static uint8_t rx[LINK_FRAME_MAX];
+static size_t rx_len = 0;
+static bool rx_overflow = false;
+static uint32_t rx_dropped = 0;
+
+struct LinkUpload {
+    bool active;
+    String name;
+    uint32_t size;
+    uint32_t offset;
+    uint32_t start_ms;
+};
+static LinkUpload upload;
+
+static uint32_t read_le32(const uint8_t* p) {
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static void write_le32(uint8_t* p, uint32_t v) {
+    p[0] = v;
+    p[1] = v >> 8;
+    p[2] = v >> 16;
+    p[3] = v >> 24;
+}
+
+static void send_frame(uint8_t type, const uint8_t* payload = nullptr, size_t len = 0) {
+    uint8_t wire[LINK_WIRE_MAX(LINK_REPLY_MAX)];
+    Serial.write(wire, link_frame_encode(type, rx_seq, payload, len, wire));
+}
+
+static void send_error(uint8_t code, const char* message) {
+    uint8_t payload[LINK_REPLY_MAX];
+    size_t len = min<size_t>(strlen(message), sizeof(payload) - 1);
+    payload[0] = code;
+    memcpy(payload + 1, message, len);
+    send_frame(LINK_REPLY_ERROR, payload, len + 1);
+}
+
+static void send_ack() {
+    uint8_t payload[4];
+    write_le32(payload, upload.offset);
+    send_frame(LINK_REPLY_ACK, payload, sizeof(payload));
+}
+
+static void end_upload() {
+    if (upload.active) cache_upload_abort();
+    upload = LinkUpload();
+}
+
+static void close_link(const char* why) {
+    end_upload();
+    Console.set_framed(false);
+    Serial.flush();
+    if (Serial.baudRate() != text_baud) {
+        Serial.updateBaudRate(text_baud);
+    }
+    link_active = false;
+    rx_len = 0;
+    Console.printf("\n🔌 Serial link closed (%s), %lu bad frames dropped\n", why,
+                   (unsigned long)rx_dropped);
+}
+
+static void handle_hello(const uint8_t* payload, size_t len) {
+    uint32_t baud = Serial.baudRate();
+    if (len >= 4) {
+        uint32_t wanted = read_le32(payload);
+        if (wanted > 0 && wanted <= SERIAL_LINK_MAX_BAUD) baud = wanted;
+    }
+
+    uint8_t reply[8];
+    reply[0] = SERIAL_LINK_VERSION;
+    reply[1] = SERIAL_LINK_CHUNK & 0xFF;
+    reply[2] = SERIAL_LINK_CHUNK >> 8;
+    reply[3] = SERIAL_LINK_WINDOW;
+    write_le32(reply + 4, baud);
+    send_frame(LINK_REPLY_HELLO, reply, sizeof(reply));
+
+    // The reply goes out at the old rate
+    if (baud != Serial.baudRate()) {
+        Serial.flush();
+        Serial.updateBaudRate(baud);
+    }
+}
+
+static void handle_begin(const uint8_t* payload, size_t len) {
+    if (len < 5) return send_error(LINK_ERROR_FRAME, "BEGIN needs a size and a name");
+    end_upload();
+
+    String name;
+    for (size_t i = 4; i < len; i++) name += (char)payload[i];
+    if (!upload_name_valid(name)) {
+        return send_error(LINK_ERROR_REFUSED, "name must be 1-32 letters, digits, '_', '-' or '.'");
+    }
+    if (upload_target_busy(name)) {
+        return send_error(LINK_ERROR_REFUSED, upload_error_message(UPLOAD_BUSY));
+    }
+    if (cache_upload_active()) {
+        return send_error(LINK_ERROR_REFUSED, "another upload is in progress");
+    }
+    if (!cache_upload_begin(LOCAL_MODULE_SCHEME + name)) {
+        return send_error(LINK_ERROR_FLASH, "flash cache unavailable");
+    }
+
+    upload.active = true;
+    upload.name = name;
+    upload.size = read_le32(payload);
+    upload.offset = 0;
+    upload.start_ms = millis();
+    send_ack();
+}
+
+static void handle_data(const uint8_t* payload, size_t len) {
+    if (!upload.active) return send_error(LINK_ERROR_STATE, "no upload in progress");
+    if (len < 4) return send_error(LINK_ERROR_FRAME, "DATA needs an offset");
+
+    // One before it went missing; ask for the bytes from there again
+    if (read_le32(payload) != upload.offset) return send_ack();
+
+    size_t n = len - 4;
+    if (upload.offset + n > upload.size) {
+        end_upload();
+        return send_error(LINK_ERROR_FRAME, "more data than announced");
+    }
+    if (!cache_upload_write(payload + 4, n)) {
+        end_upload();
+        return send_error(LINK_ERROR_FLASH, "flash is full");
+    }
+    upload.offset += n;
+    send_ack();
+}
+
+static void handle_end(const uint8_t* payload, size_t len) {
+    if (!upload.active) return send_error(LINK_ERROR_STATE, "no upload in progress");
+    if (upload.offset != upload.size) {
+        end_upload();
+        return send_error(LINK_ERROR_STATE, "upload incomplete");
+    }
+
+    bool run = len > 0 && payload[0];
+    String name = upload.name;
+    uint32_t elapsed = millis() - upload.start_ms;
+    upload = LinkUpload();    // The cache upload is install_uploaded_module()'s now
+    int id = install_uploaded_module(name);
+    if (id < 0) return send_error(LINK_ERROR_REFUSED, upload_error_message(id));
+
+    WasmModule* mod = get_module(id);
+    uint8_t reply[2 + 4 + SHA256_SIZE + 4];
+    reply[0] = id & 0xFF;
+    reply[1] = id >> 8;
+    write_le32(reply + 2, mod->size);
+    memcpy(reply + 6, mod->blob->sha256, SHA256_SIZE);
+    write_le32(reply + 6 + SHA256_SIZE, elapsed);
+    Console.printf("✅ Received %s over serial (%u bytes) in %lu ms\n", mod->name, (unsigned)mod->size,
+                   (unsigned long)elapsed);
+    send_frame(LINK_REPLY_MODULE, reply, sizeof(reply));
+
+    if (run) start_module(id);
+}
+
+static void handle_frame(size_t encoded_len, ConsoleCommandFn run_command) {
+    size_t len;
+    if (!link_frame_decode(rx, encoded_len, &len)) {
+        // No reply: the host times out and resends from the last ACK
+        rx_dropped++;
+        return;
+    }
+
+    uint8_t type = rx[0];
+    rx_seq = rx[1];
+    const uint8_t* payload = rx + LINK_HEADER_SIZE;
+    last_frame_ms = millis();
+    Console.begin_request(rx_seq);
+
+    switch (type) {
+        case LINK_HELLO:
+            handle_hello(payload, len);
+            break;
+
+        case LINK_COMMAND: {
+            String line;
+            for (size_t i = 0; i < len; i++) line += (char)payload[i];
+            refused_prompt = nullptr;
+            run_command(line);
+            if (refused_prompt) {
+                String message = String("it asks for input the link can't give: ") + refused_prompt;
+                message.trim();
+                send_error(LINK_ERROR_PROMPT, message.c_str());
+            } else {
+                send_frame(LINK_REPLY_DONE);
+            }
+            break;
+        }
+
+        case LINK_BEGIN: handle_begin(payload, len); break;
+        case LINK_DATA:  handle_data(payload, len); break;
+        case LINK_END:   handle_end(payload, len); break;
+
+        case LINK_CLOSE:
+            send_frame(LINK_REPLY_DONE);
+            close_link("by host");
+            break;
+
+        default:
+            send_error(LINK_ERROR_FRAME, "unknown frame type");
+            break;
+    }
+    Console.end_request();
+}
+
+static void feed(uint8_t b, ConsoleCommandFn run_command) {
+    if (b == 0) {
+        if (rx_len > 0 && !rx_overflow) handle_frame(rx_len, run_command);
+        if (rx_overflow) rx_dropped++;
+        rx_len = 0;
+        rx_overflow = false;
+    } else if (rx_len < sizeof(rx)) {
+        rx[rx_len++] = b;
+    } else {
+        rx_overflow = true;
+    }
+}
+
+bool serial_link_active() {
+    return link_active;
+}
+
+void serial_link_refuse_prompt(const char* prompt) {
+    if (!refused_prompt) refused_prompt = prompt;
+}
+
+bool serial_link_service(ConsoleCommandFn run_command) {
+    if (!link_active) {
+        if (!Serial.available() || Serial.peek() != 0) return false;
+        link_active = true;
+        Console.set_framed(true);
+        text_baud = Serial.baudRate();
+        last_frame_ms = millis();
+        rx_len = 0;
+        rx_dropped = 0;
+    }
+
+    // Keep reading while the host is sending, so an upload isn't paced by the console task's wake-ups
+    uint8_t buf[256];
+    uint32_t last_input = millis();
+    while (link_active && millis() - last_input < LINK_QUIET_MS) {
+        int available = Serial.available();
+        if (available <= 0) {
+            delay(1);
+            continue;
+        }
+        size_t n = Serial.read(buf, min<size_t>(available, sizeof(buf)));
+        for (size_t i = 0; i < n && link_active; i++) {
+            feed(buf[i], run_command);
+        }
+        last_input = millis();
+    }
+
+    if (link_active && millis() - last_frame_ms > SERIAL_LINK_IDLE_MS) {
+        close_link("host went quiet");
+    }
+    return true;
+}
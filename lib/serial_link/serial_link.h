@@ -0,0 +1,59 @@
+#pragma once
+#include <Arduino.h>
+#include "link_frame.h"
+
+// Binary protocol on the USB serial link, next to the text console, for
+// driving the device and pushing modules from a host without WiFi (see
+// tools/serial_link.py). Frames are COBS-encoded and sent as
+// 0x00 <frame> 0x00; console text never contains 0x00, so the first one
+// from the host switches input to frames until a CLOSE or
+// SERIAL_LINK_IDLE_MS of silence. Frames are laid out as in link_frame.h,
+// with integers little-endian. Replies echo the request's seq.
+//
+//   host -> device                  device -> host
+//   HELLO    baud (u32, 0 keeps)    HELLO   version (u8), chunk (u16), window (u8), baud (u32)
+//   COMMAND  console line           DONE    after the command's output, or ERROR
+//                                           when it wanted to prompt for more
+//   BEGIN    size (u32), name       ACK     offset of the next byte wanted (u32)
+//   DATA     offset (u32), bytes    ACK
+//   END      run (u8)               MODULE  id (u16), size (u32), SHA-256, ms (u32)
+//   CLOSE                           DONE, then text at the old baud
+//                                   ERROR   code (u8), message
+//                                   OUTPUT  text printed handling a request, its seq
+//                                   LOG     any other text, seq 0
+//
+// The device switches to the HELLO baud rate right after replying. An
+// upload is streamed to flash like an HTTP one (upload_server.h) and may
+// run `window` DATA frames ahead of the last ACK; each chunk is written
+// before it is acknowledged, which is the flow control. A DATA frame at
+// the wrong offset (one was lost or corrupted) is answered with an ACK
+// of the offset wanted, and the host goes back to it.
+//
+// What the firmware prints goes through Console (link_frame.h), which
+// sends it in OUTPUT and LOG frames while the link is active. Only what
+// bypasses it, like panics and the ROM's boot messages, arrives as text.
+#define SERIAL_LINK_VERSION     2
+#define SERIAL_LINK_CHUNK       4096
+#define SERIAL_LINK_WINDOW      3
+#define SERIAL_LINK_RX_BUFFER   (16 * 1024)   // UART RX buffer, holds a window of chunks
+#define SERIAL_LINK_IDLE_MS     10000
+#define SERIAL_LINK_MAX_BAUD    3000000
+
+enum LinkError {
+    LINK_ERROR_FRAME = 1,     // Unknown type or short payload
+    LINK_ERROR_STATE = 2,     // DATA or END without an upload
+    LINK_ERROR_REFUSED = 3,   // Upload refused, see the message
+    LINK_ERROR_FLASH = 4,     // Flash full or failing
+    LINK_ERROR_PROMPT = 5,    // The command asked for input; pass its arguments
+};
+
+// Runs one console line, as if typed
+typedef void (*ConsoleCommandFn)(String line);
+
+// From the console input loop, before it reads text. True when it took
+// the input: the link is active, or a frame just started it.
+bool serial_link_service(ConsoleCommandFn run_command);
+bool serial_link_active();
+// From console_prompt() while the link is active: nobody can answer, so
+// the command gets "" and the host an ERROR instead of DONE
+void serial_link_refuse_prompt(const char* prompt);
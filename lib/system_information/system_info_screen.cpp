@@ -9,6 +9,31 @@ extern int current_module;
 
 lv_obj_t* screen_sysinfo;
 
+static lv_obj_t* label_heap;
+static lv_obj_t* label_block;
+static lv_obj_t* label_psram;
+static lv_obj_t* label_uptime;
+static lv_obj_t* label_module;
+static lv_obj_t* label_cpu;
+
+// Refreshes the values that change while the screen is shown
+static void update_system_info_labels(lv_timer_t* timer) {
+    lv_label_set_text_fmt(label_heap, "Free Heap: %d B", ESP.getFreeHeap());
+    lv_label_set_text_fmt(label_block, "Largest Block: %d B", ESP.getMaxAllocHeap());
+    lv_label_set_text_fmt(label_psram, "Free PSRAM: %d B", ESP.getFreePsram());
+    lv_label_set_text_fmt(label_uptime, "Uptime: %lu ms", millis());
+
+    WasmModule* mod = get_module(current_module);
+    if (mod != nullptr) {
+        lv_label_set_text_fmt(label_module, "Module: %s", mod->name);
+        lv_label_set_text_fmt(label_cpu, "CPU: %u%%/%u%% thr %lu",
+                              mod->cpu_usage, mod->cpu_quota, (unsigned long)mod->throttle_count);
+    } else {
+        lv_label_set_text(label_module, "Module: None");
+        lv_label_set_text(label_cpu, "CPU: -");
+    }
+}
+
 void create_system_info_screen() {
     screen_sysinfo = lv_obj_create(NULL);
 
@@ -32,30 +57,27 @@ void create_system_info_screen() {
     lv_obj_align(label_flash, LV_ALIGN_TOP_LEFT, 10, 115);
     lv_label_set_text_fmt(label_flash, "Flash: %d KB", ESP.getFlashChipSize() / 1024);
 
-    lv_obj_t* label_heap = lv_label_create(screen_sysinfo);
+    label_heap = lv_label_create(screen_sysinfo);
     lv_obj_align(label_heap, LV_ALIGN_TOP_LEFT, 10, 140);
-    lv_label_set_text_fmt(label_heap, "Free Heap: %d B", ESP.getFreeHeap());
 
-    lv_obj_t* label_block = lv_label_create(screen_sysinfo);
+    label_block = lv_label_create(screen_sysinfo);
     lv_obj_align(label_block, LV_ALIGN_TOP_LEFT, 10, 165);
-    lv_label_set_text_fmt(label_block, "Largest Block: %d B", ESP.getMaxAllocHeap());
 
-    lv_obj_t* label_psram = lv_label_create(screen_sysinfo);
+    label_psram = lv_label_create(screen_sysinfo);
     lv_obj_align(label_psram, LV_ALIGN_TOP_LEFT, 10, 190);
-    lv_label_set_text_fmt(label_psram, "Free PSRAM: %d B", ESP.getFreePsram());
 
-    lv_obj_t* label_uptime = lv_label_create(screen_sysinfo);
+    label_uptime = lv_label_create(screen_sysinfo);
     lv_obj_align(label_uptime, LV_ALIGN_TOP_LEFT, 10, 215);
-    lv_label_set_text_fmt(label_uptime, "Uptime: %lu ms", millis());
 
     // Optional: current module
-    lv_obj_t* label_module = lv_label_create(screen_sysinfo);
+    label_module = lv_label_create(screen_sysinfo);
     lv_obj_align(label_module, LV_ALIGN_TOP_LEFT, 10, 240);
-    if (current_module >= 0) {
-        lv_label_set_text_fmt(label_module, "Module: %s", modules[current_module].name);
-    } else {
-        lv_label_set_text(label_module, "Module: None");
-    }
+
+    label_cpu = lv_label_create(screen_sysinfo);
+    lv_obj_align(label_cpu, LV_ALIGN_TOP_LEFT, 10, 265);
+
+    update_system_info_labels(NULL);
+    lv_timer_create(update_system_info_labels, 1000, NULL);
 
     // Back button
     lv_obj_t* btn_back = lv_btn_create(screen_sysinfo);
@@ -1,22 +1,39 @@
 #include <lvgl.h>
 #include <TFT_eSPI.h>
-#include <CST816S.h>
+#include <Wire.h>
 #include "ui_lvgl.h"
 #include "wifi_manager.h"
 #include "system_info_screen.h"
+#include "download_manager.h"
 
 #define TFT_HOR_RES   240
 #define TFT_VER_RES   240
 #define DRAW_BUF_SIZE (TFT_HOR_RES * TFT_VER_RES / 10 * (LV_COLOR_DEPTH / 8))
 
+#define TOUCH_I2C_ADDR      0x15
+#define TOUCH_REG_GESTURE   0x01    // Gesture, points, then X and Y
+#define TOUCH_EVENT_UP      1
+#define TOUCH_READ_MS       20      // While a finger is down
+
+#define UI_TASK_STACK       (8 * 1024)
+#define UI_TASK_PRIORITY    2       // Above modules, so touch stays responsive
+#define UI_TASK_CORE        1
+#define UI_MAX_SLEEP_MS     1000
+
 extern TFT_eSPI tft;
-extern CST816S touch;
 
 static uint32_t draw_buf[DRAW_BUF_SIZE / 4];
 static lv_display_t *disp;
+static lv_indev_t *touch_indev;
+
+static TaskHandle_t ui_task_handle = NULL;
+static volatile bool touch_irq = false;
 
 lv_obj_t* screen_main;
 
+static lv_obj_t* bar_download;
+static lv_obj_t* label_download;
+
 void my_disp_flush(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
     tft.startWrite();
     tft.setAddrWindow(area->x1, area->y1, area->x2 - area->x1 + 1, area->y2 - area->y1 + 1);
@@ -25,13 +42,55 @@ void my_disp_flush(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map) {
     lv_display_flush_ready(disp);
 }
 
+// Read over I2C directly: the CST816S driver's IRQ handler is replaced
+// by the one that wakes the UI task (ui_start_task)
+static bool read_touch_point(int32_t* x, int32_t* y) {
+    uint8_t buf[6];
+    Wire.beginTransmission(TOUCH_I2C_ADDR);
+    Wire.write(TOUCH_REG_GESTURE);
+    if (Wire.endTransmission(true) != 0) return false;
+    if (Wire.requestFrom(TOUCH_I2C_ADDR, (int)sizeof(buf)) != sizeof(buf)) return false;
+    for (size_t i = 0; i < sizeof(buf); i++) {
+        buf[i] = Wire.read();
+    }
+
+    if (buf[1] == 0 || (buf[2] >> 6) == TOUCH_EVENT_UP) return false;
+    *x = ((buf[2] & 0x0F) << 8) | buf[3];
+    *y = ((buf[4] & 0x0F) << 8) | buf[5];
+    return true;
+}
+
 void my_touchpad_read(lv_indev_t *indev, lv_indev_data_t *data) {
-    if (touch.available()) {
+    int32_t x, y;
+    if (read_touch_point(&x, &y)) {
         data->state = LV_INDEV_STATE_PRESSED;
-        data->point.x = touch.data.x;
-        data->point.y = touch.data.y;
+        data->point.x = x;
+        data->point.y = y;
     } else {
         data->state = LV_INDEV_STATE_RELEASED;
+        // Nothing to read until the controller raises its IRQ again
+        lv_timer_pause(lv_indev_get_read_timer(indev));
+    }
+}
+
+static void IRAM_ATTR touch_isr() {
+    touch_irq = true;
+    BaseType_t woken = pdFALSE;
+    vTaskNotifyGiveFromISR(ui_task_handle, &woken);
+    if (woken) portYIELD_FROM_ISR();
+}
+
+// Sleeps until LVGL's next timer is due or the touch IRQ fires
+static void ui_task(void* param) {
+    for (;;) {
+        if (touch_irq) {
+            touch_irq = false;
+            lv_timer_t* read_timer = lv_indev_get_read_timer(touch_indev);
+            lv_timer_resume(read_timer);
+            lv_timer_ready(read_timer);
+        }
+        uint32_t next_ms = lv_timer_handler();
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(min<uint32_t>(next_ms, UI_MAX_SLEEP_MS)));
     }
 }
 
@@ -39,6 +98,24 @@ uint32_t my_tick() {
     return millis();
 }
 
+// Download workers run on their own tasks, so the bar is refreshed by
+// polling from the LVGL thread rather than from their callbacks.
+static void update_download_progress(lv_timer_t* timer) {
+    size_t received, total;
+    int active;
+    if (!get_download_overview(&received, &total, &active)) {
+        lv_obj_add_flag(bar_download, LV_OBJ_FLAG_HIDDEN);
+        lv_obj_add_flag(label_download, LV_OBJ_FLAG_HIDDEN);
+        return;
+    }
+
+    int percent = total > 0 ? (int)(received * 100 / total) : 0;
+    lv_bar_set_value(bar_download, percent, LV_ANIM_OFF);
+    lv_label_set_text_fmt(label_download, "📥 %d download%s %d%%", active, active == 1 ? "" : "s", percent);
+    lv_obj_clear_flag(bar_download, LV_OBJ_FLAG_HIDDEN);
+    lv_obj_clear_flag(label_download, LV_OBJ_FLAG_HIDDEN);
+}
+
 void create_main_screen() {
     screen_main = lv_obj_create(NULL);
 
@@ -63,6 +140,19 @@ void create_main_screen() {
     }, LV_EVENT_CLICKED, NULL);
     lv_obj_t* lbl_sys = lv_label_create(btn_sys);
     lv_label_set_text(lbl_sys, "🧠 System Info");
+
+    // Download progress, hidden while nothing is queued
+    bar_download = lv_bar_create(screen_main);
+    lv_obj_set_size(bar_download, 180, 10);
+    lv_obj_align(bar_download, LV_ALIGN_BOTTOM_MID, 0, -30);
+    lv_bar_set_range(bar_download, 0, 100);
+    lv_obj_add_flag(bar_download, LV_OBJ_FLAG_HIDDEN);
+
+    label_download = lv_label_create(screen_main);
+    lv_obj_align(label_download, LV_ALIGN_BOTTOM_MID, 0, -45);
+    lv_obj_add_flag(label_download, LV_OBJ_FLAG_HIDDEN);
+
+    lv_timer_create(update_download_progress, 250, NULL);
 }
 
 
@@ -76,13 +166,20 @@ void ui_init() {
     lv_display_set_buffers(disp, draw_buf, NULL, sizeof(draw_buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
     lv_display_set_rotation(disp, LV_DISPLAY_ROTATION_0);
 
-    lv_indev_t *indev = lv_indev_create();
-    lv_indev_set_type(indev, LV_INDEV_TYPE_POINTER);
-    lv_indev_set_read_cb(indev, my_touchpad_read);
+    touch_indev = lv_indev_create();
+    lv_indev_set_type(touch_indev, LV_INDEV_TYPE_POINTER);
+    lv_indev_set_read_cb(touch_indev, my_touchpad_read);
+    lv_timer_set_period(lv_indev_get_read_timer(touch_indev), TOUCH_READ_MS);
 
     create_main_screen();
     create_system_info_screen();
 
-    setup_wifi();            // Initiate WiFi in the background
     lv_scr_load(screen_main); // Start with the main menu screen
 }
+
+void ui_start_task(int touch_irq_pin) {
+    xTaskCreatePinnedToCore(&ui_task, "ui", UI_TASK_STACK, NULL, UI_TASK_PRIORITY,
+                            &ui_task_handle, UI_TASK_CORE);
+    detachInterrupt(touch_irq_pin);
+    attachInterrupt(touch_irq_pin, touch_isr, FALLING);   // The CST816S pulls IRQ low on a touch
+}
@@ -2,6 +2,9 @@
 #define UI_LVGL_H
 
 void ui_init();
+// LVGL runs on its own task from here on, woken by the touch controller's
+// IRQ line; nothing else may call into LVGL after this
+void ui_start_task(int touch_irq_pin);
 void my_touchpad_read(struct _lv_indev_t *indev, lv_indev_data_t *data);
 extern lv_obj_t* screen_main;
 extern void show_wifi_screen();  
@@ -0,0 +1,227 @@
+#include "upload_server.h"
+#include "link_frame.h"
+#include <WebServer.h>
+#include <WiFi.h>
+#include "modules.h"
+#include "module_cache.h"
+#include "module_store.h"
+#include "download_manager.h"
+
+extern int current_module;
+
+#ifdef UPLOAD_TOKEN
+static_assert(sizeof(UPLOAD_TOKEN) > 1, "UPLOAD_TOKEN must not be empty");
+#endif
+
+static WebServer server(UPLOAD_SERVER_PORT);
+static bool server_started = false;
+
+// The request being received; WebServer serves one client at a time
+struct UploadState {
+    String name;
+    bool receiving;
+    int status;         // HTTP error to answer with, 0 while all is well
+    String error;
+    uint32_t start_ms;
+};
+static UploadState upload;
+
+static void fail(int status, const char* error) {
+    if (upload.status == 0) {
+        upload.status = status;
+        upload.error = error;
+    }
+    if (upload.receiving) cache_upload_abort();
+    upload.receiving = false;
+}
+
+bool upload_name_valid(const String& name) {
+    if (name.isEmpty() || name.length() > 32) return false;
+    for (size_t i = 0; i < name.length(); i++) {
+        char c = name[i];
+        if (!isalnum(c) && c != '_' && c != '-' && c != '.') return false;
+    }
+    return true;
+}
+
+bool upload_target_busy(const String& name) {
+    int id = find_module_by_name(name);
+    return id >= 0 && (id == current_module || download_pending(id));
+}
+
+const char* upload_error_message(int error) {
+    switch (error) {
+        case UPLOAD_NOT_MODULE: return "not a module payload";
+        case UPLOAD_REJECTED:   return "module rejected, see the serial log";
+        case UPLOAD_BUSY:       return "module is running or downloading";
+        default:                return "could not add the module";
+    }
+}
+
+#ifdef UPLOAD_TOKEN
+// Looks at every byte whatever the first mismatch, so the reply time
+// doesn't tell how much of a guess was right
+static bool token_matches(const String& given) {
+    static const char expected[] = UPLOAD_TOKEN;
+    size_t len = sizeof(expected) - 1;
+    uint8_t diff = given.length() != len;
+    for (size_t i = 0; i < len; i++) {
+        uint8_t c = i < given.length() ? given[i] : 0;
+        diff |= c ^ (uint8_t)expected[i];
+    }
+    return diff == 0;
+}
+#endif
+
+static void upload_begin(const String& filename) {
+    if (upload.receiving || upload.status != 0) {
+        return fail(400, "one module per request");
+    }
+#ifdef UPLOAD_TOKEN
+    if (!token_matches(server.header("X-Upload-Token"))) {
+        return fail(401, "bad or missing X-Upload-Token");
+    }
+#endif
+    upload.name = server.arg("name");
+    if (upload.name.isEmpty() && filename.endsWith(".wasm")) {
+        upload.name = filename.substring(0, filename.length() - 5);
+    }
+    if (!upload_name_valid(upload.name)) {
+        return fail(400, "name= must be 1-32 letters, digits, '_', '-' or '.'");
+    }
+    if (upload_target_busy(upload.name)) {
+        return fail(409, "module is running or downloading");
+    }
+    if (cache_upload_active()) {
+        return fail(409, "another upload is in progress");
+    }
+    if (!cache_upload_begin(LOCAL_MODULE_SCHEME + upload.name)) {
+        return fail(500, "flash cache unavailable");
+    }
+    upload.receiving = true;
+    upload.start_ms = millis();
+    Console.printf("📤 Receiving upload of %s\n", upload.name.c_str());
+}
+
+static void upload_chunk(const uint8_t* data, size_t len) {
+    if (!upload.receiving) return;
+    if (!cache_upload_write(data, len)) {
+        fail(507, "flash is full");
+    }
+}
+
+static void handle_upload_data() {
+    if (server.header("Content-Type").startsWith("multipart/")) {
+        HTTPUpload& part = server.upload();
+        switch (part.status) {
+            case UPLOAD_FILE_START:   upload_begin(part.filename); break;
+            case UPLOAD_FILE_WRITE:   upload_chunk(part.buf, part.currentSize); break;
+            case UPLOAD_FILE_END:     break;
+            case UPLOAD_FILE_ABORTED: fail(400, "upload aborted"); break;
+        }
+    } else {
+        HTTPRaw& raw = server.raw();
+        switch (raw.status) {
+            case RAW_START:   upload_begin(""); break;
+            case RAW_WRITE:   upload_chunk(raw.buf, raw.currentSize); break;
+            case RAW_END:     break;
+            case RAW_ABORTED: fail(400, "upload aborted"); break;
+        }
+    }
+}
+
+// Validated before anything is replaced, so a bad build leaves the
+// module and its flash copy as they were
+int install_uploaded_module(const String& name) {
+    ByteBuffer buffer = {};
+    if (!cache_upload_finish(&buffer)) {
+        byte_buffer_free(&buffer);
+        cache_upload_abort();
+        return UPLOAD_NOT_MODULE;
+    }
+    size_t size;
+    uint8_t* bytecode = byte_buffer_release(&buffer, &size);
+    SharedBytecode* blob = share_bytecode(bytecode, size);
+    if (blob == nullptr) {
+        cache_upload_abort();
+        return UPLOAD_REJECTED;
+    }
+
+    String url = LOCAL_MODULE_SCHEME + name;
+    int id = find_module_by_name(name);
+    if (upload_target_busy(name)) {
+        release_bytecode(blob);
+        cache_upload_abort();
+        return UPLOAD_BUSY;
+    }
+    if (id < 0) {
+        id = add_module(name, url);
+    } else {
+        set_module_source(id, url, "", "");
+    }
+    if (id < 0) {
+        release_bytecode(blob);
+        cache_upload_abort();
+        return UPLOAD_FAILED;
+    }
+
+    if (!cache_upload_commit()) {
+        Console.printf("⚠️  %s is not on flash and won't survive a reboot\n", name.c_str());
+    }
+    if (!install_shared_bytecode(id, blob)) {
+        // Started while the upload ran; 'h' swaps it in
+        Console.printf("⚠️  %s is running or being updated, upload kept on flash only\n", name.c_str());
+    }
+    save_module_list();
+    return id;
+}
+
+// Indexed by -UploadError
+static const int upload_http_status[] = { 0, 400, 422, 409, 500 };
+
+static void handle_upload_done() {
+    if (upload.status == 0 && !upload.receiving) {
+        fail(400, "no module in the request body");
+    }
+    int id = -1;
+    if (upload.status == 0) {
+        id = install_uploaded_module(upload.name);
+        if (id < 0) fail(upload_http_status[-id], upload_error_message(id));
+    }
+
+    if (id < 0) {
+        Console.printf("❌ Upload refused: %s\n", upload.error.c_str());
+        server.send(upload.status, "application/json",
+                    String("{\"error\":\"") + upload.error + "\"}");
+    } else {
+        WasmModule* mod = get_module(id);
+        uint32_t elapsed = millis() - upload.start_ms;
+        Console.printf("✅ Uploaded %s (%u bytes) in %lu ms\n", mod->name, (unsigned)mod->size,
+                       (unsigned long)elapsed);
+        char reply[192];
+        snprintf(reply, sizeof(reply), "{\"id\":%d,\"name\":\"%s\",\"size\":%u,\"sha256\":\"%s\",\"ms\":%lu}",
+                 id, mod->name, (unsigned)mod->size, sha256_hex(mod->blob->sha256).c_str(),
+                 (unsigned long)elapsed);
+        server.send(200, "application/json", reply);
+    }
+    upload = UploadState();
+}
+
+bool service_upload_server() {
+#ifndef UPLOAD_TOKEN
+    // Anyone on the network could replace modules, so no token, no server
+    return false;
+#endif
+    if (!server_started) {
+        if (WiFi.status() != WL_CONNECTED) return false;
+
+        static const char* headers[] = { "Content-Type", "X-Upload-Token" };
+        server.collectHeaders(headers, 2);
+        server.on(UPLOAD_PATH, HTTP_POST, handle_upload_done, handle_upload_data);
+        server.begin();
+        server_started = true;
+        Console.printf("📤 Module uploads: http://%s" UPLOAD_PATH "\n", WiFi.localIP().toString().c_str());
+    }
+    server.handleClient();
+    return true;
+}
@@ -0,0 +1,41 @@
+#pragma once
+#include <Arduino.h>
+
+// HTTP endpoint for pushing modules to the device, e.g. from CI:
+//
+//   curl --data-binary @blink.wasm -H "Content-Type: application/wasm" "http://<device>/modules?name=blink"
+//   curl -F "module=@blink.wasm" "http://<device>/modules"
+//
+// The body (raw, or the file of a multipart form) streams to flash as it
+// arrives; gzip and LZ4 payloads are accepted like downloads. Once it
+// validates, it becomes module `name` (the file name without ".wasm" when
+// not given) with URL local://<name>, replacing the bytecode of a module
+// of that name that is not running. The reply is a small JSON object.
+//
+// Raw bodies need a non-form Content-Type: the web server buffers
+// x-www-form-urlencoded bodies (curl's default) in RAM.
+//
+// Opt-in: the server only starts in builds that define a non-empty
+// UPLOAD_TOKEN, and every upload must carry it in an X-Upload-Token header.
+#define UPLOAD_SERVER_PORT 80
+#define UPLOAD_PATH        "/modules"
+
+// Starts listening once WiFi is up (never without UPLOAD_TOKEN); called
+// from the console task, which also installs the uploads it accepts.
+// True while listening.
+bool service_upload_server();
+
+// Shared with the serial link (serial_link.h), which receives modules the
+// same way. install_uploaded_module() takes what cache_upload_*() got and
+// returns the module id or one of these.
+enum UploadError {
+    UPLOAD_NOT_MODULE = -1,   // Not decodable as a module payload
+    UPLOAD_REJECTED = -2,     // Failed validation, see the serial log
+    UPLOAD_BUSY = -3,         // The module of that name runs or is downloading
+    UPLOAD_FAILED = -4,       // Could not be added
+};
+
+bool upload_name_valid(const String& name);
+bool upload_target_busy(const String& name);
+int install_uploaded_module(const String& name);
+const char* upload_error_message(int error);
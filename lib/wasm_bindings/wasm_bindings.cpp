@@ -2,6 +2,8 @@
 #include <wasm3.h>
 #include <m3_env.h>
 #include "wasm_bindings.h"
+#include "wasm_runner.h"
+#include "link_frame.h"
 
 #define DEFINE_WASM_API(name, args_block, native_call) \
     m3ApiRawFunction(name) { \
@@ -10,16 +12,22 @@
         m3ApiSuccess(); \
     }
 
+// Host calls double as safe points for stopping, hot reload and CPU
+// throttling
 DEFINE_WASM_API(
   m3_arduino_delay,
   m3ApiGetArg(uint32_t, ms),
-  delay(ms)
+  module_sleep(ms);
+  M3Result trap = module_safe_point();
+  if (trap) m3ApiTrap(trap)
 )
 
 DEFINE_WASM_API(
   m3_arduino_print,
   m3ApiGetArgMem(const char*, str),
-  Serial.print(str)
+  Console.print(str);
+  M3Result trap = module_safe_point();
+  if (trap) m3ApiTrap(trap)
 )
 
 #define ARDUINO_WASM_BINDINGS \
@@ -31,17 +39,30 @@ M3Result LinkArduino(IM3Runtime runtime)
     IM3Module module = runtime->modules;
     const char* env = "env";
 
-    Serial.println("🔗 Linking Arduino functions...");
+    Console.println("🔗 Linking Arduino functions...");
 
     M3Result result = m3Err_none;
 
     #define X(name, sig, fn) \
         result = m3_LinkRawFunction(module, env, name, sig, &fn); \
-        if (result == m3Err_none) Serial.println("✓ " name " linked"); \
-        else Serial.printf("❌ Failed to link " name ": %s\n", result);
+        if (result == m3Err_none) Console.println("✓ " name " linked"); \
+        else Console.printf("❌ Failed to link " name ": %s\n", result);
 
     ARDUINO_WASM_BINDINGS
     #undef X
 
     return m3Err_none;
 }
+
+bool wasm_binding_exists(const char* module, const char* field)
+{
+    if (strcmp(module, "env") != 0) return false;
+
+    #define X(name, sig, fn) \
+        if (strcmp(field, name) == 0) return true;
+
+    ARDUINO_WASM_BINDINGS
+    #undef X
+
+    return false;
+}
@@ -2,3 +2,5 @@
 #include <wasm3.h>
 
 M3Result LinkArduino(IM3Runtime runtime);
+// True when `module`.`field` is a function LinkArduino() provides
+bool wasm_binding_exists(const char* module, const char* field);
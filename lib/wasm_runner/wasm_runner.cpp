@@ -1,138 +1,688 @@
 #include <Arduino.h>
 #include <wasm3.h>
 #include <m3_env.h>
+#include <atomic>
+#include <string>
+#include <unordered_map>
 #include "modules.h"
 #include "wasm_bindings.h"
 #include "wasm_runner.h"
+#include "cpu_quota.h"
+#include "module_memory.h"
+#include "link_frame.h"
 
 #define WASM_STACK_SLOTS    1024
-#define NATIVE_STACK_SIZE   (32*1024)
 #define WASM_MEMORY_LIMIT   4096
 
+// How long a hot reload waits for the module to reach a safe point
+// (a host call) before falling back to a stop/start swap
+#define HOT_SWAP_TIMEOUT_MS 5000
+// How long a stop waits for one before deleting the module task
+#define STOP_TIMEOUT_MS     1000
+
 extern TaskHandle_t wasm_task_handle;
 extern int current_module;
 
 TaskHandle_t wasm_task_handle = NULL;
 int current_module = -1;
 
-void wasm_task(void* parameter)
+M3Result const wasm_trap_hot_swap = "[trap] hot swap requested";
+M3Result const wasm_trap_stop = "[trap] stop requested";
+
+struct WasmInstance {
+    IM3Environment env;
+    IM3Runtime runtime;
+    // m3_FindFunction results, so repeated calls skip the export lookup
+    std::unordered_map<std::string, IM3Function> functions;
+};
+
+// A fully loaded replacement for the running module, prepared off the
+// module task and adopted by it at the next safe point
+struct PendingSwap {
+    int module_id;
+    SharedBytecode* blob;
+    WasmInstance instance;
+    IM3Function start;
+    bool keep_memory;
+    volatile bool adopted;
+};
+
+static PendingSwap* pending_swap = nullptr;
+static std::atomic<int> reloads_in_flight(0);
+static portMUX_TYPE swap_mux = portMUX_INITIALIZER_UNLOCKED;
+
+// Stopping is cooperative: the module task traps out at its next host
+// call and frees its runtime itself. Only a task that makes no host call
+// within STOP_TIMEOUT_MS is deleted, and its runtime freed for it.
+static volatile bool stop_requested = false;
+static bool task_killed = false;       // Both guarded by swap_mux
+static bool task_exiting = false;
+static WasmInstance* running_instance = nullptr;
+
+// Guards every cached instance; wasm3 runtimes are not thread safe
+static SemaphoreHandle_t instance_mutex()
 {
-    int module_id = (int)(intptr_t)parameter;
+    static SemaphoreHandle_t mutex = xSemaphoreCreateRecursiveMutex();
+    return mutex;
+}
 
-    if (module_id < 0 || module_id >= MAX_MODULES || modules[module_id].name.isEmpty()) {
-        Serial.println("❌ Invalid module ID");
-        vTaskDelete(NULL);
-        return;
+static void free_instance(WasmInstance* instance)
+{
+    if (instance->runtime) m3_FreeRuntime(instance->runtime);
+    if (instance->env) m3_FreeEnvironment(instance->env);
+    instance->runtime = NULL;
+    instance->env = NULL;
+    instance->functions.clear();
+}
+
+// Parses, loads and links bytecode into a fresh runtime.
+static M3Result load_instance(const uint8_t* bytecode, size_t size, WasmInstance* instance)
+{
+    instance->env = m3_NewEnvironment();
+    instance->runtime = NULL;
+    if (!instance->env) {
+        return "failed to create environment";
     }
 
-    WasmModule* mod = &modules[module_id];
-    
-    // Check if module is loaded
-    if (!mod->loaded || mod->bytecode == nullptr) {
-        Serial.println("❌ Module not loaded. Please download it first.");
-        vTaskDelete(NULL);
-        return;
+    instance->runtime = m3_NewRuntime(instance->env, WASM_STACK_SLOTS, NULL);
+    if (!instance->runtime) {
+        free_instance(instance);
+        return "failed to create runtime";
+    }
+    instance->runtime->memoryLimit = WASM_MEMORY_LIMIT;
+
+    IM3Module module;
+    M3Result result = m3_ParseModule(instance->env, &module, bytecode, size);
+    if (!result) {
+        result = m3_LoadModule(instance->runtime, module);
+        if (result) m3_FreeModule(module);
+    }
+    if (!result) {
+        result = LinkArduino(instance->runtime);
+    }
+    if (result) {
+        free_instance(instance);
     }
-    Serial.printf("🚀 Starting WASM Module: %s\n", mod->name);
+    return result;
+}
+
+static void append_name(String& list, const String& name)
+{
+    if (!list.isEmpty()) list += " ";
+    list += name;
+}
 
+M3Result inspect_module(const uint8_t* bytecode, size_t size, ModuleInfo* info)
+{
+    *info = ModuleInfo();
     IM3Environment env = m3_NewEnvironment();
     if (!env) {
-        Serial.println("❌ Failed to create environment");
-        vTaskDelete(NULL);
-        return;
+        return "failed to create environment";
     }
 
-    IM3Runtime runtime = m3_NewRuntime(env, WASM_STACK_SLOTS, NULL);
-    if (!runtime) {
-        Serial.println("❌ Failed to create runtime");
-        vTaskDelete(NULL);
-        return;
+    IM3Module module;
+    M3Result result = m3_ParseModule(env, &module, bytecode, size);
+    if (result) {
+        m3_FreeEnvironment(env);
+        return result;
     }
 
-    runtime->memoryLimit = WASM_MEMORY_LIMIT;
+    for (uint32_t i = 0; i < module->numFunctions; i++) {
+        M3Function* f = &module->functions[i];
+        if (i < module->numFuncImports) {
+            String name = String(f->import.moduleUtf8) + "." + f->import.fieldUtf8;
+            append_name(info->imports, name);
+            if (!wasm_binding_exists(f->import.moduleUtf8, f->import.fieldUtf8)) {
+                Console.printf("❌ Unresolved import: %s\n", name.c_str());
+                result = "imports functions the host does not provide";
+            }
+        }
+        if (f->export_name) {
+            append_name(info->exports, f->export_name);
+            if (strcmp(f->export_name, "_start") == 0) info->has_start = true;
+        }
+    }
+    info->memory_pages = module->memoryInfo.initPages;
+    info->max_pages = module->memoryInfo.maxPages;
 
-    IM3Module module;
-    M3Result result = m3_ParseModule(env, &module, mod->bytecode, mod->size);
-    if (result) {
-        Serial.print("❌ ParseModule failed: ");
-        Serial.println(result);
-        vTaskDelete(NULL);
-        return;
+    m3_FreeModule(module);
+    m3_FreeEnvironment(env);
+    return result;
+}
+
+void module_sleep(uint32_t ms)
+{
+    if (xTaskGetCurrentTaskHandle() != wasm_task_handle) {
+        delay(ms);
+    } else if (!stop_requested) {
+        // stop_current_module() wakes it early
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(ms));
     }
+}
 
-    result = m3_LoadModule(runtime, module);
-    if (result) {
-        Serial.print("❌ LoadModule failed: ");
-        Serial.println(result);
-        vTaskDelete(NULL);
-        return;
+M3Result module_safe_point()
+{
+    uint32_t penalty = cpu_quota_take_penalty();
+    if (penalty > 0) module_sleep(penalty);
+
+    if (xTaskGetCurrentTaskHandle() != wasm_task_handle) return m3Err_none;
+    if (stop_requested) return wasm_trap_stop;
+    if (pending_swap != nullptr) return wasm_trap_hot_swap;
+    return m3Err_none;
+}
+
+static PendingSwap* take_pending_swap()
+{
+    portENTER_CRITICAL(&swap_mux);
+    PendingSwap* swap = pending_swap;
+    pending_swap = nullptr;
+    portEXIT_CRITICAL(&swap_mux);
+    return swap;
+}
+
+// Switches the module task over to a prepared runtime, whose `_start` then
+// runs from the top. Only linear memory is carried, when asked and both
+// versions use the same memory size; globals, tables and the call stack
+// of the old version are dropped with its runtime.
+static void adopt_swap(int module_id, PendingSwap* swap, WasmInstance* current, IM3Function* start)
+{
+    WasmModule* mod = get_module(module_id);
+
+    if (swap->keep_memory) {
+        uint32_t old_size = 0, new_size = 0;
+        uint8_t* old_mem = m3_GetMemory(current->runtime, &old_size, 0);
+        uint8_t* new_mem = m3_GetMemory(swap->instance.runtime, &new_size, 0);
+        if (old_mem && new_mem && old_size == new_size) {
+            memcpy(new_mem, old_mem, new_size);
+            Console.printf("🧠 Carried %lu bytes of linear memory across (globals start fresh)\n",
+                           (unsigned long)new_size);
+        } else {
+            Console.println("⚠️  Memory layout changed, starting with fresh memory");
+        }
     }
 
-    result = LinkArduino(runtime);
+    free_instance(current);
+    *current = swap->instance;
+    *start = swap->start;
+
+    // Also drops the cached call runtimes, which point into the old bytecode
+    install_shared_bytecode(module_id, swap->blob, true);
+
+    swap->adopted = true;
+    Console.printf("🔁 Hot swapped module: %s\n", mod->name);
+}
+
+// `instance` is freed by the caller, also when this returns early
+static void run_module(int module_id, WasmInstance* instance)
+{
+    WasmModule* mod = get_module(module_id);
+
+    M3Result result = load_instance(mod->bytecode, mod->size, instance);
     if (result) {
-        Serial.print("❌ LinkArduino failed: ");
-        Serial.println(result);
-        vTaskDelete(NULL);
+        Console.print("❌ Loading module failed: ");
+        Console.println(result);
         return;
     }
 
     IM3Function f;
-    result = m3_FindFunction(&f, runtime, "_start");
+    result = m3_FindFunction(&f, instance->runtime, "_start");
     if (result) {
-        Serial.print("❌ Cannot find _start function: ");
-        Serial.println(result);
-        vTaskDelete(NULL);
+        Console.print("❌ Cannot find _start function: ");
+        Console.println(result);
         return;
     }
 
-    Serial.printf("✅ Running module: %s\n", mod->name);
-    Serial.println("📝 Send 's' to stop and return to menu");
+    Console.printf("✅ Running module: %s\n", mod->name);
+    Console.println("📝 Send 's' to stop and return to menu");
 
-    result = m3_CallV(f);
+    for (;;) {
+        result = m3_CallV(f);
+        if (result != wasm_trap_hot_swap) break;
 
-    if (result) {
-        Serial.print("❌ WASM execution error: ");
-        Serial.println(result);
+        PendingSwap* swap = take_pending_swap();
+        if (swap == nullptr) break;
+        adopt_swap(module_id, swap, instance, &f);
+    }
+
+    if (result && result != wasm_trap_stop) {
+        Console.print("❌ WASM execution error: ");
+        Console.println(result);
+    }
+}
+
+void wasm_task(void* parameter)
+{
+    int module_id = (int)(intptr_t)parameter;
+
+    WasmModule* mod = get_module(module_id);
+    if (mod == nullptr) {
+        Console.println("❌ Invalid module ID");
+    } else if (!mod->loaded || mod->bytecode == nullptr) {
+        Console.println("❌ Module not loaded. Please download it first.");
+    } else {
+        Console.printf("🚀 Starting WASM Module: %s\n", mod->name);
+        cpu_quota_attach(xTaskGetCurrentTaskHandle(), module_id);
+        // On the heap, so a stop that has to delete this task can free it
+        running_instance = new WasmInstance();
+        run_module(module_id, running_instance);
+        Console.printf("🏁 Module '%s' stopped\n", mod->name);
+    }
+
+    // Single exit path so nothing keeps a handle to a deleted task
+    portENTER_CRITICAL(&swap_mux);
+    bool killed = task_killed;
+    task_exiting = !killed;
+    portEXIT_CRITICAL(&swap_mux);
+    if (killed) {
+        // stop_current_module() is deleting this task right now
+        for (;;) vTaskDelay(portMAX_DELAY);
     }
 
-    Serial.printf("🏁 Module '%s' stopped\n", mod->name);
+    if (running_instance != nullptr) {
+        free_instance(running_instance);
+        delete running_instance;
+        running_instance = nullptr;
+    }
+    cpu_quota_detach(xTaskGetCurrentTaskHandle());
+    wasm_task_handle = NULL;
+    current_module = -1;
     vTaskDelete(NULL);
 }
 
 void stop_current_module()
 {
-    if (wasm_task_handle != NULL) {
-        Serial.println("🛑 Stopping current module...");
-        vTaskDelete(wasm_task_handle);
+    TaskHandle_t task = wasm_task_handle;
+    if (task == NULL) {
+        Console.println("ℹ️  No module is currently running");
+        return;
+    }
+
+    Console.println("🛑 Stopping current module...");
+    stop_requested = true;
+    xTaskNotifyGive(task);   // Cuts a delay() short
+    uint32_t start = millis();
+    while (wasm_task_handle == task && millis() - start < STOP_TIMEOUT_MS) {
+        delay(10);
+    }
+
+    portENTER_CRITICAL(&swap_mux);
+    bool kill = wasm_task_handle == task && !task_exiting;
+    task_killed = kill;
+    portEXIT_CRITICAL(&swap_mux);
+
+    if (kill) {
+        // No host call for a whole second means it is looping in its own
+        // code, so it holds no host locks and can be deleted
+        Console.println("⚠️  No host call reached, deleting the module task");
+        vTaskDelete(task);
+        delay(10);   // Lets the other core switch away if it ran there
+        cpu_quota_detach(task);
+        if (running_instance != nullptr) {
+            free_instance(running_instance);
+            delete running_instance;
+            running_instance = nullptr;
+        }
         wasm_task_handle = NULL;
         current_module = -1;
-        Serial.println("✅ Module stopped");
     } else {
-        Serial.println("ℹ️  No module is currently running");
+        // Exiting by itself; wait for the handle to clear
+        while (wasm_task_handle == task) delay(1);
     }
+
+    stop_requested = false;
+    Console.println("✅ Module stopped");
 }
 
 void start_module(int module_id)
 {
-    if (module_id < 0 || module_id >= MAX_MODULES || modules[module_id].name.isEmpty()) {
-        Serial.println("❌ Invalid module selection");
+    WasmModule* mod = get_module(module_id);
+    if (mod == nullptr) {
+        Console.println("❌ Invalid module selection");
+        return;
+    }
+
+    touch_module(module_id);   // Also keeps it from being evicted meanwhile
+    if (!mod->loaded && !mod->evicted) {
+        Console.println("❌ Module not loaded. Download it first with 'l' command.");
+        return;
+    }
+    if (!ensure_module_loaded(module_id)) {
+        Console.println("❌ Could not reload the evicted module");
         return;
     }
-    
-    if (!modules[module_id].loaded) {
-        Serial.println("❌ Module not loaded. Download it first with 'l' command.");
+    // Known since download, so there is nothing to find out at start
+    if (!mod->blob->info.has_start) {
+        Console.printf("❌ %s has no _start; call its exports with 'f'\n", mod->name);
         return;
     }
 
     stop_current_module();
 
-    current_module = module_id;
-    xTaskCreate(&wasm_task,
-                modules[module_id].name.c_str(),
-                NATIVE_STACK_SIZE,
-                (void*)(intptr_t)module_id,
-                5,
-                &wasm_task_handle);
+    portENTER_CRITICAL(&swap_mux);
+    task_killed = false;
+    task_exiting = false;
+    portEXIT_CRITICAL(&swap_mux);
+    stop_requested = false;
+    if (!mark_module_running(module_id)) {
+        Console.printf("❌ %s is being updated, try again\n", mod->name);
+        return;
+    }
+    mod->run_count++;
+    xTaskCreatePinnedToCore(&wasm_task,
+                            mod->name,
+                            NATIVE_STACK_SIZE,
+                            (void*)(intptr_t)module_id,
+                            WASM_TASK_PRIORITY,
+                            &wasm_task_handle,
+                            mod->core < 0 ? tskNO_AFFINITY : mod->core);
 
-    Serial.printf("🚀 Started module: %s\n", modules[module_id].name.c_str());
+    Console.printf("🚀 Started module: %s\n", mod->name);
+}
+
+struct HotReloadRequest {
+    int module_id;
+    bool keep_memory;
+};
+
+static void hot_reload(const HotReloadRequest& request)
+{
+    int module_id = request.module_id;
+    WasmModule* mod = get_module(module_id);
+
+    Console.printf("📥 Hot reload: fetching %s in the background\n", mod->name);
+
+    PendingSwap* swap = new PendingSwap();
+    swap->module_id = module_id;
+    swap->keep_memory = request.keep_memory;
+
+    M3Result result = "download failed";
+    bool not_modified = false;
+    uint8_t* bytecode;
+    size_t size;
+    if (fetch_module_bytecode(swap->module_id, &bytecode, &size, &not_modified) && not_modified) {
+        Console.printf("✅ %s is already up to date\n", mod->name);
+        free(bytecode);
+        delete swap;
+        return;
+    }
+    // Pooled first, so the new runtime points into the copy that is kept
+    swap->blob = bytecode ? share_bytecode(bytecode, size) : nullptr;
+    if (bytecode != nullptr && swap->blob == nullptr) {
+        result = "module rejected";
+    }
+    if (swap->blob != nullptr) {
+        result = load_instance(swap->blob->data, swap->blob->size, &swap->instance);
+        if (!result) {
+            result = m3_FindFunction(&swap->start, swap->instance.runtime, "_start");
+        }
+    }
+
+    if (result) {
+        // The old version keeps running untouched
+        Console.printf("❌ Hot reload of %s failed: %s\n", mod->name, result);
+        free_instance(&swap->instance);
+        release_bytecode(swap->blob);
+        delete swap;
+        return;
+    }
+
+    bool published = false;
+    if (current_module == module_id) {
+        portENTER_CRITICAL(&swap_mux);
+        pending_swap = swap;
+        portEXIT_CRITICAL(&swap_mux);
+        published = true;
+
+        uint32_t start = millis();
+        while (!swap->adopted && current_module == module_id &&
+               millis() - start < HOT_SWAP_TIMEOUT_MS) {
+            delay(10);
+        }
+    }
+
+    if (published && !swap->adopted && take_pending_swap() == nullptr) {
+        // The module task picked it up; let it finish adopting
+        uint32_t start = millis();
+        while (!swap->adopted && millis() - start < 1000) {
+            delay(10);
+        }
+    }
+
+    if (swap->adopted) {
+        delete swap;
+        return;
+    }
+
+    // Not adopted: the module isn't running or never reached a host call
+    bool was_running = (current_module == module_id);
+    if (was_running) {
+        Console.println("⚠️  No safe point reached, restarting the module instead");
+        stop_current_module();
+    }
+    free_instance(&swap->instance);
+    install_shared_bytecode(module_id, swap->blob);
+    delete swap;
+
+    Console.printf("✅ Module %s updated (%u bytes)\n", mod->name, (unsigned)mod->size);
+    if (was_running) {
+        start_module(module_id);
+    }
+}
+
+static void hot_reload_task(void* parameter)
+{
+    hot_reload(*(HotReloadRequest*)parameter);
+    delete (HotReloadRequest*)parameter;
+    reloads_in_flight--;
+    vTaskDelete(NULL);
+}
+
+void hot_reload_module(int module_id, bool keep_memory)
+{
+    if (get_module(module_id) == nullptr) {
+        Console.println("❌ Invalid module selection");
+        return;
+    }
+
+    reloads_in_flight++;
+    xTaskCreate(&hot_reload_task, "hot_reload", 12 * 1024,
+                new HotReloadRequest{module_id, keep_memory}, 2, NULL);
+}
+
+bool hot_reload_active()
+{
+    return reloads_in_flight > 0;
+}
+
+void lock_module_runtimes()
+{
+    xSemaphoreTakeRecursive(instance_mutex(), portMAX_DELAY);
+}
+
+void unlock_module_runtimes()
+{
+    xSemaphoreGiveRecursive(instance_mutex());
+}
+
+static WasmInstance* load_module_instance(int module_id)
+{
+    WasmModule* mod = get_module(module_id);
+    touch_module(module_id);
+    if (mod->instance != nullptr) {
+        return mod->instance;
+    }
+
+    ensure_module_loaded(module_id);
+    if (!mod->loaded || mod->bytecode == nullptr) {
+        Console.printf("❌ Module '%s' not loaded. Download it first.\n", mod->name);
+        return nullptr;
+    }
+
+    WasmInstance instance;
+    M3Result result = load_instance(mod->bytecode, mod->size, &instance);
+    if (result) {
+        Console.printf("❌ Failed to load '%s': %s\n", mod->name, result);
+        return nullptr;
+    }
+
+    mod->instance = new WasmInstance(instance);
+    return mod->instance;
+}
+
+static M3Result find_cached_function(WasmInstance* instance, const char* function, IM3Function* f)
+{
+    auto cached = instance->functions.find(function);
+    if (cached != instance->functions.end()) {
+        *f = cached->second;
+        return m3Err_none;
+    }
+
+    M3Result result = m3_FindFunction(f, instance->runtime, function);
+    if (!result) {
+        instance->functions.emplace(function, *f);
+    }
+    return result;
+}
+
+// Runs the call once arguments have been converted to the signature.
+static M3Result call_function(int module_id, IM3Function f, const WasmValue* args, int argc,
+                              WasmValue* results, int* result_count)
+{
+    if (argc != (int)m3_GetArgCount(f)) {
+        return "wrong number of arguments";
+    }
+    int retc = m3_GetRetCount(f);
+    if (retc > WASM_MAX_CALL_VALUES) {
+        return "too many results";
+    }
+
+    const void* argptrs[WASM_MAX_CALL_VALUES];
+    for (int i = 0; i < argc; i++) {
+        if (args[i].type != m3_GetArgType(f, i)) {
+            return "argument type mismatch";
+        }
+        argptrs[i] = &args[i].i32;
+    }
+
+    // Charged to the module's quota like its `_start`
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    cpu_quota_attach(self, module_id);
+    M3Result result = m3_Call(f, argc, argptrs);
+    cpu_quota_detach(self);
+    if (result) return result;
+
+    if (results != nullptr) {
+        const void* retptrs[WASM_MAX_CALL_VALUES];
+        for (int i = 0; i < retc; i++) {
+            results[i].type = m3_GetRetType(f, i);
+            retptrs[i] = &results[i].i32;
+        }
+        result = m3_GetResults(f, retc, retptrs);
+        if (result_count != nullptr) *result_count = retc;
+    }
+    return result;
+}
+
+M3Result call_module_function(int module_id, const char* function,
+                              const WasmValue* args, int argc,
+                              WasmValue* results, int* result_count)
+{
+    if (get_module(module_id) == nullptr) {
+        return "invalid module";
+    }
+    if (argc > WASM_MAX_CALL_VALUES) {
+        return "too many arguments";
+    }
+
+    xSemaphoreTakeRecursive(instance_mutex(), portMAX_DELAY);
+
+    WasmInstance* instance = load_module_instance(module_id);
+    M3Result result = "module not loaded";
+    if (instance != nullptr) {
+        IM3Function f;
+        result = find_cached_function(instance, function, &f);
+        if (!result) {
+            result = call_function(module_id, f, args, argc, results, result_count);
+        }
+    }
+
+    xSemaphoreGiveRecursive(instance_mutex());
+    return result;
+}
+
+static bool parse_value(const char* text, M3ValueType type, WasmValue* value)
+{
+    char* end;
+    value->type = type;
+    switch (type) {
+        case c_m3Type_i32: value->i32 = (int32_t)strtol(text, &end, 0); break;
+        case c_m3Type_i64: value->i64 = (int64_t)strtoll(text, &end, 0); break;
+        case c_m3Type_f32: value->f32 = strtof(text, &end); break;
+        case c_m3Type_f64: value->f64 = strtod(text, &end); break;
+        default: return false;
+    }
+    return end != text && *end == '\0';
+}
+
+M3Result call_module_function_argv(int module_id, const char* function,
+                                   int argc, const char* argv[],
+                                   WasmValue* results, int* result_count)
+{
+    if (get_module(module_id) == nullptr) {
+        return "invalid module";
+    }
+    if (argc > WASM_MAX_CALL_VALUES) {
+        return "too many arguments";
+    }
+
+    xSemaphoreTakeRecursive(instance_mutex(), portMAX_DELAY);
+
+    WasmInstance* instance = load_module_instance(module_id);
+    M3Result result = "module not loaded";
+    if (instance != nullptr) {
+        IM3Function f;
+        result = find_cached_function(instance, function, &f);
+        if (!result && argc != (int)m3_GetArgCount(f)) {
+            result = "wrong number of arguments";
+        }
+
+        WasmValue args[WASM_MAX_CALL_VALUES];
+        for (int i = 0; !result && i < argc; i++) {
+            if (!parse_value(argv[i], m3_GetArgType(f, i), &args[i])) {
+                result = "invalid argument";
+            }
+        }
+        if (!result) {
+            result = call_function(module_id, f, args, argc, results, result_count);
+        }
+    }
+
+    xSemaphoreGiveRecursive(instance_mutex());
+    return result;
+}
+
+void print_wasm_value(const WasmValue& value)
+{
+    switch (value.type) {
+        case c_m3Type_i32: Console.printf("%ld:i32", (long)value.i32); break;
+        case c_m3Type_i64: Console.printf("%lld:i64", (long long)value.i64); break;
+        case c_m3Type_f32: Console.printf("%g:f32", value.f32); break;
+        case c_m3Type_f64: Console.printf("%g:f64", value.f64); break;
+        default: Console.print("?"); break;
+    }
+}
+
+void release_module_instance(int module_id)
+{
+    WasmModule* mod = get_module(module_id);
+    if (mod == nullptr) return;
+
+    xSemaphoreTakeRecursive(instance_mutex(), portMAX_DELAY);
+    WasmInstance* instance = mod->instance;
+    if (instance != nullptr) {
+        free_instance(instance);
+        delete instance;
+        mod->instance = nullptr;
+    }
+    xSemaphoreGiveRecursive(instance_mutex());
 }
@@ -1,3 +1,75 @@
 #pragma once
+#include <wasm3.h>
+
+struct ModuleInfo;
+
+// Every task that runs module code needs the module task's stack, and
+// the same priority as the console so a busy module is time-sliced with
+// it instead of starving it
+#define NATIVE_STACK_SIZE   (32*1024)
+#define WASM_TASK_PRIORITY  1
+
 void start_module(int module_id);
+
+// Parses bytecode without running it: lists imports and exports, reads
+// the memory requirements and checks every import against the host
+// bindings. Done once per new image, so a module that could not start
+// is refused when it arrives instead of when it is started.
+M3Result inspect_module(const uint8_t* bytecode, size_t size, ModuleInfo* info);
+// Stops the module at its next host call, waiting up to a second before
+// deleting a task that never makes one
 void stop_current_module();
+
+// Exported-function calls outside of `_start` (see call_module_function).
+// Each module gets one cached runtime, created on first use and shared by
+// the scheduler and serial calls.
+void release_module_instance(int module_id);
+
+// Hot reload: downloads and loads the new version in the background while
+// the old one keeps running, then switches over the next time the module
+// makes a host call. The switch restarts the new version's `_start` from
+// the top: globals (the C stack pointer among them), tables and the wasm
+// call stack start fresh. `keep_memory` copies linear memory across, and
+// only when both versions have the same memory size; a module that wants
+// to survive a swap keeps its state there and must tell a warm start
+// (state already in memory) from a cold one in `_start`.
+void hot_reload_module(int module_id, bool keep_memory);
+bool hot_reload_active();
+
+// Held while no cached runtime may be created, used or released, e.g.
+// while module images move in memory
+void lock_module_runtimes();
+void unlock_module_runtimes();
+
+// Host calls are the safe points where module code holds no host locks.
+// Called from every binding: sleeps off a CPU quota penalty, then returns
+// the trap the module task should raise, if any: `wasm_trap_stop` to
+// stop it, `wasm_trap_hot_swap` so the runner can switch versions.
+M3Result module_safe_point();
+extern M3Result const wasm_trap_hot_swap;
+extern M3Result const wasm_trap_stop;
+// delay() for bindings; a stop request cuts it short on the module task
+void module_sleep(uint32_t ms);
+
+// Typed calls into any export. Function handles are cached per module
+// runtime, so repeated calls cost only the interpreter call itself.
+#define WASM_MAX_CALL_VALUES 8
+
+struct WasmValue {
+    M3ValueType type;
+    union {
+        int32_t i32;
+        int64_t i64;
+        float f32;
+        double f64;
+    };
+};
+
+M3Result call_module_function(int module_id, const char* function,
+                              const WasmValue* args, int argc,
+                              WasmValue* results, int* result_count);
+// Same, parsing each argument string according to the function signature
+M3Result call_module_function_argv(int module_id, const char* function,
+                                   int argc, const char* argv[],
+                                   WasmValue* results, int* result_count);
+void print_wasm_value(const WasmValue& value);
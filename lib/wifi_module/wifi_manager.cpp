@@ -1,4 +1,5 @@
 #include "wifi_manager.h"
+#include "link_frame.h"
 #include "modules.h"
 #include <WiFiClient.h>
 #include <time.h>
@@ -24,6 +25,20 @@ const unsigned long WIFI_CHECK_INTERVAL = 10000;  // Check WiFi every 10 seconds
 int wifi_reconnect_attempts = 0;
 const int MAX_RECONNECT_ATTEMPTS = 3;
 
+#define WIFI_TASK_STACK     (4 * 1024)
+#define WIFI_TASK_PRIORITY  1
+#define WIFI_TASK_CORE      0       // With the WiFi stack
+#define WIFI_UI_REFRESH_MS  1000
+
+// Notification bits for the WiFi task
+enum {
+    WIFI_EVENT_LINK = 1 << 0,           // Got an address or dropped
+    WIFI_REQUEST_CONNECT = 1 << 1,
+    WIFI_REQUEST_DISCONNECT = 1 << 2,
+};
+
+static TaskHandle_t wifi_task_handle = NULL;
+
 static lv_obj_t* screen_wifi;
 
 lv_obj_t* label_status;
@@ -55,15 +70,11 @@ lv_obj_t* create_label(lv_obj_t* parent, lv_align_t align, lv_coord_t x_ofs, lv_
 void reconnect_event_cb(lv_event_t* e);
 void disconnect_event_cb(lv_event_t* e);
 void reconnect_event_cb(lv_event_t* e) {
-    wifi_enabled = true;
-    wifi_reconnect_attempts = 0;
-    connect_wifi();
-    update_wifi_status_ui();
+    request_wifi_connect();
 }
 
 void disconnect_event_cb(lv_event_t* e) {
-    disconnect_wifi();
-    update_wifi_status_ui();
+    request_wifi_disconnect();
 }
 
 lv_obj_t* create_label(lv_obj_t* parent, lv_align_t align, lv_coord_t x_ofs, lv_coord_t y_ofs) {
@@ -109,6 +120,11 @@ void create_wifi_screen() {
     lv_obj_t* lbl_back = lv_label_create(btn_back);
     lv_label_set_text(lbl_back, "🔙 Back");
 
+    // The WiFi task changes the state, so the screen follows it by polling
+    lv_timer_create([](lv_timer_t* timer) {
+        if (lv_scr_act() == screen_wifi) update_wifi_status_ui();
+    }, WIFI_UI_REFRESH_MS, NULL);
+
     update_wifi_status_ui();
 }
 
@@ -126,10 +142,10 @@ void show_wifi_info(bool toSerial, bool toUI) {
     String mac    = WiFi.macAddress();
 
     if (toSerial) {
-        Serial.printf("📍 IP Address: %s\n", ip.c_str());
-        Serial.printf("📶 Signal Strength: %s dBm\n", rssi.c_str());
-        Serial.printf("🌐 Gateway: %s\n", gate.c_str());
-        Serial.printf("🎭 MAC Address: %s\n", mac.c_str());
+        Console.printf("📍 IP Address: %s\n", ip.c_str());
+        Console.printf("📶 Signal Strength: %s dBm\n", rssi.c_str());
+        Console.printf("🌐 Gateway: %s\n", gate.c_str());
+        Console.printf("🎭 MAC Address: %s\n", mac.c_str());
     }
 
     if (toUI) {
@@ -172,20 +188,72 @@ void show_wifi_screen() {
     lv_scr_load(screen_wifi);
 }
 
+static void on_wifi_event(arduino_event_id_t event) {
+    xTaskNotify(wifi_task_handle, WIFI_EVENT_LINK, eSetBits);
+}
+
+// Connects, then sleeps while connected or disabled. After a drop the
+// driver's own auto-reconnect gets WIFI_CHECK_INTERVAL before
+// check_wifi_status() steps in. Connecting blocks for seconds, which is
+// why it happens here rather than on the console or UI task.
+static void wifi_task(void* param) {
+    connect_wifi();
+    last_wifi_check = millis();
+    bool was_connected = WiFi.status() == WL_CONNECTED;
+
+    for (;;) {
+        TickType_t wait = portMAX_DELAY;
+        if (wifi_enabled && WiFi.status() != WL_CONNECTED) {
+            uint32_t since = millis() - last_wifi_check;
+            wait = pdMS_TO_TICKS(since < WIFI_CHECK_INTERVAL ? WIFI_CHECK_INTERVAL - since : 0);
+        }
+        uint32_t events = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &events, wait);
+
+        if (was_connected && WiFi.status() != WL_CONNECTED) last_wifi_check = millis();
+
+        if (events & WIFI_REQUEST_DISCONNECT) {
+            disconnect_wifi();
+        }
+        if (events & WIFI_REQUEST_CONNECT) {
+            wifi_enabled = true;
+            wifi_reconnect_attempts = 0;
+            connect_wifi();
+            last_wifi_check = millis();
+        } else if (wifi_enabled && millis() - last_wifi_check >= WIFI_CHECK_INTERVAL) {
+            check_wifi_status();
+            last_wifi_check = millis();
+        }
+        was_connected = WiFi.status() == WL_CONNECTED;
+    }
+}
+
 void setup_wifi() {
-    if (!wifi_enabled) return;
+    if (wifi_task_handle != NULL) return;
 
-    Serial.println("\n📡 Initializing WiFi...");
+    Console.println("\n📡 Initializing WiFi...");
     WiFi.mode(WIFI_STA);
     WiFi.setAutoReconnect(true);
     WiFi.persistent(true);
 
-    connect_wifi();
+    xTaskCreatePinnedToCore(&wifi_task, "wifi", WIFI_TASK_STACK, NULL, WIFI_TASK_PRIORITY,
+                            &wifi_task_handle, WIFI_TASK_CORE);
+    WiFi.onEvent(on_wifi_event, ARDUINO_EVENT_WIFI_STA_GOT_IP);
+    WiFi.onEvent(on_wifi_event, ARDUINO_EVENT_WIFI_STA_DISCONNECTED);
+}
+
+// The UI is up before setup_wifi(), and its buttons can get here first
+void request_wifi_connect() {
+    if (wifi_task_handle == NULL) return;   // The task connects when it starts
+    xTaskNotify(wifi_task_handle, WIFI_REQUEST_CONNECT, eSetBits);
+}
 
-    // ✅ If WiFi screen is already created, sync UI
-    if (screen_wifi) {
-        update_wifi_status_ui();
+void request_wifi_disconnect() {
+    if (wifi_task_handle == NULL) {
+        Console.println("⚠️  WiFi is not started yet");
+        return;
     }
+    xTaskNotify(wifi_task_handle, WIFI_REQUEST_DISCONNECT, eSetBits);
 }
 
 
@@ -194,7 +262,7 @@ bool wait_until(std::function<bool()> condition, int max_attempts, int delay_ms
     for (int i = 0; i < max_attempts; ++i) {
         if (condition()) return true;
         delay(delay_ms);
-        Serial.print(".");
+        Console.print(".");
     }
     return false;
 }
@@ -204,7 +272,7 @@ bool wait_until(std::function<bool()> condition, int max_attempts, int delay_ms
 void connect_wifi() {
     if (!wifi_enabled) return;
     
-    Serial.printf("🔌 Connecting to WiFi network: %s", WIFI_SSID);
+    Console.printf("🔌 Connecting to WiFi network: %s", WIFI_SSID);
     WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
     
     int attempts = 0;
@@ -213,7 +281,7 @@ void connect_wifi() {
     }, 20, 500);
     
     if (WiFi.status() == WL_CONNECTED) {
-        Serial.println(" ✅ Connected!");
+        Console.println(" ✅ Connected!");
         show_wifi_info(true, false);
         
         // Setup time synchronization
@@ -221,18 +289,18 @@ void connect_wifi() {
         
         wifi_reconnect_attempts = 0;
     } else {
-        Serial.println(" ❌ Failed!");
-        Serial.printf("❌ WiFi Status: %d\n", WiFi.status());
+        Console.println(" ❌ Failed!");
+        Console.printf("❌ WiFi Status: %d\n", WiFi.status());
         wifi_reconnect_attempts++;
     }
 }
 
 void disconnect_wifi() {
     if (WiFi.status() == WL_CONNECTED) {
-        Serial.println("📡 Disconnecting from WiFi...");
+        Console.println("📡 Disconnecting from WiFi...");
         WiFi.disconnect();
         delay(1000);
-        Serial.println("✅ WiFi disconnected");
+        Console.println("✅ WiFi disconnected");
     }
     wifi_enabled = false;
 }
@@ -241,56 +309,56 @@ void check_wifi_status() {
     if (!wifi_enabled) return;
     
     if (WiFi.status() != WL_CONNECTED) {
-        Serial.printf("⚠️  WiFi disconnected (Status: %d)\n", WiFi.status());
+        Console.printf("⚠️  WiFi disconnected (Status: %d)\n", WiFi.status());
         
         if (wifi_reconnect_attempts < MAX_RECONNECT_ATTEMPTS) {
-            Serial.println("🔄 Attempting to reconnect...");
+            Console.println("🔄 Attempting to reconnect...");
             connect_wifi();
         } else {
-            Serial.println("❌ Max reconnection attempts reached. WiFi disabled.");
-            Serial.println("💡 Use 'w' command to manually reconnect.");
+            Console.println("❌ Max reconnection attempts reached. WiFi disabled.");
+            Console.println("💡 Use 'w' command to manually reconnect.");
             wifi_enabled = false;
         }
     }
 }
 
 void show_wifi_status() {
-    Serial.println("\n📡 WiFi Status Information");
-    Serial.println("==========================");
+    Console.println("\n📡 WiFi Status Information");
+    Console.println("==========================");
     
     if (!wifi_enabled) {
-        Serial.println("Status: ❌ WiFi Disabled");
+        Console.println("Status: ❌ WiFi Disabled");
         return;
     }
     
-    Serial.printf("Status: %s\n", (WiFi.status() == WL_CONNECTED) ? "✅ Connected" : "❌ Disconnected");
+    Console.printf("Status: %s\n", (WiFi.status() == WL_CONNECTED) ? "✅ Connected" : "❌ Disconnected");
     
     if (WiFi.status() == WL_CONNECTED) {
-        Serial.printf("SSID: %s\n", WiFi.SSID().c_str());
-        Serial.printf("IP Address: %s\n", WiFi.localIP().toString().c_str());
-        Serial.printf("Gateway: %s\n", WiFi.gatewayIP().toString().c_str());
-        Serial.printf("Subnet Mask: %s\n", WiFi.subnetMask().toString().c_str());
-        Serial.printf("DNS 1: %s\n", WiFi.dnsIP(0).toString().c_str());
-        Serial.printf("DNS 2: %s\n", WiFi.dnsIP(1).toString().c_str());
-        Serial.printf("MAC Address: %s\n", WiFi.macAddress().c_str());
-        Serial.printf("Signal Strength: %d dBm\n", WiFi.RSSI());
-        Serial.printf("Channel: %d\n", WiFi.channel());
+        Console.printf("SSID: %s\n", WiFi.SSID().c_str());
+        Console.printf("IP Address: %s\n", WiFi.localIP().toString().c_str());
+        Console.printf("Gateway: %s\n", WiFi.gatewayIP().toString().c_str());
+        Console.printf("Subnet Mask: %s\n", WiFi.subnetMask().toString().c_str());
+        Console.printf("DNS 1: %s\n", WiFi.dnsIP(0).toString().c_str());
+        Console.printf("DNS 2: %s\n", WiFi.dnsIP(1).toString().c_str());
+        Console.printf("MAC Address: %s\n", WiFi.macAddress().c_str());
+        Console.printf("Signal Strength: %d dBm\n", WiFi.RSSI());
+        Console.printf("Channel: %d\n", WiFi.channel());
         
         // Show time if available
         time_t now;
         time(&now);
         if (now > 1000000000) {  // Valid timestamp
-            Serial.printf("Current Time: %s", ctime(&now));
+            Console.printf("Current Time: %s", ctime(&now));
         }
     } else {
-        Serial.printf("Reconnect Attempts: %d/%d\n", wifi_reconnect_attempts, MAX_RECONNECT_ATTEMPTS);
+        Console.printf("Reconnect Attempts: %d/%d\n", wifi_reconnect_attempts, MAX_RECONNECT_ATTEMPTS);
     }
 }
 
 void setup_time() {
     if (WiFi.status() != WL_CONNECTED) return;
     
-    Serial.println("🕒 Synchronizing time with NTP server...");
+    Console.println("🕒 Synchronizing time with NTP server...");
     configTime(GMT_OFFSET_SEC, DAYLIGHT_OFFSET_SEC, NTP_SERVER);
     
     // Wait for time synchronization
@@ -301,12 +369,12 @@ void setup_time() {
 
     
     if (time(nullptr) > 1000000000) {
-        Serial.println(" ✅ Time synchronized!");
+        Console.println(" ✅ Time synchronized!");
         time_t now;
         time(&now);
-        Serial.printf("📅 Current time: %s", ctime(&now));
+        Console.printf("📅 Current time: %s", ctime(&now));
     } else {
-        Serial.println(" ❌ Time synchronization failed");
+        Console.println(" ❌ Time synchronization failed");
     }
 }
 
@@ -318,20 +386,18 @@ bool handle_wifi_command(char cmd) {
             return true;
             
         case 'c': case 'C':
-            wifi_enabled = true;
-            wifi_reconnect_attempts = 0;
-            connect_wifi();
+            request_wifi_connect();
             return true;
             
         case 'd': case 'D':
-            disconnect_wifi();
+            request_wifi_disconnect();
             return true;
             
         case 't': case 'T':
             if (WiFi.status() == WL_CONNECTED) {
                 setup_time();
             } else {
-                Serial.println("❌ WiFi not connected. Connect first with 'c' command.");
+                Console.println("❌ WiFi not connected. Connect first with 'c' command.");
             }
             return true;
         
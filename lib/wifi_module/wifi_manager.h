@@ -21,7 +21,11 @@ extern int wifi_reconnect_attempts;
 extern const int MAX_RECONNECT_ATTEMPTS;
 
 // WiFi Management Functions
+// Starts the WiFi task, which connects in the background, reconnects
+// after drops and carries out the requests below
 void setup_wifi();
+void request_wifi_connect();
+void request_wifi_disconnect();
 void check_wifi_status();
 void connect_wifi();
 void disconnect_wifi();
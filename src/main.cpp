@@ -4,11 +4,25 @@
 #include "wasm_runner.h"
 #include "wifi_manager.h"
 #include <wasm3.h>
-#include <Preferences.h>
 #include <Wire.h>
 #include <CST816S.h>
 #include <lvgl.h>
 #include "ui_lvgl.h"
+#include "scheduler.h"
+#include "module_cache.h"
+#include "cpu_quota.h"
+#include "console_args.h"
+#include "download_manager.h"
+#include "tls_client.h"
+#include "manifest.h"
+#include "module_memory.h"
+#include "module_arena.h"
+#include "module_store.h"
+#include "autostart.h"
+#include "upload_server.h"
+#include "serial_link.h"
+#include "console.h"
+#include <memory>
 
 
 extern TFT_eSPI tft;
@@ -20,286 +34,392 @@ extern TFT_eSPI tft;
 
 CST816S touch(TOUCH_SDA, TOUCH_SCL, TOUCH_RST, TOUCH_IRQ);
 
+#define CONSOLE_TASK_STACK     (8 * 1024)   // What loop() had
+#define CONSOLE_TASK_PRIORITY  1
+#define CONSOLE_TASK_CORE      1
+#define CONSOLE_POLL_MS        20           // While the upload server listens
+#define CONSOLE_IDLE_MS        1000
+#define FUNCTION_CALL_WAIT_MS  5000         // Before 'f' gives the console back
+
+static TaskHandle_t console_task_handle = NULL;
+
 // TFT setup
 TFT_eSPI tft = TFT_eSPI();
 
 extern int current_module;
-Preferences preferences;
 
 void show_menu();
 void handle_serial_input();
-void handle_module_management();
-void save_module_list();
-void load_module_list();
-String get_user_input(const char* prompt);
+void run_console_command(String input);
+void handle_module_management(String args);
+void handle_function_call(String args);
+
+static void console_task(void* param);
 
 void setup() {
+    Serial.setRxBufferSize(SERIAL_LINK_RX_BUFFER);   // Before begin()
     Serial.begin(115200);
-    delay(1000);
-    while (!Serial) {}
+    // No wait for a serial monitor: autostart modules must be up within
+    // a second of power-up
 
     // === TFT UI INIT ===
     touch.begin();
     tft.init();
     tft.setRotation(0); 
     ui_init();
+    ui_start_task(TOUCH_IRQ);
     // === Serial Menu Init ===
-    Serial.println("\n🎉 ESP32 WASM3 Dynamic Module Loader");
-    Serial.println("=====================================");
-    Serial.println(
+    Console.println("\n🎉 ESP32 WASM3 Dynamic Module Loader");
+    Console.println("=====================================");
+    Console.println(
         String("Wasm3 v") + M3_VERSION + " (" + M3_ARCH + "), build " + __DATE__ + " " + __TIME__
     );
 
-    preferences.begin("wasm-loader", false);
     init_modules();
+    arena_init();   // Before any bytecode is loaded, so images land in it
+    init_cpu_quota();
     load_module_list();
+    // Bytecode from flash, so modules can run before WiFi is up
+    if (init_module_cache()) {
+        // Boot modules first, the rest load while they already run
+        autostart_modules();
+        load_cached_modules();
+    }
+    init_tls_client();
+    init_scheduler();
+    init_download_manager();
+    init_module_memory();
     setup_wifi();
 
+    console_begin(run_console_command);
     show_menu();
+    xTaskCreatePinnedToCore(&console_task, "console", CONSOLE_TASK_STACK, NULL, CONSOLE_TASK_PRIORITY,
+                            &console_task_handle, CONSOLE_TASK_CORE);
+    Serial.onReceive([]() { xTaskNotifyGive(console_task_handle); });
 }
 
 void loop() {
-    handle_serial_input();
-    lv_timer_handler();
+    // The UI, console and WiFi tasks do the work
+    vTaskDelete(NULL);
+}
 
-    if (wifi_enabled && (millis() - last_wifi_check > WIFI_CHECK_INTERVAL)) {
-        check_wifi_status();
-        last_wifi_check = millis();
+// Commands, serial link frames and uploads run here. Download workers,
+// the manifest sync and hot reloads edit the module list too, through
+// modules.h under its registry lock. Woken by UART input; the upload
+// server has no event to wait on and is polled while it listens.
+static void console_task(void* param) {
+    for (;;) {
+        handle_serial_input();
+        service_module_memory();
+        service_manifest_sync();
+        bool listening = service_upload_server();
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(listening ? CONSOLE_POLL_MS : CONSOLE_IDLE_MS));
     }
-
-    delay(100);
 }
 
 void show_menu() {
-    Serial.println("\n🔧 WASM Dynamic Module Loader");
-    Serial.println("=============================");
+    Console.println("\n🔧 WASM Dynamic Module Loader");
+    Console.println("=============================");
     
     // List modules
     list_modules();
     
     // Module Commands
-    Serial.println("\n📦 Module Commands:");
-    Serial.println("  1-9. Run module (if loaded)");
-    Serial.println("  l.   Load/Download module");
-    Serial.println("  a.   Add new module URL");
-    Serial.println("  x.   Remove module");
-    Serial.println("  s.   Stop current module");
-    Serial.println("  z.   Clear all modules");
+    Console.println("\n📦 Module Commands:");
+    Console.println("  1-9. Run module (if loaded)");
+    Console.println("  l.   Load/Download module (runs in background, l all | l update for batches)");
+    Console.println("  p.   Downloads (p cancel <job|all> | p workers <n>)");
+    Console.println("  k.   TLS session cache and handshake times (k clear to reset)");
+    Console.println("  a.   Add new module URL");
+    Console.println("  u.   Sync modules from a manifest (u [url] [prune])");
+    Console.println("  x.   Remove module (x <n>)");
+    Console.println("  f.   Call exported function (f <n> <func> [args...])");
+    Console.println("  h.   Hot reload module (h <n> [keep] to carry memory)");
+    Console.println("  s.   Stop current module");
+    Console.println("  z.   Clear all modules");
+    Console.println("  q.   CPU usage and quotas (q <n> <percent> to set)");
+    Console.println("  e.   Schedules (e every <n> <func> <ms> | e at <n> <func> <HH:MM> | e del <id>)");
+    Console.println("  b.   Autostart at boot (b <n> [position] [core0|core1|any] | b <n> off)");
     
     // System Commands
-    Serial.println("\n⚡ System Commands:");
-    Serial.println("  m.   Show this menu");
-    Serial.println("  r.   Restart ESP32");
-    Serial.println("  i.   Show system information");
+    Console.println("\n⚡ System Commands:");
+    Console.println("  m.   Show this menu");
+    Console.println("  r.   Restart ESP32");
+    Console.println("  i.   Show system information");
+    Console.println("  g.   Memory and fragmentation (g compact to defragment)");
     
     // WiFi Commands
-    Serial.println("\n📡 WiFi Commands:");
-    Serial.println("  w.   Show WiFi status");
-    Serial.println("  c.   Connect/Reconnect WiFi");
-    Serial.println("  d.   Disconnect WiFi");
+    Console.println("\n📡 WiFi Commands:");
+    Console.println("  w.   Show WiFi status");
+    Console.println("  c.   Connect/Reconnect WiFi");
+    Console.println("  d.   Disconnect WiFi");
     
     // Status indicators
-    Serial.printf("\n📊 Status: WASM[%s] WiFi[%s]\n", 
-                  (current_module >= 0 && !modules[current_module].name.isEmpty()) 
-                    ? modules[current_module].name.c_str() : "None",
-                  (WiFi.status() == WL_CONNECTED) ? "Connected" : "Disconnected");
+    Console.printf("\n📊 Status: WASM[%s] WiFi[%s]\n", 
+                   get_module(current_module) != nullptr ? module_name(current_module) : "None",
+                   (WiFi.status() == WL_CONNECTED) ? "Connected" : "Disconnected");
     
-    Serial.print("\nSelect option: ");
+    Console.print("\nSelect option: ");
+}
+
+void handle_serial_input() {
+    // Frames from a host client (tools/serial_link.py) take over the input
+    if (serial_link_service(run_console_command)) return;
+
+    console_poll();
+    // It stops where a frame starts; no more input may come to wake us
+    if (Serial.available()) serial_link_service(run_console_command);
 }
 
-// New function to safely get user input without interference
-String get_user_input(const char* prompt) {
-    // Clear any pending serial data
-    while (Serial.available()) {
-        Serial.read();
+// Runs `then` with `value`, asking for it first when it's missing
+static void with_argument(const String& value, const char* prompt, ConsoleLineFn then) {
+    if (value.isEmpty()) {
+        console_prompt(prompt, then);
+    } else {
+        then(value);
     }
+}
+
+void run_console_command(String input) {
+    input.trim();
+    if (input.length() == 0) return;
+
+    char cmd = input.charAt(0);
     
-    // Show prompt
-    Serial.print(prompt);
-    
-    String input = "";
-    bool done = false;
-    
-    while (!done) {
-        if (Serial.available()) {
-            char c = Serial.read();
-            
-            if (c == '\n' || c == '\r') {
-                // Enter pressed
-                done = true;
-                Serial.println();  // New line after input
-            } else if (c == 8 || c == 127) {
-                // Backspace
-                if (input.length() > 0) {
-                    input.remove(input.length() - 1);
-                    Serial.print("\b \b");  // Erase character on terminal
-                }
-            } else if (c >= 32 && c <= 126) {
-                // Printable character
-                input += c;
-                Serial.print(c);  // Echo character
-            }
-        }
-        delay(10);
+    // Try to handle WiFi commands first
+    if (handle_wifi_command(cmd)) {
+        return;
     }
     
-    input.trim();
-    return input;
-}
+    // Handle module and system commands
+    switch (cmd) {
+        case '1': case '2': case '3': case '4': case '5':
+        case '6': case '7': case '8': case '9':
+            // Module ids can run past 9: "12" starts module 12
+            start_module(input.toInt());
+            break;
+            
+        case 'l': case 'L':
+            handle_module_management(input.substring(1));
+            break;
 
-void handle_serial_input() {
-    if (Serial.available()) {
-        String input = Serial.readStringUntil('\n');
-        input.trim();
-        if (input.length() == 0) return;
-
-        char cmd = input.charAt(0);
-        
-        // Try to handle WiFi commands first
-        if (handle_wifi_command(cmd)) {
-            return;
+        case 'p': case 'P':
+            handle_download_command(input.substring(1));
+            break;
+
+        case 'u': case 'U':
+            handle_manifest_command(input.substring(1));
+            break;
+
+        case 'k': case 'K': {
+            String args = input.substring(1);
+            if (take_token(args) == "clear") {
+                clear_tls_sessions();
+            } else {
+                print_tls_stats();
+            }
+            break;
         }
-        
-        // Handle module and system commands
-        switch (cmd) {
-            case '1': case '2': case '3': case '4': case '5':
-            case '6': case '7': case '8': case '9':
-                start_module(cmd - '1');
-                break;
-                
-            case 'l': case 'L':
-                handle_module_management();
-                break;
-                
-            case 'a': case 'A': {
-                Serial.println("\n📝 Add New Module");
-                
-                // Use the new safe input function
-                String name = get_user_input("Enter module name: ");
+            
+        case 'a': case 'A':
+            Console.println("\n📝 Add New Module");
+            console_prompt("Enter module name: ", [](String name) {
                 if (name.isEmpty()) {
-                    Serial.println("❌ Module name cannot be empty");
-                    show_menu();
-                    break;
-                }
-                
-                String url = get_user_input("Enter module URL: ");
-                if (url.isEmpty()) {
-                    Serial.println("❌ Module URL cannot be empty");
+                    Console.println("❌ Module name cannot be empty");
                     show_menu();
-                    break;
-                }
-                
-                if (add_module(name, url)) {
-                    save_module_list();
-                    Serial.println("✅ Module added successfully!");
+                    return;
                 }
-                delay(1000);
-                show_menu();
-                break;
-            }
-                
-            case 'x': case 'X': {
-                String num = get_user_input("\nEnter module number to remove: ");
-                int index = num.toInt() - 1;
-                if (remove_module(index)) {
+                console_prompt("Enter module URL: ", [name](String url) {
+                    if (url.isEmpty()) {
+                        Console.println("❌ Module URL cannot be empty");
+                        show_menu();
+                        return;
+                    }
+                    console_prompt("Enter expected SHA-256 (blank to skip): ", [name, url](String sha256) {
+                        if (!sha256.isEmpty() && !normalize_sha256_hex(&sha256)) {
+                            Console.println("❌ SHA-256 must be 64 hex digits");
+                        } else {
+                            int id = add_module(name, url);
+                            if (id >= 0) {
+                                set_module_source(id, url, sha256, "");
+                                save_module_list();
+                                Console.println("✅ Module added successfully!");
+                            }
+                        }
+                        show_menu();
+                    });
+                });
+            });
+            break;
+            
+        case 'x': case 'X': {
+            String args = input.substring(1);
+            with_argument(take_token(args), "\nEnter module number to remove: ", [](String num) {
+                if (remove_module(num.toInt())) {
                     save_module_list();
-                    Serial.println("✅ Module removed successfully!");
+                    Console.println("✅ Module removed successfully!");
                 } else {
-                    Serial.println("❌ Failed to remove module");
+                    Console.println("❌ Failed to remove module");
                 }
-                delay(1000);
                 show_menu();
-                break;
+            });
+            break;
+        }
+            
+        case 'f': case 'F':
+            handle_function_call(input.substring(1));
+            break;
+
+        case 'h': case 'H': {
+            String args = input.substring(1);
+            String number = take_token(args);
+            bool keep = take_token(args) == "keep";
+            with_argument(number, "\nEnter module number to hot reload: ", [keep](String number) {
+                hot_reload_module(number.toInt(), keep);
+            });
+            break;
+        }
+
+        case 'q': case 'Q':
+            if (handle_quota_command(input.substring(1))) {
+                save_module_list();
             }
-                
-            case 's': case 'S':
-                stop_current_module();
-                show_menu();
-                break;
-                
-            case 'm': case 'M':
-                show_menu();
-                break;
-                
-            case 'r': case 'R':
-                Serial.println("🔄 Restarting ESP32...");
-                delay(1000);
-                ESP.restart();
-                break;
-
-            case 'z': case 'Z': { 
-                Serial.println("\n⚠️  Clear All Modules");
-                String confirm = get_user_input("Are you sure? Type 'yes' to confirm: ");
-                if (confirm == "yes") {
+            break;
+
+        case 'e': case 'E':
+            handle_schedule_command(input.substring(1));
+            break;
+
+        case 'b': case 'B':
+            if (handle_autostart_command(input.substring(1))) {
+                save_module_list();
+            }
+            break;
+
+        case 'g': case 'G':
+            handle_memory_command(input.substring(1));
+            break;
+
+        case 's': case 'S':
+            stop_current_module();
+            save_module_list();   // Run counters
+            show_menu();
+            break;
+            
+        case 'm': case 'M':
+            show_menu();
+            break;
+            
+        case 'r': case 'R':
+            Console.println("🔄 Restarting ESP32...");
+            delay(1000);
+            ESP.restart();
+            break;
+
+        case 'z': case 'Z':
+            Console.println("\n⚠️  Clear All Modules");
+            console_prompt("Are you sure? Type 'yes' to confirm: ", [](String confirm) {
+                size_t received, total;
+                int active;
+                if (confirm == "yes" && get_download_overview(&received, &total, &active)) {
+                    Console.println("❌ Downloads in progress. Cancel them first with 'p cancel all'.");
+                } else if (confirm == "yes" && manifest_sync_active()) {
+                    Console.println("❌ A manifest sync is running, try again");
+                } else if (confirm == "yes" && (hot_reload_active() || !pause_module_memory())) {
+                    Console.println("❌ A hot reload or memory pass is running, try again");
+                } else if (confirm == "yes") {
                     // Clear all modules
-                    init_modules();  // This clears the array
+                    if (current_module >= 0) stop_current_module();
+                    cleanup_modules();   // Free bytecode and cached runtimes
+                    init_modules();  // This empties the registry
+                    resume_module_memory();
                     save_module_list();  // Save empty list
-                    Serial.println("✅ All modules cleared!");
+                    Console.println("✅ All modules cleared!");
                 } else {
-                    Serial.println("❌ Cancelled");
+                    Console.println("❌ Cancelled");
                 }
-                delay(1000);
                 show_menu();
-                break;
-            }
-                            
-            default:
-                Serial.printf("❌ Unknown command '%c'\n", cmd);
-                show_menu();
-                break;
-        }
+            });
+            break;
+                        
+        default:
+            Console.printf("❌ Unknown command '%c'\n", cmd);
+            show_menu();
+            break;
     }
 }
 
-void handle_module_management() {
-    String input = get_user_input("\nEnter module number to download: ");
-    int index = input.toInt() - 1;
-    
-    if (index >= 0 && index < MAX_MODULES && !modules[index].name.isEmpty()) {
-        Serial.println("\n📥 Starting download...");
-        if (download_module(index)) {
-            Serial.println("✅ Module downloaded successfully!");
+// An exported-function call handed to the scheduler task; shared with
+// it so the console can stop waiting before the call returns
+struct FunctionCall {
+    int module_id = -1;
+    String function;
+    String args[WASM_MAX_CALL_VALUES];
+    int argc = 0;
+    SemaphoreHandle_t done = xSemaphoreCreateBinary();
+
+    ~FunctionCall() { vSemaphoreDelete(done); }
+
+    void run() {
+        const char* argv[WASM_MAX_CALL_VALUES];
+        for (int i = 0; i < argc; i++) argv[i] = args[i].c_str();
+
+        WasmValue results[WASM_MAX_CALL_VALUES];
+        int result_count = 0;
+        uint32_t start = micros();
+        M3Result result = call_module_function_argv(module_id, function.c_str(), argc, argv,
+                                                    results, &result_count);
+        uint32_t elapsed = micros() - start;
+
+        if (result) {
+            Console.printf("❌ Call failed: %s\n", result);
         } else {
-            Serial.println("❌ Failed to download module");
+            Console.print("↩️  ");
+            for (int i = 0; i < result_count; i++) {
+                if (i > 0) Console.print(", ");
+                print_wasm_value(results[i]);
+            }
+            Console.printf("%s(%lu us)\n", result_count > 0 ? " " : "", (unsigned long)elapsed);
         }
-    } else {
-        Serial.println("❌ Invalid module number");
+        xSemaphoreGive(done);
+    }
+};
+
+void handle_function_call(String args) {
+    std::shared_ptr<FunctionCall> call = std::make_shared<FunctionCall>();
+    call->module_id = take_token(args).toInt();
+    call->function = take_token(args);
+    if (call->function.isEmpty()) {
+        Console.println("❌ Usage: f <n> <func> [args...]");
+        return;
     }
-    
-    delay(2000);
-    show_menu();
-}
 
-void save_module_list() {
-    // Save module list to preferences
-    preferences.clear();
-    int saved = 0;
-    for (int i = 0; i < MAX_MODULES; i++) {
-        if (!modules[i].name.isEmpty()) {
-            String key = "mod" + String(saved);
-            String value = modules[i].name + "|" + modules[i].url;
-            preferences.putString(key.c_str(), value);
-            saved++;
+    while (!args.isEmpty()) {
+        if (call->argc == WASM_MAX_CALL_VALUES) {
+            Console.printf("❌ Too many arguments (at most %d)\n", WASM_MAX_CALL_VALUES);
+            return;
         }
+        call->args[call->argc++] = take_token(args);
+    }
+
+    // Not on this task: module code needs a module-sized stack, and there
+    // it is metered like the module itself
+    if (!run_on_scheduler([call]() { call->run(); })) {
+        Console.println("❌ Too many calls queued, try again");
+        return;
+    }
+    if (xSemaphoreTake(call->done, pdMS_TO_TICKS(FUNCTION_CALL_WAIT_MS)) != pdTRUE) {
+        Console.println("⏳ Still running, the result follows when it returns");
     }
-    preferences.putInt("count", saved);
-    Serial.printf("💾 Saved %d modules to preferences\n", saved);
 }
 
-void load_module_list() {
-    int count = preferences.getInt("count", 0);
-    Serial.printf("📂 Loading %d saved modules\n", count);
-    
-    for (int i = 0; i < count; i++) {
-        String key = "mod" + String(i);
-        String value = preferences.getString(key.c_str(), "");
-        if (!value.isEmpty()) {
-            int sep = value.indexOf('|');
-            if (sep > 0) {
-                String name = value.substring(0, sep);
-                String url = value.substring(sep + 1);
-                add_module(name, url);
-            }
+void handle_module_management(String args) {
+    // Returns straight away, progress shows up on serial and the display
+    with_argument(take_token(args), "\nEnter module number to download: ", [](String input) {
+        if (input == "all" || input == "update") {
+            queue_download_all(input == "update");
+        } else {
+            queue_download(input.toInt());
         }
-    }
-}
\ No newline at end of file
+    });
+}
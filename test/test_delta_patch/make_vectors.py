@@ -0,0 +1,74 @@
+#!/usr/bin/env python3
+"""Regenerates vectors.h: two versions of a module-like image and the
+patch tools/wasm_delta.py makes between them, also gzipped.
+
+    python3 test/test_delta_patch/make_vectors.py
+"""
+
+import gzip
+import io
+import os
+import subprocess
+import sys
+import tempfile
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+TOOL = os.path.join(HERE, "..", "..", "tools", "wasm_delta.py")
+
+
+def old_image():
+    # Code-like: a few hundred distinct "functions" of varying bytes
+    x = 2463534242
+    out = bytearray()
+    for _ in range(8000):
+        x ^= (x << 13) & 0xFFFFFFFF
+        x ^= x >> 17
+        x ^= (x << 5) & 0xFFFFFFFF
+        out.append(x & 0x3F if x & 0x100 else x & 0xFF)
+    return bytes(out)
+
+
+def new_image(old):
+    # Every op kind: unchanged runs (COPY), new bytes (INSERT) and a
+    # moved block with relocated operands (ADD)
+    moved = bytearray(old[5000:6500])
+    for k in range(0, len(moved), 24):
+        moved[k] = (moved[k] + 3) & 0xFF
+    return (old[:1200] + b"new function body " * 12 + old[1200:4000] +
+            bytes(moved) + old[4000:5000] + old[6500:7600] + b"\x0b" * 40)
+
+
+def c_array(name, data):
+    lines = ["static const uint8_t %s[%d] = {" % (name, len(data))]
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    old = old_image()
+    new = new_image(old)
+    with tempfile.TemporaryDirectory() as tmp:
+        paths = [os.path.join(tmp, name) for name in ("old.wasm", "new.wasm", "patch.wdp")]
+        open(paths[0], "wb").write(old)
+        open(paths[1], "wb").write(new)
+        subprocess.run([sys.executable, TOOL] + paths, check=True, stdout=subprocess.DEVNULL)
+        patch = open(paths[2], "rb").read()
+
+    buffer = io.BytesIO()
+    with gzip.GzipFile(mode="wb", fileobj=buffer, mtime=0) as f:
+        f.write(patch)
+
+    with open(os.path.join(HERE, "vectors.h"), "w") as f:
+        f.write("// Generated by make_vectors.py, do not edit\n#pragma once\n#include <stdint.h>\n\n")
+        f.write("\n\n".join([
+            c_array("old_image", old),
+            c_array("new_image", new),
+            c_array("patch", patch),
+            c_array("gzip_patch", buffer.getvalue()),
+        ]) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,129 @@
+// On-target round trip of tools/wasm_delta.py patches through DeltaPatcher:
+// fed in chunks of many sizes, and gzipped through PayloadDecoder's sink
+// the way delta_fetch() streams them. Regenerate vectors.h with
+// make_vectors.py after changing the patch format.
+// Run with: pio test -e esp32s3dev -f test_delta_patch
+#include <Arduino.h>
+#include <unity.h>
+#include <mbedtls/sha256.h>
+#include "delta_patch.h"
+#include "payload_decoder.h"
+#include "vectors.h"
+
+static const size_t chunk_sizes[] = { 1, 2, 3, 7, 13, 64, 100, 4096, SIZE_MAX };
+
+class PatcherSink : public Print {
+public:
+    explicit PatcherSink(DeltaPatcher* patcher) : _patcher(patcher) {}
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* data, size_t len) override {
+        return _patcher->write(data, len) ? len : 0;
+    }
+
+private:
+    DeltaPatcher* _patcher;
+};
+
+static bool apply(const uint8_t* base, const uint8_t* data, size_t len, size_t chunk, ByteBuffer* out) {
+    DeltaPatcher patcher(base, sizeof(old_image), out);
+    for (size_t pos = 0; pos < len;) {
+        size_t n = min(chunk, len - pos);
+        if (!patcher.write(data + pos, n)) return false;
+        pos += n;
+    }
+    return patcher.finish();
+}
+
+static void check_new_image(const ByteBuffer& out, const char* label) {
+    TEST_ASSERT_EQUAL_MESSAGE(sizeof(new_image), out.size, label);
+    TEST_ASSERT_EQUAL_MEMORY_MESSAGE(new_image, out.data, sizeof(new_image), label);
+}
+
+static void test_patch_chunked() {
+    uint8_t want_digest[SHA256_SIZE];
+    mbedtls_sha256_ret(new_image, sizeof(new_image), want_digest, 0);
+
+    for (size_t chunk : chunk_sizes) {
+        char label[24];
+        snprintf(label, sizeof(label), "chunk %u", (unsigned)min(chunk, sizeof(patch)));
+
+        ByteBuffer out = {};
+        DeltaPatcher patcher(old_image, sizeof(old_image), &out);
+        bool ok = true;
+        for (size_t pos = 0; ok && pos < sizeof(patch); pos += chunk) {
+            ok = patcher.write(patch + pos, min(chunk, sizeof(patch) - pos));
+        }
+        TEST_ASSERT_TRUE_MESSAGE(ok && patcher.finish(), label);
+        check_new_image(out, label);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(want_digest, patcher.new_sha256(), SHA256_SIZE, label);
+        byte_buffer_free(&out);
+    }
+}
+
+static void test_gzip_patch_streamed() {
+    for (size_t chunk : chunk_sizes) {
+        char label[24];
+        snprintf(label, sizeof(label), "chunk %u", (unsigned)min(chunk, sizeof(gzip_patch)));
+
+        ByteBuffer out = {};
+        ByteBuffer window = {};
+        DeltaPatcher patcher(old_image, sizeof(old_image), &out);
+        PatcherSink sink(&patcher);
+        PayloadDecoder decoder(&window, &sink);
+        bool ok = true;
+        for (size_t pos = 0; ok && pos < sizeof(gzip_patch); pos += chunk) {
+            ok = decoder.write(gzip_patch + pos, min(chunk, sizeof(gzip_patch) - pos));
+        }
+        TEST_ASSERT_TRUE_MESSAGE(ok && decoder.finish() && patcher.finish(), label);
+        TEST_ASSERT_EQUAL_MESSAGE(PAYLOAD_GZIP, decoder.format(), label);
+        check_new_image(out, label);
+        byte_buffer_free(&out);
+        byte_buffer_free(&window);
+    }
+}
+
+static void test_wrong_base_rejected() {
+    uint8_t* base = (uint8_t*)malloc(sizeof(old_image));
+    memcpy(base, old_image, sizeof(old_image));
+    base[sizeof(old_image) / 2] ^= 0x01;
+
+    ByteBuffer out = {};
+    TEST_ASSERT_FALSE(apply(base, patch, sizeof(patch), SIZE_MAX, &out));
+    byte_buffer_free(&out);
+    free(base);
+}
+
+static void test_truncated_patch_rejected() {
+    for (size_t cut : { (size_t)1, (size_t)17, sizeof(patch) - DELTA_HEADER_SIZE }) {
+        ByteBuffer out = {};
+        TEST_ASSERT_FALSE(apply(old_image, patch, sizeof(patch) - cut, 7, &out));
+        byte_buffer_free(&out);
+    }
+}
+
+static void test_corrupt_patch_rejected() {
+    // A flipped literal byte still parses, but the image hash won't match
+    uint8_t* copy = (uint8_t*)malloc(sizeof(patch));
+    memcpy(copy, patch, sizeof(patch));
+    copy[sizeof(patch) - 1] ^= 0x01;
+
+    ByteBuffer out = {};
+    TEST_ASSERT_FALSE(apply(old_image, copy, sizeof(patch), SIZE_MAX, &out));
+    byte_buffer_free(&out);
+    free(copy);
+}
+
+void setup() {
+    delay(2000);   // Lets the serial monitor attach
+
+    UNITY_BEGIN();
+    RUN_TEST(test_patch_chunked);
+    RUN_TEST(test_gzip_patch_streamed);
+    RUN_TEST(test_wrong_base_rejected);
+    RUN_TEST(test_truncated_patch_rejected);
+    RUN_TEST(test_corrupt_patch_rejected);
+    UNITY_END();
+}
+
+void loop() {
+}
@@ -0,0 +1,1092 @@
+// Generated by make_vectors.py, do not edit
+#pragma once
+#include <stdint.h>
+
+static const uint8_t old_image[8000] = {
+    0x23, 0x3a, 0x20, 0x7e, 0xe1, 0x2a, 0xf2, 0x3d, 0x07, 0x39, 0x2d, 0x0d, 0xa6, 0x78, 0x16, 0x00,
+    0x05, 0x12, 0x3a, 0xa7, 0x4e, 0x1e, 0x9f, 0x78, 0x9c, 0x70, 0x23, 0x00, 0x0b, 0xe6, 0x08, 0x25,
+    0x21, 0x3d, 0x2d, 0x22, 0xbc, 0x70, 0x33, 0x05, 0x1a, 0x21, 0x23, 0x23, 0x36, 0x17, 0x7b, 0xc3,
+    0x39, 0xfd, 0x62, 0x2c, 0x39, 0x66, 0x03, 0x31, 0x1f, 0xbd, 0x61, 0x23, 0x3d, 0x7c, 0x19, 0x10,
+    0x67, 0x33, 0xd1, 0x18, 0x30, 0x0c, 0x88, 0xd3, 0x10, 0x34, 0x3f, 0x14, 0xd1, 0xaa, 0xff, 0x72,
+    0x48, 0x27, 0x35, 0xf9, 0x1e, 0x34, 0x0e, 0xb0, 0x0a, 0x10, 0xd8, 0x15, 0x03, 0x7e, 0x10, 0xa4,
+    0x17, 0x4d, 0xd7, 0x31, 0x39, 0x3c, 0x26, 0x1f, 0x16, 0x29, 0x48, 0x3b, 0x0d, 0x32, 0x34, 0x27,
+    0x0c, 0x39, 0x3d, 0x1a, 0x24, 0x37, 0x3f, 0x02, 0x8b, 0xd2, 0x16, 0x20, 0xcf, 0x84, 0x3c, 0x3e,
+    0x06, 0x3a, 0x3b, 0xf4, 0x37, 0x3f, 0x32, 0x09, 0x09, 0xbb, 0xae, 0xed, 0x0b, 0x7d, 0x14, 0x27,
+    0x1e, 0xe0, 0xed, 0x3c, 0x0f, 0x0f, 0x3e, 0xb7, 0x78, 0xb6, 0x3e, 0x23, 0x38, 0x04, 0x7c, 0x01,
+    0x0d, 0x4b, 0x14, 0x38, 0xbd, 0xcc, 0x3a, 0xf0, 0x23, 0x23, 0x20, 0xc6, 0x4b, 0x4b, 0xfb, 0xff,
+    0x3d, 0x02, 0x33, 0x35, 0x1f, 0xff, 0x20, 0x25, 0x40, 0x6d, 0x09, 0x2f, 0xf6, 0x03, 0x37, 0x38,
+    0xf4, 0x1f, 0x1e, 0x04, 0x87, 0xba, 0x00, 0x24, 0x21, 0x6e, 0x90, 0xf1, 0x46, 0xfd, 0x3d, 0x02,
+    0x47, 0x05, 0x2a, 0x17, 0x1e, 0x1f, 0xd9, 0x00, 0x78, 0x69, 0x83, 0x0a, 0x73, 0x27, 0xd2, 0x82,
+    0x9c, 0x0b, 0x03, 0xe3, 0xc0, 0xf4, 0x1d, 0x33, 0x74, 0xf1, 0x9f, 0x18, 0x1a, 0x8e, 0x02, 0x27,
+    0x38, 0x11, 0x36, 0x2b, 0x05, 0x10, 0x2d, 0x4a, 0x2d, 0xfe, 0x90, 0x26, 0xc1, 0x21, 0xe6, 0xbf,
+    0x8c, 0x9d, 0x9f, 0x30, 0xe8, 0xe4, 0x1a, 0xdc, 0x28, 0xb7, 0x00, 0xd7, 0x23, 0x38, 0x2c, 0x0b,
+    0x0c, 0x01, 0x96, 0x34, 0x26, 0x51, 0x0b, 0x32, 0xab, 0x0a, 0x18, 0x14, 0x3f, 0x03, 0xad, 0x2e,
+    0x12, 0x58, 0x17, 0x16, 0x3b, 0x4d, 0x1a, 0x20, 0xc6, 0x2e, 0xf2, 0x4f, 0x22, 0x32, 0x21, 0x2f,
+    0x21, 0x3a, 0x79, 0x04, 0x23, 0x65, 0x59, 0x03, 0x27, 0x19, 0x25, 0x14, 0x3f, 0x4e, 0x2f, 0x33,
+    0xa9, 0x26, 0x5d, 0x22, 0x07, 0x05, 0x1d, 0xbf, 0x1e, 0x33, 0x10, 0x2e, 0x12, 0x0a, 0x33, 0x3b,
+    0x26, 0x26, 0x07, 0x27, 0x7d, 0xa4, 0x3b, 0x3d, 0x19, 0x03, 0x3d, 0x20, 0x5b, 0x02, 0x14, 0x0c,
+    0x10, 0x16, 0x15, 0xe4, 0x05, 0x23, 0x17, 0x10, 0x8a, 0x7b, 0x2a, 0xda, 0x70, 0x66, 0x51, 0x22,
+    0xc7, 0x7a, 0xbd, 0x17, 0x66, 0x2d, 0xdb, 0x6a, 0x01, 0x37, 0x07, 0x00, 0x35, 0x68, 0x62, 0xe3,
+    0x14, 0x33, 0x15, 0x93, 0x89, 0x99, 0x15, 0x03, 0x3d, 0x37, 0x50, 0x7e, 0xe9, 0x2c, 0x02, 0x2c,
+    0x4f, 0x63, 0x0e, 0x48, 0x0a, 0x19, 0x3a, 0x17, 0x1a, 0x16, 0x1f, 0x39, 0x39, 0xb5, 0xab, 0xc9,
+    0x2e, 0x6c, 0x0c, 0x04, 0x0b, 0x99, 0x3e, 0x50, 0x0d, 0x19, 0x4c, 0x1e, 0x0d, 0x32, 0x50, 0xb0,
+    0x37, 0x68, 0x17, 0x76, 0xcb, 0x32, 0x0e, 0x60, 0x07, 0x33, 0x20, 0xa3, 0x33, 0x34, 0x01, 0x0a,
+    0x19, 0xe1, 0x21, 0x3f, 0x3c, 0x10, 0x2d, 0x2d, 0x2c, 0x1c, 0x16, 0xfb, 0xac, 0x08, 0x10, 0xea,
+    0x12, 0x24, 0x18, 0x36, 0x21, 0xb5, 0xeb, 0x01, 0xb2, 0xc0, 0xd3, 0x38, 0x2b, 0x25, 0x86, 0x17,
+    0x0c, 0xb3, 0x08, 0xbf, 0x61, 0x27, 0x27, 0x1b, 0x97, 0x3e, 0xe7, 0x3e, 0x21, 0x60, 0x21, 0x27,
+    0x6a, 0xbb, 0xa8, 0x0b, 0x92, 0xa7, 0x3a, 0x79, 0x1d, 0xea, 0x70, 0x1e, 0x2a, 0x9d, 0x68, 0x86,
+    0xbe, 0x2e, 0x8d, 0x58, 0x16, 0xa5, 0x34, 0x3f, 0x7d, 0x24, 0x76, 0xaa, 0xe3, 0x56, 0xfe, 0x3b,
+    0x5c, 0xd8, 0x1b, 0x2d, 0x1d, 0x3b, 0x1f, 0x2d, 0x9d, 0x34, 0x55, 0x18, 0x49, 0x22, 0x3d, 0x19,
+    0x23, 0x0f, 0x27, 0x15, 0x60, 0xcf, 0x03, 0xbc, 0x3b, 0x2f, 0x39, 0x62, 0x24, 0x1a, 0xa2, 0x3c,
+    0x41, 0x04, 0x37, 0x13, 0xbc, 0x39, 0x13, 0x0b, 0x1a, 0x0a, 0xb5, 0x00, 0xfb, 0x9e, 0x02, 0x48,
+    0x34, 0x05, 0x35, 0x2a, 0x16, 0x5d, 0x30, 0x93, 0x1f, 0xa7, 0x14, 0x3e, 0x3a, 0x2f, 0x16, 0x7b,
+    0x03, 0x22, 0x1e, 0x25, 0x0e, 0xc8, 0x2a, 0x24, 0x26, 0x52, 0x15, 0x5b, 0x5a, 0x12, 0x33, 0xe7,
+    0x11, 0xad, 0x18, 0xe5, 0x24, 0x31, 0x29, 0x3d, 0xf1, 0x75, 0x81, 0x18, 0x58, 0xd1, 0x12, 0x11,
+    0x2a, 0xa4, 0xbb, 0x28, 0x95, 0x30, 0x62, 0x3a, 0x09, 0xa3, 0x37, 0x06, 0x76, 0xa8, 0x2f, 0xec,
+    0x9c, 0x3e, 0x2a, 0x63, 0x25, 0x43, 0x64, 0xb9, 0x13, 0x2c, 0x32, 0x3c, 0x2b, 0x20, 0x24, 0x21,
+    0x39, 0x12, 0x0e, 0x01, 0xe2, 0x0f, 0x16, 0x33, 0xac, 0x2e, 0x85, 0xf4, 0xdf, 0x98, 0x7d, 0xbe,
+    0x61, 0x19, 0x27, 0x5c, 0xd0, 0x9a, 0x03, 0x15, 0xd8, 0x17, 0x78, 0x02, 0x38, 0x00, 0x0f, 0x74,
+    0x2a, 0x49, 0x2e, 0x8a, 0x07, 0xab, 0x5d, 0x1e, 0x0b, 0xb7, 0x36, 0x3b, 0x00, 0x0b, 0x33, 0x33,
+    0x0f, 0xff, 0x7b, 0x30, 0x58, 0x13, 0x0c, 0x38, 0x2c, 0x2d, 0x54, 0x09, 0x0b, 0x27, 0x15, 0x0f,
+    0x3f, 0xd1, 0x21, 0xaa, 0x17, 0x2a, 0xc1, 0x12, 0xef, 0x0f, 0x37, 0x2c, 0xe6, 0xa0, 0x55, 0x0c,
+    0x13, 0x14, 0x34, 0xa7, 0xb9, 0x36, 0x1c, 0x16, 0x69, 0x36, 0x12, 0xfb, 0x25, 0x2c, 0xce, 0xd2,
+    0x20, 0x6b, 0x07, 0x0f, 0x70, 0x0a, 0x44, 0xd8, 0xf2, 0x26, 0x32, 0x90, 0x36, 0x15, 0x22, 0x02,
+    0x3c, 0x14, 0x04, 0x0c, 0x8d, 0x06, 0x3f, 0x14, 0xf7, 0x2a, 0x3a, 0x0b, 0x97, 0x4d, 0x27, 0x30,
+    0x35, 0x03, 0x21, 0x18, 0x2f, 0x35, 0x83, 0x33, 0x2e, 0x0f, 0x19, 0x21, 0x29, 0xfa, 0xde, 0x39,
+    0x1e, 0x1f, 0x7c, 0x17, 0x67, 0x15, 0x28, 0x2a, 0x07, 0xd3, 0xa3, 0x5b, 0x27, 0x04, 0x3b, 0x02,
+    0x58, 0xff, 0x08, 0x2a, 0x24, 0x0f, 0x27, 0x61, 0x25, 0xc7, 0x05, 0x2b, 0xe2, 0x2f, 0x37, 0x35,
+    0x2a, 0xe2, 0x80, 0x9c, 0x09, 0x1a, 0x0b, 0x30, 0xa1, 0xc9, 0x17, 0x27, 0x2b, 0x8a, 0x12, 0xad,
+    0x17, 0x00, 0xfa, 0x24, 0x5b, 0xc2, 0x0b, 0x46, 0x13, 0x20, 0x22, 0x97, 0x2a, 0x26, 0x0b, 0x04,
+    0x10, 0x33, 0x21, 0x43, 0xf6, 0x0c, 0x14, 0x08, 0x27, 0x39, 0x03, 0xed, 0x6c, 0x55, 0x06, 0x26,
+    0x18, 0x3c, 0x38, 0x3d, 0xb3, 0x2a, 0x27, 0x34, 0x19, 0xfb, 0x1b, 0x29, 0xb8, 0x8c, 0x0b, 0x2e,
+    0xfd, 0xbd, 0x38, 0x01, 0xfe, 0x03, 0x23, 0x60, 0x33, 0x07, 0x7c, 0x2e, 0x25, 0x03, 0x22, 0x15,
+    0x58, 0xa7, 0xb7, 0x76, 0x29, 0x3c, 0x4a, 0xa6, 0x1f, 0x28, 0x6c, 0x18, 0x1a, 0x1a, 0x98, 0x28,
+    0x9d, 0x32, 0xd5, 0x15, 0x27, 0x27, 0x23, 0x14, 0x06, 0x30, 0x0d, 0x49, 0x1f, 0xf7, 0x2a, 0xfc,
+    0xf8, 0x3b, 0x3d, 0xd2, 0x39, 0x02, 0x5e, 0xc8, 0x1e, 0x01, 0x25, 0x36, 0xce, 0x12, 0x93, 0xc1,
+    0x37, 0xe5, 0x66, 0x0f, 0x39, 0x03, 0xff, 0x05, 0x0f, 0xbb, 0x00, 0x96, 0x21, 0xa5, 0xfd, 0x23,
+    0x03, 0x0c, 0xc8, 0x11, 0x2a, 0x1f, 0x4c, 0xd2, 0x3b, 0xc3, 0x25, 0xc8, 0x09, 0x0c, 0x1e, 0x29,
+    0x0d, 0x20, 0x0a, 0x01, 0x3c, 0x50, 0xcf, 0x2c, 0x0b, 0xcf, 0x10, 0xe9, 0x8d, 0x29, 0x4f, 0x0f,
+    0x7c, 0xf7, 0x18, 0x35, 0x3f, 0x83, 0x11, 0xfc, 0x34, 0x15, 0x20, 0x13, 0x88, 0xf5, 0x03, 0x0d,
+    0x2b, 0x6f, 0x07, 0x09, 0x27, 0x10, 0x9f, 0xf1, 0x05, 0x5d, 0x18, 0x4c, 0x9a, 0x1b, 0x36, 0xe3,
+    0x60, 0x2b, 0x2b, 0x5c, 0x02, 0x13, 0xde, 0x3b, 0xfe, 0x08, 0x82, 0x6a, 0x0e, 0x00, 0xcb, 0x0b,
+    0x71, 0xfd, 0xad, 0x44, 0x53, 0x25, 0xd2, 0xd7, 0x93, 0x3d, 0x76, 0x10, 0x06, 0x1c, 0x2f, 0x33,
+    0x14, 0x25, 0x04, 0x2a, 0xe7, 0x78, 0xb2, 0x33, 0x4c, 0x79, 0x0f, 0x1d, 0x51, 0x69, 0x39, 0x36,
+    0x16, 0x38, 0x2b, 0xcc, 0xdb, 0xac, 0x2c, 0xa3, 0x0b, 0x26, 0x17, 0x05, 0xa0, 0x02, 0x3c, 0x05,
+    0x38, 0x05, 0x4f, 0x62, 0x28, 0x3e, 0x3e, 0xd3, 0x94, 0xc0, 0x26, 0xec, 0x02, 0xa7, 0x36, 0x17,
+    0xdb, 0xb4, 0x81, 0x2f, 0x24, 0x00, 0xd2, 0x05, 0x30, 0x32, 0xb1, 0xd1, 0x32, 0x3f, 0x34, 0x5b,
+    0x59, 0x24, 0x04, 0x96, 0x12, 0x0b, 0x28, 0x6d, 0x1e, 0x3a, 0x23, 0x04, 0x0e, 0x2f, 0x6e, 0x11,
+    0x3b, 0x21, 0xd7, 0x0d, 0x12, 0x23, 0x0c, 0x0d, 0x19, 0x36, 0x00, 0x1b, 0x10, 0x39, 0x3b, 0x1d,
+    0xbe, 0x27, 0x79, 0x3d, 0x09, 0x10, 0xbf, 0x32, 0x14, 0x21, 0x2e, 0x30, 0xe7, 0x63, 0x18, 0xbd,
+    0xdd, 0x2d, 0xe5, 0x75, 0x87, 0xe1, 0x01, 0x29, 0x33, 0xf6, 0x27, 0x06, 0x11, 0xdc, 0x19, 0xc5,
+    0xde, 0x2c, 0x16, 0x0e, 0x18, 0x00, 0x0e, 0xd9, 0x13, 0x56, 0xd4, 0x04, 0xf0, 0x38, 0x14, 0xd8,
+    0xda, 0x36, 0x23, 0x34, 0x76, 0x2e, 0x01, 0x00, 0x5f, 0xe3, 0x32, 0x2e, 0x8f, 0x2b, 0x33, 0x37,
+    0x33, 0x6d, 0x00, 0x3b, 0xf0, 0x1d, 0x1e, 0x3b, 0x2b, 0x39, 0x08, 0x06, 0x10, 0x76, 0x14, 0xa4,
+    0x87, 0x08, 0xbf, 0x16, 0x3e, 0x07, 0x33, 0x17, 0x35, 0x78, 0x78, 0x13, 0x95, 0xd8, 0xdc, 0xfb,
+    0x3c, 0x1e, 0x29, 0x8d, 0x09, 0xf6, 0x22, 0x4d, 0x0d, 0xfa, 0x6d, 0x66, 0x5e, 0x39, 0x0d, 0x1d,
+    0xee, 0x19, 0x26, 0x11, 0xd4, 0x39, 0x13, 0x85, 0x0e, 0x8b, 0x2f, 0x0a, 0x1f, 0x0e, 0x22, 0xa0,
+    0x37, 0x04, 0x5f, 0x23, 0x80, 0xa4, 0xa9, 0x0f, 0x30, 0xdc, 0x0e, 0x2b, 0x1b, 0x40, 0x22, 0x09,
+    0x28, 0x15, 0x30, 0xac, 0x27, 0xf6, 0x0e, 0x23, 0x2c, 0x57, 0x0c, 0x04, 0xd7, 0x12, 0x1e, 0x10,
+    0x31, 0x27, 0x29, 0x11, 0xf2, 0x3c, 0x3a, 0xbb, 0xf0, 0x39, 0xbe, 0x78, 0x1f, 0x00, 0x9d, 0x03,
+    0x6e, 0xd7, 0x50, 0x5d, 0x35, 0xf9, 0x33, 0x16, 0x34, 0x21, 0x1c, 0x79, 0xa3, 0x29, 0x3f, 0x00,
+    0xfa, 0x7d, 0x6c, 0x2d, 0x08, 0x1d, 0x0c, 0x0c, 0x11, 0x98, 0xd4, 0x28, 0x02, 0x20, 0x32, 0x96,
+    0x2a, 0xbf, 0xa2, 0xca, 0x55, 0x87, 0xbc, 0x23, 0x30, 0x3c, 0x6c, 0x2c, 0x3f, 0x31, 0x32, 0x36,
+    0x0f, 0x1f, 0x07, 0x17, 0x00, 0xe7, 0x25, 0x0e, 0x31, 0xc3, 0x1e, 0x57, 0x02, 0x96, 0x3c, 0x62,
+    0x06, 0x1b, 0x35, 0xac, 0x26, 0x09, 0x67, 0xa6, 0xe8, 0x13, 0x5b, 0xe2, 0xc3, 0x20, 0x0e, 0x28,
+    0x5a, 0x3a, 0x3e, 0xbe, 0x22, 0xa7, 0xce, 0xb1, 0x9e, 0x0e, 0x68, 0x3d, 0x21, 0x44, 0x17, 0x2f,
+    0x2b, 0x1f, 0x1b, 0x5c, 0xd5, 0x3e, 0x3d, 0xd1, 0x1d, 0x0d, 0xcf, 0x6a, 0x07, 0x5b, 0x24, 0xe4,
+    0xd1, 0xf6, 0x32, 0x0f, 0x4b, 0xb7, 0x0f, 0xaf, 0x0e, 0x2b, 0x39, 0x38, 0x1d, 0x1d, 0x31, 0x62,
+    0x2c, 0x3a, 0xd8, 0x00, 0x0e, 0x88, 0x29, 0x1a, 0x05, 0x8a, 0x5f, 0xfa, 0xdb, 0x23, 0x2c, 0x31,
+    0x02, 0x19, 0x27, 0xab, 0x03, 0x93, 0x06, 0x0e, 0x21, 0x3f, 0x05, 0x3e, 0x0d, 0x34, 0x3b, 0xf4,
+    0x17, 0x96, 0x4f, 0x16, 0xfb, 0x25, 0xb8, 0x06, 0x05, 0x0a, 0x60, 0xbb, 0x2e, 0x3c, 0xf4, 0xef,
+    0x25, 0x8e, 0x0f, 0x25, 0xbf, 0x2a, 0x33, 0x8a, 0x71, 0x3a, 0x39, 0x15, 0x70, 0x30, 0xfa, 0xa2,
+    0x8f, 0x36, 0x13, 0xee, 0x15, 0x3b, 0x41, 0x11, 0x10, 0x07, 0x26, 0x1e, 0x36, 0x3d, 0x27, 0x2f,
+    0x11, 0x02, 0x02, 0x24, 0x37, 0x1f, 0xb1, 0x16, 0x19, 0x1e, 0x12, 0x85, 0x06, 0xae, 0x2f, 0x11,
+    0x0d, 0x40, 0x25, 0x09, 0xd7, 0x23, 0x36, 0x85, 0xb3, 0x75, 0x07, 0x3c, 0xa1, 0x3d, 0x9e, 0x1e,
+    0x18, 0x34, 0x9d, 0x6d, 0xf1, 0x59, 0x2a, 0x3c, 0x17, 0x65, 0x30, 0x24, 0xea, 0xbd, 0x23, 0x4f,
+    0x22, 0x36, 0x15, 0xdd, 0x20, 0x09, 0x3b, 0x9f, 0xa9, 0x3d, 0x9f, 0x35, 0x34, 0x19, 0x17, 0x32,
+    0x2c, 0x0f, 0x2a, 0x25, 0x0d, 0x0c, 0x07, 0x5b, 0xdc, 0x19, 0xa6, 0x34, 0x83, 0x36, 0x2f, 0xc0,
+    0x80, 0x21, 0x92, 0x30, 0x3c, 0x3c, 0x30, 0xb5, 0x13, 0x2a, 0x3d, 0x12, 0x38, 0x10, 0x37, 0x04,
+    0x1e, 0x20, 0x56, 0xda, 0xbf, 0x1a, 0x27, 0x0f, 0x3a, 0x1d, 0xe6, 0x3b, 0x1f, 0x87, 0x38, 0xc5,
+    0x20, 0x3d, 0x3a, 0xe3, 0x88, 0x15, 0x1c, 0x23, 0x34, 0x70, 0xc0, 0xf3, 0x0e, 0x53, 0x1e, 0x57,
+    0x20, 0x74, 0x0b, 0x89, 0xa9, 0x09, 0x34, 0x98, 0x1e, 0x05, 0x06, 0x8a, 0x0d, 0x13, 0x0f, 0x16,
+    0x53, 0x3f, 0x6c, 0xf0, 0x27, 0x29, 0x2a, 0x37, 0x65, 0x37, 0x3f, 0xb9, 0x66, 0x30, 0x17, 0x0b,
+    0x25, 0x17, 0x90, 0x24, 0x06, 0x2b, 0x02, 0x29, 0x14, 0x2a, 0x44, 0xb5, 0x10, 0x28, 0x04, 0x3d,
+    0x5c, 0xc2, 0xa0, 0x34, 0x62, 0x34, 0xcc, 0x14, 0x2d, 0x1c, 0x34, 0xdb, 0x23, 0xb4, 0x77, 0x70,
+    0xb4, 0xd5, 0x15, 0x1f, 0x23, 0x11, 0xb3, 0x58, 0x2e, 0x01, 0xd6, 0xd9, 0x79, 0x1b, 0xbe, 0xef,
+    0x26, 0x2d, 0x31, 0x3c, 0x7d, 0x76, 0x15, 0x6f, 0x48, 0x1c, 0x1a, 0x2f, 0x29, 0x53, 0x87, 0x11,
+    0x3c, 0x81, 0x24, 0xc2, 0x7b, 0xc3, 0x20, 0x4e, 0x14, 0x30, 0x5b, 0xdf, 0xb3, 0xbb, 0xdc, 0x65,
+    0xa6, 0x0b, 0x3f, 0xee, 0xdb, 0x36, 0xbb, 0x30, 0x1c, 0xe3, 0x2e, 0xe9, 0xa5, 0xb6, 0x23, 0x06,
+    0x22, 0x10, 0x8a, 0xcf, 0x08, 0xef, 0x53, 0x03, 0x3f, 0xb1, 0xb3, 0x16, 0xdc, 0x7f, 0xd5, 0xa5,
+    0x29, 0x00, 0x40, 0x3a, 0x37, 0x16, 0x17, 0xef, 0x08, 0x00, 0xc8, 0xc9, 0x03, 0x39, 0x3d, 0x98,
+    0x2b, 0xe0, 0xa9, 0x73, 0x58, 0x99, 0x2d, 0xde, 0x29, 0xb5, 0x3e, 0x1d, 0x9c, 0xdf, 0x3e, 0x36,
+    0x20, 0x22, 0x0b, 0x2b, 0xaa, 0x18, 0x2c, 0xea, 0x73, 0x18, 0x1a, 0x11, 0x05, 0x27, 0x2c, 0x01,
+    0x8b, 0x28, 0x00, 0xb4, 0x2c, 0x0c, 0x7f, 0xf0, 0xc2, 0x14, 0x00, 0x93, 0x2d, 0x82, 0x0a, 0x2d,
+    0x05, 0x33, 0x51, 0x33, 0xf6, 0x24, 0x7d, 0x1d, 0x10, 0x1d, 0x68, 0xcc, 0x09, 0x12, 0xe6, 0x65,
+    0x04, 0x7d, 0x26, 0x0d, 0x05, 0x15, 0x59, 0x0e, 0x39, 0x3c, 0x2f, 0xbf, 0xd4, 0x95, 0x0d, 0xfa,
+    0x20, 0x05, 0x3e, 0x02, 0x20, 0x3b, 0x1a, 0x06, 0x31, 0x35, 0xed, 0xf1, 0xed, 0x41, 0x0f, 0x28,
+    0xb4, 0x3b, 0x80, 0x28, 0x20, 0xb0, 0x32, 0x6f, 0x28, 0x30, 0x33, 0x3d, 0x24, 0xb9, 0x08, 0x39,
+    0xab, 0xf8, 0x54, 0x04, 0x11, 0x7b, 0x36, 0x03, 0x3b, 0x01, 0x38, 0x2e, 0x48, 0xb4, 0x27, 0x13,
+    0x85, 0x39, 0x1d, 0x34, 0x0e, 0x27, 0x6a, 0x14, 0x86, 0x68, 0x40, 0x20, 0x21, 0x38, 0x60, 0x31,
+    0xd1, 0x3f, 0x1e, 0x38, 0x43, 0x18, 0xde, 0x10, 0x0a, 0x04, 0xcf, 0x28, 0x15, 0xca, 0x1d, 0x21,
+    0x14, 0x2e, 0xb8, 0x03, 0x08, 0x13, 0x58, 0xc7, 0x2b, 0x38, 0x2c, 0x20, 0x0c, 0x5d, 0x0c, 0x7d,
+    0x39, 0x2d, 0x41, 0x10, 0x22, 0x06, 0x29, 0x96, 0x03, 0xa0, 0x0b, 0x43, 0x0a, 0x19, 0x3b, 0x2f,
+    0x5d, 0x1d, 0x6c, 0x03, 0xf2, 0x1a, 0xb0, 0x2d, 0xce, 0x31, 0xa2, 0x5e, 0x0e, 0x15, 0x2b, 0x87,
+    0xfe, 0x35, 0xb7, 0x30, 0x27, 0x4f, 0xca, 0x35, 0xae, 0x8c, 0x03, 0x36, 0x32, 0x2a, 0x34, 0x2e,
+    0x2a, 0x0e, 0x10, 0x07, 0xd0, 0xa6, 0x33, 0x26, 0x4e, 0x83, 0x3a, 0x6b, 0x17, 0x45, 0xfc, 0xdb,
+    0x0d, 0x55, 0x2f, 0xfd, 0x27, 0x38, 0x1a, 0x2b, 0x01, 0x65, 0x3d, 0x29, 0x2f, 0xb2, 0x41, 0x52,
+    0x25, 0x93, 0x3e, 0x06, 0x10, 0x83, 0xbb, 0x53, 0xba, 0x15, 0x09, 0x2a, 0x83, 0x3f, 0xf1, 0x0f,
+    0x99, 0x24, 0x4c, 0x1b, 0x94, 0x08, 0x2b, 0x0b, 0xb1, 0xce, 0x19, 0x2d, 0x0d, 0x29, 0x9b, 0x1b,
+    0x1a, 0xff, 0x34, 0xf5, 0xa6, 0x91, 0x6b, 0x10, 0x51, 0x27, 0x7d, 0x33, 0x3f, 0x3e, 0x35, 0x06,
+    0x35, 0x2a, 0x0c, 0x0e, 0x39, 0xdd, 0x62, 0x05, 0x86, 0x1a, 0x01, 0x69, 0xf4, 0x1b, 0x37, 0xb4,
+    0x29, 0x25, 0x44, 0x0e, 0x01, 0x1a, 0x47, 0x24, 0x34, 0x9e, 0x1f, 0xbe, 0x12, 0x04, 0x14, 0xf6,
+    0x3a, 0x65, 0x19, 0x4d, 0x3a, 0x1a, 0x16, 0xb3, 0xde, 0x99, 0x06, 0xc2, 0x32, 0xda, 0xb9, 0x3b,
+    0x43, 0x30, 0x19, 0x25, 0x36, 0x23, 0x33, 0x27, 0x15, 0x09, 0x87, 0x17, 0x3e, 0x87, 0x01, 0x28,
+    0x2e, 0x72, 0x12, 0x1b, 0x71, 0x3d, 0xe1, 0x88, 0x23, 0x21, 0xfb, 0x34, 0x2a, 0x02, 0x2c, 0xaf,
+    0x27, 0x32, 0x39, 0x34, 0x29, 0x0f, 0x2c, 0x35, 0x09, 0x13, 0x6f, 0x02, 0x8a, 0x0c, 0xa7, 0x69,
+    0x34, 0x0e, 0x5b, 0x2d, 0x09, 0x94, 0x40, 0x33, 0x1c, 0x87, 0x38, 0x2f, 0x09, 0x3d, 0x13, 0x47,
+    0x73, 0x1e, 0xcb, 0x4a, 0x80, 0x1e, 0x2d, 0x9c, 0x37, 0x3e, 0x22, 0xe9, 0x96, 0xf5, 0x02, 0xe3,
+    0xa6, 0x03, 0xa0, 0x2e, 0x2b, 0x38, 0x0e, 0x1a, 0x36, 0x0a, 0x63, 0xc9, 0xe6, 0x01, 0x24, 0x19,
+    0x9f, 0x76, 0x59, 0x30, 0x09, 0x3b, 0x07, 0x09, 0x65, 0x38, 0x05, 0xed, 0x31, 0x37, 0x8d, 0x01,
+    0x32, 0x20, 0xfa, 0x34, 0x08, 0xfa, 0xbf, 0x3c, 0xbc, 0xc5, 0x36, 0xf3, 0x05, 0x0e, 0x3f, 0x29,
+    0xf0, 0xca, 0x06, 0xae, 0x35, 0x2b, 0x45, 0x70, 0x00, 0xf2, 0x54, 0x5b, 0x16, 0x20, 0x09, 0xd1,
+    0x22, 0xc0, 0x0a, 0x13, 0x34, 0x3e, 0x80, 0x87, 0x37, 0x2a, 0xaf, 0x66, 0x3d, 0x18, 0xa6, 0xe4,
+    0x0c, 0x0e, 0x21, 0x3a, 0x3c, 0x2b, 0x1b, 0xa5, 0x48, 0x53, 0x39, 0x01, 0xb3, 0xc9, 0x62, 0x03,
+    0x08, 0xd7, 0x0a, 0x4a, 0x16, 0x24, 0x48, 0x33, 0xf0, 0x22, 0x98, 0x2d, 0x38, 0x7f, 0x59, 0x65,
+    0x00, 0x23, 0x34, 0x3e, 0x01, 0x25, 0xcd, 0x17, 0x16, 0x32, 0xbf, 0x01, 0x48, 0x35, 0x8c, 0x99,
+    0x13, 0x3a, 0x34, 0x2f, 0x20, 0xee, 0x3c, 0x36, 0x21, 0x3d, 0x6b, 0xf9, 0x1e, 0x0d, 0x19, 0x3d,
+    0x85, 0x68, 0x61, 0x2f, 0x28, 0x5a, 0x2a, 0x33, 0x16, 0x10, 0x11, 0x3f, 0x84, 0x29, 0x17, 0x09,
+    0x22, 0xc9, 0x05, 0x38, 0x0d, 0x07, 0xb6, 0x22, 0x1a, 0x10, 0x0b, 0xa9, 0x17, 0x03, 0x30, 0x14,
+    0x1f, 0x20, 0x05, 0x33, 0xf4, 0x12, 0x27, 0x36, 0x3a, 0x22, 0x18, 0x0f, 0xbc, 0x07, 0x31, 0x9a,
+    0x50, 0x1c, 0x0d, 0x57, 0x28, 0xc8, 0x2a, 0x78, 0x15, 0x10, 0x20, 0xc7, 0x37, 0x0e, 0x05, 0x34,
+    0x17, 0x14, 0x59, 0x9b, 0x2e, 0x24, 0xfb, 0x16, 0x0b, 0x03, 0x15, 0x14, 0x22, 0x61, 0x2d, 0xa3,
+    0x07, 0x94, 0x20, 0x11, 0xc5, 0xcf, 0x3c, 0x15, 0x28, 0x0f, 0xbd, 0x21, 0x37, 0x65, 0x3f, 0x30,
+    0x0e, 0x34, 0x27, 0x05, 0xaa, 0x3a, 0x1e, 0x4f, 0x5a, 0xcc, 0x58, 0x64, 0x01, 0x08, 0x07, 0x2c,
+    0x3d, 0x6e, 0x17, 0x21, 0x02, 0x21, 0x0e, 0x31, 0x0b, 0x3f, 0x26, 0x74, 0xe6, 0xb4, 0xda, 0x38,
+    0xcc, 0xe9, 0x37, 0x26, 0x26, 0x17, 0x47, 0x15, 0x73, 0x17, 0x34, 0x2d, 0x16, 0x45, 0x2a, 0x7a,
+    0x27, 0x2a, 0x08, 0x36, 0x60, 0x0d, 0x09, 0x32, 0xb7, 0xb6, 0xc6, 0x3c, 0x07, 0x3b, 0xf3, 0x20,
+    0xf5, 0xcf, 0x04, 0x24, 0x9e, 0x3a, 0x0f, 0x0f, 0x38, 0x15, 0x37, 0x0d, 0x3b, 0x2c, 0xfe, 0xcc,
+    0x00, 0x00, 0xf9, 0x10, 0xea, 0xa2, 0xd2, 0x25, 0x33, 0x76, 0x52, 0x6a, 0x1d, 0x2d, 0x10, 0x33,
+    0xfc, 0xc8, 0x1e, 0x3f, 0x3c, 0x13, 0xe8, 0x73, 0x8f, 0xae, 0x9b, 0x2c, 0x22, 0x90, 0xa7, 0x89,
+    0x01, 0xde, 0x1f, 0x56, 0x1d, 0x3a, 0x36, 0x7b, 0x9b, 0x05, 0x00, 0x36, 0x06, 0x5a, 0x72, 0x13,
+    0x24, 0x30, 0x1e, 0x03, 0x17, 0x00, 0x77, 0x00, 0x14, 0x00, 0x19, 0xf3, 0x5e, 0x2b, 0x07, 0x9e,
+    0x29, 0x2f, 0x45, 0x8f, 0x39, 0x10, 0xca, 0xd2, 0xf1, 0xc4, 0x6c, 0x0d, 0x46, 0x19, 0x02, 0x1e,
+    0x06, 0x77, 0x01, 0xf7, 0x52, 0x03, 0x18, 0x0a, 0x5e, 0x44, 0x44, 0xc8, 0xde, 0x89, 0x2a, 0x31,
+    0x2b, 0xb6, 0x3c, 0x26, 0xf1, 0x36, 0x9f, 0x1e, 0x09, 0xbe, 0x03, 0x0f, 0xc7, 0x1a, 0x7b, 0x16,
+    0x2a, 0xa1, 0x2a, 0xa8, 0x05, 0x83, 0x55, 0x3d, 0x2c, 0xb4, 0x01, 0x68, 0xe4, 0x34, 0x07, 0xa3,
+    0x02, 0x06, 0x37, 0x16, 0x19, 0x9e, 0x04, 0xed, 0xb6, 0x2d, 0x05, 0x28, 0x13, 0x3c, 0x15, 0x36,
+    0x4f, 0x1e, 0x12, 0x11, 0x3d, 0x54, 0x0e, 0x74, 0x2b, 0x2c, 0xea, 0x1c, 0xee, 0x3d, 0x38, 0x0d,
+    0xfc, 0x33, 0x3a, 0x9c, 0x0a, 0x18, 0x4d, 0x1b, 0x8e, 0x0b, 0x26, 0x17, 0x24, 0x51, 0xeb, 0x2f,
+    0x1f, 0x08, 0xb2, 0x10, 0xc7, 0x13, 0x90, 0x70, 0x39, 0x61, 0x29, 0xa6, 0x3f, 0x3e, 0x46, 0x13,
+    0x00, 0x18, 0x10, 0x04, 0xf4, 0xa2, 0xf5, 0xbe, 0xe2, 0x17, 0x03, 0xc4, 0xb9, 0x15, 0x02, 0x45,
+    0x21, 0xf5, 0x6c, 0xf9, 0x18, 0x7e, 0x26, 0xd2, 0x10, 0x17, 0x77, 0x94, 0x0c, 0xcd, 0x64, 0x1d,
+    0x23, 0x14, 0x89, 0xf1, 0x3a, 0x41, 0xd9, 0xfa, 0xd4, 0x3a, 0xf0, 0xd2, 0x0b, 0x15, 0xdb, 0x37,
+    0x3e, 0x34, 0x36, 0x33, 0x16, 0x38, 0x3a, 0x63, 0x05, 0x0a, 0x2b, 0x3c, 0x15, 0x2c, 0x02, 0x1f,
+    0x33, 0x86, 0x01, 0x30, 0x34, 0x10, 0x30, 0x1e, 0x06, 0x31, 0xaa, 0x06, 0x16, 0x1c, 0x0c, 0x14,
+    0x40, 0x35, 0x00, 0x27, 0x29, 0x31, 0x11, 0x11, 0x38, 0x26, 0x0b, 0x87, 0x19, 0x11, 0x24, 0xe2,
+    0x60, 0x08, 0x0b, 0x02, 0x0a, 0x01, 0x29, 0x29, 0x1d, 0x2c, 0x1a, 0x99, 0x54, 0x11, 0x7f, 0x03,
+    0xfb, 0x46, 0x5e, 0x0d, 0x0a, 0xf1, 0x3a, 0x6e, 0xbe, 0x82, 0x38, 0x31, 0xc0, 0xe8, 0x2f, 0xf4,
+    0x37, 0x91, 0x10, 0x33, 0x4b, 0xb0, 0x1e, 0x3d, 0x13, 0xaf, 0x12, 0x6b, 0xa7, 0x3a, 0x02, 0x45,
+    0x11, 0x15, 0x1c, 0x05, 0x16, 0xda, 0x0d, 0x3d, 0x28, 0xae, 0x31, 0x1d, 0x20, 0x16, 0x1c, 0x24,
+    0x01, 0x72, 0x15, 0x66, 0x16, 0x0d, 0x27, 0x0b, 0xc0, 0x25, 0x13, 0x78, 0x10, 0x11, 0x7b, 0x6b,
+    0x10, 0x73, 0x0b, 0x1b, 0x06, 0x31, 0x17, 0x9e, 0xa5, 0x85, 0xda, 0x0e, 0x31, 0x07, 0x18, 0xb6,
+    0x87, 0x21, 0x2b, 0xf0, 0x1c, 0x20, 0x01, 0xa9, 0x26, 0x04, 0x2e, 0x0d, 0xb1, 0x01, 0x5e, 0x01,
+    0x2a, 0x20, 0x22, 0x17, 0xea, 0x2f, 0x04, 0x8f, 0x63, 0x1a, 0xad, 0x1c, 0x0d, 0x7d, 0x23, 0x3a,
+    0x0d, 0xb9, 0xd3, 0x2a, 0x5b, 0x91, 0x33, 0x2c, 0x88, 0x29, 0x1f, 0x14, 0x1d, 0x3d, 0x7c, 0x45,
+    0x27, 0x35, 0x16, 0x37, 0x2c, 0x00, 0x3f, 0x6a, 0x24, 0x00, 0x66, 0x36, 0x92, 0xd0, 0xc2, 0x3d,
+    0x16, 0x5a, 0x93, 0x20, 0x29, 0x35, 0x19, 0x2f, 0x06, 0x64, 0x20, 0x40, 0x38, 0x31, 0xfa, 0xa5,
+    0x12, 0x24, 0xc2, 0x00, 0x08, 0x89, 0xe1, 0xfa, 0x87, 0x14, 0x24, 0x05, 0x4c, 0x7a, 0x1c, 0xb9,
+    0x13, 0x00, 0xf9, 0x07, 0x3b, 0x2b, 0x4d, 0x1a, 0x00, 0x35, 0x37, 0x1c, 0x1e, 0x16, 0x2a, 0x1b,
+    0xac, 0x33, 0x53, 0x26, 0x21, 0x39, 0x40, 0xf5, 0x9a, 0xc7, 0x20, 0x29, 0x0d, 0x0f, 0xc4, 0xe5,
+    0x84, 0xf7, 0xb1, 0x3b, 0x3e, 0x12, 0x31, 0xc0, 0x20, 0x1d, 0x2a, 0x0e, 0xe0, 0x37, 0x20, 0x34,
+    0xdb, 0x10, 0x35, 0x17, 0x1a, 0xf7, 0x5d, 0x24, 0xf6, 0xe0, 0x2f, 0x0f, 0x22, 0x01, 0xf0, 0x33,
+    0x23, 0x20, 0x17, 0xc1, 0x19, 0x31, 0x1a, 0x12, 0x0a, 0x3d, 0x1f, 0x08, 0x03, 0x07, 0x1b, 0x48,
+    0x3b, 0x2f, 0x6e, 0x08, 0x6c, 0x30, 0x16, 0x4e, 0x40, 0x14, 0x25, 0x38, 0x13, 0x38, 0x05, 0xca,
+    0x02, 0x32, 0x4d, 0x3a, 0x1b, 0x2f, 0x0a, 0xd2, 0x44, 0x26, 0x64, 0x1c, 0x07, 0x00, 0x9f, 0x19,
+    0x07, 0x05, 0x70, 0x18, 0x93, 0x32, 0x33, 0x8c, 0xf6, 0x25, 0x62, 0x15, 0x0d, 0xa7, 0xf8, 0x47,
+    0xe4, 0x20, 0x11, 0xc6, 0xc9, 0x29, 0x9d, 0xfd, 0x19, 0xd0, 0xe8, 0x3c, 0xee, 0x19, 0x3e, 0x98,
+    0xb9, 0x22, 0x11, 0xd8, 0x01, 0x11, 0x79, 0x48, 0xbd, 0x0a, 0x24, 0xac, 0xc5, 0x02, 0x31, 0x03,
+    0x34, 0x34, 0x16, 0x97, 0xa6, 0x10, 0x4c, 0x8f, 0xf1, 0xd2, 0xa7, 0xf0, 0x16, 0x35, 0x32, 0x20,
+    0x3b, 0x02, 0x22, 0x31, 0x16, 0x7a, 0x72, 0x80, 0x1d, 0x27, 0x25, 0x41, 0x0a, 0x36, 0x31, 0x19,
+    0x05, 0x0a, 0x41, 0x30, 0x15, 0x58, 0x88, 0x1d, 0x4c, 0x24, 0x42, 0x77, 0xfb, 0x1b, 0x7f, 0x2b,
+    0x70, 0x0f, 0x19, 0x03, 0x11, 0x10, 0x2c, 0x05, 0x02, 0x04, 0x3b, 0x3c, 0x16, 0x30, 0xd7, 0xdd,
+    0xe9, 0x39, 0x2e, 0x13, 0xa9, 0x16, 0x1d, 0x1d, 0x30, 0x27, 0x27, 0x53, 0x5f, 0x2a, 0xbd, 0x1a,
+    0x29, 0x5a, 0x1b, 0x09, 0x66, 0xb1, 0xa6, 0x2b, 0x0a, 0x26, 0x97, 0x17, 0x24, 0x3d, 0x2d, 0x2b,
+    0x2b, 0xd3, 0x2d, 0xba, 0x26, 0x21, 0x08, 0x81, 0x25, 0xb3, 0x23, 0x2a, 0x36, 0x25, 0x2d, 0x38,
+    0x2c, 0xbe, 0xca, 0x1e, 0x25, 0x2b, 0x30, 0x7d, 0x14, 0x33, 0x7c, 0x18, 0x03, 0x1e, 0xe7, 0xc4,
+    0xa1, 0x0f, 0xad, 0x9c, 0x75, 0x0b, 0xb6, 0x13, 0xf1, 0x36, 0x10, 0xa1, 0x20, 0x30, 0xf3, 0x14,
+    0x0c, 0x23, 0x2f, 0x26, 0xdf, 0x0f, 0x2c, 0x29, 0x0e, 0x2a, 0x10, 0xbf, 0x2c, 0x12, 0x23, 0x44,
+    0x3c, 0x21, 0x21, 0x9d, 0x72, 0x11, 0x30, 0x2b, 0x1f, 0xd8, 0xf8, 0x02, 0x47, 0x72, 0x1e, 0x37,
+    0x13, 0x0d, 0xe6, 0x87, 0x2c, 0x18, 0xf1, 0x1c, 0x00, 0x2a, 0xa8, 0xc3, 0x23, 0x2b, 0x47, 0x35,
+    0x65, 0x32, 0x3c, 0x30, 0x06, 0xc9, 0x29, 0x01, 0x28, 0x31, 0x3f, 0x3e, 0x1c, 0xbd, 0x08, 0x1e,
+    0x8b, 0x43, 0x25, 0x0f, 0x5b, 0x24, 0xb1, 0x76, 0x4c, 0x22, 0xad, 0x45, 0x34, 0x2b, 0xdd, 0x18,
+    0xfd, 0x3d, 0x15, 0x0f, 0x23, 0x2f, 0x24, 0x10, 0x31, 0x1a, 0x0a, 0x0e, 0xdb, 0xe2, 0x78, 0x39,
+    0x36, 0x4f, 0x1b, 0x38, 0xb7, 0x05, 0xae, 0xdf, 0x7f, 0x8b, 0x02, 0x85, 0x10, 0xb6, 0x74, 0x31,
+    0xdc, 0x57, 0x68, 0x26, 0x28, 0x11, 0x58, 0x0c, 0x1d, 0x4d, 0x16, 0x00, 0x3a, 0x47, 0x02, 0x6c,
+    0xf6, 0x90, 0x21, 0x6c, 0x18, 0x28, 0x3c, 0x80, 0xee, 0x2a, 0x3b, 0x04, 0x70, 0x1b, 0x2a, 0x8b,
+    0x0a, 0x16, 0x33, 0x02, 0x24, 0x24, 0x05, 0x62, 0x0d, 0x10, 0xc6, 0x19, 0xaa, 0xad, 0xd7, 0x12,
+    0x26, 0xde, 0x32, 0xb9, 0x17, 0x9c, 0xe7, 0x98, 0x3d, 0x32, 0x35, 0x04, 0x68, 0x20, 0x0a, 0xbc,
+    0x04, 0x21, 0xd2, 0x1d, 0x28, 0x01, 0x50, 0x04, 0x30, 0xe6, 0xec, 0xad, 0x06, 0xde, 0x86, 0x1b,
+    0x02, 0xfd, 0x0e, 0x5d, 0x0e, 0x49, 0x89, 0x7c, 0xbd, 0x37, 0x92, 0x00, 0x86, 0x2a, 0xc9, 0x77,
+    0x86, 0x0d, 0x1f, 0x01, 0x3f, 0x54, 0xae, 0x06, 0x37, 0x05, 0x2b, 0x2f, 0x4c, 0x66, 0x3a, 0x66,
+    0x3a, 0x39, 0x7a, 0x0a, 0x66, 0x0f, 0x23, 0x10, 0xba, 0x7a, 0x3e, 0x10, 0x30, 0x03, 0x0f, 0x9d,
+    0x11, 0x06, 0xd4, 0xeb, 0x7e, 0x20, 0xd3, 0x28, 0x20, 0x21, 0xea, 0x04, 0x11, 0x3e, 0xca, 0x09,
+    0x16, 0xe9, 0x09, 0x17, 0x3e, 0x95, 0x57, 0x0f, 0x28, 0x30, 0xad, 0x19, 0x28, 0x1b, 0x1e, 0x36,
+    0x3c, 0xb9, 0xeb, 0x20, 0x21, 0x6a, 0x03, 0x06, 0x2c, 0xdf, 0x31, 0x29, 0x4f, 0x09, 0x30, 0x1e,
+    0x20, 0x42, 0x13, 0xbf, 0x1f, 0x14, 0x2f, 0x25, 0x4b, 0x69, 0x03, 0x67, 0x34, 0x81, 0x6f, 0x18,
+    0x2b, 0x38, 0xb2, 0xab, 0x09, 0x38, 0xba, 0x66, 0x2c, 0x02, 0x29, 0x37, 0xc9, 0xdc, 0x2d, 0x2c,
+    0x01, 0x85, 0x2a, 0x29, 0x0e, 0x25, 0x24, 0x34, 0x49, 0x2f, 0x0e, 0x28, 0x39, 0x01, 0x3e, 0x74,
+    0xff, 0x16, 0xbf, 0xfd, 0x6c, 0x3d, 0x00, 0x03, 0x25, 0x19, 0x3d, 0x10, 0x02, 0x9c, 0x30, 0x38,
+    0x05, 0x27, 0xcd, 0xa1, 0x41, 0x20, 0x2a, 0xa4, 0x08, 0x01, 0x76, 0x25, 0xa0, 0x09, 0x39, 0xcf,
+    0x44, 0x32, 0xa6, 0x2b, 0x06, 0x0c, 0x25, 0x6a, 0x07, 0x03, 0x2a, 0x1a, 0x35, 0x34, 0x08, 0xdd,
+    0x2d, 0x1c, 0x78, 0x16, 0xf4, 0xf0, 0x11, 0x01, 0x3e, 0x7c, 0x13, 0x01, 0x2a, 0x74, 0x16, 0x13,
+    0x01, 0xb9, 0x08, 0x13, 0x14, 0x7d, 0x18, 0xe8, 0x33, 0x43, 0x49, 0x87, 0x66, 0x2d, 0x93, 0x46,
+    0x0e, 0x36, 0x35, 0x1b, 0xb5, 0x29, 0x57, 0x09, 0x27, 0x2a, 0xe8, 0x36, 0xd1, 0x06, 0x71, 0x40,
+    0x0b, 0x35, 0x1d, 0x90, 0x24, 0x3c, 0x7e, 0x37, 0x2b, 0xe6, 0x81, 0x2b, 0x6d, 0x94, 0x0b, 0x28,
+    0x22, 0x37, 0x1b, 0x32, 0x2e, 0x5f, 0x0e, 0x0c, 0x1f, 0x33, 0xcf, 0x38, 0xf8, 0x03, 0x4f, 0x5a,
+    0x1f, 0xdf, 0x09, 0xdb, 0x69, 0x21, 0x9d, 0xb3, 0x2a, 0x05, 0x2b, 0x3f, 0xc8, 0xb4, 0x1a, 0x5f,
+    0x0f, 0x36, 0x41, 0xa3, 0xd0, 0x30, 0x2c, 0x1f, 0x8c, 0x0b, 0x62, 0x16, 0x0c, 0x4f, 0x2d, 0xf4,
+    0xb6, 0x39, 0x55, 0x3e, 0x10, 0xa1, 0xc6, 0x2b, 0xc9, 0xd2, 0x0c, 0x1c, 0x94, 0x22, 0xc6, 0xb5,
+    0x12, 0x15, 0xb6, 0x1d, 0x01, 0xdf, 0x85, 0x1e, 0x41, 0x28, 0x28, 0x36, 0xfe, 0x3d, 0x39, 0x15,
+    0x31, 0x49, 0x9f, 0x1f, 0xf8, 0x3d, 0x10, 0x88, 0xb4, 0x2a, 0x33, 0x96, 0xca, 0x39, 0xb7, 0x6f,
+    0x9f, 0x12, 0x7b, 0x74, 0x6f, 0x02, 0x18, 0x0e, 0x15, 0xff, 0xe5, 0x2a, 0x55, 0x80, 0x17, 0x3f,
+    0x23, 0x78, 0x3f, 0x78, 0x03, 0x1e, 0x33, 0x44, 0x22, 0x28, 0x25, 0x2f, 0xcf, 0x26, 0x20, 0x30,
+    0xb2, 0x0c, 0x8d, 0x11, 0x2e, 0x1c, 0x2b, 0x0f, 0x46, 0x1a, 0x62, 0x17, 0xf6, 0xc8, 0x2b, 0x09,
+    0x0a, 0x1e, 0x0b, 0x4e, 0x38, 0xf4, 0xd8, 0x38, 0x3b, 0xbc, 0x11, 0xe3, 0x15, 0x00, 0x27, 0x20,
+    0x76, 0x33, 0x2a, 0x3f, 0x52, 0x20, 0xd5, 0x01, 0x08, 0xdb, 0x10, 0x38, 0x39, 0x00, 0x8e, 0xa3,
+    0x3d, 0x53, 0x0f, 0x10, 0x9b, 0x0a, 0xa5, 0xb9, 0xf1, 0x20, 0xa7, 0x20, 0x34, 0xa7, 0x1f, 0x2c,
+    0x08, 0x17, 0x29, 0x3d, 0x9a, 0x77, 0xb1, 0xf1, 0x3d, 0x34, 0x6c, 0x9f, 0xf0, 0xa4, 0x18, 0x31,
+    0x25, 0x21, 0x11, 0xea, 0x71, 0x37, 0x1b, 0xda, 0x2a, 0xd6, 0x39, 0x2d, 0x90, 0xf8, 0x2e, 0xd4,
+    0xb8, 0x38, 0x22, 0x24, 0x23, 0x2f, 0x04, 0x24, 0x2f, 0x36, 0xa0, 0x0a, 0x40, 0x30, 0x09, 0x1f,
+    0xe0, 0xa0, 0x5e, 0x35, 0x20, 0xea, 0x84, 0x02, 0x30, 0x38, 0xd0, 0xa6, 0x11, 0x5a, 0x2d, 0x26,
+    0x1d, 0x26, 0xbe, 0x10, 0x3c, 0xe7, 0xed, 0x75, 0x05, 0x55, 0x5b, 0x3f, 0x28, 0x38, 0x13, 0x1b,
+    0x04, 0x11, 0x20, 0x82, 0x2b, 0x1e, 0x69, 0x13, 0x02, 0x37, 0xaa, 0xae, 0x09, 0x0d, 0xd8, 0x33,
+    0x6b, 0x29, 0x1c, 0xd1, 0x2c, 0x07, 0x09, 0x06, 0xca, 0xa7, 0x29, 0x5c, 0x36, 0xc1, 0x13, 0x31,
+    0xbe, 0x1f, 0x3b, 0xa7, 0x24, 0x1e, 0xa6, 0x15, 0xd9, 0x05, 0x34, 0x0e, 0x25, 0x07, 0x09, 0x35,
+    0x1e, 0xc9, 0x05, 0x34, 0x69, 0x90, 0x07, 0x82, 0x28, 0x30, 0x3c, 0x16, 0x85, 0xc5, 0xd3, 0xf7,
+    0x60, 0x5a, 0x33, 0xdf, 0xab, 0xe5, 0x7f, 0xec, 0xc6, 0x26, 0x74, 0x26, 0x01, 0xca, 0x03, 0x26,
+    0x35, 0x3d, 0x03, 0xf3, 0xea, 0x26, 0x25, 0x8e, 0x0d, 0x04, 0x2b, 0x2e, 0x26, 0x2c, 0x01, 0x0f,
+    0xdd, 0x08, 0xcf, 0x2c, 0x21, 0x50, 0x16, 0x3a, 0x18, 0x0e, 0xd1, 0x07, 0x16, 0x00, 0x94, 0xb7,
+    0x00, 0x4e, 0x84, 0x13, 0x24, 0xaf, 0x47, 0x2f, 0x66, 0xf2, 0x3e, 0x2d, 0x02, 0x2e, 0xa2, 0x6e,
+    0x34, 0x4f, 0x2e, 0xbb, 0x74, 0xb6, 0x14, 0x17, 0xe7, 0xe9, 0x1b, 0xf5, 0xb7, 0x22, 0xf3, 0x28,
+    0xe1, 0x06, 0x4e, 0xe4, 0x5a, 0x39, 0x9e, 0x00, 0x5a, 0x4a, 0x04, 0x4b, 0xaa, 0x31, 0x31, 0x39,
+    0x1d, 0x1d, 0x02, 0x4a, 0x10, 0x04, 0x77, 0x06, 0xd2, 0x30, 0x16, 0x29, 0xb6, 0x33, 0x03, 0x13,
+    0xbc, 0x0d, 0x30, 0x2c, 0x30, 0x1c, 0x02, 0x34, 0x8d, 0x1c, 0x4d, 0x09, 0x81, 0x42, 0x9c, 0x02,
+    0x37, 0x10, 0x3e, 0x26, 0x12, 0x18, 0x1f, 0x03, 0x31, 0x31, 0x03, 0x2f, 0x25, 0x12, 0xf9, 0xf1,
+    0x3e, 0x0c, 0x23, 0x38, 0x23, 0x62, 0x24, 0x0f, 0x37, 0x30, 0x0c, 0x38, 0x23, 0x28, 0x22, 0x4a,
+    0xc7, 0x21, 0x00, 0x80, 0x56, 0x35, 0x76, 0x39, 0x20, 0x06, 0x19, 0x18, 0xf6, 0x1b, 0x72, 0x1e,
+    0x00, 0x17, 0x26, 0x06, 0xdb, 0x1e, 0x30, 0x32, 0x11, 0x3d, 0x34, 0x11, 0xb7, 0x2d, 0x09, 0x1a,
+    0x29, 0x0a, 0x2e, 0x17, 0x04, 0x18, 0x20, 0x32, 0x45, 0xab, 0x2b, 0x3d, 0xb6, 0x15, 0x01, 0xeb,
+    0xb1, 0x27, 0x9c, 0xa3, 0x1f, 0x02, 0x0b, 0x00, 0x1e, 0xca, 0x10, 0xe7, 0xfe, 0x31, 0xde, 0xe5,
+    0x0d, 0xe0, 0x35, 0xf9, 0x18, 0x17, 0x03, 0x02, 0x5a, 0xe4, 0x3e, 0xe6, 0xf8, 0x07, 0x15, 0x61,
+    0x28, 0x1f, 0x3f, 0xd6, 0x1a, 0x5b, 0x3b, 0xf6, 0x22, 0x70, 0x77, 0xa6, 0x00, 0xe9, 0x44, 0x3e,
+    0x69, 0x06, 0x24, 0x2b, 0x0c, 0x00, 0x2e, 0x0e, 0x55, 0xd2, 0xe7, 0x1e, 0x71, 0x3d, 0x0e, 0xd9,
+    0x1c, 0x24, 0x93, 0x3d, 0x6c, 0x1e, 0x39, 0x17, 0x27, 0x0a, 0x37, 0x1e, 0x0f, 0x7f, 0x05, 0xe2,
+    0xfa, 0x8f, 0x36, 0x04, 0x25, 0x35, 0x27, 0x03, 0x02, 0xb4, 0xa2, 0x06, 0x38, 0x0c, 0x20, 0x38,
+    0x65, 0x19, 0x2f, 0xb7, 0x31, 0x14, 0x95, 0x2a, 0xad, 0x6f, 0xd5, 0x2b, 0x00, 0xa9, 0x4b, 0x2c,
+    0x15, 0x1b, 0x23, 0x09, 0x3a, 0x3d, 0x14, 0x17, 0x7c, 0x38, 0x17, 0x0f, 0x3d, 0x0f, 0x1a, 0x3d,
+    0xce, 0x26, 0x2a, 0x18, 0x1d, 0x97, 0x35, 0x1e, 0x2c, 0x3b, 0x17, 0x3e, 0x86, 0x23, 0xf3, 0x7f,
+    0x00, 0xe5, 0x01, 0x0d, 0x3b, 0x06, 0x3e, 0x0c, 0x5c, 0x62, 0x81, 0xf1, 0x23, 0x32, 0xaa, 0x44,
+    0x18, 0xdf, 0x1f, 0xd2, 0x2f, 0x21, 0xb3, 0x28, 0x4b, 0x1e, 0x2a, 0x64, 0x2a, 0x34, 0x1b, 0x18,
+    0x2e, 0x04, 0xec, 0x12, 0xaa, 0xc4, 0x24, 0xc5, 0xfc, 0x11, 0x67, 0x06, 0x0e, 0x98, 0xff, 0x3f,
+    0xa2, 0x1f, 0x07, 0x7d, 0x07, 0x0d, 0xa6, 0x10, 0x53, 0xdb, 0x2b, 0x08, 0x06, 0x30, 0x9a, 0xc7,
+    0x34, 0x6d, 0x2a, 0xfa, 0x1c, 0x52, 0x24, 0x39, 0xe4, 0x25, 0x13, 0x31, 0x13, 0x23, 0x10, 0x1e,
+    0x31, 0x2d, 0x2c, 0xd0, 0x02, 0x36, 0x33, 0xd2, 0x0e, 0x69, 0x2b, 0x00, 0x6d, 0x32, 0x31, 0xe0,
+    0xde, 0x53, 0x66, 0x96, 0x20, 0x0c, 0x03, 0x0f, 0x25, 0xce, 0x9b, 0x0c, 0x8c, 0x57, 0x02, 0x38,
+    0x35, 0x35, 0x59, 0x24, 0x00, 0x0d, 0xa1, 0x01, 0x22, 0x4b, 0x25, 0x32, 0xfd, 0x44, 0x00, 0x61,
+    0x2c, 0x1b, 0x06, 0xf7, 0x15, 0x0a, 0x85, 0x02, 0x57, 0x22, 0x09, 0xe3, 0x1d, 0x0d, 0x1d, 0x00,
+    0x0b, 0x37, 0xd1, 0x00, 0x28, 0xe6, 0x3f, 0x24, 0x26, 0x9e, 0x25, 0x11, 0xf7, 0xb8, 0xea, 0x29,
+    0xbe, 0x3b, 0xdb, 0x1d, 0x05, 0x1a, 0x3e, 0x26, 0x83, 0x60, 0x67, 0x35, 0x20, 0x89, 0xf4, 0x14,
+    0x0b, 0x06, 0xf9, 0x0d, 0x12, 0x19, 0x29, 0x97, 0x34, 0x06, 0xd9, 0x2a, 0x00, 0x1a, 0xcd, 0xe6,
+    0x39, 0x73, 0xd8, 0x23, 0x0a, 0x11, 0x17, 0x15, 0x60, 0x0a, 0x08, 0xf6, 0x48, 0x3e, 0x3c, 0xd5,
+    0x9c, 0x20, 0x17, 0x59, 0x13, 0xf7, 0x15, 0xae, 0x8a, 0xb9, 0x00, 0x12, 0x5c, 0x12, 0x03, 0x34,
+    0x47, 0x18, 0x34, 0xc3, 0x8d, 0x19, 0x21, 0xa8, 0x22, 0x73, 0x95, 0x02, 0x00, 0x20, 0x13, 0x1c,
+    0x7c, 0xff, 0x0e, 0x2f, 0x37, 0x25, 0xc7, 0x05, 0x1c, 0x97, 0xb8, 0x32, 0x8a, 0x70, 0x38, 0xa9,
+    0x16, 0x31, 0x28, 0x0d, 0x75, 0x21, 0x2b, 0xdd, 0x2b, 0xb0, 0x54, 0x18, 0x27, 0x2e, 0xb0, 0x5a,
+    0x3d, 0x27, 0x68, 0xa2, 0xd6, 0x2e, 0xfa, 0x19, 0x16, 0xd5, 0x03, 0x4c, 0x11, 0xf1, 0x13, 0x3b,
+    0x32, 0x17, 0x38, 0x18, 0x0b, 0x1e, 0x3b, 0xc7, 0x25, 0x31, 0x0c, 0x05, 0x92, 0x9e, 0xa1, 0x0e,
+    0x18, 0x3a, 0x26, 0x85, 0x72, 0x86, 0xdf, 0x30, 0x1a, 0x10, 0x9b, 0x16, 0x6d, 0x2e, 0x1c, 0x0c,
+    0x7a, 0x02, 0x24, 0x26, 0x19, 0x33, 0x24, 0x72, 0xcf, 0x21, 0x1e, 0x2f, 0x39, 0x33, 0x16, 0x83,
+    0xad, 0x2b, 0x88, 0xed, 0xce, 0x15, 0xb9, 0x15, 0x08, 0xe8, 0x19, 0x00, 0x2b, 0x61, 0x1d, 0x38,
+    0x3f, 0x07, 0x18, 0x62, 0x08, 0x3c, 0x29, 0x12, 0x25, 0x39, 0x11, 0xab, 0xc1, 0x09, 0x3d, 0xe8,
+    0x90, 0x07, 0x55, 0x1b, 0x17, 0x94, 0xaa, 0x39, 0x22, 0xb0, 0xee, 0x2a, 0x3e, 0xd7, 0xbe, 0x1b,
+    0x70, 0x1b, 0x0a, 0xba, 0x8b, 0x49, 0x2c, 0x1d, 0x11, 0x0c, 0x2e, 0xd9, 0x9d, 0xe8, 0x3a, 0x27,
+    0xc6, 0x25, 0x3f, 0x26, 0xfb, 0xb3, 0x3a, 0x0c, 0x38, 0x95, 0x08, 0x36, 0x1c, 0x44, 0x00, 0x10,
+    0x79, 0x22, 0x39, 0x37, 0x3c, 0xa4, 0x01, 0x35, 0x0b, 0x86, 0x1d, 0x2b, 0x20, 0x6c, 0x10, 0x01,
+    0x0d, 0xdf, 0x31, 0x13, 0x24, 0xea, 0x60, 0x0f, 0x92, 0xe8, 0x3d, 0x23, 0x98, 0xcb, 0x34, 0x17,
+    0x1c, 0xca, 0x39, 0x0c, 0x10, 0xc0, 0x05, 0xe2, 0x4e, 0x12, 0x2a, 0x29, 0x9b, 0x28, 0x1c, 0x35,
+    0x09, 0x46, 0xad, 0xa9, 0x1c, 0x70, 0xc2, 0x19, 0xe9, 0x86, 0x82, 0x12, 0x2c, 0xfb, 0x0b, 0x3a,
+    0x4c, 0x14, 0x0f, 0x30, 0xd2, 0x36, 0xa1, 0xe2, 0x0e, 0x36, 0x11, 0xdd, 0x04, 0xdb, 0xd3, 0x29,
+    0xf3, 0x11, 0xd9, 0x31, 0x17, 0x21, 0xa6, 0x49, 0x10, 0x1f, 0xfe, 0x25, 0x1a, 0x32, 0x07, 0x17,
+    0x2e, 0x05, 0x96, 0xc3, 0x71, 0xc0, 0x27, 0x03, 0xcf, 0x2b, 0x01, 0x2c, 0x2e, 0x5e, 0x0c, 0x22,
+    0x3b, 0x1c, 0x11, 0x3d, 0x0e, 0x70, 0x90, 0x15, 0x00, 0x03, 0x45, 0x5e, 0x36, 0x8c, 0x6c, 0xcf,
+    0x02, 0x1c, 0x14, 0x30, 0x34, 0xd0, 0x18, 0xe8, 0x38, 0x00, 0x83, 0x23, 0x25, 0x32, 0x18, 0x3c,
+    0x57, 0x59, 0x35, 0x2c, 0xfb, 0x4d, 0x3d, 0xae, 0xb7, 0x27, 0x1f, 0x11, 0x0a, 0x3d, 0x8c, 0x21,
+    0x48, 0x0e, 0x08, 0x2b, 0x12, 0x60, 0x07, 0x29, 0xf4, 0x25, 0x23, 0x2b, 0x45, 0x1b, 0x3e, 0x00,
+    0x3f, 0x17, 0x22, 0x6f, 0xa5, 0x35, 0x14, 0x20, 0x28, 0x3b, 0x26, 0x14, 0x27, 0xcb, 0x0c, 0x90,
+    0x1e, 0x32, 0x34, 0x32, 0x35, 0x3e, 0x13, 0xaa, 0xcc, 0x1d, 0x04, 0xea, 0xdb, 0xd7, 0x2d, 0x85,
+    0xb3, 0x81, 0xb2, 0x0b, 0x58, 0x46, 0x7d, 0x3c, 0x50, 0x36, 0x15, 0x9d, 0x8e, 0x33, 0x11, 0x0b,
+    0x1e, 0x30, 0x34, 0x08, 0x3e, 0x18, 0x41, 0x15, 0x22, 0x22, 0xe0, 0x69, 0x20, 0xb2, 0x2d, 0x1d,
+    0x08, 0x26, 0x6b, 0x27, 0x4e, 0x08, 0x02, 0x21, 0x1c, 0xc8, 0x48, 0x3b, 0x87, 0x06, 0x17, 0x42,
+    0x21, 0x18, 0xd3, 0xfe, 0x5f, 0x4a, 0x3c, 0x05, 0x30, 0x0c, 0x34, 0xb4, 0x1a, 0x14, 0x15, 0x13,
+    0x77, 0x68, 0x27, 0xbf, 0xa2, 0x34, 0x2b, 0xd6, 0x28, 0x37, 0x57, 0x7b, 0x13, 0x54, 0x17, 0x1c,
+    0x31, 0x28, 0x1c, 0x24, 0xb1, 0x03, 0x06, 0x19, 0x2c, 0xfa, 0xd4, 0x23, 0x63, 0xe6, 0x1b, 0x1c,
+    0x02, 0x08, 0x24, 0xae, 0x93, 0x10, 0x2e, 0xf4, 0x00, 0x6b, 0xb5, 0xcc, 0x10, 0x1f, 0x26, 0x5d,
+    0x0b, 0x9c, 0x2e, 0x88, 0xe8, 0x02, 0x5c, 0x01, 0x38, 0x26, 0x2b, 0x19, 0x9d, 0x38, 0x9f, 0x2c,
+    0xac, 0x0f, 0x40, 0xa8, 0x1e, 0x32, 0x24, 0x8f, 0xd6, 0x29, 0x27, 0x4f, 0x26, 0x9f, 0xcd, 0x15,
+    0x49, 0x16, 0x03, 0x2d, 0x35, 0x01, 0x19, 0xb2, 0x3b, 0x0f, 0x3e, 0x6e, 0x1f, 0xd9, 0x53, 0x5e,
+    0x75, 0x78, 0x74, 0x16, 0x16, 0x09, 0x35, 0xba, 0x7f, 0x73, 0x12, 0xa3, 0x6d, 0x2e, 0x3d, 0x1c,
+    0x17, 0x39, 0x5d, 0x1e, 0x3a, 0x2d, 0x00, 0x32, 0x9e, 0xef, 0x10, 0xd4, 0xb2, 0x66, 0x0d, 0x6c,
+    0xff, 0xcf, 0xfd, 0x97, 0x07, 0xa0, 0xd4, 0x29, 0x36, 0x43, 0x0b, 0x95, 0x2e, 0x3a, 0x17, 0x19,
+    0x1b, 0x11, 0x2a, 0x9d, 0x8e, 0x27, 0x3b, 0x9a, 0x28, 0x7c, 0x42, 0x55, 0x0f, 0x30, 0xd3, 0xa4,
+    0x29, 0x0a, 0xc1, 0x21, 0x13, 0x06, 0xd3, 0x18, 0x05, 0x39, 0x04, 0x95, 0x90, 0x53, 0x1b, 0xa5,
+    0x14, 0xe2, 0x0b, 0x3e, 0x2d, 0x20, 0x30, 0x6b, 0xd1, 0x4d, 0x1e, 0x18, 0x02, 0x04, 0x7d, 0x01,
+    0x27, 0x2f, 0x0f, 0xa6, 0x16, 0xc2, 0x1a, 0x17, 0x2a, 0x10, 0x10, 0xd4, 0x0d, 0x3c, 0x3b, 0x1a,
+    0x07, 0x16, 0x35, 0x22, 0x2b, 0x12, 0xce, 0xa3, 0x2b, 0x30, 0x21, 0x76, 0x07, 0x24, 0x11, 0x03,
+    0x34, 0x55, 0x56, 0x27, 0x09, 0x33, 0x1b, 0x3b, 0x2e, 0x12, 0x29, 0x3d, 0x6a, 0x04, 0x43, 0x0f,
+    0xf5, 0x33, 0x34, 0xa2, 0x70, 0x2e, 0x23, 0x19, 0x27, 0xc9, 0x51, 0x06, 0x38, 0x71, 0x12, 0x39,
+    0x0a, 0xd6, 0x05, 0x1b, 0x48, 0x9a, 0x00, 0x06, 0x33, 0xdb, 0xf4, 0xce, 0x21, 0x09, 0x18, 0x2f,
+    0x2e, 0x44, 0x06, 0xe7, 0xba, 0x33, 0xa4, 0x0b, 0x2c, 0x0a, 0x79, 0x06, 0xc9, 0x1e, 0x10, 0x30,
+    0x0a, 0x29, 0x13, 0x29, 0xee, 0xe1, 0x15, 0x26, 0xa2, 0x2d, 0xea, 0xfe, 0x36, 0x55, 0x17, 0x09,
+    0x3c, 0xac, 0x1a, 0x40, 0x3a, 0x74, 0xef, 0xc6, 0x3c, 0x0d, 0x16, 0x07, 0x34, 0xbe, 0x38, 0x01,
+    0x14, 0xab, 0x38, 0x5f, 0x27, 0x3c, 0xc2, 0x00, 0x26, 0x67, 0x13, 0x14, 0xf1, 0x37, 0x38, 0x38,
+    0x30, 0x97, 0x18, 0x15, 0xca, 0x63, 0x07, 0x25, 0x0b, 0x2b, 0x0e, 0x09, 0x27, 0x79, 0x0b, 0xf4,
+    0x82, 0x53, 0xb3, 0x06, 0x2f, 0x03, 0x60, 0x23, 0x99, 0x3b, 0xbe, 0x0f, 0x1a, 0x56, 0x19, 0x29,
+    0xa9, 0x33, 0x22, 0xcf, 0x2a, 0x17, 0x08, 0x34, 0x96, 0x72, 0x1b, 0xa5, 0x1a, 0x02, 0x95, 0xfc,
+    0x0a, 0x16, 0x31, 0x21, 0x25, 0xb3, 0x00, 0x83, 0x1b, 0x61, 0xe8, 0xc4, 0x26, 0x2a, 0x2f, 0x16,
+    0xaa, 0x2c, 0xb9, 0x0e, 0x29, 0x32, 0x2d, 0x7f, 0xd7, 0x28, 0x3b, 0x00, 0xe1, 0x87, 0xd8, 0x09,
+    0x12, 0x80, 0x2f, 0xad, 0x0f, 0xe9, 0x10, 0x39, 0xff, 0x23, 0x04, 0x37, 0x12, 0x04, 0x06, 0x33,
+    0x5a, 0x87, 0x9e, 0x18, 0x0b, 0x39, 0x35, 0x2e, 0x20, 0xab, 0x0c, 0x11, 0x38, 0xa9, 0x10, 0x4d,
+    0x27, 0x15, 0x0b, 0x0c, 0xa0, 0x17, 0x3b, 0xc5, 0x02, 0xdc, 0xd0, 0xb7, 0xae, 0x24, 0x4a, 0x06,
+    0x3c, 0x04, 0xd8, 0x1e, 0xde, 0x24, 0x0b, 0x1b, 0x2a, 0x0d, 0x08, 0x12, 0xd3, 0x2b, 0x07, 0x16,
+    0x34, 0x0d, 0xf2, 0x22, 0x01, 0xd5, 0x0f, 0x1c, 0x33, 0x16, 0xee, 0xb5, 0xcb, 0x2a, 0xc8, 0x0c,
+    0xe2, 0x3e, 0x3c, 0x8b, 0x0e, 0x4a, 0x38, 0x2b, 0x1f, 0xf4, 0x2b, 0xe1, 0x9d, 0x1c, 0x9c, 0xb7,
+    0xe4, 0x1a, 0x34, 0x35, 0x00, 0x3e, 0x46, 0xda, 0xa9, 0x05, 0x27, 0x94, 0xbe, 0x04, 0xa4, 0x26,
+    0x60, 0x14, 0x2b, 0x07, 0x36, 0x15, 0xe9, 0x8a, 0x09, 0x29, 0x3a, 0x41, 0x56, 0x58, 0x02, 0x6e,
+    0x3e, 0x07, 0xfa, 0xf8, 0x19, 0x06, 0xac, 0x0f, 0x26, 0x3c, 0x43, 0x39, 0xf6, 0x12, 0x83, 0x82,
+    0x56, 0x05, 0x1e, 0x1f, 0xe9, 0x8d, 0x21, 0x10, 0x0d, 0xc9, 0x3a, 0x13, 0x10, 0xcf, 0x20, 0xa4,
+    0x0f, 0x9b, 0x3c, 0x31, 0xf1, 0x05, 0x01, 0x1a, 0x2e, 0x2b, 0x06, 0x32, 0x13, 0x03, 0x18, 0x05,
+    0xd8, 0x3c, 0x4a, 0x20, 0x0a, 0x26, 0x0a, 0x36, 0x22, 0x99, 0xfe, 0x41, 0xe7, 0x2d, 0x10, 0x10,
+    0xc2, 0x16, 0x34, 0x0d, 0x3f, 0x3c, 0x09, 0x0e, 0xda, 0x15, 0x0e, 0x2b, 0x39, 0xaf, 0x53, 0x6e,
+    0x27, 0x95, 0x34, 0x22, 0x14, 0x83, 0x1a, 0x3f, 0x05, 0x09, 0xfe, 0xbf, 0x2a, 0x00, 0x3d, 0x3a,
+    0x37, 0x44, 0xe7, 0x37, 0x22, 0x25, 0x3b, 0x78, 0xdb, 0x23, 0x15, 0x87, 0xfb, 0xd1, 0x8b, 0x14,
+    0xa0, 0x75, 0x0e, 0xfd, 0x24, 0x3a, 0x5f, 0x07, 0x24, 0x04, 0x74, 0xba, 0x21, 0xf4, 0x3f, 0xdc,
+    0x28, 0xaf, 0x15, 0x36, 0x17, 0xbc, 0x23, 0x23, 0x22, 0xbe, 0x24, 0x38, 0x91, 0x99, 0x45, 0x32,
+    0x7f, 0x19, 0x0a, 0xeb, 0xa7, 0xa6, 0x2a, 0x15, 0x9e, 0x1d, 0x31, 0x18, 0x1c, 0x13, 0x36, 0x3e,
+    0x3b, 0x2f, 0x3c, 0x2a, 0x11, 0xc0, 0xfe, 0x3f, 0x3a, 0x1d, 0x2c, 0xd6, 0x1b, 0x3c, 0x04, 0xbc,
+    0xa8, 0x01, 0x22, 0x13, 0x35, 0x39, 0x3b, 0xc5, 0x06, 0x43, 0xce, 0x20, 0x37, 0x39, 0x1b, 0xd1,
+    0xdc, 0x2e, 0x18, 0x3b, 0x32, 0x41, 0x3b, 0x35, 0x22, 0x3b, 0x36, 0xf7, 0x2f, 0xa3, 0x3a, 0x02,
+    0x64, 0x2c, 0x30, 0x4e, 0x37, 0x2a, 0x03, 0xad, 0x0b, 0x2a, 0xf3, 0x21, 0x3c, 0x21, 0x24, 0x2a,
+    0x2b, 0x6b, 0x38, 0x4b, 0x3c, 0x89, 0x55, 0x14, 0x3f, 0x84, 0x0f, 0x0d, 0x08, 0x05, 0x64, 0x29,
+    0x2e, 0xa0, 0x25, 0x00, 0x65, 0x2d, 0x8d, 0x0a, 0x0e, 0x38, 0x25, 0x13, 0x09, 0x1c, 0x03, 0x33,
+    0x7a, 0xd7, 0x0b, 0xc3, 0x0f, 0xd1, 0x36, 0x16, 0x27, 0x2c, 0xe1, 0x0a, 0xb7, 0x84, 0x48, 0x3f,
+    0xea, 0x26, 0x68, 0x34, 0x2e, 0x7b, 0x1f, 0x5c, 0x8e, 0xe1, 0x59, 0x28, 0xc7, 0x07, 0x06, 0xb7,
+    0x38, 0xe3, 0x48, 0x4e, 0x21, 0x3c, 0x29, 0x05, 0x1a, 0x9e, 0xc9, 0x33, 0x78, 0x22, 0x10, 0xb7,
+    0xdd, 0x1e, 0xaa, 0x12, 0x22, 0x1b, 0x09, 0x30, 0x39, 0xf1, 0x25, 0x1d, 0x0f, 0x25, 0xf4, 0xfa,
+    0x37, 0x0d, 0x30, 0x65, 0x18, 0x7b, 0x1f, 0x57, 0xce, 0xec, 0x77, 0xc8, 0x60, 0x2f, 0xbd, 0x33,
+    0x90, 0xaf, 0x3a, 0x74, 0x66, 0x12, 0x15, 0xbb, 0x14, 0xef, 0x1c, 0xc2, 0x65, 0xfc, 0x76, 0x8a,
+    0x1f, 0x21, 0x27, 0x32, 0x09, 0x95, 0x26, 0x6f, 0x1a, 0x3b, 0xcf, 0x48, 0x28, 0x0c, 0x18, 0x1d,
+    0x3e, 0x32, 0x35, 0x37, 0x6e, 0xba, 0x2f, 0x25, 0x92, 0x0c, 0x39, 0x01, 0x15, 0xb4, 0xe7, 0x31,
+    0x63, 0x5b, 0x90, 0x2a, 0x26, 0x31, 0x44, 0x3b, 0x2f, 0x1a, 0xae, 0x35, 0x05, 0xbe, 0x41, 0x02,
+    0x3d, 0x15, 0x9c, 0x22, 0xe2, 0xb4, 0x09, 0x6c, 0x6b, 0x98, 0x08, 0x4d, 0xba, 0xdd, 0x15, 0x24,
+    0x83, 0x10, 0xb3, 0x24, 0x2a, 0x1b, 0x0f, 0xc9, 0xe4, 0xf4, 0x19, 0xc7, 0x17, 0xf3, 0x08, 0x3b,
+    0x2b, 0xff, 0x3a, 0x30, 0xed, 0x2d, 0x61, 0x3f, 0xa6, 0x10, 0x2f, 0x26, 0x98, 0x3b, 0x37, 0x13,
+    0x3e, 0x3b, 0x6a, 0xfa, 0x0f, 0x0e, 0x23, 0x3a, 0x37, 0x71, 0x15, 0x13, 0x13, 0x57, 0xff, 0x26,
+    0x14, 0x70, 0x5d, 0x06, 0x38, 0x03, 0xd1, 0x04, 0x80, 0x59, 0xe3, 0x3f, 0x50, 0x02, 0x5f, 0x05,
+    0xa5, 0x17, 0x02, 0x5b, 0x19, 0x73, 0x6c, 0x3e, 0x3a, 0x9f, 0x29, 0x0c, 0x7b, 0xc5, 0x7f, 0x4a,
+    0xe2, 0x28, 0x33, 0x18, 0x04, 0x3f, 0x10, 0xc7, 0x5e, 0xbe, 0xff, 0x2e, 0x7e, 0x0e, 0x2d, 0x13,
+    0x1b, 0x28, 0xca, 0x16, 0x16, 0x14, 0xd0, 0x39, 0x25, 0xb3, 0x13, 0x34, 0x25, 0x1a, 0x70, 0x31,
+    0x04, 0x16, 0x4d, 0xb4, 0x02, 0xd0, 0x77, 0x02, 0x19, 0x93, 0x6e, 0x0a, 0x0e, 0xc7, 0x27, 0x21,
+    0x04, 0xeb, 0x1a, 0x25, 0x89, 0x37, 0x3a, 0x20, 0x08, 0x5e, 0x2c, 0x16, 0x32, 0x2e, 0x08, 0x81,
+    0x0c, 0x24, 0xb0, 0x74, 0x2f, 0xf1, 0x2a, 0x92, 0x37, 0x2e, 0x1a, 0x03, 0x16, 0x2d, 0x3f, 0x3b,
+    0x17, 0x1a, 0xfe, 0x8c, 0x1f, 0x09, 0x85, 0x0f, 0x50, 0x57, 0x31, 0x01, 0x0e, 0x12, 0x0a, 0xf5,
+    0x32, 0x21, 0x19, 0xa4, 0xae, 0x22, 0x29, 0x1d, 0x23, 0xd2, 0x64, 0x71, 0x2f, 0x1e, 0x28, 0x3a,
+    0xaa, 0x3b, 0x20, 0x76, 0x26, 0x29, 0x0b, 0x2f, 0x39, 0xc9, 0x04, 0x31, 0x7d, 0x22, 0x35, 0x63,
+    0x79, 0x1a, 0x07, 0x10, 0x3f, 0x3b, 0x19, 0x33, 0x37, 0x41, 0x70, 0x11, 0x04, 0x1d, 0x29, 0xb6,
+    0x37, 0x00, 0x35, 0x06, 0x30, 0x2e, 0x75, 0x05, 0x05, 0x38, 0x0c, 0x94, 0x95, 0xe3, 0x52, 0x2f,
+    0x53, 0x00, 0x7e, 0x0b, 0x42, 0x34, 0x55, 0x32, 0x38, 0xbe, 0xe3, 0x4d, 0x0a, 0x3f, 0x23, 0x88,
+    0x04, 0xa3, 0xed, 0x3c, 0x7f, 0x23, 0x23, 0x76, 0x15, 0x1b, 0x41, 0x11, 0x02, 0xdb, 0xa9, 0x36,
+    0x3d, 0xb3, 0x19, 0x2d, 0x37, 0x03, 0x23, 0x15, 0x7f, 0x98, 0xc2, 0x70, 0x1e, 0x3b, 0xbf, 0x81,
+    0x10, 0x3c, 0x08, 0x32, 0x03, 0x12, 0x23, 0xfb, 0x36, 0xb6, 0x1d, 0x04, 0x03, 0xa1, 0x39, 0x1b,
+    0xef, 0x3d, 0xc1, 0xe0, 0x3e, 0x38, 0x4f, 0xd5, 0x29, 0x1e, 0x24, 0x0b, 0x0c, 0x1c, 0x0d, 0xf0,
+    0x3d, 0x06, 0x14, 0x4e, 0x0b, 0xf8, 0xb0, 0x16, 0xc9, 0x62, 0x03, 0x6d, 0x0f, 0x1b, 0x13, 0x31,
+    0x2c, 0x18, 0x03, 0x3c, 0x69, 0x35, 0x13, 0xf6, 0x9c, 0x0c, 0x27, 0x3d, 0x03, 0x15, 0x3e, 0xeb,
+    0x36, 0x3e, 0x01, 0x1d, 0x2c, 0x81, 0xae, 0x0e, 0x27, 0x08, 0x3d, 0x42, 0x2b, 0x16, 0xa5, 0x0b,
+    0x29, 0x0b, 0x3a, 0xe6, 0x49, 0x35, 0x48, 0x01, 0xf6, 0xe8, 0x32, 0x20, 0x26, 0xb9, 0x14, 0x49,
+    0x55, 0x07, 0x55, 0x0c, 0x39, 0xec, 0x3f, 0x26, 0x25, 0x17, 0x0e, 0x0d, 0x00, 0x64, 0xf0, 0x17,
+    0x1f, 0x97, 0x3e, 0x13, 0x1c, 0x11, 0x25, 0x0f, 0x0c, 0x20, 0x17, 0x5b, 0x57, 0x96, 0x1d, 0x2d,
+    0x2d, 0x62, 0xc1, 0x19, 0x29, 0x0f, 0x0a, 0x1e, 0xc5, 0xad, 0x04, 0x6d, 0x0a, 0x20, 0x58, 0xbf,
+    0xb6, 0x3b, 0x0d, 0xf0, 0x76, 0x9f, 0x26, 0x7a, 0x89, 0x0c, 0x2b, 0x02, 0x7a, 0xc5, 0x0f, 0x19,
+    0x02, 0x03, 0x61, 0x74, 0x36, 0x0e, 0x80, 0x27, 0xe0, 0xb5, 0xac, 0xac, 0x63, 0xf8, 0x26, 0x81,
+    0x64, 0x1c, 0xec, 0xdb, 0xf1, 0x0e, 0x8f, 0x05, 0x0c, 0xce, 0x18, 0x36, 0x32, 0xcd, 0x4b, 0x17,
+    0xc4, 0x2a, 0x3b, 0x2b, 0x53, 0x7e, 0x34, 0x24, 0x0f, 0x0b, 0x04, 0x30, 0x10, 0x61, 0x04, 0xa8,
+    0x2e, 0x9b, 0x2e, 0x04, 0x1e, 0xdb, 0x13, 0xe6, 0x33, 0x08, 0x1e, 0x73, 0x3b, 0x45, 0x3a, 0x02,
+    0x23, 0xb0, 0x05, 0x06, 0x09, 0x00, 0x39, 0x4e, 0x3e, 0x31, 0x20, 0x06, 0xe6, 0x10, 0x10, 0xa6,
+    0xf7, 0x71, 0x05, 0x02, 0xfe, 0x05, 0x04, 0x36, 0x2f, 0x3f, 0x72, 0x2c, 0x38, 0x2f, 0x2c, 0x03,
+    0x10, 0x37, 0x30, 0x03, 0x59, 0x3a, 0x7a, 0x1e, 0x5b, 0xee, 0x11, 0x2c, 0x9f, 0xba, 0x18, 0xc2,
+    0x04, 0x0c, 0x25, 0x1e, 0x3b, 0xdf, 0x4a, 0x1e, 0x26, 0x09, 0x87, 0x06, 0x27, 0x12, 0x3f, 0x08,
+    0x4d, 0x2b, 0x21, 0x8d, 0x2d, 0x17, 0x33, 0x3c, 0x26, 0x3a, 0xe0, 0x1a, 0xe7, 0xbf, 0x0a, 0xb1,
+    0x0d, 0x35, 0x1b, 0x29, 0x06, 0x35, 0x05, 0x24, 0x25, 0x12, 0x22, 0x34, 0x17, 0x89, 0x0d, 0x00,
+    0x0b, 0x0f, 0x1e, 0x09, 0x23, 0x1c, 0x53, 0x08, 0x22, 0x14, 0x14, 0x01, 0x5f, 0x27, 0x25, 0x95,
+    0x30, 0x03, 0x63, 0xfb, 0x0b, 0x5f, 0x06, 0x15, 0x05, 0xae, 0x9f, 0xe0, 0x24, 0x2d, 0x20, 0xdc,
+    0x33, 0x3c, 0x72, 0x20, 0xef, 0x2f, 0x0c, 0x36, 0x0f, 0xa4, 0x21, 0x3e, 0x02, 0x9f, 0xf3, 0xf0,
+    0x8a, 0x38, 0x13, 0x4a, 0x15, 0x20, 0xbc, 0x1e, 0xc5, 0x08, 0x47, 0x22, 0x08, 0x1f, 0x3f, 0x2e,
+    0x0c, 0x01, 0x2c, 0x3f, 0x47, 0x15, 0xbd, 0x1f, 0x1c, 0x51, 0x08, 0x16, 0x17, 0xf3, 0x9f, 0x2c,
+    0x6f, 0x3f, 0x36, 0xcb, 0xa4, 0xa2, 0x04, 0x21, 0x32, 0xac, 0x38, 0x05, 0x3f, 0x09, 0x42, 0x02,
+    0x57, 0xea, 0x1e, 0xe1, 0x98, 0x30, 0x02, 0x39, 0x3e, 0x11, 0x01, 0x38, 0xca, 0x25, 0x2c, 0x2d,
+    0xba, 0x26, 0x0e, 0xc1, 0x0e, 0x49, 0x3e, 0x11, 0x26, 0x0d, 0x37, 0x73, 0x10, 0xcb, 0x32, 0x18,
+    0xeb, 0xf3, 0x2d, 0x1c, 0x7e, 0x18, 0x1c, 0x2e, 0x09, 0xa8, 0x13, 0x30, 0x30, 0x26, 0xd9, 0xec,
+    0x07, 0x78, 0x0b, 0x1f, 0x48, 0x2a, 0xbc, 0xc7, 0x48, 0x33, 0xb2, 0xe1, 0xaa, 0x0a, 0x33, 0x95,
+    0x24, 0xaf, 0x2d, 0xe6, 0xb5, 0x14, 0x0d, 0x1b, 0x93, 0x00, 0xd7, 0x23, 0x65, 0x0e, 0x23, 0x02,
+    0xeb, 0xdb, 0x38, 0xa0, 0xea, 0x39, 0x9e, 0xf2, 0x1d, 0xff, 0x0a, 0x0d, 0x38, 0x4e, 0x1c, 0x3d,
+    0x18, 0xdf, 0x32, 0xc2, 0x03, 0x1a, 0xae, 0x44, 0x49, 0x38, 0xe4, 0x28, 0x4b, 0x11, 0x07, 0x40,
+    0x9d, 0xc1, 0x9e, 0x70, 0x5f, 0x16, 0xfb, 0x66, 0xda, 0x2c, 0x94, 0x0d, 0x96, 0x44, 0x73, 0x15,
+    0x2f, 0xfe, 0x2b, 0x20, 0x25, 0x25, 0x25, 0x1c, 0x35, 0x22, 0x86, 0x15, 0xa9, 0x1d, 0x23, 0x04,
+    0x19, 0x27, 0x01, 0x53, 0x0f, 0x05, 0xe0, 0x20, 0x2b, 0xff, 0x0a, 0xb8, 0x4f, 0x25, 0x16, 0x18,
+    0x30, 0xc1, 0x2c, 0x2c, 0xbd, 0x91, 0x44, 0x54, 0x96, 0x22, 0x04, 0x9c, 0x05, 0x0a, 0x0f, 0x55,
+    0x25, 0x0d, 0xf3, 0x24, 0xd5, 0x1a, 0x23, 0x09, 0xd9, 0x11, 0xeb, 0x12, 0x12, 0x15, 0x5a, 0x30,
+    0x19, 0x1a, 0xcf, 0x89, 0x1c, 0x3a, 0x63, 0x21, 0xd1, 0x30, 0x32, 0xca, 0x29, 0xab, 0x21, 0xc0,
+    0x47, 0x85, 0x16, 0xc7, 0x34, 0x16, 0x1f, 0x6c, 0x11, 0x05, 0x33, 0xf2, 0x17, 0xa9, 0x36, 0x36,
+    0x1d, 0x22, 0x00, 0x83, 0x25, 0x36, 0xd1, 0x06, 0x3c, 0x12, 0x2a, 0x2e, 0x3e, 0x29, 0x0d, 0x81,
+    0x2f, 0x70, 0x0d, 0x0f, 0x22, 0x27, 0xc1, 0x2b, 0x13, 0x57, 0x36, 0x39, 0x9f, 0x35, 0xde, 0x27,
+    0x25, 0xe6, 0x6d, 0xae, 0x6d, 0x60, 0x8b, 0x32, 0xd9, 0x1d, 0x24, 0xab, 0x14, 0x16, 0x09, 0xf3,
+    0x28, 0xaa, 0x3e, 0xe1, 0x3f, 0xda, 0xcd, 0x0f, 0x02, 0x32, 0x2a, 0x1b, 0xb3, 0x29, 0xed, 0x23,
+    0xd9, 0x1c, 0x1b, 0x96, 0xa8, 0x04, 0x07, 0xa9, 0xe1, 0x1b, 0x12, 0xab, 0x23, 0xc2, 0x08, 0x8f,
+    0x24, 0x13, 0xf6, 0x04, 0xa1, 0x14, 0x1b, 0x1c, 0x1e, 0x12, 0x92, 0x24, 0xe7, 0x36, 0xc7, 0xe8,
+    0xd6, 0x10, 0x10, 0xa7, 0x95, 0x9b, 0x78, 0x1d, 0x08, 0x00, 0x24, 0x31, 0x28, 0x27, 0x3d, 0x10,
+    0x6b, 0x22, 0x06, 0x12, 0x04, 0xcc, 0x1a, 0x2a, 0xb6, 0x18, 0x38, 0x4c, 0xfa, 0x12, 0x0d, 0x38,
+    0x3d, 0x14, 0xca, 0x25, 0xd0, 0x27, 0x78, 0xa7, 0xe3, 0xdb, 0x22, 0x57, 0xd8, 0x0f, 0xc5, 0x63,
+    0x10, 0xd5, 0x18, 0x25, 0x81, 0x3d, 0x45, 0x4f, 0x09, 0x89, 0x3e, 0x90, 0xce, 0xbb, 0x36, 0x8f,
+    0xac, 0x26, 0x28, 0x14, 0x37, 0xe5, 0x1e, 0x20, 0xab, 0x4b, 0xcb, 0x14, 0x1b, 0x6a, 0x87, 0x1b,
+    0x2d, 0xf7, 0x33, 0x2b, 0x83, 0xed, 0x09, 0x07, 0x02, 0x0c, 0x5f, 0x01, 0xb0, 0x0b, 0x09, 0x2d,
+    0x24, 0xc4, 0x86, 0xe2, 0x23, 0x01, 0x27, 0x23, 0x3c, 0x0a, 0x1d, 0x08, 0x94, 0x3b, 0x11, 0x11,
+    0x4e, 0x47, 0xd4, 0x0f, 0x00, 0x0b, 0x36, 0x39, 0x7b, 0x13, 0x48, 0x10, 0x90, 0x0f, 0xe5, 0xa8,
+    0x1e, 0x03, 0xb0, 0x10, 0x32, 0x38, 0xe0, 0x0b, 0x31, 0x2f, 0x36, 0x58, 0x0c, 0xa2, 0x22, 0x04,
+    0xcf, 0xca, 0x53, 0xaf, 0x2a, 0x9f, 0xbf, 0x4c, 0x19, 0x13, 0x08, 0x7f, 0xb7, 0x1b, 0x8f, 0x32,
+    0x34, 0x03, 0x35, 0x35, 0x7c, 0x36, 0xec, 0x0c, 0xe2, 0x39, 0x32, 0x86, 0x26, 0xc5, 0x2d, 0x1d,
+    0x17, 0x2e, 0x1d, 0x75, 0x34, 0xef, 0x53, 0x30, 0x9b, 0x00, 0x87, 0x0f, 0x0c, 0x36, 0x10, 0x2b,
+    0x0c, 0x17, 0x25, 0x3a, 0x34, 0x23, 0xaf, 0x3d, 0x30, 0x70, 0x85, 0xd6, 0x0a, 0x25, 0x3c, 0xff,
+    0x20, 0x19, 0x6d, 0xfe, 0x2b, 0x29, 0x0d, 0x1f, 0x02, 0x43, 0x0b, 0xd5, 0x86, 0x28, 0x23, 0x20,
+    0x18, 0x6c, 0x14, 0xe6, 0x3d, 0x84, 0xd8, 0x05, 0xb4, 0xec, 0x22, 0x19, 0x0f, 0xa6, 0x40, 0x24,
+    0x4a, 0xa6, 0x8c, 0x13, 0x3b, 0xa3, 0x34, 0x1f, 0x6e, 0x14, 0x39, 0x0d, 0x03, 0x04, 0xe5, 0xbe,
+    0x29, 0x16, 0x35, 0xf2, 0xd4, 0x1d, 0x3a, 0xf3, 0x1e, 0xa3, 0x10, 0x1c, 0x34, 0x1e, 0x65, 0x24,
+    0xe9, 0x23, 0x22, 0x39, 0x28, 0x09, 0x02, 0x10, 0x11, 0x31, 0x28, 0x3e, 0x32, 0x0d, 0x1d, 0xff,
+    0x28, 0x80, 0x37, 0x86, 0x3a, 0x2f, 0x2d, 0x0b, 0x12, 0x10, 0x03, 0xfb, 0x0e, 0x14, 0x44, 0x0f,
+    0x5c, 0x05, 0x90, 0x2c, 0x37, 0x71, 0x6b, 0xc3, 0xd8, 0x06, 0x2e, 0x9a, 0x54, 0x11, 0x9c, 0x80,
+    0x21, 0x0a, 0x05, 0x3b, 0xd6, 0x13, 0x03, 0x27, 0x0c, 0x39, 0x2e, 0x19, 0x3d, 0x2f, 0xa0, 0x28,
+    0x1c, 0x31, 0xa3, 0x1c, 0x34, 0x65, 0xdf, 0x1c, 0x36, 0xad, 0x02, 0xd7, 0x7f, 0x0b, 0x05, 0x36,
+    0x0c, 0x86, 0x33, 0x89, 0x15, 0x18, 0x95, 0x1f, 0xd2, 0x3c, 0x25, 0x78, 0x9c, 0x0e, 0x3a, 0x10,
+    0xac, 0x37, 0x46, 0xae, 0x7b, 0x2a, 0x37, 0x39, 0x0c, 0x10, 0x69, 0x09, 0x76, 0x04, 0xbe, 0x00,
+    0x81, 0x0e, 0x33, 0x0b, 0x2e, 0xf4, 0x0d, 0x2a, 0x13, 0xb3, 0x3e, 0x00, 0x25, 0xaa, 0x3d, 0x55,
+    0x19, 0x49, 0xfa, 0x1b, 0xdd, 0x41, 0x2f, 0x3e, 0xd9, 0xd6, 0x24, 0x9a, 0x1d, 0x25, 0x91, 0x1c,
+    0xa3, 0x04, 0x26, 0x3a, 0x04, 0x35, 0x6e, 0x5b, 0x66, 0xac, 0x1c, 0x30, 0x2f, 0x55, 0x01, 0x06,
+    0x04, 0x6f, 0x20, 0x90, 0x4a, 0x17, 0x22, 0x2a, 0x83, 0x06, 0x3a, 0x13, 0x1b, 0xa2, 0xe9, 0x8a,
+    0x24, 0x0e, 0x1e, 0x60, 0x27, 0x29, 0x1c, 0x08, 0x16, 0xda, 0x44, 0x17, 0x9a, 0x38, 0xc6, 0x2a,
+    0x3d, 0x3d, 0x20, 0xd1, 0x9d, 0x76, 0x2a, 0x1c, 0x1b, 0xfb, 0x2b, 0x17, 0xab, 0x1f, 0x3f, 0x27,
+    0xe9, 0x25, 0x93, 0x3b, 0x0a, 0xc9, 0x87, 0xa6, 0xa8, 0x20, 0x33, 0x22, 0x3b, 0x38, 0x30, 0xc9,
+    0x3a, 0x28, 0x39, 0x7d, 0x21, 0x35, 0x1a, 0xc6, 0xd2, 0x23, 0xe9, 0x2b, 0x33, 0x28, 0x0f, 0x39,
+    0x8f, 0x49, 0x3e, 0x2b, 0xdd, 0x03, 0x14, 0x0b, 0x16, 0x12, 0x03, 0xc3, 0x2d, 0x89, 0xa6, 0x07,
+    0x37, 0xee, 0x2c, 0xcd, 0xad, 0xbf, 0x41, 0xdf, 0xbd, 0x3b, 0xcf, 0x1c, 0x3f, 0x2d, 0x02, 0x16,
+    0xb5, 0x03, 0x33, 0x27, 0x11, 0x91, 0x26, 0x21, 0x7a, 0x58, 0x25, 0x07, 0x22, 0x37, 0x32, 0x19,
+    0x0e, 0xaf, 0xdb, 0xc4, 0xaf, 0x17, 0x09, 0x92, 0x14, 0x00, 0x06, 0xc3, 0xc2, 0x18, 0x80, 0x29,
+    0x28, 0x3e, 0x08, 0x9e, 0x04, 0x06, 0x26, 0x15, 0x23, 0x03, 0x4b, 0x1a, 0x0c, 0xcc, 0x3c, 0x06,
+    0x04, 0x08, 0x35, 0x62, 0x72, 0x16, 0x04, 0x7f, 0x4b, 0x3a, 0x30, 0x8f, 0x27, 0xf5, 0x0c, 0x15,
+    0x0c, 0x15, 0xc0, 0x38, 0x08, 0x0a, 0x39, 0x66, 0x3b, 0x25, 0x18, 0x2d, 0x25, 0x02, 0x97, 0xcb,
+    0x0c, 0x1d, 0x8d, 0x0c, 0x84, 0x3c, 0xb9, 0x3b, 0xfa, 0x37, 0x0c, 0x98, 0x57, 0x7c, 0x9e, 0x25,
+    0xe8, 0x6c, 0x31, 0x28, 0x20, 0x3b, 0x0d, 0xa3, 0x7b, 0x03, 0x1d, 0x37, 0x03, 0x76, 0xbb, 0x92,
+    0x17, 0x68, 0x76, 0x3f, 0x80, 0xf9, 0x21, 0x48, 0x3a, 0x9f, 0x1f, 0xc1, 0x17, 0xcd, 0x0c, 0x1e,
+    0x17, 0x46, 0x2d, 0x5c, 0xb7, 0x1b, 0xd6, 0x36, 0x1a, 0x1d, 0xd9, 0x00, 0xdc, 0x10, 0x17, 0xc7,
+    0x60, 0x3d, 0x0c, 0x0a, 0x1f, 0x61, 0x6c, 0xdd, 0x18, 0x02, 0x8f, 0x48, 0x25, 0x5a, 0x1d, 0x1c,
+    0x09, 0x1a, 0xef, 0x3b, 0x72, 0x3d, 0x33, 0x73, 0x3b, 0x36, 0x1f, 0x18, 0x3e, 0xe6, 0x31, 0xcc,
+    0x0e, 0x12, 0x3b, 0x2c, 0x2e, 0xef, 0x23, 0x34, 0x36, 0x57, 0x0d, 0x22, 0x37, 0x2e, 0x03, 0x68,
+    0x35, 0x01, 0x2a, 0x3a, 0x45, 0x2d, 0x3a, 0x2e, 0xae, 0x36, 0xcc, 0x39, 0x34, 0x09, 0x3e, 0x19,
+    0x28, 0x34, 0x1d, 0x35, 0x7c, 0xb1, 0xd7, 0x21, 0x1e, 0x23, 0x79, 0xae, 0x37, 0x05, 0x78, 0x54,
+    0x0f, 0xe0, 0xef, 0xf4, 0x12, 0x11, 0x91, 0x74, 0x14, 0x50, 0x1c, 0x3a, 0x09, 0x1e, 0xb1, 0x6d,
+    0x08, 0x3e, 0x10, 0x1c, 0x6b, 0x3c, 0xa1, 0x00, 0x02, 0x78, 0x37, 0x13, 0x1b, 0x29, 0x1e, 0x2f,
+    0x37, 0x17, 0x1d, 0xf7, 0xbb, 0x81, 0xfc, 0x3a, 0x14, 0xe7, 0x22, 0x94, 0xf9, 0x27, 0x0d, 0x15,
+};
+
+static const uint8_t new_image[7856] = {
+    0x23, 0x3a, 0x20, 0x7e, 0xe1, 0x2a, 0xf2, 0x3d, 0x07, 0x39, 0x2d, 0x0d, 0xa6, 0x78, 0x16, 0x00,
+    0x05, 0x12, 0x3a, 0xa7, 0x4e, 0x1e, 0x9f, 0x78, 0x9c, 0x70, 0x23, 0x00, 0x0b, 0xe6, 0x08, 0x25,
+    0x21, 0x3d, 0x2d, 0x22, 0xbc, 0x70, 0x33, 0x05, 0x1a, 0x21, 0x23, 0x23, 0x36, 0x17, 0x7b, 0xc3,
+    0x39, 0xfd, 0x62, 0x2c, 0x39, 0x66, 0x03, 0x31, 0x1f, 0xbd, 0x61, 0x23, 0x3d, 0x7c, 0x19, 0x10,
+    0x67, 0x33, 0xd1, 0x18, 0x30, 0x0c, 0x88, 0xd3, 0x10, 0x34, 0x3f, 0x14, 0xd1, 0xaa, 0xff, 0x72,
+    0x48, 0x27, 0x35, 0xf9, 0x1e, 0x34, 0x0e, 0xb0, 0x0a, 0x10, 0xd8, 0x15, 0x03, 0x7e, 0x10, 0xa4,
+    0x17, 0x4d, 0xd7, 0x31, 0x39, 0x3c, 0x26, 0x1f, 0x16, 0x29, 0x48, 0x3b, 0x0d, 0x32, 0x34, 0x27,
+    0x0c, 0x39, 0x3d, 0x1a, 0x24, 0x37, 0x3f, 0x02, 0x8b, 0xd2, 0x16, 0x20, 0xcf, 0x84, 0x3c, 0x3e,
+    0x06, 0x3a, 0x3b, 0xf4, 0x37, 0x3f, 0x32, 0x09, 0x09, 0xbb, 0xae, 0xed, 0x0b, 0x7d, 0x14, 0x27,
+    0x1e, 0xe0, 0xed, 0x3c, 0x0f, 0x0f, 0x3e, 0xb7, 0x78, 0xb6, 0x3e, 0x23, 0x38, 0x04, 0x7c, 0x01,
+    0x0d, 0x4b, 0x14, 0x38, 0xbd, 0xcc, 0x3a, 0xf0, 0x23, 0x23, 0x20, 0xc6, 0x4b, 0x4b, 0xfb, 0xff,
+    0x3d, 0x02, 0x33, 0x35, 0x1f, 0xff, 0x20, 0x25, 0x40, 0x6d, 0x09, 0x2f, 0xf6, 0x03, 0x37, 0x38,
+    0xf4, 0x1f, 0x1e, 0x04, 0x87, 0xba, 0x00, 0x24, 0x21, 0x6e, 0x90, 0xf1, 0x46, 0xfd, 0x3d, 0x02,
+    0x47, 0x05, 0x2a, 0x17, 0x1e, 0x1f, 0xd9, 0x00, 0x78, 0x69, 0x83, 0x0a, 0x73, 0x27, 0xd2, 0x82,
+    0x9c, 0x0b, 0x03, 0xe3, 0xc0, 0xf4, 0x1d, 0x33, 0x74, 0xf1, 0x9f, 0x18, 0x1a, 0x8e, 0x02, 0x27,
+    0x38, 0x11, 0x36, 0x2b, 0x05, 0x10, 0x2d, 0x4a, 0x2d, 0xfe, 0x90, 0x26, 0xc1, 0x21, 0xe6, 0xbf,
+    0x8c, 0x9d, 0x9f, 0x30, 0xe8, 0xe4, 0x1a, 0xdc, 0x28, 0xb7, 0x00, 0xd7, 0x23, 0x38, 0x2c, 0x0b,
+    0x0c, 0x01, 0x96, 0x34, 0x26, 0x51, 0x0b, 0x32, 0xab, 0x0a, 0x18, 0x14, 0x3f, 0x03, 0xad, 0x2e,
+    0x12, 0x58, 0x17, 0x16, 0x3b, 0x4d, 0x1a, 0x20, 0xc6, 0x2e, 0xf2, 0x4f, 0x22, 0x32, 0x21, 0x2f,
+    0x21, 0x3a, 0x79, 0x04, 0x23, 0x65, 0x59, 0x03, 0x27, 0x19, 0x25, 0x14, 0x3f, 0x4e, 0x2f, 0x33,
+    0xa9, 0x26, 0x5d, 0x22, 0x07, 0x05, 0x1d, 0xbf, 0x1e, 0x33, 0x10, 0x2e, 0x12, 0x0a, 0x33, 0x3b,
+    0x26, 0x26, 0x07, 0x27, 0x7d, 0xa4, 0x3b, 0x3d, 0x19, 0x03, 0x3d, 0x20, 0x5b, 0x02, 0x14, 0x0c,
+    0x10, 0x16, 0x15, 0xe4, 0x05, 0x23, 0x17, 0x10, 0x8a, 0x7b, 0x2a, 0xda, 0x70, 0x66, 0x51, 0x22,
+    0xc7, 0x7a, 0xbd, 0x17, 0x66, 0x2d, 0xdb, 0x6a, 0x01, 0x37, 0x07, 0x00, 0x35, 0x68, 0x62, 0xe3,
+    0x14, 0x33, 0x15, 0x93, 0x89, 0x99, 0x15, 0x03, 0x3d, 0x37, 0x50, 0x7e, 0xe9, 0x2c, 0x02, 0x2c,
+    0x4f, 0x63, 0x0e, 0x48, 0x0a, 0x19, 0x3a, 0x17, 0x1a, 0x16, 0x1f, 0x39, 0x39, 0xb5, 0xab, 0xc9,
+    0x2e, 0x6c, 0x0c, 0x04, 0x0b, 0x99, 0x3e, 0x50, 0x0d, 0x19, 0x4c, 0x1e, 0x0d, 0x32, 0x50, 0xb0,
+    0x37, 0x68, 0x17, 0x76, 0xcb, 0x32, 0x0e, 0x60, 0x07, 0x33, 0x20, 0xa3, 0x33, 0x34, 0x01, 0x0a,
+    0x19, 0xe1, 0x21, 0x3f, 0x3c, 0x10, 0x2d, 0x2d, 0x2c, 0x1c, 0x16, 0xfb, 0xac, 0x08, 0x10, 0xea,
+    0x12, 0x24, 0x18, 0x36, 0x21, 0xb5, 0xeb, 0x01, 0xb2, 0xc0, 0xd3, 0x38, 0x2b, 0x25, 0x86, 0x17,
+    0x0c, 0xb3, 0x08, 0xbf, 0x61, 0x27, 0x27, 0x1b, 0x97, 0x3e, 0xe7, 0x3e, 0x21, 0x60, 0x21, 0x27,
+    0x6a, 0xbb, 0xa8, 0x0b, 0x92, 0xa7, 0x3a, 0x79, 0x1d, 0xea, 0x70, 0x1e, 0x2a, 0x9d, 0x68, 0x86,
+    0xbe, 0x2e, 0x8d, 0x58, 0x16, 0xa5, 0x34, 0x3f, 0x7d, 0x24, 0x76, 0xaa, 0xe3, 0x56, 0xfe, 0x3b,
+    0x5c, 0xd8, 0x1b, 0x2d, 0x1d, 0x3b, 0x1f, 0x2d, 0x9d, 0x34, 0x55, 0x18, 0x49, 0x22, 0x3d, 0x19,
+    0x23, 0x0f, 0x27, 0x15, 0x60, 0xcf, 0x03, 0xbc, 0x3b, 0x2f, 0x39, 0x62, 0x24, 0x1a, 0xa2, 0x3c,
+    0x41, 0x04, 0x37, 0x13, 0xbc, 0x39, 0x13, 0x0b, 0x1a, 0x0a, 0xb5, 0x00, 0xfb, 0x9e, 0x02, 0x48,
+    0x34, 0x05, 0x35, 0x2a, 0x16, 0x5d, 0x30, 0x93, 0x1f, 0xa7, 0x14, 0x3e, 0x3a, 0x2f, 0x16, 0x7b,
+    0x03, 0x22, 0x1e, 0x25, 0x0e, 0xc8, 0x2a, 0x24, 0x26, 0x52, 0x15, 0x5b, 0x5a, 0x12, 0x33, 0xe7,
+    0x11, 0xad, 0x18, 0xe5, 0x24, 0x31, 0x29, 0x3d, 0xf1, 0x75, 0x81, 0x18, 0x58, 0xd1, 0x12, 0x11,
+    0x2a, 0xa4, 0xbb, 0x28, 0x95, 0x30, 0x62, 0x3a, 0x09, 0xa3, 0x37, 0x06, 0x76, 0xa8, 0x2f, 0xec,
+    0x9c, 0x3e, 0x2a, 0x63, 0x25, 0x43, 0x64, 0xb9, 0x13, 0x2c, 0x32, 0x3c, 0x2b, 0x20, 0x24, 0x21,
+    0x39, 0x12, 0x0e, 0x01, 0xe2, 0x0f, 0x16, 0x33, 0xac, 0x2e, 0x85, 0xf4, 0xdf, 0x98, 0x7d, 0xbe,
+    0x61, 0x19, 0x27, 0x5c, 0xd0, 0x9a, 0x03, 0x15, 0xd8, 0x17, 0x78, 0x02, 0x38, 0x00, 0x0f, 0x74,
+    0x2a, 0x49, 0x2e, 0x8a, 0x07, 0xab, 0x5d, 0x1e, 0x0b, 0xb7, 0x36, 0x3b, 0x00, 0x0b, 0x33, 0x33,
+    0x0f, 0xff, 0x7b, 0x30, 0x58, 0x13, 0x0c, 0x38, 0x2c, 0x2d, 0x54, 0x09, 0x0b, 0x27, 0x15, 0x0f,
+    0x3f, 0xd1, 0x21, 0xaa, 0x17, 0x2a, 0xc1, 0x12, 0xef, 0x0f, 0x37, 0x2c, 0xe6, 0xa0, 0x55, 0x0c,
+    0x13, 0x14, 0x34, 0xa7, 0xb9, 0x36, 0x1c, 0x16, 0x69, 0x36, 0x12, 0xfb, 0x25, 0x2c, 0xce, 0xd2,
+    0x20, 0x6b, 0x07, 0x0f, 0x70, 0x0a, 0x44, 0xd8, 0xf2, 0x26, 0x32, 0x90, 0x36, 0x15, 0x22, 0x02,
+    0x3c, 0x14, 0x04, 0x0c, 0x8d, 0x06, 0x3f, 0x14, 0xf7, 0x2a, 0x3a, 0x0b, 0x97, 0x4d, 0x27, 0x30,
+    0x35, 0x03, 0x21, 0x18, 0x2f, 0x35, 0x83, 0x33, 0x2e, 0x0f, 0x19, 0x21, 0x29, 0xfa, 0xde, 0x39,
+    0x1e, 0x1f, 0x7c, 0x17, 0x67, 0x15, 0x28, 0x2a, 0x07, 0xd3, 0xa3, 0x5b, 0x27, 0x04, 0x3b, 0x02,
+    0x58, 0xff, 0x08, 0x2a, 0x24, 0x0f, 0x27, 0x61, 0x25, 0xc7, 0x05, 0x2b, 0xe2, 0x2f, 0x37, 0x35,
+    0x2a, 0xe2, 0x80, 0x9c, 0x09, 0x1a, 0x0b, 0x30, 0xa1, 0xc9, 0x17, 0x27, 0x2b, 0x8a, 0x12, 0xad,
+    0x17, 0x00, 0xfa, 0x24, 0x5b, 0xc2, 0x0b, 0x46, 0x13, 0x20, 0x22, 0x97, 0x2a, 0x26, 0x0b, 0x04,
+    0x10, 0x33, 0x21, 0x43, 0xf6, 0x0c, 0x14, 0x08, 0x27, 0x39, 0x03, 0xed, 0x6c, 0x55, 0x06, 0x26,
+    0x18, 0x3c, 0x38, 0x3d, 0xb3, 0x2a, 0x27, 0x34, 0x19, 0xfb, 0x1b, 0x29, 0xb8, 0x8c, 0x0b, 0x2e,
+    0xfd, 0xbd, 0x38, 0x01, 0xfe, 0x03, 0x23, 0x60, 0x33, 0x07, 0x7c, 0x2e, 0x25, 0x03, 0x22, 0x15,
+    0x58, 0xa7, 0xb7, 0x76, 0x29, 0x3c, 0x4a, 0xa6, 0x1f, 0x28, 0x6c, 0x18, 0x1a, 0x1a, 0x98, 0x28,
+    0x9d, 0x32, 0xd5, 0x15, 0x27, 0x27, 0x23, 0x14, 0x06, 0x30, 0x0d, 0x49, 0x1f, 0xf7, 0x2a, 0xfc,
+    0xf8, 0x3b, 0x3d, 0xd2, 0x39, 0x02, 0x5e, 0xc8, 0x1e, 0x01, 0x25, 0x36, 0xce, 0x12, 0x93, 0xc1,
+    0x37, 0xe5, 0x66, 0x0f, 0x39, 0x03, 0xff, 0x05, 0x0f, 0xbb, 0x00, 0x96, 0x21, 0xa5, 0xfd, 0x23,
+    0x03, 0x0c, 0xc8, 0x11, 0x2a, 0x1f, 0x4c, 0xd2, 0x3b, 0xc3, 0x25, 0xc8, 0x09, 0x0c, 0x1e, 0x29,
+    0x0d, 0x20, 0x0a, 0x01, 0x3c, 0x50, 0xcf, 0x2c, 0x0b, 0xcf, 0x10, 0xe9, 0x8d, 0x29, 0x4f, 0x0f,
+    0x7c, 0xf7, 0x18, 0x35, 0x3f, 0x83, 0x11, 0xfc, 0x34, 0x15, 0x20, 0x13, 0x88, 0xf5, 0x03, 0x0d,
+    0x2b, 0x6f, 0x07, 0x09, 0x27, 0x10, 0x9f, 0xf1, 0x05, 0x5d, 0x18, 0x4c, 0x9a, 0x1b, 0x36, 0xe3,
+    0x60, 0x2b, 0x2b, 0x5c, 0x02, 0x13, 0xde, 0x3b, 0xfe, 0x08, 0x82, 0x6a, 0x0e, 0x00, 0xcb, 0x0b,
+    0x71, 0xfd, 0xad, 0x44, 0x53, 0x25, 0xd2, 0xd7, 0x93, 0x3d, 0x76, 0x10, 0x06, 0x1c, 0x2f, 0x33,
+    0x14, 0x25, 0x04, 0x2a, 0xe7, 0x78, 0xb2, 0x33, 0x4c, 0x79, 0x0f, 0x1d, 0x51, 0x69, 0x39, 0x36,
+    0x16, 0x38, 0x2b, 0xcc, 0xdb, 0xac, 0x2c, 0xa3, 0x0b, 0x26, 0x17, 0x05, 0xa0, 0x02, 0x3c, 0x05,
+    0x38, 0x05, 0x4f, 0x62, 0x28, 0x3e, 0x3e, 0xd3, 0x94, 0xc0, 0x26, 0xec, 0x02, 0xa7, 0x36, 0x17,
+    0xdb, 0xb4, 0x81, 0x2f, 0x24, 0x00, 0xd2, 0x05, 0x30, 0x32, 0xb1, 0xd1, 0x32, 0x3f, 0x34, 0x5b,
+    0x59, 0x24, 0x04, 0x96, 0x12, 0x0b, 0x28, 0x6d, 0x1e, 0x3a, 0x23, 0x04, 0x0e, 0x2f, 0x6e, 0x11,
+    0x3b, 0x21, 0xd7, 0x0d, 0x12, 0x23, 0x0c, 0x0d, 0x19, 0x36, 0x00, 0x1b, 0x10, 0x39, 0x3b, 0x1d,
+    0xbe, 0x27, 0x79, 0x3d, 0x09, 0x10, 0xbf, 0x32, 0x14, 0x21, 0x2e, 0x30, 0xe7, 0x63, 0x18, 0xbd,
+    0xdd, 0x2d, 0xe5, 0x75, 0x87, 0xe1, 0x01, 0x29, 0x33, 0xf6, 0x27, 0x06, 0x11, 0xdc, 0x19, 0xc5,
+    0x6e, 0x65, 0x77, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x6f, 0x64,
+    0x79, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62,
+    0x6f, 0x64, 0x79, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+    0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+    0x6f, 0x6e, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x66, 0x75, 0x6e, 0x63,
+    0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x66, 0x75,
+    0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x6e, 0x65, 0x77, 0x20,
+    0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x6e, 0x65,
+    0x77, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20,
+    0x6e, 0x65, 0x77, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x6f, 0x64,
+    0x79, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62,
+    0x6f, 0x64, 0x79, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e,
+    0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69,
+    0x6f, 0x6e, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0xde, 0x2c, 0x16, 0x0e, 0x18, 0x00, 0x0e, 0xd9,
+    0x13, 0x56, 0xd4, 0x04, 0xf0, 0x38, 0x14, 0xd8, 0xda, 0x36, 0x23, 0x34, 0x76, 0x2e, 0x01, 0x00,
+    0x5f, 0xe3, 0x32, 0x2e, 0x8f, 0x2b, 0x33, 0x37, 0x33, 0x6d, 0x00, 0x3b, 0xf0, 0x1d, 0x1e, 0x3b,
+    0x2b, 0x39, 0x08, 0x06, 0x10, 0x76, 0x14, 0xa4, 0x87, 0x08, 0xbf, 0x16, 0x3e, 0x07, 0x33, 0x17,
+    0x35, 0x78, 0x78, 0x13, 0x95, 0xd8, 0xdc, 0xfb, 0x3c, 0x1e, 0x29, 0x8d, 0x09, 0xf6, 0x22, 0x4d,
+    0x0d, 0xfa, 0x6d, 0x66, 0x5e, 0x39, 0x0d, 0x1d, 0xee, 0x19, 0x26, 0x11, 0xd4, 0x39, 0x13, 0x85,
+    0x0e, 0x8b, 0x2f, 0x0a, 0x1f, 0x0e, 0x22, 0xa0, 0x37, 0x04, 0x5f, 0x23, 0x80, 0xa4, 0xa9, 0x0f,
+    0x30, 0xdc, 0x0e, 0x2b, 0x1b, 0x40, 0x22, 0x09, 0x28, 0x15, 0x30, 0xac, 0x27, 0xf6, 0x0e, 0x23,
+    0x2c, 0x57, 0x0c, 0x04, 0xd7, 0x12, 0x1e, 0x10, 0x31, 0x27, 0x29, 0x11, 0xf2, 0x3c, 0x3a, 0xbb,
+    0xf0, 0x39, 0xbe, 0x78, 0x1f, 0x00, 0x9d, 0x03, 0x6e, 0xd7, 0x50, 0x5d, 0x35, 0xf9, 0x33, 0x16,
+    0x34, 0x21, 0x1c, 0x79, 0xa3, 0x29, 0x3f, 0x00, 0xfa, 0x7d, 0x6c, 0x2d, 0x08, 0x1d, 0x0c, 0x0c,
+    0x11, 0x98, 0xd4, 0x28, 0x02, 0x20, 0x32, 0x96, 0x2a, 0xbf, 0xa2, 0xca, 0x55, 0x87, 0xbc, 0x23,
+    0x30, 0x3c, 0x6c, 0x2c, 0x3f, 0x31, 0x32, 0x36, 0x0f, 0x1f, 0x07, 0x17, 0x00, 0xe7, 0x25, 0x0e,
+    0x31, 0xc3, 0x1e, 0x57, 0x02, 0x96, 0x3c, 0x62, 0x06, 0x1b, 0x35, 0xac, 0x26, 0x09, 0x67, 0xa6,
+    0xe8, 0x13, 0x5b, 0xe2, 0xc3, 0x20, 0x0e, 0x28, 0x5a, 0x3a, 0x3e, 0xbe, 0x22, 0xa7, 0xce, 0xb1,
+    0x9e, 0x0e, 0x68, 0x3d, 0x21, 0x44, 0x17, 0x2f, 0x2b, 0x1f, 0x1b, 0x5c, 0xd5, 0x3e, 0x3d, 0xd1,
+    0x1d, 0x0d, 0xcf, 0x6a, 0x07, 0x5b, 0x24, 0xe4, 0xd1, 0xf6, 0x32, 0x0f, 0x4b, 0xb7, 0x0f, 0xaf,
+    0x0e, 0x2b, 0x39, 0x38, 0x1d, 0x1d, 0x31, 0x62, 0x2c, 0x3a, 0xd8, 0x00, 0x0e, 0x88, 0x29, 0x1a,
+    0x05, 0x8a, 0x5f, 0xfa, 0xdb, 0x23, 0x2c, 0x31, 0x02, 0x19, 0x27, 0xab, 0x03, 0x93, 0x06, 0x0e,
+    0x21, 0x3f, 0x05, 0x3e, 0x0d, 0x34, 0x3b, 0xf4, 0x17, 0x96, 0x4f, 0x16, 0xfb, 0x25, 0xb8, 0x06,
+    0x05, 0x0a, 0x60, 0xbb, 0x2e, 0x3c, 0xf4, 0xef, 0x25, 0x8e, 0x0f, 0x25, 0xbf, 0x2a, 0x33, 0x8a,
+    0x71, 0x3a, 0x39, 0x15, 0x70, 0x30, 0xfa, 0xa2, 0x8f, 0x36, 0x13, 0xee, 0x15, 0x3b, 0x41, 0x11,
+    0x10, 0x07, 0x26, 0x1e, 0x36, 0x3d, 0x27, 0x2f, 0x11, 0x02, 0x02, 0x24, 0x37, 0x1f, 0xb1, 0x16,
+    0x19, 0x1e, 0x12, 0x85, 0x06, 0xae, 0x2f, 0x11, 0x0d, 0x40, 0x25, 0x09, 0xd7, 0x23, 0x36, 0x85,
+    0xb3, 0x75, 0x07, 0x3c, 0xa1, 0x3d, 0x9e, 0x1e, 0x18, 0x34, 0x9d, 0x6d, 0xf1, 0x59, 0x2a, 0x3c,
+    0x17, 0x65, 0x30, 0x24, 0xea, 0xbd, 0x23, 0x4f, 0x22, 0x36, 0x15, 0xdd, 0x20, 0x09, 0x3b, 0x9f,
+    0xa9, 0x3d, 0x9f, 0x35, 0x34, 0x19, 0x17, 0x32, 0x2c, 0x0f, 0x2a, 0x25, 0x0d, 0x0c, 0x07, 0x5b,
+    0xdc, 0x19, 0xa6, 0x34, 0x83, 0x36, 0x2f, 0xc0, 0x80, 0x21, 0x92, 0x30, 0x3c, 0x3c, 0x30, 0xb5,
+    0x13, 0x2a, 0x3d, 0x12, 0x38, 0x10, 0x37, 0x04, 0x1e, 0x20, 0x56, 0xda, 0xbf, 0x1a, 0x27, 0x0f,
+    0x3a, 0x1d, 0xe6, 0x3b, 0x1f, 0x87, 0x38, 0xc5, 0x20, 0x3d, 0x3a, 0xe3, 0x88, 0x15, 0x1c, 0x23,
+    0x34, 0x70, 0xc0, 0xf3, 0x0e, 0x53, 0x1e, 0x57, 0x20, 0x74, 0x0b, 0x89, 0xa9, 0x09, 0x34, 0x98,
+    0x1e, 0x05, 0x06, 0x8a, 0x0d, 0x13, 0x0f, 0x16, 0x53, 0x3f, 0x6c, 0xf0, 0x27, 0x29, 0x2a, 0x37,
+    0x65, 0x37, 0x3f, 0xb9, 0x66, 0x30, 0x17, 0x0b, 0x25, 0x17, 0x90, 0x24, 0x06, 0x2b, 0x02, 0x29,
+    0x14, 0x2a, 0x44, 0xb5, 0x10, 0x28, 0x04, 0x3d, 0x5c, 0xc2, 0xa0, 0x34, 0x62, 0x34, 0xcc, 0x14,
+    0x2d, 0x1c, 0x34, 0xdb, 0x23, 0xb4, 0x77, 0x70, 0xb4, 0xd5, 0x15, 0x1f, 0x23, 0x11, 0xb3, 0x58,
+    0x2e, 0x01, 0xd6, 0xd9, 0x79, 0x1b, 0xbe, 0xef, 0x26, 0x2d, 0x31, 0x3c, 0x7d, 0x76, 0x15, 0x6f,
+    0x48, 0x1c, 0x1a, 0x2f, 0x29, 0x53, 0x87, 0x11, 0x3c, 0x81, 0x24, 0xc2, 0x7b, 0xc3, 0x20, 0x4e,
+    0x14, 0x30, 0x5b, 0xdf, 0xb3, 0xbb, 0xdc, 0x65, 0xa6, 0x0b, 0x3f, 0xee, 0xdb, 0x36, 0xbb, 0x30,
+    0x1c, 0xe3, 0x2e, 0xe9, 0xa5, 0xb6, 0x23, 0x06, 0x22, 0x10, 0x8a, 0xcf, 0x08, 0xef, 0x53, 0x03,
+    0x3f, 0xb1, 0xb3, 0x16, 0xdc, 0x7f, 0xd5, 0xa5, 0x29, 0x00, 0x40, 0x3a, 0x37, 0x16, 0x17, 0xef,
+    0x08, 0x00, 0xc8, 0xc9, 0x03, 0x39, 0x3d, 0x98, 0x2b, 0xe0, 0xa9, 0x73, 0x58, 0x99, 0x2d, 0xde,
+    0x29, 0xb5, 0x3e, 0x1d, 0x9c, 0xdf, 0x3e, 0x36, 0x20, 0x22, 0x0b, 0x2b, 0xaa, 0x18, 0x2c, 0xea,
+    0x73, 0x18, 0x1a, 0x11, 0x05, 0x27, 0x2c, 0x01, 0x8b, 0x28, 0x00, 0xb4, 0x2c, 0x0c, 0x7f, 0xf0,
+    0xc2, 0x14, 0x00, 0x93, 0x2d, 0x82, 0x0a, 0x2d, 0x05, 0x33, 0x51, 0x33, 0xf6, 0x24, 0x7d, 0x1d,
+    0x10, 0x1d, 0x68, 0xcc, 0x09, 0x12, 0xe6, 0x65, 0x04, 0x7d, 0x26, 0x0d, 0x05, 0x15, 0x59, 0x0e,
+    0x39, 0x3c, 0x2f, 0xbf, 0xd4, 0x95, 0x0d, 0xfa, 0x20, 0x05, 0x3e, 0x02, 0x20, 0x3b, 0x1a, 0x06,
+    0x31, 0x35, 0xed, 0xf1, 0xed, 0x41, 0x0f, 0x28, 0xb4, 0x3b, 0x80, 0x28, 0x20, 0xb0, 0x32, 0x6f,
+    0x28, 0x30, 0x33, 0x3d, 0x24, 0xb9, 0x08, 0x39, 0xab, 0xf8, 0x54, 0x04, 0x11, 0x7b, 0x36, 0x03,
+    0x3b, 0x01, 0x38, 0x2e, 0x48, 0xb4, 0x27, 0x13, 0x85, 0x39, 0x1d, 0x34, 0x0e, 0x27, 0x6a, 0x14,
+    0x86, 0x68, 0x40, 0x20, 0x21, 0x38, 0x60, 0x31, 0xd1, 0x3f, 0x1e, 0x38, 0x43, 0x18, 0xde, 0x10,
+    0x0a, 0x04, 0xcf, 0x28, 0x15, 0xca, 0x1d, 0x21, 0x14, 0x2e, 0xb8, 0x03, 0x08, 0x13, 0x58, 0xc7,
+    0x2b, 0x38, 0x2c, 0x20, 0x0c, 0x5d, 0x0c, 0x7d, 0x39, 0x2d, 0x41, 0x10, 0x22, 0x06, 0x29, 0x96,
+    0x03, 0xa0, 0x0b, 0x43, 0x0a, 0x19, 0x3b, 0x2f, 0x5d, 0x1d, 0x6c, 0x03, 0xf2, 0x1a, 0xb0, 0x2d,
+    0xce, 0x31, 0xa2, 0x5e, 0x0e, 0x15, 0x2b, 0x87, 0xfe, 0x35, 0xb7, 0x30, 0x27, 0x4f, 0xca, 0x35,
+    0xae, 0x8c, 0x03, 0x36, 0x32, 0x2a, 0x34, 0x2e, 0x2a, 0x0e, 0x10, 0x07, 0xd0, 0xa6, 0x33, 0x26,
+    0x4e, 0x83, 0x3a, 0x6b, 0x17, 0x45, 0xfc, 0xdb, 0x0d, 0x55, 0x2f, 0xfd, 0x27, 0x38, 0x1a, 0x2b,
+    0x01, 0x65, 0x3d, 0x29, 0x2f, 0xb2, 0x41, 0x52, 0x25, 0x93, 0x3e, 0x06, 0x10, 0x83, 0xbb, 0x53,
+    0xba, 0x15, 0x09, 0x2a, 0x83, 0x3f, 0xf1, 0x0f, 0x99, 0x24, 0x4c, 0x1b, 0x94, 0x08, 0x2b, 0x0b,
+    0xb1, 0xce, 0x19, 0x2d, 0x0d, 0x29, 0x9b, 0x1b, 0x1a, 0xff, 0x34, 0xf5, 0xa6, 0x91, 0x6b, 0x10,
+    0x51, 0x27, 0x7d, 0x33, 0x3f, 0x3e, 0x35, 0x06, 0x35, 0x2a, 0x0c, 0x0e, 0x39, 0xdd, 0x62, 0x05,
+    0x86, 0x1a, 0x01, 0x69, 0xf4, 0x1b, 0x37, 0xb4, 0x29, 0x25, 0x44, 0x0e, 0x01, 0x1a, 0x47, 0x24,
+    0x34, 0x9e, 0x1f, 0xbe, 0x12, 0x04, 0x14, 0xf6, 0x3a, 0x65, 0x19, 0x4d, 0x3a, 0x1a, 0x16, 0xb3,
+    0xde, 0x99, 0x06, 0xc2, 0x32, 0xda, 0xb9, 0x3b, 0x43, 0x30, 0x19, 0x25, 0x36, 0x23, 0x33, 0x27,
+    0x15, 0x09, 0x87, 0x17, 0x3e, 0x87, 0x01, 0x28, 0x2e, 0x72, 0x12, 0x1b, 0x71, 0x3d, 0xe1, 0x88,
+    0x23, 0x21, 0xfb, 0x34, 0x2a, 0x02, 0x2c, 0xaf, 0x27, 0x32, 0x39, 0x34, 0x29, 0x0f, 0x2c, 0x35,
+    0x09, 0x13, 0x6f, 0x02, 0x8a, 0x0c, 0xa7, 0x69, 0x34, 0x0e, 0x5b, 0x2d, 0x09, 0x94, 0x40, 0x33,
+    0x1c, 0x87, 0x38, 0x2f, 0x09, 0x3d, 0x13, 0x47, 0x73, 0x1e, 0xcb, 0x4a, 0x80, 0x1e, 0x2d, 0x9c,
+    0x37, 0x3e, 0x22, 0xe9, 0x96, 0xf5, 0x02, 0xe3, 0xa6, 0x03, 0xa0, 0x2e, 0x2b, 0x38, 0x0e, 0x1a,
+    0x36, 0x0a, 0x63, 0xc9, 0xe6, 0x01, 0x24, 0x19, 0x9f, 0x76, 0x59, 0x30, 0x09, 0x3b, 0x07, 0x09,
+    0x65, 0x38, 0x05, 0xed, 0x31, 0x37, 0x8d, 0x01, 0x32, 0x20, 0xfa, 0x34, 0x08, 0xfa, 0xbf, 0x3c,
+    0xbc, 0xc5, 0x36, 0xf3, 0x05, 0x0e, 0x3f, 0x29, 0xf0, 0xca, 0x06, 0xae, 0x35, 0x2b, 0x45, 0x70,
+    0x00, 0xf2, 0x54, 0x5b, 0x16, 0x20, 0x09, 0xd1, 0x22, 0xc0, 0x0a, 0x13, 0x34, 0x3e, 0x80, 0x87,
+    0x37, 0x2a, 0xaf, 0x66, 0x3d, 0x18, 0xa6, 0xe4, 0x0c, 0x0e, 0x21, 0x3a, 0x3c, 0x2b, 0x1b, 0xa5,
+    0x48, 0x53, 0x39, 0x01, 0xb3, 0xc9, 0x62, 0x03, 0x08, 0xd7, 0x0a, 0x4a, 0x16, 0x24, 0x48, 0x33,
+    0xf0, 0x22, 0x98, 0x2d, 0x38, 0x7f, 0x59, 0x65, 0x00, 0x23, 0x34, 0x3e, 0x01, 0x25, 0xcd, 0x17,
+    0x16, 0x32, 0xbf, 0x01, 0x48, 0x35, 0x8c, 0x99, 0x13, 0x3a, 0x34, 0x2f, 0x20, 0xee, 0x3c, 0x36,
+    0x21, 0x3d, 0x6b, 0xf9, 0x1e, 0x0d, 0x19, 0x3d, 0x85, 0x68, 0x61, 0x2f, 0x28, 0x5a, 0x2a, 0x33,
+    0x16, 0x10, 0x11, 0x3f, 0x84, 0x29, 0x17, 0x09, 0x22, 0xc9, 0x05, 0x38, 0x0d, 0x07, 0xb6, 0x22,
+    0x1a, 0x10, 0x0b, 0xa9, 0x17, 0x03, 0x30, 0x14, 0x1f, 0x20, 0x05, 0x33, 0xf4, 0x12, 0x27, 0x36,
+    0x3a, 0x22, 0x18, 0x0f, 0xbc, 0x07, 0x31, 0x9a, 0x50, 0x1c, 0x0d, 0x57, 0x28, 0xc8, 0x2a, 0x78,
+    0x15, 0x10, 0x20, 0xc7, 0x37, 0x0e, 0x05, 0x34, 0x17, 0x14, 0x59, 0x9b, 0x2e, 0x24, 0xfb, 0x16,
+    0x0b, 0x03, 0x15, 0x14, 0x22, 0x61, 0x2d, 0xa3, 0x07, 0x94, 0x20, 0x11, 0xc5, 0xcf, 0x3c, 0x15,
+    0x28, 0x0f, 0xbd, 0x21, 0x37, 0x65, 0x3f, 0x30, 0x0e, 0x34, 0x27, 0x05, 0xaa, 0x3a, 0x1e, 0x4f,
+    0x5a, 0xcc, 0x58, 0x64, 0x01, 0x08, 0x07, 0x2c, 0x3d, 0x6e, 0x17, 0x21, 0x02, 0x21, 0x0e, 0x31,
+    0x0b, 0x3f, 0x26, 0x74, 0xe6, 0xb4, 0xda, 0x38, 0xcc, 0xe9, 0x37, 0x26, 0x26, 0x17, 0x47, 0x15,
+    0x73, 0x17, 0x34, 0x2d, 0x16, 0x45, 0x2a, 0x7a, 0x27, 0x2a, 0x08, 0x36, 0x60, 0x0d, 0x09, 0x32,
+    0xb7, 0xb6, 0xc6, 0x3c, 0x07, 0x3b, 0xf3, 0x20, 0xf5, 0xcf, 0x04, 0x24, 0x9e, 0x3a, 0x0f, 0x0f,
+    0x38, 0x15, 0x37, 0x0d, 0x3b, 0x2c, 0xfe, 0xcc, 0x00, 0x00, 0xf9, 0x10, 0xea, 0xa2, 0xd2, 0x25,
+    0x33, 0x76, 0x52, 0x6a, 0x1d, 0x2d, 0x10, 0x33, 0xfc, 0xc8, 0x1e, 0x3f, 0x3c, 0x13, 0xe8, 0x73,
+    0x8f, 0xae, 0x9b, 0x2c, 0x22, 0x90, 0xa7, 0x89, 0x01, 0xde, 0x1f, 0x56, 0x1d, 0x3a, 0x36, 0x7b,
+    0x9b, 0x05, 0x00, 0x36, 0x06, 0x5a, 0x72, 0x13, 0x24, 0x30, 0x1e, 0x03, 0x17, 0x00, 0x77, 0x00,
+    0x14, 0x00, 0x19, 0xf3, 0x5e, 0x2b, 0x07, 0x9e, 0x29, 0x2f, 0x45, 0x8f, 0x39, 0x10, 0xca, 0xd2,
+    0xf1, 0xc4, 0x6c, 0x0d, 0x46, 0x19, 0x02, 0x1e, 0x06, 0x77, 0x01, 0xf7, 0x52, 0x03, 0x18, 0x0a,
+    0x5e, 0x44, 0x44, 0xc8, 0xde, 0x89, 0x2a, 0x31, 0x2b, 0xb6, 0x3c, 0x26, 0xf1, 0x36, 0x9f, 0x1e,
+    0x09, 0xbe, 0x03, 0x0f, 0xc7, 0x1a, 0x7b, 0x16, 0x2a, 0xa1, 0x2a, 0xa8, 0x05, 0x83, 0x55, 0x3d,
+    0x2c, 0xb4, 0x01, 0x68, 0xe4, 0x34, 0x07, 0xa3, 0x02, 0x06, 0x37, 0x16, 0x19, 0x9e, 0x04, 0xed,
+    0xb6, 0x2d, 0x05, 0x28, 0x13, 0x3c, 0x15, 0x36, 0x4f, 0x1e, 0x12, 0x11, 0x3d, 0x54, 0x0e, 0x74,
+    0x2b, 0x2c, 0xea, 0x1c, 0xee, 0x3d, 0x38, 0x0d, 0xfc, 0x33, 0x3a, 0x9c, 0x0a, 0x18, 0x4d, 0x1b,
+    0x8e, 0x0b, 0x26, 0x17, 0x24, 0x51, 0xeb, 0x2f, 0x1f, 0x08, 0xb2, 0x10, 0xc7, 0x13, 0x90, 0x70,
+    0x39, 0x61, 0x29, 0xa6, 0x3f, 0x3e, 0x46, 0x13, 0x00, 0x18, 0x10, 0x04, 0xf4, 0xa2, 0xf5, 0xbe,
+    0xe2, 0x17, 0x03, 0xc4, 0xb9, 0x15, 0x02, 0x45, 0x21, 0xf5, 0x6c, 0xf9, 0x18, 0x7e, 0x26, 0xd2,
+    0x10, 0x17, 0x77, 0x94, 0x0c, 0xcd, 0x64, 0x1d, 0x23, 0x14, 0x89, 0xf1, 0x3a, 0x41, 0xd9, 0xfa,
+    0xd4, 0x3a, 0xf0, 0xd2, 0x0b, 0x15, 0xdb, 0x37, 0x3e, 0x34, 0x36, 0x33, 0x16, 0x38, 0x3a, 0x63,
+    0x05, 0x0a, 0x2b, 0x3c, 0x15, 0x2c, 0x02, 0x1f, 0x33, 0x86, 0x01, 0x30, 0x34, 0x10, 0x30, 0x1e,
+    0x06, 0x31, 0xaa, 0x06, 0x16, 0x1c, 0x0c, 0x14, 0x40, 0x35, 0x00, 0x27, 0x29, 0x31, 0x11, 0x11,
+    0x38, 0x26, 0x0b, 0x87, 0x19, 0x11, 0x24, 0xe2, 0x60, 0x08, 0x0b, 0x02, 0x0a, 0x01, 0x29, 0x29,
+    0x1d, 0x2c, 0x1a, 0x99, 0x54, 0x11, 0x7f, 0x03, 0xfb, 0x46, 0x5e, 0x0d, 0x0a, 0xf1, 0x3a, 0x6e,
+    0xbe, 0x82, 0x38, 0x31, 0xc0, 0xe8, 0x2f, 0xf4, 0x37, 0x91, 0x10, 0x33, 0x4b, 0xb0, 0x1e, 0x3d,
+    0x13, 0xaf, 0x12, 0x6b, 0xa7, 0x3a, 0x02, 0x45, 0x11, 0x15, 0x1c, 0x05, 0x16, 0xda, 0x0d, 0x3d,
+    0x28, 0xae, 0x31, 0x1d, 0x20, 0x16, 0x1c, 0x24, 0x01, 0x72, 0x15, 0x66, 0x16, 0x0d, 0x27, 0x0b,
+    0xc0, 0x25, 0x13, 0x78, 0x10, 0x11, 0x7b, 0x6b, 0x10, 0x73, 0x0b, 0x1b, 0x06, 0x31, 0x17, 0x9e,
+    0xa5, 0x85, 0xda, 0x0e, 0x31, 0x07, 0x18, 0xb6, 0x87, 0x21, 0x2b, 0xf0, 0x1c, 0x20, 0x01, 0xa9,
+    0x26, 0x04, 0x2e, 0x0d, 0xb1, 0x01, 0x5e, 0x01, 0x2a, 0x20, 0x22, 0x17, 0xea, 0x2f, 0x04, 0x8f,
+    0x63, 0x1a, 0xad, 0x1c, 0x0d, 0x7d, 0x23, 0x3a, 0x0d, 0xb9, 0xd3, 0x2a, 0x5b, 0x91, 0x33, 0x2c,
+    0x88, 0x29, 0x1f, 0x14, 0x1d, 0x3d, 0x7c, 0x45, 0x27, 0x35, 0x16, 0x37, 0x2c, 0x00, 0x3f, 0x6a,
+    0x24, 0x00, 0x66, 0x36, 0x92, 0xd0, 0xc2, 0x3d, 0x16, 0x5a, 0x93, 0x20, 0x29, 0x35, 0x19, 0x2f,
+    0x06, 0x64, 0x20, 0x40, 0x38, 0x31, 0xfa, 0xa5, 0x12, 0x24, 0xc2, 0x00, 0x08, 0x89, 0xe1, 0xfa,
+    0x87, 0x14, 0x24, 0x05, 0x4c, 0x7a, 0x1c, 0xb9, 0x13, 0x00, 0xf9, 0x07, 0x3b, 0x2b, 0x4d, 0x1a,
+    0x00, 0x35, 0x37, 0x1c, 0x1e, 0x16, 0x2a, 0x1b, 0xac, 0x33, 0x53, 0x26, 0x21, 0x39, 0x40, 0xf5,
+    0x9a, 0xc7, 0x20, 0x29, 0x0d, 0x0f, 0xc4, 0xe5, 0x84, 0xf7, 0xb1, 0x3b, 0x3e, 0x12, 0x31, 0xc0,
+    0x20, 0x1d, 0x2a, 0x0e, 0xe0, 0x37, 0x20, 0x34, 0xdb, 0x10, 0x35, 0x17, 0x1a, 0xf7, 0x5d, 0x24,
+    0xf6, 0xe0, 0x2f, 0x0f, 0x22, 0x01, 0xf0, 0x33, 0x23, 0x20, 0x17, 0xc1, 0x19, 0x31, 0x1a, 0x12,
+    0x0a, 0x3d, 0x1f, 0x08, 0x03, 0x07, 0x1b, 0x48, 0x3b, 0x2f, 0x6e, 0x08, 0x6c, 0x30, 0x16, 0x4e,
+    0x40, 0x14, 0x25, 0x38, 0x13, 0x38, 0x05, 0xca, 0x02, 0x32, 0x4d, 0x3a, 0x1b, 0x2f, 0x0a, 0xd2,
+    0x44, 0x26, 0x64, 0x1c, 0x07, 0x00, 0x9f, 0x19, 0x07, 0x05, 0x70, 0x18, 0x93, 0x32, 0x33, 0x8c,
+    0xf6, 0x25, 0x62, 0x15, 0x0d, 0xa7, 0xf8, 0x47, 0xe4, 0x20, 0x11, 0xc6, 0xc9, 0x29, 0x9d, 0xfd,
+    0x19, 0xd0, 0xe8, 0x3c, 0xee, 0x19, 0x3e, 0x98, 0xb9, 0x22, 0x11, 0xd8, 0x01, 0x11, 0x79, 0x48,
+    0xbd, 0x0a, 0x24, 0xac, 0xc5, 0x02, 0x31, 0x03, 0x34, 0x34, 0x16, 0x97, 0xa6, 0x10, 0x4c, 0x8f,
+    0xf1, 0xd2, 0xa7, 0xf0, 0x16, 0x35, 0x32, 0x20, 0x3b, 0x02, 0x22, 0x31, 0x16, 0x7a, 0x72, 0x80,
+    0x1d, 0x27, 0x25, 0x41, 0x0a, 0x36, 0x31, 0x19, 0x05, 0x0a, 0x41, 0x30, 0x15, 0x58, 0x88, 0x1d,
+    0x4c, 0x24, 0x42, 0x77, 0xfb, 0x1b, 0x7f, 0x2b, 0x70, 0x0f, 0x19, 0x03, 0x11, 0x10, 0x2c, 0x05,
+    0x02, 0x04, 0x3b, 0x3c, 0x16, 0x30, 0xd7, 0xdd, 0xe9, 0x39, 0x2e, 0x13, 0xa9, 0x16, 0x1d, 0x1d,
+    0x30, 0x27, 0x27, 0x53, 0x5f, 0x2a, 0xbd, 0x1a, 0x29, 0x5a, 0x1b, 0x09, 0x66, 0xb1, 0xa6, 0x2b,
+    0x0a, 0x26, 0x97, 0x17, 0x24, 0x3d, 0x2d, 0x2b, 0x2b, 0xd3, 0x2d, 0xba, 0x26, 0x21, 0x08, 0x81,
+    0x25, 0xb3, 0x23, 0x2a, 0x36, 0x25, 0x2d, 0x38, 0x2c, 0xbe, 0xca, 0x1e, 0x25, 0x2b, 0x30, 0x7d,
+    0x14, 0x33, 0x7c, 0x18, 0x03, 0x1e, 0xe7, 0xc4, 0xa1, 0x0f, 0xad, 0x9c, 0x75, 0x0b, 0xb6, 0x13,
+    0xf1, 0x36, 0x10, 0xa1, 0x20, 0x30, 0xf3, 0x14, 0x0c, 0x23, 0x2f, 0x26, 0xdf, 0x0f, 0x2c, 0x29,
+    0x0e, 0x2a, 0x10, 0xbf, 0x2c, 0x12, 0x23, 0x44, 0x3c, 0x21, 0x21, 0x9d, 0x72, 0x11, 0x30, 0x2b,
+    0x1f, 0xd8, 0xf8, 0x02, 0x47, 0x72, 0x1e, 0x37, 0x13, 0x0d, 0xe6, 0x87, 0x2c, 0x18, 0xf1, 0x1c,
+    0x00, 0x2a, 0xa8, 0xc3, 0x23, 0x2b, 0x47, 0x35, 0x65, 0x32, 0x3c, 0x30, 0x06, 0xc9, 0x29, 0x01,
+    0x28, 0x31, 0x3f, 0x3e, 0x1c, 0xbd, 0x08, 0x1e, 0x8b, 0x43, 0x25, 0x0f, 0x5b, 0x24, 0xb1, 0x76,
+    0x4c, 0x22, 0xad, 0x45, 0x34, 0x2b, 0xdd, 0x18, 0xfd, 0x3d, 0x15, 0x0f, 0x23, 0x2f, 0x24, 0x10,
+    0x31, 0x1a, 0x0a, 0x0e, 0xdb, 0xe2, 0x78, 0x39, 0x36, 0x4f, 0x1b, 0x38, 0xb7, 0x05, 0xae, 0xdf,
+    0x7f, 0x8b, 0x02, 0x85, 0x10, 0xb6, 0x74, 0x31, 0xdc, 0x57, 0x68, 0x26, 0x28, 0x11, 0x58, 0x0c,
+    0x1d, 0x4d, 0x16, 0x00, 0x3a, 0x47, 0x02, 0x6c, 0xf6, 0x90, 0x21, 0x6c, 0x18, 0x28, 0x3c, 0x80,
+    0xee, 0x2a, 0x3b, 0x04, 0x70, 0x1b, 0x2a, 0x8b, 0x0a, 0x16, 0x33, 0x02, 0x24, 0x24, 0x05, 0x62,
+    0x0d, 0x10, 0xc6, 0x19, 0xaa, 0xad, 0xd7, 0x12, 0x26, 0xde, 0x32, 0xb9, 0x17, 0x9c, 0xe7, 0x98,
+    0x3d, 0x32, 0x35, 0x04, 0x68, 0x20, 0x0a, 0xbc, 0x04, 0x21, 0xd2, 0x1d, 0x28, 0x01, 0x50, 0x04,
+    0x30, 0xe6, 0xec, 0xad, 0x06, 0xde, 0x86, 0x1b, 0x02, 0xfd, 0x0e, 0x5d, 0x0e, 0x49, 0x89, 0x7c,
+    0xbd, 0x37, 0x92, 0x00, 0x86, 0x2a, 0xc9, 0x77, 0x86, 0x0d, 0x1f, 0x01, 0x3f, 0x54, 0xae, 0x06,
+    0x37, 0x05, 0x2b, 0x2f, 0x4c, 0x66, 0x3a, 0x66, 0x3a, 0x39, 0x7a, 0x0a, 0x66, 0x0f, 0x23, 0x10,
+    0xba, 0x7a, 0x3e, 0x10, 0x30, 0x03, 0x0f, 0x9d, 0x11, 0x06, 0xd4, 0xeb, 0x7e, 0x20, 0xd3, 0x28,
+    0x20, 0x21, 0xea, 0x04, 0x11, 0x3e, 0xca, 0x09, 0x16, 0xe9, 0x09, 0x17, 0x3e, 0x95, 0x57, 0x0f,
+    0x28, 0x30, 0xad, 0x19, 0x28, 0x1b, 0x1e, 0x36, 0x3c, 0xb9, 0xeb, 0x20, 0x21, 0x6a, 0x03, 0x06,
+    0x2c, 0xdf, 0x31, 0x29, 0x4f, 0x09, 0x30, 0x1e, 0x20, 0x42, 0x13, 0xbf, 0x1f, 0x14, 0x2f, 0x25,
+    0x4b, 0x69, 0x03, 0x67, 0x34, 0x81, 0x6f, 0x18, 0x2b, 0x38, 0xb2, 0xab, 0x09, 0x38, 0xba, 0x66,
+    0x2c, 0x02, 0x29, 0x37, 0xc9, 0xdc, 0x2d, 0x2c, 0x01, 0x85, 0x2a, 0x29, 0x0e, 0x25, 0x24, 0x34,
+    0x49, 0x2f, 0x0e, 0x28, 0x39, 0x01, 0x3e, 0x74, 0xff, 0x16, 0xbf, 0xfd, 0x6c, 0x3d, 0x00, 0x03,
+    0x25, 0x19, 0x3d, 0x10, 0x02, 0x9c, 0x30, 0x38, 0x05, 0x27, 0xcd, 0xa1, 0x41, 0x20, 0x2a, 0xa4,
+    0x08, 0x01, 0x76, 0x25, 0xa0, 0x09, 0x39, 0xcf, 0x44, 0x32, 0xa6, 0x2b, 0x06, 0x0c, 0x25, 0x6a,
+    0x07, 0x03, 0x2a, 0x1a, 0x35, 0x34, 0x08, 0xdd, 0x2d, 0x1c, 0x78, 0x16, 0xf4, 0xf0, 0x11, 0x01,
+    0x3e, 0x7c, 0x13, 0x01, 0x2a, 0x74, 0x16, 0x13, 0x01, 0xb9, 0x08, 0x13, 0x14, 0x7d, 0x18, 0xe8,
+    0x33, 0x43, 0x49, 0x87, 0x66, 0x2d, 0x93, 0x46, 0x0e, 0x36, 0x35, 0x1b, 0xb5, 0x29, 0x57, 0x09,
+    0x27, 0x2a, 0xe8, 0x36, 0xd1, 0x06, 0x71, 0x40, 0x0b, 0x35, 0x1d, 0x90, 0x24, 0x3c, 0x7e, 0x37,
+    0x2b, 0xe6, 0x81, 0x2b, 0x6d, 0x94, 0x0b, 0x28, 0x22, 0x37, 0x1b, 0x32, 0x2e, 0x5f, 0x0e, 0x0c,
+    0x1f, 0x33, 0xcf, 0x38, 0xf8, 0x03, 0x4f, 0x5a, 0x1f, 0xdf, 0x09, 0xdb, 0x69, 0x21, 0x9d, 0xb3,
+    0x2a, 0x05, 0x2b, 0x3f, 0xc8, 0xb4, 0x1a, 0x5f, 0x0f, 0x36, 0x41, 0xa3, 0xd0, 0x30, 0x2c, 0x1f,
+    0x8c, 0x0b, 0x62, 0x16, 0x0c, 0x4f, 0x2d, 0xf4, 0xb6, 0x39, 0x55, 0x3e, 0x10, 0xa1, 0xc6, 0x2b,
+    0xc9, 0xd2, 0x0c, 0x1c, 0x94, 0x22, 0xc6, 0xb5, 0x12, 0x15, 0xb6, 0x1d, 0x01, 0xdf, 0x85, 0x1e,
+    0x41, 0x28, 0x28, 0x36, 0xfe, 0x3d, 0x39, 0x15, 0x31, 0x49, 0x9f, 0x1f, 0xf8, 0x3d, 0x10, 0x88,
+    0xb4, 0x2a, 0x33, 0x96, 0xca, 0x39, 0xb7, 0x6f, 0x9f, 0x12, 0x7b, 0x74, 0x6f, 0x02, 0x18, 0x0e,
+    0x15, 0xff, 0xe5, 0x2a, 0x55, 0x80, 0x17, 0x3f, 0x23, 0x78, 0x3f, 0x78, 0x03, 0x1e, 0x33, 0x44,
+    0x22, 0x28, 0x25, 0x2f, 0xcf, 0x26, 0x20, 0x30, 0xb2, 0x0c, 0x8d, 0x11, 0x2e, 0x1c, 0x2b, 0x0f,
+    0x46, 0x1a, 0x62, 0x17, 0xf6, 0xc8, 0x2b, 0x09, 0x0a, 0x1e, 0x0b, 0x4e, 0x38, 0xf4, 0xd8, 0x38,
+    0x3b, 0xbc, 0x11, 0xe3, 0x15, 0x00, 0x27, 0x20, 0x76, 0x33, 0x2a, 0x3f, 0x52, 0x20, 0xd5, 0x01,
+    0x08, 0xdb, 0x10, 0x38, 0x39, 0x00, 0x8e, 0xa3, 0x11, 0x36, 0x11, 0xdd, 0x04, 0xdb, 0xd3, 0x29,
+    0xf3, 0x11, 0xd9, 0x31, 0x17, 0x21, 0xa6, 0x49, 0x10, 0x1f, 0xfe, 0x25, 0x1a, 0x32, 0x07, 0x17,
+    0x31, 0x05, 0x96, 0xc3, 0x71, 0xc0, 0x27, 0x03, 0xcf, 0x2b, 0x01, 0x2c, 0x2e, 0x5e, 0x0c, 0x22,
+    0x3b, 0x1c, 0x11, 0x3d, 0x0e, 0x70, 0x90, 0x15, 0x03, 0x03, 0x45, 0x5e, 0x36, 0x8c, 0x6c, 0xcf,
+    0x02, 0x1c, 0x14, 0x30, 0x34, 0xd0, 0x18, 0xe8, 0x38, 0x00, 0x83, 0x23, 0x25, 0x32, 0x18, 0x3c,
+    0x5a, 0x59, 0x35, 0x2c, 0xfb, 0x4d, 0x3d, 0xae, 0xb7, 0x27, 0x1f, 0x11, 0x0a, 0x3d, 0x8c, 0x21,
+    0x48, 0x0e, 0x08, 0x2b, 0x12, 0x60, 0x07, 0x29, 0xf7, 0x25, 0x23, 0x2b, 0x45, 0x1b, 0x3e, 0x00,
+    0x3f, 0x17, 0x22, 0x6f, 0xa5, 0x35, 0x14, 0x20, 0x28, 0x3b, 0x26, 0x14, 0x27, 0xcb, 0x0c, 0x90,
+    0x21, 0x32, 0x34, 0x32, 0x35, 0x3e, 0x13, 0xaa, 0xcc, 0x1d, 0x04, 0xea, 0xdb, 0xd7, 0x2d, 0x85,
+    0xb3, 0x81, 0xb2, 0x0b, 0x58, 0x46, 0x7d, 0x3c, 0x53, 0x36, 0x15, 0x9d, 0x8e, 0x33, 0x11, 0x0b,
+    0x1e, 0x30, 0x34, 0x08, 0x3e, 0x18, 0x41, 0x15, 0x22, 0x22, 0xe0, 0x69, 0x20, 0xb2, 0x2d, 0x1d,
+    0x0b, 0x26, 0x6b, 0x27, 0x4e, 0x08, 0x02, 0x21, 0x1c, 0xc8, 0x48, 0x3b, 0x87, 0x06, 0x17, 0x42,
+    0x21, 0x18, 0xd3, 0xfe, 0x5f, 0x4a, 0x3c, 0x05, 0x33, 0x0c, 0x34, 0xb4, 0x1a, 0x14, 0x15, 0x13,
+    0x77, 0x68, 0x27, 0xbf, 0xa2, 0x34, 0x2b, 0xd6, 0x28, 0x37, 0x57, 0x7b, 0x13, 0x54, 0x17, 0x1c,
+    0x34, 0x28, 0x1c, 0x24, 0xb1, 0x03, 0x06, 0x19, 0x2c, 0xfa, 0xd4, 0x23, 0x63, 0xe6, 0x1b, 0x1c,
+    0x02, 0x08, 0x24, 0xae, 0x93, 0x10, 0x2e, 0xf4, 0x03, 0x6b, 0xb5, 0xcc, 0x10, 0x1f, 0x26, 0x5d,
+    0x0b, 0x9c, 0x2e, 0x88, 0xe8, 0x02, 0x5c, 0x01, 0x38, 0x26, 0x2b, 0x19, 0x9d, 0x38, 0x9f, 0x2c,
+    0xaf, 0x0f, 0x40, 0xa8, 0x1e, 0x32, 0x24, 0x8f, 0xd6, 0x29, 0x27, 0x4f, 0x26, 0x9f, 0xcd, 0x15,
+    0x49, 0x16, 0x03, 0x2d, 0x35, 0x01, 0x19, 0xb2, 0x3e, 0x0f, 0x3e, 0x6e, 0x1f, 0xd9, 0x53, 0x5e,
+    0x75, 0x78, 0x74, 0x16, 0x16, 0x09, 0x35, 0xba, 0x7f, 0x73, 0x12, 0xa3, 0x6d, 0x2e, 0x3d, 0x1c,
+    0x1a, 0x39, 0x5d, 0x1e, 0x3a, 0x2d, 0x00, 0x32, 0x9e, 0xef, 0x10, 0xd4, 0xb2, 0x66, 0x0d, 0x6c,
+    0xff, 0xcf, 0xfd, 0x97, 0x07, 0xa0, 0xd4, 0x29, 0x39, 0x43, 0x0b, 0x95, 0x2e, 0x3a, 0x17, 0x19,
+    0x1b, 0x11, 0x2a, 0x9d, 0x8e, 0x27, 0x3b, 0x9a, 0x28, 0x7c, 0x42, 0x55, 0x0f, 0x30, 0xd3, 0xa4,
+    0x2c, 0x0a, 0xc1, 0x21, 0x13, 0x06, 0xd3, 0x18, 0x05, 0x39, 0x04, 0x95, 0x90, 0x53, 0x1b, 0xa5,
+    0x14, 0xe2, 0x0b, 0x3e, 0x2d, 0x20, 0x30, 0x6b, 0xd4, 0x4d, 0x1e, 0x18, 0x02, 0x04, 0x7d, 0x01,
+    0x27, 0x2f, 0x0f, 0xa6, 0x16, 0xc2, 0x1a, 0x17, 0x2a, 0x10, 0x10, 0xd4, 0x0d, 0x3c, 0x3b, 0x1a,
+    0x0a, 0x16, 0x35, 0x22, 0x2b, 0x12, 0xce, 0xa3, 0x2b, 0x30, 0x21, 0x76, 0x07, 0x24, 0x11, 0x03,
+    0x34, 0x55, 0x56, 0x27, 0x09, 0x33, 0x1b, 0x3b, 0x31, 0x12, 0x29, 0x3d, 0x6a, 0x04, 0x43, 0x0f,
+    0xf5, 0x33, 0x34, 0xa2, 0x70, 0x2e, 0x23, 0x19, 0x27, 0xc9, 0x51, 0x06, 0x38, 0x71, 0x12, 0x39,
+    0x0d, 0xd6, 0x05, 0x1b, 0x48, 0x9a, 0x00, 0x06, 0x33, 0xdb, 0xf4, 0xce, 0x21, 0x09, 0x18, 0x2f,
+    0x2e, 0x44, 0x06, 0xe7, 0xba, 0x33, 0xa4, 0x0b, 0x2f, 0x0a, 0x79, 0x06, 0xc9, 0x1e, 0x10, 0x30,
+    0x0a, 0x29, 0x13, 0x29, 0xee, 0xe1, 0x15, 0x26, 0xa2, 0x2d, 0xea, 0xfe, 0x36, 0x55, 0x17, 0x09,
+    0x3f, 0xac, 0x1a, 0x40, 0x3a, 0x74, 0xef, 0xc6, 0x3c, 0x0d, 0x16, 0x07, 0x34, 0xbe, 0x38, 0x01,
+    0x14, 0xab, 0x38, 0x5f, 0x27, 0x3c, 0xc2, 0x00, 0x29, 0x67, 0x13, 0x14, 0xf1, 0x37, 0x38, 0x38,
+    0x30, 0x97, 0x18, 0x15, 0xca, 0x63, 0x07, 0x25, 0x0b, 0x2b, 0x0e, 0x09, 0x27, 0x79, 0x0b, 0xf4,
+    0x85, 0x53, 0xb3, 0x06, 0x2f, 0x03, 0x60, 0x23, 0x99, 0x3b, 0xbe, 0x0f, 0x1a, 0x56, 0x19, 0x29,
+    0xa9, 0x33, 0x22, 0xcf, 0x2a, 0x17, 0x08, 0x34, 0x99, 0x72, 0x1b, 0xa5, 0x1a, 0x02, 0x95, 0xfc,
+    0x0a, 0x16, 0x31, 0x21, 0x25, 0xb3, 0x00, 0x83, 0x1b, 0x61, 0xe8, 0xc4, 0x26, 0x2a, 0x2f, 0x16,
+    0xad, 0x2c, 0xb9, 0x0e, 0x29, 0x32, 0x2d, 0x7f, 0xd7, 0x28, 0x3b, 0x00, 0xe1, 0x87, 0xd8, 0x09,
+    0x12, 0x80, 0x2f, 0xad, 0x0f, 0xe9, 0x10, 0x39, 0x02, 0x23, 0x04, 0x37, 0x12, 0x04, 0x06, 0x33,
+    0x5a, 0x87, 0x9e, 0x18, 0x0b, 0x39, 0x35, 0x2e, 0x20, 0xab, 0x0c, 0x11, 0x38, 0xa9, 0x10, 0x4d,
+    0x2a, 0x15, 0x0b, 0x0c, 0xa0, 0x17, 0x3b, 0xc5, 0x02, 0xdc, 0xd0, 0xb7, 0xae, 0x24, 0x4a, 0x06,
+    0x3c, 0x04, 0xd8, 0x1e, 0xde, 0x24, 0x0b, 0x1b, 0x2d, 0x0d, 0x08, 0x12, 0xd3, 0x2b, 0x07, 0x16,
+    0x34, 0x0d, 0xf2, 0x22, 0x01, 0xd5, 0x0f, 0x1c, 0x33, 0x16, 0xee, 0xb5, 0xcb, 0x2a, 0xc8, 0x0c,
+    0xe5, 0x3e, 0x3c, 0x8b, 0x0e, 0x4a, 0x38, 0x2b, 0x1f, 0xf4, 0x2b, 0xe1, 0x9d, 0x1c, 0x9c, 0xb7,
+    0xe4, 0x1a, 0x34, 0x35, 0x00, 0x3e, 0x46, 0xda, 0xac, 0x05, 0x27, 0x94, 0xbe, 0x04, 0xa4, 0x26,
+    0x60, 0x14, 0x2b, 0x07, 0x36, 0x15, 0xe9, 0x8a, 0x09, 0x29, 0x3a, 0x41, 0x56, 0x58, 0x02, 0x6e,
+    0x41, 0x07, 0xfa, 0xf8, 0x19, 0x06, 0xac, 0x0f, 0x26, 0x3c, 0x43, 0x39, 0xf6, 0x12, 0x83, 0x82,
+    0x56, 0x05, 0x1e, 0x1f, 0xe9, 0x8d, 0x21, 0x10, 0x10, 0xc9, 0x3a, 0x13, 0x10, 0xcf, 0x20, 0xa4,
+    0x0f, 0x9b, 0x3c, 0x31, 0xf1, 0x05, 0x01, 0x1a, 0x2e, 0x2b, 0x06, 0x32, 0x13, 0x03, 0x18, 0x05,
+    0xdb, 0x3c, 0x4a, 0x20, 0x0a, 0x26, 0x0a, 0x36, 0x22, 0x99, 0xfe, 0x41, 0xe7, 0x2d, 0x10, 0x10,
+    0xc2, 0x16, 0x34, 0x0d, 0x3f, 0x3c, 0x09, 0x0e, 0xdd, 0x15, 0x0e, 0x2b, 0x39, 0xaf, 0x53, 0x6e,
+    0x27, 0x95, 0x34, 0x22, 0x14, 0x83, 0x1a, 0x3f, 0x05, 0x09, 0xfe, 0xbf, 0x2a, 0x00, 0x3d, 0x3a,
+    0x3a, 0x44, 0xe7, 0x37, 0x22, 0x25, 0x3b, 0x78, 0xdb, 0x23, 0x15, 0x87, 0xfb, 0xd1, 0x8b, 0x14,
+    0xa0, 0x75, 0x0e, 0xfd, 0x24, 0x3a, 0x5f, 0x07, 0x27, 0x04, 0x74, 0xba, 0x21, 0xf4, 0x3f, 0xdc,
+    0x28, 0xaf, 0x15, 0x36, 0x17, 0xbc, 0x23, 0x23, 0x22, 0xbe, 0x24, 0x38, 0x91, 0x99, 0x45, 0x32,
+    0x82, 0x19, 0x0a, 0xeb, 0xa7, 0xa6, 0x2a, 0x15, 0x9e, 0x1d, 0x31, 0x18, 0x1c, 0x13, 0x36, 0x3e,
+    0x3b, 0x2f, 0x3c, 0x2a, 0x11, 0xc0, 0xfe, 0x3f, 0x3d, 0x1d, 0x2c, 0xd6, 0x1b, 0x3c, 0x04, 0xbc,
+    0xa8, 0x01, 0x22, 0x13, 0x35, 0x39, 0x3b, 0xc5, 0x06, 0x43, 0xce, 0x20, 0x37, 0x39, 0x1b, 0xd1,
+    0xdf, 0x2e, 0x18, 0x3b, 0x32, 0x41, 0x3b, 0x35, 0x22, 0x3b, 0x36, 0xf7, 0x2f, 0xa3, 0x3a, 0x02,
+    0x64, 0x2c, 0x30, 0x4e, 0x37, 0x2a, 0x03, 0xad, 0x0e, 0x2a, 0xf3, 0x21, 0x3c, 0x21, 0x24, 0x2a,
+    0x2b, 0x6b, 0x38, 0x4b, 0x3c, 0x89, 0x55, 0x14, 0x3f, 0x84, 0x0f, 0x0d, 0x08, 0x05, 0x64, 0x29,
+    0x31, 0xa0, 0x25, 0x00, 0x65, 0x2d, 0x8d, 0x0a, 0x0e, 0x38, 0x25, 0x13, 0x09, 0x1c, 0x03, 0x33,
+    0x7a, 0xd7, 0x0b, 0xc3, 0x0f, 0xd1, 0x36, 0x16, 0x2a, 0x2c, 0xe1, 0x0a, 0xb7, 0x84, 0x48, 0x3f,
+    0xea, 0x26, 0x68, 0x34, 0x2e, 0x7b, 0x1f, 0x5c, 0x8e, 0xe1, 0x59, 0x28, 0xc7, 0x07, 0x06, 0xb7,
+    0x3b, 0xe3, 0x48, 0x4e, 0x21, 0x3c, 0x29, 0x05, 0x1a, 0x9e, 0xc9, 0x33, 0x78, 0x22, 0x10, 0xb7,
+    0xdd, 0x1e, 0xaa, 0x12, 0x22, 0x1b, 0x09, 0x30, 0x3c, 0xf1, 0x25, 0x1d, 0x0f, 0x25, 0xf4, 0xfa,
+    0x37, 0x0d, 0x30, 0x65, 0x18, 0x7b, 0x1f, 0x57, 0xce, 0xec, 0x77, 0xc8, 0x60, 0x2f, 0xbd, 0x33,
+    0x93, 0xaf, 0x3a, 0x74, 0x66, 0x12, 0x15, 0xbb, 0x14, 0xef, 0x1c, 0xc2, 0x65, 0xfc, 0x76, 0x8a,
+    0x1f, 0x21, 0x27, 0x32, 0x09, 0x95, 0x26, 0x6f, 0x1d, 0x3b, 0xcf, 0x48, 0x28, 0x0c, 0x18, 0x1d,
+    0x3e, 0x32, 0x35, 0x37, 0x6e, 0xba, 0x2f, 0x25, 0x92, 0x0c, 0x39, 0x01, 0x15, 0xb4, 0xe7, 0x31,
+    0x66, 0x5b, 0x90, 0x2a, 0x26, 0x31, 0x44, 0x3b, 0x2f, 0x1a, 0xae, 0x35, 0x05, 0xbe, 0x41, 0x02,
+    0x3d, 0x15, 0x9c, 0x22, 0xe2, 0xb4, 0x09, 0x6c, 0x6e, 0x98, 0x08, 0x4d, 0xba, 0xdd, 0x15, 0x24,
+    0x83, 0x10, 0xb3, 0x24, 0x2a, 0x1b, 0x0f, 0xc9, 0xe4, 0xf4, 0x19, 0xc7, 0x17, 0xf3, 0x08, 0x3b,
+    0x2e, 0xff, 0x3a, 0x30, 0xed, 0x2d, 0x61, 0x3f, 0xa6, 0x10, 0x2f, 0x26, 0x98, 0x3b, 0x37, 0x13,
+    0x3e, 0x3b, 0x6a, 0xfa, 0x0f, 0x0e, 0x23, 0x3a, 0x3a, 0x71, 0x15, 0x13, 0x13, 0x57, 0xff, 0x26,
+    0x14, 0x70, 0x5d, 0x06, 0x38, 0x03, 0xd1, 0x04, 0x80, 0x59, 0xe3, 0x3f, 0x50, 0x02, 0x5f, 0x05,
+    0xa8, 0x17, 0x02, 0x5b, 0x19, 0x73, 0x6c, 0x3e, 0x3a, 0x9f, 0x29, 0x0c, 0x7b, 0xc5, 0x7f, 0x4a,
+    0xe2, 0x28, 0x33, 0x18, 0x04, 0x3f, 0x10, 0xc7, 0x61, 0xbe, 0xff, 0x2e, 0x7e, 0x0e, 0x2d, 0x13,
+    0x1b, 0x28, 0xca, 0x16, 0x16, 0x14, 0xd0, 0x39, 0x25, 0xb3, 0x13, 0x34, 0x25, 0x1a, 0x70, 0x31,
+    0x07, 0x16, 0x4d, 0xb4, 0x02, 0xd0, 0x77, 0x02, 0x19, 0x93, 0x6e, 0x0a, 0x0e, 0xc7, 0x27, 0x21,
+    0x04, 0xeb, 0x1a, 0x25, 0x89, 0x37, 0x3a, 0x20, 0x0b, 0x5e, 0x2c, 0x16, 0x32, 0x2e, 0x08, 0x81,
+    0x0c, 0x24, 0xb0, 0x74, 0x2f, 0xf1, 0x2a, 0x92, 0x37, 0x2e, 0x1a, 0x03, 0x16, 0x2d, 0x3f, 0x3b,
+    0x1a, 0x1a, 0xfe, 0x8c, 0x1f, 0x09, 0x85, 0x0f, 0x50, 0x57, 0x31, 0x01, 0x0e, 0x12, 0x0a, 0xf5,
+    0x32, 0x21, 0x19, 0xa4, 0xae, 0x22, 0x29, 0x1d, 0x26, 0xd2, 0x64, 0x71, 0x2f, 0x1e, 0x28, 0x3a,
+    0xaa, 0x3b, 0x20, 0x76, 0x26, 0x29, 0x0b, 0x2f, 0x39, 0xc9, 0x04, 0x31, 0x7d, 0x22, 0x35, 0x63,
+    0x7c, 0x1a, 0x07, 0x10, 0x3f, 0x3b, 0x19, 0x33, 0x37, 0x41, 0x70, 0x11, 0x04, 0x1d, 0x29, 0xb6,
+    0x37, 0x00, 0x35, 0x06, 0x30, 0x2e, 0x75, 0x05, 0x08, 0x38, 0x0c, 0x94, 0x95, 0xe3, 0x52, 0x2f,
+    0x53, 0x00, 0x7e, 0x0b, 0x42, 0x34, 0x55, 0x32, 0x38, 0xbe, 0xe3, 0x4d, 0x0a, 0x3f, 0x23, 0x88,
+    0x07, 0xa3, 0xed, 0x3c, 0x7f, 0x23, 0x23, 0x76, 0x15, 0x1b, 0x41, 0x11, 0x02, 0xdb, 0xa9, 0x36,
+    0x3d, 0xb3, 0x19, 0x2d, 0x37, 0x03, 0x23, 0x15, 0x82, 0x98, 0xc2, 0x70, 0x1e, 0x3b, 0xbf, 0x81,
+    0x10, 0x3c, 0x08, 0x32, 0x03, 0x12, 0x23, 0xfb, 0x36, 0xb6, 0x1d, 0x04, 0x03, 0xa1, 0x39, 0x1b,
+    0xf2, 0x3d, 0xc1, 0xe0, 0x3e, 0x38, 0x4f, 0xd5, 0x29, 0x1e, 0x24, 0x0b, 0x0c, 0x1c, 0x0d, 0xf0,
+    0x3d, 0x06, 0x14, 0x4e, 0x0b, 0xf8, 0xb0, 0x16, 0xcc, 0x62, 0x03, 0x6d, 0x0f, 0x1b, 0x13, 0x31,
+    0x2c, 0x18, 0x03, 0x3c, 0x3d, 0x53, 0x0f, 0x10, 0x9b, 0x0a, 0xa5, 0xb9, 0xf1, 0x20, 0xa7, 0x20,
+    0x34, 0xa7, 0x1f, 0x2c, 0x08, 0x17, 0x29, 0x3d, 0x9a, 0x77, 0xb1, 0xf1, 0x3d, 0x34, 0x6c, 0x9f,
+    0xf0, 0xa4, 0x18, 0x31, 0x25, 0x21, 0x11, 0xea, 0x71, 0x37, 0x1b, 0xda, 0x2a, 0xd6, 0x39, 0x2d,
+    0x90, 0xf8, 0x2e, 0xd4, 0xb8, 0x38, 0x22, 0x24, 0x23, 0x2f, 0x04, 0x24, 0x2f, 0x36, 0xa0, 0x0a,
+    0x40, 0x30, 0x09, 0x1f, 0xe0, 0xa0, 0x5e, 0x35, 0x20, 0xea, 0x84, 0x02, 0x30, 0x38, 0xd0, 0xa6,
+    0x11, 0x5a, 0x2d, 0x26, 0x1d, 0x26, 0xbe, 0x10, 0x3c, 0xe7, 0xed, 0x75, 0x05, 0x55, 0x5b, 0x3f,
+    0x28, 0x38, 0x13, 0x1b, 0x04, 0x11, 0x20, 0x82, 0x2b, 0x1e, 0x69, 0x13, 0x02, 0x37, 0xaa, 0xae,
+    0x09, 0x0d, 0xd8, 0x33, 0x6b, 0x29, 0x1c, 0xd1, 0x2c, 0x07, 0x09, 0x06, 0xca, 0xa7, 0x29, 0x5c,
+    0x36, 0xc1, 0x13, 0x31, 0xbe, 0x1f, 0x3b, 0xa7, 0x24, 0x1e, 0xa6, 0x15, 0xd9, 0x05, 0x34, 0x0e,
+    0x25, 0x07, 0x09, 0x35, 0x1e, 0xc9, 0x05, 0x34, 0x69, 0x90, 0x07, 0x82, 0x28, 0x30, 0x3c, 0x16,
+    0x85, 0xc5, 0xd3, 0xf7, 0x60, 0x5a, 0x33, 0xdf, 0xab, 0xe5, 0x7f, 0xec, 0xc6, 0x26, 0x74, 0x26,
+    0x01, 0xca, 0x03, 0x26, 0x35, 0x3d, 0x03, 0xf3, 0xea, 0x26, 0x25, 0x8e, 0x0d, 0x04, 0x2b, 0x2e,
+    0x26, 0x2c, 0x01, 0x0f, 0xdd, 0x08, 0xcf, 0x2c, 0x21, 0x50, 0x16, 0x3a, 0x18, 0x0e, 0xd1, 0x07,
+    0x16, 0x00, 0x94, 0xb7, 0x00, 0x4e, 0x84, 0x13, 0x24, 0xaf, 0x47, 0x2f, 0x66, 0xf2, 0x3e, 0x2d,
+    0x02, 0x2e, 0xa2, 0x6e, 0x34, 0x4f, 0x2e, 0xbb, 0x74, 0xb6, 0x14, 0x17, 0xe7, 0xe9, 0x1b, 0xf5,
+    0xb7, 0x22, 0xf3, 0x28, 0xe1, 0x06, 0x4e, 0xe4, 0x5a, 0x39, 0x9e, 0x00, 0x5a, 0x4a, 0x04, 0x4b,
+    0xaa, 0x31, 0x31, 0x39, 0x1d, 0x1d, 0x02, 0x4a, 0x10, 0x04, 0x77, 0x06, 0xd2, 0x30, 0x16, 0x29,
+    0xb6, 0x33, 0x03, 0x13, 0xbc, 0x0d, 0x30, 0x2c, 0x30, 0x1c, 0x02, 0x34, 0x8d, 0x1c, 0x4d, 0x09,
+    0x81, 0x42, 0x9c, 0x02, 0x37, 0x10, 0x3e, 0x26, 0x12, 0x18, 0x1f, 0x03, 0x31, 0x31, 0x03, 0x2f,
+    0x25, 0x12, 0xf9, 0xf1, 0x3e, 0x0c, 0x23, 0x38, 0x23, 0x62, 0x24, 0x0f, 0x37, 0x30, 0x0c, 0x38,
+    0x23, 0x28, 0x22, 0x4a, 0xc7, 0x21, 0x00, 0x80, 0x56, 0x35, 0x76, 0x39, 0x20, 0x06, 0x19, 0x18,
+    0xf6, 0x1b, 0x72, 0x1e, 0x00, 0x17, 0x26, 0x06, 0xdb, 0x1e, 0x30, 0x32, 0x11, 0x3d, 0x34, 0x11,
+    0xb7, 0x2d, 0x09, 0x1a, 0x29, 0x0a, 0x2e, 0x17, 0x04, 0x18, 0x20, 0x32, 0x45, 0xab, 0x2b, 0x3d,
+    0xb6, 0x15, 0x01, 0xeb, 0xb1, 0x27, 0x9c, 0xa3, 0x1f, 0x02, 0x0b, 0x00, 0x1e, 0xca, 0x10, 0xe7,
+    0xfe, 0x31, 0xde, 0xe5, 0x0d, 0xe0, 0x35, 0xf9, 0x18, 0x17, 0x03, 0x02, 0x5a, 0xe4, 0x3e, 0xe6,
+    0xf8, 0x07, 0x15, 0x61, 0x28, 0x1f, 0x3f, 0xd6, 0x1a, 0x5b, 0x3b, 0xf6, 0x22, 0x70, 0x77, 0xa6,
+    0x00, 0xe9, 0x44, 0x3e, 0x69, 0x06, 0x24, 0x2b, 0x0c, 0x00, 0x2e, 0x0e, 0x55, 0xd2, 0xe7, 0x1e,
+    0x71, 0x3d, 0x0e, 0xd9, 0x1c, 0x24, 0x93, 0x3d, 0x6c, 0x1e, 0x39, 0x17, 0x27, 0x0a, 0x37, 0x1e,
+    0x0f, 0x7f, 0x05, 0xe2, 0xfa, 0x8f, 0x36, 0x04, 0x25, 0x35, 0x27, 0x03, 0x02, 0xb4, 0xa2, 0x06,
+    0x38, 0x0c, 0x20, 0x38, 0x65, 0x19, 0x2f, 0xb7, 0x31, 0x14, 0x95, 0x2a, 0xad, 0x6f, 0xd5, 0x2b,
+    0x00, 0xa9, 0x4b, 0x2c, 0x15, 0x1b, 0x23, 0x09, 0x3a, 0x3d, 0x14, 0x17, 0x7c, 0x38, 0x17, 0x0f,
+    0x3d, 0x0f, 0x1a, 0x3d, 0xce, 0x26, 0x2a, 0x18, 0x1d, 0x97, 0x35, 0x1e, 0x2c, 0x3b, 0x17, 0x3e,
+    0x86, 0x23, 0xf3, 0x7f, 0x00, 0xe5, 0x01, 0x0d, 0x3b, 0x06, 0x3e, 0x0c, 0x5c, 0x62, 0x81, 0xf1,
+    0x23, 0x32, 0xaa, 0x44, 0x18, 0xdf, 0x1f, 0xd2, 0x2f, 0x21, 0xb3, 0x28, 0x4b, 0x1e, 0x2a, 0x64,
+    0x2a, 0x34, 0x1b, 0x18, 0x2e, 0x04, 0xec, 0x12, 0xaa, 0xc4, 0x24, 0xc5, 0xfc, 0x11, 0x67, 0x06,
+    0x0e, 0x98, 0xff, 0x3f, 0xa2, 0x1f, 0x07, 0x7d, 0x07, 0x0d, 0xa6, 0x10, 0x53, 0xdb, 0x2b, 0x08,
+    0x06, 0x30, 0x9a, 0xc7, 0x34, 0x6d, 0x2a, 0xfa, 0x1c, 0x52, 0x24, 0x39, 0xe4, 0x25, 0x13, 0x31,
+    0x13, 0x23, 0x10, 0x1e, 0x31, 0x2d, 0x2c, 0xd0, 0x02, 0x36, 0x33, 0xd2, 0x0e, 0x69, 0x2b, 0x00,
+    0x6d, 0x32, 0x31, 0xe0, 0xde, 0x53, 0x66, 0x96, 0x20, 0x0c, 0x03, 0x0f, 0x25, 0xce, 0x9b, 0x0c,
+    0x8c, 0x57, 0x02, 0x38, 0x35, 0x35, 0x59, 0x24, 0x00, 0x0d, 0xa1, 0x01, 0x22, 0x4b, 0x25, 0x32,
+    0xfd, 0x44, 0x00, 0x61, 0x2c, 0x1b, 0x06, 0xf7, 0x15, 0x0a, 0x85, 0x02, 0x57, 0x22, 0x09, 0xe3,
+    0x1d, 0x0d, 0x1d, 0x00, 0x0b, 0x37, 0xd1, 0x00, 0x28, 0xe6, 0x3f, 0x24, 0x26, 0x9e, 0x25, 0x11,
+    0xf7, 0xb8, 0xea, 0x29, 0xbe, 0x3b, 0xdb, 0x1d, 0x05, 0x1a, 0x3e, 0x26, 0x83, 0x60, 0x67, 0x35,
+    0x20, 0x89, 0xf4, 0x14, 0x0b, 0x06, 0xf9, 0x0d, 0x12, 0x19, 0x29, 0x97, 0x34, 0x06, 0xd9, 0x2a,
+    0x00, 0x1a, 0xcd, 0xe6, 0x39, 0x73, 0xd8, 0x23, 0x0a, 0x11, 0x17, 0x15, 0x60, 0x0a, 0x08, 0xf6,
+    0x48, 0x3e, 0x3c, 0xd5, 0x9c, 0x20, 0x17, 0x59, 0x13, 0xf7, 0x15, 0xae, 0x8a, 0xb9, 0x00, 0x12,
+    0x5c, 0x12, 0x03, 0x34, 0x47, 0x18, 0x34, 0xc3, 0x8d, 0x19, 0x21, 0xa8, 0x22, 0x73, 0x95, 0x02,
+    0x00, 0x20, 0x13, 0x1c, 0x7c, 0xff, 0x0e, 0x2f, 0x37, 0x25, 0xc7, 0x05, 0x1c, 0x97, 0xb8, 0x32,
+    0x8a, 0x70, 0x38, 0xa9, 0x16, 0x31, 0x28, 0x0d, 0x75, 0x21, 0x2b, 0xdd, 0x2b, 0xb0, 0x54, 0x18,
+    0x27, 0x2e, 0xb0, 0x5a, 0x3d, 0x27, 0x68, 0xa2, 0xd6, 0x2e, 0xfa, 0x19, 0x16, 0xd5, 0x03, 0x4c,
+    0x11, 0xf1, 0x13, 0x3b, 0x32, 0x17, 0x38, 0x18, 0x0b, 0x1e, 0x3b, 0xc7, 0x25, 0x31, 0x0c, 0x05,
+    0x92, 0x9e, 0xa1, 0x0e, 0x18, 0x3a, 0x26, 0x85, 0x72, 0x86, 0xdf, 0x30, 0x1a, 0x10, 0x9b, 0x16,
+    0x6d, 0x2e, 0x1c, 0x0c, 0x7a, 0x02, 0x24, 0x26, 0x19, 0x33, 0x24, 0x72, 0xcf, 0x21, 0x1e, 0x2f,
+    0x39, 0x33, 0x16, 0x83, 0xad, 0x2b, 0x88, 0xed, 0xce, 0x15, 0xb9, 0x15, 0x08, 0xe8, 0x19, 0x00,
+    0x2b, 0x61, 0x1d, 0x38, 0x3f, 0x07, 0x18, 0x62, 0x08, 0x3c, 0x29, 0x12, 0x25, 0x39, 0x11, 0xab,
+    0xc1, 0x09, 0x3d, 0xe8, 0x90, 0x07, 0x55, 0x1b, 0x17, 0x94, 0xaa, 0x39, 0x22, 0xb0, 0xee, 0x2a,
+    0x3e, 0xd7, 0xbe, 0x1b, 0x70, 0x1b, 0x0a, 0xba, 0x8b, 0x49, 0x2c, 0x1d, 0x11, 0x0c, 0x2e, 0xd9,
+    0x9d, 0xe8, 0x3a, 0x27, 0xc6, 0x25, 0x3f, 0x26, 0xfb, 0xb3, 0x3a, 0x0c, 0x38, 0x95, 0x08, 0x36,
+    0x1c, 0x44, 0x00, 0x10, 0x79, 0x22, 0x39, 0x37, 0x3c, 0xa4, 0x01, 0x35, 0x0b, 0x86, 0x1d, 0x2b,
+    0x20, 0x6c, 0x10, 0x01, 0x0d, 0xdf, 0x31, 0x13, 0x24, 0xea, 0x60, 0x0f, 0x92, 0xe8, 0x3d, 0x23,
+    0x98, 0xcb, 0x34, 0x17, 0x1c, 0xca, 0x39, 0x0c, 0x10, 0xc0, 0x05, 0xe2, 0x4e, 0x12, 0x2a, 0x29,
+    0x9b, 0x28, 0x1c, 0x35, 0x09, 0x46, 0xad, 0xa9, 0x1c, 0x70, 0xc2, 0x19, 0xe9, 0x86, 0x82, 0x12,
+    0x2c, 0xfb, 0x0b, 0x3a, 0x4c, 0x14, 0x0f, 0x30, 0xd2, 0x36, 0xa1, 0xe2, 0x69, 0x35, 0x13, 0xf6,
+    0x9c, 0x0c, 0x27, 0x3d, 0x03, 0x15, 0x3e, 0xeb, 0x36, 0x3e, 0x01, 0x1d, 0x2c, 0x81, 0xae, 0x0e,
+    0x27, 0x08, 0x3d, 0x42, 0x2b, 0x16, 0xa5, 0x0b, 0x29, 0x0b, 0x3a, 0xe6, 0x49, 0x35, 0x48, 0x01,
+    0xf6, 0xe8, 0x32, 0x20, 0x26, 0xb9, 0x14, 0x49, 0x55, 0x07, 0x55, 0x0c, 0x39, 0xec, 0x3f, 0x26,
+    0x25, 0x17, 0x0e, 0x0d, 0x00, 0x64, 0xf0, 0x17, 0x1f, 0x97, 0x3e, 0x13, 0x1c, 0x11, 0x25, 0x0f,
+    0x0c, 0x20, 0x17, 0x5b, 0x57, 0x96, 0x1d, 0x2d, 0x2d, 0x62, 0xc1, 0x19, 0x29, 0x0f, 0x0a, 0x1e,
+    0xc5, 0xad, 0x04, 0x6d, 0x0a, 0x20, 0x58, 0xbf, 0xb6, 0x3b, 0x0d, 0xf0, 0x76, 0x9f, 0x26, 0x7a,
+    0x89, 0x0c, 0x2b, 0x02, 0x7a, 0xc5, 0x0f, 0x19, 0x02, 0x03, 0x61, 0x74, 0x36, 0x0e, 0x80, 0x27,
+    0xe0, 0xb5, 0xac, 0xac, 0x63, 0xf8, 0x26, 0x81, 0x64, 0x1c, 0xec, 0xdb, 0xf1, 0x0e, 0x8f, 0x05,
+    0x0c, 0xce, 0x18, 0x36, 0x32, 0xcd, 0x4b, 0x17, 0xc4, 0x2a, 0x3b, 0x2b, 0x53, 0x7e, 0x34, 0x24,
+    0x0f, 0x0b, 0x04, 0x30, 0x10, 0x61, 0x04, 0xa8, 0x2e, 0x9b, 0x2e, 0x04, 0x1e, 0xdb, 0x13, 0xe6,
+    0x33, 0x08, 0x1e, 0x73, 0x3b, 0x45, 0x3a, 0x02, 0x23, 0xb0, 0x05, 0x06, 0x09, 0x00, 0x39, 0x4e,
+    0x3e, 0x31, 0x20, 0x06, 0xe6, 0x10, 0x10, 0xa6, 0xf7, 0x71, 0x05, 0x02, 0xfe, 0x05, 0x04, 0x36,
+    0x2f, 0x3f, 0x72, 0x2c, 0x38, 0x2f, 0x2c, 0x03, 0x10, 0x37, 0x30, 0x03, 0x59, 0x3a, 0x7a, 0x1e,
+    0x5b, 0xee, 0x11, 0x2c, 0x9f, 0xba, 0x18, 0xc2, 0x04, 0x0c, 0x25, 0x1e, 0x3b, 0xdf, 0x4a, 0x1e,
+    0x26, 0x09, 0x87, 0x06, 0x27, 0x12, 0x3f, 0x08, 0x4d, 0x2b, 0x21, 0x8d, 0x2d, 0x17, 0x33, 0x3c,
+    0x26, 0x3a, 0xe0, 0x1a, 0xe7, 0xbf, 0x0a, 0xb1, 0x0d, 0x35, 0x1b, 0x29, 0x06, 0x35, 0x05, 0x24,
+    0x25, 0x12, 0x22, 0x34, 0x17, 0x89, 0x0d, 0x00, 0x0b, 0x0f, 0x1e, 0x09, 0x23, 0x1c, 0x53, 0x08,
+    0x22, 0x14, 0x14, 0x01, 0x5f, 0x27, 0x25, 0x95, 0x30, 0x03, 0x63, 0xfb, 0x0b, 0x5f, 0x06, 0x15,
+    0x05, 0xae, 0x9f, 0xe0, 0x24, 0x2d, 0x20, 0xdc, 0x33, 0x3c, 0x72, 0x20, 0xef, 0x2f, 0x0c, 0x36,
+    0x0f, 0xa4, 0x21, 0x3e, 0x02, 0x9f, 0xf3, 0xf0, 0x8a, 0x38, 0x13, 0x4a, 0x15, 0x20, 0xbc, 0x1e,
+    0xc5, 0x08, 0x47, 0x22, 0x08, 0x1f, 0x3f, 0x2e, 0x0c, 0x01, 0x2c, 0x3f, 0x47, 0x15, 0xbd, 0x1f,
+    0x1c, 0x51, 0x08, 0x16, 0x17, 0xf3, 0x9f, 0x2c, 0x6f, 0x3f, 0x36, 0xcb, 0xa4, 0xa2, 0x04, 0x21,
+    0x32, 0xac, 0x38, 0x05, 0x3f, 0x09, 0x42, 0x02, 0x57, 0xea, 0x1e, 0xe1, 0x98, 0x30, 0x02, 0x39,
+    0x3e, 0x11, 0x01, 0x38, 0xca, 0x25, 0x2c, 0x2d, 0xba, 0x26, 0x0e, 0xc1, 0x0e, 0x49, 0x3e, 0x11,
+    0x26, 0x0d, 0x37, 0x73, 0x10, 0xcb, 0x32, 0x18, 0xeb, 0xf3, 0x2d, 0x1c, 0x7e, 0x18, 0x1c, 0x2e,
+    0x09, 0xa8, 0x13, 0x30, 0x30, 0x26, 0xd9, 0xec, 0x07, 0x78, 0x0b, 0x1f, 0x48, 0x2a, 0xbc, 0xc7,
+    0x48, 0x33, 0xb2, 0xe1, 0xaa, 0x0a, 0x33, 0x95, 0x24, 0xaf, 0x2d, 0xe6, 0xb5, 0x14, 0x0d, 0x1b,
+    0x93, 0x00, 0xd7, 0x23, 0x65, 0x0e, 0x23, 0x02, 0xeb, 0xdb, 0x38, 0xa0, 0xea, 0x39, 0x9e, 0xf2,
+    0x1d, 0xff, 0x0a, 0x0d, 0x38, 0x4e, 0x1c, 0x3d, 0x18, 0xdf, 0x32, 0xc2, 0x03, 0x1a, 0xae, 0x44,
+    0x49, 0x38, 0xe4, 0x28, 0x4b, 0x11, 0x07, 0x40, 0x9d, 0xc1, 0x9e, 0x70, 0x5f, 0x16, 0xfb, 0x66,
+    0xda, 0x2c, 0x94, 0x0d, 0x96, 0x44, 0x73, 0x15, 0x2f, 0xfe, 0x2b, 0x20, 0x25, 0x25, 0x25, 0x1c,
+    0x35, 0x22, 0x86, 0x15, 0xa9, 0x1d, 0x23, 0x04, 0x19, 0x27, 0x01, 0x53, 0x0f, 0x05, 0xe0, 0x20,
+    0x2b, 0xff, 0x0a, 0xb8, 0x4f, 0x25, 0x16, 0x18, 0x30, 0xc1, 0x2c, 0x2c, 0xbd, 0x91, 0x44, 0x54,
+    0x96, 0x22, 0x04, 0x9c, 0x05, 0x0a, 0x0f, 0x55, 0x25, 0x0d, 0xf3, 0x24, 0xd5, 0x1a, 0x23, 0x09,
+    0xd9, 0x11, 0xeb, 0x12, 0x12, 0x15, 0x5a, 0x30, 0x19, 0x1a, 0xcf, 0x89, 0x1c, 0x3a, 0x63, 0x21,
+    0xd1, 0x30, 0x32, 0xca, 0x29, 0xab, 0x21, 0xc0, 0x47, 0x85, 0x16, 0xc7, 0x34, 0x16, 0x1f, 0x6c,
+    0x11, 0x05, 0x33, 0xf2, 0x17, 0xa9, 0x36, 0x36, 0x1d, 0x22, 0x00, 0x83, 0x25, 0x36, 0xd1, 0x06,
+    0x3c, 0x12, 0x2a, 0x2e, 0x3e, 0x29, 0x0d, 0x81, 0x2f, 0x70, 0x0d, 0x0f, 0x22, 0x27, 0xc1, 0x2b,
+    0x13, 0x57, 0x36, 0x39, 0x9f, 0x35, 0xde, 0x27, 0x25, 0xe6, 0x6d, 0xae, 0x6d, 0x60, 0x8b, 0x32,
+    0xd9, 0x1d, 0x24, 0xab, 0x14, 0x16, 0x09, 0xf3, 0x28, 0xaa, 0x3e, 0xe1, 0x3f, 0xda, 0xcd, 0x0f,
+    0x02, 0x32, 0x2a, 0x1b, 0xb3, 0x29, 0xed, 0x23, 0xd9, 0x1c, 0x1b, 0x96, 0xa8, 0x04, 0x07, 0xa9,
+    0xe1, 0x1b, 0x12, 0xab, 0x23, 0xc2, 0x08, 0x8f, 0x24, 0x13, 0xf6, 0x04, 0xa1, 0x14, 0x1b, 0x1c,
+    0x1e, 0x12, 0x92, 0x24, 0xe7, 0x36, 0xc7, 0xe8, 0xd6, 0x10, 0x10, 0xa7, 0x95, 0x9b, 0x78, 0x1d,
+    0x08, 0x00, 0x24, 0x31, 0x28, 0x27, 0x3d, 0x10, 0x6b, 0x22, 0x06, 0x12, 0x04, 0xcc, 0x1a, 0x2a,
+    0xb6, 0x18, 0x38, 0x4c, 0xfa, 0x12, 0x0d, 0x38, 0x3d, 0x14, 0xca, 0x25, 0xd0, 0x27, 0x78, 0xa7,
+    0xe3, 0xdb, 0x22, 0x57, 0xd8, 0x0f, 0xc5, 0x63, 0x10, 0xd5, 0x18, 0x25, 0x81, 0x3d, 0x45, 0x4f,
+    0x09, 0x89, 0x3e, 0x90, 0xce, 0xbb, 0x36, 0x8f, 0xac, 0x26, 0x28, 0x14, 0x37, 0xe5, 0x1e, 0x20,
+    0xab, 0x4b, 0xcb, 0x14, 0x1b, 0x6a, 0x87, 0x1b, 0x2d, 0xf7, 0x33, 0x2b, 0x83, 0xed, 0x09, 0x07,
+    0x02, 0x0c, 0x5f, 0x01, 0xb0, 0x0b, 0x09, 0x2d, 0x24, 0xc4, 0x86, 0xe2, 0x23, 0x01, 0x27, 0x23,
+    0x3c, 0x0a, 0x1d, 0x08, 0x94, 0x3b, 0x11, 0x11, 0x4e, 0x47, 0xd4, 0x0f, 0x00, 0x0b, 0x36, 0x39,
+    0x7b, 0x13, 0x48, 0x10, 0x90, 0x0f, 0xe5, 0xa8, 0x1e, 0x03, 0xb0, 0x10, 0x32, 0x38, 0xe0, 0x0b,
+    0x31, 0x2f, 0x36, 0x58, 0x0c, 0xa2, 0x22, 0x04, 0xcf, 0xca, 0x53, 0xaf, 0x2a, 0x9f, 0xbf, 0x4c,
+    0x19, 0x13, 0x08, 0x7f, 0xb7, 0x1b, 0x8f, 0x32, 0x34, 0x03, 0x35, 0x35, 0x7c, 0x36, 0xec, 0x0c,
+    0xe2, 0x39, 0x32, 0x86, 0x26, 0xc5, 0x2d, 0x1d, 0x17, 0x2e, 0x1d, 0x75, 0x34, 0xef, 0x53, 0x30,
+    0x9b, 0x00, 0x87, 0x0f, 0x0c, 0x36, 0x10, 0x2b, 0x0c, 0x17, 0x25, 0x3a, 0x34, 0x23, 0xaf, 0x3d,
+    0x30, 0x70, 0x85, 0xd6, 0x0a, 0x25, 0x3c, 0xff, 0x20, 0x19, 0x6d, 0xfe, 0x2b, 0x29, 0x0d, 0x1f,
+    0x02, 0x43, 0x0b, 0xd5, 0x86, 0x28, 0x23, 0x20, 0x18, 0x6c, 0x14, 0xe6, 0x3d, 0x84, 0xd8, 0x05,
+    0xb4, 0xec, 0x22, 0x19, 0x0f, 0xa6, 0x40, 0x24, 0x4a, 0xa6, 0x8c, 0x13, 0x3b, 0xa3, 0x34, 0x1f,
+    0x6e, 0x14, 0x39, 0x0d, 0x03, 0x04, 0xe5, 0xbe, 0x29, 0x16, 0x35, 0xf2, 0xd4, 0x1d, 0x3a, 0xf3,
+    0x1e, 0xa3, 0x10, 0x1c, 0x34, 0x1e, 0x65, 0x24, 0xe9, 0x23, 0x22, 0x39, 0x28, 0x09, 0x02, 0x10,
+    0x11, 0x31, 0x28, 0x3e, 0x32, 0x0d, 0x1d, 0xff, 0x28, 0x80, 0x37, 0x86, 0x3a, 0x2f, 0x2d, 0x0b,
+    0x12, 0x10, 0x03, 0xfb, 0x0e, 0x14, 0x44, 0x0f, 0x5c, 0x05, 0x90, 0x2c, 0x37, 0x71, 0x6b, 0xc3,
+    0xd8, 0x06, 0x2e, 0x9a, 0x54, 0x11, 0x9c, 0x80, 0x21, 0x0a, 0x05, 0x3b, 0xd6, 0x13, 0x03, 0x27,
+    0x0c, 0x39, 0x2e, 0x19, 0x3d, 0x2f, 0xa0, 0x28, 0x1c, 0x31, 0xa3, 0x1c, 0x34, 0x65, 0xdf, 0x1c,
+    0x36, 0xad, 0x02, 0xd7, 0x7f, 0x0b, 0x05, 0x36, 0x0c, 0x86, 0x33, 0x89, 0x15, 0x18, 0x95, 0x1f,
+    0xd2, 0x3c, 0x25, 0x78, 0x9c, 0x0e, 0x3a, 0x10, 0xac, 0x37, 0x46, 0xae, 0x7b, 0x2a, 0x37, 0x39,
+    0x0c, 0x10, 0x69, 0x09, 0x76, 0x04, 0xbe, 0x00, 0x81, 0x0e, 0x33, 0x0b, 0x2e, 0xf4, 0x0d, 0x2a,
+    0x13, 0xb3, 0x3e, 0x00, 0x25, 0xaa, 0x3d, 0x55, 0x19, 0x49, 0xfa, 0x1b, 0xdd, 0x41, 0x2f, 0x3e,
+    0xd9, 0xd6, 0x24, 0x9a, 0x1d, 0x25, 0x91, 0x1c, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+};
+
+static const uint8_t patch[928] = {
+    0x57, 0x44, 0x50, 0x31, 0x40, 0x1f, 0x00, 0x00, 0xb0, 0x1e, 0x00, 0x00, 0x7a, 0x70, 0x0f, 0xfa,
+    0xc7, 0xd8, 0xae, 0xa4, 0xa5, 0x76, 0x55, 0xa8, 0xd4, 0x8a, 0x93, 0x88, 0x7f, 0xb4, 0x7a, 0xe5,
+    0x55, 0x91, 0xd9, 0x96, 0x9a, 0xa9, 0x2b, 0x62, 0x63, 0x61, 0x69, 0x27, 0x75, 0x9c, 0x8a, 0x1c,
+    0xf0, 0xf8, 0x56, 0x12, 0x7e, 0xed, 0x50, 0x4b, 0xe5, 0xc4, 0xef, 0xb4, 0x09, 0x48, 0x9d, 0x94,
+    0x43, 0x33, 0x5a, 0xeb, 0x99, 0x4c, 0x80, 0x41, 0x7c, 0x50, 0xa3, 0xbf, 0x01, 0x00, 0xb0, 0x09,
+    0x02, 0xd8, 0x01, 0x6e, 0x65, 0x77, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+    0x62, 0x6f, 0x64, 0x79, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x66, 0x75, 0x6e,
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x66,
+    0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x6e, 0x65, 0x77,
+    0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x6e,
+    0x65, 0x77, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x6f, 0x64, 0x79,
+    0x20, 0x6e, 0x65, 0x77, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x6f,
+    0x64, 0x79, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20,
+    0x62, 0x6f, 0x64, 0x79, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74, 0x69, 0x6f,
+    0x6e, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x66, 0x75, 0x6e, 0x63, 0x74,
+    0x69, 0x6f, 0x6e, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x6e, 0x65, 0x77, 0x20, 0x66, 0x75, 0x6e,
+    0x63, 0x74, 0x69, 0x6f, 0x6e, 0x20, 0x62, 0x6f, 0x64, 0x79, 0x20, 0x01, 0xb0, 0x09, 0xf0, 0x15,
+    0x02, 0x01, 0x11, 0x01, 0x89, 0x27, 0x17, 0x03, 0xa0, 0x27, 0x01, 0x03, 0x01, 0xa1, 0x27, 0x17,
+    0x03, 0xb8, 0x27, 0x01, 0x03, 0x01, 0xb9, 0x27, 0x17, 0x03, 0xd0, 0x27, 0x01, 0x03, 0x01, 0xd1,
+    0x27, 0x17, 0x03, 0xe8, 0x27, 0x01, 0x03, 0x01, 0xe9, 0x27, 0x17, 0x03, 0x80, 0x28, 0x01, 0x03,
+    0x01, 0x81, 0x28, 0x17, 0x03, 0x98, 0x28, 0x01, 0x03, 0x01, 0x99, 0x28, 0x17, 0x03, 0xb0, 0x28,
+    0x01, 0x03, 0x01, 0xb1, 0x28, 0x17, 0x03, 0xc8, 0x28, 0x01, 0x03, 0x01, 0xc9, 0x28, 0x17, 0x03,
+    0xe0, 0x28, 0x01, 0x03, 0x01, 0xe1, 0x28, 0x17, 0x03, 0xf8, 0x28, 0x01, 0x03, 0x01, 0xf9, 0x28,
+    0x17, 0x03, 0x90, 0x29, 0x01, 0x03, 0x01, 0x91, 0x29, 0x17, 0x03, 0xa8, 0x29, 0x01, 0x03, 0x01,
+    0xa9, 0x29, 0x17, 0x03, 0xc0, 0x29, 0x01, 0x03, 0x01, 0xc1, 0x29, 0x17, 0x03, 0xd8, 0x29, 0x01,
+    0x03, 0x01, 0xd9, 0x29, 0x17, 0x03, 0xf0, 0x29, 0x01, 0x03, 0x01, 0xf1, 0x29, 0x17, 0x03, 0x88,
+    0x2a, 0x01, 0x03, 0x01, 0x89, 0x2a, 0x17, 0x03, 0xa0, 0x2a, 0x01, 0x03, 0x01, 0xa1, 0x2a, 0x17,
+    0x03, 0xb8, 0x2a, 0x01, 0x03, 0x01, 0xb9, 0x2a, 0x17, 0x03, 0xd0, 0x2a, 0x01, 0x03, 0x01, 0xd1,
+    0x2a, 0x17, 0x03, 0xe8, 0x2a, 0x01, 0x03, 0x01, 0xe9, 0x2a, 0x17, 0x03, 0x80, 0x2b, 0x01, 0x03,
+    0x01, 0x81, 0x2b, 0x17, 0x03, 0x98, 0x2b, 0x01, 0x03, 0x01, 0x99, 0x2b, 0x17, 0x03, 0xb0, 0x2b,
+    0x01, 0x03, 0x01, 0xb1, 0x2b, 0x17, 0x03, 0xc8, 0x2b, 0x01, 0x03, 0x01, 0xc9, 0x2b, 0x17, 0x03,
+    0xe0, 0x2b, 0x01, 0x03, 0x01, 0xe1, 0x2b, 0x17, 0x03, 0xf8, 0x2b, 0x01, 0x03, 0x01, 0xf9, 0x2b,
+    0x17, 0x03, 0x90, 0x2c, 0x01, 0x03, 0x01, 0x91, 0x2c, 0x17, 0x03, 0xa8, 0x2c, 0x01, 0x03, 0x01,
+    0xa9, 0x2c, 0x17, 0x03, 0xc0, 0x2c, 0x01, 0x03, 0x01, 0xc1, 0x2c, 0x17, 0x03, 0xd8, 0x2c, 0x01,
+    0x03, 0x01, 0xd9, 0x2c, 0x17, 0x03, 0xf0, 0x2c, 0x01, 0x03, 0x01, 0xf1, 0x2c, 0x17, 0x03, 0x88,
+    0x2d, 0x01, 0x03, 0x01, 0x89, 0x2d, 0x17, 0x03, 0xa0, 0x2d, 0x01, 0x03, 0x01, 0xa1, 0x2d, 0x17,
+    0x03, 0xb8, 0x2d, 0x01, 0x03, 0x01, 0xb9, 0x2d, 0x17, 0x03, 0xd0, 0x2d, 0x01, 0x03, 0x01, 0xd1,
+    0x2d, 0x17, 0x03, 0xe8, 0x2d, 0x01, 0x03, 0x01, 0xe9, 0x2d, 0x17, 0x03, 0x80, 0x2e, 0x01, 0x03,
+    0x01, 0x81, 0x2e, 0x17, 0x03, 0x98, 0x2e, 0x01, 0x03, 0x01, 0x99, 0x2e, 0x17, 0x03, 0xb0, 0x2e,
+    0x01, 0x03, 0x01, 0xb1, 0x2e, 0x17, 0x03, 0xc8, 0x2e, 0x01, 0x03, 0x01, 0xc9, 0x2e, 0x17, 0x03,
+    0xe0, 0x2e, 0x01, 0x03, 0x01, 0xe1, 0x2e, 0x17, 0x03, 0xf8, 0x2e, 0x01, 0x03, 0x01, 0xf9, 0x2e,
+    0x17, 0x03, 0x90, 0x2f, 0x01, 0x03, 0x01, 0x91, 0x2f, 0x17, 0x03, 0xa8, 0x2f, 0x01, 0x03, 0x01,
+    0xa9, 0x2f, 0x17, 0x03, 0xc0, 0x2f, 0x01, 0x03, 0x01, 0xc1, 0x2f, 0x17, 0x03, 0xd8, 0x2f, 0x01,
+    0x03, 0x01, 0xd9, 0x2f, 0x17, 0x03, 0xf0, 0x2f, 0x01, 0x03, 0x01, 0xf1, 0x2f, 0x17, 0x03, 0x88,
+    0x30, 0x01, 0x03, 0x01, 0x89, 0x30, 0x17, 0x03, 0xa0, 0x30, 0x01, 0x03, 0x01, 0xa1, 0x30, 0x17,
+    0x03, 0xb8, 0x30, 0x01, 0x03, 0x01, 0xb9, 0x30, 0x17, 0x03, 0xd0, 0x30, 0x01, 0x03, 0x01, 0xd1,
+    0x30, 0x17, 0x03, 0xe8, 0x30, 0x01, 0x03, 0x01, 0xe9, 0x30, 0x17, 0x03, 0x80, 0x31, 0x01, 0x03,
+    0x01, 0x81, 0x31, 0x17, 0x03, 0x98, 0x31, 0x01, 0x03, 0x01, 0x99, 0x31, 0x17, 0x03, 0xb0, 0x31,
+    0x01, 0x03, 0x01, 0xb1, 0x31, 0x17, 0x03, 0xc8, 0x31, 0x01, 0x03, 0x01, 0xc9, 0x31, 0x17, 0x03,
+    0xe0, 0x31, 0x01, 0x03, 0x01, 0xe1, 0x31, 0x17, 0x03, 0xf8, 0x31, 0x01, 0x03, 0x01, 0xf9, 0x31,
+    0x17, 0x03, 0x90, 0x32, 0x01, 0x03, 0x01, 0x91, 0x32, 0x17, 0x03, 0xa8, 0x32, 0x01, 0x03, 0x01,
+    0xa9, 0x32, 0x17, 0x03, 0xc0, 0x32, 0x01, 0x03, 0x01, 0xc1, 0x32, 0x17, 0x03, 0xd8, 0x32, 0x0c,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xa0, 0x1f, 0xe8,
+    0x07, 0x01, 0xe4, 0x32, 0xcc, 0x08, 0x02, 0x28, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+    0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b, 0x0b,
+};
+
+static const uint8_t gzip_patch[439] = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xdd, 0xce, 0xbd, 0x4b, 0x02, 0x71,
+    0x00, 0xc6, 0xf1, 0xfb, 0x79, 0x43, 0x49, 0x41, 0x14, 0x84, 0x4b, 0x94, 0x9b, 0xa6, 0x59, 0x69,
+    0xff, 0x40, 0x51, 0x43, 0x50, 0x83, 0x4b, 0x05, 0x6d, 0xd9, 0x0b, 0xb8, 0x58, 0x43, 0x2f, 0x14,
+    0x51, 0xd7, 0xa6, 0x4d, 0x46, 0x11, 0x5d, 0x14, 0x24, 0x15, 0x74, 0x4b, 0x9c, 0xd0, 0xa0, 0x53,
+    0x0a, 0x41, 0x0a, 0x0d, 0x0a, 0x0d, 0xe7, 0xa6, 0x50, 0x70, 0x12, 0xd1, 0xb9, 0x9d, 0x4d, 0x3d,
+    0xcf, 0xd4, 0xda, 0xdc, 0x33, 0x7d, 0x78, 0xa6, 0xef, 0xdc, 0x44, 0x38, 0x38, 0xda, 0x27, 0x49,
+    0x7a, 0xaf, 0x24, 0xed, 0xac, 0x75, 0x7c, 0x3f, 0x1b, 0xf7, 0x37, 0xb7, 0x9b, 0x33, 0x77, 0xaf,
+    0x87, 0xc7, 0xf1, 0xfd, 0x87, 0x9d, 0xf7, 0x99, 0xa3, 0xca, 0xe9, 0xb9, 0xe6, 0x8f, 0x2c, 0x2e,
+    0x44, 0x3d, 0x1b, 0x17, 0x87, 0x3d, 0x96, 0x3d, 0xdb, 0xb5, 0xf7, 0x19, 0x9e, 0x7a, 0x7f, 0xfa,
+    0x7a, 0x70, 0x4e, 0x5e, 0x9e, 0x8c, 0x8f, 0xcc, 0x7f, 0xa8, 0xd3, 0xca, 0xd8, 0x6e, 0xf8, 0xfa,
+    0x51, 0x48, 0xba, 0xd3, 0x61, 0x88, 0xd8, 0xf2, 0x96, 0x7b, 0x65, 0x23, 0xb6, 0xb8, 0x1e, 0x5d,
+    0x8d, 0xb9, 0x23, 0xab, 0x4b, 0xdb, 0xee, 0xff, 0xf1, 0x08, 0xdd, 0x69, 0x75, 0x3b, 0x44, 0xa7,
+    0x48, 0x78, 0x5c, 0xf2, 0x95, 0x47, 0xc8, 0x22, 0x05, 0x64, 0x88, 0x2c, 0x50, 0x22, 0xca, 0x80,
+    0x49, 0xd4, 0x01, 0xc5, 0x0b, 0x1c, 0x78, 0x5d, 0xf2, 0x19, 0xa1, 0x02, 0x3a, 0x91, 0x06, 0x0a,
+    0x44, 0x11, 0xa8, 0x12, 0x35, 0xc0, 0x26, 0x9a, 0x40, 0xb2, 0x1f, 0x38, 0xea, 0x77, 0xc9, 0x77,
+    0x84, 0x06, 0xe4, 0x88, 0x3c, 0x60, 0x10, 0x15, 0xc0, 0x22, 0x1a, 0x40, 0xdc, 0x07, 0x24, 0x7c,
+    0xe8, 0x21, 0x52, 0x40, 0x86, 0xc8, 0x02, 0x25, 0xa2, 0x0c, 0x98, 0x44, 0x1d, 0x50, 0xfc, 0xec,
+    0xf1, 0xa3, 0x87, 0x50, 0x01, 0x9d, 0x48, 0x03, 0x05, 0xa2, 0x08, 0x54, 0x89, 0x1a, 0x60, 0x13,
+    0x4d, 0x20, 0x39, 0xc0, 0x9e, 0x01, 0xf4, 0x10, 0x1a, 0x90, 0x23, 0xf2, 0x80, 0x41, 0x54, 0x00,
+    0x8b, 0x68, 0x00, 0xf1, 0x00, 0x7b, 0x02, 0xe8, 0x21, 0x52, 0x40, 0x86, 0xc8, 0x02, 0x25, 0xa2,
+    0x0c, 0x98, 0x44, 0x1d, 0x50, 0x06, 0xd9, 0x33, 0x88, 0x1e, 0x42, 0x05, 0x74, 0x22, 0x0d, 0x14,
+    0x88, 0x22, 0x50, 0x25, 0x6a, 0x80, 0x4d, 0x34, 0x81, 0xe4, 0x10, 0x7b, 0x86, 0xd0, 0x43, 0x68,
+    0x40, 0x8e, 0xc8, 0x03, 0x06, 0x51, 0x01, 0x2c, 0xa2, 0x01, 0xc4, 0x87, 0xd9, 0x33, 0x8c, 0x1e,
+    0x22, 0x05, 0x64, 0x88, 0x2c, 0x50, 0x22, 0xca, 0x80, 0x49, 0xd4, 0x01, 0x25, 0xc8, 0x9e, 0x20,
+    0x7a, 0x08, 0x15, 0xd0, 0x89, 0x34, 0x50, 0x20, 0x8a, 0x40, 0x95, 0xa8, 0x01, 0x36, 0xd1, 0x04,
+    0x92, 0x21, 0xf6, 0x84, 0xd0, 0x43, 0x68, 0x40, 0x8e, 0xc8, 0x03, 0x46, 0xa8, 0x5d, 0x96, 0x7e,
+    0x27, 0xae, 0xfa, 0xcc, 0x16, 0xf1, 0x16, 0x7a, 0x69, 0x75, 0x78, 0xdb, 0xfe, 0xb8, 0x1f, 0xc3,
+    0x15, 0x2f, 0x7b, 0xa0, 0x03, 0x00, 0x00,
+};
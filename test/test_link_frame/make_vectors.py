@@ -0,0 +1,82 @@
+#!/usr/bin/env python3
+"""Regenerates vectors.h: frames as tools/serial_link.py encodes them, for
+checking the device's framing against the host's.
+
+    python3 test/test_link_frame/make_vectors.py
+"""
+
+import os
+import struct
+import sys
+
+HERE = os.path.dirname(os.path.abspath(__file__))
+sys.path.insert(0, os.path.join(HERE, "..", "..", "tools"))
+
+import serial_link  # noqa: E402
+
+
+def data_payload():
+    # A full DATA chunk, with zeros and runs that cross COBS block limits
+    x = 2463534242
+    out = bytearray(struct.pack("<I", 8192))
+    for i in range(4096):
+        x ^= (x << 13) & 0xFFFFFFFF
+        x ^= x >> 17
+        x ^= (x << 5) & 0xFFFFFFFF
+        out.append(0 if i % 509 == 0 else (x & 0xFF) or 1)
+    return bytes(out)
+
+
+# Device frames, which the device must encode byte for byte the same
+DEVICE_FRAMES = [
+    ("done", serial_link.R_DONE, 7, b""),
+    ("hello", serial_link.R_HELLO, 1, struct.pack("<BHBI", 2, 4096, 3, 2000000)),
+    ("output", serial_link.OUTPUT, 2, "✅ All modules cleared!\r\n".encode()),
+    ("log_zeros", serial_link.LOG, 0, bytes(i % 10 and i for i in range(96))),
+    ("log_run", serial_link.LOG, 0, bytes(range(1, 97))),
+]
+
+# Host frames, which the device must decode
+HOST_FRAMES = [
+    ("command", serial_link.COMMAND, 3, b"x 4"),
+    ("close", serial_link.CLOSE, 255, b""),
+    ("data", serial_link.DATA, 42, data_payload()),
+]
+
+
+def c_array(name, data):
+    lines = ["static const uint8_t %s[%d] = {" % (name, len(data))]
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def table(name, frames):
+    lines = ["static const TestFrame %s[] = {" % name]
+    for label, kind, seq, payload in frames:
+        lines.append('    { "%s", 0x%02x, %d, %s_payload, %d, %s_wire, sizeof(%s_wire) },' %
+                     (label, kind, seq, label, len(payload), label, label))
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    parts = []
+    for label, kind, seq, payload in DEVICE_FRAMES + HOST_FRAMES:
+        # C++ has no zero-length arrays; the table holds the real length
+        parts.append(c_array(label + "_payload", payload or b"\0"))
+        parts.append(c_array(label + "_wire", serial_link.encode_frame(kind, seq, payload)))
+
+    with open(os.path.join(HERE, "vectors.h"), "w") as f:
+        f.write("// Generated by make_vectors.py, do not edit\n#pragma once\n#include <stddef.h>\n#include <stdint.h>\n\n")
+        f.write("struct TestFrame {\n    const char* label;\n    uint8_t type;\n    uint8_t seq;\n"
+                "    const uint8_t* payload;\n    size_t payload_len;\n"
+                "    const uint8_t* wire;\n    size_t wire_len;\n};\n\n")
+        f.write("\n\n".join(parts) + "\n\n")
+        f.write(table("device_frames", DEVICE_FRAMES) + "\n\n")
+        f.write(table("host_frames", HOST_FRAMES) + "\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,141 @@
+// On-target tests for the serial link's framing: COBS round trips over the
+// inputs where its blocks break, and frames checked byte for byte against
+// the ones tools/serial_link.py makes. Regenerate vectors.h with
+// make_vectors.py after changing the frame layout.
+// Run with: pio test -e esp32s3dev -f test_link_frame
+#include <Arduino.h>
+#include <unity.h>
+#include "link_frame.h"
+#include "vectors.h"
+
+static const size_t cobs_lengths[] = { 0, 1, 2, 253, 254, 255, 256, 508, 509, 4100 };
+
+static void check_cobs(const uint8_t* data, size_t len, const char* label) {
+    uint8_t* wire = (uint8_t*)malloc(COBS_MAX_SIZE(len));
+    size_t n = cobs_encode(data, len, wire);
+    TEST_ASSERT_TRUE_MESSAGE(n <= COBS_MAX_SIZE(len), label);
+    for (size_t i = 0; i < n; i++) {
+        TEST_ASSERT_NOT_EQUAL_MESSAGE(0, wire[i], label);
+    }
+    TEST_ASSERT_EQUAL_MESSAGE(len, cobs_decode(wire, n), label);
+    if (len) TEST_ASSERT_EQUAL_MEMORY_MESSAGE(data, wire, len, label);
+    free(wire);
+}
+
+static void test_cobs_round_trip() {
+    uint8_t* data = (uint8_t*)malloc(4100);
+    for (size_t len : cobs_lengths) {
+        char label[32];
+        snprintf(label, sizeof(label), "%u zeros", (unsigned)len);
+        memset(data, 0, len);
+        check_cobs(data, len, label);
+
+        snprintf(label, sizeof(label), "%u non-zero", (unsigned)len);
+        for (size_t i = 0; i < len; i++) data[i] = i % 255 + 1;
+        check_cobs(data, len, label);
+
+        snprintf(label, sizeof(label), "%u mixed", (unsigned)len);
+        for (size_t i = 0; i < len; i++) data[i] = (i % 7 == 3) ? 0 : (uint8_t)(i * 31 + 1) | 1;
+        check_cobs(data, len, label);
+    }
+    free(data);
+}
+
+static void test_cobs_malformed() {
+    // A block that claims more bytes than follow, and a zero inside
+    uint8_t short_block[] = { 0x05, 0x01, 0x02 };
+    TEST_ASSERT_EQUAL(0, cobs_decode(short_block, sizeof(short_block)));
+    uint8_t zero_code[] = { 0x02, 0x01, 0x00, 0x01 };
+    TEST_ASSERT_EQUAL(0, cobs_decode(zero_code, sizeof(zero_code)));
+}
+
+static void test_encode_matches_host() {
+    for (const TestFrame& frame : device_frames) {
+        uint8_t wire[LINK_WIRE_MAX(LINK_REPLY_MAX)];
+        size_t n = link_frame_encode(frame.type, frame.seq, frame.payload, frame.payload_len, wire);
+        TEST_ASSERT_EQUAL_MESSAGE(frame.wire_len, n, frame.label);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(frame.wire, wire, n, frame.label);
+    }
+}
+
+// Decodes the bytes between a frame's delimiters, like serial_link does
+static bool decode_wire(const uint8_t* wire, size_t wire_len, uint8_t* buf, size_t* payload_len) {
+    memcpy(buf, wire + 1, wire_len - 2);
+    return link_frame_decode(buf, wire_len - 2, payload_len);
+}
+
+static void test_decode_host_frames() {
+    for (const TestFrame& frame : host_frames) {
+        uint8_t* buf = (uint8_t*)malloc(frame.wire_len);
+        size_t len = 0;
+        TEST_ASSERT_TRUE_MESSAGE(decode_wire(frame.wire, frame.wire_len, buf, &len), frame.label);
+        TEST_ASSERT_EQUAL_MESSAGE(frame.type, buf[0], frame.label);
+        TEST_ASSERT_EQUAL_MESSAGE(frame.seq, buf[1], frame.label);
+        TEST_ASSERT_EQUAL_MESSAGE(frame.payload_len, len, frame.label);
+        if (len) TEST_ASSERT_EQUAL_MEMORY_MESSAGE(frame.payload, buf + LINK_HEADER_SIZE, len, frame.label);
+        free(buf);
+    }
+}
+
+static void test_device_frames_round_trip() {
+    for (const TestFrame& frame : device_frames) {
+        uint8_t buf[LINK_WIRE_MAX(LINK_REPLY_MAX)];
+        size_t len = 0;
+        TEST_ASSERT_TRUE_MESSAGE(decode_wire(frame.wire, frame.wire_len, buf, &len), frame.label);
+        TEST_ASSERT_EQUAL_MESSAGE(frame.payload_len, len, frame.label);
+    }
+}
+
+static void test_corruption_rejected() {
+    // Every single-bit error, in the COBS codes as well as the data
+    for (const TestFrame& frame : host_frames) {
+        uint8_t* wire = (uint8_t*)malloc(frame.wire_len);
+        uint8_t* buf = (uint8_t*)malloc(frame.wire_len);
+        memcpy(wire, frame.wire, frame.wire_len);
+        for (size_t i = 1; i < frame.wire_len - 1; i++) {
+            for (int bit = 0; bit < 8; bit++) {
+                wire[i] ^= 1 << bit;
+                size_t len;
+                // A flip to 0x00 would end the frame early on the wire; what's
+                // left of it must still not pass
+                size_t cut = wire[i] == 0 ? i + 1 : frame.wire_len;
+                TEST_ASSERT_FALSE_MESSAGE(decode_wire(wire, cut, buf, &len), frame.label);
+                wire[i] ^= 1 << bit;
+            }
+        }
+        free(wire);
+        free(buf);
+    }
+}
+
+static void test_truncated_rejected() {
+    for (const TestFrame& frame : host_frames) {
+        uint8_t* buf = (uint8_t*)malloc(frame.wire_len);
+        for (size_t cut = 1; cut <= 8 && cut < frame.wire_len - 2; cut++) {
+            uint8_t* wire = (uint8_t*)malloc(frame.wire_len);
+            memcpy(wire, frame.wire, frame.wire_len - cut - 1);
+            wire[frame.wire_len - cut - 1] = 0;
+            size_t len;
+            TEST_ASSERT_FALSE_MESSAGE(decode_wire(wire, frame.wire_len - cut, buf, &len), frame.label);
+            free(wire);
+        }
+        free(buf);
+    }
+}
+
+void setup() {
+    delay(2000);   // Lets the serial monitor attach
+
+    UNITY_BEGIN();
+    RUN_TEST(test_cobs_round_trip);
+    RUN_TEST(test_cobs_malformed);
+    RUN_TEST(test_encode_matches_host);
+    RUN_TEST(test_decode_host_frames);
+    RUN_TEST(test_device_frames_round_trip);
+    RUN_TEST(test_corruption_rejected);
+    RUN_TEST(test_truncated_rejected);
+    UNITY_END();
+}
+
+void loop() {
+}
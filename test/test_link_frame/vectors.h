@@ -0,0 +1,631 @@
+// Generated by make_vectors.py, do not edit
+#pragma once
+#include <stddef.h>
+#include <stdint.h>
+
+struct TestFrame {
+    const char* label;
+    uint8_t type;
+    uint8_t seq;
+    const uint8_t* payload;
+    size_t payload_len;
+    const uint8_t* wire;
+    size_t wire_len;
+};
+
+static const uint8_t done_payload[1] = {
+    0x00,
+};
+
+static const uint8_t done_wire[9] = {
+    0x00, 0x07, 0x82, 0x07, 0x95, 0x7d, 0x08, 0xd6, 0x00,
+};
+
+static const uint8_t hello_payload[8] = {
+    0x02, 0x00, 0x10, 0x03, 0x80, 0x84, 0x1e, 0x00,
+};
+
+static const uint8_t hello_wire[17] = {
+    0x00, 0x04, 0x81, 0x01, 0x02, 0x06, 0x10, 0x03, 0x80, 0x84, 0x1e, 0x05, 0x84, 0x5b, 0x41, 0x24,
+    0x00,
+};
+
+static const uint8_t output_payload[26] = {
+    0xe2, 0x9c, 0x85, 0x20, 0x41, 0x6c, 0x6c, 0x20, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65, 0x73, 0x20,
+    0x63, 0x6c, 0x65, 0x61, 0x72, 0x65, 0x64, 0x21, 0x0d, 0x0a,
+};
+
+static const uint8_t output_wire[35] = {
+    0x00, 0x21, 0x90, 0x02, 0xe2, 0x9c, 0x85, 0x20, 0x41, 0x6c, 0x6c, 0x20, 0x6d, 0x6f, 0x64, 0x75,
+    0x6c, 0x65, 0x73, 0x20, 0x63, 0x6c, 0x65, 0x61, 0x72, 0x65, 0x64, 0x21, 0x0d, 0x0a, 0x6c, 0xd8,
+    0x9a, 0xa5, 0x00,
+};
+
+static const uint8_t log_zeros_payload[96] = {
+    0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x00, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f,
+    0x10, 0x11, 0x12, 0x13, 0x00, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x00, 0x1f,
+    0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x00, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f,
+    0x30, 0x31, 0x00, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x00, 0x3d, 0x3e, 0x3f,
+    0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x00, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f,
+    0x00, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x00, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f,
+};
+
+static const uint8_t log_zeros_wire[105] = {
+    0x00, 0x02, 0x91, 0x01, 0x0a, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+    0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x0a, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b,
+    0x1c, 0x1d, 0x0a, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x0a, 0x29, 0x2a, 0x2b,
+    0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x0a, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b,
+    0x0a, 0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x0a, 0x47, 0x48, 0x49, 0x4a, 0x4b,
+    0x4c, 0x4d, 0x4e, 0x4f, 0x0a, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x0a, 0x5b,
+    0x5c, 0x5d, 0x5e, 0x5f, 0xac, 0x47, 0x63, 0x64, 0x00,
+};
+
+static const uint8_t log_run_payload[96] = {
+    0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f, 0x10,
+    0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20,
+    0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30,
+    0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0x3e, 0x3f, 0x40,
+    0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c, 0x4d, 0x4e, 0x4f, 0x50,
+    0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c, 0x5d, 0x5e, 0x5f, 0x60,
+};
+
+static const uint8_t log_run_wire[105] = {
+    0x00, 0x02, 0x91, 0x65, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c,
+    0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0x1a, 0x1b, 0x1c,
+    0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28, 0x29, 0x2a, 0x2b, 0x2c,
+    0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c,
+    0x3d, 0x3e, 0x3f, 0x40, 0x41, 0x42, 0x43, 0x44, 0x45, 0x46, 0x47, 0x48, 0x49, 0x4a, 0x4b, 0x4c,
+    0x4d, 0x4e, 0x4f, 0x50, 0x51, 0x52, 0x53, 0x54, 0x55, 0x56, 0x57, 0x58, 0x59, 0x5a, 0x5b, 0x5c,
+    0x5d, 0x5e, 0x5f, 0x60, 0xc0, 0xe1, 0xf2, 0x29, 0x00,
+};
+
+static const uint8_t command_payload[3] = {
+    0x78, 0x20, 0x34,
+};
+
+static const uint8_t command_wire[12] = {
+    0x00, 0x0a, 0x02, 0x03, 0x78, 0x20, 0x34, 0x6c, 0xe2, 0x85, 0x40, 0x00,
+};
+
+static const uint8_t close_payload[1] = {
+    0x00,
+};
+
+static const uint8_t close_wire[9] = {
+    0x00, 0x07, 0x06, 0xff, 0xf4, 0x5a, 0x81, 0x3a, 0x00,
+};
+
+static const uint8_t data_payload[4100] = {
+    0x00, 0x20, 0x00, 0x00, 0x00, 0x7a, 0xa0, 0x7e, 0xe1, 0xea, 0xf2, 0x3d, 0xc7, 0x39, 0x6d, 0x0d,
+    0xa6, 0x78, 0x16, 0x80, 0x05, 0x12, 0x3a, 0xa7, 0x4e, 0xde, 0x9f, 0x78, 0x9c, 0x70, 0x63, 0x01,
+    0x0b, 0xe6, 0xc8, 0x25, 0x21, 0x3d, 0xad, 0x22, 0xbc, 0x70, 0xb3, 0x85, 0xda, 0x21, 0x23, 0x63,
+    0x36, 0x17, 0x7b, 0xc3, 0x79, 0xfd, 0x62, 0x6c, 0xf9, 0x66, 0x43, 0xf1, 0x1f, 0xbd, 0x61, 0x63,
+    0xbd, 0x7c, 0x99, 0x90, 0x67, 0xf3, 0xd1, 0x98, 0xf0, 0x8c, 0x88, 0xd3, 0x90, 0x34, 0x3f, 0x14,
+    0xd1, 0xaa, 0xff, 0x72, 0x48, 0x27, 0x35, 0xf9, 0xde, 0x34, 0x4e, 0xb0, 0x4a, 0x10, 0xd8, 0xd5,
+    0x83, 0x7e, 0x10, 0xa4, 0x57, 0x4d, 0xd7, 0x31, 0x39, 0x3c, 0x26, 0x9f, 0x56, 0x69, 0x48, 0x3b,
+    0x0d, 0x32, 0x34, 0xa7, 0x0c, 0x79, 0x3d, 0x1a, 0x24, 0x37, 0xbf, 0xc2, 0x8b, 0xd2, 0x16, 0x20,
+    0xcf, 0x84, 0x7c, 0xbe, 0xc6, 0xba, 0xbb, 0xf4, 0x77, 0x3f, 0x32, 0x89, 0xc9, 0xbb, 0xae, 0xed,
+    0x0b, 0x7d, 0x14, 0xa7, 0x1e, 0xe0, 0xed, 0x3c, 0x0f, 0x8f, 0x3e, 0xb7, 0x78, 0xb6, 0x7e, 0x23,
+    0x38, 0x04, 0x7c, 0x01, 0x4d, 0x4b, 0x54, 0x38, 0xbd, 0xcc, 0x3a, 0xf0, 0x63, 0x23, 0x20, 0xc6,
+    0x4b, 0x4b, 0xfb, 0xff, 0xbd, 0x42, 0x33, 0x75, 0x5f, 0xff, 0x20, 0xe5, 0x40, 0x6d, 0x89, 0x6f,
+    0xf6, 0x43, 0x77, 0xf8, 0xf4, 0x1f, 0x1e, 0x04, 0x87, 0xba, 0x01, 0xe4, 0x21, 0x6e, 0x90, 0xf1,
+    0x46, 0xfd, 0xfd, 0x02, 0x47, 0x05, 0x2a, 0x17, 0x9e, 0x5f, 0xd9, 0x80, 0x78, 0x69, 0x83, 0x0a,
+    0x73, 0x67, 0xd2, 0x82, 0x9c, 0x0b, 0x03, 0xe3, 0xc0, 0xf4, 0x9d, 0x33, 0x74, 0xf1, 0x9f, 0x58,
+    0x1a, 0x8e, 0x02, 0x27, 0x78, 0x51, 0xb6, 0xeb, 0x45, 0x10, 0x6d, 0x4a, 0xad, 0xfe, 0x90, 0x66,
+    0xc1, 0xe1, 0xe6, 0xbf, 0x8c, 0x9d, 0x9f, 0x30, 0xe8, 0xe4, 0x1a, 0xdc, 0x28, 0xb7, 0x40, 0xd7,
+    0xe3, 0x78, 0x2c, 0xcb, 0x8c, 0x01, 0x96, 0x34, 0x26, 0x51, 0xcb, 0x32, 0xab, 0x0a, 0x18, 0x14,
+    0x3f, 0x03, 0xad, 0x2e, 0x12, 0x58, 0x57, 0xd6, 0x7b, 0x4d, 0xda, 0x20, 0xc6, 0xee, 0xf2, 0x4f,
+    0xe2, 0x32, 0xe1, 0x2f, 0x21, 0x7a, 0x79, 0x04, 0x23, 0x65, 0x59, 0xc3, 0x27, 0x19, 0xa5, 0x14,
+    0x3f, 0x4e, 0x2f, 0x73, 0xa9, 0xe6, 0x5d, 0x22, 0x07, 0xc5, 0x1d, 0xbf, 0x1e, 0xb3, 0xd0, 0x2e,
+    0x12, 0x0a, 0x33, 0x3b, 0x66, 0x66, 0x47, 0xe7, 0x7d, 0xa4, 0x3b, 0xbd, 0x19, 0x43, 0xbd, 0xe0,
+    0x5b, 0x02, 0x14, 0x4c, 0x10, 0x96, 0xd5, 0xe4, 0x05, 0x23, 0x57, 0x10, 0x8a, 0x7b, 0xea, 0xda,
+    0x70, 0x66, 0x51, 0x22, 0xc7, 0x7a, 0xbd, 0x57, 0x66, 0xed, 0xdb, 0x6a, 0x81, 0x37, 0x07, 0x40,
+    0x35, 0x68, 0x62, 0xe3, 0x54, 0x33, 0x55, 0x93, 0x89, 0x99, 0x15, 0x43, 0x3d, 0x77, 0x50, 0x7e,
+    0xe9, 0x2c, 0x42, 0x6c, 0x4f, 0x63, 0xce, 0x48, 0x4a, 0x99, 0x3a, 0x57, 0x1a, 0x56, 0x1f, 0x79,
+    0xf9, 0xb5, 0xab, 0xc9, 0x2e, 0x6c, 0xcc, 0x04, 0xcb, 0x99, 0x3e, 0x50, 0x0d, 0x19, 0x4c, 0x1e,
+    0x4d, 0x32, 0x50, 0xb0, 0xb7, 0x68, 0xd7, 0x76, 0xcb, 0xb2, 0x4e, 0x60, 0x87, 0x73, 0xa0, 0xa3,
+    0xf3, 0x34, 0x81, 0x8a, 0x59, 0xe1, 0x21, 0x3f, 0x7c, 0x10, 0x2d, 0x2d, 0xac, 0xdc, 0x16, 0xfb,
+    0xac, 0xc8, 0x10, 0xea, 0x12, 0x24, 0x18, 0xf6, 0x21, 0xb5, 0xeb, 0x01, 0xb2, 0xc0, 0xd3, 0x78,
+    0x2b, 0xa5, 0x86, 0x17, 0x0c, 0xb3, 0xc8, 0xbf, 0x61, 0x67, 0x27, 0x5b, 0x97, 0x3e, 0xe7, 0xfe,
+    0x21, 0x60, 0x61, 0x67, 0x6a, 0xbb, 0xa8, 0x8b, 0x92, 0xa7, 0x3a, 0x79, 0x9d, 0xea, 0x70, 0x5e,
+    0x2a, 0x00, 0x68, 0x86, 0xbe, 0x2e, 0x8d, 0x58, 0x56, 0xa5, 0x74, 0xbf, 0x7d, 0xe4, 0x76, 0xaa,
+    0xe3, 0x56, 0xfe, 0xbb, 0x5c, 0xd8, 0x9b, 0xad, 0x5d, 0xbb, 0x9f, 0x2d, 0x9d, 0xb4, 0x55, 0x18,
+    0x49, 0xa2, 0x3d, 0x19, 0x63, 0x4f, 0x27, 0xd5, 0x60, 0xcf, 0x83, 0xbc, 0xfb, 0xef, 0x79, 0x62,
+    0x24, 0x1a, 0xa2, 0xbc, 0x41, 0x04, 0x77, 0x53, 0xbc, 0x79, 0xd3, 0x8b, 0x1a, 0x4a, 0xb5, 0xc0,
+    0xfb, 0x9e, 0x02, 0x48, 0xf4, 0x45, 0x35, 0xea, 0x56, 0x5d, 0x70, 0x93, 0x5f, 0xa7, 0xd4, 0xfe,
+    0x3a, 0x6f, 0xd6, 0x7b, 0x03, 0x22, 0x1e, 0x25, 0x0e, 0xc8, 0x2a, 0x24, 0x66, 0x52, 0x55, 0x5b,
+    0x5a, 0x52, 0xf3, 0xe7, 0x51, 0xad, 0x58, 0xe5, 0x24, 0x31, 0xe9, 0x7d, 0xf1, 0x75, 0x81, 0x98,
+    0x58, 0xd1, 0x52, 0x11, 0x6a, 0xa4, 0xbb, 0xa8, 0x95, 0x30, 0x62, 0x3a, 0x49, 0xa3, 0x37, 0x86,
+    0x76, 0xa8, 0xef, 0xec, 0x9c, 0xfe, 0xaa, 0x63, 0xe5, 0x43, 0x64, 0xb9, 0x93, 0x2c, 0xf2, 0x7c,
+    0xab, 0x20, 0x64, 0x61, 0x39, 0xd2, 0x0e, 0xc1, 0xe2, 0x4f, 0xd6, 0xb3, 0xac, 0xae, 0x85, 0xf4,
+    0xdf, 0x98, 0x7d, 0xbe, 0x61, 0x59, 0xa7, 0x5c, 0xd0, 0x9a, 0xc3, 0x95, 0xd8, 0x17, 0x78, 0x82,
+    0xf8, 0x40, 0x0f, 0x74, 0x6a, 0x49, 0x2e, 0x8a, 0x07, 0xab, 0x5d, 0xde, 0x8b, 0xb7, 0x36, 0xbb,
+    0x01, 0x0b, 0x73, 0x33, 0x8f, 0xff, 0x7b, 0x70, 0x58, 0x13, 0x8c, 0xf8, 0x2c, 0xed, 0x54, 0x89,
+    0xcb, 0x67, 0x95, 0x0f, 0x7f, 0xd1, 0x21, 0xaa, 0x97, 0xaa, 0xc1, 0x12, 0xef, 0xcf, 0xb7, 0xec,
+    0xe6, 0xa0, 0x55, 0x4c, 0x13, 0x54, 0x34, 0xa7, 0xb9, 0x76, 0x1c, 0x16, 0x69, 0x76, 0x12, 0xfb,
+    0xe5, 0x6c, 0xce, 0xd2, 0x60, 0x6b, 0x07, 0x4f, 0x70, 0x0a, 0x44, 0xd8, 0xf2, 0x66, 0x72, 0x90,
+    0x36, 0x15, 0xe2, 0xc2, 0x3c, 0x94, 0x04, 0x4c, 0x8d, 0x06, 0xff, 0x14, 0xf7, 0xaa, 0x3a, 0xcb,
+    0x97, 0x4d, 0x67, 0xb0, 0x35, 0x03, 0xe1, 0x18, 0xef, 0x35, 0x83, 0x33, 0xee, 0x0f, 0x99, 0x21,
+    0x69, 0xfa, 0xde, 0x39, 0x9e, 0x9f, 0x7c, 0x17, 0x67, 0x95, 0x68, 0xea, 0x07, 0xd3, 0xa3, 0x5b,
+    0xe7, 0x04, 0x7b, 0x42, 0x58, 0xff, 0x48, 0xea, 0x24, 0x4f, 0xe7, 0x61, 0xe5, 0xc7, 0x45, 0x2b,
+    0xe2, 0xef, 0xf7, 0xf5, 0x2a, 0xe2, 0x80, 0x9c, 0x89, 0x9a, 0x8b, 0xb0, 0xa1, 0xc9, 0x17, 0x27,
+    0xab, 0x8a, 0x12, 0xad, 0x97, 0x80, 0xfa, 0x24, 0x5b, 0xc2, 0x0b, 0x46, 0x13, 0xa0, 0x22, 0x97,
+    0xea, 0x26, 0x8b, 0xc4, 0x10, 0x33, 0xe1, 0x43, 0xf6, 0x0c, 0x54, 0x88, 0xa7, 0x39, 0x03, 0xed,
+    0x6c, 0x55, 0x86, 0xa6, 0x18, 0x3c, 0x38, 0x3d, 0xb3, 0x2a, 0x27, 0x34, 0x99, 0xfb, 0x1b, 0x69,
+    0xb8, 0x8c, 0x4b, 0x2e, 0xfd, 0xbd, 0x38, 0x01, 0xfe, 0x83, 0x23, 0x60, 0xb3, 0x07, 0x7c, 0x2e,
+    0xa5, 0x83, 0x62, 0x55, 0x58, 0xa7, 0xb7, 0x76, 0x69, 0x7c, 0x4a, 0xa6, 0x5f, 0x28, 0x6c, 0x18,
+    0x1a, 0x5a, 0x98, 0xa8, 0x9d, 0x32, 0xd5, 0x15, 0x27, 0x27, 0x63, 0x94, 0x86, 0xb0, 0x4d, 0x49,
+    0xdf, 0xf7, 0x2a, 0xfc, 0xf8, 0xfb, 0xbd, 0xd2, 0x79, 0x42, 0x5e, 0xc8, 0x9e, 0x41, 0x65, 0xf6,
+    0xce, 0xd2, 0x93, 0xc1, 0x37, 0xe5, 0x66, 0x0f, 0xf9, 0xc3, 0xff, 0x05, 0x0f, 0xbb, 0x01, 0x96,
+    0xe1, 0xa5, 0xfd, 0x23, 0x03, 0x0c, 0xc8, 0x11, 0x2a, 0x9f, 0x4c, 0xd2, 0x7b, 0xc3, 0xe5, 0xc8,
+    0x89, 0x4c, 0xde, 0xa9, 0xcd, 0xe0, 0xca, 0xc1, 0x3c, 0x50, 0xcf, 0x6c, 0x4b, 0xcf, 0xd0, 0xe9,
+    0x8d, 0x29, 0x4f, 0x4f, 0x7c, 0xf7, 0x58, 0xf5, 0xff, 0x83, 0xd1, 0xfc, 0xb4, 0x55, 0x00, 0xd3,
+    0x88, 0xf5, 0x43, 0x0d, 0xeb, 0x6f, 0x47, 0xc9, 0x27, 0x10, 0x9f, 0xf1, 0x05, 0x5d, 0x58, 0x4c,
+    0x9a, 0xdb, 0x36, 0xe3, 0x60, 0xeb, 0x2b, 0x5c, 0x82, 0x93, 0xde, 0xbb, 0xfe, 0x88, 0x82, 0x6a,
+    0x4e, 0x01, 0xcb, 0x8b, 0x71, 0xfd, 0xad, 0x44, 0x53, 0x25, 0xd2, 0xd7, 0x93, 0xbd, 0x76, 0x50,
+    0x06, 0x1c, 0xaf, 0x73, 0x14, 0x65, 0x04, 0x2a, 0xe7, 0x78, 0xb2, 0x33, 0x4c, 0x79, 0x0f, 0xdd,
+    0x51, 0x69, 0x79, 0x36, 0x16, 0x38, 0x2b, 0xcc, 0xdb, 0xac, 0xec, 0xa3, 0x4b, 0x26, 0xd7, 0xc5,
+    0xa0, 0x42, 0xbc, 0x45, 0x38, 0x05, 0x4f, 0x62, 0xe8, 0x3e, 0x7e, 0xd3, 0x94, 0xc0, 0x66, 0xec,
+    0x42, 0xa7, 0xb6, 0xd7, 0xdb, 0xb4, 0x81, 0xef, 0xa4, 0xc0, 0xd2, 0x05, 0xf0, 0xb2, 0xb1, 0xd1,
+    0xf2, 0x7f, 0xb4, 0x5b, 0x59, 0x64, 0x04, 0x96, 0x12, 0x0b, 0xa8, 0x6d, 0x1e, 0x3a, 0xa3, 0xc4,
+    0xce, 0x6f, 0x6e, 0x91, 0xbb, 0x21, 0xd7, 0x0d, 0x12, 0x63, 0x4c, 0x0d, 0x19, 0x36, 0xc0, 0xdb,
+    0x90, 0xf9, 0xbb, 0x1d, 0xbe, 0x67, 0x79, 0xbd, 0x09, 0x10, 0xbf, 0x32, 0x54, 0xa1, 0x2e, 0x70,
+    0xe7, 0x63, 0x18, 0xbd, 0xdd, 0x2d, 0xe5, 0x75, 0x87, 0xe1, 0x41, 0xa9, 0x33, 0xf6, 0x67, 0xc6,
+    0x91, 0xdc, 0xd9, 0xc5, 0xde, 0xac, 0x56, 0x8e, 0x18, 0xc0, 0x4e, 0xd9, 0x93, 0x56, 0xd4, 0xc4,
+    0xf0, 0x38, 0x14, 0xd8, 0xda, 0xb6, 0xa3, 0x34, 0x76, 0xee, 0xc1, 0x01, 0x5f, 0xe3, 0x32, 0x2e,
+    0x8f, 0x2b, 0xf3, 0x37, 0xb3, 0x6d, 0x01, 0x3b, 0xf0, 0x1d, 0x5e, 0x3b, 0xab, 0x39, 0xc8, 0x06,
+    0x90, 0x76, 0x14, 0xa4, 0x87, 0x88, 0xbf, 0x16, 0xbe, 0xc7, 0xf3, 0x17, 0xb5, 0x78, 0x78, 0x93,
+    0x95, 0xd8, 0xdc, 0xfb, 0x3c, 0x9e, 0x29, 0x8d, 0x09, 0xf6, 0x22, 0x4d, 0x0d, 0xfa, 0x6d, 0x66,
+    0x5e, 0x39, 0x0d, 0xdd, 0xee, 0x59, 0x26, 0xd1, 0xd4, 0xf9, 0xd3, 0x85, 0x0e, 0x8b, 0xef, 0xca,
+    0x1f, 0x0e, 0x62, 0xa0, 0xb7, 0x84, 0x5f, 0x23, 0x80, 0xa4, 0xa9, 0x0f, 0xb0, 0xdc, 0xce, 0xeb,
+    0x5b, 0x40, 0xa2, 0x89, 0xa8, 0xd5, 0x70, 0xac, 0x27, 0xf6, 0x0e, 0x23, 0xac, 0x57, 0xcc, 0x44,
+    0xd7, 0x12, 0xde, 0xd0, 0x31, 0x67, 0x29, 0x51, 0xf2, 0x7c, 0xfa, 0xbb, 0xf0, 0x39, 0xbe, 0x78,
+    0x1f, 0x01, 0x9d, 0xc3, 0x6e, 0xd7, 0x50, 0x5d, 0x75, 0xf9, 0x33, 0x96, 0xb4, 0xa1, 0x5c, 0x79,
+    0xa3, 0x69, 0xff, 0x01, 0xfa, 0x7d, 0x6c, 0x6d, 0x08, 0x5d, 0x0c, 0x8c, 0x51, 0x98, 0xd4, 0xe8,
+    0x82, 0xa0, 0x32, 0x96, 0x2a, 0xbf, 0xa2, 0xca, 0x55, 0x87, 0xbc, 0x23, 0x30, 0x3c, 0x6c, 0xec,
+    0x3f, 0xf1, 0x32, 0x36, 0xcf, 0x9f, 0xc7, 0x17, 0x01, 0xe7, 0x65, 0x8e, 0x31, 0xc3, 0x1e, 0x57,
+    0x82, 0x96, 0x3c, 0x62, 0x06, 0x5b, 0x35, 0xac, 0xe6, 0x49, 0x67, 0xa6, 0xe8, 0x13, 0x5b, 0xe2,
+    0xc3, 0x60, 0x0e, 0x68, 0x5a, 0x3a, 0x3e, 0xbe, 0x62, 0xa7, 0xce, 0xb1, 0x9e, 0xce, 0x68, 0x3d,
+    0x21, 0x44, 0x57, 0x2f, 0x6b, 0x1f, 0x5b, 0x5c, 0xd5, 0x3e, 0xbd, 0xd1, 0x5d, 0x0d, 0xcf, 0x6a,
+    0x47, 0x5b, 0xe4, 0xe4, 0xd1, 0xf6, 0x32, 0xcf, 0x4b, 0xb7, 0x0f, 0xaf, 0x0e, 0x6b, 0x79, 0xf8,
+    0x9d, 0x9d, 0x71, 0x62, 0x2c, 0x3a, 0xd8, 0x80, 0xce, 0x88, 0xa9, 0x9a, 0x05, 0x8a, 0x5f, 0xfa,
+    0xdb, 0x23, 0x2c, 0x31, 0x82, 0xd9, 0x27, 0xab, 0xc3, 0x93, 0x06, 0xce, 0xa1, 0x3f, 0x45, 0xbe,
+    0x0d, 0xf4, 0x3b, 0xf4, 0x17, 0x96, 0x4f, 0x16, 0xfb, 0x25, 0xb8, 0xc6, 0x05, 0xca, 0x60, 0xbb,
+    0x2e, 0x3c, 0xf4, 0xef, 0x65, 0x8e, 0x0f, 0xe5, 0xbf, 0x2a, 0xf3, 0x00, 0x71, 0x7a, 0x39, 0x15,
+    0x70, 0x30, 0xfa, 0xa2, 0x8f, 0x36, 0x13, 0xee, 0x15, 0x7b, 0x41, 0x11, 0x10, 0x47, 0xe6, 0x5e,
+    0xf6, 0xbd, 0x67, 0x2f, 0x11, 0xc2, 0x02, 0xe4, 0x37, 0xdf, 0xb1, 0x16, 0x59, 0x5e, 0x52, 0x85,
+    0x86, 0xae, 0xaf, 0x11, 0x0d, 0x40, 0x25, 0x89, 0xd7, 0x63, 0xb6, 0x85, 0xb3, 0x75, 0x07, 0x3c,
+    0xa1, 0x3d, 0x9e, 0x9e, 0x18, 0x34, 0x9d, 0x6d, 0xf1, 0x59, 0xea, 0x3c, 0x57, 0x65, 0xb0, 0xe4,
+    0xea, 0xbd, 0x23, 0x4f, 0xa2, 0xf6, 0x95, 0xdd, 0xa0, 0x09, 0x7b, 0x9f, 0xa9, 0x3d, 0x9f, 0xb5,
+    0xb4, 0x19, 0x57, 0xb2, 0xec, 0xcf, 0xea, 0x65, 0xcd, 0x0c, 0xc7, 0x5b, 0xdc, 0x59, 0xa6, 0xb4,
+    0x83, 0x36, 0xaf, 0xc0, 0x80, 0x21, 0x92, 0xf0, 0xbc, 0xfc, 0x70, 0xb5, 0x53, 0xea, 0xfd, 0x12,
+    0xb8, 0xd0, 0x77, 0x84, 0x1e, 0x20, 0x56, 0xda, 0xbf, 0xda, 0x27, 0x8f, 0xfa, 0x1d, 0xe6, 0xbb,
+    0x1f, 0x87, 0xf8, 0xc5, 0x20, 0x3d, 0xfa, 0xe3, 0x88, 0x55, 0x1c, 0x23, 0x74, 0x70, 0xc0, 0xf3,
+    0xce, 0x53, 0x1e, 0x57, 0xe0, 0x74, 0x0b, 0x89, 0xa9, 0x09, 0x34, 0x98, 0xde, 0xc5, 0x06, 0x8a,
+    0x0d, 0x93, 0x8f, 0x16, 0x53, 0x7f, 0x6c, 0xf0, 0x27, 0x29, 0x2a, 0x37, 0x65, 0xf7, 0x3f, 0xb9,
+    0x66, 0xb0, 0x17, 0x0b, 0x65, 0x17, 0x90, 0x24, 0x06, 0x6b, 0x02, 0x29, 0x94, 0xaa, 0x44, 0xb5,
+    0x10, 0x68, 0x84, 0x3d, 0x5c, 0xc2, 0xa0, 0x34, 0x62, 0xf4, 0xcc, 0x54, 0x6d, 0xdc, 0x34, 0xdb,
+    0x23, 0xb4, 0x77, 0x70, 0xb4, 0xd5, 0x15, 0x9f, 0x63, 0x11, 0xb3, 0x58, 0xee, 0x01, 0xd6, 0xd9,
+    0x79, 0x1b, 0xbe, 0xef, 0x66, 0x2d, 0x71, 0x7c, 0x7d, 0x76, 0x55, 0x6f, 0x48, 0xdc, 0x1a, 0xef,
+    0x29, 0x53, 0x87, 0x11, 0x7c, 0x81, 0x24, 0xc2, 0x7b, 0xc3, 0x20, 0x4e, 0x14, 0xb0, 0x5b, 0xdf,
+    0xb3, 0xbb, 0xdc, 0x65, 0xa6, 0x4b, 0x3f, 0xee, 0xdb, 0x36, 0xbb, 0x30, 0x1c, 0xe3, 0x6e, 0xe9,
+    0xa5, 0xb6, 0xe3, 0x46, 0x22, 0xd0, 0x8a, 0xcf, 0x08, 0xef, 0x53, 0x03, 0x7f, 0xb1, 0xb3, 0x56,
+    0xdc, 0x7f, 0xd5, 0xa5, 0x29, 0x80, 0x40, 0x3a, 0x37, 0xd6, 0x97, 0xef, 0x88, 0xc0, 0xc8, 0xc9,
+    0x83, 0x39, 0x3d, 0x98, 0xab, 0xe0, 0xa9, 0x73, 0x58, 0x99, 0x6d, 0xde, 0x29, 0xb5, 0x3e, 0x5d,
+    0x9c, 0xdf, 0xbe, 0x36, 0x20, 0xe2, 0x4b, 0x6b, 0xaa, 0x18, 0x6c, 0xea, 0x73, 0x98, 0x1a, 0x11,
+    0x45, 0xe7, 0x2c, 0x01, 0x8b, 0xe8, 0x40, 0xb4, 0xec, 0xcc, 0x7f, 0xf0, 0xc2, 0xd4, 0x01, 0x93,
+    0x6d, 0x82, 0xca, 0xed, 0xc5, 0x33, 0x51, 0x73, 0xf6, 0xe4, 0x7d, 0xdd, 0x90, 0x5d, 0x68, 0xcc,
+    0x09, 0x52, 0xe6, 0x65, 0x04, 0x7d, 0x26, 0x4d, 0xc5, 0x15, 0x59, 0x4e, 0x39, 0x3c, 0x6f, 0xbf,
+    0xd4, 0x95, 0xcd, 0xfa, 0xa0, 0x05, 0xfe, 0x82, 0xa0, 0x3b, 0x5a, 0xc6, 0xb1, 0x35, 0xed, 0xf1,
+    0xed, 0x41, 0x0f, 0x68, 0xb4, 0xbb, 0x80, 0xe8, 0x60, 0xb0, 0xb2, 0x6f, 0xe8, 0xf0, 0xf3, 0xbd,
+    0x24, 0xb9, 0x08, 0x39, 0xab, 0xf8, 0x54, 0x84, 0x11, 0x7b, 0x36, 0x43, 0xfb, 0x81, 0xb8, 0x2e,
+    0x48, 0xb4, 0x27, 0x13, 0x85, 0x39, 0x1d, 0x74, 0x8e, 0x27, 0x6a, 0x94, 0x86, 0x68, 0x40, 0x20,
+    0xa1, 0xf8, 0x60, 0x71, 0xd1, 0x3f, 0x1e, 0xb8, 0x43, 0xd8, 0xde, 0x10, 0x4a, 0xc4, 0xcf, 0x28,
+    0x15, 0xca, 0x5d, 0x21, 0x94, 0xae, 0xb8, 0x83, 0x08, 0x13, 0x58, 0xc7, 0xeb, 0x38, 0x2c, 0x60,
+    0x0c, 0x5d, 0xcc, 0x7d, 0x39, 0x2d, 0x41, 0x10, 0x22, 0x46, 0xa9, 0x96, 0x03, 0xa0, 0x8b, 0x43,
+    0x0a, 0x99, 0xfb, 0x2f, 0x5d, 0x9d, 0x6c, 0x83, 0x00, 0x9a, 0xb0, 0x2d, 0xce, 0x31, 0xa2, 0x5e,
+    0x4e, 0xd5, 0xeb, 0x87, 0xfe, 0x75, 0xb7, 0x70, 0x27, 0x4f, 0xca, 0x35, 0xae, 0x8c, 0x03, 0xb6,
+    0x32, 0xea, 0x74, 0x2e, 0x6a, 0x0e, 0x90, 0x07, 0xd0, 0xa6, 0xb3, 0x26, 0x4e, 0x83, 0x3a, 0x6b,
+    0xd7, 0x45, 0xfc, 0xdb, 0x0d, 0x55, 0x2f, 0xfd, 0xa7, 0x38, 0x1a, 0xeb, 0x01, 0x65, 0x7d, 0x69,
+    0x6f, 0xb2, 0x41, 0x52, 0x65, 0x93, 0x7e, 0x46, 0xd0, 0x83, 0xbb, 0x53, 0xba, 0x15, 0x09, 0x2a,
+    0x83, 0x3f, 0xf1, 0x0f, 0x99, 0x24, 0x4c, 0x1b, 0x94, 0xc8, 0xab, 0x0b, 0xb1, 0xce, 0x99, 0xed,
+    0xcd, 0xe9, 0x9b, 0xdb, 0x1a, 0xff, 0xb4, 0xf5, 0xa6, 0x91, 0x6b, 0x50, 0x51, 0x27, 0x7d, 0xb3,
+    0x3f, 0xbe, 0x35, 0x06, 0x35, 0x6a, 0x0c, 0x0e, 0x79, 0xdd, 0x62, 0x85, 0x86, 0xda, 0x01, 0x69,
+    0xf4, 0x9b, 0xb7, 0xb4, 0xa9, 0x25, 0x44, 0x4e, 0x01, 0xda, 0x47, 0xa4, 0x34, 0x9e, 0x1f, 0xbe,
+    0x92, 0x84, 0x94, 0xf6, 0x7a, 0x65, 0x19, 0x4d, 0x7a, 0x1a, 0x56, 0xb3, 0xde, 0x99, 0x86, 0xc2,
+    0x32, 0xda, 0xb9, 0x7b, 0x43, 0x70, 0x19, 0x65, 0x76, 0xe3, 0xf3, 0x27, 0x15, 0x09, 0x87, 0xd7,
+    0xfe, 0x87, 0x81, 0x68, 0xee, 0x72, 0x12, 0xdb, 0x71, 0x3d, 0xe1, 0x88, 0xe3, 0x61, 0xfb, 0x34,
+    0x6a, 0x02, 0xac, 0xaf, 0xa7, 0x32, 0xb9, 0x34, 0x69, 0x0f, 0xec, 0xb5, 0x49, 0x13, 0x6f, 0x82,
+    0x8a, 0xcc, 0xa7, 0x69, 0xb4, 0x0e, 0x5b, 0x2d, 0x09, 0x94, 0x40, 0xf3, 0x9c, 0x87, 0x38, 0x2f,
+    0x89, 0xfd, 0x93, 0x47, 0x73, 0x9e, 0xcb, 0x4a, 0x80, 0x9e, 0x6d, 0x9c, 0xb7, 0xbe, 0x62, 0xe9,
+    0x96, 0xf5, 0x02, 0xe3, 0xa6, 0x03, 0xa0, 0x2e, 0x2b, 0x78, 0x8e, 0x9a, 0x36, 0xca, 0x63, 0xc9,
+    0xe6, 0x41, 0x24, 0x99, 0x9f, 0x76, 0x59, 0xb0, 0x09, 0xfb, 0x87, 0x89, 0x65, 0x78, 0xc5, 0xed,
+    0xf1, 0x77, 0x8d, 0xc1, 0x32, 0x60, 0xfa, 0xb4, 0x08, 0xfa, 0xbf, 0xfc, 0xbc, 0xc5, 0x76, 0xf3,
+    0x05, 0x8e, 0xff, 0xe9, 0xf0, 0xca, 0x86, 0xae, 0x35, 0x6b, 0x45, 0x70, 0x01, 0xf2, 0x54, 0x5b,
+    0xd6, 0x20, 0x09, 0xd1, 0xe2, 0xc0, 0x4a, 0x53, 0x74, 0xfe, 0x80, 0x87, 0xb7, 0x2a, 0xaf, 0x66,
+    0x3d, 0x58, 0xa6, 0xe4, 0xcc, 0xce, 0x21, 0x3a, 0x3c, 0x2b, 0x1b, 0xa5, 0x48, 0x53, 0x39, 0x81,
+    0xb3, 0xc9, 0x62, 0x43, 0xc8, 0xd7, 0x0a, 0x4a, 0x16, 0xa4, 0x48, 0x33, 0xf0, 0xa2, 0x98, 0x6d,
+    0x78, 0x7f, 0x59, 0x65, 0x80, 0x63, 0x74, 0x3e, 0x01, 0x25, 0xcd, 0x97, 0xd6, 0x72, 0xbf, 0xc1,
+    0x48, 0x75, 0x8c, 0x99, 0x13, 0x3a, 0x34, 0x2f, 0x60, 0xee, 0x3c, 0xb6, 0xa1, 0x3d, 0x6b, 0xf9,
+    0x1e, 0x0d, 0x59, 0x3d, 0x85, 0x68, 0x61, 0xaf, 0x28, 0x5a, 0x2a, 0x33, 0x56, 0x10, 0x91, 0x3f,
+    0x84, 0x69, 0x57, 0x89, 0xa2, 0xc9, 0x45, 0x38, 0xcd, 0x07, 0xb6, 0x22, 0xda, 0x10, 0x0b, 0xa9,
+    0x57, 0xc3, 0x30, 0xd4, 0x1f, 0xe0, 0x05, 0x33, 0xf4, 0x92, 0xa7, 0x76, 0x7a, 0x22, 0x18, 0x4f,
+    0xbc, 0x07, 0x31, 0x9a, 0x50, 0xdc, 0x4d, 0x57, 0x28, 0xc8, 0x2a, 0x78, 0x15, 0x10, 0x20, 0xc7,
+    0xb7, 0xce, 0x05, 0xb4, 0x17, 0x94, 0x59, 0x9b, 0x6e, 0xe4, 0xfb, 0x96, 0x4b, 0x03, 0x15, 0x54,
+    0x22, 0x61, 0xed, 0xa3, 0x07, 0x94, 0x60, 0x91, 0xc5, 0xcf, 0x3c, 0x95, 0xe8, 0xcf, 0xbd, 0x21,
+    0xf7, 0x65, 0x7f, 0x30, 0xce, 0x74, 0xe7, 0x05, 0xaa, 0x3a, 0x5e, 0x4f, 0x5a, 0xcc, 0x58, 0x64,
+    0x81, 0x08, 0x47, 0x6c, 0xbd, 0x6e, 0x97, 0xe1, 0x42, 0xe1, 0x8e, 0x71, 0x8b, 0xff, 0x26, 0x74,
+    0xe6, 0xb4, 0xda, 0xf8, 0xcc, 0x00, 0xb7, 0x66, 0xe6, 0x17, 0x47, 0x55, 0x73, 0x17, 0x74, 0x2d,
+    0x16, 0x45, 0x2a, 0x7a, 0x27, 0x6a, 0xc8, 0x36, 0x60, 0xcd, 0x09, 0x72, 0xb7, 0xb6, 0xc6, 0x3c,
+    0x47, 0x7b, 0xf3, 0x20, 0xf5, 0xcf, 0x44, 0xa4, 0x9e, 0xfa, 0x0f, 0x4f, 0x38, 0x55, 0xb7, 0x4d,
+    0x7b, 0xac, 0xfe, 0xcc, 0x01, 0x80, 0xf9, 0x50, 0xea, 0xa2, 0xd2, 0xe5, 0xb3, 0x76, 0x52, 0x6a,
+    0x1d, 0xad, 0x10, 0x73, 0xfc, 0xc8, 0x9e, 0x3f, 0x7c, 0x53, 0xe8, 0x73, 0x8f, 0xae, 0x9b, 0x2c,
+    0xe2, 0x90, 0xa7, 0x89, 0x81, 0xde, 0x9f, 0x56, 0x5d, 0xba, 0x76, 0x7b, 0x9b, 0x05, 0xc0, 0x36,
+    0x86, 0x5a, 0x72, 0x53, 0x64, 0x70, 0xde, 0x43, 0x97, 0x80, 0x77, 0x40, 0xd4, 0x01, 0x19, 0xf3,
+    0x5e, 0xeb, 0x87, 0x9e, 0x29, 0xaf, 0x45, 0x8f, 0x39, 0xd0, 0xca, 0xd2, 0xf1, 0xc4, 0x6c, 0x4d,
+    0x46, 0x19, 0xc2, 0x1e, 0x86, 0x77, 0x01, 0xf7, 0x52, 0x03, 0x98, 0xca, 0x5e, 0x44, 0x44, 0xc8,
+    0xde, 0x89, 0x2a, 0x31, 0x2b, 0xb6, 0xfc, 0x26, 0xf1, 0xf6, 0x9f, 0x9e, 0x89, 0xbe, 0x83, 0x0f,
+    0xc7, 0x1a, 0x7b, 0x56, 0x2a, 0xa1, 0x2a, 0xa8, 0x85, 0x83, 0x55, 0x7d, 0x2c, 0xb4, 0x81, 0x68,
+    0xe4, 0x74, 0xc7, 0xa3, 0x02, 0x06, 0x77, 0xd6, 0xd9, 0x9e, 0x04, 0xed, 0xb6, 0x2d, 0x05, 0xe8,
+    0x93, 0x7c, 0x15, 0x36, 0x4f, 0x1e, 0x12, 0x91, 0x3d, 0x54, 0xce, 0x74, 0x2b, 0x2c, 0xea, 0x1c,
+    0xee, 0xbd, 0xf8, 0x0d, 0xfc, 0xb3, 0x3a, 0x9c, 0xca, 0x98, 0x4d, 0x5b, 0x8e, 0x0b, 0x66, 0x57,
+    0x24, 0x51, 0xeb, 0x2f, 0x1f, 0xc8, 0xb2, 0x10, 0xc7, 0x13, 0x90, 0x70, 0x39, 0x61, 0xe9, 0xa6,
+    0x3f, 0xbe, 0x46, 0x13, 0xc0, 0x58, 0x10, 0xc4, 0xf4, 0xa2, 0xf5, 0xbe, 0xe2, 0x57, 0x43, 0xc4,
+    0xb9, 0x95, 0x82, 0x45, 0x61, 0xf5, 0x6c, 0xf9, 0x18, 0x7e, 0x66, 0xd2, 0x90, 0x17, 0x77, 0x94,
+    0xcc, 0xcd, 0x64, 0x5d, 0xa3, 0x14, 0x89, 0xf1, 0xfa, 0x41, 0xd9, 0xfa, 0xd4, 0xba, 0xf0, 0xd2,
+    0x0b, 0x55, 0xdb, 0x37, 0xfe, 0xb4, 0xb6, 0xf3, 0xd6, 0x38, 0xfa, 0x63, 0x05, 0x4a, 0x2b, 0x7c,
+    0xd5, 0x2c, 0x02, 0x9f, 0x33, 0x86, 0x41, 0x30, 0xf4, 0x90, 0x70, 0x5e, 0xc6, 0xf1, 0xaa, 0x86,
+    0xd6, 0x9c, 0xcc, 0x14, 0x40, 0x35, 0x01, 0x27, 0x29, 0x31, 0x91, 0x51, 0x38, 0xa6, 0x0b, 0x87,
+    0x19, 0x91, 0xa4, 0xe2, 0x60, 0x88, 0x8b, 0xc2, 0x8a, 0x81, 0xe9, 0x29, 0x5d, 0x2c, 0x1a, 0x99,
+    0x54, 0x91, 0x7f, 0x03, 0xfb, 0x46, 0x5e, 0x0d, 0xca, 0xf1, 0xba, 0x6e, 0xbe, 0x82, 0xf8, 0xf1,
+    0xc0, 0xe8, 0x2f, 0xf4, 0xf7, 0x91, 0x10, 0xf3, 0x4b, 0xb0, 0xde, 0xfd, 0x13, 0xaf, 0xd2, 0x6b,
+    0xa7, 0xba, 0x82, 0x45, 0x91, 0x15, 0x5c, 0x05, 0x16, 0xda, 0x8d, 0xbd, 0x28, 0xae, 0xf1, 0x1d,
+    0x20, 0x16, 0x1c, 0xa4, 0xc1, 0x72, 0x15, 0x66, 0x16, 0x0d, 0x27, 0xcb, 0xc0, 0xe5, 0x53, 0x78,
+    0xd0, 0x11, 0x7b, 0x6b, 0x10, 0x73, 0x4b, 0xdb, 0x46, 0x31, 0xd7, 0x9e, 0xa5, 0x85, 0xda, 0x0e,
+    0x71, 0xc7, 0x98, 0xb6, 0x87, 0xa1, 0x2b, 0xf0, 0x9c, 0x20, 0x81, 0xa9, 0x66, 0x04, 0x2e, 0x0d,
+    0xb1, 0x41, 0x5e, 0xc1, 0xaa, 0xe0, 0xa2, 0x57, 0xea, 0xaf, 0x44, 0x8f, 0x63, 0x5a, 0xad, 0xdc,
+    0xcd, 0x7d, 0x23, 0xba, 0xcd, 0xb9, 0xd3, 0xea, 0x5b, 0x91, 0x73, 0x2c, 0x88, 0x69, 0x1f, 0x14,
+    0x5d, 0x7d, 0x7c, 0x45, 0x67, 0x35, 0x16, 0xb7, 0x2c, 0x40, 0x3f, 0x6a, 0xe4, 0xc0, 0x66, 0x36,
+    0x92, 0xd0, 0xc2, 0x7d, 0x16, 0x5a, 0x93, 0x20, 0xa9, 0x75, 0x19, 0xaf, 0x46, 0x64, 0x20, 0x40,
+    0x78, 0x31, 0x00, 0xa5, 0x12, 0x24, 0xc2, 0x01, 0xc8, 0x89, 0xe1, 0xfa, 0x87, 0x14, 0x24, 0x85,
+    0x4c, 0x7a, 0xdc, 0xb9, 0x93, 0x01, 0xf9, 0x07, 0x7b, 0xab, 0x4d, 0x9a, 0x01, 0x35, 0x77, 0x5c,
+    0x1e, 0x16, 0x2a, 0x1b, 0xac, 0xb3, 0x53, 0xa6, 0x21, 0x39, 0x40, 0xf5, 0x9a, 0xc7, 0xe0, 0x29,
+    0x0d, 0x0f, 0xc4, 0xe5, 0x84, 0xf7, 0xb1, 0xfb, 0x3e, 0x52, 0x31, 0xc0, 0x20, 0x1d, 0x2a, 0x4e,
+    0xe0, 0x37, 0x20, 0x74, 0xdb, 0xd0, 0xf5, 0x97, 0x1a, 0xf7, 0x5d, 0xa4, 0xf6, 0xe0, 0x6f, 0x8f,
+    0xe2, 0xc1, 0xf0, 0xf3, 0xa3, 0x60, 0x57, 0xc1, 0x59, 0x31, 0x1a, 0x92, 0x0a, 0xfd, 0xdf, 0x88,
+    0x03, 0x07, 0x1b, 0x48, 0xfb, 0xaf, 0x6e, 0x48, 0x6c, 0xb0, 0x16, 0x4e, 0x40, 0x94, 0x25, 0x38,
+    0xd3, 0xf8, 0x05, 0xca, 0x42, 0x72, 0x4d, 0x3a, 0x9b, 0x2f, 0x0a, 0xd2, 0x44, 0xe6, 0x64, 0x5c,
+    0xc7, 0x01, 0x9f, 0x99, 0x07, 0x85, 0x70, 0x18, 0x93, 0x32, 0xf3, 0x8c, 0xf6, 0xe5, 0x62, 0x95,
+    0x0d, 0xa7, 0xf8, 0x47, 0xe4, 0x60, 0x11, 0xc6, 0xc9, 0x69, 0x9d, 0xfd, 0x99, 0xd0, 0xe8, 0x3c,
+    0xee, 0x59, 0x3e, 0x98, 0xb9, 0x22, 0x91, 0xd8, 0xc1, 0x91, 0x79, 0x48, 0xbd, 0x8a, 0x24, 0xac,
+    0xc5, 0x82, 0x31, 0xc3, 0x34, 0x34, 0x96, 0x97, 0xa6, 0x50, 0x4c, 0x8f, 0xf1, 0xd2, 0xa7, 0xf0,
+    0x16, 0xf5, 0x32, 0xa0, 0x7b, 0x02, 0x22, 0xf1, 0xd6, 0x7a, 0x72, 0x80, 0x1d, 0x27, 0x25, 0x41,
+    0x4a, 0x76, 0xf1, 0xd9, 0x45, 0xca, 0x41, 0x30, 0x95, 0x58, 0x88, 0x1d, 0x4c, 0x64, 0x42, 0x77,
+    0xfb, 0x9b, 0x7f, 0x2b, 0x70, 0x0f, 0x99, 0x03, 0x11, 0x90, 0x2c, 0x85, 0x82, 0xc4, 0x3b, 0x7c,
+    0xd6, 0xf0, 0xd7, 0xdd, 0xe9, 0xf9, 0x2e, 0x93, 0xa9, 0x96, 0x5d, 0x9d, 0x30, 0x67, 0x27, 0x53,
+    0x5f, 0x2a, 0xbd, 0x1a, 0xe9, 0x5a, 0x1b, 0x09, 0x66, 0xb1, 0xa6, 0x2b, 0x0a, 0x26, 0x97, 0x57,
+    0x24, 0x3d, 0x2d, 0x2b, 0xeb, 0xd3, 0xad, 0xba, 0xa6, 0x21, 0x08, 0x81, 0xa5, 0xb3, 0xa3, 0x2a,
+    0x36, 0x65, 0xed, 0x38, 0x2c, 0xbe, 0xca, 0xde, 0x65, 0xeb, 0x30, 0x7d, 0x14, 0xb3, 0x7c, 0x98,
+    0x03, 0x1e, 0xe7, 0xc4, 0xa1, 0x4f, 0xad, 0x9c, 0x75, 0xcb, 0xb6, 0x53, 0xf1, 0x36, 0x50, 0xa1,
+    0x20, 0x70, 0xf3, 0x94, 0x4c, 0xe3, 0x6f, 0x26, 0xdf, 0x0f, 0x2c, 0xa9, 0xce, 0x2a, 0x10, 0xbf,
+    0x2c, 0x12, 0xe3, 0x44, 0x3c, 0x21, 0x21, 0x9d, 0x72, 0x11, 0x30, 0x2b, 0xdf, 0xd8, 0xf8, 0x02,
+    0x47, 0x72, 0x5e, 0x77, 0x13, 0xcd, 0xe6, 0x87, 0x6c, 0x58, 0xf1, 0x1c, 0x01, 0x2a, 0xa8, 0xc3,
+    0x63, 0xeb, 0x47, 0x75, 0x65, 0x32, 0x7c, 0xf0, 0x06, 0xc9, 0x69, 0xc1, 0x68, 0xf1, 0x3f, 0xfe,
+    0x1c, 0xbd, 0x08, 0x5e, 0x8b, 0x43, 0xe5, 0x8f, 0x5b, 0x24, 0xb1, 0x76, 0x4c, 0xe2, 0xad, 0x45,
+    0x34, 0xeb, 0xdd, 0x98, 0xfd, 0xbd, 0x15, 0x4f, 0xa3, 0x2f, 0x64, 0x10, 0x31, 0x9a, 0x4a, 0xce,
+    0xdb, 0xe2, 0x78, 0xb9, 0xf6, 0x4f, 0x1b, 0x38, 0xb7, 0xc5, 0xae, 0xdf, 0x7f, 0x8b, 0x82, 0x85,
+    0x10, 0xb6, 0x74, 0x31, 0xdc, 0x57, 0x68, 0x26, 0x68, 0x11, 0x58, 0x8c, 0x5d, 0x4d, 0x16, 0x01,
+    0x7a, 0x47, 0x42, 0x6c, 0xf6, 0x90, 0xe1, 0x6c, 0x18, 0xa8, 0x7c, 0x80, 0xee, 0x6a, 0x7b, 0x04,
+    0x70, 0x1b, 0x2a, 0x8b, 0x4a, 0x16, 0x73, 0xc2, 0x64, 0x24, 0x85, 0x62, 0x0d, 0x90, 0xc6, 0x19,
+    0xaa, 0xad, 0xd7, 0x92, 0xa6, 0xde, 0x32, 0xb9, 0x97, 0x9c, 0xe7, 0x98, 0x7d, 0xf2, 0x35, 0xc4,
+    0x68, 0xe0, 0x4a, 0xbc, 0x44, 0xe1, 0xd2, 0x1d, 0xe8, 0x01, 0x50, 0x04, 0xf0, 0xe6, 0xec, 0x00,
+    0x46, 0xde, 0x86, 0x5b, 0x82, 0xfd, 0x8e, 0x5d, 0xce, 0x49, 0x89, 0x7c, 0xbd, 0x37, 0x92, 0x01,
+    0x86, 0x6a, 0xc9, 0x77, 0x86, 0x0d, 0xdf, 0x01, 0x3f, 0x54, 0xae, 0x06, 0x37, 0x45, 0xeb, 0xef,
+    0x4c, 0x66, 0xfa, 0x66, 0x3a, 0xf9, 0x7a, 0xca, 0x66, 0x8f, 0x63, 0x50, 0xba, 0x7a, 0x3e, 0x10,
+    0x30, 0x43, 0xcf, 0x9d, 0x51, 0x86, 0xd4, 0xeb, 0x7e, 0x20, 0xd3, 0x68, 0x20, 0x21, 0xea, 0x44,
+    0x51, 0xbe, 0xca, 0x49, 0x96, 0xe9, 0x09, 0x17, 0xbe, 0x95, 0x57, 0x4f, 0x28, 0xf0, 0xad, 0xd9,
+    0x28, 0x9b, 0x1e, 0x36, 0xfc, 0xb9, 0xeb, 0x60, 0x61, 0x6a, 0x03, 0x06, 0x2c, 0xdf, 0xf1, 0x29,
+    0x4f, 0x89, 0x70, 0xde, 0x20, 0x42, 0xd3, 0xbf, 0x9f, 0x54, 0x6f, 0x25, 0x4b, 0x69, 0x83, 0x67,
+    0x34, 0x81, 0x6f, 0x18, 0x6b, 0x78, 0xb2, 0xab, 0x49, 0xf8, 0xba, 0x66, 0x6c, 0x82, 0xe9, 0xb7,
+    0xc9, 0xdc, 0x6d, 0x6c, 0x81, 0x85, 0x2a, 0x29, 0x4e, 0x65, 0x24, 0xf4, 0x49, 0xef, 0x0e, 0xa8,
+    0xf9, 0xc1, 0x3e, 0x74, 0xff, 0x16, 0xbf, 0xfd, 0x6c, 0x3d, 0xc0, 0x83, 0x25, 0xd9, 0x3d, 0x10,
+    0x42, 0x9c, 0x30, 0x78, 0x05, 0x27, 0xcd, 0xa1, 0x41, 0xe0, 0xaa, 0xa4, 0x08, 0x41, 0x76, 0xa5,
+    0xa0, 0x09, 0x39, 0xcf, 0x44, 0xb2, 0xa6, 0x2b, 0x06, 0xcc, 0x65, 0x6a, 0x07, 0x83, 0x2a, 0x5a,
+    0xb5, 0x34, 0xc8, 0xdd, 0xed, 0x5c, 0x78, 0x96, 0xf4, 0xf0, 0x91, 0x01, 0xfe, 0x7c, 0x53, 0xc1,
+    0x2a, 0x74, 0x56, 0x53, 0x01, 0xb9, 0x48, 0x53, 0x14, 0x7d, 0x18, 0xe8, 0xb3, 0x43, 0x49, 0x87,
+    0x66, 0x2d, 0x93, 0x46, 0xce, 0x36, 0x35, 0x1b, 0xb5, 0x69, 0x57, 0x49, 0x27, 0x2a, 0xe8, 0x36,
+    0xd1, 0xc6, 0x71, 0x40, 0x4b, 0x35, 0x5d, 0x90, 0x24, 0x3c, 0x7e, 0x37, 0xeb, 0xe6, 0x81, 0xab,
+    0x6d, 0x94, 0x8b, 0x28, 0x62, 0x37, 0x9b, 0x32, 0x2e, 0x5f, 0xce, 0xcc, 0x1f, 0xb3, 0xcf, 0x78,
+    0xf8, 0x83, 0x4f, 0x5a, 0x9f, 0xdf, 0x09, 0xdb, 0x69, 0x61, 0x9d, 0xb3, 0x2a, 0x05, 0x6b, 0x3f,
+    0xc8, 0xb4, 0xda, 0x5f, 0x0f, 0xb6, 0x41, 0xa3, 0xd0, 0xb0, 0xac, 0x9f, 0x8c, 0x8b, 0x62, 0x56,
+    0x4c, 0x4f, 0xed, 0xf4, 0xb6, 0x79, 0x55, 0x3e, 0xd0, 0xa1, 0xc6, 0x6b, 0xc9, 0xd2, 0x8c, 0x1c,
+    0x94, 0x22, 0xc6, 0xb5, 0x52, 0xd5, 0xb6, 0x5d, 0x81, 0xdf, 0x85, 0x1e, 0x41, 0x68, 0x28, 0x36,
+    0xfe, 0x7d, 0x39, 0x95, 0xb1, 0x49, 0x9f, 0x9f, 0xf8, 0x3d, 0x90, 0x88, 0xb4, 0x2a, 0xb3, 0x96,
+    0xca, 0xf9, 0xb7, 0x6f, 0x9f, 0x92, 0x7b, 0x74, 0x6f, 0x82, 0x18, 0x0e, 0x15, 0xff, 0xe5, 0x6a,
+    0x55, 0x80, 0x17, 0x3f, 0xa3, 0x78, 0x3f, 0x78, 0xc3, 0x1e, 0xb3, 0x44, 0x22, 0x68, 0x25, 0x2f,
+    0xcf, 0x66, 0xa0, 0x30, 0xb2, 0xcc, 0x8d, 0x91, 0xee, 0xdc, 0xab, 0x0f, 0x46, 0x9a, 0x62, 0x17,
+    0xf6, 0xc8, 0x6b, 0x49, 0x0a, 0x1e, 0x4b, 0x4e, 0x38, 0xf4, 0xd8, 0xb8, 0x3b, 0xbc, 0xd1, 0xe3,
+    0x15, 0xc0, 0x27, 0x20, 0x76, 0xf3, 0x2a, 0x3f, 0x52, 0xe0, 0xd5, 0x41, 0x08, 0xdb, 0x90, 0xf8,
+    0x39, 0x01, 0x8e, 0xa3, 0x3d, 0x53, 0x0f, 0x10, 0x9b, 0x8a, 0xa5, 0xb9, 0xf1, 0x20, 0xa7, 0x20,
+    0xf4, 0xa7, 0xdf, 0xac, 0x08, 0x17, 0xa9, 0x7d, 0x9a, 0x77, 0xb1, 0xf1, 0x3d, 0x34, 0x6c, 0x9f,
+    0xf0, 0xa4, 0x98, 0xf1, 0xe5, 0x61, 0x11, 0xea, 0x71, 0xb7, 0x1b, 0xda, 0xea, 0xd6, 0x79, 0x2d,
+    0x90, 0xf8, 0x6e, 0xd4, 0xb8, 0xb8, 0x62, 0x24, 0xe3, 0x6f, 0xc4, 0xe4, 0xef, 0xb6, 0xa0, 0x4a,
+    0x40, 0x30, 0xc9, 0x9f, 0xe0, 0xa0, 0x5e, 0x35, 0xa0, 0xea, 0x84, 0xc2, 0x00, 0x38, 0xd0, 0xa6,
+    0x51, 0x5a, 0xad, 0x26, 0x1d, 0x26, 0xbe, 0x10, 0xbc, 0xe7, 0xed, 0x75, 0x85, 0x55, 0x5b, 0x3f,
+    0x68, 0x78, 0x13, 0x9b,
+};
+
+static const uint8_t data_wire[4125] = {
+    0x00, 0x03, 0x04, 0x2a, 0x02, 0x20, 0x01, 0x01, 0xff, 0x7a, 0xa0, 0x7e, 0xe1, 0xea, 0xf2, 0x3d,
+    0xc7, 0x39, 0x6d, 0x0d, 0xa6, 0x78, 0x16, 0x80, 0x05, 0x12, 0x3a, 0xa7, 0x4e, 0xde, 0x9f, 0x78,
+    0x9c, 0x70, 0x63, 0x01, 0x0b, 0xe6, 0xc8, 0x25, 0x21, 0x3d, 0xad, 0x22, 0xbc, 0x70, 0xb3, 0x85,
+    0xda, 0x21, 0x23, 0x63, 0x36, 0x17, 0x7b, 0xc3, 0x79, 0xfd, 0x62, 0x6c, 0xf9, 0x66, 0x43, 0xf1,
+    0x1f, 0xbd, 0x61, 0x63, 0xbd, 0x7c, 0x99, 0x90, 0x67, 0xf3, 0xd1, 0x98, 0xf0, 0x8c, 0x88, 0xd3,
+    0x90, 0x34, 0x3f, 0x14, 0xd1, 0xaa, 0xff, 0x72, 0x48, 0x27, 0x35, 0xf9, 0xde, 0x34, 0x4e, 0xb0,
+    0x4a, 0x10, 0xd8, 0xd5, 0x83, 0x7e, 0x10, 0xa4, 0x57, 0x4d, 0xd7, 0x31, 0x39, 0x3c, 0x26, 0x9f,
+    0x56, 0x69, 0x48, 0x3b, 0x0d, 0x32, 0x34, 0xa7, 0x0c, 0x79, 0x3d, 0x1a, 0x24, 0x37, 0xbf, 0xc2,
+    0x8b, 0xd2, 0x16, 0x20, 0xcf, 0x84, 0x7c, 0xbe, 0xc6, 0xba, 0xbb, 0xf4, 0x77, 0x3f, 0x32, 0x89,
+    0xc9, 0xbb, 0xae, 0xed, 0x0b, 0x7d, 0x14, 0xa7, 0x1e, 0xe0, 0xed, 0x3c, 0x0f, 0x8f, 0x3e, 0xb7,
+    0x78, 0xb6, 0x7e, 0x23, 0x38, 0x04, 0x7c, 0x01, 0x4d, 0x4b, 0x54, 0x38, 0xbd, 0xcc, 0x3a, 0xf0,
+    0x63, 0x23, 0x20, 0xc6, 0x4b, 0x4b, 0xfb, 0xff, 0xbd, 0x42, 0x33, 0x75, 0x5f, 0xff, 0x20, 0xe5,
+    0x40, 0x6d, 0x89, 0x6f, 0xf6, 0x43, 0x77, 0xf8, 0xf4, 0x1f, 0x1e, 0x04, 0x87, 0xba, 0x01, 0xe4,
+    0x21, 0x6e, 0x90, 0xf1, 0x46, 0xfd, 0xfd, 0x02, 0x47, 0x05, 0x2a, 0x17, 0x9e, 0x5f, 0xd9, 0x80,
+    0x78, 0x69, 0x83, 0x0a, 0x73, 0x67, 0xd2, 0x82, 0x9c, 0x0b, 0x03, 0xe3, 0xc0, 0xf4, 0x9d, 0x33,
+    0x74, 0xf1, 0x9f, 0x58, 0x1a, 0x8e, 0x02, 0x27, 0x78, 0x51, 0xb6, 0xeb, 0x45, 0x10, 0x6d, 0x4a,
+    0xad, 0xfe, 0x90, 0x66, 0xc1, 0xe1, 0xe6, 0xff, 0xbf, 0x8c, 0x9d, 0x9f, 0x30, 0xe8, 0xe4, 0x1a,
+    0xdc, 0x28, 0xb7, 0x40, 0xd7, 0xe3, 0x78, 0x2c, 0xcb, 0x8c, 0x01, 0x96, 0x34, 0x26, 0x51, 0xcb,
+    0x32, 0xab, 0x0a, 0x18, 0x14, 0x3f, 0x03, 0xad, 0x2e, 0x12, 0x58, 0x57, 0xd6, 0x7b, 0x4d, 0xda,
+    0x20, 0xc6, 0xee, 0xf2, 0x4f, 0xe2, 0x32, 0xe1, 0x2f, 0x21, 0x7a, 0x79, 0x04, 0x23, 0x65, 0x59,
+    0xc3, 0x27, 0x19, 0xa5, 0x14, 0x3f, 0x4e, 0x2f, 0x73, 0xa9, 0xe6, 0x5d, 0x22, 0x07, 0xc5, 0x1d,
+    0xbf, 0x1e, 0xb3, 0xd0, 0x2e, 0x12, 0x0a, 0x33, 0x3b, 0x66, 0x66, 0x47, 0xe7, 0x7d, 0xa4, 0x3b,
+    0xbd, 0x19, 0x43, 0xbd, 0xe0, 0x5b, 0x02, 0x14, 0x4c, 0x10, 0x96, 0xd5, 0xe4, 0x05, 0x23, 0x57,
+    0x10, 0x8a, 0x7b, 0xea, 0xda, 0x70, 0x66, 0x51, 0x22, 0xc7, 0x7a, 0xbd, 0x57, 0x66, 0xed, 0xdb,
+    0x6a, 0x81, 0x37, 0x07, 0x40, 0x35, 0x68, 0x62, 0xe3, 0x54, 0x33, 0x55, 0x93, 0x89, 0x99, 0x15,
+    0x43, 0x3d, 0x77, 0x50, 0x7e, 0xe9, 0x2c, 0x42, 0x6c, 0x4f, 0x63, 0xce, 0x48, 0x4a, 0x99, 0x3a,
+    0x57, 0x1a, 0x56, 0x1f, 0x79, 0xf9, 0xb5, 0xab, 0xc9, 0x2e, 0x6c, 0xcc, 0x04, 0xcb, 0x99, 0x3e,
+    0x50, 0x0d, 0x19, 0x4c, 0x1e, 0x4d, 0x32, 0x50, 0xb0, 0xb7, 0x68, 0xd7, 0x76, 0xcb, 0xb2, 0x4e,
+    0x60, 0x87, 0x73, 0xa0, 0xa3, 0xf3, 0x34, 0x81, 0x8a, 0x59, 0xe1, 0x21, 0x3f, 0x7c, 0x10, 0x2d,
+    0x2d, 0xac, 0xdc, 0x16, 0xfb, 0xac, 0xc8, 0x10, 0xea, 0x12, 0x24, 0x18, 0xf6, 0x21, 0xb5, 0xeb,
+    0x01, 0xb2, 0xc0, 0xd3, 0x78, 0x2b, 0xa5, 0x86, 0x17, 0x0c, 0xb3, 0xc8, 0xbf, 0x61, 0x67, 0x27,
+    0x5b, 0x97, 0x3e, 0xe7, 0xfe, 0x21, 0x60, 0x61, 0x67, 0x6a, 0xbb, 0xa8, 0x8b, 0x92, 0xa7, 0x3a,
+    0x79, 0x9d, 0xea, 0x70, 0x5e, 0x2a, 0x01, 0xff, 0x68, 0x86, 0xbe, 0x2e, 0x8d, 0x58, 0x56, 0xa5,
+    0x74, 0xbf, 0x7d, 0xe4, 0x76, 0xaa, 0xe3, 0x56, 0xfe, 0xbb, 0x5c, 0xd8, 0x9b, 0xad, 0x5d, 0xbb,
+    0x9f, 0x2d, 0x9d, 0xb4, 0x55, 0x18, 0x49, 0xa2, 0x3d, 0x19, 0x63, 0x4f, 0x27, 0xd5, 0x60, 0xcf,
+    0x83, 0xbc, 0xfb, 0xef, 0x79, 0x62, 0x24, 0x1a, 0xa2, 0xbc, 0x41, 0x04, 0x77, 0x53, 0xbc, 0x79,
+    0xd3, 0x8b, 0x1a, 0x4a, 0xb5, 0xc0, 0xfb, 0x9e, 0x02, 0x48, 0xf4, 0x45, 0x35, 0xea, 0x56, 0x5d,
+    0x70, 0x93, 0x5f, 0xa7, 0xd4, 0xfe, 0x3a, 0x6f, 0xd6, 0x7b, 0x03, 0x22, 0x1e, 0x25, 0x0e, 0xc8,
+    0x2a, 0x24, 0x66, 0x52, 0x55, 0x5b, 0x5a, 0x52, 0xf3, 0xe7, 0x51, 0xad, 0x58, 0xe5, 0x24, 0x31,
+    0xe9, 0x7d, 0xf1, 0x75, 0x81, 0x98, 0x58, 0xd1, 0x52, 0x11, 0x6a, 0xa4, 0xbb, 0xa8, 0x95, 0x30,
+    0x62, 0x3a, 0x49, 0xa3, 0x37, 0x86, 0x76, 0xa8, 0xef, 0xec, 0x9c, 0xfe, 0xaa, 0x63, 0xe5, 0x43,
+    0x64, 0xb9, 0x93, 0x2c, 0xf2, 0x7c, 0xab, 0x20, 0x64, 0x61, 0x39, 0xd2, 0x0e, 0xc1, 0xe2, 0x4f,
+    0xd6, 0xb3, 0xac, 0xae, 0x85, 0xf4, 0xdf, 0x98, 0x7d, 0xbe, 0x61, 0x59, 0xa7, 0x5c, 0xd0, 0x9a,
+    0xc3, 0x95, 0xd8, 0x17, 0x78, 0x82, 0xf8, 0x40, 0x0f, 0x74, 0x6a, 0x49, 0x2e, 0x8a, 0x07, 0xab,
+    0x5d, 0xde, 0x8b, 0xb7, 0x36, 0xbb, 0x01, 0x0b, 0x73, 0x33, 0x8f, 0xff, 0x7b, 0x70, 0x58, 0x13,
+    0x8c, 0xf8, 0x2c, 0xed, 0x54, 0x89, 0xcb, 0x67, 0x95, 0x0f, 0x7f, 0xd1, 0x21, 0xaa, 0x97, 0xaa,
+    0xc1, 0x12, 0xef, 0xcf, 0xb7, 0xec, 0xe6, 0xa0, 0x55, 0x4c, 0x13, 0x54, 0x34, 0xa7, 0xb9, 0x76,
+    0x1c, 0x16, 0x69, 0x76, 0x12, 0xfb, 0xe5, 0x6c, 0xce, 0xd2, 0x60, 0x6b, 0x07, 0x4f, 0x70, 0x0a,
+    0x44, 0xd8, 0xf2, 0x66, 0x72, 0x90, 0xff, 0x36, 0x15, 0xe2, 0xc2, 0x3c, 0x94, 0x04, 0x4c, 0x8d,
+    0x06, 0xff, 0x14, 0xf7, 0xaa, 0x3a, 0xcb, 0x97, 0x4d, 0x67, 0xb0, 0x35, 0x03, 0xe1, 0x18, 0xef,
+    0x35, 0x83, 0x33, 0xee, 0x0f, 0x99, 0x21, 0x69, 0xfa, 0xde, 0x39, 0x9e, 0x9f, 0x7c, 0x17, 0x67,
+    0x95, 0x68, 0xea, 0x07, 0xd3, 0xa3, 0x5b, 0xe7, 0x04, 0x7b, 0x42, 0x58, 0xff, 0x48, 0xea, 0x24,
+    0x4f, 0xe7, 0x61, 0xe5, 0xc7, 0x45, 0x2b, 0xe2, 0xef, 0xf7, 0xf5, 0x2a, 0xe2, 0x80, 0x9c, 0x89,
+    0x9a, 0x8b, 0xb0, 0xa1, 0xc9, 0x17, 0x27, 0xab, 0x8a, 0x12, 0xad, 0x97, 0x80, 0xfa, 0x24, 0x5b,
+    0xc2, 0x0b, 0x46, 0x13, 0xa0, 0x22, 0x97, 0xea, 0x26, 0x8b, 0xc4, 0x10, 0x33, 0xe1, 0x43, 0xf6,
+    0x0c, 0x54, 0x88, 0xa7, 0x39, 0x03, 0xed, 0x6c, 0x55, 0x86, 0xa6, 0x18, 0x3c, 0x38, 0x3d, 0xb3,
+    0x2a, 0x27, 0x34, 0x99, 0xfb, 0x1b, 0x69, 0xb8, 0x8c, 0x4b, 0x2e, 0xfd, 0xbd, 0x38, 0x01, 0xfe,
+    0x83, 0x23, 0x60, 0xb3, 0x07, 0x7c, 0x2e, 0xa5, 0x83, 0x62, 0x55, 0x58, 0xa7, 0xb7, 0x76, 0x69,
+    0x7c, 0x4a, 0xa6, 0x5f, 0x28, 0x6c, 0x18, 0x1a, 0x5a, 0x98, 0xa8, 0x9d, 0x32, 0xd5, 0x15, 0x27,
+    0x27, 0x63, 0x94, 0x86, 0xb0, 0x4d, 0x49, 0xdf, 0xf7, 0x2a, 0xfc, 0xf8, 0xfb, 0xbd, 0xd2, 0x79,
+    0x42, 0x5e, 0xc8, 0x9e, 0x41, 0x65, 0xf6, 0xce, 0xd2, 0x93, 0xc1, 0x37, 0xe5, 0x66, 0x0f, 0xf9,
+    0xc3, 0xff, 0x05, 0x0f, 0xbb, 0x01, 0x96, 0xe1, 0xa5, 0xfd, 0x23, 0x03, 0x0c, 0xc8, 0x11, 0x2a,
+    0x9f, 0x4c, 0xd2, 0x7b, 0xc3, 0xe5, 0xc8, 0x89, 0x4c, 0xde, 0xa9, 0xcd, 0xe0, 0xca, 0xc1, 0x3c,
+    0x50, 0xcf, 0x6c, 0x4b, 0xcf, 0xd0, 0xe9, 0x8d, 0x29, 0x4f, 0x4f, 0x7c, 0xf7, 0x58, 0xf5, 0xff,
+    0x83, 0xd1, 0xfc, 0xb4, 0x55, 0x01, 0xff, 0xd3, 0x88, 0xf5, 0x43, 0x0d, 0xeb, 0x6f, 0x47, 0xc9,
+    0x27, 0x10, 0x9f, 0xf1, 0x05, 0x5d, 0x58, 0x4c, 0x9a, 0xdb, 0x36, 0xe3, 0x60, 0xeb, 0x2b, 0x5c,
+    0x82, 0x93, 0xde, 0xbb, 0xfe, 0x88, 0x82, 0x6a, 0x4e, 0x01, 0xcb, 0x8b, 0x71, 0xfd, 0xad, 0x44,
+    0x53, 0x25, 0xd2, 0xd7, 0x93, 0xbd, 0x76, 0x50, 0x06, 0x1c, 0xaf, 0x73, 0x14, 0x65, 0x04, 0x2a,
+    0xe7, 0x78, 0xb2, 0x33, 0x4c, 0x79, 0x0f, 0xdd, 0x51, 0x69, 0x79, 0x36, 0x16, 0x38, 0x2b, 0xcc,
+    0xdb, 0xac, 0xec, 0xa3, 0x4b, 0x26, 0xd7, 0xc5, 0xa0, 0x42, 0xbc, 0x45, 0x38, 0x05, 0x4f, 0x62,
+    0xe8, 0x3e, 0x7e, 0xd3, 0x94, 0xc0, 0x66, 0xec, 0x42, 0xa7, 0xb6, 0xd7, 0xdb, 0xb4, 0x81, 0xef,
+    0xa4, 0xc0, 0xd2, 0x05, 0xf0, 0xb2, 0xb1, 0xd1, 0xf2, 0x7f, 0xb4, 0x5b, 0x59, 0x64, 0x04, 0x96,
+    0x12, 0x0b, 0xa8, 0x6d, 0x1e, 0x3a, 0xa3, 0xc4, 0xce, 0x6f, 0x6e, 0x91, 0xbb, 0x21, 0xd7, 0x0d,
+    0x12, 0x63, 0x4c, 0x0d, 0x19, 0x36, 0xc0, 0xdb, 0x90, 0xf9, 0xbb, 0x1d, 0xbe, 0x67, 0x79, 0xbd,
+    0x09, 0x10, 0xbf, 0x32, 0x54, 0xa1, 0x2e, 0x70, 0xe7, 0x63, 0x18, 0xbd, 0xdd, 0x2d, 0xe5, 0x75,
+    0x87, 0xe1, 0x41, 0xa9, 0x33, 0xf6, 0x67, 0xc6, 0x91, 0xdc, 0xd9, 0xc5, 0xde, 0xac, 0x56, 0x8e,
+    0x18, 0xc0, 0x4e, 0xd9, 0x93, 0x56, 0xd4, 0xc4, 0xf0, 0x38, 0x14, 0xd8, 0xda, 0xb6, 0xa3, 0x34,
+    0x76, 0xee, 0xc1, 0x01, 0x5f, 0xe3, 0x32, 0x2e, 0x8f, 0x2b, 0xf3, 0x37, 0xb3, 0x6d, 0x01, 0x3b,
+    0xf0, 0x1d, 0x5e, 0x3b, 0xab, 0x39, 0xc8, 0x06, 0x90, 0x76, 0x14, 0xa4, 0x87, 0x88, 0xbf, 0x16,
+    0xbe, 0xc7, 0xf3, 0x17, 0xb5, 0x78, 0x78, 0x93, 0x95, 0xd8, 0xdc, 0xfb, 0x3c, 0x9e, 0x29, 0x8d,
+    0x09, 0xf6, 0x22, 0x4d, 0x0d, 0xff, 0xfa, 0x6d, 0x66, 0x5e, 0x39, 0x0d, 0xdd, 0xee, 0x59, 0x26,
+    0xd1, 0xd4, 0xf9, 0xd3, 0x85, 0x0e, 0x8b, 0xef, 0xca, 0x1f, 0x0e, 0x62, 0xa0, 0xb7, 0x84, 0x5f,
+    0x23, 0x80, 0xa4, 0xa9, 0x0f, 0xb0, 0xdc, 0xce, 0xeb, 0x5b, 0x40, 0xa2, 0x89, 0xa8, 0xd5, 0x70,
+    0xac, 0x27, 0xf6, 0x0e, 0x23, 0xac, 0x57, 0xcc, 0x44, 0xd7, 0x12, 0xde, 0xd0, 0x31, 0x67, 0x29,
+    0x51, 0xf2, 0x7c, 0xfa, 0xbb, 0xf0, 0x39, 0xbe, 0x78, 0x1f, 0x01, 0x9d, 0xc3, 0x6e, 0xd7, 0x50,
+    0x5d, 0x75, 0xf9, 0x33, 0x96, 0xb4, 0xa1, 0x5c, 0x79, 0xa3, 0x69, 0xff, 0x01, 0xfa, 0x7d, 0x6c,
+    0x6d, 0x08, 0x5d, 0x0c, 0x8c, 0x51, 0x98, 0xd4, 0xe8, 0x82, 0xa0, 0x32, 0x96, 0x2a, 0xbf, 0xa2,
+    0xca, 0x55, 0x87, 0xbc, 0x23, 0x30, 0x3c, 0x6c, 0xec, 0x3f, 0xf1, 0x32, 0x36, 0xcf, 0x9f, 0xc7,
+    0x17, 0x01, 0xe7, 0x65, 0x8e, 0x31, 0xc3, 0x1e, 0x57, 0x82, 0x96, 0x3c, 0x62, 0x06, 0x5b, 0x35,
+    0xac, 0xe6, 0x49, 0x67, 0xa6, 0xe8, 0x13, 0x5b, 0xe2, 0xc3, 0x60, 0x0e, 0x68, 0x5a, 0x3a, 0x3e,
+    0xbe, 0x62, 0xa7, 0xce, 0xb1, 0x9e, 0xce, 0x68, 0x3d, 0x21, 0x44, 0x57, 0x2f, 0x6b, 0x1f, 0x5b,
+    0x5c, 0xd5, 0x3e, 0xbd, 0xd1, 0x5d, 0x0d, 0xcf, 0x6a, 0x47, 0x5b, 0xe4, 0xe4, 0xd1, 0xf6, 0x32,
+    0xcf, 0x4b, 0xb7, 0x0f, 0xaf, 0x0e, 0x6b, 0x79, 0xf8, 0x9d, 0x9d, 0x71, 0x62, 0x2c, 0x3a, 0xd8,
+    0x80, 0xce, 0x88, 0xa9, 0x9a, 0x05, 0x8a, 0x5f, 0xfa, 0xdb, 0x23, 0x2c, 0x31, 0x82, 0xd9, 0x27,
+    0xab, 0xc3, 0x93, 0x06, 0xce, 0xa1, 0x3f, 0x45, 0xbe, 0x0d, 0xf4, 0x3b, 0xf4, 0x17, 0x96, 0x4f,
+    0x16, 0xfb, 0x25, 0xb8, 0xc6, 0x05, 0xca, 0x60, 0xbb, 0x2e, 0x3c, 0xf4, 0xef, 0x65, 0x8e, 0x0f,
+    0xe5, 0xbf, 0x2a, 0xf3, 0x01, 0xff, 0x71, 0x7a, 0x39, 0x15, 0x70, 0x30, 0xfa, 0xa2, 0x8f, 0x36,
+    0x13, 0xee, 0x15, 0x7b, 0x41, 0x11, 0x10, 0x47, 0xe6, 0x5e, 0xf6, 0xbd, 0x67, 0x2f, 0x11, 0xc2,
+    0x02, 0xe4, 0x37, 0xdf, 0xb1, 0x16, 0x59, 0x5e, 0x52, 0x85, 0x86, 0xae, 0xaf, 0x11, 0x0d, 0x40,
+    0x25, 0x89, 0xd7, 0x63, 0xb6, 0x85, 0xb3, 0x75, 0x07, 0x3c, 0xa1, 0x3d, 0x9e, 0x9e, 0x18, 0x34,
+    0x9d, 0x6d, 0xf1, 0x59, 0xea, 0x3c, 0x57, 0x65, 0xb0, 0xe4, 0xea, 0xbd, 0x23, 0x4f, 0xa2, 0xf6,
+    0x95, 0xdd, 0xa0, 0x09, 0x7b, 0x9f, 0xa9, 0x3d, 0x9f, 0xb5, 0xb4, 0x19, 0x57, 0xb2, 0xec, 0xcf,
+    0xea, 0x65, 0xcd, 0x0c, 0xc7, 0x5b, 0xdc, 0x59, 0xa6, 0xb4, 0x83, 0x36, 0xaf, 0xc0, 0x80, 0x21,
+    0x92, 0xf0, 0xbc, 0xfc, 0x70, 0xb5, 0x53, 0xea, 0xfd, 0x12, 0xb8, 0xd0, 0x77, 0x84, 0x1e, 0x20,
+    0x56, 0xda, 0xbf, 0xda, 0x27, 0x8f, 0xfa, 0x1d, 0xe6, 0xbb, 0x1f, 0x87, 0xf8, 0xc5, 0x20, 0x3d,
+    0xfa, 0xe3, 0x88, 0x55, 0x1c, 0x23, 0x74, 0x70, 0xc0, 0xf3, 0xce, 0x53, 0x1e, 0x57, 0xe0, 0x74,
+    0x0b, 0x89, 0xa9, 0x09, 0x34, 0x98, 0xde, 0xc5, 0x06, 0x8a, 0x0d, 0x93, 0x8f, 0x16, 0x53, 0x7f,
+    0x6c, 0xf0, 0x27, 0x29, 0x2a, 0x37, 0x65, 0xf7, 0x3f, 0xb9, 0x66, 0xb0, 0x17, 0x0b, 0x65, 0x17,
+    0x90, 0x24, 0x06, 0x6b, 0x02, 0x29, 0x94, 0xaa, 0x44, 0xb5, 0x10, 0x68, 0x84, 0x3d, 0x5c, 0xc2,
+    0xa0, 0x34, 0x62, 0xf4, 0xcc, 0x54, 0x6d, 0xdc, 0x34, 0xdb, 0x23, 0xb4, 0x77, 0x70, 0xb4, 0xd5,
+    0x15, 0x9f, 0x63, 0x11, 0xb3, 0x58, 0xee, 0x01, 0xd6, 0xd9, 0x79, 0x1b, 0xbe, 0xef, 0x66, 0x2d,
+    0x71, 0x7c, 0x7d, 0x76, 0x55, 0x6f, 0x48, 0xdc, 0x1a, 0xef, 0x29, 0x53, 0x87, 0x11, 0x7c, 0x81,
+    0x24, 0xc2, 0x7b, 0xc3, 0xff, 0x20, 0x4e, 0x14, 0xb0, 0x5b, 0xdf, 0xb3, 0xbb, 0xdc, 0x65, 0xa6,
+    0x4b, 0x3f, 0xee, 0xdb, 0x36, 0xbb, 0x30, 0x1c, 0xe3, 0x6e, 0xe9, 0xa5, 0xb6, 0xe3, 0x46, 0x22,
+    0xd0, 0x8a, 0xcf, 0x08, 0xef, 0x53, 0x03, 0x7f, 0xb1, 0xb3, 0x56, 0xdc, 0x7f, 0xd5, 0xa5, 0x29,
+    0x80, 0x40, 0x3a, 0x37, 0xd6, 0x97, 0xef, 0x88, 0xc0, 0xc8, 0xc9, 0x83, 0x39, 0x3d, 0x98, 0xab,
+    0xe0, 0xa9, 0x73, 0x58, 0x99, 0x6d, 0xde, 0x29, 0xb5, 0x3e, 0x5d, 0x9c, 0xdf, 0xbe, 0x36, 0x20,
+    0xe2, 0x4b, 0x6b, 0xaa, 0x18, 0x6c, 0xea, 0x73, 0x98, 0x1a, 0x11, 0x45, 0xe7, 0x2c, 0x01, 0x8b,
+    0xe8, 0x40, 0xb4, 0xec, 0xcc, 0x7f, 0xf0, 0xc2, 0xd4, 0x01, 0x93, 0x6d, 0x82, 0xca, 0xed, 0xc5,
+    0x33, 0x51, 0x73, 0xf6, 0xe4, 0x7d, 0xdd, 0x90, 0x5d, 0x68, 0xcc, 0x09, 0x52, 0xe6, 0x65, 0x04,
+    0x7d, 0x26, 0x4d, 0xc5, 0x15, 0x59, 0x4e, 0x39, 0x3c, 0x6f, 0xbf, 0xd4, 0x95, 0xcd, 0xfa, 0xa0,
+    0x05, 0xfe, 0x82, 0xa0, 0x3b, 0x5a, 0xc6, 0xb1, 0x35, 0xed, 0xf1, 0xed, 0x41, 0x0f, 0x68, 0xb4,
+    0xbb, 0x80, 0xe8, 0x60, 0xb0, 0xb2, 0x6f, 0xe8, 0xf0, 0xf3, 0xbd, 0x24, 0xb9, 0x08, 0x39, 0xab,
+    0xf8, 0x54, 0x84, 0x11, 0x7b, 0x36, 0x43, 0xfb, 0x81, 0xb8, 0x2e, 0x48, 0xb4, 0x27, 0x13, 0x85,
+    0x39, 0x1d, 0x74, 0x8e, 0x27, 0x6a, 0x94, 0x86, 0x68, 0x40, 0x20, 0xa1, 0xf8, 0x60, 0x71, 0xd1,
+    0x3f, 0x1e, 0xb8, 0x43, 0xd8, 0xde, 0x10, 0x4a, 0xc4, 0xcf, 0x28, 0x15, 0xca, 0x5d, 0x21, 0x94,
+    0xae, 0xb8, 0x83, 0x08, 0x13, 0x58, 0xc7, 0xeb, 0x38, 0x2c, 0x60, 0x0c, 0x5d, 0xcc, 0x7d, 0x39,
+    0x2d, 0x41, 0x10, 0x22, 0x46, 0xa9, 0x96, 0x03, 0xa0, 0x8b, 0x43, 0x0a, 0x99, 0xfb, 0x2f, 0x5d,
+    0x9d, 0x6c, 0x83, 0x01, 0xff, 0x9a, 0xb0, 0x2d, 0xce, 0x31, 0xa2, 0x5e, 0x4e, 0xd5, 0xeb, 0x87,
+    0xfe, 0x75, 0xb7, 0x70, 0x27, 0x4f, 0xca, 0x35, 0xae, 0x8c, 0x03, 0xb6, 0x32, 0xea, 0x74, 0x2e,
+    0x6a, 0x0e, 0x90, 0x07, 0xd0, 0xa6, 0xb3, 0x26, 0x4e, 0x83, 0x3a, 0x6b, 0xd7, 0x45, 0xfc, 0xdb,
+    0x0d, 0x55, 0x2f, 0xfd, 0xa7, 0x38, 0x1a, 0xeb, 0x01, 0x65, 0x7d, 0x69, 0x6f, 0xb2, 0x41, 0x52,
+    0x65, 0x93, 0x7e, 0x46, 0xd0, 0x83, 0xbb, 0x53, 0xba, 0x15, 0x09, 0x2a, 0x83, 0x3f, 0xf1, 0x0f,
+    0x99, 0x24, 0x4c, 0x1b, 0x94, 0xc8, 0xab, 0x0b, 0xb1, 0xce, 0x99, 0xed, 0xcd, 0xe9, 0x9b, 0xdb,
+    0x1a, 0xff, 0xb4, 0xf5, 0xa6, 0x91, 0x6b, 0x50, 0x51, 0x27, 0x7d, 0xb3, 0x3f, 0xbe, 0x35, 0x06,
+    0x35, 0x6a, 0x0c, 0x0e, 0x79, 0xdd, 0x62, 0x85, 0x86, 0xda, 0x01, 0x69, 0xf4, 0x9b, 0xb7, 0xb4,
+    0xa9, 0x25, 0x44, 0x4e, 0x01, 0xda, 0x47, 0xa4, 0x34, 0x9e, 0x1f, 0xbe, 0x92, 0x84, 0x94, 0xf6,
+    0x7a, 0x65, 0x19, 0x4d, 0x7a, 0x1a, 0x56, 0xb3, 0xde, 0x99, 0x86, 0xc2, 0x32, 0xda, 0xb9, 0x7b,
+    0x43, 0x70, 0x19, 0x65, 0x76, 0xe3, 0xf3, 0x27, 0x15, 0x09, 0x87, 0xd7, 0xfe, 0x87, 0x81, 0x68,
+    0xee, 0x72, 0x12, 0xdb, 0x71, 0x3d, 0xe1, 0x88, 0xe3, 0x61, 0xfb, 0x34, 0x6a, 0x02, 0xac, 0xaf,
+    0xa7, 0x32, 0xb9, 0x34, 0x69, 0x0f, 0xec, 0xb5, 0x49, 0x13, 0x6f, 0x82, 0x8a, 0xcc, 0xa7, 0x69,
+    0xb4, 0x0e, 0x5b, 0x2d, 0x09, 0x94, 0x40, 0xf3, 0x9c, 0x87, 0x38, 0x2f, 0x89, 0xfd, 0x93, 0x47,
+    0x73, 0x9e, 0xcb, 0x4a, 0x80, 0x9e, 0x6d, 0x9c, 0xb7, 0xbe, 0x62, 0xe9, 0x96, 0xf5, 0x02, 0xe3,
+    0xa6, 0x03, 0xa0, 0x2e, 0x2b, 0x78, 0x8e, 0x9a, 0x36, 0xca, 0x63, 0xc9, 0xe6, 0x41, 0x24, 0x99,
+    0x9f, 0x76, 0x59, 0xff, 0xb0, 0x09, 0xfb, 0x87, 0x89, 0x65, 0x78, 0xc5, 0xed, 0xf1, 0x77, 0x8d,
+    0xc1, 0x32, 0x60, 0xfa, 0xb4, 0x08, 0xfa, 0xbf, 0xfc, 0xbc, 0xc5, 0x76, 0xf3, 0x05, 0x8e, 0xff,
+    0xe9, 0xf0, 0xca, 0x86, 0xae, 0x35, 0x6b, 0x45, 0x70, 0x01, 0xf2, 0x54, 0x5b, 0xd6, 0x20, 0x09,
+    0xd1, 0xe2, 0xc0, 0x4a, 0x53, 0x74, 0xfe, 0x80, 0x87, 0xb7, 0x2a, 0xaf, 0x66, 0x3d, 0x58, 0xa6,
+    0xe4, 0xcc, 0xce, 0x21, 0x3a, 0x3c, 0x2b, 0x1b, 0xa5, 0x48, 0x53, 0x39, 0x81, 0xb3, 0xc9, 0x62,
+    0x43, 0xc8, 0xd7, 0x0a, 0x4a, 0x16, 0xa4, 0x48, 0x33, 0xf0, 0xa2, 0x98, 0x6d, 0x78, 0x7f, 0x59,
+    0x65, 0x80, 0x63, 0x74, 0x3e, 0x01, 0x25, 0xcd, 0x97, 0xd6, 0x72, 0xbf, 0xc1, 0x48, 0x75, 0x8c,
+    0x99, 0x13, 0x3a, 0x34, 0x2f, 0x60, 0xee, 0x3c, 0xb6, 0xa1, 0x3d, 0x6b, 0xf9, 0x1e, 0x0d, 0x59,
+    0x3d, 0x85, 0x68, 0x61, 0xaf, 0x28, 0x5a, 0x2a, 0x33, 0x56, 0x10, 0x91, 0x3f, 0x84, 0x69, 0x57,
+    0x89, 0xa2, 0xc9, 0x45, 0x38, 0xcd, 0x07, 0xb6, 0x22, 0xda, 0x10, 0x0b, 0xa9, 0x57, 0xc3, 0x30,
+    0xd4, 0x1f, 0xe0, 0x05, 0x33, 0xf4, 0x92, 0xa7, 0x76, 0x7a, 0x22, 0x18, 0x4f, 0xbc, 0x07, 0x31,
+    0x9a, 0x50, 0xdc, 0x4d, 0x57, 0x28, 0xc8, 0x2a, 0x78, 0x15, 0x10, 0x20, 0xc7, 0xb7, 0xce, 0x05,
+    0xb4, 0x17, 0x94, 0x59, 0x9b, 0x6e, 0xe4, 0xfb, 0x96, 0x4b, 0x03, 0x15, 0x54, 0x22, 0x61, 0xed,
+    0xa3, 0x07, 0x94, 0x60, 0x91, 0xc5, 0xcf, 0x3c, 0x95, 0xe8, 0xcf, 0xbd, 0x21, 0xf7, 0x65, 0x7f,
+    0x30, 0xce, 0x74, 0xe7, 0x05, 0xaa, 0x3a, 0x5e, 0x4f, 0x5a, 0xcc, 0x58, 0x64, 0x81, 0x08, 0x47,
+    0x6c, 0xbd, 0x6e, 0x97, 0xe1, 0x42, 0xe1, 0x8e, 0x71, 0x8b, 0xff, 0x26, 0x74, 0xe6, 0xb4, 0xda,
+    0xf8, 0xcc, 0x01, 0xff, 0xb7, 0x66, 0xe6, 0x17, 0x47, 0x55, 0x73, 0x17, 0x74, 0x2d, 0x16, 0x45,
+    0x2a, 0x7a, 0x27, 0x6a, 0xc8, 0x36, 0x60, 0xcd, 0x09, 0x72, 0xb7, 0xb6, 0xc6, 0x3c, 0x47, 0x7b,
+    0xf3, 0x20, 0xf5, 0xcf, 0x44, 0xa4, 0x9e, 0xfa, 0x0f, 0x4f, 0x38, 0x55, 0xb7, 0x4d, 0x7b, 0xac,
+    0xfe, 0xcc, 0x01, 0x80, 0xf9, 0x50, 0xea, 0xa2, 0xd2, 0xe5, 0xb3, 0x76, 0x52, 0x6a, 0x1d, 0xad,
+    0x10, 0x73, 0xfc, 0xc8, 0x9e, 0x3f, 0x7c, 0x53, 0xe8, 0x73, 0x8f, 0xae, 0x9b, 0x2c, 0xe2, 0x90,
+    0xa7, 0x89, 0x81, 0xde, 0x9f, 0x56, 0x5d, 0xba, 0x76, 0x7b, 0x9b, 0x05, 0xc0, 0x36, 0x86, 0x5a,
+    0x72, 0x53, 0x64, 0x70, 0xde, 0x43, 0x97, 0x80, 0x77, 0x40, 0xd4, 0x01, 0x19, 0xf3, 0x5e, 0xeb,
+    0x87, 0x9e, 0x29, 0xaf, 0x45, 0x8f, 0x39, 0xd0, 0xca, 0xd2, 0xf1, 0xc4, 0x6c, 0x4d, 0x46, 0x19,
+    0xc2, 0x1e, 0x86, 0x77, 0x01, 0xf7, 0x52, 0x03, 0x98, 0xca, 0x5e, 0x44, 0x44, 0xc8, 0xde, 0x89,
+    0x2a, 0x31, 0x2b, 0xb6, 0xfc, 0x26, 0xf1, 0xf6, 0x9f, 0x9e, 0x89, 0xbe, 0x83, 0x0f, 0xc7, 0x1a,
+    0x7b, 0x56, 0x2a, 0xa1, 0x2a, 0xa8, 0x85, 0x83, 0x55, 0x7d, 0x2c, 0xb4, 0x81, 0x68, 0xe4, 0x74,
+    0xc7, 0xa3, 0x02, 0x06, 0x77, 0xd6, 0xd9, 0x9e, 0x04, 0xed, 0xb6, 0x2d, 0x05, 0xe8, 0x93, 0x7c,
+    0x15, 0x36, 0x4f, 0x1e, 0x12, 0x91, 0x3d, 0x54, 0xce, 0x74, 0x2b, 0x2c, 0xea, 0x1c, 0xee, 0xbd,
+    0xf8, 0x0d, 0xfc, 0xb3, 0x3a, 0x9c, 0xca, 0x98, 0x4d, 0x5b, 0x8e, 0x0b, 0x66, 0x57, 0x24, 0x51,
+    0xeb, 0x2f, 0x1f, 0xc8, 0xb2, 0x10, 0xc7, 0x13, 0x90, 0x70, 0x39, 0x61, 0xe9, 0xa6, 0x3f, 0xbe,
+    0x46, 0x13, 0xc0, 0x58, 0x10, 0xc4, 0xf4, 0xa2, 0xf5, 0xbe, 0xe2, 0x57, 0x43, 0xc4, 0xb9, 0x95,
+    0x82, 0x45, 0xff, 0x61, 0xf5, 0x6c, 0xf9, 0x18, 0x7e, 0x66, 0xd2, 0x90, 0x17, 0x77, 0x94, 0xcc,
+    0xcd, 0x64, 0x5d, 0xa3, 0x14, 0x89, 0xf1, 0xfa, 0x41, 0xd9, 0xfa, 0xd4, 0xba, 0xf0, 0xd2, 0x0b,
+    0x55, 0xdb, 0x37, 0xfe, 0xb4, 0xb6, 0xf3, 0xd6, 0x38, 0xfa, 0x63, 0x05, 0x4a, 0x2b, 0x7c, 0xd5,
+    0x2c, 0x02, 0x9f, 0x33, 0x86, 0x41, 0x30, 0xf4, 0x90, 0x70, 0x5e, 0xc6, 0xf1, 0xaa, 0x86, 0xd6,
+    0x9c, 0xcc, 0x14, 0x40, 0x35, 0x01, 0x27, 0x29, 0x31, 0x91, 0x51, 0x38, 0xa6, 0x0b, 0x87, 0x19,
+    0x91, 0xa4, 0xe2, 0x60, 0x88, 0x8b, 0xc2, 0x8a, 0x81, 0xe9, 0x29, 0x5d, 0x2c, 0x1a, 0x99, 0x54,
+    0x91, 0x7f, 0x03, 0xfb, 0x46, 0x5e, 0x0d, 0xca, 0xf1, 0xba, 0x6e, 0xbe, 0x82, 0xf8, 0xf1, 0xc0,
+    0xe8, 0x2f, 0xf4, 0xf7, 0x91, 0x10, 0xf3, 0x4b, 0xb0, 0xde, 0xfd, 0x13, 0xaf, 0xd2, 0x6b, 0xa7,
+    0xba, 0x82, 0x45, 0x91, 0x15, 0x5c, 0x05, 0x16, 0xda, 0x8d, 0xbd, 0x28, 0xae, 0xf1, 0x1d, 0x20,
+    0x16, 0x1c, 0xa4, 0xc1, 0x72, 0x15, 0x66, 0x16, 0x0d, 0x27, 0xcb, 0xc0, 0xe5, 0x53, 0x78, 0xd0,
+    0x11, 0x7b, 0x6b, 0x10, 0x73, 0x4b, 0xdb, 0x46, 0x31, 0xd7, 0x9e, 0xa5, 0x85, 0xda, 0x0e, 0x71,
+    0xc7, 0x98, 0xb6, 0x87, 0xa1, 0x2b, 0xf0, 0x9c, 0x20, 0x81, 0xa9, 0x66, 0x04, 0x2e, 0x0d, 0xb1,
+    0x41, 0x5e, 0xc1, 0xaa, 0xe0, 0xa2, 0x57, 0xea, 0xaf, 0x44, 0x8f, 0x63, 0x5a, 0xad, 0xdc, 0xcd,
+    0x7d, 0x23, 0xba, 0xcd, 0xb9, 0xd3, 0xea, 0x5b, 0x91, 0x73, 0x2c, 0x88, 0x69, 0x1f, 0x14, 0x5d,
+    0x7d, 0x7c, 0x45, 0x67, 0x35, 0x16, 0xb7, 0x2c, 0x40, 0x3f, 0x6a, 0xe4, 0xc0, 0x66, 0x36, 0x92,
+    0xd0, 0xc2, 0x7d, 0x16, 0x5a, 0x93, 0x20, 0xa9, 0x75, 0x19, 0xaf, 0x46, 0x64, 0x20, 0x40, 0x78,
+    0x31, 0x01, 0xff, 0xa5, 0x12, 0x24, 0xc2, 0x01, 0xc8, 0x89, 0xe1, 0xfa, 0x87, 0x14, 0x24, 0x85,
+    0x4c, 0x7a, 0xdc, 0xb9, 0x93, 0x01, 0xf9, 0x07, 0x7b, 0xab, 0x4d, 0x9a, 0x01, 0x35, 0x77, 0x5c,
+    0x1e, 0x16, 0x2a, 0x1b, 0xac, 0xb3, 0x53, 0xa6, 0x21, 0x39, 0x40, 0xf5, 0x9a, 0xc7, 0xe0, 0x29,
+    0x0d, 0x0f, 0xc4, 0xe5, 0x84, 0xf7, 0xb1, 0xfb, 0x3e, 0x52, 0x31, 0xc0, 0x20, 0x1d, 0x2a, 0x4e,
+    0xe0, 0x37, 0x20, 0x74, 0xdb, 0xd0, 0xf5, 0x97, 0x1a, 0xf7, 0x5d, 0xa4, 0xf6, 0xe0, 0x6f, 0x8f,
+    0xe2, 0xc1, 0xf0, 0xf3, 0xa3, 0x60, 0x57, 0xc1, 0x59, 0x31, 0x1a, 0x92, 0x0a, 0xfd, 0xdf, 0x88,
+    0x03, 0x07, 0x1b, 0x48, 0xfb, 0xaf, 0x6e, 0x48, 0x6c, 0xb0, 0x16, 0x4e, 0x40, 0x94, 0x25, 0x38,
+    0xd3, 0xf8, 0x05, 0xca, 0x42, 0x72, 0x4d, 0x3a, 0x9b, 0x2f, 0x0a, 0xd2, 0x44, 0xe6, 0x64, 0x5c,
+    0xc7, 0x01, 0x9f, 0x99, 0x07, 0x85, 0x70, 0x18, 0x93, 0x32, 0xf3, 0x8c, 0xf6, 0xe5, 0x62, 0x95,
+    0x0d, 0xa7, 0xf8, 0x47, 0xe4, 0x60, 0x11, 0xc6, 0xc9, 0x69, 0x9d, 0xfd, 0x99, 0xd0, 0xe8, 0x3c,
+    0xee, 0x59, 0x3e, 0x98, 0xb9, 0x22, 0x91, 0xd8, 0xc1, 0x91, 0x79, 0x48, 0xbd, 0x8a, 0x24, 0xac,
+    0xc5, 0x82, 0x31, 0xc3, 0x34, 0x34, 0x96, 0x97, 0xa6, 0x50, 0x4c, 0x8f, 0xf1, 0xd2, 0xa7, 0xf0,
+    0x16, 0xf5, 0x32, 0xa0, 0x7b, 0x02, 0x22, 0xf1, 0xd6, 0x7a, 0x72, 0x80, 0x1d, 0x27, 0x25, 0x41,
+    0x4a, 0x76, 0xf1, 0xd9, 0x45, 0xca, 0x41, 0x30, 0x95, 0x58, 0x88, 0x1d, 0x4c, 0x64, 0x42, 0x77,
+    0xfb, 0x9b, 0x7f, 0x2b, 0x70, 0x0f, 0x99, 0x03, 0x11, 0x90, 0x2c, 0x85, 0x82, 0xc4, 0x3b, 0x7c,
+    0xd6, 0xf0, 0xd7, 0xdd, 0xe9, 0xf9, 0x2e, 0x93, 0xa9, 0x96, 0x5d, 0x9d, 0x30, 0x67, 0x27, 0x53,
+    0x5f, 0xff, 0x2a, 0xbd, 0x1a, 0xe9, 0x5a, 0x1b, 0x09, 0x66, 0xb1, 0xa6, 0x2b, 0x0a, 0x26, 0x97,
+    0x57, 0x24, 0x3d, 0x2d, 0x2b, 0xeb, 0xd3, 0xad, 0xba, 0xa6, 0x21, 0x08, 0x81, 0xa5, 0xb3, 0xa3,
+    0x2a, 0x36, 0x65, 0xed, 0x38, 0x2c, 0xbe, 0xca, 0xde, 0x65, 0xeb, 0x30, 0x7d, 0x14, 0xb3, 0x7c,
+    0x98, 0x03, 0x1e, 0xe7, 0xc4, 0xa1, 0x4f, 0xad, 0x9c, 0x75, 0xcb, 0xb6, 0x53, 0xf1, 0x36, 0x50,
+    0xa1, 0x20, 0x70, 0xf3, 0x94, 0x4c, 0xe3, 0x6f, 0x26, 0xdf, 0x0f, 0x2c, 0xa9, 0xce, 0x2a, 0x10,
+    0xbf, 0x2c, 0x12, 0xe3, 0x44, 0x3c, 0x21, 0x21, 0x9d, 0x72, 0x11, 0x30, 0x2b, 0xdf, 0xd8, 0xf8,
+    0x02, 0x47, 0x72, 0x5e, 0x77, 0x13, 0xcd, 0xe6, 0x87, 0x6c, 0x58, 0xf1, 0x1c, 0x01, 0x2a, 0xa8,
+    0xc3, 0x63, 0xeb, 0x47, 0x75, 0x65, 0x32, 0x7c, 0xf0, 0x06, 0xc9, 0x69, 0xc1, 0x68, 0xf1, 0x3f,
+    0xfe, 0x1c, 0xbd, 0x08, 0x5e, 0x8b, 0x43, 0xe5, 0x8f, 0x5b, 0x24, 0xb1, 0x76, 0x4c, 0xe2, 0xad,
+    0x45, 0x34, 0xeb, 0xdd, 0x98, 0xfd, 0xbd, 0x15, 0x4f, 0xa3, 0x2f, 0x64, 0x10, 0x31, 0x9a, 0x4a,
+    0xce, 0xdb, 0xe2, 0x78, 0xb9, 0xf6, 0x4f, 0x1b, 0x38, 0xb7, 0xc5, 0xae, 0xdf, 0x7f, 0x8b, 0x82,
+    0x85, 0x10, 0xb6, 0x74, 0x31, 0xdc, 0x57, 0x68, 0x26, 0x68, 0x11, 0x58, 0x8c, 0x5d, 0x4d, 0x16,
+    0x01, 0x7a, 0x47, 0x42, 0x6c, 0xf6, 0x90, 0xe1, 0x6c, 0x18, 0xa8, 0x7c, 0x80, 0xee, 0x6a, 0x7b,
+    0x04, 0x70, 0x1b, 0x2a, 0x8b, 0x4a, 0x16, 0x73, 0xc2, 0x64, 0x24, 0x85, 0x62, 0x0d, 0x90, 0xc6,
+    0x19, 0xaa, 0xad, 0xd7, 0x92, 0xa6, 0xde, 0x32, 0xb9, 0x97, 0x9c, 0xe7, 0x98, 0x7d, 0xf2, 0x35,
+    0xc4, 0x68, 0xe0, 0x4a, 0xbc, 0x44, 0xe1, 0xd2, 0x1d, 0xe8, 0x01, 0x50, 0x04, 0xf0, 0xe6, 0xec,
+    0x01, 0xff, 0x46, 0xde, 0x86, 0x5b, 0x82, 0xfd, 0x8e, 0x5d, 0xce, 0x49, 0x89, 0x7c, 0xbd, 0x37,
+    0x92, 0x01, 0x86, 0x6a, 0xc9, 0x77, 0x86, 0x0d, 0xdf, 0x01, 0x3f, 0x54, 0xae, 0x06, 0x37, 0x45,
+    0xeb, 0xef, 0x4c, 0x66, 0xfa, 0x66, 0x3a, 0xf9, 0x7a, 0xca, 0x66, 0x8f, 0x63, 0x50, 0xba, 0x7a,
+    0x3e, 0x10, 0x30, 0x43, 0xcf, 0x9d, 0x51, 0x86, 0xd4, 0xeb, 0x7e, 0x20, 0xd3, 0x68, 0x20, 0x21,
+    0xea, 0x44, 0x51, 0xbe, 0xca, 0x49, 0x96, 0xe9, 0x09, 0x17, 0xbe, 0x95, 0x57, 0x4f, 0x28, 0xf0,
+    0xad, 0xd9, 0x28, 0x9b, 0x1e, 0x36, 0xfc, 0xb9, 0xeb, 0x60, 0x61, 0x6a, 0x03, 0x06, 0x2c, 0xdf,
+    0xf1, 0x29, 0x4f, 0x89, 0x70, 0xde, 0x20, 0x42, 0xd3, 0xbf, 0x9f, 0x54, 0x6f, 0x25, 0x4b, 0x69,
+    0x83, 0x67, 0x34, 0x81, 0x6f, 0x18, 0x6b, 0x78, 0xb2, 0xab, 0x49, 0xf8, 0xba, 0x66, 0x6c, 0x82,
+    0xe9, 0xb7, 0xc9, 0xdc, 0x6d, 0x6c, 0x81, 0x85, 0x2a, 0x29, 0x4e, 0x65, 0x24, 0xf4, 0x49, 0xef,
+    0x0e, 0xa8, 0xf9, 0xc1, 0x3e, 0x74, 0xff, 0x16, 0xbf, 0xfd, 0x6c, 0x3d, 0xc0, 0x83, 0x25, 0xd9,
+    0x3d, 0x10, 0x42, 0x9c, 0x30, 0x78, 0x05, 0x27, 0xcd, 0xa1, 0x41, 0xe0, 0xaa, 0xa4, 0x08, 0x41,
+    0x76, 0xa5, 0xa0, 0x09, 0x39, 0xcf, 0x44, 0xb2, 0xa6, 0x2b, 0x06, 0xcc, 0x65, 0x6a, 0x07, 0x83,
+    0x2a, 0x5a, 0xb5, 0x34, 0xc8, 0xdd, 0xed, 0x5c, 0x78, 0x96, 0xf4, 0xf0, 0x91, 0x01, 0xfe, 0x7c,
+    0x53, 0xc1, 0x2a, 0x74, 0x56, 0x53, 0x01, 0xb9, 0x48, 0x53, 0x14, 0x7d, 0x18, 0xe8, 0xb3, 0x43,
+    0x49, 0x87, 0x66, 0x2d, 0x93, 0x46, 0xce, 0x36, 0x35, 0x1b, 0xb5, 0x69, 0x57, 0x49, 0x27, 0x2a,
+    0xe8, 0x36, 0xd1, 0xc6, 0x71, 0x40, 0x4b, 0x35, 0x5d, 0x90, 0x24, 0x3c, 0x7e, 0x37, 0xeb, 0xe6,
+    0xff, 0x81, 0xab, 0x6d, 0x94, 0x8b, 0x28, 0x62, 0x37, 0x9b, 0x32, 0x2e, 0x5f, 0xce, 0xcc, 0x1f,
+    0xb3, 0xcf, 0x78, 0xf8, 0x83, 0x4f, 0x5a, 0x9f, 0xdf, 0x09, 0xdb, 0x69, 0x61, 0x9d, 0xb3, 0x2a,
+    0x05, 0x6b, 0x3f, 0xc8, 0xb4, 0xda, 0x5f, 0x0f, 0xb6, 0x41, 0xa3, 0xd0, 0xb0, 0xac, 0x9f, 0x8c,
+    0x8b, 0x62, 0x56, 0x4c, 0x4f, 0xed, 0xf4, 0xb6, 0x79, 0x55, 0x3e, 0xd0, 0xa1, 0xc6, 0x6b, 0xc9,
+    0xd2, 0x8c, 0x1c, 0x94, 0x22, 0xc6, 0xb5, 0x52, 0xd5, 0xb6, 0x5d, 0x81, 0xdf, 0x85, 0x1e, 0x41,
+    0x68, 0x28, 0x36, 0xfe, 0x7d, 0x39, 0x95, 0xb1, 0x49, 0x9f, 0x9f, 0xf8, 0x3d, 0x90, 0x88, 0xb4,
+    0x2a, 0xb3, 0x96, 0xca, 0xf9, 0xb7, 0x6f, 0x9f, 0x92, 0x7b, 0x74, 0x6f, 0x82, 0x18, 0x0e, 0x15,
+    0xff, 0xe5, 0x6a, 0x55, 0x80, 0x17, 0x3f, 0xa3, 0x78, 0x3f, 0x78, 0xc3, 0x1e, 0xb3, 0x44, 0x22,
+    0x68, 0x25, 0x2f, 0xcf, 0x66, 0xa0, 0x30, 0xb2, 0xcc, 0x8d, 0x91, 0xee, 0xdc, 0xab, 0x0f, 0x46,
+    0x9a, 0x62, 0x17, 0xf6, 0xc8, 0x6b, 0x49, 0x0a, 0x1e, 0x4b, 0x4e, 0x38, 0xf4, 0xd8, 0xb8, 0x3b,
+    0xbc, 0xd1, 0xe3, 0x15, 0xc0, 0x27, 0x20, 0x76, 0xf3, 0x2a, 0x3f, 0x52, 0xe0, 0xd5, 0x41, 0x08,
+    0xdb, 0x90, 0xf8, 0x39, 0x01, 0x8e, 0xa3, 0x3d, 0x53, 0x0f, 0x10, 0x9b, 0x8a, 0xa5, 0xb9, 0xf1,
+    0x20, 0xa7, 0x20, 0xf4, 0xa7, 0xdf, 0xac, 0x08, 0x17, 0xa9, 0x7d, 0x9a, 0x77, 0xb1, 0xf1, 0x3d,
+    0x34, 0x6c, 0x9f, 0xf0, 0xa4, 0x98, 0xf1, 0xe5, 0x61, 0x11, 0xea, 0x71, 0xb7, 0x1b, 0xda, 0xea,
+    0xd6, 0x79, 0x2d, 0x90, 0xf8, 0x6e, 0xd4, 0xb8, 0xb8, 0x62, 0x24, 0xe3, 0x6f, 0xc4, 0xe4, 0xef,
+    0xb6, 0xa0, 0x4a, 0x40, 0x30, 0xc9, 0x9f, 0xe0, 0xa0, 0x5e, 0x35, 0xa0, 0xea, 0x84, 0xc2, 0x01,
+    0x1c, 0x38, 0xd0, 0xa6, 0x51, 0x5a, 0xad, 0x26, 0x1d, 0x26, 0xbe, 0x10, 0xbc, 0xe7, 0xed, 0x75,
+    0x85, 0x55, 0x5b, 0x3f, 0x68, 0x78, 0x13, 0x9b, 0xad, 0xab, 0xa4, 0x4d, 0x00,
+};
+
+static const TestFrame device_frames[] = {
+    { "done", 0x82, 7, done_payload, 0, done_wire, sizeof(done_wire) },
+    { "hello", 0x81, 1, hello_payload, 8, hello_wire, sizeof(hello_wire) },
+    { "output", 0x90, 2, output_payload, 26, output_wire, sizeof(output_wire) },
+    { "log_zeros", 0x91, 0, log_zeros_payload, 96, log_zeros_wire, sizeof(log_zeros_wire) },
+    { "log_run", 0x91, 0, log_run_payload, 96, log_run_wire, sizeof(log_run_wire) },
+};
+
+static const TestFrame host_frames[] = {
+    { "command", 0x02, 3, command_payload, 3, command_wire, sizeof(command_wire) },
+    { "close", 0x06, 255, close_payload, 0, close_wire, sizeof(close_wire) },
+    { "data", 0x04, 42, data_payload, 4100, data_wire, sizeof(data_wire) },
+};
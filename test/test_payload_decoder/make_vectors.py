@@ -0,0 +1,83 @@
+#!/usr/bin/env python3
+"""Regenerates vectors.h: the test payload compressed as gzip and as LZ4
+frames. Needs the lz4 command line tool.
+
+    python3 test/test_payload_decoder/make_vectors.py
+"""
+
+import gzip
+import io
+import os
+import subprocess
+
+LINES = 700
+# Long enough that a sink makes the decoder drop output it is done with
+# (more than twice the 64 KB LZ4 window); blocks repeat so matches reach
+# far back
+BIG_BLOCK = 12000
+BIG_REPEATS = 11
+
+
+def payload():
+    # Same text the test rebuilds with snprintf
+    return b"".join(b"module payload line %u\n" % i for i in range(LINES))
+
+
+def big_payload():
+    # xorshift32, same as the test's rebuild
+    x = 2463534242
+    block = bytearray()
+    for _ in range(BIG_BLOCK):
+        x ^= (x << 13) & 0xFFFFFFFF
+        x ^= x >> 17
+        x ^= (x << 5) & 0xFFFFFFFF
+        block.append(x & 0xFF)
+    out = bytearray()
+    for repeat in range(BIG_REPEATS):
+        block[0] = repeat
+        out += block
+    return bytes(out)
+
+
+def gzip_member(data):
+    # With a file name, so the FNAME header field is parsed too
+    buffer = io.BytesIO()
+    with gzip.GzipFile(filename="module.wasm", mode="wb", fileobj=buffer, mtime=0) as f:
+        f.write(data)
+    return buffer.getvalue()
+
+
+def lz4_frame(data, *flags):
+    return subprocess.run(["lz4", "-c", "-9", *flags], input=data,
+                          stdout=subprocess.PIPE, check=True).stdout
+
+
+def c_array(name, data):
+    lines = ["static const uint8_t %s[%d] = {" % (name, len(data))]
+    for i in range(0, len(data), 16):
+        lines.append("    " + ", ".join("0x%02x" % b for b in data[i:i + 16]) + ",")
+    lines.append("};")
+    return "\n".join(lines)
+
+
+def main():
+    data = payload()
+    arrays = [
+        c_array("gzip_payload", gzip_member(data)),
+        c_array("lz4_payload", lz4_frame(data)),
+        # Block checksums and the content size field on
+        c_array("lz4_checked_payload", lz4_frame(data, "-BX", "--content-size")),
+        c_array("big_gzip_payload", gzip_member(big_payload())),
+        # 64 KB linked blocks, so matches cross block boundaries
+        c_array("big_lz4_payload", lz4_frame(big_payload(), "-B4", "-BD")),
+    ]
+    path = os.path.join(os.path.dirname(os.path.abspath(__file__)), "vectors.h")
+    with open(path, "w") as f:
+        f.write("// Generated by make_vectors.py, do not edit\n#pragma once\n#include <stdint.h>\n\n")
+        f.write("#define PAYLOAD_LINES %d\n#define PAYLOAD_SIZE %d\n" % (LINES, len(data)))
+        f.write("#define BIG_BLOCK %d\n#define BIG_REPEATS %d\n\n" % (BIG_BLOCK, BIG_REPEATS))
+        f.write("\n\n".join(arrays) + "\n")
+
+
+if __name__ == "__main__":
+    main()
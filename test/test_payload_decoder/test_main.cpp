@@ -0,0 +1,218 @@
+// On-target tests for PayloadDecoder: every payload is fed in chunks of
+// many sizes, so header fields, LZ4 blocks and the gzip trailer get split
+// at every kind of boundary, with and without a sink.
+// Run with: pio test -e esp32s3dev -f test_payload_decoder
+#include <Arduino.h>
+#include <unity.h>
+#include <mbedtls/sha256.h>
+#include "payload_decoder.h"
+#include "vectors.h"
+
+static const size_t chunk_sizes[] = { 1, 2, 3, 5, 7, 8, 9, 13, 64, 511, 4096, SIZE_MAX };
+
+static uint8_t* expected = nullptr;
+static uint8_t* big_expected = nullptr;
+
+// Collects what a decoder hands its sink
+class CollectSink : public Print {
+public:
+    ByteBuffer data = {};
+    ~CollectSink() { byte_buffer_free(&data); }
+    size_t write(uint8_t c) override { return write(&c, 1); }
+    size_t write(const uint8_t* buf, size_t len) override {
+        if (!byte_buffer_reserve(&data, len)) return 0;
+        memcpy(data.data + data.size, buf, len);
+        data.size += len;
+        return len;
+    }
+};
+
+static void build_expected() {
+    expected = (uint8_t*)malloc(PAYLOAD_SIZE + 1);
+    size_t size = 0;
+    for (int i = 0; i < PAYLOAD_LINES; i++) {
+        size += snprintf((char*)expected + size, PAYLOAD_SIZE + 1 - size, "module payload line %u\n", i);
+    }
+    TEST_ASSERT_EQUAL(PAYLOAD_SIZE, size);
+
+    // xorshift32 blocks, as make_vectors.py writes them
+    big_expected = (uint8_t*)malloc(BIG_BLOCK * BIG_REPEATS);
+    uint32_t x = 2463534242u;
+    for (int i = 0; i < BIG_BLOCK; i++) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        big_expected[i] = (uint8_t)x;
+    }
+    for (int repeat = 0; repeat < BIG_REPEATS; repeat++) {
+        memcpy(big_expected + repeat * BIG_BLOCK, big_expected, BIG_BLOCK);
+        big_expected[repeat * BIG_BLOCK] = repeat;
+    }
+}
+
+// Feeds `len` bytes `chunk` at a time, through reserve()/commit() like a
+// download or through write() like an upload
+static bool decode(const uint8_t* data, size_t len, size_t chunk, bool zero_copy,
+                   ByteBuffer* out, uint8_t digest[SHA256_SIZE], Print* sink = nullptr) {
+    PayloadDecoder decoder(out, sink);
+    bool ok = true;
+    for (size_t pos = 0; ok && pos < len;) {
+        size_t want = min(chunk, len - pos);
+        if (zero_copy) {
+            uint8_t* dst = decoder.reserve(&want);
+            ok = dst != nullptr;
+            if (ok) {
+                memcpy(dst, data + pos, want);
+                ok = decoder.commit(want);
+            }
+        } else {
+            ok = decoder.write(data + pos, want);
+        }
+        pos += want;
+    }
+    ok = ok && decoder.finish();
+    decoder.digest(digest);
+    return ok;
+}
+
+static void check_payload(const uint8_t* data, size_t len, PayloadFormat format) {
+    uint8_t want_digest[SHA256_SIZE];
+    mbedtls_sha256_ret(expected, PAYLOAD_SIZE, want_digest, 0);
+
+    for (size_t chunk : chunk_sizes) {
+        for (int zero_copy = 0; zero_copy < 2; zero_copy++) {
+            char label[48];
+            snprintf(label, sizeof(label), "chunk %u, %s", (unsigned)min<size_t>(chunk, len),
+                     zero_copy ? "reserve/commit" : "write");
+
+            ByteBuffer out = {};
+            uint8_t digest[SHA256_SIZE];
+            TEST_ASSERT_TRUE_MESSAGE(decode(data, len, chunk, zero_copy, &out, digest), label);
+            TEST_ASSERT_EQUAL_MESSAGE(PAYLOAD_SIZE, out.size, label);
+            TEST_ASSERT_EQUAL_MEMORY_MESSAGE(expected, out.data, PAYLOAD_SIZE, label);
+            TEST_ASSERT_EQUAL_MEMORY_MESSAGE(want_digest, digest, SHA256_SIZE, label);
+            byte_buffer_free(&out);
+        }
+    }
+
+    ByteBuffer out = {};
+    PayloadDecoder decoder(&out);
+    decoder.write(data, len);
+    TEST_ASSERT_EQUAL(format, decoder.format());
+    byte_buffer_free(&out);
+}
+
+// A payload cut short anywhere, trailer included, must not pass
+static void check_truncated(const uint8_t* data, size_t len) {
+    for (size_t cut = 1; cut <= 12; cut++) {
+        for (size_t chunk : { (size_t)1, (size_t)7, SIZE_MAX }) {
+            ByteBuffer out = {};
+            uint8_t digest[SHA256_SIZE];
+            TEST_ASSERT_FALSE(decode(data, len - cut, chunk, true, &out, digest));
+            byte_buffer_free(&out);
+        }
+    }
+}
+
+static void test_gzip_chunked() {
+    check_payload(gzip_payload, sizeof(gzip_payload), PAYLOAD_GZIP);
+}
+
+static void test_gzip_truncated() {
+    check_truncated(gzip_payload, sizeof(gzip_payload));
+}
+
+static void test_gzip_bad_crc() {
+    uint8_t* copy = (uint8_t*)malloc(sizeof(gzip_payload));
+    memcpy(copy, gzip_payload, sizeof(gzip_payload));
+    copy[sizeof(gzip_payload) - 8] ^= 0x01;   // First CRC32 byte
+
+    for (size_t chunk : chunk_sizes) {
+        ByteBuffer out = {};
+        uint8_t digest[SHA256_SIZE];
+        TEST_ASSERT_FALSE(decode(copy, sizeof(gzip_payload), chunk, true, &out, digest));
+        byte_buffer_free(&out);
+    }
+    free(copy);
+}
+
+static void test_lz4_chunked() {
+    check_payload(lz4_payload, sizeof(lz4_payload), PAYLOAD_LZ4);
+}
+
+static void test_lz4_checksums_chunked() {
+    check_payload(lz4_checked_payload, sizeof(lz4_checked_payload), PAYLOAD_LZ4);
+}
+
+static void test_lz4_truncated() {
+    check_truncated(lz4_payload, sizeof(lz4_payload));
+}
+
+// Output goes to the sink as it is decoded; `out` keeps only the window
+static void check_sink(const uint8_t* data, size_t len, const uint8_t* want, size_t want_len,
+                       size_t max_window) {
+    uint8_t want_digest[SHA256_SIZE];
+    mbedtls_sha256_ret(want, want_len, want_digest, 0);
+
+    for (size_t chunk : chunk_sizes) {
+        char label[24];
+        snprintf(label, sizeof(label), "chunk %u", (unsigned)min<size_t>(chunk, len));
+
+        ByteBuffer out = {};
+        CollectSink sink;
+        uint8_t digest[SHA256_SIZE];
+        TEST_ASSERT_TRUE_MESSAGE(decode(data, len, chunk, true, &out, digest, &sink), label);
+        TEST_ASSERT_EQUAL_MESSAGE(want_len, sink.data.size, label);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(want, sink.data.data, want_len, label);
+        TEST_ASSERT_EQUAL_MEMORY_MESSAGE(want_digest, digest, SHA256_SIZE, label);
+        TEST_ASSERT_TRUE_MESSAGE(out.size <= max_window, label);
+        byte_buffer_free(&out);
+    }
+}
+
+static void test_gzip_sink() {
+    check_sink(big_gzip_payload, sizeof(big_gzip_payload), big_expected, BIG_BLOCK * BIG_REPEATS,
+               2 * 32 * 1024);
+}
+
+static void test_lz4_sink() {
+    check_sink(big_lz4_payload, sizeof(big_lz4_payload), big_expected, BIG_BLOCK * BIG_REPEATS,
+               2 * 64 * 1024);
+}
+
+static void test_raw_sink() {
+    // Nothing refers back into raw input, so nothing is kept
+    check_sink(big_expected, BIG_BLOCK * BIG_REPEATS, big_expected, BIG_BLOCK * BIG_REPEATS, 0);
+}
+
+static void test_raw_passthrough() {
+    for (size_t chunk : chunk_sizes) {
+        ByteBuffer out = {};
+        uint8_t digest[SHA256_SIZE];
+        TEST_ASSERT_TRUE(decode(expected, PAYLOAD_SIZE, chunk, true, &out, digest));
+        TEST_ASSERT_EQUAL(PAYLOAD_SIZE, out.size);
+        TEST_ASSERT_EQUAL_MEMORY(expected, out.data, PAYLOAD_SIZE);
+        byte_buffer_free(&out);
+    }
+}
+
+void setup() {
+    delay(2000);   // Lets the serial monitor attach
+    build_expected();
+
+    UNITY_BEGIN();
+    RUN_TEST(test_gzip_chunked);
+    RUN_TEST(test_gzip_truncated);
+    RUN_TEST(test_gzip_bad_crc);
+    RUN_TEST(test_lz4_chunked);
+    RUN_TEST(test_lz4_checksums_chunked);
+    RUN_TEST(test_lz4_truncated);
+    RUN_TEST(test_raw_passthrough);
+    RUN_TEST(test_gzip_sink);
+    RUN_TEST(test_lz4_sink);
+    RUN_TEST(test_raw_sink);
+    UNITY_END();
+}
+
+void loop() {
+}
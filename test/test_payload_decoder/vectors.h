@@ -0,0 +1,2172 @@
+// Generated by make_vectors.py, do not edit
+#pragma once
+#include <stdint.h>
+
+#define PAYLOAD_LINES 700
+#define PAYLOAD_SIZE 16690
+#define BIG_BLOCK 12000
+#define BIG_REPEATS 11
+
+static const uint8_t gzip_payload[1676] = {
+    0x1f, 0x8b, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65,
+    0x2e, 0x77, 0x61, 0x73, 0x6d, 0x00, 0x75, 0xdb, 0xb9, 0x8d, 0x64, 0x47, 0x10, 0x40, 0x41, 0x9d,
+    0x56, 0xac, 0x09, 0x9d, 0xe7, 0xef, 0x6f, 0x0e, 0x01, 0x52, 0x20, 0xb0, 0x3c, 0x14, 0x0a, 0xf4,
+    0x9e, 0x0e, 0x64, 0xa8, 0xa5, 0x3d, 0xcc, 0x4c, 0x4f, 0x74, 0x55, 0xe6, 0x9f, 0x7f, 0xff, 0xf6,
+    0xef, 0xcf, 0xdf, 0x7f, 0xfc, 0xf3, 0xeb, 0x7f, 0x3f, 0xff, 0xfe, 0xf5, 0xb7, 0x1f, 0x3f, 0xff,
+    0xf8, 0xeb, 0xf7, 0x1f, 0x9f, 0x5f, 0xfe, 0x3c, 0x4e, 0xe3, 0x3c, 0xcd, 0xf3, 0xb4, 0xce, 0xd3,
+    0x3e, 0x4f, 0xe7, 0x3c, 0xdd, 0xf3, 0xf4, 0x39, 0x4f, 0xbf, 0xe7, 0xe9, 0x7b, 0x57, 0x20, 0xee,
+    0xae, 0x8b, 0x3b, 0x2f, 0xee, 0xbe, 0xb8, 0x03, 0xe3, 0x2e, 0x8c, 0x3b, 0x31, 0xee, 0xc6, 0xb8,
+    0x23, 0xe3, 0xae, 0xcc, 0xbb, 0x32, 0xf1, 0x33, 0xbc, 0x2b, 0xf3, 0xae, 0xcc, 0xbb, 0x32, 0xef,
+    0xca, 0xbc, 0x2b, 0xf3, 0xae, 0xcc, 0xbb, 0x32, 0xef, 0xca, 0xba, 0x2b, 0xeb, 0xae, 0x2c, 0xfc,
+    0xaa, 0xde, 0x95, 0x75, 0x57, 0xd6, 0x5d, 0x59, 0x77, 0x65, 0xdd, 0x95, 0x75, 0x57, 0xd6, 0x5d,
+    0xd9, 0x77, 0x65, 0xdf, 0x95, 0x7d, 0x57, 0x36, 0xfe, 0x22, 0xef, 0xca, 0xbe, 0x2b, 0xfb, 0xae,
+    0xec, 0xbb, 0xb2, 0xef, 0xca, 0xbe, 0x2b, 0xe7, 0xae, 0x9c, 0xbb, 0x72, 0xee, 0xca, 0xb9, 0x2b,
+    0x07, 0x1f, 0x3c, 0x77, 0xe5, 0xdc, 0x95, 0x73, 0x57, 0xce, 0x5d, 0x39, 0x77, 0xe5, 0xde, 0x95,
+    0x7b, 0x57, 0xee, 0x5d, 0xb9, 0x77, 0xe5, 0xde, 0x95, 0x8b, 0xcf, 0xd7, 0xbb, 0x72, 0xef, 0xca,
+    0xbd, 0x2b, 0xf7, 0xae, 0x7c, 0xee, 0xca, 0xe7, 0xae, 0x7c, 0xee, 0xca, 0xe7, 0xae, 0x7c, 0xee,
+    0xca, 0xe7, 0xae, 0x7c, 0xf0, 0x6f, 0xe4, 0xae, 0x7c, 0xee, 0xca, 0xe7, 0xae, 0xfc, 0xde, 0x95,
+    0xdf, 0xbb, 0xf2, 0x7b, 0x57, 0x7e, 0xef, 0xca, 0xef, 0x5d, 0xf9, 0xbd, 0x2b, 0xbf, 0x77, 0xe5,
+    0x17, 0xff, 0x2d, 0xef, 0xca, 0xef, 0x5d, 0xf9, 0xde, 0x95, 0xef, 0x5d, 0xf9, 0xde, 0x95, 0xef,
+    0x5d, 0xf9, 0xde, 0x95, 0xef, 0x5d, 0xf9, 0xde, 0x95, 0xef, 0x5d, 0xf9, 0x02, 0x05, 0x52, 0x01,
+    0x58, 0xf0, 0x81, 0x0b, 0x3e, 0x80, 0xc1, 0x07, 0x32, 0xf8, 0x80, 0x06, 0x1f, 0xd8, 0xe0, 0x03,
+    0x1c, 0x7c, 0xa0, 0x83, 0x0f, 0x78, 0xf0, 0x41, 0x2f, 0x19, 0x84, 0x5e, 0x41, 0x48, 0x12, 0x12,
+    0x85, 0x64, 0x21, 0x61, 0x48, 0x1a, 0x12, 0x87, 0xe0, 0xa1, 0x00, 0x88, 0x22, 0xe5, 0x3e, 0xf4,
+    0xc2, 0x44, 0x01, 0x14, 0x05, 0x54, 0x14, 0x60, 0x51, 0xc0, 0x45, 0x01, 0x18, 0x05, 0x64, 0x14,
+    0xa0, 0x51, 0xc0, 0x46, 0x51, 0x82, 0x2e, 0x7a, 0xc1, 0xa3, 0x80, 0x8f, 0x02, 0x40, 0x0a, 0x08,
+    0x29, 0x40, 0xa4, 0x80, 0x91, 0x02, 0x48, 0x0a, 0x28, 0x29, 0xc0, 0xa4, 0x68, 0xc9, 0x1e, 0xbd,
+    0x90, 0x52, 0x80, 0x4a, 0x01, 0x2b, 0x05, 0xb0, 0x14, 0xd0, 0x52, 0x80, 0x4b, 0x01, 0x2f, 0x05,
+    0xc0, 0x14, 0x10, 0x53, 0x8c, 0xbe, 0xca, 0xa0, 0x17, 0x68, 0x0a, 0xa8, 0x29, 0xc0, 0xa6, 0x80,
+    0x9b, 0x02, 0x70, 0x0a, 0xc8, 0x29, 0x40, 0xa7, 0x80, 0x9d, 0x02, 0x78, 0x8a, 0xd5, 0x77, 0x37,
+    0xf4, 0xc2, 0x4f, 0x01, 0x40, 0x05, 0x04, 0x15, 0x20, 0x54, 0xc0, 0x50, 0x01, 0x44, 0x05, 0x14,
+    0x15, 0x60, 0x54, 0xc0, 0x51, 0xf1, 0xe8, 0xcb, 0x2a, 0x7a, 0x41, 0xa9, 0x80, 0xa5, 0x02, 0x98,
+    0x0a, 0x68, 0x2a, 0xc0, 0xa9, 0x80, 0xa7, 0x02, 0xa0, 0x0a, 0x88, 0x2a, 0x40, 0xaa, 0xf8, 0xea,
+    0xdb, 0x39, 0x7a, 0xa1, 0xaa, 0x00, 0xab, 0x02, 0xae, 0x0a, 0xc0, 0x2a, 0x20, 0xab, 0x00, 0xad,
+    0x02, 0xb6, 0x0a, 0xe0, 0x2a, 0xa0, 0xab, 0x78, 0x75, 0x1d, 0xa1, 0xfb, 0x08, 0x5c, 0x48, 0xc0,
+    0x57, 0x09, 0x5f, 0x25, 0x7c, 0x95, 0xf0, 0x55, 0xc2, 0x57, 0x09, 0x5f, 0x25, 0x7c, 0x95, 0xf0,
+    0x55, 0xc2, 0x57, 0x19, 0xba, 0x80, 0x41, 0x2f, 0x7c, 0x95, 0xf0, 0x55, 0xc2, 0x57, 0x09, 0x5f,
+    0x25, 0x7c, 0x95, 0xf0, 0x55, 0xc2, 0x57, 0xa9, 0xfb, 0x26, 0x5d, 0x38, 0xf1, 0xc6, 0x09, 0xbd,
+    0xba, 0x73, 0xd2, 0xa5, 0x93, 0x6e, 0x9d, 0x74, 0xed, 0xa4, 0x7b, 0x27, 0x5d, 0x3c, 0xc1, 0x57,
+    0x09, 0x5f, 0x25, 0x7c, 0x95, 0xa5, 0x2b, 0x36, 0xf4, 0xc2, 0x57, 0x09, 0x5f, 0x25, 0x7c, 0x95,
+    0xf0, 0x55, 0xc2, 0x57, 0x09, 0x5f, 0x25, 0x7c, 0x95, 0xf0, 0x55, 0xc2, 0x57, 0xd9, 0xba, 0x53,
+    0x44, 0x2f, 0x7c, 0x95, 0xf0, 0x55, 0xc2, 0x57, 0x09, 0x5f, 0x25, 0x7c, 0x95, 0xf0, 0x55, 0xc2,
+    0x57, 0x09, 0x5f, 0x25, 0x7c, 0x95, 0xa3, 0x4b, 0x54, 0xf4, 0xc2, 0x57, 0x09, 0x5f, 0x25, 0x7c,
+    0x95, 0xf0, 0x55, 0xc2, 0x57, 0x09, 0x5f, 0x25, 0x7c, 0x95, 0xf0, 0x55, 0xc2, 0x57, 0xb9, 0xba,
+    0x35, 0x46, 0x2f, 0x7c, 0x95, 0xf0, 0x55, 0xc2, 0x57, 0x09, 0x5f, 0x25, 0x7c, 0x95, 0xf0, 0x55,
+    0xc2, 0x57, 0x09, 0x5f, 0x25, 0x7c, 0x95, 0x8f, 0xae, 0xc9, 0xd1, 0x0b, 0x5f, 0x25, 0x7c, 0x95,
+    0xf0, 0x55, 0xc2, 0x57, 0x09, 0x5f, 0x25, 0x7c, 0x95, 0xf0, 0x55, 0xc2, 0x57, 0x09, 0x5f, 0xe5,
+    0x57, 0xef, 0x02, 0xe8, 0x85, 0xaf, 0x12, 0xbe, 0x4a, 0xf8, 0x2a, 0xe1, 0xab, 0x84, 0xaf, 0x12,
+    0xbe, 0x4a, 0xf8, 0x2a, 0xe1, 0xab, 0x84, 0xaf, 0xf2, 0xd5, 0x43, 0x88, 0x5e, 0x42, 0xf0, 0x14,
+    0x02, 0x5f, 0x15, 0x7c, 0x55, 0xf0, 0x55, 0xc1, 0x57, 0x05, 0x5f, 0x15, 0x7c, 0x55, 0xf0, 0x55,
+    0xc1, 0x57, 0x05, 0x5f, 0x55, 0xe8, 0xe9, 0x07, 0xbd, 0xf0, 0x55, 0xc1, 0x57, 0x05, 0x5f, 0x15,
+    0x7c, 0x55, 0xf0, 0x55, 0xc1, 0x57, 0x05, 0x5f, 0x15, 0x7c, 0x55, 0xf0, 0x55, 0xa5, 0xde, 0xba,
+    0xd0, 0x0b, 0x5f, 0x15, 0x7c, 0x55, 0xf0, 0x55, 0xc1, 0x57, 0x05, 0x5f, 0x15, 0x7c, 0x55, 0x7a,
+    0xd9, 0xd3, 0xd3, 0x9e, 0xde, 0xf6, 0xf8, 0xb8, 0x87, 0x5e, 0x3d, 0xef, 0xe9, 0x7d, 0x4f, 0x0f,
+    0x7c, 0x7a, 0xe1, 0xd3, 0x13, 0x1f, 0x7c, 0x55, 0xf0, 0x55, 0xc1, 0x57, 0x05, 0x5f, 0x55, 0xeb,
+    0x35, 0x13, 0xbd, 0xf0, 0x55, 0xc1, 0x57, 0x05, 0x5f, 0x15, 0x7c, 0x55, 0xf0, 0x55, 0xc1, 0x57,
+    0x05, 0x5f, 0x15, 0x7c, 0x55, 0xf0, 0x55, 0x8d, 0x9e, 0x6f, 0xd1, 0x0b, 0x5f, 0x15, 0x7c, 0x55,
+    0xf0, 0x55, 0xc1, 0x57, 0x05, 0x5f, 0x15, 0x7c, 0x55, 0xf0, 0x55, 0xc1, 0x57, 0x05, 0x5f, 0xd5,
+    0xea, 0xbd, 0x1a, 0xbd, 0xf0, 0x55, 0xc1, 0x57, 0x05, 0x5f, 0x15, 0x7c, 0x55, 0xf0, 0x55, 0xc1,
+    0x57, 0x05, 0x5f, 0x15, 0x7c, 0x55, 0xf0, 0x55, 0x3d, 0x7a, 0xa0, 0x47, 0x2f, 0x7c, 0x55, 0xf0,
+    0x55, 0xc1, 0x57, 0x05, 0x5f, 0x15, 0x7c, 0x55, 0xf0, 0x55, 0xc1, 0x57, 0x05, 0x5f, 0x15, 0x7c,
+    0x55, 0x5f, 0x4d, 0x24, 0xa0, 0x17, 0xbe, 0x2a, 0xf8, 0xaa, 0xe0, 0xab, 0x82, 0xaf, 0x0a, 0xbe,
+    0x2a, 0xf8, 0xaa, 0xe0, 0xab, 0x82, 0xaf, 0x0a, 0xbe, 0xaa, 0x57, 0x23, 0x18, 0x9a, 0xc1, 0xc0,
+    0x10, 0x06, 0x7c, 0xd5, 0xf0, 0x55, 0xc3, 0x57, 0x0d, 0x5f, 0x35, 0x7c, 0xd5, 0xf0, 0x55, 0xc3,
+    0x57, 0x0d, 0x5f, 0x35, 0x7c, 0xd5, 0xa1, 0xa1, 0x13, 0xf4, 0xc2, 0x57, 0x0d, 0x5f, 0x35, 0x7c,
+    0xd5, 0xf0, 0x55, 0xc3, 0x57, 0x0d, 0x5f, 0x35, 0x7c, 0xd5, 0xf0, 0x55, 0xc3, 0x57, 0x9d, 0x9a,
+    0xb2, 0x41, 0x2f, 0x7c, 0xd5, 0xf0, 0x55, 0xc3, 0x57, 0x0d, 0x5f, 0x35, 0x7c, 0xd5, 0xf0, 0x55,
+    0xc3, 0x57, 0x0d, 0x5f, 0x35, 0x7c, 0xd5, 0xa5, 0xb1, 0x22, 0xf4, 0xc2, 0x57, 0x0d, 0x5f, 0x35,
+    0x7c, 0xd5, 0xf0, 0x55, 0xc3, 0x57, 0xad, 0x19, 0x2a, 0x0d, 0x51, 0x69, 0x8a, 0x4a, 0x63, 0x54,
+    0x9c, 0xa3, 0x42, 0xaf, 0x26, 0xa9, 0x34, 0x4a, 0xa5, 0x59, 0x2a, 0x0d, 0x53, 0xc1, 0x57, 0x0d,
+    0x5f, 0x35, 0x7c, 0xd5, 0xf0, 0x55, 0xc3, 0x57, 0x3d, 0x1a, 0x1c, 0x43, 0x2f, 0x7c, 0xd5, 0xf0,
+    0x55, 0xc3, 0x57, 0x0d, 0x5f, 0x35, 0x7c, 0xd5, 0xf0, 0x55, 0xc3, 0x57, 0x0d, 0x5f, 0x35, 0x7c,
+    0xd5, 0xab, 0x49, 0x39, 0xf4, 0xc2, 0x57, 0x0d, 0x5f, 0x35, 0x7c, 0xd5, 0xf0, 0x55, 0xc3, 0x57,
+    0x0d, 0x5f, 0x35, 0x7c, 0xd5, 0xf0, 0x55, 0xc3, 0x57, 0xfd, 0x68, 0x34, 0x10, 0xbd, 0xf0, 0x55,
+    0xc3, 0x57, 0x0d, 0x5f, 0x35, 0x7c, 0xd5, 0xf0, 0x55, 0xc3, 0x57, 0x0d, 0x5f, 0x35, 0x7c, 0xd5,
+    0xf0, 0x55, 0x7f, 0x35, 0x0b, 0x89, 0x5e, 0xf8, 0xaa, 0xe1, 0xab, 0x86, 0xaf, 0x1a, 0xbe, 0x6a,
+    0xf8, 0xaa, 0xe1, 0xab, 0x86, 0xaf, 0x1a, 0xbe, 0x6a, 0xf8, 0xaa, 0x5f, 0x0d, 0x7f, 0x6a, 0xfa,
+    0x13, 0xe3, 0x9f, 0xf0, 0xd5, 0xc0, 0x57, 0x03, 0x5f, 0x0d, 0x7c, 0x35, 0xf0, 0xd5, 0xc0, 0x57,
+    0x03, 0x5f, 0x0d, 0x7c, 0x35, 0xf0, 0xd5, 0x84, 0xc6, 0x5d, 0xd1, 0x0b, 0x5f, 0x0d, 0x7c, 0x35,
+    0xf0, 0xd5, 0xc0, 0x57, 0x03, 0x5f, 0x0d, 0x7c, 0x35, 0xf0, 0xd5, 0xc0, 0x57, 0x03, 0x5f, 0x4d,
+    0x6a, 0xbe, 0x17, 0xbd, 0xf0, 0xd5, 0xc0, 0x57, 0x03, 0x5f, 0x0d, 0x7c, 0x35, 0xf0, 0xd5, 0xc0,
+    0x57, 0x03, 0x5f, 0x0d, 0x7c, 0x35, 0xf0, 0xd5, 0x94, 0x06, 0x9a, 0xd1, 0x0b, 0x5f, 0x0d, 0x7c,
+    0x35, 0xf0, 0xd5, 0xc0, 0x57, 0x03, 0x5f, 0x0d, 0x7c, 0x35, 0xf0, 0xd5, 0xc0, 0x57, 0x03, 0x5f,
+    0x4d, 0x6b, 0x82, 0x1b, 0xbd, 0xf0, 0xd5, 0xc0, 0x57, 0x03, 0x5f, 0x0d, 0x7c, 0x35, 0x9a, 0x56,
+    0xd7, 0xb8, 0xba, 0xe6, 0xd5, 0x35, 0xb0, 0xae, 0x89, 0x75, 0x8e, 0xac, 0xa3, 0x57, 0x43, 0xeb,
+    0x9a, 0x5a, 0xd7, 0xd8, 0x3a, 0x7c, 0x35, 0xf0, 0xd5, 0xc0, 0x57, 0x03, 0x5f, 0x0d, 0x7c, 0x35,
+    0xf0, 0xd5, 0xac, 0x66, 0xf4, 0xd1, 0x0b, 0x5f, 0x0d, 0x7c, 0x35, 0xf0, 0xd5, 0xc0, 0x57, 0x03,
+    0x5f, 0x0d, 0x7c, 0x35, 0xf0, 0xd5, 0xc0, 0x57, 0x03, 0x5f, 0xcd, 0xa3, 0xa5, 0x04, 0xf4, 0xc2,
+    0x57, 0x03, 0x5f, 0x0d, 0x7c, 0x35, 0xf0, 0xd5, 0xc0, 0x57, 0x03, 0x5f, 0x0d, 0x7c, 0x35, 0xf0,
+    0xd5, 0xc0, 0x57, 0xf3, 0xd5, 0x16, 0x06, 0x7a, 0xe1, 0xab, 0x81, 0xaf, 0x06, 0xbe, 0x1a, 0xf8,
+    0x6a, 0xe0, 0xab, 0x81, 0xaf, 0x06, 0xbe, 0x1a, 0xf8, 0x6a, 0xe0, 0xab, 0x79, 0xb5, 0x76, 0xa2,
+    0xbd, 0x13, 0x2c, 0x9e, 0xc0, 0x57, 0x0b, 0x5f, 0x2d, 0x7c, 0xb5, 0xf0, 0xd5, 0xc2, 0x57, 0x0b,
+    0x5f, 0x2d, 0x7c, 0xb5, 0xf0, 0xd5, 0xc2, 0x57, 0x1b, 0x5a, 0xb4, 0x41, 0x2f, 0x7c, 0xb5, 0xf0,
+    0xd5, 0xc2, 0x57, 0x0b, 0x5f, 0x2d, 0x7c, 0xb5, 0xf0, 0xd5, 0xc2, 0x57, 0x0b, 0x5f, 0x2d, 0x7c,
+    0xb5, 0xa9, 0xcd, 0x22, 0xf4, 0xc2, 0x57, 0x0b, 0x5f, 0x2d, 0x7c, 0xb5, 0xf0, 0xd5, 0xc2, 0x57,
+    0x0b, 0x5f, 0x2d, 0x7c, 0xb5, 0xf0, 0xd5, 0xc2, 0x57, 0x5b, 0x5a, 0xa5, 0x42, 0x2f, 0x7c, 0xb5,
+    0xf0, 0xd5, 0xc2, 0x57, 0x0b, 0x5f, 0x2d, 0x7c, 0xb5, 0xf0, 0xd5, 0xc2, 0x57, 0x0b, 0x5f, 0x2d,
+    0x7c, 0xb5, 0xad, 0xdd, 0x31, 0xf4, 0xc2, 0x57, 0x0b, 0x5f, 0x2d, 0x7c, 0xb5, 0xf0, 0xd5, 0xc2,
+    0x57, 0x0b, 0x5f, 0x2d, 0x7c, 0xb5, 0xf0, 0xd5, 0xc2, 0x57, 0x3b, 0x5a, 0x96, 0x43, 0x2f, 0x7c,
+    0xb5, 0xf0, 0xd5, 0xc2, 0x57, 0xab, 0xbd, 0x40, 0x2d, 0x06, 0x6a, 0x33, 0x50, 0xab, 0x81, 0xda,
+    0x0d, 0xd4, 0x72, 0x20, 0xb7, 0x03, 0xd1, 0xab, 0xfd, 0x40, 0x2d, 0x08, 0xc2, 0x57, 0x0b, 0x5f,
+    0x2d, 0x7c, 0xb5, 0xf0, 0xd5, 0xc2, 0x57, 0x0b, 0x5f, 0x2d, 0x7c, 0xb5, 0x8f, 0xd6, 0x21, 0xd1,
+    0x0b, 0x5f, 0x2d, 0x7c, 0xb5, 0xf0, 0xd5, 0xc2, 0x57, 0x0b, 0x5f, 0x2d, 0x7c, 0xb5, 0xf0, 0xd5,
+    0xc2, 0x57, 0x0b, 0x5f, 0xed, 0x57, 0xfb, 0x9f, 0xe8, 0x85, 0xaf, 0x16, 0xbe, 0x5a, 0xf8, 0x6a,
+    0xe1, 0xab, 0x85, 0xaf, 0x16, 0xbe, 0x5a, 0xf8, 0x6a, 0xe1, 0xab, 0x85, 0xaf, 0xf6, 0xd5, 0xc2,
+    0xeb, 0xfb, 0xcb, 0xff, 0xbb, 0xf2, 0xf7, 0x51, 0x32, 0x41, 0x00, 0x00,
+};
+
+static const uint8_t lz4_payload[3419] = {
+    0x04, 0x22, 0x4d, 0x18, 0x64, 0x40, 0xa7, 0x48, 0x0d, 0x00, 0x00, 0xff, 0x07, 0x6d, 0x6f, 0x64,
+    0x75, 0x6c, 0x65, 0x20, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x6c, 0x69, 0x6e, 0x65,
+    0x20, 0x30, 0x0a, 0x16, 0x00, 0x01, 0x1f, 0x31, 0x16, 0x00, 0x02, 0x1f, 0x32, 0x16, 0x00, 0x02,
+    0x1f, 0x33, 0x16, 0x00, 0x02, 0x1f, 0x34, 0x16, 0x00, 0x02, 0x1f, 0x35, 0x16, 0x00, 0x02, 0x1f,
+    0x36, 0x16, 0x00, 0x02, 0x1f, 0x37, 0x16, 0x00, 0x02, 0x1f, 0x38, 0x16, 0x00, 0x02, 0x1f, 0x39,
+    0xc6, 0x00, 0x03, 0x0f, 0xdd, 0x00, 0x04, 0x0f, 0xde, 0x00, 0x03, 0x1f, 0x31, 0xdf, 0x00, 0x03,
+    0x1f, 0x31, 0xe0, 0x00, 0x03, 0x1f, 0x31, 0xe1, 0x00, 0x03, 0x1f, 0x31, 0xe2, 0x00, 0x03, 0x1f,
+    0x31, 0xe3, 0x00, 0x03, 0x1f, 0x31, 0xe4, 0x00, 0x03, 0x1f, 0x31, 0xe5, 0x00, 0x03, 0x1f, 0x31,
+    0xe6, 0x00, 0x03, 0x1f, 0x32, 0xe6, 0x00, 0x03, 0x1f, 0x32, 0xc4, 0x01, 0x04, 0x0f, 0xe6, 0x00,
+    0x03, 0x1f, 0x32, 0xe6, 0x00, 0x03, 0x1f, 0x32, 0xe6, 0x00, 0x03, 0x1f, 0x32, 0xe6, 0x00, 0x03,
+    0x1f, 0x32, 0xe6, 0x00, 0x03, 0x1f, 0x32, 0xe6, 0x00, 0x03, 0x1f, 0x32, 0xe6, 0x00, 0x03, 0x1f,
+    0x32, 0xe6, 0x00, 0x03, 0x1f, 0x33, 0xe6, 0x00, 0x03, 0x1f, 0x33, 0xe6, 0x00, 0x03, 0x1f, 0x33,
+    0xab, 0x02, 0x04, 0x0f, 0xe6, 0x00, 0x03, 0x1f, 0x33, 0xe6, 0x00, 0x03, 0x1f, 0x33, 0xe6, 0x00,
+    0x03, 0x1f, 0x33, 0xe6, 0x00, 0x03, 0x1f, 0x33, 0xe6, 0x00, 0x03, 0x1f, 0x33, 0xe6, 0x00, 0x03,
+    0x1f, 0x33, 0xe6, 0x00, 0x03, 0x1f, 0x34, 0xe6, 0x00, 0x03, 0x1f, 0x34, 0xe6, 0x00, 0x03, 0x1f,
+    0x34, 0xe6, 0x00, 0x03, 0x1f, 0x34, 0x92, 0x03, 0x04, 0x0f, 0xe6, 0x00, 0x03, 0x1f, 0x34, 0xe6,
+    0x00, 0x03, 0x1f, 0x34, 0xe6, 0x00, 0x03, 0x1f, 0x34, 0xe6, 0x00, 0x03, 0x1f, 0x34, 0xe6, 0x00,
+    0x03, 0x1f, 0x34, 0xe6, 0x00, 0x03, 0x1f, 0x35, 0xe6, 0x00, 0x03, 0x1f, 0x35, 0xe6, 0x00, 0x03,
+    0x1f, 0x35, 0xe6, 0x00, 0x03, 0x1f, 0x35, 0xe6, 0x00, 0x03, 0x1f, 0x35, 0x79, 0x04, 0x04, 0x0f,
+    0xe6, 0x00, 0x03, 0x1f, 0x35, 0xe6, 0x00, 0x03, 0x1f, 0x35, 0xe6, 0x00, 0x03, 0x1f, 0x35, 0xe6,
+    0x00, 0x03, 0x1f, 0x35, 0xe6, 0x00, 0x03, 0x1f, 0x36, 0xe6, 0x00, 0x03, 0x1f, 0x36, 0xe6, 0x00,
+    0x03, 0x1f, 0x36, 0xe6, 0x00, 0x03, 0x1f, 0x36, 0xe6, 0x00, 0x03, 0x1f, 0x36, 0xe6, 0x00, 0x03,
+    0x1f, 0x36, 0x60, 0x05, 0x04, 0x0f, 0xe6, 0x00, 0x03, 0x1f, 0x36, 0xe6, 0x00, 0x03, 0x1f, 0x36,
+    0xe6, 0x00, 0x03, 0x1f, 0x36, 0xe6, 0x00, 0x03, 0x1f, 0x37, 0xe6, 0x00, 0x03, 0x1f, 0x37, 0xe6,
+    0x00, 0x03, 0x1f, 0x37, 0xe6, 0x00, 0x03, 0x1f, 0x37, 0xe6, 0x00, 0x03, 0x1f, 0x37, 0xe6, 0x00,
+    0x03, 0x1f, 0x37, 0xe6, 0x00, 0x03, 0x1f, 0x37, 0x47, 0x06, 0x04, 0x0f, 0xe6, 0x00, 0x03, 0x1f,
+    0x37, 0xe6, 0x00, 0x03, 0x1f, 0x37, 0xe6, 0x00, 0x03, 0x1f, 0x38, 0xe6, 0x00, 0x03, 0x1f, 0x38,
+    0xe6, 0x00, 0x03, 0x1f, 0x38, 0xe6, 0x00, 0x03, 0x1f, 0x38, 0xe6, 0x00, 0x03, 0x1f, 0x38, 0xe6,
+    0x00, 0x03, 0x1f, 0x38, 0xe6, 0x00, 0x03, 0x1f, 0x38, 0xe6, 0x00, 0x03, 0x1f, 0x38, 0x2e, 0x07,
+    0x04, 0x0f, 0xe6, 0x00, 0x03, 0x1f, 0x38, 0xe6, 0x00, 0x03, 0x1f, 0x39, 0xe6, 0x00, 0x03, 0x1f,
+    0x39, 0xe6, 0x00, 0x03, 0x1f, 0x39, 0xe6, 0x00, 0x03, 0x1f, 0x39, 0xe6, 0x00, 0x03, 0x1f, 0x39,
+    0xe6, 0x00, 0x03, 0x1f, 0x39, 0xe6, 0x00, 0x03, 0x1f, 0x39, 0xe6, 0x00, 0x03, 0x1f, 0x39, 0xe6,
+    0x00, 0x03, 0x1f, 0x39, 0x15, 0x08, 0x04, 0x0f, 0x16, 0x08, 0x05, 0x0f, 0x17, 0x08, 0x04, 0x1f,
+    0x30, 0x18, 0x08, 0x04, 0x1f, 0x30, 0x19, 0x08, 0x04, 0x1f, 0x30, 0x1a, 0x08, 0x04, 0x1f, 0x30,
+    0x1b, 0x08, 0x04, 0x1f, 0x30, 0x1c, 0x08, 0x04, 0x1f, 0x30, 0x1d, 0x08, 0x04, 0x1f, 0x30, 0x1e,
+    0x08, 0x04, 0x1f, 0x30, 0x1f, 0x08, 0x04, 0x1f, 0x30, 0xf0, 0x00, 0x04, 0x0f, 0x07, 0x09, 0x06,
+    0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x09, 0x09, 0x05, 0x0f, 0x0a, 0x09, 0x05, 0x0f, 0x0b, 0x09, 0x05,
+    0x0f, 0x0c, 0x09, 0x05, 0x0f, 0x0d, 0x09, 0x05, 0x0f, 0x0e, 0x09, 0x05, 0x0f, 0x0f, 0x09, 0x05,
+    0x0f, 0x10, 0x09, 0x04, 0x1f, 0x31, 0x11, 0x09, 0x04, 0x2f, 0x31, 0x32, 0xf8, 0x09, 0x05, 0x0f,
+    0xf0, 0x00, 0x04, 0x0f, 0x14, 0x09, 0x04, 0x1f, 0x31, 0x15, 0x09, 0x04, 0x1f, 0x31, 0x16, 0x09,
+    0x04, 0x1f, 0x31, 0x17, 0x09, 0x04, 0x1f, 0x31, 0x18, 0x09, 0x04, 0x1f, 0x31, 0x19, 0x09, 0x04,
+    0x1f, 0x31, 0x1a, 0x09, 0x04, 0x1f, 0x31, 0x1b, 0x09, 0x04, 0x1f, 0x31, 0x1c, 0x09, 0x04, 0x2f,
+    0x31, 0x33, 0xe9, 0x0a, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x1f, 0x09, 0x04, 0x1f, 0x31, 0x20,
+    0x09, 0x04, 0x1f, 0x31, 0x21, 0x09, 0x04, 0x1f, 0x31, 0x22, 0x09, 0x04, 0x1f, 0x31, 0x23, 0x09,
+    0x04, 0x1f, 0x31, 0x24, 0x09, 0x04, 0x1f, 0x31, 0x25, 0x09, 0x04, 0x1f, 0x31, 0x26, 0x09, 0x04,
+    0x1f, 0x31, 0x27, 0x09, 0x04, 0x2f, 0x31, 0x34, 0xda, 0x0b, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f,
+    0x2a, 0x09, 0x04, 0x1f, 0x31, 0x2b, 0x09, 0x04, 0x1f, 0x31, 0x2c, 0x09, 0x04, 0x1f, 0x31, 0x2d,
+    0x09, 0x04, 0x1f, 0x31, 0x2e, 0x09, 0x04, 0x1f, 0x31, 0x2f, 0x09, 0x04, 0x1f, 0x31, 0x30, 0x09,
+    0x04, 0x1f, 0x31, 0x31, 0x09, 0x04, 0x1f, 0x31, 0x32, 0x09, 0x04, 0x2f, 0x31, 0x35, 0xcb, 0x0c,
+    0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x35, 0x09, 0x04, 0x1f, 0x31, 0x36, 0x09, 0x04, 0x1f, 0x31,
+    0x37, 0x09, 0x04, 0x1f, 0x31, 0x38, 0x09, 0x04, 0x1f, 0x31, 0x39, 0x09, 0x04, 0x1f, 0x31, 0x3a,
+    0x09, 0x04, 0x1f, 0x31, 0x3b, 0x09, 0x04, 0x1f, 0x31, 0x3c, 0x09, 0x04, 0x1f, 0x31, 0x3d, 0x09,
+    0x04, 0x2f, 0x31, 0x36, 0xbc, 0x0d, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x40, 0x09, 0x04, 0x1f,
+    0x31, 0x41, 0x09, 0x04, 0x1f, 0x31, 0x42, 0x09, 0x04, 0x1f, 0x31, 0x43, 0x09, 0x04, 0x1f, 0x31,
+    0x44, 0x09, 0x04, 0x1f, 0x31, 0x45, 0x09, 0x04, 0x1f, 0x31, 0x46, 0x09, 0x04, 0x1f, 0x31, 0x47,
+    0x09, 0x04, 0x1f, 0x31, 0x48, 0x09, 0x04, 0x2f, 0x31, 0x37, 0xad, 0x0e, 0x05, 0x0f, 0xf0, 0x00,
+    0x04, 0x0f, 0x4b, 0x09, 0x04, 0x1f, 0x31, 0x4c, 0x09, 0x04, 0x1f, 0x31, 0x4d, 0x09, 0x04, 0x1f,
+    0x31, 0x4e, 0x09, 0x04, 0x1f, 0x31, 0x4f, 0x09, 0x04, 0x1f, 0x31, 0x50, 0x09, 0x04, 0x1f, 0x31,
+    0x51, 0x09, 0x04, 0x1f, 0x31, 0x52, 0x09, 0x04, 0x1f, 0x31, 0x53, 0x09, 0x04, 0x2f, 0x31, 0x38,
+    0x9e, 0x0f, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x56, 0x09, 0x04, 0x1f, 0x31, 0x57, 0x09, 0x04,
+    0x1f, 0x31, 0x58, 0x09, 0x04, 0x1f, 0x31, 0x59, 0x09, 0x04, 0x1f, 0x31, 0x5a, 0x09, 0x04, 0x1f,
+    0x31, 0x5b, 0x09, 0x04, 0x1f, 0x31, 0x5c, 0x09, 0x04, 0x1f, 0x31, 0x5d, 0x09, 0x04, 0x1f, 0x31,
+    0x5e, 0x09, 0x04, 0x2f, 0x31, 0x39, 0x8f, 0x10, 0x05, 0x0f, 0x90, 0x10, 0x05, 0x0f, 0x91, 0x10,
+    0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f,
+    0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32,
+    0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x2f, 0x32, 0x31,
+    0x81, 0x11, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04,
+    0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f,
+    0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x70, 0x12, 0x05, 0x0f, 0x71,
+    0x12, 0x05, 0x0f, 0x72, 0x12, 0x06, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x74, 0x12, 0x05, 0x0f, 0x75,
+    0x12, 0x05, 0x0f, 0x76, 0x12, 0x05, 0x0f, 0x77, 0x12, 0x05, 0x0f, 0x78, 0x12, 0x05, 0x0f, 0x79,
+    0x12, 0x05, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04,
+    0x2f, 0x32, 0x33, 0x63, 0x13, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x32,
+    0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60,
+    0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09,
+    0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x2f, 0x32, 0x34, 0x54, 0x14, 0x05, 0x0f, 0xf0, 0x00, 0x04,
+    0x0f, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32,
+    0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60,
+    0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x2f, 0x32, 0x35, 0x45,
+    0x15, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f,
+    0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32,
+    0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60,
+    0x09, 0x04, 0x2f, 0x32, 0x36, 0x36, 0x16, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04,
+    0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f,
+    0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32,
+    0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x2f, 0x32, 0x37, 0x27, 0x17, 0x05, 0x0f, 0xf0,
+    0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04,
+    0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f,
+    0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x2f, 0x32,
+    0x38, 0x18, 0x18, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09,
+    0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04,
+    0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f,
+    0x32, 0x60, 0x09, 0x04, 0x2f, 0x32, 0x39, 0x09, 0x19, 0x05, 0x0f, 0x0a, 0x19, 0x05, 0x0f, 0x0b,
+    0x19, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04,
+    0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f,
+    0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x2f, 0x33,
+    0x31, 0xfb, 0x19, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09,
+    0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04,
+    0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f,
+    0x33, 0x60, 0x09, 0x04, 0x2f, 0x33, 0x32, 0xec, 0x1a, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60,
+    0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09,
+    0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0xda, 0x1b, 0x05,
+    0x0f, 0xdb, 0x1b, 0x05, 0x0f, 0xdc, 0x1b, 0x05, 0x0f, 0xdd, 0x1b, 0x06, 0x0f, 0xf0, 0x00, 0x04,
+    0x0f, 0xdf, 0x1b, 0x05, 0x0f, 0xe0, 0x1b, 0x05, 0x0f, 0xe1, 0x1b, 0x05, 0x0f, 0xe2, 0x1b, 0x05,
+    0x0f, 0xe3, 0x1b, 0x05, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60,
+    0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x2f, 0x33, 0x34, 0xce, 0x1c, 0x05, 0x0f, 0xf0, 0x00,
+    0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f,
+    0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33,
+    0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x2f, 0x33, 0x35,
+    0xbf, 0x1d, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04,
+    0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f,
+    0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33,
+    0x60, 0x09, 0x04, 0x2f, 0x33, 0x36, 0xb0, 0x1e, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09,
+    0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04,
+    0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f,
+    0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x2f, 0x33, 0x37, 0xa1, 0x1f, 0x05, 0x0f,
+    0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09,
+    0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04,
+    0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x2f,
+    0x33, 0x38, 0x92, 0x20, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60,
+    0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09,
+    0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04,
+    0x1f, 0x33, 0x60, 0x09, 0x04, 0x2f, 0x33, 0x39, 0x83, 0x21, 0x05, 0x0f, 0x84, 0x21, 0x05, 0x0f,
+    0x85, 0x21, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09,
+    0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04,
+    0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x2f,
+    0x34, 0x31, 0x75, 0x22, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60,
+    0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09,
+    0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04,
+    0x1f, 0x34, 0x60, 0x09, 0x04, 0x2f, 0x34, 0x32, 0x66, 0x23, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f,
+    0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60,
+    0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09,
+    0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x2f, 0x34, 0x33, 0x57, 0x24,
+    0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34,
+    0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x44,
+    0x25, 0x05, 0x0f, 0x45, 0x25, 0x05, 0x0f, 0x46, 0x25, 0x05, 0x0f, 0x47, 0x25, 0x05, 0x0f, 0x48,
+    0x25, 0x06, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x4a, 0x25, 0x05, 0x0f, 0x4b, 0x25, 0x05, 0x0f, 0x4c,
+    0x25, 0x05, 0x0f, 0x4d, 0x25, 0x05, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f,
+    0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x2f, 0x34,
+    0x35, 0x39, 0x26, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09,
+    0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04,
+    0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f,
+    0x34, 0x60, 0x09, 0x04, 0x2f, 0x34, 0x36, 0x2a, 0x27, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60,
+    0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09,
+    0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04,
+    0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x2f, 0x34, 0x37, 0x1b, 0x28, 0x05,
+    0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60,
+    0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09,
+    0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04,
+    0x2f, 0x34, 0x38, 0x0c, 0x29, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x34,
+    0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60,
+    0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09,
+    0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x2f, 0x34, 0x39, 0xfd, 0x29, 0x05, 0x0f, 0xfe, 0x29, 0x05,
+    0x0f, 0xff, 0x29, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60,
+    0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09,
+    0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04,
+    0x2f, 0x35, 0x31, 0xef, 0x2a, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x35,
+    0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60,
+    0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09,
+    0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x2f, 0x35, 0x32, 0xe0, 0x2b, 0x05, 0x0f, 0xf0, 0x00, 0x04,
+    0x0f, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35,
+    0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60,
+    0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x2f, 0x35, 0x33, 0xd1,
+    0x2c, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f,
+    0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35,
+    0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60,
+    0x09, 0x04, 0x2f, 0x35, 0x34, 0xc2, 0x2d, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04,
+    0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f,
+    0x35, 0xae, 0x2e, 0x05, 0x0f, 0xaf, 0x2e, 0x05, 0x0f, 0xb0, 0x2e, 0x05, 0x0f, 0xb1, 0x2e, 0x05,
+    0x0f, 0xb2, 0x2e, 0x05, 0x0f, 0xb3, 0x2e, 0x06, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0xb5, 0x2e, 0x05,
+    0x0f, 0xb6, 0x2e, 0x05, 0x0f, 0xb7, 0x2e, 0x05, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09,
+    0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04,
+    0x1f, 0x35, 0x60, 0x09, 0x04, 0x2f, 0x35, 0x36, 0xa4, 0x2f, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f,
+    0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60,
+    0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09,
+    0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x2f, 0x35, 0x37, 0x95, 0x30,
+    0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35,
+    0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60,
+    0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09,
+    0x04, 0x2f, 0x35, 0x38, 0x86, 0x31, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f,
+    0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35,
+    0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60,
+    0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x2f, 0x35, 0x39, 0x77, 0x32, 0x05, 0x0f, 0x78, 0x32,
+    0x05, 0x0f, 0x79, 0x32, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36,
+    0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60,
+    0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09,
+    0x04, 0x2f, 0x36, 0x31, 0x69, 0x33, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f,
+    0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36,
+    0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60,
+    0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x2f, 0x36, 0x32, 0x5a, 0x34, 0x05, 0x0f, 0xf0, 0x00,
+    0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f,
+    0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36,
+    0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x2f, 0x36, 0x33,
+    0x4b, 0x35, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04,
+    0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f,
+    0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36,
+    0x60, 0x09, 0x04, 0x2f, 0x36, 0x34, 0x3c, 0x36, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09,
+    0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04,
+    0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f,
+    0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x2f, 0x36, 0x35, 0x2d, 0x37, 0x05, 0x0f,
+    0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09,
+    0x04, 0x1f, 0x36, 0x18, 0x38, 0x05, 0x0f, 0x19, 0x38, 0x05, 0x0f, 0x1a, 0x38, 0x05, 0x0f, 0x1b,
+    0x38, 0x05, 0x0f, 0x1c, 0x38, 0x05, 0x0f, 0x1d, 0x38, 0x05, 0x0f, 0x1e, 0x38, 0x06, 0x0f, 0xf0,
+    0x00, 0x04, 0x0f, 0x20, 0x38, 0x05, 0x0f, 0x21, 0x38, 0x05, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x36,
+    0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60,
+    0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x2f, 0x36, 0x37, 0x0f,
+    0x39, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f,
+    0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36,
+    0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60,
+    0x09, 0x04, 0x2f, 0x36, 0x38, 0x00, 0x3a, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04,
+    0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f,
+    0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36,
+    0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x03, 0x50, 0x20, 0x36,
+    0x39, 0x39, 0x0a, 0x00, 0x00, 0x00, 0x00, 0x93, 0xdc, 0x0c, 0x2e,
+};
+
+static const uint8_t lz4_checked_payload[3423] = {
+    0x04, 0x22, 0x4d, 0x18, 0x74, 0x40, 0xbd, 0x48, 0x0d, 0x00, 0x00, 0xff, 0x07, 0x6d, 0x6f, 0x64,
+    0x75, 0x6c, 0x65, 0x20, 0x70, 0x61, 0x79, 0x6c, 0x6f, 0x61, 0x64, 0x20, 0x6c, 0x69, 0x6e, 0x65,
+    0x20, 0x30, 0x0a, 0x16, 0x00, 0x01, 0x1f, 0x31, 0x16, 0x00, 0x02, 0x1f, 0x32, 0x16, 0x00, 0x02,
+    0x1f, 0x33, 0x16, 0x00, 0x02, 0x1f, 0x34, 0x16, 0x00, 0x02, 0x1f, 0x35, 0x16, 0x00, 0x02, 0x1f,
+    0x36, 0x16, 0x00, 0x02, 0x1f, 0x37, 0x16, 0x00, 0x02, 0x1f, 0x38, 0x16, 0x00, 0x02, 0x1f, 0x39,
+    0xc6, 0x00, 0x03, 0x0f, 0xdd, 0x00, 0x04, 0x0f, 0xde, 0x00, 0x03, 0x1f, 0x31, 0xdf, 0x00, 0x03,
+    0x1f, 0x31, 0xe0, 0x00, 0x03, 0x1f, 0x31, 0xe1, 0x00, 0x03, 0x1f, 0x31, 0xe2, 0x00, 0x03, 0x1f,
+    0x31, 0xe3, 0x00, 0x03, 0x1f, 0x31, 0xe4, 0x00, 0x03, 0x1f, 0x31, 0xe5, 0x00, 0x03, 0x1f, 0x31,
+    0xe6, 0x00, 0x03, 0x1f, 0x32, 0xe6, 0x00, 0x03, 0x1f, 0x32, 0xc4, 0x01, 0x04, 0x0f, 0xe6, 0x00,
+    0x03, 0x1f, 0x32, 0xe6, 0x00, 0x03, 0x1f, 0x32, 0xe6, 0x00, 0x03, 0x1f, 0x32, 0xe6, 0x00, 0x03,
+    0x1f, 0x32, 0xe6, 0x00, 0x03, 0x1f, 0x32, 0xe6, 0x00, 0x03, 0x1f, 0x32, 0xe6, 0x00, 0x03, 0x1f,
+    0x32, 0xe6, 0x00, 0x03, 0x1f, 0x33, 0xe6, 0x00, 0x03, 0x1f, 0x33, 0xe6, 0x00, 0x03, 0x1f, 0x33,
+    0xab, 0x02, 0x04, 0x0f, 0xe6, 0x00, 0x03, 0x1f, 0x33, 0xe6, 0x00, 0x03, 0x1f, 0x33, 0xe6, 0x00,
+    0x03, 0x1f, 0x33, 0xe6, 0x00, 0x03, 0x1f, 0x33, 0xe6, 0x00, 0x03, 0x1f, 0x33, 0xe6, 0x00, 0x03,
+    0x1f, 0x33, 0xe6, 0x00, 0x03, 0x1f, 0x34, 0xe6, 0x00, 0x03, 0x1f, 0x34, 0xe6, 0x00, 0x03, 0x1f,
+    0x34, 0xe6, 0x00, 0x03, 0x1f, 0x34, 0x92, 0x03, 0x04, 0x0f, 0xe6, 0x00, 0x03, 0x1f, 0x34, 0xe6,
+    0x00, 0x03, 0x1f, 0x34, 0xe6, 0x00, 0x03, 0x1f, 0x34, 0xe6, 0x00, 0x03, 0x1f, 0x34, 0xe6, 0x00,
+    0x03, 0x1f, 0x34, 0xe6, 0x00, 0x03, 0x1f, 0x35, 0xe6, 0x00, 0x03, 0x1f, 0x35, 0xe6, 0x00, 0x03,
+    0x1f, 0x35, 0xe6, 0x00, 0x03, 0x1f, 0x35, 0xe6, 0x00, 0x03, 0x1f, 0x35, 0x79, 0x04, 0x04, 0x0f,
+    0xe6, 0x00, 0x03, 0x1f, 0x35, 0xe6, 0x00, 0x03, 0x1f, 0x35, 0xe6, 0x00, 0x03, 0x1f, 0x35, 0xe6,
+    0x00, 0x03, 0x1f, 0x35, 0xe6, 0x00, 0x03, 0x1f, 0x36, 0xe6, 0x00, 0x03, 0x1f, 0x36, 0xe6, 0x00,
+    0x03, 0x1f, 0x36, 0xe6, 0x00, 0x03, 0x1f, 0x36, 0xe6, 0x00, 0x03, 0x1f, 0x36, 0xe6, 0x00, 0x03,
+    0x1f, 0x36, 0x60, 0x05, 0x04, 0x0f, 0xe6, 0x00, 0x03, 0x1f, 0x36, 0xe6, 0x00, 0x03, 0x1f, 0x36,
+    0xe6, 0x00, 0x03, 0x1f, 0x36, 0xe6, 0x00, 0x03, 0x1f, 0x37, 0xe6, 0x00, 0x03, 0x1f, 0x37, 0xe6,
+    0x00, 0x03, 0x1f, 0x37, 0xe6, 0x00, 0x03, 0x1f, 0x37, 0xe6, 0x00, 0x03, 0x1f, 0x37, 0xe6, 0x00,
+    0x03, 0x1f, 0x37, 0xe6, 0x00, 0x03, 0x1f, 0x37, 0x47, 0x06, 0x04, 0x0f, 0xe6, 0x00, 0x03, 0x1f,
+    0x37, 0xe6, 0x00, 0x03, 0x1f, 0x37, 0xe6, 0x00, 0x03, 0x1f, 0x38, 0xe6, 0x00, 0x03, 0x1f, 0x38,
+    0xe6, 0x00, 0x03, 0x1f, 0x38, 0xe6, 0x00, 0x03, 0x1f, 0x38, 0xe6, 0x00, 0x03, 0x1f, 0x38, 0xe6,
+    0x00, 0x03, 0x1f, 0x38, 0xe6, 0x00, 0x03, 0x1f, 0x38, 0xe6, 0x00, 0x03, 0x1f, 0x38, 0x2e, 0x07,
+    0x04, 0x0f, 0xe6, 0x00, 0x03, 0x1f, 0x38, 0xe6, 0x00, 0x03, 0x1f, 0x39, 0xe6, 0x00, 0x03, 0x1f,
+    0x39, 0xe6, 0x00, 0x03, 0x1f, 0x39, 0xe6, 0x00, 0x03, 0x1f, 0x39, 0xe6, 0x00, 0x03, 0x1f, 0x39,
+    0xe6, 0x00, 0x03, 0x1f, 0x39, 0xe6, 0x00, 0x03, 0x1f, 0x39, 0xe6, 0x00, 0x03, 0x1f, 0x39, 0xe6,
+    0x00, 0x03, 0x1f, 0x39, 0x15, 0x08, 0x04, 0x0f, 0x16, 0x08, 0x05, 0x0f, 0x17, 0x08, 0x04, 0x1f,
+    0x30, 0x18, 0x08, 0x04, 0x1f, 0x30, 0x19, 0x08, 0x04, 0x1f, 0x30, 0x1a, 0x08, 0x04, 0x1f, 0x30,
+    0x1b, 0x08, 0x04, 0x1f, 0x30, 0x1c, 0x08, 0x04, 0x1f, 0x30, 0x1d, 0x08, 0x04, 0x1f, 0x30, 0x1e,
+    0x08, 0x04, 0x1f, 0x30, 0x1f, 0x08, 0x04, 0x1f, 0x30, 0xf0, 0x00, 0x04, 0x0f, 0x07, 0x09, 0x06,
+    0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x09, 0x09, 0x05, 0x0f, 0x0a, 0x09, 0x05, 0x0f, 0x0b, 0x09, 0x05,
+    0x0f, 0x0c, 0x09, 0x05, 0x0f, 0x0d, 0x09, 0x05, 0x0f, 0x0e, 0x09, 0x05, 0x0f, 0x0f, 0x09, 0x05,
+    0x0f, 0x10, 0x09, 0x04, 0x1f, 0x31, 0x11, 0x09, 0x04, 0x2f, 0x31, 0x32, 0xf8, 0x09, 0x05, 0x0f,
+    0xf0, 0x00, 0x04, 0x0f, 0x14, 0x09, 0x04, 0x1f, 0x31, 0x15, 0x09, 0x04, 0x1f, 0x31, 0x16, 0x09,
+    0x04, 0x1f, 0x31, 0x17, 0x09, 0x04, 0x1f, 0x31, 0x18, 0x09, 0x04, 0x1f, 0x31, 0x19, 0x09, 0x04,
+    0x1f, 0x31, 0x1a, 0x09, 0x04, 0x1f, 0x31, 0x1b, 0x09, 0x04, 0x1f, 0x31, 0x1c, 0x09, 0x04, 0x2f,
+    0x31, 0x33, 0xe9, 0x0a, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x1f, 0x09, 0x04, 0x1f, 0x31, 0x20,
+    0x09, 0x04, 0x1f, 0x31, 0x21, 0x09, 0x04, 0x1f, 0x31, 0x22, 0x09, 0x04, 0x1f, 0x31, 0x23, 0x09,
+    0x04, 0x1f, 0x31, 0x24, 0x09, 0x04, 0x1f, 0x31, 0x25, 0x09, 0x04, 0x1f, 0x31, 0x26, 0x09, 0x04,
+    0x1f, 0x31, 0x27, 0x09, 0x04, 0x2f, 0x31, 0x34, 0xda, 0x0b, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f,
+    0x2a, 0x09, 0x04, 0x1f, 0x31, 0x2b, 0x09, 0x04, 0x1f, 0x31, 0x2c, 0x09, 0x04, 0x1f, 0x31, 0x2d,
+    0x09, 0x04, 0x1f, 0x31, 0x2e, 0x09, 0x04, 0x1f, 0x31, 0x2f, 0x09, 0x04, 0x1f, 0x31, 0x30, 0x09,
+    0x04, 0x1f, 0x31, 0x31, 0x09, 0x04, 0x1f, 0x31, 0x32, 0x09, 0x04, 0x2f, 0x31, 0x35, 0xcb, 0x0c,
+    0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x35, 0x09, 0x04, 0x1f, 0x31, 0x36, 0x09, 0x04, 0x1f, 0x31,
+    0x37, 0x09, 0x04, 0x1f, 0x31, 0x38, 0x09, 0x04, 0x1f, 0x31, 0x39, 0x09, 0x04, 0x1f, 0x31, 0x3a,
+    0x09, 0x04, 0x1f, 0x31, 0x3b, 0x09, 0x04, 0x1f, 0x31, 0x3c, 0x09, 0x04, 0x1f, 0x31, 0x3d, 0x09,
+    0x04, 0x2f, 0x31, 0x36, 0xbc, 0x0d, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x40, 0x09, 0x04, 0x1f,
+    0x31, 0x41, 0x09, 0x04, 0x1f, 0x31, 0x42, 0x09, 0x04, 0x1f, 0x31, 0x43, 0x09, 0x04, 0x1f, 0x31,
+    0x44, 0x09, 0x04, 0x1f, 0x31, 0x45, 0x09, 0x04, 0x1f, 0x31, 0x46, 0x09, 0x04, 0x1f, 0x31, 0x47,
+    0x09, 0x04, 0x1f, 0x31, 0x48, 0x09, 0x04, 0x2f, 0x31, 0x37, 0xad, 0x0e, 0x05, 0x0f, 0xf0, 0x00,
+    0x04, 0x0f, 0x4b, 0x09, 0x04, 0x1f, 0x31, 0x4c, 0x09, 0x04, 0x1f, 0x31, 0x4d, 0x09, 0x04, 0x1f,
+    0x31, 0x4e, 0x09, 0x04, 0x1f, 0x31, 0x4f, 0x09, 0x04, 0x1f, 0x31, 0x50, 0x09, 0x04, 0x1f, 0x31,
+    0x51, 0x09, 0x04, 0x1f, 0x31, 0x52, 0x09, 0x04, 0x1f, 0x31, 0x53, 0x09, 0x04, 0x2f, 0x31, 0x38,
+    0x9e, 0x0f, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x56, 0x09, 0x04, 0x1f, 0x31, 0x57, 0x09, 0x04,
+    0x1f, 0x31, 0x58, 0x09, 0x04, 0x1f, 0x31, 0x59, 0x09, 0x04, 0x1f, 0x31, 0x5a, 0x09, 0x04, 0x1f,
+    0x31, 0x5b, 0x09, 0x04, 0x1f, 0x31, 0x5c, 0x09, 0x04, 0x1f, 0x31, 0x5d, 0x09, 0x04, 0x1f, 0x31,
+    0x5e, 0x09, 0x04, 0x2f, 0x31, 0x39, 0x8f, 0x10, 0x05, 0x0f, 0x90, 0x10, 0x05, 0x0f, 0x91, 0x10,
+    0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f,
+    0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32,
+    0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x2f, 0x32, 0x31,
+    0x81, 0x11, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04,
+    0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f,
+    0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x70, 0x12, 0x05, 0x0f, 0x71,
+    0x12, 0x05, 0x0f, 0x72, 0x12, 0x06, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x74, 0x12, 0x05, 0x0f, 0x75,
+    0x12, 0x05, 0x0f, 0x76, 0x12, 0x05, 0x0f, 0x77, 0x12, 0x05, 0x0f, 0x78, 0x12, 0x05, 0x0f, 0x79,
+    0x12, 0x05, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04,
+    0x2f, 0x32, 0x33, 0x63, 0x13, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x32,
+    0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60,
+    0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09,
+    0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x2f, 0x32, 0x34, 0x54, 0x14, 0x05, 0x0f, 0xf0, 0x00, 0x04,
+    0x0f, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32,
+    0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60,
+    0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x2f, 0x32, 0x35, 0x45,
+    0x15, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f,
+    0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32,
+    0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60,
+    0x09, 0x04, 0x2f, 0x32, 0x36, 0x36, 0x16, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04,
+    0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f,
+    0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32,
+    0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x2f, 0x32, 0x37, 0x27, 0x17, 0x05, 0x0f, 0xf0,
+    0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04,
+    0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f,
+    0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x2f, 0x32,
+    0x38, 0x18, 0x18, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09,
+    0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04,
+    0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f, 0x32, 0x60, 0x09, 0x04, 0x1f,
+    0x32, 0x60, 0x09, 0x04, 0x2f, 0x32, 0x39, 0x09, 0x19, 0x05, 0x0f, 0x0a, 0x19, 0x05, 0x0f, 0x0b,
+    0x19, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04,
+    0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f,
+    0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x2f, 0x33,
+    0x31, 0xfb, 0x19, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09,
+    0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04,
+    0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f,
+    0x33, 0x60, 0x09, 0x04, 0x2f, 0x33, 0x32, 0xec, 0x1a, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60,
+    0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09,
+    0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0xda, 0x1b, 0x05,
+    0x0f, 0xdb, 0x1b, 0x05, 0x0f, 0xdc, 0x1b, 0x05, 0x0f, 0xdd, 0x1b, 0x06, 0x0f, 0xf0, 0x00, 0x04,
+    0x0f, 0xdf, 0x1b, 0x05, 0x0f, 0xe0, 0x1b, 0x05, 0x0f, 0xe1, 0x1b, 0x05, 0x0f, 0xe2, 0x1b, 0x05,
+    0x0f, 0xe3, 0x1b, 0x05, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60,
+    0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x2f, 0x33, 0x34, 0xce, 0x1c, 0x05, 0x0f, 0xf0, 0x00,
+    0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f,
+    0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33,
+    0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x2f, 0x33, 0x35,
+    0xbf, 0x1d, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04,
+    0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f,
+    0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33,
+    0x60, 0x09, 0x04, 0x2f, 0x33, 0x36, 0xb0, 0x1e, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09,
+    0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04,
+    0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f,
+    0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x2f, 0x33, 0x37, 0xa1, 0x1f, 0x05, 0x0f,
+    0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09,
+    0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04,
+    0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x2f,
+    0x33, 0x38, 0x92, 0x20, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60,
+    0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09,
+    0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04, 0x1f, 0x33, 0x60, 0x09, 0x04,
+    0x1f, 0x33, 0x60, 0x09, 0x04, 0x2f, 0x33, 0x39, 0x83, 0x21, 0x05, 0x0f, 0x84, 0x21, 0x05, 0x0f,
+    0x85, 0x21, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09,
+    0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04,
+    0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x2f,
+    0x34, 0x31, 0x75, 0x22, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60,
+    0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09,
+    0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04,
+    0x1f, 0x34, 0x60, 0x09, 0x04, 0x2f, 0x34, 0x32, 0x66, 0x23, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f,
+    0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60,
+    0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09,
+    0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x2f, 0x34, 0x33, 0x57, 0x24,
+    0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34,
+    0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x44,
+    0x25, 0x05, 0x0f, 0x45, 0x25, 0x05, 0x0f, 0x46, 0x25, 0x05, 0x0f, 0x47, 0x25, 0x05, 0x0f, 0x48,
+    0x25, 0x06, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x4a, 0x25, 0x05, 0x0f, 0x4b, 0x25, 0x05, 0x0f, 0x4c,
+    0x25, 0x05, 0x0f, 0x4d, 0x25, 0x05, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f,
+    0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x2f, 0x34,
+    0x35, 0x39, 0x26, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09,
+    0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04,
+    0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f,
+    0x34, 0x60, 0x09, 0x04, 0x2f, 0x34, 0x36, 0x2a, 0x27, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60,
+    0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09,
+    0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04,
+    0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x2f, 0x34, 0x37, 0x1b, 0x28, 0x05,
+    0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60,
+    0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09,
+    0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04,
+    0x2f, 0x34, 0x38, 0x0c, 0x29, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x34,
+    0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60,
+    0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x1f, 0x34, 0x60, 0x09,
+    0x04, 0x1f, 0x34, 0x60, 0x09, 0x04, 0x2f, 0x34, 0x39, 0xfd, 0x29, 0x05, 0x0f, 0xfe, 0x29, 0x05,
+    0x0f, 0xff, 0x29, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60,
+    0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09,
+    0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04,
+    0x2f, 0x35, 0x31, 0xef, 0x2a, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x35,
+    0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60,
+    0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09,
+    0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x2f, 0x35, 0x32, 0xe0, 0x2b, 0x05, 0x0f, 0xf0, 0x00, 0x04,
+    0x0f, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35,
+    0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60,
+    0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x2f, 0x35, 0x33, 0xd1,
+    0x2c, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f,
+    0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35,
+    0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60,
+    0x09, 0x04, 0x2f, 0x35, 0x34, 0xc2, 0x2d, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04,
+    0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f,
+    0x35, 0xae, 0x2e, 0x05, 0x0f, 0xaf, 0x2e, 0x05, 0x0f, 0xb0, 0x2e, 0x05, 0x0f, 0xb1, 0x2e, 0x05,
+    0x0f, 0xb2, 0x2e, 0x05, 0x0f, 0xb3, 0x2e, 0x06, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0xb5, 0x2e, 0x05,
+    0x0f, 0xb6, 0x2e, 0x05, 0x0f, 0xb7, 0x2e, 0x05, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09,
+    0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04,
+    0x1f, 0x35, 0x60, 0x09, 0x04, 0x2f, 0x35, 0x36, 0xa4, 0x2f, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f,
+    0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60,
+    0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09,
+    0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x2f, 0x35, 0x37, 0x95, 0x30,
+    0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35,
+    0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60,
+    0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09,
+    0x04, 0x2f, 0x35, 0x38, 0x86, 0x31, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f,
+    0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35,
+    0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x1f, 0x35, 0x60,
+    0x09, 0x04, 0x1f, 0x35, 0x60, 0x09, 0x04, 0x2f, 0x35, 0x39, 0x77, 0x32, 0x05, 0x0f, 0x78, 0x32,
+    0x05, 0x0f, 0x79, 0x32, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36,
+    0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60,
+    0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09,
+    0x04, 0x2f, 0x36, 0x31, 0x69, 0x33, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f,
+    0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36,
+    0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60,
+    0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x2f, 0x36, 0x32, 0x5a, 0x34, 0x05, 0x0f, 0xf0, 0x00,
+    0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f,
+    0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36,
+    0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x2f, 0x36, 0x33,
+    0x4b, 0x35, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04,
+    0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f,
+    0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36,
+    0x60, 0x09, 0x04, 0x2f, 0x36, 0x34, 0x3c, 0x36, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09,
+    0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04,
+    0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f,
+    0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x2f, 0x36, 0x35, 0x2d, 0x37, 0x05, 0x0f,
+    0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09,
+    0x04, 0x1f, 0x36, 0x18, 0x38, 0x05, 0x0f, 0x19, 0x38, 0x05, 0x0f, 0x1a, 0x38, 0x05, 0x0f, 0x1b,
+    0x38, 0x05, 0x0f, 0x1c, 0x38, 0x05, 0x0f, 0x1d, 0x38, 0x05, 0x0f, 0x1e, 0x38, 0x06, 0x0f, 0xf0,
+    0x00, 0x04, 0x0f, 0x20, 0x38, 0x05, 0x0f, 0x21, 0x38, 0x05, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x36,
+    0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60,
+    0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x2f, 0x36, 0x37, 0x0f,
+    0x39, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f,
+    0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36,
+    0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60,
+    0x09, 0x04, 0x2f, 0x36, 0x38, 0x00, 0x3a, 0x05, 0x0f, 0xf0, 0x00, 0x04, 0x0f, 0x60, 0x09, 0x04,
+    0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f,
+    0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36,
+    0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x04, 0x1f, 0x36, 0x60, 0x09, 0x03, 0x50, 0x20, 0x36,
+    0x39, 0x39, 0x0a, 0xf6, 0x21, 0xcd, 0x1b, 0x00, 0x00, 0x00, 0x00, 0x93, 0xdc, 0x0c, 0x2e,
+};
+
+static const uint8_t big_gzip_payload[13232] = {
+    0x1f, 0x8b, 0x08, 0x08, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0x6d, 0x6f, 0x64, 0x75, 0x6c, 0x65,
+    0x2e, 0x77, 0x61, 0x73, 0x6d, 0x00, 0xed, 0xda, 0x73, 0x57, 0x18, 0x7c, 0x03, 0x80, 0xe1, 0x6c,
+    0xbb, 0x85, 0x65, 0x7b, 0x19, 0xcb, 0xb6, 0xb5, 0x6c, 0x5b, 0xab, 0x96, 0x5d, 0xcb, 0x5a, 0x5c,
+    0x5c, 0xb6, 0x97, 0x6b, 0xd9, 0xc6, 0xe2, 0xb2, 0x97, 0x6b, 0xd5, 0xfb, 0x7e, 0x8c, 0xe7, 0x8f,
+    0xdf, 0x97, 0xb8, 0xcf, 0xb9, 0xcf, 0xb9, 0x20, 0x3e, 0xe7, 0x7f, 0xd9, 0x3e, 0xfe, 0x2b, 0x34,
+    0xc4, 0xe7, 0x80, 0x5a, 0xe2, 0x8d, 0x17, 0x08, 0x8b, 0xc5, 0x5f, 0xaa, 0xb4, 0x91, 0xe7, 0x9d,
+    0xed, 0x6c, 0x06, 0x81, 0xbc, 0x3f, 0x4c, 0x4d, 0x2e, 0x54, 0x45, 0xf1, 0xd3, 0xb9, 0x21, 0x6c,
+    0x95, 0x9c, 0xd2, 0x8c, 0x1b, 0xdf, 0xb7, 0xdf, 0xe7, 0xc5, 0xd4, 0xfe, 0xd1, 0x52, 0xfc, 0xea,
+    0x7d, 0xa7, 0x89, 0x59, 0xa7, 0x5f, 0x66, 0x82, 0xd5, 0xf5, 0x4c, 0xc6, 0x65, 0x6c, 0xe4, 0x5c,
+    0x02, 0xa7, 0x30, 0xce, 0x4c, 0xf9, 0x9b, 0xab, 0x0c, 0x2d, 0xd7, 0xe3, 0x06, 0xa7, 0x52, 0xad,
+    0x1c, 0xc6, 0xf2, 0x42, 0xc8, 0x17, 0x8c, 0x22, 0x6d, 0xc5, 0x25, 0x76, 0x3e, 0x41, 0x9a, 0x3c,
+    0x2d, 0x1b, 0x19, 0x01, 0x54, 0x0e, 0xce, 0x52, 0x14, 0x1f, 0xa1, 0x77, 0x54, 0x3c, 0xdd, 0x7d,
+    0x31, 0xb3, 0x78, 0x64, 0x53, 0xa1, 0x7e, 0x5d, 0xbf, 0xda, 0x3b, 0x6e, 0xbc, 0x84, 0x39, 0xa2,
+    0x46, 0x3a, 0xaa, 0xcf, 0x90, 0xfd, 0x71, 0x4a, 0x49, 0xb7, 0xce, 0x04, 0xd1, 0xe3, 0x3f, 0xb6,
+    0x78, 0x37, 0x7f, 0xa1, 0xe4, 0x85, 0xf1, 0x83, 0x54, 0x94, 0xd7, 0xe0, 0xed, 0x1c, 0xe7, 0xbf,
+    0x34, 0xa3, 0x24, 0xfb, 0x25, 0x2f, 0xff, 0xfc, 0xd6, 0x29, 0xf6, 0xc1, 0xc3, 0xe8, 0x8d, 0x6c,
+    0x4f, 0xc4, 0x21, 0xca, 0xe9, 0x4e, 0xdc, 0xeb, 0xe1, 0xe6, 0x3d, 0x29, 0x4c, 0x44, 0x3b, 0xc4,
+    0x1f, 0x72, 0xc7, 0x84, 0x2b, 0xa9, 0x97, 0x17, 0x28, 0x69, 0x58, 0x06, 0xfc, 0x5c, 0xa3, 0x95,
+    0x40, 0x6f, 0x9b, 0x10, 0x24, 0x37, 0xab, 0xd9, 0xe0, 0x6c, 0x64, 0xe8, 0xdd, 0x9e, 0x9b, 0x9c,
+    0x0f, 0xee, 0x57, 0x79, 0x3a, 0xef, 0xbe, 0x42, 0xd1, 0x7a, 0xab, 0x36, 0x9f, 0x48, 0x62, 0x38,
+    0xc8, 0x55, 0xbd, 0x26, 0x58, 0xf6, 0x6e, 0xef, 0x77, 0xc7, 0xe6, 0xe4, 0xb1, 0x1d, 0xfe, 0x79,
+    0xb7, 0x4e, 0xd7, 0x22, 0xb2, 0xb4, 0xeb, 0xcd, 0x34, 0x16, 0x0b, 0x99, 0xc6, 0x49, 0xa3, 0x3a,
+    0xc6, 0x51, 0x81, 0x44, 0x80, 0x23, 0x0c, 0x5d, 0xc5, 0x82, 0xa5, 0xa3, 0xbd, 0xe8, 0xab, 0xb8,
+    0x4a, 0xf6, 0xeb, 0xfc, 0xaf, 0xf2, 0x0e, 0xc7, 0x36, 0x2b, 0xf9, 0x67, 0x1f, 0x18, 0x4a, 0x0b,
+    0xdd, 0x7e, 0x5a, 0xc2, 0x62, 0x1c, 0x61, 0x25, 0x56, 0xb7, 0xb2, 0x7d, 0x03, 0x0a, 0xf8, 0x41,
+    0x92, 0x6e, 0xd2, 0x86, 0x69, 0x16, 0x2c, 0xa4, 0x0f, 0x02, 0x96, 0x96, 0xd2, 0x07, 0xfe, 0x45,
+    0x02, 0x9d, 0x84, 0xe2, 0x9d, 0x5b, 0xfa, 0x50, 0x38, 0x0a, 0x18, 0x69, 0x0b, 0x7f, 0x60, 0x29,
+    0xb5, 0x31, 0xa2, 0x7d, 0x8f, 0x57, 0x9d, 0x2d, 0x55, 0x29, 0x86, 0x3e, 0x77, 0x6a, 0x5b, 0x9e,
+    0xad, 0xd9, 0x06, 0xf1, 0xc0, 0x8b, 0x70, 0x59, 0x9b, 0xee, 0x6a, 0x7c, 0xd0, 0x4c, 0x8e, 0xca,
+    0xc4, 0x15, 0x17, 0xf2, 0x52, 0xf9, 0x72, 0xc4, 0x24, 0x66, 0xaf, 0x6c, 0x36, 0x29, 0x23, 0x97,
+    0xc9, 0xaf, 0xfd, 0x4e, 0xeb, 0xbd, 0xcf, 0x63, 0x53, 0xc5, 0x08, 0x8b, 0xfd, 0x38, 0xcc, 0x58,
+    0xe6, 0x47, 0x15, 0x54, 0x42, 0x05, 0x52, 0x45, 0x0e, 0x95, 0xda, 0x16, 0xeb, 0x25, 0xcf, 0xb1,
+    0x7a, 0x25, 0xe3, 0x08, 0xb7, 0xfc, 0xc2, 0x6b, 0xce, 0xa0, 0x68, 0xdd, 0x6d, 0x72, 0x61, 0x3f,
+    0x0c, 0x66, 0xe6, 0xca, 0x75, 0xbc, 0xe7, 0xca, 0x61, 0x8c, 0x63, 0x2c, 0x2a, 0x82, 0x3b, 0xf2,
+    0xa6, 0x13, 0xc8, 0xfa, 0x9e, 0x39, 0x6f, 0xc6, 0xe2, 0x70, 0x7c, 0x94, 0x86, 0xe1, 0x6e, 0x13,
+    0x2b, 0x5a, 0xfd, 0xf4, 0x8f, 0x07, 0xaf, 0xe4, 0xc6, 0x26, 0x56, 0xb6, 0x1d, 0x3f, 0x62, 0x92,
+    0x4a, 0xf9, 0x7d, 0x72, 0x8e, 0x9d, 0x0d, 0x19, 0x72, 0xac, 0xc3, 0xbb, 0x58, 0xe2, 0x74, 0xb4,
+    0x8a, 0xdd, 0xbb, 0xfd, 0xff, 0x78, 0x96, 0xef, 0x6a, 0xbd, 0x76, 0x7c, 0x5a, 0xce, 0xaa, 0x32,
+    0xe8, 0xc8, 0x63, 0xce, 0x69, 0xd4, 0x24, 0x90, 0x2d, 0x10, 0x22, 0x34, 0x53, 0xa6, 0x5d, 0x30,
+    0x9e, 0x0a, 0xf9, 0xf9, 0x7c, 0xe1, 0x63, 0x4a, 0xf5, 0xae, 0xe0, 0xa7, 0x28, 0x8c, 0x97, 0xfa,
+    0x4f, 0x9f, 0xb9, 0x98, 0x77, 0x72, 0x4d, 0x3d, 0xcf, 0xb9, 0x50, 0x32, 0x37, 0x92, 0x5c, 0xc7,
+    0x5a, 0x06, 0xce, 0xc9, 0x46, 0xa5, 0xf3, 0xaf, 0xfc, 0x4e, 0x8b, 0xbe, 0xd0, 0x14, 0xa4, 0xd4,
+    0x68, 0xc3, 0x0c, 0x54, 0x96, 0x6a, 0x9a, 0xfa, 0x7a, 0x6a, 0xd7, 0x07, 0xaa, 0x55, 0x3a, 0x7b,
+    0x54, 0xec, 0x47, 0xfe, 0x57, 0x1e, 0x41, 0x19, 0x3a, 0x33, 0x6a, 0x98, 0xb6, 0x45, 0x1d, 0x3f,
+    0x52, 0xd9, 0x4c, 0xf9, 0x65, 0x0b, 0x79, 0xc2, 0x3d, 0x7f, 0x5c, 0x9c, 0x66, 0xbf, 0x96, 0x9b,
+    0xed, 0x89, 0x9b, 0xb7, 0x25, 0x33, 0xfd, 0xf5, 0xab, 0x20, 0x33, 0x37, 0xe1, 0x9b, 0x45, 0xeb,
+    0xdd, 0x51, 0x5e, 0x6c, 0xa8, 0xac, 0x0e, 0xbb, 0xd9, 0xcc, 0xf0, 0xef, 0x32, 0xd1, 0x2d, 0xfd,
+    0x34, 0xfd, 0xad, 0x3f, 0x75, 0x19, 0xdf, 0x3b, 0xf8, 0x41, 0x04, 0xdd, 0xdd, 0x56, 0x96, 0x25,
+    0x1a, 0xbe, 0xc2, 0x60, 0x23, 0xa6, 0x85, 0xbb, 0x03, 0x02, 0xd9, 0xed, 0x43, 0xfc, 0x9b, 0xaf,
+    0xb3, 0x0e, 0x76, 0xec, 0x03, 0xd3, 0x99, 0x46, 0xd4, 0x98, 0x55, 0x2a, 0x7a, 0xc0, 0x0c, 0x79,
+    0x79, 0x7a, 0x79, 0x2f, 0xd6, 0xc5, 0x54, 0xcb, 0xe9, 0x7e, 0xbe, 0xa6, 0x02, 0xb6, 0x06, 0x67,
+    0x69, 0x9b, 0x27, 0x31, 0x9e, 0x8d, 0x27, 0xd6, 0xf3, 0x9e, 0xfd, 0xe4, 0xac, 0xb1, 0x1d, 0xbc,
+    0xb2, 0x33, 0x92, 0xc4, 0xf2, 0x5f, 0x4b, 0xd7, 0x04, 0x6e, 0xdc, 0x9d, 0x3e, 0xc1, 0x14, 0x18,
+    0x85, 0x38, 0xb8, 0x37, 0x9c, 0xfb, 0x72, 0xfe, 0xb1, 0x74, 0x45, 0xab, 0x5a, 0x2e, 0xe8, 0x6d,
+    0x82, 0x0b, 0xae, 0x90, 0x0f, 0xe7, 0xe8, 0x99, 0xe4, 0x36, 0x4f, 0x1b, 0x7c, 0xb9, 0x79, 0x7e,
+    0xf8, 0x56, 0xa9, 0xd6, 0xc7, 0xf0, 0x73, 0x85, 0xfa, 0x07, 0x30, 0xbe, 0x62, 0x3a, 0x6f, 0x32,
+    0xc7, 0x54, 0xca, 0x07, 0x26, 0x7b, 0x43, 0x92, 0x8c, 0x3b, 0x17, 0xf7, 0xb7, 0x0c, 0x3b, 0x81,
+    0xd9, 0x51, 0xdf, 0x62, 0x6a, 0xbf, 0x8f, 0xe0, 0xd3, 0x56, 0x44, 0x63, 0x55, 0xa5, 0x07, 0x3e,
+    0x51, 0xe9, 0xf7, 0x21, 0x4b, 0x61, 0xe7, 0x53, 0xa4, 0x1f, 0xd3, 0xc4, 0x0c, 0x60, 0x7c, 0xd8,
+    0x16, 0xbf, 0x43, 0xd1, 0x88, 0x2c, 0xe5, 0x83, 0x3e, 0xb3, 0xd7, 0x0c, 0x2f, 0x21, 0x10, 0xe4,
+    0x15, 0x6a, 0x60, 0xa0, 0xe5, 0xcc, 0x7c, 0x26, 0xb2, 0x69, 0x8d, 0x95, 0x67, 0x79, 0xe9, 0xe4,
+    0x85, 0x7c, 0x0d, 0xa1, 0x34, 0x6e, 0x80, 0xf7, 0x63, 0x29, 0x0e, 0x31, 0xd5, 0xd4, 0x29, 0x6d,
+    0xf1, 0xb4, 0xf1, 0x93, 0x2b, 0x31, 0xa2, 0xb3, 0x27, 0x78, 0xa7, 0x97, 0xf1, 0x23, 0x87, 0x63,
+    0x01, 0x97, 0x96, 0xd6, 0x2c, 0x25, 0xbc, 0x56, 0x51, 0x76, 0xf3, 0x9e, 0xe1, 0xdf, 0xc3, 0x73,
+    0xe7, 0xac, 0x8f, 0x98, 0xe1, 0x70, 0xae, 0xa8, 0xc5, 0xdd, 0xe4, 0x6c, 0x72, 0x2f, 0xcf, 0x9e,
+    0x25, 0xfa, 0x63, 0xff, 0x1b, 0x2c, 0x7a, 0x07, 0x44, 0xda, 0x76, 0xf1, 0x0b, 0x25, 0x34, 0xca,
+    0x30, 0x26, 0x43, 0x9e, 0xc2, 0xac, 0x6f, 0xff, 0xde, 0x70, 0x94, 0xc2, 0x46, 0xd9, 0xc4, 0xd6,
+    0x68, 0xaf, 0xa0, 0xca, 0x94, 0xbd, 0xfc, 0xd4, 0xf4, 0x51, 0x1c, 0xbd, 0xb2, 0xb2, 0xdf, 0xbd,
+    0xce, 0xed, 0x5b, 0xc8, 0xcc, 0xbf, 0x46, 0x4d, 0xb2, 0xb9, 0xc8, 0x5b, 0x71, 0xd4, 0x13, 0x27,
+    0xe9, 0x11, 0x5a, 0x8c, 0xbc, 0x2b, 0x58, 0x03, 0x1d, 0x85, 0x6f, 0x6b, 0xdc, 0xbb, 0xc6, 0x27,
+    0x8c, 0x9f, 0x82, 0x93, 0x37, 0x3a, 0x5e, 0x23, 0x83, 0x6d, 0x95, 0x20, 0xc6, 0x62, 0x5c, 0x5e,
+    0xaa, 0x24, 0xd4, 0xa9, 0x67, 0x97, 0x92, 0x3b, 0x3d, 0x55, 0xe0, 0x88, 0x6b, 0xdc, 0x70, 0x2c,
+    0x60, 0x18, 0x0e, 0xbc, 0xeb, 0x3f, 0x28, 0xf8, 0xa0, 0xff, 0x56, 0xb5, 0xf1, 0xe1, 0xc6, 0xe3,
+    0x65, 0x1c, 0x5f, 0xab, 0x3c, 0x2d, 0x94, 0xa7, 0x59, 0x1a, 0xcc, 0x17, 0xfb, 0x29, 0xc9, 0x0b,
+    0xab, 0x6c, 0x7a, 0xf8, 0xf1, 0xcb, 0x5c, 0x4a, 0x8f, 0xe5, 0xa9, 0x58, 0x69, 0xf3, 0xd2, 0x5a,
+    0x63, 0xd0, 0x45, 0x51, 0xcf, 0x2c, 0xec, 0x65, 0x7d, 0xdd, 0xcc, 0xdf, 0x80, 0x46, 0x7d, 0x5d,
+    0x73, 0x98, 0x34, 0x2c, 0xe4, 0x1f, 0x0e, 0xa4, 0xfc, 0x85, 0x03, 0x93, 0x4e, 0x8e, 0x89, 0x1d,
+    0xe4, 0x4b, 0xa8, 0x58, 0x66, 0x0a, 0xa8, 0x84, 0xdc, 0x3d, 0x6b, 0x09, 0x8f, 0x1d, 0x24, 0x5d,
+    0x56, 0x3e, 0x9d, 0x88, 0x18, 0xdd, 0x1c, 0x1a, 0xdf, 0x59, 0x9c, 0x0f, 0xcc, 0x08, 0x3a, 0x7f,
+    0x33, 0xef, 0x79, 0x44, 0x6c, 0x8b, 0x96, 0x7d, 0xb8, 0xb3, 0xfa, 0x95, 0xb8, 0xbe, 0x32, 0xb8,
+    0x51, 0xa9, 0xf5, 0x95, 0xa0, 0x47, 0x69, 0x25, 0x59, 0x6b, 0x7e, 0xe0, 0x92, 0x17, 0x67, 0x79,
+    0xb5, 0xb9, 0x90, 0xd3, 0xf3, 0xbc, 0x17, 0xc2, 0x68, 0x97, 0x83, 0x25, 0x9e, 0xf1, 0x9a, 0xa7,
+    0xc1, 0x01, 0x42, 0xe0, 0x92, 0xc4, 0x50, 0xa0, 0x82, 0x6f, 0x18, 0x2e, 0xc1, 0x13, 0xa7, 0x28,
+    0x22, 0xb2, 0x1b, 0xaf, 0x6b, 0xe8, 0x1a, 0xbf, 0xc9, 0xdb, 0x3b, 0x39, 0x75, 0x79, 0xfd, 0x59,
+    0x30, 0x97, 0x3e, 0x0e, 0xf1, 0x8e, 0x42, 0x11, 0xf5, 0xc9, 0xc1, 0xd2, 0x90, 0x0f, 0xf5, 0xf7,
+    0xb9, 0x2e, 0xcd, 0xcc, 0xfc, 0xe3, 0x5c, 0x18, 0x5a, 0xcc, 0xc5, 0xe8, 0x7b, 0x34, 0xd3, 0xfc,
+    0x96, 0x50, 0x23, 0xca, 0xc0, 0xa2, 0x32, 0xf4, 0xda, 0xf5, 0xc9, 0x13, 0x7d, 0x91, 0x82, 0xa8,
+    0x1f, 0x0b, 0xce, 0x95, 0xb4, 0x77, 0x68, 0x94, 0x95, 0xda, 0xe3, 0x12, 0x4b, 0x58, 0x1b, 0xd3,
+    0xec, 0x56, 0xf4, 0xaa, 0x7f, 0xfd, 0x9e, 0x3a, 0x2e, 0xf9, 0xba, 0xbc, 0xdf, 0x43, 0xe4, 0xf4,
+    0x3b, 0x2e, 0xa9, 0x18, 0x78, 0x3c, 0x7e, 0x48, 0x6b, 0xfc, 0xfe, 0xc9, 0xa7, 0xd0, 0xe6, 0x0d,
+    0xe2, 0xc9, 0xdf, 0xde, 0x01, 0xc1, 0x00, 0x25, 0x56, 0x35, 0x63, 0xfe, 0x30, 0x38, 0x9f, 0x23,
+    0x8d, 0xa1, 0xbb, 0x60, 0x54, 0x33, 0xe2, 0x27, 0x25, 0x9b, 0xa0, 0xfd, 0xa9, 0xf0, 0x15, 0x07,
+    0xf7, 0x54, 0xde, 0x10, 0x3e, 0xc4, 0x81, 0xc5, 0x57, 0xf6, 0x7e, 0x52, 0xed, 0xe0, 0x34, 0x41,
+    0x53, 0x38, 0x7d, 0xae, 0xca, 0x7d, 0x59, 0xab, 0x92, 0x43, 0x6c, 0xfd, 0x9d, 0x7e, 0x63, 0x34,
+    0x6b, 0x3d, 0xfe, 0x8f, 0x5d, 0xa6, 0xa5, 0x93, 0x75, 0xb9, 0x93, 0xd6, 0x42, 0xe4, 0x12, 0xda,
+    0xac, 0x76, 0xef, 0xf5, 0x3f, 0x2d, 0x7c, 0xec, 0x9c, 0x31, 0x40, 0x9d, 0xb2, 0x95, 0xd6, 0xff,
+    0xf3, 0x67, 0xe6, 0x8e, 0x63, 0x4a, 0xbe, 0x05, 0xbd, 0x06, 0xcd, 0xce, 0xe7, 0x21, 0x27, 0xc7,
+    0xc5, 0x94, 0x89, 0x7f, 0x39, 0x70, 0x32, 0xb2, 0xec, 0x1b, 0x6c, 0xb4, 0xd1, 0xd3, 0x1a, 0x25,
+    0x13, 0x7b, 0xf0, 0x0a, 0x6d, 0x45, 0x7f, 0x32, 0xdc, 0xe4, 0x77, 0x61, 0xc9, 0x2e, 0xd4, 0x1b,
+    0x81, 0x1b, 0xfc, 0x34, 0x65, 0xbc, 0x67, 0xea, 0xd6, 0x5f, 0xb0, 0xa3, 0xc6, 0x1d, 0x2c, 0x82,
+    0x37, 0x17, 0x16, 0x5f, 0xd1, 0xf7, 0xba, 0x19, 0xae, 0xa3, 0x5d, 0x3e, 0xf3, 0xe1, 0x3a, 0xb3,
+    0x3d, 0x15, 0xc4, 0x73, 0x63, 0x9f, 0xe3, 0xfa, 0x8a, 0x62, 0x62, 0x48, 0xef, 0x1b, 0xde, 0x75,
+    0x5a, 0xb1, 0x62, 0xf6, 0x41, 0xfd, 0xe1, 0xd9, 0xac, 0xc3, 0xd3, 0x35, 0x54, 0x0b, 0x0b, 0xaf,
+    0xae, 0xc1, 0x44, 0x15, 0xa1, 0x8e, 0x5a, 0x32, 0x6b, 0x0e, 0x6b, 0xf0, 0x80, 0x17, 0xfc, 0x2e,
+    0x94, 0x9b, 0x4b, 0xc0, 0x99, 0xe3, 0x70, 0xa5, 0x7b, 0x2c, 0xa8, 0x6d, 0x51, 0xfb, 0xe7, 0xb8,
+    0x93, 0x52, 0xb9, 0xe0, 0x2e, 0xf5, 0x77, 0x3e, 0xa2, 0x6f, 0x5e, 0x99, 0x50, 0x5e, 0x53, 0x23,
+    0xa1, 0x76, 0xfd, 0xe9, 0xd4, 0xb1, 0xc5, 0x04, 0xca, 0x90, 0xfe, 0xba, 0x6e, 0x49, 0x63, 0x08,
+    0x77, 0x4d, 0x4f, 0x20, 0x79, 0xd2, 0xe5, 0xcf, 0x7f, 0xce, 0x4d, 0xea, 0xc7, 0x2f, 0x58, 0xad,
+    0xd3, 0x5e, 0xa1, 0xa4, 0x64, 0x5a, 0xab, 0xdd, 0xab, 0xb4, 0xf1, 0x4f, 0x24, 0xfb, 0x1d, 0xef,
+    0x23, 0x1e, 0x06, 0xc9, 0x84, 0x9e, 0x76, 0x23, 0x35, 0x89, 0x29, 0xdd, 0x9d, 0x7b, 0xae, 0x27,
+    0xd5, 0x49, 0xb5, 0xb7, 0xdc, 0x91, 0xa3, 0xca, 0x10, 0x39, 0x33, 0x36, 0x06, 0xe1, 0xa2, 0x51,
+    0x93, 0xe3, 0xf1, 0xd4, 0x03, 0xec, 0x2f, 0x69, 0xe9, 0x19, 0x78, 0x2c, 0xee, 0x85, 0xdb, 0x2c,
+    0x6b, 0xf1, 0x91, 0x2d, 0xf0, 0x13, 0xa8, 0xe0, 0xec, 0xa0, 0xe8, 0x53, 0xca, 0x25, 0x9a, 0x30,
+    0xac, 0x43, 0x85, 0x3e, 0xf5, 0xe5, 0x73, 0x9a, 0xde, 0x8c, 0x6b, 0x38, 0xac, 0x73, 0xae, 0x51,
+    0x36, 0x7a, 0x39, 0x37, 0x2e, 0xe0, 0xe6, 0x99, 0x61, 0x36, 0xe8, 0x9c, 0x43, 0x2e, 0xae, 0xf8,
+    0x10, 0x75, 0x5d, 0x58, 0x32, 0xbb, 0xf8, 0xf9, 0x7b, 0x6a, 0x3a, 0xc9, 0xac, 0xbf, 0xbb, 0xa0,
+    0x57, 0x8f, 0xc0, 0xf4, 0x0b, 0xa2, 0xea, 0xf3, 0xed, 0x27, 0x53, 0xc2, 0xa9, 0xd5, 0xdf, 0x6c,
+    0xe8, 0x58, 0xb7, 0x28, 0x91, 0x17, 0x3e, 0x5f, 0xe3, 0xee, 0x60, 0x23, 0xde, 0x75, 0x3c, 0x2a,
+    0x6e, 0xde, 0x95, 0xa2, 0x98, 0x8e, 0x9e, 0x42, 0xb8, 0x50, 0x87, 0x0e, 0xa8, 0x6b, 0xd0, 0x5a,
+    0x0f, 0x58, 0x28, 0xa6, 0x0f, 0x14, 0xe1, 0xe7, 0x59, 0x4c, 0xbf, 0x88, 0xec, 0x19, 0x1e, 0x09,
+    0xe1, 0x13, 0xca, 0xa8, 0xd8, 0x2a, 0x73, 0xd3, 0xc9, 0x74, 0xd8, 0xa0, 0x6f, 0xfa, 0x68, 0x90,
+    0xbd, 0xd9, 0xc5, 0x4d, 0xb6, 0x23, 0x6f, 0x57, 0x4e, 0x60, 0x7f, 0xec, 0x96, 0xf1, 0x0e, 0x53,
+    0xf2, 0x80, 0x09, 0x32, 0xe6, 0x50, 0xa4, 0xf1, 0x74, 0x3c, 0xe0, 0xb2, 0x6f, 0x1e, 0x22, 0xd9,
+    0x21, 0x78, 0xf4, 0x6c, 0xf0, 0x83, 0xaa, 0xdb, 0xdd, 0x1f, 0xff, 0xdf, 0x09, 0x06, 0xd6, 0xe3,
+    0x88, 0x6a, 0xfb, 0x16, 0x30, 0xfe, 0x34, 0x8a, 0x83, 0xb8, 0xba, 0x4a, 0x7c, 0x82, 0x4e, 0xdd,
+    0xf3, 0xa9, 0x13, 0x4f, 0xf9, 0xb0, 0xaf, 0xc1, 0xf9, 0x02, 0x7a, 0xbf, 0xea, 0xb8, 0xce, 0xae,
+    0xce, 0x44, 0xd1, 0xad, 0x1b, 0x3b, 0x02, 0x0f, 0x8d, 0x6b, 0xeb, 0x9d, 0x0e, 0x2f, 0xaf, 0x3b,
+    0xa9, 0xda, 0x10, 0xf8, 0x2a, 0x1e, 0x34, 0x42, 0x31, 0x7d, 0xb9, 0xc5, 0x9f, 0x83, 0x5a, 0x59,
+    0x64, 0x1a, 0x69, 0xb1, 0xc3, 0xf8, 0x48, 0xdc, 0xbf, 0xd2, 0xda, 0xa6, 0x84, 0x5b, 0x8b, 0x90,
+    0x7d, 0x7f, 0x30, 0x76, 0x99, 0x11, 0x26, 0x6d, 0x15, 0x5f, 0xde, 0xc0, 0x90, 0x1b, 0x98, 0xa2,
+    0xc3, 0x1d, 0x35, 0x20, 0x4f, 0xa9, 0x6e, 0x0d, 0x41, 0xc0, 0xd6, 0x19, 0x3a, 0xe1, 0x65, 0x32,
+    0x46, 0x31, 0x18, 0xf7, 0xe7, 0x63, 0x16, 0xc5, 0xa0, 0x90, 0x2a, 0x4b, 0x83, 0xce, 0x8f, 0x11,
+    0x47, 0xca, 0x7c, 0x66, 0x35, 0xc8, 0xb1, 0x0f, 0xf9, 0xfb, 0xad, 0x96, 0x79, 0x92, 0xbd, 0xc0,
+    0x50, 0x69, 0xe1, 0x24, 0xe2, 0xd5, 0xa3, 0xc5, 0x99, 0x56, 0x79, 0x94, 0xab, 0x3a, 0x16, 0xba,
+    0x99, 0xe3, 0xd8, 0x9d, 0xc5, 0x16, 0x2d, 0x01, 0x7e, 0xba, 0xa4, 0x81, 0x46, 0x29, 0x84, 0xdf,
+    0x6e, 0x49, 0xf2, 0xdf, 0x1a, 0xaa, 0x26, 0xeb, 0x4b, 0x29, 0xef, 0xbb, 0x13, 0x48, 0x0b, 0x7f,
+    0x1b, 0xa7, 0x7a, 0x51, 0x35, 0x8b, 0xe4, 0x2f, 0x52, 0xd3, 0x21, 0x1d, 0xea, 0xed, 0xb8, 0x88,
+    0x0c, 0x21, 0xc2, 0x57, 0xe8, 0x99, 0x54, 0x0a, 0x44, 0x29, 0xc3, 0x15, 0xc8, 0x75, 0x93, 0x99,
+    0x67, 0x13, 0x47, 0x59, 0x6b, 0xef, 0xde, 0x1a, 0x6f, 0x4b, 0x12, 0xed, 0x54, 0x54, 0x69, 0xfd,
+    0x1b, 0x84, 0xbb, 0xb8, 0xe0, 0xb8, 0x6c, 0x51, 0xd0, 0x7c, 0x7e, 0x9b, 0x86, 0x85, 0xaf, 0x42,
+    0xda, 0xdc, 0x64, 0xb5, 0x34, 0x96, 0x51, 0x4b, 0x28, 0x41, 0xae, 0x4a, 0x17, 0x71, 0xe6, 0xbe,
+    0xef, 0x4a, 0x0a, 0x4d, 0xb9, 0xfb, 0x6c, 0x41, 0xa8, 0xf8, 0xf9, 0x9d, 0x56, 0xc3, 0x46, 0x66,
+    0x78, 0x1f, 0xc7, 0x6a, 0x9b, 0xaf, 0xb8, 0x33, 0xa1, 0x85, 0xe7, 0xee, 0x35, 0x2d, 0x2e, 0x62,
+    0xc4, 0xd2, 0x6b, 0x44, 0x90, 0xf5, 0xb9, 0x2b, 0xd6, 0x9a, 0x8b, 0xd0, 0x76, 0xe4, 0xae, 0xc9,
+    0x33, 0xa7, 0x2d, 0x54, 0x65, 0x4d, 0x29, 0x47, 0x1b, 0xa7, 0x0d, 0xfa, 0x69, 0x93, 0x2c, 0xb6,
+    0x53, 0x70, 0xf4, 0x78, 0xa9, 0x4d, 0x23, 0x9a, 0x3e, 0x33, 0x62, 0x8a, 0xc8, 0x75, 0x76, 0x04,
+    0x2f, 0x6b, 0xd4, 0x4b, 0xb2, 0xb4, 0x5b, 0xee, 0x98, 0x5c, 0x60, 0xae, 0x43, 0x76, 0x4b, 0x97,
+    0xe9, 0x51, 0xda, 0x2d, 0xd4, 0x6e, 0x09, 0x74, 0x3e, 0x0b, 0xa3, 0xf7, 0xd7, 0x6f, 0xdc, 0xa3,
+    0x66, 0x23, 0xfb, 0xa2, 0x54, 0x99, 0x79, 0x9e, 0xba, 0xb5, 0x88, 0xcf, 0x11, 0x51, 0x16, 0xde,
+    0x83, 0x67, 0x57, 0x5e, 0x71, 0xbd, 0x1c, 0xc6, 0x4f, 0x8d, 0x08, 0x4f, 0xdd, 0xff, 0x7e, 0x0e,
+    0x7a, 0x5e, 0xc3, 0x7e, 0x7d, 0x3b, 0xba, 0x1c, 0x0d, 0xaf, 0xe6, 0xb2, 0x93, 0x74, 0x86, 0xf8,
+    0xab, 0xa1, 0xbf, 0x48, 0x86, 0x38, 0xb3, 0xd3, 0x23, 0xa7, 0xee, 0xfe, 0x1a, 0x18, 0xd1, 0xc2,
+    0x50, 0x63, 0x29, 0xa4, 0x53, 0xf2, 0x67, 0x7c, 0x92, 0x9c, 0x5f, 0x90, 0x91, 0xa8, 0x58, 0x46,
+    0x9d, 0x2f, 0xa8, 0x61, 0xc4, 0x54, 0x7c, 0x78, 0x09, 0x49, 0x0e, 0xaf, 0x48, 0xe6, 0xc3, 0x65,
+    0x41, 0x86, 0x83, 0x77, 0x80, 0xae, 0x45, 0xa0, 0x99, 0xfb, 0x47, 0x48, 0xea, 0x89, 0xf4, 0x45,
+    0xd7, 0xee, 0x5e, 0x19, 0x8f, 0xd8, 0x4c, 0x6c, 0x7e, 0x4e, 0x56, 0xe3, 0x73, 0xc1, 0xe6, 0xef,
+    0x42, 0x76, 0x8f, 0xa4, 0xa8, 0xba, 0x42, 0x61, 0xd6, 0x26, 0x35, 0x74, 0x7a, 0x0c, 0x1f, 0xb4,
+    0x30, 0x12, 0x85, 0x43, 0x6d, 0xb4, 0xa3, 0x0a, 0x46, 0x24, 0x79, 0x27, 0xe0, 0x9b, 0x29, 0x56,
+    0x31, 0x90, 0xcb, 0xb4, 0xfb, 0xd9, 0xe6, 0xdf, 0x6f, 0xc1, 0x7e, 0xb8, 0x49, 0x2a, 0xf5, 0xfc,
+    0x4c, 0x41, 0xa0, 0xfc, 0x13, 0x9e, 0xfd, 0x9b, 0xca, 0xba, 0xa2, 0x36, 0xdd, 0x30, 0x83, 0x37,
+    0x2e, 0x06, 0xd9, 0x50, 0xcb, 0x24, 0x6c, 0x23, 0x7e, 0x8a, 0x6e, 0x96, 0xe3, 0x9f, 0xe7, 0x34,
+    0x79, 0x68, 0x5c, 0x0d, 0x0a, 0x93, 0xb3, 0x42, 0xf8, 0x14, 0xe3, 0xc4, 0xc1, 0x29, 0xc1, 0xd4,
+    0xc3, 0xa9, 0x4e, 0xf2, 0x7b, 0x8b, 0x00, 0xb6, 0x49, 0xf7, 0x03, 0xd8, 0x72, 0x7e, 0x43, 0x65,
+    0xbd, 0x71, 0x1d, 0xf3, 0x20, 0x04, 0x69, 0xfb, 0x4e, 0xc7, 0xf4, 0x6d, 0xb1, 0xed, 0xaf, 0x2e,
+    0x31, 0x6f, 0x34, 0xee, 0xfb, 0x8d, 0xab, 0x0f, 0xe3, 0x47, 0x2d, 0x96, 0xfb, 0xf8, 0xd2, 0x9a,
+    0x6e, 0xf8, 0xee, 0xcc, 0x78, 0x92, 0x0c, 0x9f, 0x69, 0x6d, 0x87, 0xb9, 0x8d, 0x27, 0x10, 0x5d,
+    0x5b, 0x9a, 0x7f, 0x09, 0x4a, 0xfb, 0x5e, 0x93, 0xdd, 0x4e, 0x49, 0x14, 0xe5, 0x3e, 0xa1, 0x2b,
+    0xf3, 0x6a, 0xb6, 0x28, 0xfa, 0x56, 0xbe, 0x8e, 0x43, 0x04, 0x3e, 0xaa, 0x1c, 0x17, 0xcc, 0xee,
+    0x35, 0x78, 0xaa, 0xd9, 0x92, 0x54, 0x61, 0xb8, 0xfd, 0x1b, 0xce, 0x15, 0xf6, 0x53, 0x3f, 0x74,
+    0x8b, 0xaf, 0xce, 0x62, 0xda, 0x49, 0x28, 0x8d, 0x0a, 0xda, 0xc8, 0xd3, 0x32, 0x68, 0xf7, 0xf4,
+    0xcd, 0x82, 0xed, 0xe1, 0x0e, 0xd7, 0x73, 0x55, 0x37, 0x77, 0xde, 0x10, 0x4f, 0x0f, 0xf4, 0x12,
+    0x99, 0x87, 0x20, 0xbc, 0x36, 0x3c, 0x89, 0xc8, 0xa5, 0xaf, 0x91, 0x8c, 0xe7, 0x9b, 0x1e, 0x9d,
+    0xbd, 0x1a, 0xb0, 0x57, 0x94, 0x22, 0xec, 0x23, 0x0d, 0xf7, 0x82, 0xbc, 0x57, 0x83, 0xce, 0x18,
+    0x35, 0x94, 0x90, 0x18, 0xde, 0x88, 0x62, 0x60, 0x67, 0x6c, 0xfe, 0x47, 0x73, 0x75, 0x97, 0x97,
+    0x1b, 0xd5, 0x15, 0x82, 0x3e, 0xf4, 0xce, 0x57, 0x8b, 0xe1, 0x3b, 0xc3, 0x8f, 0xb0, 0x10, 0x4d,
+    0x7f, 0xa6, 0xc6, 0x20, 0xeb, 0x3f, 0xee, 0x43, 0x85, 0x50, 0x70, 0x5e, 0x8b, 0x2b, 0xb9, 0x30,
+    0x67, 0xcd, 0xcc, 0xb0, 0x87, 0xc9, 0x7e, 0xb8, 0xdc, 0xca, 0xa4, 0x58, 0x89, 0x42, 0x1a, 0x93,
+    0xee, 0x8c, 0x4c, 0xc7, 0xc4, 0xe7, 0x9d, 0x0f, 0xa8, 0xff, 0x1a, 0xf8, 0xb3, 0x47, 0x33, 0x14,
+    0xf5, 0xbf, 0x22, 0x5b, 0x6a, 0x53, 0xa9, 0x9e, 0xb0, 0xbe, 0x1f, 0xae, 0xc7, 0x18, 0xc2, 0x4e,
+    0x70, 0xe6, 0x33, 0x39, 0x2a, 0x11, 0xee, 0x92, 0xc2, 0xee, 0xd1, 0xc1, 0x18, 0xb8, 0x29, 0xb8,
+    0xed, 0xda, 0xd1, 0x16, 0x1f, 0x68, 0x4b, 0x0d, 0x96, 0x34, 0xb9, 0xb5, 0x7f, 0x24, 0xf8, 0x62,
+    0x39, 0x9b, 0x80, 0xef, 0x95, 0x32, 0x3e, 0x61, 0x6e, 0x50, 0x88, 0x13, 0x75, 0xf5, 0x24, 0xba,
+    0xf2, 0x34, 0xdf, 0x7e, 0x39, 0x8b, 0xac, 0xb9, 0xc6, 0xf3, 0xda, 0xd8, 0x7c, 0xbd, 0xc8, 0xfb,
+    0x64, 0x06, 0x2b, 0xc7, 0xe8, 0xb7, 0xc0, 0x04, 0x95, 0xf7, 0x21, 0x5c, 0x94, 0xed, 0x26, 0xc1,
+    0xd9, 0xf0, 0xd7, 0x55, 0x79, 0xf8, 0x62, 0xf6, 0x38, 0x8e, 0x08, 0x17, 0x04, 0x2d, 0x3d, 0x7b,
+    0xa2, 0x2a, 0x6f, 0x09, 0x72, 0x04, 0x61, 0x62, 0xd1, 0x8e, 0x71, 0x64, 0x4c, 0x5f, 0x74, 0xd0,
+    0x11, 0xbd, 0x01, 0xd3, 0xbb, 0x4c, 0x8d, 0xc4, 0x00, 0xe8, 0x67, 0x29, 0x43, 0xd4, 0xd1, 0xab,
+    0x76, 0xc7, 0xae, 0xe0, 0x87, 0xab, 0x9e, 0x43, 0xd6, 0x9b, 0xfb, 0x44, 0x8c, 0x6b, 0xf9, 0xda,
+    0x8d, 0x17, 0xec, 0x9a, 0x59, 0xbb, 0xd2, 0xf6, 0x60, 0xc9, 0x44, 0xdc, 0x4f, 0xb0, 0x78, 0xab,
+    0x71, 0x9d, 0x74, 0xd5, 0x57, 0x24, 0x64, 0x78, 0xc4, 0x45, 0xbd, 0xae, 0xb8, 0x96, 0x78, 0xa8,
+    0xb4, 0x63, 0x3d, 0x7b, 0xea, 0xde, 0xd3, 0x98, 0xbe, 0x76, 0x18, 0x6e, 0xf2, 0x6b, 0x52, 0xec,
+    0x4b, 0xb9, 0xc5, 0x61, 0xab, 0x68, 0x2e, 0x43, 0x19, 0xcd, 0x11, 0xdf, 0x19, 0x2f, 0xb3, 0xc9,
+    0x82, 0xca, 0x2c, 0x61, 0x58, 0x50, 0xeb, 0x44, 0x0d, 0x7b, 0xcb, 0xb7, 0x0a, 0xb4, 0x8f, 0x6b,
+    0x24, 0xe2, 0xcd, 0xf4, 0xaa, 0xd6, 0x27, 0xfc, 0x29, 0xdb, 0x27, 0xda, 0xe6, 0x8e, 0xf5, 0x13,
+    0xdd, 0x98, 0x22, 0x6d, 0xde, 0xe3, 0x18, 0xf8, 0xfb, 0x49, 0x5a, 0x71, 0xe1, 0xb5, 0x30, 0x89,
+    0x08, 0xdb, 0xfe, 0xe9, 0xb1, 0xe4, 0x4e, 0x9a, 0xee, 0xf3, 0xc7, 0xd3, 0x4b, 0x26, 0x2b, 0xf3,
+    0x20, 0xac, 0x91, 0x32, 0x27, 0x13, 0xf1, 0x66, 0x7f, 0x2a, 0xc6, 0xa2, 0xea, 0x83, 0x18, 0x8e,
+    0xda, 0x7e, 0x8a, 0xc0, 0xa1, 0x0a, 0x53, 0xf8, 0xbc, 0xde, 0x96, 0x0c, 0xf1, 0x08, 0xef, 0x5b,
+    0xa1, 0xf8, 0x0d, 0x82, 0xcb, 0xeb, 0x13, 0x29, 0x1e, 0x03, 0x51, 0x65, 0x83, 0x7a, 0x09, 0x39,
+    0x9f, 0xc8, 0xed, 0xb7, 0xa1, 0x2d, 0x7a, 0x54, 0xf4, 0x81, 0xbd, 0xd0, 0xfb, 0xba, 0xe7, 0x8f,
+    0x6a, 0xec, 0x3d, 0x64, 0x24, 0x0c, 0x4a, 0x5b, 0x3c, 0x64, 0xee, 0x6b, 0xd3, 0xb7, 0xe9, 0xef,
+    0xee, 0x0d, 0x8a, 0xee, 0xb6, 0x9c, 0xe2, 0x77, 0x7a, 0x2f, 0xaf, 0x0b, 0x8d, 0xb5, 0x7b, 0x75,
+    0xd9, 0xdf, 0x25, 0x21, 0xbd, 0x6c, 0x46, 0x42, 0xc3, 0x13, 0xc9, 0x3c, 0xd7, 0x38, 0xca, 0xd8,
+    0xd7, 0xe2, 0x29, 0x89, 0xa4, 0x50, 0xf3, 0xce, 0x3d, 0xc0, 0x8e, 0x8a, 0xb9, 0x2a, 0xf2, 0x67,
+    0xb1, 0x22, 0xcd, 0x4a, 0xec, 0x9b, 0x7f, 0x1a, 0x82, 0xc8, 0xcb, 0x84, 0x0f, 0x73, 0x26, 0x48,
+    0xe6, 0xb8, 0x8e, 0xbd, 0xdb, 0x33, 0x4d, 0x45, 0x2d, 0x7d, 0x90, 0xfe, 0x63, 0x8c, 0xf9, 0x6b,
+    0xc4, 0x26, 0xe7, 0x25, 0x73, 0xfa, 0x50, 0xf0, 0x5c, 0xf7, 0x63, 0x46, 0x1b, 0x45, 0xe2, 0x72,
+    0x6f, 0xa2, 0x8f, 0x4c, 0x67, 0x34, 0x55, 0xe5, 0x60, 0x30, 0x7b, 0x3f, 0x27, 0x67, 0x5a, 0x7a,
+    0x89, 0x8a, 0x42, 0xfc, 0xd5, 0x6c, 0xe9, 0x25, 0xde, 0x2d, 0x47, 0xbe, 0x2f, 0x14, 0xc5, 0xd5,
+    0xe2, 0x67, 0xd7, 0x40, 0x12, 0x5a, 0x6a, 0x51, 0x39, 0xcf, 0xab, 0x15, 0xc9, 0x51, 0x51, 0xb6,
+    0x54, 0x9d, 0x48, 0x12, 0x05, 0x73, 0x31, 0xaf, 0xe7, 0xac, 0x00, 0x46, 0x67, 0xf4, 0x4c, 0x68,
+    0xcc, 0x04, 0xa6, 0xb0, 0xe0, 0x01, 0x01, 0xbf, 0xc5, 0xcb, 0xa5, 0xdf, 0x47, 0x8f, 0x2c, 0xc9,
+    0x65, 0x69, 0x06, 0x39, 0x6c, 0x56, 0xb4, 0xea, 0x46, 0x0c, 0x9d, 0xef, 0x8e, 0xf4, 0x88, 0x10,
+    0x2d, 0xeb, 0x4a, 0x18, 0x91, 0x68, 0xd2, 0xb5, 0xa9, 0x84, 0x98, 0x19, 0x4f, 0xe6, 0xaa, 0xda,
+    0x4b, 0xc8, 0x11, 0x82, 0x8a, 0x1b, 0x0a, 0x19, 0xb8, 0x2d, 0xce, 0x78, 0x99, 0xba, 0x46, 0x37,
+    0x2c, 0x4e, 0xd8, 0xfc, 0x71, 0x1a, 0xfc, 0x32, 0xa0, 0x49, 0x0f, 0x06, 0xbe, 0x2b, 0x57, 0x65,
+    0x7b, 0x8c, 0x35, 0xab, 0x5f, 0x71, 0xab, 0x7c, 0x27, 0x73, 0xbe, 0x4e, 0x51, 0xd8, 0x75, 0xa2,
+    0xd9, 0x44, 0x67, 0x2a, 0x9b, 0x64, 0xc0, 0xe8, 0x66, 0xc2, 0xda, 0x95, 0x10, 0x24, 0x27, 0xcf,
+    0x71, 0xc5, 0x64, 0x63, 0xdc, 0x5c, 0x7e, 0x80, 0x92, 0x76, 0x35, 0xf4, 0xc2, 0x9e, 0xd8, 0x8f,
+    0xb0, 0xd7, 0xb9, 0x22, 0x86, 0x60, 0xf8, 0xd1, 0x6f, 0x76, 0x22, 0xed, 0x61, 0xc1, 0xe1, 0x77,
+    0x09, 0x37, 0x62, 0xd3, 0x6b, 0x7d, 0x25, 0xfc, 0x4a, 0xdc, 0x89, 0x60, 0x18, 0x23, 0xbe, 0x17,
+    0xaf, 0x4f, 0x55, 0xe7, 0xa9, 0xb0, 0x53, 0x25, 0xc9, 0x79, 0xf2, 0x3b, 0xe3, 0xa5, 0x13, 0x57,
+    0xb9, 0x90, 0xd5, 0x1c, 0x83, 0xfd, 0x9b, 0xdc, 0xe4, 0xda, 0x8e, 0x77, 0xdb, 0x9d, 0x32, 0x11,
+    0x6f, 0xcb, 0x60, 0xf5, 0x66, 0x40, 0x4c, 0x70, 0x18, 0x46, 0xb3, 0x3b, 0xfb, 0xba, 0xb6, 0x35,
+    0x8d, 0x35, 0xa6, 0x4e, 0xac, 0x81, 0x22, 0x1e, 0xc4, 0x67, 0x69, 0x31, 0xfb, 0xbb, 0x84, 0x6d,
+    0x7b, 0x82, 0x1f, 0x7e, 0x81, 0xe7, 0xb6, 0xbe, 0x30, 0xce, 0x44, 0x0c, 0x31, 0x72, 0x78, 0x6e,
+    0x7d, 0xe6, 0x54, 0x61, 0xa6, 0xa8, 0x09, 0xbf, 0x08, 0xcb, 0xab, 0x96, 0x92, 0x4a, 0x36, 0x38,
+    0xda, 0xd2, 0xb3, 0x0f, 0x32, 0xfc, 0xff, 0x72, 0x0d, 0x58, 0x6f, 0xc9, 0xfd, 0x94, 0xd8, 0x9e,
+    0x25, 0x39, 0x84, 0x54, 0x81, 0xb9, 0xdc, 0x3f, 0xad, 0x92, 0xda, 0x08, 0xd7, 0x0f, 0x7e, 0xf9,
+    0x6a, 0x30, 0x29, 0x1b, 0xe5, 0xd7, 0xc9, 0x93, 0x04, 0x11, 0x6e, 0x3b, 0xe2, 0x15, 0x8e, 0xba,
+    0x09, 0x29, 0xac, 0x51, 0x0d, 0xc7, 0x23, 0x79, 0x72, 0xa1, 0x60, 0xf9, 0x64, 0xc9, 0xff, 0xf8,
+    0x79, 0xd4, 0x32, 0xde, 0x4c, 0xa5, 0xfd, 0xf3, 0x47, 0x0c, 0x36, 0xf1, 0xa9, 0x1c, 0xd5, 0xf0,
+    0xf9, 0x93, 0x2f, 0x64, 0x73, 0xd6, 0x64, 0xe4, 0xc7, 0x12, 0xaa, 0x5d, 0xa3, 0xb2, 0x69, 0x47,
+    0x88, 0xf8, 0x5d, 0xa9, 0xda, 0xca, 0x74, 0x97, 0x55, 0x2b, 0x74, 0x59, 0xa4, 0xdc, 0xff, 0xda,
+    0x4e, 0x8c, 0x4d, 0x6c, 0xa1, 0xe1, 0x98, 0x36, 0xaf, 0xe8, 0x95, 0xa3, 0x9c, 0x37, 0xc8, 0xc4,
+    0xe6, 0xba, 0xf3, 0x34, 0x9c, 0xa8, 0xe5, 0x6d, 0x42, 0xac, 0x38, 0x83, 0x9c, 0x08, 0xec, 0xbc,
+    0xeb, 0x2b, 0x64, 0x1f, 0xda, 0x2d, 0xed, 0x83, 0x8f, 0x5a, 0x46, 0xd6, 0x1d, 0xec, 0x83, 0xc2,
+    0x18, 0xe8, 0x95, 0x2c, 0xa8, 0x6e, 0x64, 0x2f, 0xd0, 0x7e, 0x3c, 0xf6, 0x7e, 0x74, 0x7f, 0xc3,
+    0xeb, 0x7e, 0xb1, 0x17, 0xea, 0x09, 0xa1, 0x5e, 0x11, 0xc2, 0x10, 0xcb, 0x66, 0xf3, 0x86, 0xa5,
+    0x9d, 0xf8, 0x2e, 0xba, 0x55, 0x5e, 0x84, 0x20, 0xea, 0x59, 0x9c, 0x8f, 0xc8, 0x37, 0x25, 0x51,
+    0x5f, 0xc2, 0x08, 0x37, 0x6e, 0x61, 0x0b, 0x1f, 0xc2, 0xa0, 0xd7, 0xc4, 0x39, 0xfc, 0xfb, 0xec,
+    0x93, 0x77, 0xda, 0xcd, 0x65, 0x22, 0xe4, 0xab, 0x9f, 0x7a, 0x2f, 0x83, 0xbb, 0x96, 0x3a, 0x64,
+    0x9b, 0x8c, 0x3a, 0x8e, 0x3f, 0xc1, 0x61, 0x83, 0xb8, 0x6c, 0x84, 0x25, 0x73, 0xb2, 0xd4, 0x24,
+    0x37, 0x17, 0x51, 0x93, 0x8d, 0xb6, 0x2c, 0x2d, 0xc3, 0x21, 0xf7, 0xcc, 0x2f, 0x17, 0x11, 0x79,
+    0x2e, 0x83, 0x04, 0x2a, 0xc1, 0x2f, 0x3c, 0x27, 0xfb, 0x41, 0x15, 0x0e, 0x29, 0x31, 0x74, 0xa6,
+    0x3c, 0x59, 0x1c, 0x2c, 0x46, 0x93, 0xe3, 0xef, 0x1b, 0xa6, 0xbc, 0x1f, 0x42, 0x94, 0xf5, 0xf2,
+    0x36, 0x11, 0xd7, 0x6c, 0x4c, 0x72, 0x1a, 0x18, 0x60, 0xed, 0x84, 0x87, 0x1b, 0x57, 0x8d, 0xd0,
+    0x9b, 0x45, 0x0b, 0xa7, 0x6b, 0x2b, 0xf3, 0x62, 0x63, 0x4c, 0xb5, 0x14, 0x94, 0xcf, 0x6e, 0x9a,
+    0x7d, 0x34, 0x3f, 0x4e, 0x7f, 0xff, 0x65, 0x37, 0x32, 0x1b, 0x4b, 0x9c, 0x42, 0xf1, 0xab, 0x49,
+    0x6d, 0xa1, 0xd9, 0x20, 0x68, 0x33, 0x8c, 0x54, 0xd4, 0x9a, 0x8e, 0xfb, 0xd5, 0x9f, 0x2f, 0xb5,
+    0x4e, 0x36, 0x2f, 0xef, 0x41, 0x28, 0x21, 0xb2, 0x91, 0xa1, 0x21, 0x6d, 0xf4, 0xb1, 0xc5, 0x29,
+    0x2f, 0xc9, 0xd7, 0xdd, 0x29, 0x98, 0x00, 0x0d, 0xf7, 0x6d, 0xcf, 0x56, 0x33, 0x10, 0x5f, 0xb8,
+    0xd0, 0x5b, 0xd8, 0xbb, 0x9f, 0xb4, 0x41, 0x82, 0xc2, 0x9a, 0x9a, 0x75, 0xca, 0x32, 0x9f, 0xad,
+    0x7e, 0x3c, 0x2e, 0xf1, 0x7c, 0xbd, 0x02, 0x5d, 0xea, 0x9b, 0x29, 0xfe, 0xdd, 0xb0, 0x9d, 0x2c,
+    0x12, 0xa9, 0xbc, 0x12, 0xef, 0xcd, 0x72, 0xab, 0xc0, 0xcf, 0x99, 0x5d, 0xdc, 0x1e, 0x5a, 0x32,
+    0xcf, 0x6b, 0x06, 0x61, 0xb5, 0xad, 0x05, 0x51, 0x84, 0xb5, 0x84, 0x07, 0x3e, 0x88, 0xaf, 0x85,
+    0x42, 0xea, 0xe8, 0x18, 0x59, 0xd1, 0xc5, 0x6d, 0x57, 0x64, 0xa5, 0x64, 0x37, 0xa5, 0x9b, 0x95,
+    0x08, 0xf8, 0x65, 0xfe, 0xdf, 0xbc, 0xea, 0xae, 0x84, 0x38, 0xed, 0xf3, 0x2e, 0x8b, 0x32, 0xae,
+    0xf6, 0x4c, 0x30, 0x8f, 0x5d, 0x5a, 0x88, 0x56, 0x8f, 0x17, 0x7d, 0x98, 0x13, 0x1e, 0x1c, 0xe7,
+    0x5b, 0x5b, 0x4d, 0xa9, 0x76, 0x9d, 0x06, 0xfe, 0x5c, 0x34, 0xe7, 0xcb, 0x89, 0xb0, 0x8d, 0xe4,
+    0x6d, 0xe5, 0x1b, 0x72, 0xe5, 0x1f, 0x87, 0xf6, 0xb1, 0xf1, 0x4e, 0x97, 0xa8, 0xea, 0x55, 0xd1,
+    0x90, 0xd0, 0x74, 0x61, 0xfc, 0x3c, 0x38, 0xf3, 0x08, 0xd3, 0xd4, 0x17, 0xb6, 0xf6, 0xc6, 0xce,
+    0x82, 0x49, 0x24, 0x0b, 0x66, 0x34, 0xb4, 0x51, 0x87, 0xe2, 0x29, 0xaf, 0x46, 0x9c, 0x58, 0xfe,
+    0x60, 0x47, 0xff, 0x69, 0xc6, 0x7e, 0x08, 0x11, 0x6e, 0xb4, 0xd4, 0xe6, 0x93, 0x67, 0xaf, 0xba,
+    0x4b, 0xd7, 0xfb, 0x8e, 0x52, 0xf3, 0xdc, 0x12, 0xdc, 0x15, 0xc9, 0x46, 0xb4, 0x3d, 0xf8, 0x11,
+    0x0f, 0xd2, 0x91, 0x30, 0x4e, 0x9b, 0x84, 0xa1, 0x60, 0x3a, 0xb6, 0x9f, 0x69, 0x61, 0x83, 0x73,
+    0xf7, 0xc6, 0x7a, 0x1f, 0x36, 0x2b, 0xf6, 0x02, 0x4e, 0x7f, 0x95, 0xb8, 0xd3, 0x40, 0x8e, 0x8a,
+    0x97, 0x70, 0x75, 0x42, 0x5f, 0x1f, 0xd3, 0x50, 0x7f, 0x45, 0x85, 0xb1, 0xab, 0x2e, 0x61, 0x0a,
+    0x9a, 0xfa, 0x2d, 0x33, 0x55, 0x69, 0xa2, 0xa2, 0xf5, 0x79, 0x59, 0x69, 0x06, 0x1e, 0x0f, 0x22,
+    0xa5, 0x45, 0x44, 0x29, 0x14, 0x9b, 0xaa, 0x46, 0x9a, 0xd5, 0xf2, 0x6f, 0x97, 0x43, 0x9f, 0x63,
+    0x81, 0x63, 0xa3, 0xf2, 0x79, 0x87, 0x7b, 0x33, 0x8e, 0xf6, 0xc1, 0x11, 0xd1, 0x6d, 0x0b, 0xc5,
+    0xb5, 0xf5, 0x76, 0xb8, 0xd2, 0x1f, 0xbd, 0xc7, 0x5c, 0x08, 0x3d, 0x39, 0x09, 0xf9, 0x72, 0xf6,
+    0x3a, 0x1f, 0x03, 0x12, 0x31, 0xb9, 0x84, 0x01, 0x2f, 0xa9, 0xd9, 0x5a, 0x3c, 0xfa, 0x66, 0x37,
+    0xe8, 0xe4, 0x9f, 0x13, 0x6c, 0xa7, 0xb5, 0xd9, 0x50, 0x9c, 0x71, 0xc4, 0x8a, 0x51, 0x41, 0x62,
+    0xd9, 0x50, 0x3c, 0x09, 0x1f, 0x69, 0xb0, 0x74, 0xde, 0xf7, 0xb3, 0xb3, 0x43, 0x3b, 0x15, 0x27,
+    0x3d, 0x5e, 0xbd, 0x8e, 0x53, 0x7a, 0x53, 0x9a, 0x9a, 0x4f, 0xf1, 0x38, 0xa3, 0x3c, 0x50, 0xfe,
+    0xd8, 0x91, 0x1b, 0x22, 0xef, 0x09, 0xd4, 0xf2, 0xf0, 0xe4, 0xcb, 0x0f, 0x27, 0x24, 0xb8, 0x5b,
+    0x73, 0x25, 0x85, 0x48, 0xdf, 0x87, 0x5b, 0xdb, 0x60, 0x73, 0xc5, 0x14, 0xe2, 0x54, 0x6d, 0xa9,
+    0x1a, 0xf9, 0x46, 0x3f, 0x5a, 0xbd, 0x34, 0x90, 0x91, 0xff, 0x57, 0xb2, 0x82, 0x51, 0xa8, 0x19,
+    0xb7, 0xf7, 0xa4, 0xee, 0x20, 0xbb, 0xf0, 0x7d, 0x9f, 0x7c, 0xa0, 0xe1, 0x68, 0xc2, 0xc1, 0x6b,
+    0xdd, 0xc6, 0x1e, 0xea, 0x16, 0xd7, 0xa3, 0x0e, 0xbe, 0x78, 0x9f, 0xde, 0x9f, 0x8f, 0xfb, 0x0f,
+    0xf0, 0x0b, 0x26, 0xd6, 0x9b, 0x6f, 0x8b, 0xab, 0xfa, 0x1d, 0x77, 0x14, 0xce, 0x5e, 0x25, 0x10,
+    0x47, 0x12, 0x1f, 0x6d, 0xe0, 0xa8, 0x18, 0x51, 0x44, 0x58, 0x26, 0x35, 0x67, 0x0f, 0x48, 0x5d,
+    0x5e, 0x94, 0x56, 0xb2, 0xcd, 0x93, 0xfd, 0xed, 0x49, 0x7d, 0xf0, 0x69, 0x47, 0x5b, 0x48, 0xd1,
+    0x03, 0x06, 0x77, 0x9e, 0xe2, 0xef, 0x24, 0x2c, 0xb8, 0x4a, 0x43, 0xa0, 0x1a, 0x0b, 0x7e, 0x79,
+    0x2b, 0x18, 0x3f, 0x58, 0x64, 0x5e, 0xb4, 0xd4, 0xcd, 0xa7, 0x96, 0x57, 0x39, 0x2d, 0x30, 0x06,
+    0x96, 0xc9, 0x9f, 0x2e, 0x64, 0x51, 0x22, 0x3e, 0x75, 0xce, 0x6b, 0xfb, 0xf1, 0xe2, 0xa3, 0xbf,
+    0xa0, 0xaf, 0xbe, 0x4c, 0x5a, 0x1e, 0xeb, 0xe4, 0xa4, 0x37, 0x91, 0x32, 0x75, 0xa4, 0x7f, 0x09,
+    0xdf, 0xbd, 0x0e, 0xe8, 0xd9, 0x83, 0x9c, 0x78, 0x86, 0xeb, 0x52, 0xf8, 0x64, 0x1a, 0x74, 0x45,
+    0x59, 0x5f, 0x2e, 0x91, 0xb1, 0x69, 0x34, 0x7b, 0x61, 0xd2, 0x70, 0x28, 0x9f, 0xcb, 0x60, 0x7e,
+    0xdc, 0xa8, 0x4f, 0xc0, 0x22, 0x71, 0x9a, 0x54, 0x3e, 0x40, 0x35, 0xf8, 0x2f, 0xd1, 0x4a, 0x6a,
+    0x32, 0xe3, 0x4d, 0xb8, 0xe0, 0x3d, 0xbc, 0xbf, 0x74, 0x5c, 0x09, 0x86, 0xfa, 0x1a, 0xa3, 0x0c,
+    0xdc, 0xe5, 0xb7, 0xa1, 0x1b, 0x87, 0xe3, 0xa7, 0x6c, 0xb5, 0x3f, 0x7c, 0x7f, 0xf6, 0xe6, 0xea,
+    0xb0, 0x29, 0x31, 0x72, 0xd9, 0x99, 0xed, 0xa7, 0xa1, 0xb8, 0xaf, 0x67, 0x27, 0x6d, 0x18, 0x21,
+    0x1c, 0xea, 0xd9, 0xb7, 0x36, 0xd4, 0x2d, 0xd3, 0x8c, 0x63, 0xa1, 0xd1, 0x2d, 0x26, 0xb3, 0x50,
+    0x62, 0xb5, 0x83, 0x1f, 0xb8, 0x6e, 0x75, 0xcd, 0x45, 0x26, 0xbe, 0x07, 0x51, 0xc8, 0x5b, 0xfc,
+    0x7d, 0x91, 0x08, 0x34, 0x61, 0x22, 0x82, 0xbb, 0xc7, 0x45, 0x0a, 0x83, 0xd2, 0x36, 0x45, 0xdc,
+    0x25, 0x51, 0x34, 0x80, 0x18, 0xe3, 0x99, 0x81, 0xa0, 0xdb, 0x7f, 0x2b, 0xda, 0xcf, 0xb5, 0x50,
+    0xbd, 0x6f, 0x3d, 0xa6, 0xef, 0x12, 0x58, 0x23, 0x91, 0x5c, 0xed, 0xa2, 0x09, 0x31, 0xb6, 0xe2,
+    0xda, 0x8a, 0xba, 0xd1, 0x40, 0x0e, 0x7f, 0x44, 0x4d, 0x22, 0xa4, 0x4f, 0xbf, 0x81, 0x5b, 0x39,
+    0x86, 0x78, 0x37, 0xb1, 0xcf, 0xe7, 0xb6, 0x4c, 0x89, 0x84, 0xb9, 0xa4, 0x69, 0x2c, 0x27, 0x73,
+    0x27, 0xf3, 0xfa, 0x73, 0x21, 0x9b, 0x0c, 0x5f, 0x17, 0xfb, 0x1e, 0xb7, 0x3a, 0xba, 0xad, 0x67,
+    0xf6, 0x53, 0x12, 0x34, 0xa7, 0x74, 0xc6, 0x4d, 0x7f, 0x9c, 0x2e, 0xf9, 0x0f, 0x0a, 0xb7, 0x54,
+    0xa8, 0x1e, 0x32, 0xec, 0x4f, 0x7e, 0x6f, 0x68, 0x35, 0xf7, 0xd4, 0x43, 0xb0, 0xd9, 0xe9, 0xad,
+    0x7f, 0xa3, 0x9d, 0x5b, 0xcb, 0x16, 0xd9, 0x0f, 0x51, 0x3d, 0x4c, 0x18, 0x7f, 0x33, 0xd6, 0x6a,
+    0x10, 0xd0, 0xb2, 0xd4, 0xea, 0xbd, 0x1c, 0x58, 0x17, 0x2c, 0xb2, 0x3c, 0x11, 0xe2, 0x2d, 0x40,
+    0x2b, 0x24, 0x5e, 0x25, 0xfb, 0xba, 0x2e, 0x79, 0x13, 0x8c, 0xe5, 0x0a, 0x0c, 0x59, 0xb0, 0xa3,
+    0xc0, 0x26, 0xe5, 0x7e, 0x47, 0x5b, 0x7e, 0xa2, 0x09, 0x73, 0x0d, 0xdf, 0xbc, 0xfc, 0x36, 0x9d,
+    0x85, 0xe7, 0x70, 0x4e, 0xac, 0xf0, 0x59, 0xcc, 0x9c, 0x86, 0xf0, 0x83, 0xb9, 0xeb, 0x94, 0xc9,
+    0x86, 0x13, 0x5f, 0x43, 0x5a, 0x48, 0x55, 0x45, 0xe4, 0xd9, 0xe4, 0x42, 0x1b, 0x6e, 0xe4, 0x61,
+    0x66, 0x0f, 0xa3, 0x09, 0x09, 0x6f, 0x37, 0x7c, 0x86, 0x29, 0xc2, 0xcf, 0x23, 0xac, 0xe2, 0x47,
+    0xd5, 0x8a, 0x5e, 0x44, 0xff, 0xc3, 0x04, 0x78, 0x4d, 0xfd, 0xa5, 0x94, 0xf2, 0xc7, 0x82, 0xda,
+    0xf3, 0xf2, 0xd7, 0xa5, 0x2e, 0x22, 0xe7, 0x35, 0xb9, 0xf6, 0x18, 0x59, 0x26, 0x12, 0xd5, 0xf1,
+    0xea, 0x95, 0x9c, 0x43, 0x7e, 0xab, 0x5f, 0x16, 0xdd, 0x34, 0xcf, 0x0d, 0x9f, 0x15, 0x78, 0x53,
+    0x65, 0x3c, 0xb3, 0x25, 0x20, 0x30, 0x7c, 0x4c, 0xf9, 0xbc, 0xfc, 0x8a, 0x44, 0x6f, 0xe5, 0xc3,
+    0x0d, 0x18, 0xb7, 0xec, 0x31, 0x82, 0x26, 0x36, 0xaf, 0xd4, 0xcd, 0x8f, 0x8d, 0xa7, 0x92, 0x0e,
+    0x3b, 0xcd, 0x32, 0xc6, 0x38, 0xb5, 0xd7, 0x47, 0xf9, 0x62, 0xa7, 0x7b, 0x06, 0x77, 0x94, 0xb0,
+    0x8e, 0xe9, 0xb3, 0x0e, 0x89, 0x3d, 0x64, 0xa5, 0xaa, 0xca, 0x88, 0x9d, 0xfb, 0x56, 0x8e, 0xc2,
+    0x83, 0x67, 0x99, 0x9e, 0x91, 0xf9, 0x15, 0x34, 0xe2, 0x9d, 0x67, 0x9b, 0xbf, 0xef, 0xa0, 0x79,
+    0xaa, 0xfe, 0x1e, 0x58, 0x9b, 0xa3, 0xbf, 0x56, 0x5d, 0xb9, 0xc2, 0x37, 0x29, 0x91, 0xc5, 0xc8,
+    0x7b, 0xb5, 0x78, 0x57, 0x1f, 0x81, 0xef, 0x38, 0x98, 0xd6, 0xef, 0xd2, 0x63, 0x05, 0x3d, 0x65,
+    0x17, 0x54, 0xe9, 0x68, 0x38, 0xbe, 0xe3, 0x4b, 0x8c, 0x29, 0x84, 0xe6, 0x9c, 0xb0, 0x20, 0x02,
+    0x2d, 0x69, 0xe8, 0x19, 0x6b, 0x3f, 0x05, 0x45, 0x9c, 0x52, 0x7b, 0x33, 0x4d, 0x70, 0xd8, 0x1a,
+    0x18, 0x52, 0x48, 0xfd, 0x97, 0xe0, 0x9f, 0xb6, 0xae, 0x47, 0xe5, 0xb3, 0xe2, 0x4b, 0x75, 0xcb,
+    0x81, 0xd1, 0x0c, 0x92, 0x50, 0xac, 0x89, 0x8c, 0xd2, 0xb0, 0x1d, 0x96, 0x31, 0x3c, 0xfd, 0x0d,
+    0x35, 0x25, 0xa3, 0xa4, 0x7e, 0x17, 0x84, 0xb0, 0x36, 0x85, 0x53, 0x71, 0x13, 0x0e, 0x99, 0xb5,
+    0x00, 0x0d, 0x0e, 0xed, 0x58, 0x6c, 0xc2, 0x06, 0x07, 0x27, 0xc7, 0xed, 0x17, 0xec, 0xf2, 0x71,
+    0x92, 0x81, 0xe3, 0xb5, 0xa5, 0xaa, 0xb0, 0x86, 0xa0, 0xfa, 0x18, 0x1d, 0x29, 0x7f, 0x3f, 0x15,
+    0xcf, 0x85, 0x9c, 0xaf, 0x6e, 0xaa, 0xc8, 0x86, 0x6c, 0x8d, 0x91, 0x5d, 0x04, 0xa2, 0xb8, 0x14,
+    0x3b, 0x5b, 0x36, 0x64, 0xf5, 0xcc, 0x06, 0x32, 0x25, 0x76, 0xb4, 0x4a, 0xc3, 0x50, 0x26, 0xd9,
+    0xc3, 0x32, 0x1d, 0x11, 0x70, 0xe9, 0x62, 0xdb, 0x04, 0x73, 0xaf, 0x46, 0x72, 0x7e, 0xb0, 0xce,
+    0xe3, 0x9c, 0x8d, 0x7a, 0x1a, 0xb8, 0xd8, 0x5e, 0xd6, 0xb4, 0xdd, 0x05, 0x8d, 0x27, 0x8b, 0x74,
+    0x2d, 0xda, 0xbe, 0x73, 0x1a, 0xda, 0xc4, 0x75, 0x74, 0xd9, 0x54, 0x75, 0xd0, 0x52, 0x84, 0x4c,
+    0x4f, 0xf3, 0xbb, 0x66, 0xfb, 0x6b, 0xc4, 0x62, 0x08, 0x54, 0xd5, 0xc9, 0x2a, 0x8e, 0x37, 0x22,
+    0x76, 0x4d, 0xe3, 0x18, 0xef, 0x4b, 0x0c, 0x62, 0xb2, 0xcf, 0x23, 0x0f, 0xa1, 0x3e, 0xf5, 0x7a,
+    0x97, 0x30, 0xae, 0xe4, 0x3c, 0xe4, 0x31, 0x55, 0x2a, 0x8b, 0xfc, 0x20, 0xe5, 0xa0, 0x8a, 0x5f,
+    0xb4, 0xb1, 0x52, 0x2e, 0xc9, 0x9b, 0xd0, 0x94, 0xc5, 0x0b, 0x39, 0xbb, 0x0d, 0x5a, 0xa9, 0xf7,
+    0x55, 0xfe, 0xe2, 0x98, 0xb7, 0xa2, 0x6e, 0xe8, 0xe1, 0xed, 0x9e, 0xa6, 0x15, 0xc5, 0xd5, 0x1e,
+    0xe0, 0x36, 0x5b, 0xe8, 0xc0, 0xe2, 0x9f, 0x9d, 0xfe, 0x68, 0x40, 0xda, 0xce, 0x0c, 0x51, 0x9f,
+    0x7b, 0x91, 0x30, 0x5f, 0x6f, 0xa9, 0x68, 0xff, 0x36, 0xf5, 0x92, 0x0e, 0x9f, 0x3f, 0x5f, 0xc6,
+    0x2d, 0x8e, 0x9c, 0xca, 0xd2, 0x9e, 0xae, 0xab, 0xaf, 0x6a, 0x9b, 0xf3, 0x95, 0x56, 0xe0, 0x1b,
+    0x9d, 0x9f, 0x98, 0x26, 0x3a, 0xdb, 0x5c, 0x51, 0x19, 0x52, 0xef, 0x76, 0x32, 0xdc, 0x1c, 0x01,
+    0x2c, 0x5f, 0x68, 0x6a, 0x82, 0x7a, 0x56, 0xf1, 0xfc, 0x0e, 0xf2, 0x17, 0xe6, 0x7c, 0x36, 0xbb,
+    0x19, 0x45, 0x43, 0x9d, 0x60, 0x18, 0x7f, 0x48, 0x2b, 0xd6, 0xa9, 0x12, 0xad, 0xbe, 0x6f, 0xf8,
+    0xc7, 0xd3, 0x18, 0xf3, 0xa8, 0x82, 0xbe, 0xab, 0xf0, 0x8b, 0x1e, 0x05, 0x76, 0xb3, 0x93, 0x85,
+    0x8c, 0x97, 0xdb, 0x9e, 0xf0, 0x7f, 0x66, 0xa0, 0x39, 0x35, 0xb5, 0x68, 0x47, 0xae, 0x89, 0x7c,
+    0xab, 0xd5, 0xe8, 0xfd, 0x6d, 0x07, 0xc4, 0xa7, 0x6e, 0xaf, 0x39, 0x0b, 0x9c, 0x59, 0x28, 0x75,
+    0xad, 0x46, 0x54, 0xa5, 0x5a, 0x5d, 0x92, 0xf8, 0x46, 0x17, 0x61, 0xb3, 0x64, 0xbe, 0x41, 0x48,
+    0xb9, 0xad, 0xdd, 0x4c, 0x7e, 0x47, 0x24, 0xa8, 0x61, 0x91, 0x80, 0x3b, 0x68, 0xff, 0x50, 0x24,
+    0xcf, 0x24, 0xe7, 0xf3, 0x6b, 0xc4, 0x10, 0xe3, 0x32, 0x9a, 0x5e, 0xfd, 0xe8, 0x7c, 0x1b, 0x77,
+    0xbf, 0x80, 0xf9, 0xf8, 0x95, 0x5b, 0x33, 0x1d, 0xf1, 0x67, 0xa5, 0x9e, 0x48, 0xbb, 0xfb, 0xc5,
+    0xaf, 0x9f, 0x8a, 0x69, 0x11, 0x8d, 0x5d, 0xde, 0xbd, 0x1a, 0x15, 0xad, 0x46, 0x07, 0x82, 0x7d,
+    0x3d, 0xfb, 0x56, 0x73, 0xf3, 0x57, 0x3c, 0xbc, 0x0f, 0x6c, 0xe9, 0x04, 0xa9, 0xa3, 0x66, 0xf0,
+    0xc5, 0x63, 0x27, 0x93, 0xb2, 0x56, 0x3e, 0xf2, 0x37, 0xc1, 0xea, 0x0d, 0xe1, 0x4e, 0xfd, 0xc6,
+    0x66, 0x99, 0x02, 0x5d, 0xf1, 0xef, 0xb4, 0x74, 0x8f, 0xca, 0xdc, 0x4c, 0xa7, 0x18, 0xd2, 0x87,
+    0xdd, 0xd3, 0x5c, 0x89, 0x8a, 0xdf, 0x41, 0xa5, 0xfe, 0x43, 0xc2, 0xab, 0x23, 0xdf, 0x6b, 0x80,
+    0x08, 0x59, 0x33, 0x39, 0x1c, 0xa0, 0x61, 0x70, 0xc2, 0x2b, 0x67, 0x6a, 0x43, 0xa3, 0xaf, 0x77,
+    0x08, 0x58, 0xa2, 0x13, 0x80, 0xd8, 0x8e, 0x58, 0x1e, 0xc1, 0x0a, 0xac, 0xa9, 0x9a, 0x3a, 0xc2,
+    0x78, 0x7c, 0xdb, 0x1d, 0x68, 0xc1, 0x0a, 0x85, 0x73, 0xd3, 0x8b, 0xc8, 0x5d, 0x8e, 0xe1, 0xbb,
+    0x75, 0x34, 0xae, 0x18, 0x9f, 0x79, 0x28, 0x4b, 0x50, 0x3c, 0x48, 0x1d, 0x43, 0xc9, 0x4f, 0xf7,
+    0x1d, 0x84, 0x5a, 0x9f, 0x6e, 0xa9, 0xfe, 0x23, 0x07, 0xf7, 0x13, 0x66, 0xd9, 0x70, 0xc3, 0x1c,
+    0x79, 0x8d, 0x21, 0x4e, 0x46, 0x6d, 0xee, 0x24, 0x22, 0x8d, 0x13, 0xf5, 0xef, 0x0e, 0xe4, 0x02,
+    0x7a, 0xf6, 0x07, 0xad, 0xf3, 0xa6, 0xb1, 0xe3, 0x61, 0x94, 0x9d, 0x57, 0xc1, 0x18, 0x25, 0x39,
+    0x5e, 0xc6, 0xf7, 0x37, 0x15, 0xdb, 0x39, 0xd9, 0xd9, 0x2d, 0x7f, 0xde, 0xdd, 0x34, 0x41, 0x7c,
+    0x94, 0x5a, 0x2d, 0x0b, 0x2b, 0x4d, 0xe9, 0x82, 0x29, 0xda, 0x37, 0xc6, 0x61, 0x84, 0x6f, 0x4e,
+    0x3d, 0x8a, 0x46, 0x3c, 0x6a, 0x17, 0xd5, 0xd2, 0x11, 0x73, 0xfc, 0x02, 0xff, 0xf4, 0x90, 0x19,
+    0x5e, 0x19, 0x6f, 0xe9, 0x27, 0xce, 0x77, 0xa7, 0x16, 0x12, 0xac, 0x15, 0xb6, 0xf1, 0xfe, 0x28,
+    0x8e, 0x1c, 0x63, 0x62, 0xa4, 0x1d, 0x7b, 0x7a, 0xca, 0xb8, 0x28, 0x3e, 0x4b, 0xb0, 0xee, 0x4a,
+    0x12, 0x52, 0x8f, 0x85, 0xf1, 0x97, 0x2b, 0xb6, 0xb8, 0x0e, 0xec, 0xb2, 0xa0, 0x9c, 0x31, 0x12,
+    0x0d, 0x52, 0x73, 0x41, 0xe6, 0xab, 0xe8, 0xc1, 0x99, 0x0a, 0x46, 0xdf, 0xa2, 0xfb, 0xc4, 0x9b,
+    0x1f, 0xe2, 0xd7, 0xd5, 0x54, 0xa5, 0x0a, 0x9f, 0x1a, 0x75, 0xc7, 0x83, 0x54, 0x77, 0x53, 0x9c,
+    0x10, 0x3d, 0x61, 0xd8, 0x91, 0xd7, 0xee, 0xe3, 0x9e, 0x17, 0x7e, 0x2f, 0x89, 0x03, 0x1e, 0x8a,
+    0x62, 0x01, 0xef, 0x35, 0x4a, 0xcd, 0x88, 0xe7, 0x99, 0x18, 0x9c, 0x7c, 0x0f, 0xb4, 0x97, 0x3f,
+    0xfc, 0x46, 0x43, 0x54, 0x03, 0xee, 0xed, 0xdb, 0x37, 0xdd, 0xeb, 0x3f, 0x6a, 0x16, 0xee, 0xf0,
+    0x7f, 0xee, 0x16, 0x16, 0x74, 0x51, 0x79, 0x27, 0x66, 0x4a, 0xba, 0x06, 0xac, 0x44, 0x9f, 0x94,
+    0x96, 0x30, 0xe0, 0xe6, 0xfe, 0x76, 0x59, 0x5e, 0xc7, 0x6e, 0xfe, 0xe2, 0xeb, 0xe4, 0xc7, 0x80,
+    0xd9, 0xf3, 0xfa, 0xd6, 0x4e, 0xc2, 0xb4, 0xb8, 0xf6, 0x0f, 0xe6, 0xe7, 0x8f, 0x5e, 0x8a, 0xe4,
+    0x5b, 0x9f, 0xe7, 0xc1, 0x70, 0xf1, 0xc9, 0xfc, 0x16, 0x3e, 0xa2, 0x99, 0x75, 0x47, 0x1d, 0x81,
+    0xbf, 0xa2, 0xbe, 0x5c, 0x3b, 0x02, 0xdc, 0xf7, 0x35, 0x85, 0xed, 0x62, 0xe6, 0xf6, 0xce, 0x4a,
+    0x2d, 0xe5, 0xd0, 0x55, 0xf2, 0xb6, 0xd7, 0xdf, 0x05, 0xbf, 0x17, 0x1d, 0x33, 0xda, 0xb5, 0xca,
+    0xfb, 0x45, 0x69, 0xe2, 0x08, 0x87, 0x2a, 0x2b, 0x46, 0x0e, 0x9a, 0xdb, 0xb0, 0xe4, 0x53, 0x8b,
+    0x58, 0x30, 0xc7, 0x8d, 0xa2, 0xf1, 0x52, 0x63, 0xcb, 0xae, 0x43, 0xbb, 0x7d, 0x5e, 0x42, 0xee,
+    0x9f, 0x9a, 0xe1, 0xc6, 0xa3, 0xad, 0xdc, 0x46, 0x6a, 0x09, 0x95, 0x11, 0x3e, 0x2e, 0xb1, 0xbe,
+    0x61, 0xf1, 0xdd, 0xfc, 0xf4, 0x75, 0x5b, 0xf7, 0x70, 0x68, 0x08, 0xae, 0xe5, 0x61, 0x57, 0x46,
+    0xe9, 0xfb, 0x3f, 0x9b, 0xc1, 0x77, 0xb9, 0x23, 0x6e, 0xde, 0xa6, 0x09, 0x2d, 0xbf, 0x37, 0xca,
+    0x93, 0x4c, 0xb3, 0x10, 0x6b, 0x1f, 0xaf, 0xa8, 0x49, 0xe2, 0x2d, 0x6e, 0x9e, 0x78, 0x14, 0x2f,
+    0x2d, 0x08, 0x7c, 0x37, 0xb5, 0x27, 0x4f, 0xbd, 0x86, 0x8d, 0x2f, 0x3a, 0x1b, 0x12, 0x6a, 0xda,
+    0xdd, 0x2d, 0x67, 0x17, 0x3a, 0x70, 0x2e, 0x88, 0xfb, 0x2c, 0xfe, 0x79, 0x46, 0x6f, 0x6e, 0x5b,
+    0x71, 0x20, 0xa6, 0xd2, 0x38, 0xbd, 0xf3, 0x9d, 0x92, 0x39, 0x54, 0x20, 0xc8, 0xf9, 0x52, 0xdf,
+    0xd4, 0xe2, 0xd8, 0xce, 0x4a, 0x9d, 0xa4, 0xf0, 0xd8, 0x8b, 0xdb, 0x78, 0x70, 0x65, 0xa6, 0x9f,
+    0x70, 0xbc, 0xcf, 0x2e, 0x21, 0xe0, 0xf4, 0xad, 0xfa, 0x56, 0xb2, 0x4b, 0x54, 0xec, 0x05, 0x37,
+    0x7b, 0x67, 0xa7, 0x31, 0xca, 0xde, 0x2e, 0x23, 0x52, 0xb1, 0xfd, 0x37, 0x2e, 0x55, 0xc8, 0x74,
+    0x83, 0x39, 0x03, 0x91, 0xf2, 0xc8, 0x9f, 0x1b, 0xdd, 0x21, 0xfc, 0x6b, 0x84, 0xe7, 0x93, 0x37,
+    0xfe, 0xcb, 0x33, 0x07, 0x93, 0xb7, 0x12, 0x95, 0x9a, 0xfd, 0x8c, 0x67, 0x1e, 0xec, 0x2f, 0xbe,
+    0xb6, 0x4f, 0xca, 0x68, 0x66, 0x4f, 0xf7, 0x2e, 0xb8, 0xd8, 0x73, 0xda, 0x6f, 0x34, 0x1a, 0xce,
+    0x06, 0x70, 0xbc, 0xd0, 0x33, 0x12, 0x81, 0xba, 0xbb, 0xdd, 0x2a, 0x50, 0x46, 0xb0, 0xc5, 0xda,
+    0x50, 0xfa, 0x84, 0x6e, 0xf6, 0xaf, 0xed, 0x79, 0xf4, 0x0a, 0xbe, 0x83, 0x01, 0x72, 0x3b, 0x74,
+    0x1f, 0x08, 0x24, 0x84, 0x55, 0x86, 0x0c, 0xbb, 0xde, 0x58, 0xbe, 0x4c, 0x56, 0xcd, 0x11, 0xd1,
+    0x8d, 0xe2, 0xa5, 0xa5, 0x4c, 0x3f, 0x16, 0x37, 0xcc, 0x35, 0x52, 0xeb, 0x39, 0xb3, 0x87, 0x2e,
+    0x2a, 0x36, 0x42, 0x4d, 0x7b, 0x41, 0xe9, 0x26, 0x3b, 0xca, 0xa1, 0x0d, 0xd1, 0x9a, 0x0c, 0x9c,
+    0x7c, 0xdb, 0x8b, 0xe2, 0x79, 0x32, 0x46, 0x30, 0x3c, 0x5d, 0xe4, 0x60, 0x89, 0x0c, 0x42, 0xa1,
+    0xaa, 0x75, 0x67, 0xbd, 0x2a, 0x4f, 0xf2, 0xaa, 0x5e, 0x0d, 0x49, 0xab, 0xea, 0x16, 0xd0, 0xd6,
+    0x7b, 0x8d, 0xcd, 0x43, 0x0c, 0x43, 0x57, 0xd1, 0x76, 0x11, 0x45, 0x4b, 0x92, 0xbb, 0xe5, 0x30,
+    0x59, 0x29, 0xaa, 0xa6, 0x28, 0xfb, 0xbd, 0x3b, 0x6b, 0xee, 0xc2, 0xba, 0x61, 0xcd, 0x5f, 0xde,
+    0xb1, 0xe5, 0x69, 0x49, 0x8f, 0xcc, 0xca, 0x37, 0x02, 0xc3, 0xee, 0x6f, 0xea, 0x61, 0xe6, 0xf3,
+    0x4d, 0x5a, 0x25, 0xe0, 0x99, 0xf0, 0xc3, 0xbd, 0xa8, 0x33, 0xa6, 0x84, 0x41, 0x59, 0xb3, 0x17,
+    0xc4, 0xad, 0x94, 0x73, 0xb5, 0x87, 0xe4, 0xe0, 0x43, 0x6c, 0x4a, 0xea, 0xae, 0x1a, 0xab, 0x3a,
+    0xc4, 0x97, 0x18, 0xb1, 0x1b, 0x4d, 0xd7, 0x87, 0xae, 0x5d, 0xc5, 0x51, 0x61, 0xb3, 0xc8, 0x81,
+    0xc2, 0x33, 0xc1, 0x00, 0xca, 0x5d, 0x4f, 0x4d, 0x22, 0x51, 0x55, 0xa8, 0xb5, 0xb2, 0x66, 0xff,
+    0x06, 0x5d, 0xe6, 0x16, 0x68, 0x33, 0xdc, 0x80, 0x8c, 0x3e, 0x67, 0x52, 0x81, 0xee, 0x20, 0x95,
+    0x7f, 0xc3, 0xae, 0xd0, 0x58, 0x85, 0xcf, 0xdc, 0xcd, 0x39, 0x12, 0xe2, 0xdf, 0xdb, 0xf4, 0x2f,
+    0x3a, 0x7b, 0xb7, 0x3e, 0x3e, 0x28, 0x2f, 0x1c, 0xe5, 0x52, 0xc9, 0xa3, 0x64, 0xc7, 0x5d, 0xbe,
+    0x84, 0x6b, 0x28, 0x21, 0x3f, 0xd4, 0xe2, 0x8d, 0x98, 0x8a, 0x3b, 0xc4, 0x13, 0xa9, 0xb3, 0x33,
+    0x11, 0x40, 0x0b, 0xda, 0x70, 0xcd, 0xdd, 0x65, 0xa3, 0x94, 0x0a, 0xf5, 0x2f, 0x7c, 0x3c, 0xe1,
+    0xfe, 0x12, 0x64, 0x70, 0x1a, 0x54, 0x8d, 0x46, 0x1b, 0x29, 0x24, 0x66, 0x87, 0x57, 0x8c, 0x7c,
+    0x14, 0xf3, 0x79, 0x5f, 0xb6, 0x49, 0x26, 0xe8, 0xee, 0xf0, 0x2f, 0x99, 0x65, 0x9b, 0x86, 0xac,
+    0x66, 0x84, 0x66, 0x2c, 0xdf, 0x69, 0x40, 0x09, 0xf5, 0xd2, 0x24, 0x2a, 0x84, 0xf9, 0x65, 0xfa,
+    0x66, 0xfa, 0x6b, 0x32, 0x71, 0x22, 0xf5, 0x54, 0x2c, 0xd9, 0x92, 0xbe, 0x76, 0x1a, 0x09, 0xf3,
+    0x99, 0x69, 0xef, 0x0a, 0x3d, 0x7a, 0xf4, 0xc6, 0x60, 0x55, 0xa8, 0xc3, 0x68, 0xbe, 0x4e, 0x77,
+    0xf3, 0x33, 0xea, 0xa5, 0x67, 0x1e, 0xcd, 0xe7, 0x28, 0x14, 0x3b, 0xa8, 0xcf, 0x83, 0xf1, 0x2b,
+    0x7d, 0xd0, 0x26, 0xee, 0xcd, 0x68, 0x81, 0x07, 0x5b, 0x4d, 0x95, 0x95, 0x66, 0x0f, 0xfb, 0x41,
+    0xe6, 0xeb, 0xa7, 0x6b, 0x57, 0x4a, 0xf1, 0x83, 0x0a, 0x93, 0xcb, 0xdc, 0x1c, 0x13, 0xf2, 0xda,
+    0x03, 0xe5, 0x1d, 0x8c, 0xea, 0x5f, 0xdc, 0xff, 0x28, 0x23, 0x4b, 0xd4, 0x26, 0x98, 0x84, 0xfe,
+    0x60, 0xc9, 0x72, 0x1c, 0xd8, 0x58, 0x4b, 0xde, 0xff, 0x80, 0x40, 0xea, 0xf6, 0x2c, 0xd9, 0x2e,
+    0x56, 0x58, 0x2b, 0x09, 0x27, 0x0b, 0xf1, 0xa8, 0xf4, 0xea, 0x92, 0x0f, 0xb7, 0x8f, 0x81, 0x51,
+    0x72, 0xef, 0x32, 0xd8, 0xf7, 0x3a, 0x08, 0xc3, 0x5d, 0xf3, 0xe6, 0x7a, 0xca, 0x5b, 0x63, 0xdf,
+    0x3f, 0xcd, 0x73, 0x19, 0xa2, 0xcb, 0xff, 0x39, 0x57, 0xff, 0x1c, 0xf3, 0x34, 0xaf, 0x9d, 0xa0,
+    0x2f, 0x54, 0xc1, 0x82, 0x54, 0x60, 0x53, 0x6e, 0x83, 0x66, 0x24, 0x02, 0xae, 0x54, 0xed, 0x2d,
+    0x52, 0x91, 0x71, 0x3b, 0x8e, 0x19, 0xdf, 0xed, 0x1f, 0x0d, 0xff, 0xd6, 0xbb, 0x83, 0xee, 0xe8,
+    0x3a, 0xd4, 0x5b, 0x22, 0x7a, 0xb8, 0x5b, 0xc9, 0xa2, 0x3d, 0x35, 0x8a, 0xc6, 0xa5, 0x28, 0x54,
+    0x11, 0x64, 0x74, 0x52, 0xd9, 0xdd, 0x75, 0x75, 0x04, 0x0a, 0x9c, 0xf9, 0x20, 0xa3, 0x03, 0x8b,
+    0x54, 0x36, 0x68, 0xb3, 0x67, 0x79, 0xa3, 0xf0, 0x54, 0xc9, 0xea, 0xbc, 0x2d, 0xf3, 0x33, 0xe3,
+    0xf5, 0x0f, 0x7e, 0xae, 0x64, 0x17, 0x17, 0xb1, 0x77, 0xe8, 0x45, 0xe4, 0xaf, 0x50, 0x79, 0xd7,
+    0x97, 0xd1, 0xbc, 0x73, 0x72, 0x9a, 0x5b, 0x3f, 0x0d, 0x07, 0x65, 0xa4, 0x77, 0x10, 0x36, 0x85,
+    0x59, 0x50, 0x44, 0x99, 0xde, 0xa4, 0x17, 0x3a, 0xf3, 0x88, 0x55, 0x65, 0xb4, 0xf0, 0xaf, 0xf3,
+    0x4e, 0x9d, 0xde, 0xee, 0xc6, 0x8a, 0x0a, 0x06, 0xbe, 0x73, 0x54, 0xf2, 0xc2, 0xbe, 0x8d, 0x88,
+    0x05, 0x6b, 0x1f, 0x1b, 0x6e, 0x67, 0xd4, 0x8a, 0xf1, 0x75, 0x25, 0x06, 0xf1, 0x8e, 0x52, 0x33,
+    0x39, 0xb4, 0x5b, 0x4e, 0xf6, 0xa2, 0xc9, 0x7e, 0x4c, 0xa4, 0x89, 0xe3, 0x71, 0xc3, 0x18, 0xab,
+    0xd7, 0x39, 0xb9, 0x66, 0x5e, 0xff, 0xa2, 0xb3, 0xce, 0x22, 0xfb, 0x03, 0x9b, 0x8d, 0xcd, 0x72,
+    0xe5, 0x74, 0xc8, 0x3b, 0xe6, 0xbd, 0x0c, 0xc3, 0xcf, 0x21, 0x99, 0x0f, 0xf5, 0xdb, 0xe5, 0xa3,
+    0x6e, 0xa9, 0x54, 0x35, 0x67, 0xfb, 0x4d, 0x1a, 0x71, 0x59, 0xc9, 0x10, 0x4b, 0x94, 0x16, 0x68,
+    0x94, 0x50, 0x27, 0x6b, 0xad, 0xf9, 0xc7, 0x6d, 0xb9, 0x7f, 0x49, 0xde, 0xa2, 0xe3, 0x1e, 0x94,
+    0x88, 0x3b, 0x09, 0x36, 0xff, 0xf6, 0x89, 0xbf, 0xab, 0x96, 0x90, 0x7d, 0xf8, 0x63, 0x2d, 0x3f,
+    0x33, 0x24, 0x92, 0xd3, 0x9b, 0xeb, 0x6c, 0x84, 0xf7, 0x6c, 0xb9, 0x6a, 0x9f, 0x12, 0x97, 0x26,
+    0xe1, 0x86, 0x5b, 0xf3, 0xca, 0x48, 0x56, 0x4c, 0x4d, 0xbd, 0xee, 0x41, 0x11, 0x8e, 0x5b, 0x66,
+    0x60, 0x26, 0x41, 0x48, 0xdb, 0xab, 0x8e, 0x2e, 0xb9, 0xb5, 0x75, 0xf2, 0x16, 0xdd, 0xaa, 0x4c,
+    0x8d, 0xb7, 0xec, 0xdc, 0x6b, 0x7f, 0xda, 0x99, 0x28, 0xa1, 0x91, 0xb6, 0x33, 0x90, 0x2d, 0x89,
+    0x84, 0xae, 0x59, 0x8c, 0x7a, 0xfd, 0x67, 0xe1, 0x1d, 0x25, 0xe2, 0x4a, 0xe2, 0x89, 0x1a, 0x96,
+    0xa6, 0x5e, 0xad, 0xae, 0xde, 0x54, 0x14, 0x71, 0xbb, 0x19, 0xf9, 0x0c, 0x1b, 0xc7, 0x68, 0x59,
+    0x85, 0x49, 0x8f, 0x74, 0x18, 0xde, 0x10, 0x27, 0xde, 0x7b, 0x7b, 0xd5, 0xb0, 0x86, 0xbf, 0xda,
+    0x65, 0xcd, 0xdc, 0xbf, 0x29, 0x02, 0x43, 0xf6, 0xee, 0x66, 0xe0, 0xfc, 0x66, 0x8f, 0xcf, 0x3f,
+    0xd2, 0xa3, 0x06, 0x39, 0x39, 0xa3, 0xa2, 0x17, 0x94, 0xf6, 0x56, 0xcc, 0x69, 0x73, 0x3f, 0xe6,
+    0x35, 0x6d, 0xd0, 0x52, 0xef, 0x3b, 0x54, 0x3b, 0x18, 0xc7, 0xfc, 0x5d, 0x21, 0xa1, 0xaa, 0x98,
+    0x5f, 0x44, 0xbc, 0xa6, 0x2b, 0xff, 0xb8, 0x2d, 0xbc, 0x3a, 0xa1, 0x0c, 0x55, 0xcf, 0x90, 0xd5,
+    0x50, 0x76, 0x46, 0xb9, 0x42, 0x4c, 0x94, 0xf6, 0x03, 0x06, 0xbe, 0x6c, 0x7b, 0x0d, 0xab, 0x82,
+    0xb2, 0x0f, 0x21, 0xbe, 0x08, 0xfb, 0x0e, 0xe6, 0x3b, 0xce, 0x5a, 0xf6, 0x46, 0x52, 0x12, 0xd5,
+    0x81, 0xe7, 0xd0, 0xe1, 0x22, 0x06, 0x46, 0x69, 0x6a, 0x96, 0x37, 0x09, 0x02, 0x84, 0xb9, 0xcb,
+    0x21, 0xad, 0x10, 0x86, 0xdd, 0x0e, 0x1c, 0x16, 0xcc, 0xf8, 0x2a, 0x43, 0x73, 0x86, 0xb7, 0xc2,
+    0x53, 0x12, 0xea, 0x43, 0x27, 0xce, 0x28, 0xf5, 0xb4, 0x95, 0x77, 0xe9, 0xee, 0xda, 0x8e, 0xf6,
+    0xf2, 0xd4, 0xa0, 0x59, 0xc2, 0x02, 0x01, 0x75, 0x90, 0xbf, 0xa4, 0x32, 0x62, 0xd4, 0xc7, 0x84,
+    0xc9, 0x0e, 0xcf, 0xf8, 0x4a, 0x9a, 0x43, 0x1c, 0x9e, 0x3d, 0x43, 0xb2, 0x0a, 0xf9, 0xb1, 0x94,
+    0x35, 0xdb, 0x88, 0xac, 0xaa, 0xfb, 0x86, 0x8a, 0x90, 0x33, 0xd9, 0x88, 0x60, 0x14, 0x23, 0xc8,
+    0x5a, 0x79, 0xc4, 0x33, 0xaa, 0x81, 0xf0, 0x1d, 0xca, 0x5e, 0x5a, 0xca, 0x9f, 0xa3, 0x06, 0x91,
+    0x29, 0x1d, 0x98, 0x98, 0x4a, 0xd2, 0xf3, 0xe8, 0x22, 0xc8, 0x9e, 0x7c, 0xbe, 0xd8, 0x32, 0x18,
+    0x09, 0xca, 0x7b, 0x3f, 0x48, 0xa1, 0x6b, 0x55, 0x38, 0xbc, 0xb7, 0x90, 0xd9, 0x59, 0xef, 0x74,
+    0x50, 0x0a, 0x76, 0x60, 0xa6, 0x46, 0xd5, 0x6b, 0x18, 0xf2, 0xba, 0x15, 0x74, 0xe7, 0x10, 0x02,
+    0x5a, 0x88, 0xe2, 0x5d, 0x1b, 0xfb, 0xb9, 0x6e, 0xfd, 0xb8, 0x4f, 0x51, 0x76, 0xf8, 0x38, 0xc2,
+    0x69, 0x06, 0xcf, 0x72, 0xf0, 0x59, 0x0c, 0x3c, 0x6e, 0x2e, 0xd4, 0x9d, 0xb3, 0x7a, 0x22, 0x94,
+    0x63, 0x9b, 0x13, 0xec, 0x50, 0xf0, 0xa9, 0xf9, 0x39, 0x29, 0x6b, 0xfc, 0xd9, 0x9c, 0xc3, 0x16,
+    0x91, 0xf6, 0x04, 0xdf, 0x8c, 0x09, 0x1d, 0x5e, 0xed, 0xe8, 0x27, 0x8c, 0xa0, 0xc4, 0x91, 0x17,
+    0xc2, 0xe9, 0x28, 0xc9, 0x96, 0xed, 0x53, 0xf6, 0x85, 0x42, 0x97, 0x61, 0x1b, 0x4f, 0x29, 0x32,
+    0xd1, 0x4b, 0x44, 0xa8, 0xe4, 0x4a, 0x62, 0xb1, 0x05, 0x0a, 0x39, 0xdf, 0x3b, 0xe2, 0xf0, 0x4d,
+    0x40, 0x87, 0xee, 0x75, 0xd1, 0xe3, 0xdd, 0xfe, 0x9d, 0x27, 0x79, 0xba, 0x26, 0x2d, 0xc4, 0x58,
+    0xe7, 0xdc, 0xb0, 0x30, 0x3f, 0xa2, 0xa4, 0xe0, 0xa3, 0x43, 0xec, 0xc3, 0xc0, 0xbc, 0xb2, 0xee,
+    0xe2, 0x88, 0xcb, 0x79, 0xb3, 0x0e, 0xe4, 0x09, 0xe7, 0xbf, 0xa8, 0x42, 0xc6, 0xc2, 0x10, 0x7f,
+    0x9e, 0xc4, 0x91, 0x40, 0xff, 0x04, 0x9b, 0xc0, 0xc4, 0xe3, 0x62, 0xd7, 0xbf, 0x0c, 0x77, 0xfe,
+    0x4d, 0x03, 0x33, 0x3b, 0xd0, 0x04, 0x49, 0xf2, 0x79, 0x71, 0x4e, 0xbc, 0x74, 0x9c, 0x8f, 0x85,
+    0x50, 0xa8, 0x26, 0x9f, 0x2e, 0x9b, 0xbd, 0x90, 0xb8, 0xd1, 0x62, 0x73, 0x9d, 0xbb, 0x2a, 0x78,
+    0x29, 0x00, 0x59, 0x92, 0x7b, 0x3c, 0xfc, 0x3a, 0x0a, 0x77, 0x39, 0x35, 0x6f, 0x56, 0x70, 0xcf,
+    0x3b, 0x1b, 0xad, 0x1d, 0xa3, 0xb2, 0x45, 0xaa, 0xda, 0xd7, 0xb6, 0xa5, 0x6d, 0x3c, 0xc1, 0x06,
+    0xd1, 0x13, 0xa6, 0x0b, 0x22, 0x08, 0xed, 0x1a, 0x99, 0xe5, 0x26, 0xae, 0x5c, 0xbd, 0xe1, 0x0b,
+    0xc4, 0x5e, 0xb9, 0xbf, 0x26, 0xa1, 0xec, 0x13, 0xd1, 0x6f, 0x51, 0xd6, 0x8f, 0x2b, 0x8b, 0xe6,
+    0xdf, 0x7e, 0xef, 0x25, 0x12, 0x17, 0x0e, 0x58, 0xb6, 0x4b, 0x70, 0x39, 0xea, 0x5b, 0x56, 0x7e,
+    0x62, 0xab, 0xd1, 0x84, 0x94, 0x82, 0x71, 0x22, 0x4b, 0x90, 0xc3, 0x37, 0x65, 0x08, 0x81, 0xe3,
+    0x57, 0xcf, 0x2a, 0x38, 0x8a, 0x2e, 0x42, 0xdb, 0x30, 0xa6, 0xa5, 0x27, 0x46, 0xc0, 0x5b, 0x95,
+    0x58, 0xfa, 0xe6, 0xfd, 0xab, 0xbc, 0xf3, 0x85, 0x6c, 0x26, 0xc7, 0x93, 0x61, 0x7d, 0xed, 0xd9,
+    0x6e, 0xa9, 0x22, 0x4f, 0x98, 0xf6, 0xc8, 0x22, 0x59, 0x40, 0x6e, 0x24, 0xa2, 0xe4, 0xc7, 0xd6,
+    0xf5, 0x8e, 0xef, 0x43, 0xed, 0x08, 0x3f, 0x1d, 0x9f, 0xbf, 0x89, 0xc7, 0xea, 0xaf, 0x59, 0xb3,
+    0x23, 0x46, 0xb7, 0xc3, 0x29, 0xbe, 0x78, 0xd9, 0x2e, 0xbb, 0xdf, 0xfd, 0x29, 0x63, 0x78, 0x49,
+    0xe2, 0xfd, 0xcc, 0x51, 0x25, 0x11, 0xf7, 0xe7, 0x4c, 0x13, 0x55, 0xdd, 0xa2, 0x9b, 0x9d, 0x1d,
+    0x53, 0xc4, 0xc2, 0x67, 0x50, 0x69, 0x4d, 0xd0, 0x1f, 0x68, 0x67, 0x12, 0x69, 0xbe, 0x7f, 0xd6,
+    0xa1, 0x86, 0x2f, 0xe0, 0xe1, 0x20, 0x9c, 0xac, 0x59, 0x1b, 0xa8, 0x59, 0x42, 0x4c, 0x9a, 0x17,
+    0xf9, 0xd5, 0xdf, 0xb7, 0x1c, 0x58, 0x46, 0xf7, 0x11, 0x21, 0x17, 0x06, 0x6e, 0x7f, 0x81, 0x52,
+    0x5c, 0xfe, 0x9b, 0xc2, 0xb8, 0xe0, 0x2f, 0x18, 0x04, 0x0f, 0x53, 0x57, 0x3c, 0x98, 0x00, 0xf9,
+    0xcf, 0x97, 0xf1, 0xb4, 0xb7, 0x28, 0xb8, 0x28, 0xb8, 0x3d, 0xad, 0xc3, 0x48, 0x7c, 0x96, 0x1d,
+    0x16, 0x3a, 0x55, 0xc5, 0x7d, 0xe9, 0x63, 0xe3, 0x24, 0x71, 0xe3, 0xa1, 0x82, 0x6d, 0x02, 0x4f,
+    0x5e, 0x28, 0x19, 0xda, 0x7e, 0xb9, 0x7b, 0x87, 0xf6, 0x57, 0x74, 0x64, 0xbe, 0x13, 0x85, 0xbe,
+    0xfd, 0x24, 0xf7, 0xd0, 0x9e, 0x1d, 0x49, 0xe9, 0xd6, 0x9e, 0xc2, 0x81, 0x8f, 0xdf, 0x65, 0xf8,
+    0xf3, 0x36, 0x7b, 0xd3, 0x27, 0x14, 0x48, 0xd3, 0xa5, 0x98, 0x3f, 0xb5, 0x10, 0x2d, 0x72, 0x7f,
+    0x33, 0x58, 0xe9, 0x59, 0xc7, 0x48, 0x1f, 0x32, 0xf6, 0x57, 0x88, 0xde, 0x34, 0xb1, 0xff, 0xad,
+    0x23, 0x16, 0x2f, 0xb3, 0xa7, 0x47, 0x42, 0x2c, 0xfb, 0xee, 0xa2, 0xc3, 0x55, 0xc8, 0xcd, 0xed,
+    0x99, 0x7b, 0x53, 0xe7, 0xe3, 0x3e, 0xfb, 0xb8, 0x12, 0xd6, 0xb3, 0x7d, 0xf5, 0xc5, 0xee, 0x0d,
+    0xb7, 0xf6, 0x44, 0xc1, 0x7d, 0x75, 0xbf, 0x35, 0x17, 0x24, 0x03, 0xbf, 0x24, 0x33, 0x3f, 0x4b,
+    0x35, 0xf7, 0x78, 0x9b, 0x7b, 0xd4, 0x17, 0x42, 0x3a, 0x4e, 0x12, 0x2e, 0xbf, 0xba, 0xa5, 0x6d,
+    0x43, 0x33, 0x9f, 0x6a, 0x2f, 0x58, 0x6f, 0x8d, 0xf8, 0xad, 0x8b, 0x9b, 0xa4, 0x99, 0x44, 0x77,
+    0x1c, 0x15, 0x62, 0x7e, 0x59, 0xd2, 0x3a, 0x07, 0x84, 0xae, 0xe9, 0x6c, 0xbb, 0x9f, 0xdf, 0x21,
+    0xa0, 0xbc, 0xef, 0xb1, 0x89, 0xca, 0x0c, 0x6b, 0x5a, 0x96, 0x72, 0xee, 0x3b, 0x82, 0xfe, 0x3d,
+    0xa5, 0x1c, 0x14, 0xa4, 0x3c, 0xd2, 0x4e, 0xa4, 0x96, 0xbe, 0xd8, 0x92, 0x54, 0xd8, 0x26, 0x6c,
+    0x06, 0x43, 0x2e, 0x12, 0xe1, 0x94, 0xfa, 0x2c, 0x76, 0x67, 0x69, 0xb8, 0x5e, 0xb8, 0xf7, 0xac,
+    0xa6, 0x88, 0x65, 0x37, 0x13, 0x7c, 0xde, 0x50, 0xea, 0xde, 0xa2, 0x9a, 0x95, 0x18, 0xbc, 0x48,
+    0x77, 0xd6, 0x8f, 0xfa, 0x57, 0xa1, 0x32, 0x12, 0xc0, 0xdf, 0x08, 0x65, 0x61, 0xa3, 0xb2, 0xd1,
+    0x03, 0x1f, 0x69, 0xd7, 0xf2, 0x87, 0xc1, 0x78, 0x47, 0x5b, 0xc0, 0xbc, 0x51, 0x00, 0x2e, 0x71,
+    0x20, 0x2a, 0xb9, 0x60, 0x65, 0x9b, 0xe3, 0x72, 0x8f, 0x77, 0x11, 0xaa, 0xa5, 0x6e, 0x4f, 0xa4,
+    0x9c, 0x83, 0x28, 0xce, 0x9b, 0x73, 0xf2, 0xaf, 0xa4, 0x17, 0xf9, 0x5c, 0x2e, 0xaf, 0x55, 0x4b,
+    0x88, 0x2a, 0x26, 0x3b, 0xd6, 0x7a, 0x87, 0x32, 0xf3, 0x81, 0xe5, 0x89, 0x4a, 0x65, 0xec, 0x57,
+    0xbf, 0x40, 0x8d, 0x0f, 0x85, 0xcf, 0xe4, 0x7c, 0x98, 0x4a, 0x0a, 0xc9, 0xb1, 0x85, 0x73, 0x86,
+    0xa6, 0x29, 0x3a, 0xd0, 0xd0, 0x64, 0xa1, 0xb2, 0x11, 0xdc, 0xd2, 0x48, 0x0f, 0xc1, 0xa3, 0xed,
+    0xae, 0x5c, 0x13, 0x1a, 0xf2, 0x81, 0x16, 0x3a, 0xdf, 0x7c, 0xb3, 0x51, 0x51, 0x98, 0x22, 0xa8,
+    0x86, 0x2c, 0xd8, 0x74, 0xa1, 0xbb, 0xa9, 0xc9, 0xe2, 0x9b, 0xd0, 0x96, 0x10, 0x43, 0xf0, 0xfa,
+    0x03, 0x76, 0x08, 0x44, 0xb0, 0x4c, 0x38, 0xfa, 0xb3, 0xc2, 0x6a, 0x2f, 0x13, 0x37, 0xe8, 0xb4,
+    0xe4, 0xcf, 0x79, 0xe0, 0x74, 0xdc, 0x20, 0x45, 0x20, 0x30, 0xcf, 0xad, 0xb9, 0xfc, 0xe4, 0xa0,
+    0xc5, 0xd2, 0xdb, 0x0f, 0x1c, 0x75, 0x11, 0xc3, 0xfb, 0xc8, 0x43, 0x9f, 0x1b, 0x0a, 0xfe, 0xde,
+    0x5e, 0x98, 0x2e, 0x78, 0x14, 0xb0, 0xbd, 0x83, 0x24, 0x71, 0x96, 0x9c, 0x08, 0x0a, 0xb3, 0x93,
+    0x16, 0x2a, 0xfd, 0xab, 0x55, 0xdd, 0xc8, 0x17, 0xd6, 0xf4, 0x94, 0x46, 0x74, 0x36, 0xc8, 0x54,
+    0x52, 0xbb, 0xe6, 0xd4, 0x17, 0x84, 0x1c, 0x44, 0xc4, 0xe1, 0xb7, 0xdc, 0xee, 0x98, 0x84, 0x70,
+    0x18, 0x09, 0xb3, 0xb7, 0x14, 0x3f, 0x3e, 0xc5, 0xcb, 0x1f, 0x8b, 0xe2, 0x82, 0xbb, 0x46, 0xcc,
+    0xb9, 0xfc, 0x0b, 0xa1, 0xdb, 0xbd, 0xb2, 0x65, 0xfd, 0x6e, 0xbd, 0x24, 0x7e, 0x69, 0xfa, 0x14,
+    0x46, 0x0e, 0xe6, 0xe7, 0x20, 0x54, 0xdc, 0xd1, 0x8d, 0x8f, 0x0e, 0x39, 0xf1, 0x79, 0x62, 0xa0,
+    0x55, 0xd9, 0x99, 0xf5, 0xc1, 0x28, 0x2e, 0xf4, 0x34, 0x21, 0x63, 0x6c, 0xef, 0xd1, 0xe0, 0xc8,
+    0xd6, 0x77, 0x05, 0xcf, 0xdd, 0x11, 0x55, 0x0c, 0x85, 0x38, 0xee, 0x4c, 0xde, 0xcd, 0x0b, 0x96,
+    0xc5, 0xa3, 0xb3, 0xcf, 0x5a, 0xf9, 0xb2, 0x03, 0x6c, 0x56, 0xfd, 0x61, 0xa3, 0x7e, 0xda, 0xc1,
+    0x1e, 0xda, 0xa5, 0xb1, 0x07, 0xd1, 0xe6, 0x8c, 0x2a, 0x24, 0x8c, 0x29, 0xad, 0xd7, 0x22, 0xbe,
+    0x82, 0x02, 0xf3, 0x9a, 0x72, 0x6c, 0x4d, 0x36, 0x69, 0x71, 0xc9, 0xca, 0xe9, 0x2a, 0xcc, 0xb4,
+    0xf7, 0x86, 0xe9, 0x77, 0xb2, 0xb8, 0x6e, 0xec, 0x26, 0xbe, 0x6b, 0xbd, 0x6e, 0x6f, 0xf2, 0xe4,
+    0x0e, 0x46, 0x0a, 0x8f, 0xc5, 0x8e, 0xd6, 0x6b, 0x72, 0xb5, 0x35, 0x6e, 0x3f, 0xdc, 0x02, 0x06,
+    0x1b, 0xcf, 0x43, 0x37, 0xdf, 0xa8, 0xf1, 0x19, 0x5d, 0xde, 0x4a, 0xaf, 0x48, 0x67, 0x18, 0xee,
+    0x8d, 0xc7, 0xf1, 0x88, 0x9b, 0xb4, 0x99, 0x0e, 0x83, 0x08, 0xca, 0x64, 0xde, 0x3e, 0x70, 0xf9,
+    0x14, 0xb3, 0x27, 0x89, 0x47, 0x15, 0xc6, 0x5a, 0x5a, 0x3a, 0x45, 0x13, 0x6b, 0x12, 0x47, 0x9c,
+    0xcc, 0xd2, 0x0c, 0xbf, 0x76, 0x45, 0xf9, 0x64, 0x6d, 0x56, 0x04, 0xec, 0xac, 0xef, 0xb5, 0xeb,
+    0xa3, 0x66, 0xf3, 0xe4, 0x70, 0x27, 0x7a, 0x39, 0x30, 0xe0, 0x1d, 0x86, 0x11, 0xef, 0x3c, 0x5f,
+    0x38, 0x9f, 0x4b, 0x34, 0xf1, 0x35, 0x5a, 0x2c, 0x5b, 0x1e, 0xfe, 0x64, 0x0a, 0xd0, 0xc9, 0xab,
+    0x39, 0xce, 0x0b, 0xb1, 0x93, 0x3b, 0x9d, 0x52, 0xfe, 0xcd, 0x98, 0xf1, 0x6c, 0x52, 0x8a, 0xce,
+    0x4c, 0xac, 0xc4, 0x3d, 0x58, 0x33, 0x3c, 0xd2, 0x69, 0xfd, 0x6f, 0xbe, 0xbe, 0x88, 0x6c, 0x9a,
+    0xf7, 0x8e, 0x8a, 0x9c, 0xa2, 0x5a, 0xaa, 0xa2, 0xf0, 0x6e, 0x09, 0xf9, 0xc7, 0x6e, 0x89, 0x33,
+    0x14, 0x5a, 0xd9, 0xbf, 0xaf, 0x3c, 0x30, 0xd9, 0x07, 0xc5, 0x34, 0x5d, 0xbf, 0xb1, 0xc7, 0x94,
+    0x7f, 0x62, 0x18, 0x90, 0x56, 0xc7, 0x99, 0x7c, 0x31, 0x1e, 0xc9, 0x7b, 0x4d, 0x45, 0x5d, 0xe5,
+    0xd3, 0x96, 0xfa, 0x92, 0xda, 0xbf, 0x06, 0x1d, 0x8c, 0x1d, 0xfd, 0xe3, 0x73, 0x72, 0x8c, 0x88,
+    0x82, 0x98, 0xd3, 0xc6, 0x25, 0x8e, 0x32, 0x31, 0x95, 0x50, 0x6a, 0x39, 0xba, 0x4c, 0xdc, 0x38,
+    0xf3, 0x30, 0x72, 0x99, 0x19, 0xa6, 0x70, 0xb5, 0xc1, 0x55, 0x55, 0xe6, 0x2c, 0x42, 0x45, 0xa2,
+    0xd5, 0xa0, 0x52, 0x62, 0xa1, 0xcd, 0x30, 0xc9, 0x85, 0xc2, 0xc0, 0x6a, 0x9d, 0xb8, 0xe7, 0x0b,
+    0xe2, 0xd6, 0xee, 0x15, 0x5c, 0x21, 0x9e, 0xbd, 0x94, 0x94, 0x3e, 0xfc, 0x68, 0xc7, 0xf6, 0xa6,
+    0xb0, 0xec, 0xcf, 0xbb, 0x0b, 0x6c, 0x4c, 0x77, 0xeb, 0x46, 0x77, 0x55, 0xc3, 0x9c, 0xaf, 0x89,
+    0x19, 0x09, 0x1d, 0x3e, 0x70, 0x89, 0xae, 0x8a, 0x2b, 0xaa, 0xfd, 0xd4, 0xa3, 0x6f, 0x3b, 0xbe,
+    0x22, 0x56, 0x9f, 0xa4, 0x76, 0x86, 0x6c, 0xb9, 0xc7, 0x04, 0x52, 0xda, 0xe6, 0xb2, 0x9a, 0x89,
+    0x3e, 0x3b, 0x1b, 0xd9, 0xc9, 0x8f, 0xa2, 0xaa, 0x1a, 0xea, 0xd8, 0x24, 0x88, 0x88, 0xea, 0xb3,
+    0xfa, 0x10, 0x27, 0x41, 0xc9, 0xae, 0xc5, 0xd5, 0x5c, 0xcd, 0x59, 0x76, 0x5f, 0x54, 0x7b, 0xd1,
+    0x4b, 0x26, 0x4a, 0xfd, 0xa4, 0x63, 0x2a, 0x62, 0x74, 0xd6, 0x48, 0x60, 0xb8, 0x51, 0x7b, 0x5e,
+    0xc5, 0xdb, 0x15, 0xc6, 0xfa, 0xf7, 0xf3, 0xa9, 0x64, 0x1a, 0x02, 0x4f, 0xbd, 0x2d, 0x64, 0xfa,
+    0xe1, 0x9d, 0xcb, 0x01, 0xca, 0x7d, 0xd4, 0x23, 0xac, 0xbc, 0x35, 0x2c, 0xe3, 0xdf, 0x9b, 0xdd,
+    0x24, 0xb2, 0xdf, 0xba, 0x37, 0xf3, 0xa4, 0x13, 0xb5, 0x13, 0xdf, 0x02, 0x2e, 0x82, 0x3e, 0xef,
+    0x97, 0x89, 0xd8, 0xf0, 0x59, 0xe7, 0x71, 0x52, 0x49, 0x3c, 0xaa, 0xff, 0xfe, 0xc0, 0xf7, 0xaf,
+    0x8a, 0xbf, 0x82, 0xfa, 0x2a, 0xee, 0xcb, 0xbd, 0xd2, 0x81, 0x1e, 0x7b, 0xb6, 0x63, 0xc4, 0x3c,
+    0x5b, 0x9b, 0xf3, 0xea, 0x74, 0xe5, 0x3d, 0xfc, 0x74, 0xa3, 0x4c, 0x23, 0x95, 0x13, 0x3f, 0x35,
+    0x82, 0x1a, 0xf2, 0x98, 0xf6, 0xd9, 0x82, 0x52, 0x08, 0x21, 0xe7, 0x43, 0x5a, 0x4e, 0x11, 0x9b,
+    0x84, 0x7b, 0x51, 0xdd, 0x5a, 0x8c, 0x46, 0xc6, 0x0b, 0xa7, 0xa7, 0x34, 0xcf, 0xfb, 0xff, 0x2f,
+    0xaf, 0xa2, 0xc3, 0xad, 0xc5, 0x0f, 0xf1, 0x88, 0xfa, 0xf1, 0xc5, 0x33, 0xa4, 0x87, 0xfb, 0xa6,
+    0x38, 0x93, 0x49, 0x7a, 0x5e, 0xd4, 0x2d, 0x31, 0x85, 0x8d, 0x5e, 0x99, 0x3c, 0x96, 0xe4, 0xf2,
+    0xf7, 0x78, 0xc6, 0xd2, 0x89, 0x6a, 0x09, 0x59, 0xc6, 0x58, 0x64, 0x82, 0x86, 0xcd, 0xad, 0x77,
+    0xde, 0x94, 0x0a, 0xcd, 0x6b, 0xba, 0xbb, 0x41, 0x54, 0x85, 0x2e, 0x94, 0x58, 0x7d, 0x34, 0xa7,
+    0x91, 0xad, 0xec, 0xf9, 0xa2, 0xac, 0xe7, 0x74, 0xad, 0x65, 0x2a, 0xa1, 0xe4, 0x84, 0x01, 0xf1,
+    0x4d, 0x25, 0x6e, 0xb9, 0x90, 0xfc, 0xb9, 0xe7, 0x7c, 0xfe, 0x30, 0x86, 0x14, 0x6d, 0x70, 0x3b,
+    0xca, 0xf5, 0x63, 0xf1, 0x27, 0xbe, 0x31, 0xc4, 0x55, 0x92, 0xa4, 0xb6, 0x49, 0x2d, 0x2a, 0x26,
+    0xf3, 0x5d, 0x26, 0x58, 0xff, 0xac, 0x94, 0xf6, 0xd1, 0xfe, 0xa8, 0x65, 0x23, 0x05, 0x54, 0x72,
+    0xef, 0x17, 0x4a, 0xb7, 0xe3, 0x74, 0x93, 0x7b, 0x37, 0xb6, 0x8b, 0xa6, 0x3f, 0xed, 0xd5, 0x79,
+    0x61, 0x56, 0xbd, 0x1a, 0x0e, 0x5c, 0xf8, 0xf4, 0x33, 0x92, 0x2b, 0x11, 0x74, 0xa0, 0x36, 0xd6,
+    0xe5, 0xa0, 0xe1, 0x63, 0x2b, 0xbf, 0x10, 0xbc, 0xcc, 0xc5, 0xd7, 0x74, 0xd3, 0x6c, 0xd1, 0xcc,
+    0xde, 0x14, 0xbc, 0xd3, 0x1d, 0x42, 0x74, 0x5e, 0x67, 0xd6, 0xc5, 0xec, 0x86, 0xa6, 0x85, 0x8f,
+    0x99, 0x89, 0xc0, 0x53, 0x4c, 0xfa, 0x40, 0x25, 0x4b, 0x27, 0x60, 0x72, 0x62, 0xd9, 0x96, 0x27,
+    0xcb, 0x74, 0x62, 0xe4, 0x79, 0xe0, 0x12, 0xd5, 0x57, 0xed, 0xe4, 0xb7, 0x00, 0x13, 0x57, 0xd4,
+    0xad, 0xf0, 0xaf, 0x6d, 0x29, 0x83, 0x8c, 0x47, 0x46, 0x67, 0xb0, 0x93, 0x61, 0x28, 0x4c, 0xed,
+    0xf1, 0x59, 0x3a, 0x74, 0xa8, 0x1d, 0x63, 0x78, 0x25, 0xf3, 0xb5, 0x6d, 0x2d, 0x03, 0x9b, 0x4d,
+    0xb3, 0x83, 0x01, 0x99, 0x33, 0xec, 0x38, 0xc0, 0x4d, 0x9e, 0x7c, 0x6e, 0x70, 0x91, 0x5b, 0xd4,
+    0x7b, 0x76, 0x1f, 0xe2, 0x47, 0xe1, 0x9b, 0x85, 0x92, 0x0e, 0xab, 0x48, 0x9c, 0x86, 0x54, 0xdf,
+    0xcf, 0xc9, 0x3a, 0x47, 0x24, 0x3b, 0x1f, 0x9f, 0x5d, 0x1e, 0x35, 0x61, 0xc5, 0x42, 0x45, 0x42,
+    0x46, 0xf2, 0x54, 0xba, 0x06, 0x69, 0x4c, 0x3b, 0xd7, 0x80, 0x4a, 0xe7, 0xa1, 0x27, 0x8f, 0xfc,
+    0xc9, 0xf8, 0xde, 0x4f, 0x9e, 0xba, 0x66, 0x75, 0x76, 0xdc, 0x03, 0x3a, 0xcc, 0xde, 0xf3, 0x88,
+    0x55, 0xba, 0x5e, 0x32, 0xd5, 0x94, 0xf4, 0x51, 0xc5, 0x2b, 0x0d, 0x86, 0x49, 0xe7, 0xd4, 0xfa,
+    0x55, 0x83, 0x66, 0xdb, 0x48, 0x9f, 0x66, 0x1d, 0xd0, 0xa6, 0x21, 0x6d, 0xed, 0xf3, 0x3f, 0x16,
+    0x71, 0x24, 0x9f, 0x8a, 0x29, 0xcc, 0x39, 0xe6, 0xc4, 0x11, 0x91, 0x50, 0x19, 0xa0, 0x50, 0xcf,
+    0xa7, 0x1b, 0x47, 0xf6, 0x37, 0x7c, 0x69, 0xa9, 0xa5, 0x1c, 0x34, 0x0b, 0x35, 0xf6, 0x5d, 0x5c,
+    0x57, 0x31, 0xe9, 0x80, 0x8d, 0x22, 0xcb, 0xaa, 0xbe, 0x7b, 0xe5, 0xc7, 0x40, 0x21, 0x76, 0xa4,
+    0xc8, 0x6c, 0x88, 0x58, 0x44, 0x28, 0x65, 0x41, 0xb3, 0xa8, 0x76, 0x75, 0xa8, 0x20, 0x68, 0x45,
+    0xe6, 0xcc, 0x65, 0xa1, 0xaf, 0x27, 0xec, 0xf9, 0x8d, 0x48, 0x35, 0x27, 0xce, 0x81, 0xeb, 0x6f,
+    0x94, 0x91, 0xdd, 0xbe, 0xae, 0x80, 0x24, 0xe9, 0x3e, 0x91, 0x0a, 0xc3, 0x28, 0x4c, 0x3c, 0x61,
+    0xa0, 0xc4, 0x31, 0x56, 0xe8, 0xb2, 0x7a, 0xa8, 0x2d, 0xd2, 0xa6, 0xfd, 0x66, 0xd0, 0xcd, 0xca,
+    0x44, 0x3f, 0x9f, 0xbe, 0x96, 0xcf, 0x1a, 0x4d, 0xf0, 0xc5, 0x05, 0x4d, 0x69, 0x28, 0x3b, 0x45,
+    0x0a, 0xf9, 0x8b, 0xb2, 0x95, 0xd5, 0x8e, 0xe8, 0xa9, 0xf8, 0x89, 0x83, 0x67, 0x6e, 0xfc, 0x92,
+    0xf2, 0x9c, 0x59, 0x0e, 0xcf, 0x4b, 0xce, 0x0c, 0xe4, 0x32, 0x12, 0x57, 0xcc, 0xe2, 0x81, 0xbe,
+    0x4e, 0x82, 0xb7, 0x62, 0x68, 0x6d, 0x57, 0x8e, 0x54, 0x01, 0xe7, 0x8e, 0x07, 0x53, 0x92, 0x19,
+    0x6d, 0xe3, 0xa0, 0x57, 0x19, 0xee, 0x22, 0x9e, 0xb7, 0x50, 0x1d, 0xef, 0x1a, 0xee, 0x5e, 0x16,
+    0x7a, 0xb1, 0xc4, 0x45, 0x17, 0xc3, 0xa4, 0xd8, 0xea, 0x70, 0xd9, 0xf8, 0xd9, 0xab, 0x8f, 0x28,
+    0x9d, 0xe7, 0x72, 0x3d, 0x56, 0x35, 0x8f, 0x2b, 0x92, 0x47, 0x91, 0xa8, 0x4c, 0x45, 0xc0, 0x68,
+    0xe2, 0x2f, 0xe9, 0x74, 0xfc, 0xef, 0xdc, 0x9b, 0xbb, 0x2a, 0xfa, 0x5d, 0x3c, 0x4b, 0x2d, 0xdf,
+    0x03, 0x2a, 0x50, 0xea, 0xb9, 0x31, 0xa3, 0xbb, 0xd0, 0x3d, 0x75, 0xb1, 0x0c, 0x15, 0xb3, 0x1b,
+    0xe7, 0xe2, 0x9d, 0xe4, 0x7d, 0x78, 0x91, 0x03, 0xf7, 0x22, 0x7f, 0xfd, 0xd1, 0x69, 0xdd, 0x72,
+    0x12, 0x95, 0x1c, 0xd7, 0x5c, 0x8e, 0x3b, 0x87, 0xf9, 0x7d, 0x4c, 0x1b, 0x4a, 0x70, 0xe7, 0xe5,
+    0xae, 0x35, 0x18, 0xe8, 0x3c, 0x29, 0xff, 0x98, 0x86, 0x3a, 0x1c, 0x8b, 0xbe, 0x1e, 0x3f, 0x88,
+    0x7d, 0x37, 0x9c, 0x0d, 0x4b, 0xb0, 0xbf, 0x14, 0x4b, 0x90, 0xa0, 0xd4, 0xca, 0xb3, 0x3c, 0x3c,
+    0x44, 0x1a, 0x4d, 0x1c, 0x67, 0x02, 0xc9, 0x9f, 0x3e, 0x0b, 0x55, 0xf3, 0x86, 0xad, 0xe9, 0x97,
+    0x39, 0x48, 0x70, 0xc8, 0x68, 0xf6, 0x43, 0x65, 0x67, 0xd7, 0x5c, 0x35, 0x03, 0x5f, 0xfd, 0x4d,
+    0x64, 0xae, 0xb9, 0xeb, 0x6e, 0xb0, 0x7a, 0xa9, 0xe4, 0x0c, 0xa2, 0x38, 0x13, 0x7b, 0x70, 0x3e,
+    0x6d, 0x6d, 0xfc, 0x5d, 0x29, 0xd1, 0x20, 0xd1, 0x0a, 0xfb, 0x45, 0x0a, 0x64, 0x45, 0x8b, 0x67,
+    0xe1, 0x51, 0xa0, 0x25, 0x69, 0xef, 0x12, 0x69, 0xb8, 0x6a, 0xd6, 0x14, 0xae, 0x1a, 0x62, 0xab,
+    0x1b, 0x4e, 0xc7, 0xdc, 0xea, 0xe0, 0x65, 0x32, 0x8a, 0xe4, 0x00, 0x53, 0x42, 0x95, 0x74, 0xf7,
+    0x3d, 0x19, 0xe4, 0x8b, 0xca, 0x96, 0xb6, 0x80, 0xb5, 0x51, 0x56, 0x3d, 0xe4, 0xee, 0xd1, 0x96,
+    0x1a, 0x86, 0x43, 0xf2, 0x4d, 0xbf, 0x9c, 0x49, 0x72, 0x74, 0x3e, 0xf9, 0x65, 0x52, 0x92, 0x07,
+    0x6b, 0x1d, 0x9e, 0x2a, 0xad, 0x92, 0xb7, 0xdd, 0x9c, 0xea, 0xc1, 0xe2, 0x60, 0x68, 0xbd, 0xd2,
+    0xf1, 0x6f, 0xdb, 0x03, 0x43, 0xe7, 0x2f, 0xd9, 0xc1, 0xc9, 0x3c, 0x5a, 0x8b, 0x88, 0x76, 0xfc,
+    0xa1, 0x12, 0xe8, 0x82, 0x72, 0xda, 0xec, 0x55, 0x6e, 0x5d, 0x94, 0xcf, 0x34, 0xd0, 0x96, 0x56,
+    0x82, 0x4b, 0xfd, 0x44, 0x9a, 0xb2, 0x3c, 0x12, 0xae, 0xbb, 0x39, 0xbf, 0xbb, 0x2f, 0x5f, 0x48,
+    0x08, 0x4d, 0x09, 0xaa, 0x08, 0x9f, 0x1f, 0x83, 0x0d, 0x36, 0x0e, 0xea, 0x22, 0x26, 0x4f, 0xc2,
+    0x85, 0x8a, 0x28, 0x1f, 0xbf, 0xf6, 0x91, 0xbd, 0x68, 0x4f, 0x08, 0x87, 0xb3, 0x49, 0x1e, 0xab,
+    0x9b, 0x20, 0xc1, 0x36, 0x39, 0x55, 0xdb, 0x06, 0x4e, 0xde, 0x5f, 0x0f, 0xc8, 0x78, 0x5a, 0x20,
+    0x60, 0x29, 0xc3, 0x9f, 0xf3, 0x69, 0xa0, 0xe8, 0x17, 0xb6, 0x49, 0x96, 0x1c, 0x93, 0x47, 0x54,
+    0xe9, 0x9d, 0x84, 0xaf, 0xbd, 0x9b, 0xde, 0xab, 0xa1, 0xa8, 0x51, 0xbb, 0x15, 0x1b, 0xfc, 0x7f,
+    0x52, 0xe6, 0x0f, 0x5d, 0xf1, 0xc9, 0x61, 0xfc, 0x91, 0xea, 0x09, 0x5f, 0x57, 0xa4, 0x8b, 0xbb,
+    0xe5, 0xb6, 0x64, 0x95, 0xef, 0x71, 0x89, 0x79, 0x47, 0xc4, 0xb1, 0xd5, 0xb3, 0x1c, 0x6c, 0x85,
+    0x74, 0x3b, 0x85, 0xbb, 0x6f, 0x02, 0x5c, 0xe9, 0x72, 0x6d, 0xcc, 0x45, 0x89, 0x54, 0x06, 0x6f,
+    0x6e, 0x16, 0x75, 0xf5, 0xd6, 0xaa, 0xc7, 0x86, 0xc5, 0x3f, 0xf1, 0x65, 0x76, 0xd6, 0xd2, 0x35,
+    0xcc, 0x29, 0x9c, 0x7b, 0xb9, 0x18, 0xe5, 0x9d, 0x04, 0x8c, 0xae, 0xda, 0x3f, 0xa0, 0x3b, 0xde,
+    0x41, 0x3b, 0xb1, 0x0b, 0x6a, 0x42, 0x41, 0x27, 0x2c, 0xb7, 0x33, 0x2e, 0x8b, 0x22, 0xce, 0xfe,
+    0x62, 0x9c, 0xb1, 0x81, 0xd7, 0x3b, 0x1f, 0xe2, 0x3e, 0x65, 0x82, 0xae, 0xdd, 0x64, 0xa9, 0xe3,
+    0x2b, 0xa6, 0x8a, 0x5a, 0xfc, 0x65, 0xe5, 0xc1, 0x23, 0x21, 0x88, 0x96, 0xaf, 0x46, 0xf3, 0x43,
+    0x3c, 0xe9, 0x3a, 0xe8, 0xd5, 0x63, 0xcc, 0x84, 0xf1, 0x77, 0x0e, 0x8f, 0xc3, 0x07, 0x77, 0x9b,
+    0x37, 0x2e, 0x7b, 0xb8, 0x5d, 0x95, 0x95, 0x13, 0x88, 0x05, 0xbf, 0x5c, 0xeb, 0x47, 0x96, 0xbf,
+    0x45, 0x0f, 0x05, 0x47, 0x71, 0x32, 0xf9, 0xbe, 0xaf, 0x8e, 0xa6, 0xdf, 0x47, 0x79, 0x11, 0xdc,
+    0x75, 0x57, 0x75, 0x21, 0x59, 0xaa, 0xaa, 0x87, 0xd4, 0xf8, 0xbe, 0xb2, 0x85, 0xfb, 0x87, 0x05,
+    0xe1, 0xb7, 0xa5, 0x7a, 0x92, 0x89, 0xc5, 0xcb, 0xf1, 0xe1, 0xe5, 0x22, 0x69, 0x93, 0x2e, 0x92,
+    0xfe, 0x45, 0x96, 0x40, 0x49, 0xe3, 0xe7, 0x8f, 0x35, 0xd6, 0x94, 0x57, 0x3b, 0xae, 0x44, 0xc4,
+    0x2d, 0x33, 0x92, 0x85, 0x52, 0x1d, 0x1f, 0x35, 0xd6, 0xb9, 0x33, 0xf8, 0xec, 0xf9, 0x81, 0x02,
+    0x15, 0xc1, 0xbe, 0x69, 0xf4, 0xaf, 0x5d, 0x9d, 0x33, 0x82, 0x8b, 0x61, 0x2a, 0x5b, 0x9a, 0x9d,
+    0x0f, 0x1b, 0x5b, 0x0e, 0x72, 0xb2, 0xdc, 0x31, 0xf4, 0x18, 0xdb, 0x90, 0xf2, 0x81, 0xe9, 0x51,
+    0x5a, 0x71, 0x35, 0xf6, 0xef, 0x9b, 0x65, 0xd5, 0x9d, 0x88, 0x36, 0xc6, 0x5c, 0x9f, 0x56, 0x66,
+    0xb1, 0x15, 0x77, 0x15, 0x9f, 0x2a, 0xb3, 0x8d, 0xee, 0xbf, 0x51, 0x75, 0x97, 0xbb, 0x59, 0x0f,
+    0x1e, 0x75, 0x83, 0x2e, 0xe6, 0x3c, 0x38, 0xe4, 0x07, 0xe8, 0xb4, 0xb7, 0x02, 0x36, 0xa1, 0xea,
+    0xfb, 0x97, 0x65, 0xa5, 0x8a, 0xd6, 0x94, 0xb6, 0xac, 0xa8, 0xb8, 0xac, 0xde, 0x64, 0x43, 0x09,
+    0xa6, 0x48, 0x48, 0x46, 0xb4, 0xb3, 0x8c, 0x61, 0x4d, 0xb8, 0xe6, 0x42, 0x9b, 0xf1, 0x5a, 0x47,
+    0x5c, 0x77, 0x83, 0x82, 0x57, 0x49, 0x62, 0xf7, 0x2a, 0x0f, 0x7a, 0x65, 0x48, 0xe8, 0xfb, 0x7b,
+    0xf1, 0x17, 0x15, 0x64, 0xed, 0x1f, 0x66, 0xbb, 0xaa, 0xbf, 0xda, 0x62, 0xe2, 0x7f, 0xd3, 0x4f,
+    0x36, 0xd9, 0xce, 0xec, 0x55, 0x31, 0xe9, 0x5d, 0x55, 0x44, 0x0e, 0x12, 0x14, 0x60, 0xa0, 0x62,
+    0x4f, 0x36, 0x09, 0x28, 0x61, 0xe1, 0x94, 0xa2, 0xfe, 0x91, 0xd5, 0xd8, 0x99, 0x07, 0xbb, 0xda,
+    0x48, 0x9c, 0x33, 0xf8, 0x51, 0x0a, 0x77, 0xb2, 0xd1, 0x2c, 0x68, 0xb2, 0x31, 0xb9, 0xcf, 0x57,
+    0x09, 0xf7, 0xe3, 0xbf, 0xda, 0x23, 0x7f, 0xac, 0x53, 0x61, 0x87, 0x22, 0x9d, 0x23, 0x36, 0x95,
+    0xdb, 0x40, 0xcf, 0xdd, 0x8e, 0xa5, 0x98, 0x41, 0xf9, 0x84, 0x54, 0x12, 0xad, 0x38, 0x93, 0x7f,
+    0xb8, 0x9d, 0x7d, 0x30, 0xbb, 0xd4, 0xf1, 0xda, 0x33, 0xc5, 0xcf, 0x23, 0x23, 0x42, 0xf0, 0x55,
+    0x93, 0xcd, 0x49, 0xa9, 0xa7, 0x44, 0x77, 0xde, 0x4c, 0x47, 0x56, 0x71, 0xf6, 0x52, 0xd7, 0xdf,
+    0xe7, 0xdc, 0x95, 0x08, 0x5d, 0xbb, 0xe4, 0x91, 0x86, 0x5e, 0x12, 0x9a, 0x09, 0x61, 0x0e, 0xab,
+    0xec, 0x91, 0x21, 0x8c, 0x8d, 0xf6, 0xb6, 0x49, 0x98, 0x08, 0x7c, 0x66, 0xb3, 0x33, 0x05, 0xed,
+    0xaf, 0x70, 0xbe, 0x64, 0x57, 0x38, 0x0e, 0x59, 0x38, 0x5e, 0xb3, 0xd2, 0xfa, 0x42, 0x0c, 0x38,
+    0xdc, 0x61, 0x6d, 0x45, 0xa0, 0x30, 0x51, 0x71, 0xd0, 0x34, 0xfb, 0xa5, 0x8e, 0x7c, 0xb0, 0xa2,
+    0xe5, 0x2b, 0x31, 0xbd, 0x93, 0xfd, 0xd7, 0xce, 0x88, 0x4c, 0xba, 0xed, 0x5c, 0x2f, 0xc6, 0xe4,
+    0x52, 0xb8, 0x42, 0x8a, 0x5d, 0x03, 0x33, 0x2d, 0x83, 0x98, 0xeb, 0x1b, 0x53, 0x18, 0x7a, 0x6d,
+    0xd9, 0x3d, 0x2c, 0x5e, 0x7a, 0x6a, 0xfd, 0xb2, 0xca, 0x8a, 0xf3, 0x76, 0xfe, 0x11, 0x81, 0xd0,
+    0x7d, 0xba, 0xfa, 0x82, 0xbe, 0x67, 0xde, 0xe4, 0x2f, 0x8d, 0xf3, 0xd9, 0x54, 0xf0, 0x5f, 0x61,
+    0x19, 0xe9, 0x27, 0x35, 0x87, 0x71, 0x43, 0x6a, 0x51, 0x7a, 0xee, 0x0c, 0x83, 0xf7, 0xa9, 0x89,
+    0xb0, 0xdb, 0xdc, 0x64, 0x95, 0x83, 0x96, 0x05, 0x8f, 0xaf, 0xeb, 0x59, 0x3f, 0x72, 0xb2, 0x2c,
+    0x8b, 0x57, 0xe4, 0x8a, 0x35, 0xd4, 0x08, 0xdd, 0xfd, 0x05, 0xa5, 0xbf, 0xdd, 0x7e, 0xd7, 0xb7,
+    0x57, 0xa9, 0xdc, 0xbf, 0xf6, 0x33, 0x92, 0x6a, 0x35, 0x43, 0x34, 0x37, 0x84, 0x37, 0xb3, 0xa5,
+    0x61, 0x2e, 0x09, 0xc8, 0xb0, 0x3f, 0x95, 0x1f, 0xa3, 0xd4, 0x7d, 0xa0, 0x98, 0xbd, 0xad, 0xd3,
+    0x4d, 0xd2, 0x1e, 0x86, 0x8f, 0xce, 0x89, 0xa5, 0x8c, 0xb9, 0x91, 0xb2, 0x4e, 0x2b, 0x6e, 0x63,
+    0xd6, 0x41, 0x82, 0xe9, 0xde, 0x35, 0x2f, 0xfe, 0x1c, 0x32, 0xf0, 0xbb, 0x7e, 0x54, 0xec, 0x42,
+    0x57, 0x66, 0x23, 0xb7, 0x96, 0x45, 0x73, 0xe7, 0x65, 0x80, 0xc9, 0xf6, 0xfc, 0xd9, 0x47, 0xf6,
+    0x0a, 0x06, 0xd9, 0x4b, 0xf5, 0x92, 0x7f, 0x5d, 0x25, 0xc2, 0x83, 0x90, 0x5f, 0x7e, 0xd0, 0x92,
+    0x7c, 0x25, 0xb6, 0x72, 0xd5, 0x88, 0xb3, 0xf0, 0xdf, 0x6c, 0xf3, 0x47, 0x1b, 0x31, 0x01, 0x8b,
+    0x64, 0x5f, 0x18, 0x97, 0x32, 0xcd, 0x7d, 0xac, 0xf2, 0xf2, 0x9c, 0x8c, 0x54, 0x6e, 0xa7, 0x48,
+    0x3b, 0xcd, 0xcd, 0xd1, 0xa7, 0x93, 0x39, 0x55, 0x89, 0xbe, 0xc8, 0x9b, 0xd9, 0x8d, 0x40, 0x2c,
+    0x9b, 0x1e, 0x55, 0xec, 0x07, 0x52, 0x51, 0xa3, 0x7c, 0x82, 0xe9, 0x68, 0x5e, 0x33, 0x76, 0xdb,
+    0x58, 0x2c, 0x66, 0x6c, 0x2d, 0x28, 0x19, 0x33, 0x68, 0xa5, 0x9e, 0x48, 0x93, 0xc5, 0x66, 0x04,
+    0xec, 0x98, 0x28, 0x67, 0x4c, 0x29, 0xf2, 0x5c, 0x42, 0xcf, 0x10, 0xbd, 0x9a, 0x2f, 0xab, 0xbe,
+    0x98, 0xd4, 0x25, 0x53, 0xac, 0x68, 0x86, 0xcb, 0x6f, 0xdf, 0xf6, 0xc3, 0xb3, 0x45, 0x27, 0x83,
+    0x22, 0x8f, 0xd3, 0x5c, 0xad, 0x29, 0x11, 0x79, 0xa5, 0xdf, 0x98, 0xb8, 0x91, 0x95, 0xee, 0x4f,
+    0x36, 0x1b, 0x9b, 0x22, 0x7f, 0x3d, 0x26, 0x25, 0xc9, 0xe9, 0x8d, 0xa9, 0x22, 0x0d, 0x5a, 0x8e,
+    0xcf, 0xeb, 0x09, 0xfc, 0xdd, 0xf0, 0x9a, 0x14, 0x43, 0x96, 0x33, 0x32, 0x17, 0xc4, 0x38, 0x30,
+    0x8d, 0xd0, 0xbf, 0x4f, 0xef, 0x70, 0x1e, 0xf4, 0x2b, 0xc5, 0x31, 0x39, 0xe7, 0x44, 0x47, 0x10,
+    0xa1, 0x1e, 0x77, 0x78, 0x89, 0x69, 0x20, 0xb2, 0xae, 0x6e, 0x35, 0x29, 0xfd, 0xa6, 0x41, 0x21,
+    0xf2, 0x39, 0x61, 0xfb, 0x3a, 0xf9, 0x0f, 0x7b, 0x63, 0xfe, 0x42, 0x51, 0xc9, 0x65, 0x67, 0x8e,
+    0x08, 0x66, 0x45, 0xfc, 0xbf, 0x56, 0x28, 0x0f, 0x1c, 0xe8, 0xcd, 0x0a, 0x0d, 0x69, 0xba, 0x5e,
+    0x4d, 0x72, 0x87, 0xcf, 0x0c, 0x52, 0x71, 0x28, 0xc8, 0xad, 0x9f, 0xf8, 0x89, 0x5c, 0xc3, 0xf0,
+    0xff, 0xae, 0xdc, 0xbb, 0xc2, 0xc3, 0x52, 0x98, 0x32, 0x52, 0x04, 0x2b, 0xce, 0x6e, 0x6e, 0xcc,
+    0x56, 0xb2, 0x4b, 0xe7, 0x4e, 0x48, 0xd3, 0x76, 0xdf, 0xa3, 0x66, 0x1e, 0x59, 0xdb, 0xf9, 0xd6,
+    0x65, 0x7f, 0x08, 0xc4, 0x2c, 0xf9, 0x98, 0x93, 0x4c, 0x71, 0x6f, 0xeb, 0x5c, 0x09, 0x45, 0x76,
+    0xec, 0x59, 0xed, 0xf2, 0x4f, 0x7e, 0x8e, 0x3f, 0xf2, 0x2f, 0xe1, 0xc2, 0xf5, 0xba, 0x8e, 0x51,
+    0x62, 0x84, 0xcf, 0xba, 0xe2, 0x88, 0x26, 0xdc, 0xfb, 0xe2, 0x93, 0xfa, 0x14, 0x11, 0xf8, 0x4c,
+    0xdb, 0x8b, 0x73, 0xa9, 0x9f, 0x9a, 0xa4, 0xd9, 0x4c, 0xd2, 0x78, 0x2e, 0xa2, 0xe1, 0x6e, 0x46,
+    0xaa, 0xbf, 0xfc, 0x2a, 0xfe, 0xfa, 0x90, 0x33, 0x24, 0xd5, 0x71, 0x23, 0x79, 0x5c, 0xbc, 0x95,
+    0x86, 0xe1, 0xa1, 0x1f, 0x96, 0x63, 0x74, 0xf9, 0x84, 0x85, 0xc1, 0x87, 0x7d, 0x6a, 0xd9, 0xf9,
+    0x3c, 0x4b, 0xb4, 0xf3, 0x95, 0x08, 0xad, 0x9e, 0x4d, 0xc5, 0xb1, 0x2a, 0x15, 0x6d, 0x8e, 0x60,
+    0x45, 0x02, 0x79, 0x13, 0x7d, 0xe0, 0xba, 0xe3, 0x87, 0x47, 0xe0, 0x29, 0xe9, 0x82, 0xa8, 0x5a,
+    0x23, 0xa5, 0xb4, 0xb8, 0x5d, 0xbe, 0xd8, 0x8b, 0x50, 0x73, 0x50, 0x80, 0x15, 0xb6, 0x03, 0x41,
+    0x3e, 0xce, 0x45, 0xe6, 0xe8, 0xcd, 0x3f, 0x06, 0x59, 0xe9, 0x60, 0x8e, 0x85, 0x1d, 0x9f, 0x36,
+    0x1b, 0xf5, 0x9e, 0xe1, 0xc2, 0x8e, 0x74, 0x66, 0xb5, 0x75, 0xb7, 0xa7, 0xf9, 0x0a, 0xf6, 0x9a,
+    0x8c, 0x93, 0x01, 0x6b, 0xe6, 0xe4, 0x02, 0xc3, 0xeb, 0xf0, 0x66, 0x1c, 0x93, 0xf6, 0x07, 0x5e,
+    0xc9, 0x68, 0x76, 0xc3, 0x09, 0xa4, 0xb5, 0xcc, 0x98, 0xac, 0x47, 0xb5, 0x14, 0x06, 0xc8, 0x2d,
+    0x43, 0x54, 0x1e, 0x7e, 0x3c, 0x69, 0x52, 0x23, 0xc5, 0xa8, 0x5a, 0x36, 0x1b, 0xbf, 0xca, 0xd5,
+    0x26, 0xbc, 0x44, 0xee, 0x19, 0x91, 0xbd, 0xcc, 0x55, 0x2b, 0xa4, 0x92, 0x09, 0xec, 0x90, 0x8b,
+    0x3c, 0x43, 0x0e, 0xdb, 0x7f, 0xf7, 0x8d, 0x17, 0xb9, 0xce, 0xdf, 0x5a, 0xca, 0xf5, 0x15, 0x9a,
+    0xb4, 0xb0, 0xf0, 0x3e, 0xce, 0xae, 0x6f, 0x09, 0x5f, 0xea, 0x57, 0xd7, 0xf6, 0xfb, 0xb6, 0xb2,
+    0xa6, 0xa1, 0xd5, 0xa6, 0x76, 0xf2, 0xb3, 0xfe, 0xd8, 0x81, 0xfa, 0x25, 0x80, 0x24, 0x1b, 0xa3,
+    0xb7, 0xd8, 0xa2, 0xff, 0x14, 0x60, 0xf0, 0x71, 0xda, 0xbf, 0xe3, 0x4f, 0x88, 0x22, 0x91, 0x7b,
+    0xb4, 0xa1, 0xea, 0xc7, 0x9e, 0xfd, 0x7e, 0xa6, 0xd6, 0xf6, 0x13, 0x78, 0xbd, 0xa0, 0x58, 0x44,
+    0x28, 0xda, 0xfc, 0x35, 0x6b, 0x6f, 0x25, 0xeb, 0x7b, 0x2f, 0x0d, 0xaf, 0xc7, 0x33, 0x5f, 0x4c,
+    0xfe, 0x16, 0x9a, 0x0c, 0x74, 0x26, 0xf9, 0x7e, 0x8f, 0x9e, 0x0e, 0xd6, 0x0a, 0xfd, 0x76, 0x26,
+    0xdf, 0xfd, 0xdc, 0x77, 0x5f, 0x2c, 0xac, 0xd4, 0xf0, 0xe9, 0x90, 0xca, 0x78, 0x58, 0x5d, 0x27,
+    0x0d, 0x8d, 0x17, 0xea, 0x61, 0x7e, 0x13, 0xca, 0xc5, 0xbf, 0x1e, 0x3a, 0x19, 0x5e, 0x10, 0x1a,
+    0x6a, 0x45, 0xd1, 0x34, 0xf5, 0xf7, 0x3d, 0x2b, 0xe7, 0xae, 0xa0, 0xf9, 0x4e, 0x21, 0xe7, 0xed,
+    0xed, 0x15, 0x1e, 0xa7, 0x7d, 0x27, 0xb3, 0xe0, 0xe9, 0xf7, 0x89, 0x2a, 0x7b, 0xe8, 0xff, 0x8a,
+    0xaa, 0xa2, 0xd2, 0xf3, 0xe4, 0xea, 0xfc, 0x12, 0x9e, 0xd4, 0xb2, 0x68, 0x62, 0x71, 0x0c, 0x0b,
+    0x8d, 0x15, 0x06, 0x6d, 0xff, 0x06, 0x1f, 0xbe, 0x71, 0x94, 0x73, 0xee, 0x12, 0xaa, 0x86, 0x06,
+    0x8f, 0x06, 0x61, 0x7d, 0x80, 0x24, 0xa9, 0x95, 0x90, 0x3b, 0xe4, 0xda, 0x56, 0xf1, 0xcd, 0x9d,
+    0xbf, 0x87, 0xe1, 0x19, 0x09, 0xcf, 0x5b, 0xe6, 0x07, 0xb1, 0x6b, 0x86, 0xcb, 0xa7, 0xea, 0x50,
+    0x61, 0xf3, 0x29, 0xf2, 0xe1, 0xbd, 0xe0, 0x70, 0x72, 0x59, 0xe6, 0x73, 0xb1, 0x80, 0x01, 0xc9,
+    0x39, 0x08, 0x59, 0x2e, 0xf1, 0xc8, 0xb8, 0xe2, 0x99, 0x51, 0x2d, 0xe1, 0x26, 0x19, 0x1e, 0xfc,
+    0x3e, 0x33, 0x58, 0x55, 0x83, 0xf5, 0xcc, 0xc3, 0xe4, 0x24, 0x0e, 0x16, 0xca, 0x11, 0xa1, 0x31,
+    0x28, 0xdb, 0x52, 0xe5, 0xe2, 0x49, 0x7d, 0x8d, 0x04, 0xeb, 0xbb, 0x6e, 0xda, 0x46, 0xca, 0xa8,
+    0xc5, 0x1f, 0xcf, 0x2b, 0x5e, 0x54, 0x6f, 0x64, 0x3e, 0xfd, 0x90, 0x09, 0x66, 0xb6, 0xd1, 0xf4,
+    0x62, 0x84, 0x85, 0x25, 0xa1, 0x19, 0x55, 0xc5, 0x79, 0xaa, 0x3e, 0x72, 0xcf, 0xfc, 0x48, 0xe7,
+    0xb2, 0x5a, 0xcf, 0x32, 0xd2, 0x85, 0x57, 0x02, 0xa2, 0x31, 0x12, 0xb2, 0xe5, 0xd3, 0x74, 0xb7,
+    0xfa, 0x03, 0xe8, 0x93, 0x4b, 0xc9, 0xf9, 0x47, 0xb7, 0x26, 0x9f, 0xac, 0x05, 0x99, 0x4b, 0xfd,
+    0x6b, 0x0a, 0x6a, 0xf4, 0x3e, 0xe9, 0x15, 0xbe, 0xcf, 0xbf, 0xd8, 0x87, 0x7e, 0x48, 0x0a, 0xee,
+    0xc4, 0xbc, 0x0e, 0x08, 0x7d, 0x52, 0x56, 0xeb, 0x61, 0x82, 0xac, 0x5d, 0x33, 0x8b, 0x63, 0x70,
+    0x37, 0x39, 0x51, 0x1c, 0xa5, 0x2c, 0x5f, 0x28, 0x1a, 0x72, 0xe4, 0xb2, 0x7d, 0xb2, 0x60, 0xd5,
+    0x7e, 0x54, 0x64, 0x0b, 0xe0, 0x68, 0xcf, 0x35, 0xe2, 0x68, 0x14, 0xd6, 0x72, 0x7d, 0xcd, 0xfd,
+    0x46, 0x17, 0x67, 0xaa, 0xd3, 0xbb, 0x2a, 0x12, 0xc4, 0xf5, 0xfe, 0xe4, 0xa3, 0x94, 0xd9, 0xd8,
+    0xb6, 0xef, 0xab, 0x5b, 0xdb, 0xc3, 0x09, 0x76, 0x39, 0x7a, 0xbf, 0xc6, 0xb7, 0x39, 0x31, 0x4d,
+    0xdb, 0xcf, 0x2d, 0x6f, 0xf4, 0x24, 0xca, 0x9f, 0x6a, 0xa9, 0x29, 0x66, 0x7c, 0xf3, 0xe3, 0x7c,
+    0x70, 0x4a, 0x87, 0x7f, 0x7e, 0xce, 0x66, 0xd8, 0x8b, 0x2d, 0x12, 0x12, 0xa0, 0x92, 0x52, 0xb3,
+    0xee, 0x9d, 0xb9, 0xb4, 0x2b, 0x32, 0x30, 0xd6, 0x48, 0x1d, 0xeb, 0x45, 0x91, 0xbc, 0x4e, 0x56,
+    0xc3, 0x9e, 0x1f, 0x91, 0xac, 0x4a, 0xd4, 0x89, 0x8a, 0xc1, 0xad, 0x27, 0xab, 0x1b, 0x43, 0xa5,
+    0x99, 0x3a, 0x83, 0xcb, 0x1d, 0x58, 0x9a, 0xec, 0x79, 0x6d, 0xf1, 0x56, 0x50, 0x74, 0x56, 0xbd,
+    0xc4, 0x16, 0xef, 0x3f, 0x5a, 0x5f, 0x31, 0x29, 0x5a, 0x53, 0xff, 0x2c, 0xbb, 0xf0, 0xa3, 0x2b,
+    0xd2, 0xf7, 0x61, 0xe2, 0xcd, 0x75, 0xd8, 0xc6, 0x83, 0x13, 0x19, 0x61, 0xd4, 0x87, 0xd8, 0x81,
+    0xd6, 0x2a, 0x3e, 0x66, 0x78, 0x29, 0x12, 0x4d, 0x8d, 0x39, 0x87, 0x2a, 0xb2, 0xb2, 0x48, 0xc5,
+    0xa7, 0x67, 0x09, 0xa3, 0x54, 0xb4, 0x95, 0x86, 0xb7, 0x81, 0xa9, 0x6b, 0x54, 0x61, 0x9a, 0x2f,
+    0x5d, 0x82, 0xce, 0xc7, 0x76, 0x25, 0xea, 0x0a, 0xdd, 0xb9, 0x9a, 0xea, 0xc9, 0x94, 0xc0, 0x40,
+    0x08, 0x9d, 0xad, 0x57, 0x26, 0xf5, 0x5f, 0x41, 0xb3, 0x96, 0x44, 0x75, 0x11, 0xb5, 0x22, 0x29,
+    0x42, 0x85, 0xdb, 0xa3, 0x5f, 0x9a, 0xbe, 0x8d, 0x2f, 0xeb, 0x64, 0x85, 0xf1, 0xa2, 0x84, 0x38,
+    0xfa, 0x40, 0xb9, 0x8c, 0xba, 0xfe, 0x0d, 0x76, 0x6e, 0xd7, 0x33, 0xcd, 0x47, 0x86, 0x50, 0x22,
+    0x4d, 0xc3, 0xa9, 0xb2, 0x77, 0x86, 0xb9, 0xeb, 0x76, 0x70, 0x30, 0xa5, 0x7f, 0xe9, 0x2d, 0x8d,
+    0x4a, 0x36, 0x9a, 0x39, 0x53, 0x4d, 0x22, 0x12, 0xbc, 0xfb, 0x59, 0xa9, 0xcc, 0xbb, 0x05, 0xd1,
+    0x3e, 0x7d, 0xad, 0xac, 0xf6, 0xee, 0x3c, 0x30, 0x59, 0x3a, 0xd9, 0x6a, 0x72, 0x49, 0xb3, 0x74,
+    0xc8, 0xc4, 0x5e, 0xa0, 0x86, 0xb8, 0x25, 0x63, 0xc7, 0x85, 0x6e, 0xad, 0xe4, 0xb1, 0x5c, 0x38,
+    0x57, 0xdc, 0x08, 0x83, 0x46, 0xb9, 0x11, 0xfa, 0x7a, 0x7b, 0x10, 0xcb, 0x1f, 0x43, 0xfd, 0x42,
+    0x4b, 0xfe, 0xb9, 0xe5, 0x06, 0xb5, 0x9a, 0xf1, 0x9f, 0xda, 0x5d, 0xb9, 0x88, 0xc6, 0xe6, 0x2f,
+    0x8a, 0x25, 0xcc, 0xc4, 0x50, 0x01, 0xec, 0x40, 0x5c, 0x8e, 0x2f, 0xb3, 0x65, 0x61, 0x06, 0x9e,
+    0x0c, 0x9c, 0xe6, 0x7a, 0xba, 0xa5, 0xd9, 0xda, 0x0b, 0x13, 0x2d, 0x19, 0x9e, 0xff, 0xbe, 0xcb,
+    0xae, 0xd3, 0x97, 0xb6, 0x73, 0xcd, 0xa9, 0x69, 0x6e, 0x96, 0x9c, 0xfa, 0x16, 0xe1, 0x7b, 0x87,
+    0x8a, 0x1e, 0x46, 0xa8, 0x16, 0x84, 0xbc, 0xfe, 0x5c, 0xbe, 0xcd, 0xee, 0x59, 0x22, 0x8c, 0xba,
+    0x1f, 0xfb, 0x94, 0x61, 0x7f, 0x33, 0x9d, 0xbb, 0x6c, 0xbb, 0xfa, 0x9d, 0x12, 0x65, 0x43, 0x70,
+    0xb9, 0xb5, 0x1d, 0xae, 0xfb, 0x16, 0x16, 0x83, 0xb4, 0x57, 0x22, 0x37, 0x87, 0x9a, 0x0a, 0x12,
+    0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07,
+    0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81,
+    0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0,
+    0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8,
+    0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe,
+    0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f,
+    0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0xff, 0x03, 0xbe, 0x1d, 0x0a, 0xf8, 0x76, 0xe0, 0xdb,
+    0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76,
+    0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d,
+    0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07,
+    0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81,
+    0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0,
+    0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8,
+    0x76, 0xe0, 0xdb, 0xff, 0x03, 0xbe, 0x1d, 0x1a, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe,
+    0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f,
+    0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb,
+    0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76,
+    0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d,
+    0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07,
+    0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0xff,
+    0x03, 0xbe, 0x1d, 0x06, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0,
+    0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8,
+    0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe,
+    0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f,
+    0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb,
+    0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76,
+    0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0xff, 0x03, 0xbe, 0x1d, 0x16,
+    0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07,
+    0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81,
+    0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0,
+    0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8,
+    0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe,
+    0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f,
+    0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0xff, 0x03, 0xbe, 0x1d, 0x0e, 0xf8, 0x76, 0xe0, 0xdb,
+    0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76,
+    0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d,
+    0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07,
+    0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81,
+    0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0,
+    0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8,
+    0x76, 0xe0, 0xdb, 0xff, 0x03, 0xbe, 0x1d, 0x1e, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe,
+    0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f,
+    0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb,
+    0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76,
+    0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d,
+    0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07,
+    0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0xff,
+    0x03, 0xbe, 0x1d, 0x01, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0,
+    0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8,
+    0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe,
+    0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f,
+    0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb,
+    0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76,
+    0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0xff, 0x03, 0xbe, 0x1d, 0x11,
+    0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07,
+    0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81,
+    0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0,
+    0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8,
+    0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe,
+    0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f,
+    0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0xff, 0x03, 0xbe, 0x1d, 0x09, 0xf8, 0x76, 0xe0, 0xdb,
+    0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76,
+    0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d,
+    0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07,
+    0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81,
+    0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0,
+    0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8, 0x76, 0xe0, 0xdb, 0x81, 0x6f, 0x07, 0xbe, 0x1d, 0xf8,
+    0x76, 0xe0, 0xdb, 0xff, 0x03, 0xbe, 0xfd, 0x7f, 0xcb, 0xe0, 0x26, 0x87, 0xa0, 0x03, 0x02, 0x00,
+};
+
+static const uint8_t big_lz4_payload[12611] = {
+    0x04, 0x22, 0x4d, 0x18, 0x44, 0x40, 0x5e, 0xfc, 0x2f, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x01, 0x00, 0x7a, 0xa0, 0x7e,
+    0xe1, 0xea, 0xf2, 0x3d, 0xc7, 0x39, 0x6d, 0x0d, 0xa6, 0x78, 0x16, 0x80, 0x05, 0x12, 0x3a, 0xa7,
+    0x4e, 0xde, 0x9f, 0x78, 0x9c, 0x70, 0x63, 0x00, 0x0b, 0xe6, 0xc8, 0x25, 0x21, 0x3d, 0xad, 0x22,
+    0xbc, 0x70, 0xb3, 0x85, 0xda, 0x21, 0x23, 0x63, 0x36, 0x17, 0x7b, 0xc3, 0x79, 0xfd, 0x62, 0x6c,
+    0xf9, 0x66, 0x43, 0xf1, 0x1f, 0xbd, 0x61, 0x63, 0xbd, 0x7c, 0x99, 0x90, 0x67, 0xf3, 0xd1, 0x98,
+    0xf0, 0x8c, 0x88, 0xd3, 0x90, 0x34, 0x3f, 0x14, 0xd1, 0xaa, 0xff, 0x72, 0x48, 0x27, 0x35, 0xf9,
+    0xde, 0x34, 0x4e, 0xb0, 0x4a, 0x10, 0xd8, 0xd5, 0x83, 0x7e, 0x10, 0xa4, 0x57, 0x4d, 0xd7, 0x31,
+    0x39, 0x3c, 0x26, 0x9f, 0x56, 0x69, 0x48, 0x3b, 0x0d, 0x32, 0x34, 0xa7, 0x0c, 0x79, 0x3d, 0x1a,
+    0x24, 0x37, 0xbf, 0xc2, 0x8b, 0xd2, 0x16, 0x20, 0xcf, 0x84, 0x7c, 0xbe, 0xc6, 0xba, 0xbb, 0xf4,
+    0x77, 0x3f, 0x32, 0x89, 0xc9, 0xbb, 0xae, 0xed, 0x0b, 0x7d, 0x14, 0xa7, 0x1e, 0xe0, 0xed, 0x3c,
+    0x0f, 0x8f, 0x3e, 0xb7, 0x78, 0xb6, 0x7e, 0x23, 0x38, 0x04, 0x7c, 0x01, 0x4d, 0x4b, 0x54, 0x38,
+    0xbd, 0xcc, 0x3a, 0xf0, 0x63, 0x23, 0x20, 0xc6, 0x4b, 0x4b, 0xfb, 0xff, 0xbd, 0x42, 0x33, 0x75,
+    0x5f, 0xff, 0x20, 0xe5, 0x40, 0x6d, 0x89, 0x6f, 0xf6, 0x43, 0x77, 0xf8, 0xf4, 0x1f, 0x1e, 0x04,
+    0x87, 0xba, 0x00, 0xe4, 0x21, 0x6e, 0x90, 0xf1, 0x46, 0xfd, 0xfd, 0x02, 0x47, 0x05, 0x2a, 0x17,
+    0x9e, 0x5f, 0xd9, 0x80, 0x78, 0x69, 0x83, 0x0a, 0x73, 0x67, 0xd2, 0x82, 0x9c, 0x0b, 0x03, 0xe3,
+    0xc0, 0xf4, 0x9d, 0x33, 0x74, 0xf1, 0x9f, 0x58, 0x1a, 0x8e, 0x02, 0x27, 0x78, 0x51, 0xb6, 0xeb,
+    0x45, 0x10, 0x6d, 0x4a, 0xad, 0xfe, 0x90, 0x66, 0xc1, 0xe1, 0xe6, 0xbf, 0x8c, 0x9d, 0x9f, 0x30,
+    0xe8, 0xe4, 0x1a, 0xdc, 0x28, 0xb7, 0x40, 0xd7, 0xe3, 0x78, 0x2c, 0xcb, 0x8c, 0x01, 0x96, 0x34,
+    0x26, 0x51, 0xcb, 0x32, 0xab, 0x0a, 0x18, 0x14, 0x3f, 0x03, 0xad, 0x2e, 0x12, 0x58, 0x57, 0xd6,
+    0x7b, 0x4d, 0xda, 0x20, 0xc6, 0xee, 0xf2, 0x4f, 0xe2, 0x32, 0xe1, 0x2f, 0x21, 0x7a, 0x79, 0x04,
+    0x23, 0x65, 0x59, 0xc3, 0x27, 0x19, 0xa5, 0x14, 0x3f, 0x4e, 0x2f, 0x73, 0xa9, 0xe6, 0x5d, 0x22,
+    0x07, 0xc5, 0x1d, 0xbf, 0x1e, 0xb3, 0xd0, 0x2e, 0x12, 0x0a, 0x33, 0x3b, 0x66, 0x66, 0x47, 0xe7,
+    0x7d, 0xa4, 0x3b, 0xbd, 0x19, 0x43, 0xbd, 0xe0, 0x5b, 0x02, 0x14, 0x4c, 0x10, 0x96, 0xd5, 0xe4,
+    0x05, 0x23, 0x57, 0x10, 0x8a, 0x7b, 0xea, 0xda, 0x70, 0x66, 0x51, 0x22, 0xc7, 0x7a, 0xbd, 0x57,
+    0x66, 0xed, 0xdb, 0x6a, 0x81, 0x37, 0x07, 0x40, 0x35, 0x68, 0x62, 0xe3, 0x54, 0x33, 0x55, 0x93,
+    0x89, 0x99, 0x15, 0x43, 0x3d, 0x77, 0x50, 0x7e, 0xe9, 0x2c, 0x42, 0x6c, 0x4f, 0x63, 0xce, 0x48,
+    0x4a, 0x99, 0x3a, 0x57, 0x1a, 0x56, 0x1f, 0x79, 0xf9, 0xb5, 0xab, 0xc9, 0x2e, 0x6c, 0xcc, 0x04,
+    0xcb, 0x99, 0x3e, 0x50, 0x0d, 0x19, 0x4c, 0x1e, 0x4d, 0x32, 0x50, 0xb0, 0xb7, 0x68, 0xd7, 0x76,
+    0xcb, 0xb2, 0x4e, 0x60, 0x87, 0x73, 0xa0, 0xa3, 0xf3, 0x34, 0x81, 0x8a, 0x59, 0xe1, 0x21, 0x3f,
+    0x7c, 0x10, 0x2d, 0x2d, 0xac, 0xdc, 0x16, 0xfb, 0xac, 0xc8, 0x10, 0xea, 0x12, 0x24, 0x18, 0xf6,
+    0x21, 0xb5, 0xeb, 0x01, 0xb2, 0xc0, 0xd3, 0x78, 0x2b, 0xa5, 0x86, 0x17, 0x0c, 0xb3, 0xc8, 0xbf,
+    0x61, 0x67, 0x27, 0x5b, 0x97, 0x3e, 0xe7, 0xfe, 0x21, 0x60, 0x61, 0x67, 0x6a, 0xbb, 0xa8, 0x8b,
+    0x92, 0xa7, 0x3a, 0x79, 0x9d, 0xea, 0x70, 0x5e, 0x2a, 0x9d, 0x68, 0x86, 0xbe, 0x2e, 0x8d, 0x58,
+    0x56, 0xa5, 0x74, 0xbf, 0x7d, 0xe4, 0x76, 0xaa, 0xe3, 0x56, 0xfe, 0xbb, 0x5c, 0xd8, 0x9b, 0xad,
+    0x5d, 0xbb, 0x9f, 0x2d, 0x9d, 0xb4, 0x55, 0x18, 0x49, 0xa2, 0x3d, 0x19, 0x63, 0x4f, 0x27, 0xd5,
+    0x60, 0xcf, 0x83, 0xbc, 0xfb, 0xef, 0x79, 0x62, 0x24, 0x1a, 0xa2, 0xbc, 0x41, 0x04, 0x77, 0x53,
+    0xbc, 0x79, 0xd3, 0x8b, 0x1a, 0x4a, 0xb5, 0xc0, 0xfb, 0x9e, 0x02, 0x48, 0xf4, 0x45, 0x35, 0xea,
+    0x56, 0x5d, 0x70, 0x93, 0x5f, 0xa7, 0xd4, 0xfe, 0x3a, 0x6f, 0xd6, 0x7b, 0x03, 0x22, 0x1e, 0x25,
+    0x0e, 0xc8, 0x2a, 0x24, 0x66, 0x52, 0x55, 0x5b, 0x5a, 0x52, 0xf3, 0xe7, 0x51, 0xad, 0x58, 0xe5,
+    0x24, 0x31, 0xe9, 0x7d, 0xf1, 0x75, 0x81, 0x98, 0x58, 0xd1, 0x52, 0x11, 0x6a, 0xa4, 0xbb, 0xa8,
+    0x95, 0x30, 0x62, 0x3a, 0x49, 0xa3, 0x37, 0x86, 0x76, 0xa8, 0xef, 0xec, 0x9c, 0xfe, 0xaa, 0x63,
+    0xe5, 0x43, 0x64, 0xb9, 0x93, 0x2c, 0xf2, 0x7c, 0xab, 0x20, 0x64, 0x61, 0x39, 0xd2, 0x0e, 0xc1,
+    0xe2, 0x4f, 0xd6, 0xb3, 0xac, 0xae, 0x85, 0xf4, 0xdf, 0x98, 0x7d, 0xbe, 0x61, 0x59, 0xa7, 0x5c,
+    0xd0, 0x9a, 0xc3, 0x95, 0xd8, 0x17, 0x78, 0x82, 0xf8, 0x40, 0x0f, 0x74, 0x6a, 0x49, 0x2e, 0x8a,
+    0x07, 0xab, 0x5d, 0xde, 0x8b, 0xb7, 0x36, 0xbb, 0x00, 0x0b, 0x73, 0x33, 0x8f, 0xff, 0x7b, 0x70,
+    0x58, 0x13, 0x8c, 0xf8, 0x2c, 0xed, 0x54, 0x89, 0xcb, 0x67, 0x95, 0x0f, 0x7f, 0xd1, 0x21, 0xaa,
+    0x97, 0xaa, 0xc1, 0x12, 0xef, 0xcf, 0xb7, 0xec, 0xe6, 0xa0, 0x55, 0x4c, 0x13, 0x54, 0x34, 0xa7,
+    0xb9, 0x76, 0x1c, 0x16, 0x69, 0x76, 0x12, 0xfb, 0xe5, 0x6c, 0xce, 0xd2, 0x60, 0x6b, 0x07, 0x4f,
+    0x70, 0x0a, 0x44, 0xd8, 0xf2, 0x66, 0x72, 0x90, 0x36, 0x15, 0xe2, 0xc2, 0x3c, 0x94, 0x04, 0x4c,
+    0x8d, 0x06, 0xff, 0x14, 0xf7, 0xaa, 0x3a, 0xcb, 0x97, 0x4d, 0x67, 0xb0, 0x35, 0x03, 0xe1, 0x18,
+    0xef, 0x35, 0x83, 0x33, 0xee, 0x0f, 0x99, 0x21, 0x69, 0xfa, 0xde, 0x39, 0x9e, 0x9f, 0x7c, 0x17,
+    0x67, 0x95, 0x68, 0xea, 0x07, 0xd3, 0xa3, 0x5b, 0xe7, 0x04, 0x7b, 0x42, 0x58, 0xff, 0x48, 0xea,
+    0x24, 0x4f, 0xe7, 0x61, 0xe5, 0xc7, 0x45, 0x2b, 0xe2, 0xef, 0xf7, 0xf5, 0x2a, 0xe2, 0x80, 0x9c,
+    0x89, 0x9a, 0x8b, 0xb0, 0xa1, 0xc9, 0x17, 0x27, 0xab, 0x8a, 0x12, 0xad, 0x97, 0x80, 0xfa, 0x24,
+    0x5b, 0xc2, 0x0b, 0x46, 0x13, 0xa0, 0x22, 0x97, 0xea, 0x26, 0x8b, 0xc4, 0x10, 0x33, 0xe1, 0x43,
+    0xf6, 0x0c, 0x54, 0x88, 0xa7, 0x39, 0x03, 0xed, 0x6c, 0x55, 0x86, 0xa6, 0x18, 0x3c, 0x38, 0x3d,
+    0xb3, 0x2a, 0x27, 0x34, 0x99, 0xfb, 0x1b, 0x69, 0xb8, 0x8c, 0x4b, 0x2e, 0xfd, 0xbd, 0x38, 0x01,
+    0xfe, 0x83, 0x23, 0x60, 0xb3, 0x07, 0x7c, 0x2e, 0xa5, 0x83, 0x62, 0x55, 0x58, 0xa7, 0xb7, 0x76,
+    0x69, 0x7c, 0x4a, 0xa6, 0x5f, 0x28, 0x6c, 0x18, 0x1a, 0x5a, 0x98, 0xa8, 0x9d, 0x32, 0xd5, 0x15,
+    0x27, 0x27, 0x63, 0x94, 0x86, 0xb0, 0x4d, 0x49, 0xdf, 0xf7, 0x2a, 0xfc, 0xf8, 0xfb, 0xbd, 0xd2,
+    0x79, 0x42, 0x5e, 0xc8, 0x9e, 0x41, 0x65, 0xf6, 0xce, 0xd2, 0x93, 0xc1, 0x37, 0xe5, 0x66, 0x0f,
+    0xf9, 0xc3, 0xff, 0x05, 0x0f, 0xbb, 0x00, 0x96, 0xe1, 0xa5, 0xfd, 0x23, 0x03, 0x0c, 0xc8, 0x11,
+    0x2a, 0x9f, 0x4c, 0xd2, 0x7b, 0xc3, 0xe5, 0xc8, 0x89, 0x4c, 0xde, 0xa9, 0xcd, 0xe0, 0xca, 0xc1,
+    0x3c, 0x50, 0xcf, 0x6c, 0x4b, 0xcf, 0xd0, 0xe9, 0x8d, 0x29, 0x4f, 0x4f, 0x7c, 0xf7, 0x58, 0xf5,
+    0xff, 0x83, 0xd1, 0xfc, 0xb4, 0x55, 0x20, 0xd3, 0x88, 0xf5, 0x43, 0x0d, 0xeb, 0x6f, 0x47, 0xc9,
+    0x27, 0x10, 0x9f, 0xf1, 0x05, 0x5d, 0x58, 0x4c, 0x9a, 0xdb, 0x36, 0xe3, 0x60, 0xeb, 0x2b, 0x5c,
+    0x82, 0x93, 0xde, 0xbb, 0xfe, 0x88, 0x82, 0x6a, 0x4e, 0x00, 0xcb, 0x8b, 0x71, 0xfd, 0xad, 0x44,
+    0x53, 0x25, 0xd2, 0xd7, 0x93, 0xbd, 0x76, 0x50, 0x06, 0x1c, 0xaf, 0x73, 0x14, 0x65, 0x04, 0x2a,
+    0xe7, 0x78, 0xb2, 0x33, 0x4c, 0x79, 0x0f, 0xdd, 0x51, 0x69, 0x79, 0x36, 0x16, 0x38, 0x2b, 0xcc,
+    0xdb, 0xac, 0xec, 0xa3, 0x4b, 0x26, 0xd7, 0xc5, 0xa0, 0x42, 0xbc, 0x45, 0x38, 0x05, 0x4f, 0x62,
+    0xe8, 0x3e, 0x7e, 0xd3, 0x94, 0xc0, 0x66, 0xec, 0x42, 0xa7, 0xb6, 0xd7, 0xdb, 0xb4, 0x81, 0xef,
+    0xa4, 0xc0, 0xd2, 0x05, 0xf0, 0xb2, 0xb1, 0xd1, 0xf2, 0x7f, 0xb4, 0x5b, 0x59, 0x64, 0x04, 0x96,
+    0x12, 0x0b, 0xa8, 0x6d, 0x1e, 0x3a, 0xa3, 0xc4, 0xce, 0x6f, 0x6e, 0x91, 0xbb, 0x21, 0xd7, 0x0d,
+    0x12, 0x63, 0x4c, 0x0d, 0x19, 0x36, 0xc0, 0xdb, 0x90, 0xf9, 0xbb, 0x1d, 0xbe, 0x67, 0x79, 0xbd,
+    0x09, 0x10, 0xbf, 0x32, 0x54, 0xa1, 0x2e, 0x70, 0xe7, 0x63, 0x18, 0xbd, 0xdd, 0x2d, 0xe5, 0x75,
+    0x87, 0xe1, 0x41, 0xa9, 0x33, 0xf6, 0x67, 0xc6, 0x91, 0xdc, 0xd9, 0xc5, 0xde, 0xac, 0x56, 0x8e,
+    0x18, 0xc0, 0x4e, 0xd9, 0x93, 0x56, 0xd4, 0xc4, 0xf0, 0x38, 0x14, 0xd8, 0xda, 0xb6, 0xa3, 0x34,
+    0x76, 0xee, 0xc1, 0x00, 0x5f, 0xe3, 0x32, 0x2e, 0x8f, 0x2b, 0xf3, 0x37, 0xb3, 0x6d, 0x00, 0x3b,
+    0xf0, 0x1d, 0x5e, 0x3b, 0xab, 0x39, 0xc8, 0x06, 0x90, 0x76, 0x14, 0xa4, 0x87, 0x88, 0xbf, 0x16,
+    0xbe, 0xc7, 0xf3, 0x17, 0xb5, 0x78, 0x78, 0x93, 0x95, 0xd8, 0xdc, 0xfb, 0x3c, 0x9e, 0x29, 0x8d,
+    0x09, 0xf6, 0x22, 0x4d, 0x0d, 0xfa, 0x6d, 0x66, 0x5e, 0x39, 0x0d, 0xdd, 0xee, 0x59, 0x26, 0xd1,
+    0xd4, 0xf9, 0xd3, 0x85, 0x0e, 0x8b, 0xef, 0xca, 0x1f, 0x0e, 0x62, 0xa0, 0xb7, 0x84, 0x5f, 0x23,
+    0x80, 0xa4, 0xa9, 0x0f, 0xb0, 0xdc, 0xce, 0xeb, 0x5b, 0x40, 0xa2, 0x89, 0xa8, 0xd5, 0x70, 0xac,
+    0x27, 0xf6, 0x0e, 0x23, 0xac, 0x57, 0xcc, 0x44, 0xd7, 0x12, 0xde, 0xd0, 0x31, 0x67, 0x29, 0x51,
+    0xf2, 0x7c, 0xfa, 0xbb, 0xf0, 0x39, 0xbe, 0x78, 0x1f, 0x00, 0x9d, 0xc3, 0x6e, 0xd7, 0x50, 0x5d,
+    0x75, 0xf9, 0x33, 0x96, 0xb4, 0xa1, 0x5c, 0x79, 0xa3, 0x69, 0xff, 0x00, 0xfa, 0x7d, 0x6c, 0x6d,
+    0x08, 0x5d, 0x0c, 0x8c, 0x51, 0x98, 0xd4, 0xe8, 0x82, 0xa0, 0x32, 0x96, 0x2a, 0xbf, 0xa2, 0xca,
+    0x55, 0x87, 0xbc, 0x23, 0x30, 0x3c, 0x6c, 0xec, 0x3f, 0xf1, 0x32, 0x36, 0xcf, 0x9f, 0xc7, 0x17,
+    0x00, 0xe7, 0x65, 0x8e, 0x31, 0xc3, 0x1e, 0x57, 0x82, 0x96, 0x3c, 0x62, 0x06, 0x5b, 0x35, 0xac,
+    0xe6, 0x49, 0x67, 0xa6, 0xe8, 0x13, 0x5b, 0xe2, 0xc3, 0x60, 0x0e, 0x68, 0x5a, 0x3a, 0x3e, 0xbe,
+    0x62, 0xa7, 0xce, 0xb1, 0x9e, 0xce, 0x68, 0x3d, 0x21, 0x44, 0x57, 0x2f, 0x6b, 0x1f, 0x5b, 0x5c,
+    0xd5, 0x3e, 0xbd, 0xd1, 0x5d, 0x0d, 0xcf, 0x6a, 0x47, 0x5b, 0xe4, 0xe4, 0xd1, 0xf6, 0x32, 0xcf,
+    0x4b, 0xb7, 0x0f, 0xaf, 0x0e, 0x6b, 0x79, 0xf8, 0x9d, 0x9d, 0x71, 0x62, 0x2c, 0x3a, 0xd8, 0x80,
+    0xce, 0x88, 0xa9, 0x9a, 0x05, 0x8a, 0x5f, 0xfa, 0xdb, 0x23, 0x2c, 0x31, 0x82, 0xd9, 0x27, 0xab,
+    0xc3, 0x93, 0x06, 0xce, 0xa1, 0x3f, 0x45, 0xbe, 0x0d, 0xf4, 0x3b, 0xf4, 0x17, 0x96, 0x4f, 0x16,
+    0xfb, 0x25, 0xb8, 0xc6, 0x05, 0xca, 0x60, 0xbb, 0x2e, 0x3c, 0xf4, 0xef, 0x65, 0x8e, 0x0f, 0xe5,
+    0xbf, 0x2a, 0xf3, 0x8a, 0x71, 0x7a, 0x39, 0x15, 0x70, 0x30, 0xfa, 0xa2, 0x8f, 0x36, 0x13, 0xee,
+    0x15, 0x7b, 0x41, 0x11, 0x10, 0x47, 0xe6, 0x5e, 0xf6, 0xbd, 0x67, 0x2f, 0x11, 0xc2, 0x02, 0xe4,
+    0x37, 0xdf, 0xb1, 0x16, 0x59, 0x5e, 0x52, 0x85, 0x86, 0xae, 0xaf, 0x11, 0x0d, 0x40, 0x25, 0x89,
+    0xd7, 0x63, 0xb6, 0x85, 0xb3, 0x75, 0x07, 0x3c, 0xa1, 0x3d, 0x9e, 0x9e, 0x18, 0x34, 0x9d, 0x6d,
+    0xf1, 0x59, 0xea, 0x3c, 0x57, 0x65, 0xb0, 0xe4, 0xea, 0xbd, 0x23, 0x4f, 0xa2, 0xf6, 0x95, 0xdd,
+    0xa0, 0x09, 0x7b, 0x9f, 0xa9, 0x3d, 0x9f, 0xb5, 0xb4, 0x19, 0x57, 0xb2, 0xec, 0xcf, 0xea, 0x65,
+    0xcd, 0x0c, 0xc7, 0x5b, 0xdc, 0x59, 0xa6, 0xb4, 0x83, 0x36, 0xaf, 0xc0, 0x80, 0x21, 0x92, 0xf0,
+    0xbc, 0xfc, 0x70, 0xb5, 0x53, 0xea, 0xfd, 0x12, 0xb8, 0xd0, 0x77, 0x84, 0x1e, 0x20, 0x56, 0xda,
+    0xbf, 0xda, 0x27, 0x8f, 0xfa, 0x1d, 0xe6, 0xbb, 0x1f, 0x87, 0xf8, 0xc5, 0x20, 0x3d, 0xfa, 0xe3,
+    0x88, 0x55, 0x1c, 0x23, 0x74, 0x70, 0xc0, 0xf3, 0xce, 0x53, 0x1e, 0x57, 0xe0, 0x74, 0x0b, 0x89,
+    0xa9, 0x09, 0x34, 0x98, 0xde, 0xc5, 0x06, 0x8a, 0x0d, 0x93, 0x8f, 0x16, 0x53, 0x7f, 0x6c, 0xf0,
+    0x27, 0x29, 0x2a, 0x37, 0x65, 0xf7, 0x3f, 0xb9, 0x66, 0xb0, 0x17, 0x0b, 0x65, 0x17, 0x90, 0x24,
+    0x06, 0x6b, 0x02, 0x29, 0x94, 0xaa, 0x44, 0xb5, 0x10, 0x68, 0x84, 0x3d, 0x5c, 0xc2, 0xa0, 0x34,
+    0x62, 0xf4, 0xcc, 0x54, 0x6d, 0xdc, 0x34, 0xdb, 0x23, 0xb4, 0x77, 0x70, 0xb4, 0xd5, 0x15, 0x9f,
+    0x63, 0x11, 0xb3, 0x58, 0xee, 0x01, 0xd6, 0xd9, 0x79, 0x1b, 0xbe, 0xef, 0x66, 0x2d, 0x71, 0x7c,
+    0x7d, 0x76, 0x55, 0x6f, 0x48, 0xdc, 0x1a, 0xef, 0x29, 0x53, 0x87, 0x11, 0x7c, 0x81, 0x24, 0xc2,
+    0x7b, 0xc3, 0x20, 0x4e, 0x14, 0xb0, 0x5b, 0xdf, 0xb3, 0xbb, 0xdc, 0x65, 0xa6, 0x4b, 0x3f, 0xee,
+    0xdb, 0x36, 0xbb, 0x30, 0x1c, 0xe3, 0x6e, 0xe9, 0xa5, 0xb6, 0xe3, 0x46, 0x22, 0xd0, 0x8a, 0xcf,
+    0x08, 0xef, 0x53, 0x03, 0x7f, 0xb1, 0xb3, 0x56, 0xdc, 0x7f, 0xd5, 0xa5, 0x29, 0x80, 0x40, 0x3a,
+    0x37, 0xd6, 0x97, 0xef, 0x88, 0xc0, 0xc8, 0xc9, 0x83, 0x39, 0x3d, 0x98, 0xab, 0xe0, 0xa9, 0x73,
+    0x58, 0x99, 0x6d, 0xde, 0x29, 0xb5, 0x3e, 0x5d, 0x9c, 0xdf, 0xbe, 0x36, 0x20, 0xe2, 0x4b, 0x6b,
+    0xaa, 0x18, 0x6c, 0xea, 0x73, 0x98, 0x1a, 0x11, 0x45, 0xe7, 0x2c, 0x01, 0x8b, 0xe8, 0x40, 0xb4,
+    0xec, 0xcc, 0x7f, 0xf0, 0xc2, 0xd4, 0x00, 0x93, 0x6d, 0x82, 0xca, 0xed, 0xc5, 0x33, 0x51, 0x73,
+    0xf6, 0xe4, 0x7d, 0xdd, 0x90, 0x5d, 0x68, 0xcc, 0x09, 0x52, 0xe6, 0x65, 0x04, 0x7d, 0x26, 0x4d,
+    0xc5, 0x15, 0x59, 0x4e, 0x39, 0x3c, 0x6f, 0xbf, 0xd4, 0x95, 0xcd, 0xfa, 0xa0, 0x05, 0xfe, 0x82,
+    0xa0, 0x3b, 0x5a, 0xc6, 0xb1, 0x35, 0xed, 0xf1, 0xed, 0x41, 0x0f, 0x68, 0xb4, 0xbb, 0x80, 0xe8,
+    0x60, 0xb0, 0xb2, 0x6f, 0xe8, 0xf0, 0xf3, 0xbd, 0x24, 0xb9, 0x08, 0x39, 0xab, 0xf8, 0x54, 0x84,
+    0x11, 0x7b, 0x36, 0x43, 0xfb, 0x81, 0xb8, 0x2e, 0x48, 0xb4, 0x27, 0x13, 0x85, 0x39, 0x1d, 0x74,
+    0x8e, 0x27, 0x6a, 0x94, 0x86, 0x68, 0x40, 0x20, 0xa1, 0xf8, 0x60, 0x71, 0xd1, 0x3f, 0x1e, 0xb8,
+    0x43, 0xd8, 0xde, 0x10, 0x4a, 0xc4, 0xcf, 0x28, 0x15, 0xca, 0x5d, 0x21, 0x94, 0xae, 0xb8, 0x83,
+    0x08, 0x13, 0x58, 0xc7, 0xeb, 0x38, 0x2c, 0x60, 0x0c, 0x5d, 0xcc, 0x7d, 0x39, 0x2d, 0x41, 0x10,
+    0x22, 0x46, 0xa9, 0x96, 0x03, 0xa0, 0x8b, 0x43, 0x0a, 0x99, 0xfb, 0x2f, 0x5d, 0x9d, 0x6c, 0x83,
+    0xf2, 0x9a, 0xb0, 0x2d, 0xce, 0x31, 0xa2, 0x5e, 0x4e, 0xd5, 0xeb, 0x87, 0xfe, 0x75, 0xb7, 0x70,
+    0x27, 0x4f, 0xca, 0x35, 0xae, 0x8c, 0x03, 0xb6, 0x32, 0xea, 0x74, 0x2e, 0x6a, 0x0e, 0x90, 0x07,
+    0xd0, 0xa6, 0xb3, 0x26, 0x4e, 0x83, 0x3a, 0x6b, 0xd7, 0x45, 0xfc, 0xdb, 0x0d, 0x55, 0x2f, 0xfd,
+    0xa7, 0x38, 0x1a, 0xeb, 0x01, 0x65, 0x7d, 0x69, 0x6f, 0xb2, 0x41, 0x52, 0x65, 0x93, 0x7e, 0x46,
+    0xd0, 0x83, 0xbb, 0x53, 0xba, 0x15, 0x09, 0x2a, 0x83, 0x3f, 0xf1, 0x0f, 0x99, 0x24, 0x4c, 0x1b,
+    0x94, 0xc8, 0xab, 0x0b, 0xb1, 0xce, 0x99, 0xed, 0xcd, 0xe9, 0x9b, 0xdb, 0x1a, 0xff, 0xb4, 0xf5,
+    0xa6, 0x91, 0x6b, 0x50, 0x51, 0x27, 0x7d, 0xb3, 0x3f, 0xbe, 0x35, 0x06, 0x35, 0x6a, 0x0c, 0x0e,
+    0x79, 0xdd, 0x62, 0x85, 0x86, 0xda, 0x01, 0x69, 0xf4, 0x9b, 0xb7, 0xb4, 0xa9, 0x25, 0x44, 0x4e,
+    0x01, 0xda, 0x47, 0xa4, 0x34, 0x9e, 0x1f, 0xbe, 0x92, 0x84, 0x94, 0xf6, 0x7a, 0x65, 0x19, 0x4d,
+    0x7a, 0x1a, 0x56, 0xb3, 0xde, 0x99, 0x86, 0xc2, 0x32, 0xda, 0xb9, 0x7b, 0x43, 0x70, 0x19, 0x65,
+    0x76, 0xe3, 0xf3, 0x27, 0x15, 0x09, 0x87, 0xd7, 0xfe, 0x87, 0x81, 0x68, 0xee, 0x72, 0x12, 0xdb,
+    0x71, 0x3d, 0xe1, 0x88, 0xe3, 0x61, 0xfb, 0x34, 0x6a, 0x02, 0xac, 0xaf, 0xa7, 0x32, 0xb9, 0x34,
+    0x69, 0x0f, 0xec, 0xb5, 0x49, 0x13, 0x6f, 0x82, 0x8a, 0xcc, 0xa7, 0x69, 0xb4, 0x0e, 0x5b, 0x2d,
+    0x09, 0x94, 0x40, 0xf3, 0x9c, 0x87, 0x38, 0x2f, 0x89, 0xfd, 0x93, 0x47, 0x73, 0x9e, 0xcb, 0x4a,
+    0x80, 0x9e, 0x6d, 0x9c, 0xb7, 0xbe, 0x62, 0xe9, 0x96, 0xf5, 0x02, 0xe3, 0xa6, 0x03, 0xa0, 0x2e,
+    0x2b, 0x78, 0x8e, 0x9a, 0x36, 0xca, 0x63, 0xc9, 0xe6, 0x41, 0x24, 0x99, 0x9f, 0x76, 0x59, 0xb0,
+    0x09, 0xfb, 0x87, 0x89, 0x65, 0x78, 0xc5, 0xed, 0xf1, 0x77, 0x8d, 0xc1, 0x32, 0x60, 0xfa, 0xb4,
+    0x08, 0xfa, 0xbf, 0xfc, 0xbc, 0xc5, 0x76, 0xf3, 0x05, 0x8e, 0xff, 0xe9, 0xf0, 0xca, 0x86, 0xae,
+    0x35, 0x6b, 0x45, 0x70, 0x00, 0xf2, 0x54, 0x5b, 0xd6, 0x20, 0x09, 0xd1, 0xe2, 0xc0, 0x4a, 0x53,
+    0x74, 0xfe, 0x80, 0x87, 0xb7, 0x2a, 0xaf, 0x66, 0x3d, 0x58, 0xa6, 0xe4, 0xcc, 0xce, 0x21, 0x3a,
+    0x3c, 0x2b, 0x1b, 0xa5, 0x48, 0x53, 0x39, 0x81, 0xb3, 0xc9, 0x62, 0x43, 0xc8, 0xd7, 0x0a, 0x4a,
+    0x16, 0xa4, 0x48, 0x33, 0xf0, 0xa2, 0x98, 0x6d, 0x78, 0x7f, 0x59, 0x65, 0x80, 0x63, 0x74, 0x3e,
+    0x01, 0x25, 0xcd, 0x97, 0xd6, 0x72, 0xbf, 0xc1, 0x48, 0x75, 0x8c, 0x99, 0x13, 0x3a, 0x34, 0x2f,
+    0x60, 0xee, 0x3c, 0xb6, 0xa1, 0x3d, 0x6b, 0xf9, 0x1e, 0x0d, 0x59, 0x3d, 0x85, 0x68, 0x61, 0xaf,
+    0x28, 0x5a, 0x2a, 0x33, 0x56, 0x10, 0x91, 0x3f, 0x84, 0x69, 0x57, 0x89, 0xa2, 0xc9, 0x45, 0x38,
+    0xcd, 0x07, 0xb6, 0x22, 0xda, 0x10, 0x0b, 0xa9, 0x57, 0xc3, 0x30, 0xd4, 0x1f, 0xe0, 0x05, 0x33,
+    0xf4, 0x92, 0xa7, 0x76, 0x7a, 0x22, 0x18, 0x4f, 0xbc, 0x07, 0x31, 0x9a, 0x50, 0xdc, 0x4d, 0x57,
+    0x28, 0xc8, 0x2a, 0x78, 0x15, 0x10, 0x20, 0xc7, 0xb7, 0xce, 0x05, 0xb4, 0x17, 0x94, 0x59, 0x9b,
+    0x6e, 0xe4, 0xfb, 0x96, 0x4b, 0x03, 0x15, 0x54, 0x22, 0x61, 0xed, 0xa3, 0x07, 0x94, 0x60, 0x91,
+    0xc5, 0xcf, 0x3c, 0x95, 0xe8, 0xcf, 0xbd, 0x21, 0xf7, 0x65, 0x7f, 0x30, 0xce, 0x74, 0xe7, 0x05,
+    0xaa, 0x3a, 0x5e, 0x4f, 0x5a, 0xcc, 0x58, 0x64, 0x81, 0x08, 0x47, 0x6c, 0xbd, 0x6e, 0x97, 0xe1,
+    0x42, 0xe1, 0x8e, 0x71, 0x8b, 0xff, 0x26, 0x74, 0xe6, 0xb4, 0xda, 0xf8, 0xcc, 0xe9, 0xb7, 0x66,
+    0xe6, 0x17, 0x47, 0x55, 0x73, 0x17, 0x74, 0x2d, 0x16, 0x45, 0x2a, 0x7a, 0x27, 0x6a, 0xc8, 0x36,
+    0x60, 0xcd, 0x09, 0x72, 0xb7, 0xb6, 0xc6, 0x3c, 0x47, 0x7b, 0xf3, 0x20, 0xf5, 0xcf, 0x44, 0xa4,
+    0x9e, 0xfa, 0x0f, 0x4f, 0x38, 0x55, 0xb7, 0x4d, 0x7b, 0xac, 0xfe, 0xcc, 0x00, 0x80, 0xf9, 0x50,
+    0xea, 0xa2, 0xd2, 0xe5, 0xb3, 0x76, 0x52, 0x6a, 0x1d, 0xad, 0x10, 0x73, 0xfc, 0xc8, 0x9e, 0x3f,
+    0x7c, 0x53, 0xe8, 0x73, 0x8f, 0xae, 0x9b, 0x2c, 0xe2, 0x90, 0xa7, 0x89, 0x81, 0xde, 0x9f, 0x56,
+    0x5d, 0xba, 0x76, 0x7b, 0x9b, 0x05, 0xc0, 0x36, 0x86, 0x5a, 0x72, 0x53, 0x64, 0x70, 0xde, 0x43,
+    0x97, 0x80, 0x77, 0x40, 0xd4, 0x00, 0x19, 0xf3, 0x5e, 0xeb, 0x87, 0x9e, 0x29, 0xaf, 0x45, 0x8f,
+    0x39, 0xd0, 0xca, 0xd2, 0xf1, 0xc4, 0x6c, 0x4d, 0x46, 0x19, 0xc2, 0x1e, 0x86, 0x77, 0x01, 0xf7,
+    0x52, 0x03, 0x98, 0xca, 0x5e, 0x44, 0x44, 0xc8, 0xde, 0x89, 0x2a, 0x31, 0x2b, 0xb6, 0xfc, 0x26,
+    0xf1, 0xf6, 0x9f, 0x9e, 0x89, 0xbe, 0x83, 0x0f, 0xc7, 0x1a, 0x7b, 0x56, 0x2a, 0xa1, 0x2a, 0xa8,
+    0x85, 0x83, 0x55, 0x7d, 0x2c, 0xb4, 0x81, 0x68, 0xe4, 0x74, 0xc7, 0xa3, 0x02, 0x06, 0x77, 0xd6,
+    0xd9, 0x9e, 0x04, 0xed, 0xb6, 0x2d, 0x05, 0xe8, 0x93, 0x7c, 0x15, 0x36, 0x4f, 0x1e, 0x12, 0x91,
+    0x3d, 0x54, 0xce, 0x74, 0x2b, 0x2c, 0xea, 0x1c, 0xee, 0xbd, 0xf8, 0x0d, 0xfc, 0xb3, 0x3a, 0x9c,
+    0xca, 0x98, 0x4d, 0x5b, 0x8e, 0x0b, 0x66, 0x57, 0x24, 0x51, 0xeb, 0x2f, 0x1f, 0xc8, 0xb2, 0x10,
+    0xc7, 0x13, 0x90, 0x70, 0x39, 0x61, 0xe9, 0xa6, 0x3f, 0xbe, 0x46, 0x13, 0xc0, 0x58, 0x10, 0xc4,
+    0xf4, 0xa2, 0xf5, 0xbe, 0xe2, 0x57, 0x43, 0xc4, 0xb9, 0x95, 0x82, 0x45, 0x61, 0xf5, 0x6c, 0xf9,
+    0x18, 0x7e, 0x66, 0xd2, 0x90, 0x17, 0x77, 0x94, 0xcc, 0xcd, 0x64, 0x5d, 0xa3, 0x14, 0x89, 0xf1,
+    0xfa, 0x41, 0xd9, 0xfa, 0xd4, 0xba, 0xf0, 0xd2, 0x0b, 0x55, 0xdb, 0x37, 0xfe, 0xb4, 0xb6, 0xf3,
+    0xd6, 0x38, 0xfa, 0x63, 0x05, 0x4a, 0x2b, 0x7c, 0xd5, 0x2c, 0x02, 0x9f, 0x33, 0x86, 0x41, 0x30,
+    0xf4, 0x90, 0x70, 0x5e, 0xc6, 0xf1, 0xaa, 0x86, 0xd6, 0x9c, 0xcc, 0x14, 0x40, 0x35, 0x00, 0x27,
+    0x29, 0x31, 0x91, 0x51, 0x38, 0xa6, 0x0b, 0x87, 0x19, 0x91, 0xa4, 0xe2, 0x60, 0x88, 0x8b, 0xc2,
+    0x8a, 0x81, 0xe9, 0x29, 0x5d, 0x2c, 0x1a, 0x99, 0x54, 0x91, 0x7f, 0x03, 0xfb, 0x46, 0x5e, 0x0d,
+    0xca, 0xf1, 0xba, 0x6e, 0xbe, 0x82, 0xf8, 0xf1, 0xc0, 0xe8, 0x2f, 0xf4, 0xf7, 0x91, 0x10, 0xf3,
+    0x4b, 0xb0, 0xde, 0xfd, 0x13, 0xaf, 0xd2, 0x6b, 0xa7, 0xba, 0x82, 0x45, 0x91, 0x15, 0x5c, 0x05,
+    0x16, 0xda, 0x8d, 0xbd, 0x28, 0xae, 0xf1, 0x1d, 0x20, 0x16, 0x1c, 0xa4, 0xc1, 0x72, 0x15, 0x66,
+    0x16, 0x0d, 0x27, 0xcb, 0xc0, 0xe5, 0x53, 0x78, 0xd0, 0x11, 0x7b, 0x6b, 0x10, 0x73, 0x4b, 0xdb,
+    0x46, 0x31, 0xd7, 0x9e, 0xa5, 0x85, 0xda, 0x0e, 0x71, 0xc7, 0x98, 0xb6, 0x87, 0xa1, 0x2b, 0xf0,
+    0x9c, 0x20, 0x81, 0xa9, 0x66, 0x04, 0x2e, 0x0d, 0xb1, 0x41, 0x5e, 0xc1, 0xaa, 0xe0, 0xa2, 0x57,
+    0xea, 0xaf, 0x44, 0x8f, 0x63, 0x5a, 0xad, 0xdc, 0xcd, 0x7d, 0x23, 0xba, 0xcd, 0xb9, 0xd3, 0xea,
+    0x5b, 0x91, 0x73, 0x2c, 0x88, 0x69, 0x1f, 0x14, 0x5d, 0x7d, 0x7c, 0x45, 0x67, 0x35, 0x16, 0xb7,
+    0x2c, 0x40, 0x3f, 0x6a, 0xe4, 0xc0, 0x66, 0x36, 0x92, 0xd0, 0xc2, 0x7d, 0x16, 0x5a, 0x93, 0x20,
+    0xa9, 0x75, 0x19, 0xaf, 0x46, 0x64, 0x20, 0x40, 0x78, 0x31, 0xfa, 0xa5, 0x12, 0x24, 0xc2, 0x00,
+    0xc8, 0x89, 0xe1, 0xfa, 0x87, 0x14, 0x24, 0x85, 0x4c, 0x7a, 0xdc, 0xb9, 0x93, 0x00, 0xf9, 0x07,
+    0x7b, 0xab, 0x4d, 0x9a, 0x00, 0x35, 0x77, 0x5c, 0x1e, 0x16, 0x2a, 0x1b, 0xac, 0xb3, 0x53, 0xa6,
+    0x21, 0x39, 0x40, 0xf5, 0x9a, 0xc7, 0xe0, 0x29, 0x0d, 0x0f, 0xc4, 0xe5, 0x84, 0xf7, 0xb1, 0xfb,
+    0x3e, 0x52, 0x31, 0xc0, 0x20, 0x1d, 0x2a, 0x4e, 0xe0, 0x37, 0x20, 0x74, 0xdb, 0xd0, 0xf5, 0x97,
+    0x1a, 0xf7, 0x5d, 0xa4, 0xf6, 0xe0, 0x6f, 0x8f, 0xe2, 0xc1, 0xf0, 0xf3, 0xa3, 0x60, 0x57, 0xc1,
+    0x59, 0x31, 0x1a, 0x92, 0x0a, 0xfd, 0xdf, 0x88, 0x03, 0x07, 0x1b, 0x48, 0xfb, 0xaf, 0x6e, 0x48,
+    0x6c, 0xb0, 0x16, 0x4e, 0x40, 0x94, 0x25, 0x38, 0xd3, 0xf8, 0x05, 0xca, 0x42, 0x72, 0x4d, 0x3a,
+    0x9b, 0x2f, 0x0a, 0xd2, 0x44, 0xe6, 0x64, 0x5c, 0xc7, 0x00, 0x9f, 0x99, 0x07, 0x85, 0x70, 0x18,
+    0x93, 0x32, 0xf3, 0x8c, 0xf6, 0xe5, 0x62, 0x95, 0x0d, 0xa7, 0xf8, 0x47, 0xe4, 0x60, 0x11, 0xc6,
+    0xc9, 0x69, 0x9d, 0xfd, 0x99, 0xd0, 0xe8, 0x3c, 0xee, 0x59, 0x3e, 0x98, 0xb9, 0x22, 0x91, 0xd8,
+    0xc1, 0x91, 0x79, 0x48, 0xbd, 0x8a, 0x24, 0xac, 0xc5, 0x82, 0x31, 0xc3, 0x34, 0x34, 0x96, 0x97,
+    0xa6, 0x50, 0x4c, 0x8f, 0xf1, 0xd2, 0xa7, 0xf0, 0x16, 0xf5, 0x32, 0xa0, 0x7b, 0x02, 0x22, 0xf1,
+    0xd6, 0x7a, 0x72, 0x80, 0x1d, 0x27, 0x25, 0x41, 0x4a, 0x76, 0xf1, 0xd9, 0x45, 0xca, 0x41, 0x30,
+    0x95, 0x58, 0x88, 0x1d, 0x4c, 0x64, 0x42, 0x77, 0xfb, 0x9b, 0x7f, 0x2b, 0x70, 0x0f, 0x99, 0x03,
+    0x11, 0x90, 0x2c, 0x85, 0x82, 0xc4, 0x3b, 0x7c, 0xd6, 0xf0, 0xd7, 0xdd, 0xe9, 0xf9, 0x2e, 0x93,
+    0xa9, 0x96, 0x5d, 0x9d, 0x30, 0x67, 0x27, 0x53, 0x5f, 0x2a, 0xbd, 0x1a, 0xe9, 0x5a, 0x1b, 0x09,
+    0x66, 0xb1, 0xa6, 0x2b, 0x0a, 0x26, 0x97, 0x57, 0x24, 0x3d, 0x2d, 0x2b, 0xeb, 0xd3, 0xad, 0xba,
+    0xa6, 0x21, 0x08, 0x81, 0xa5, 0xb3, 0xa3, 0x2a, 0x36, 0x65, 0xed, 0x38, 0x2c, 0xbe, 0xca, 0xde,
+    0x65, 0xeb, 0x30, 0x7d, 0x14, 0xb3, 0x7c, 0x98, 0x03, 0x1e, 0xe7, 0xc4, 0xa1, 0x4f, 0xad, 0x9c,
+    0x75, 0xcb, 0xb6, 0x53, 0xf1, 0x36, 0x50, 0xa1, 0x20, 0x70, 0xf3, 0x94, 0x4c, 0xe3, 0x6f, 0x26,
+    0xdf, 0x0f, 0x2c, 0xa9, 0xce, 0x2a, 0x10, 0xbf, 0x2c, 0x12, 0xe3, 0x44, 0x3c, 0x21, 0x21, 0x9d,
+    0x72, 0x11, 0x30, 0x2b, 0xdf, 0xd8, 0xf8, 0x02, 0x47, 0x72, 0x5e, 0x77, 0x13, 0xcd, 0xe6, 0x87,
+    0x6c, 0x58, 0xf1, 0x1c, 0x00, 0x2a, 0xa8, 0xc3, 0x63, 0xeb, 0x47, 0x75, 0x65, 0x32, 0x7c, 0xf0,
+    0x06, 0xc9, 0x69, 0xc1, 0x68, 0xf1, 0x3f, 0xfe, 0x1c, 0xbd, 0x08, 0x5e, 0x8b, 0x43, 0xe5, 0x8f,
+    0x5b, 0x24, 0xb1, 0x76, 0x4c, 0xe2, 0xad, 0x45, 0x34, 0xeb, 0xdd, 0x98, 0xfd, 0xbd, 0x15, 0x4f,
+    0xa3, 0x2f, 0x64, 0x10, 0x31, 0x9a, 0x4a, 0xce, 0xdb, 0xe2, 0x78, 0xb9, 0xf6, 0x4f, 0x1b, 0x38,
+    0xb7, 0xc5, 0xae, 0xdf, 0x7f, 0x8b, 0x82, 0x85, 0x10, 0xb6, 0x74, 0x31, 0xdc, 0x57, 0x68, 0x26,
+    0x68, 0x11, 0x58, 0x8c, 0x5d, 0x4d, 0x16, 0x00, 0x7a, 0x47, 0x42, 0x6c, 0xf6, 0x90, 0xe1, 0x6c,
+    0x18, 0xa8, 0x7c, 0x80, 0xee, 0x6a, 0x7b, 0x04, 0x70, 0x1b, 0x2a, 0x8b, 0x4a, 0x16, 0x73, 0xc2,
+    0x64, 0x24, 0x85, 0x62, 0x0d, 0x90, 0xc6, 0x19, 0xaa, 0xad, 0xd7, 0x92, 0xa6, 0xde, 0x32, 0xb9,
+    0x97, 0x9c, 0xe7, 0x98, 0x7d, 0xf2, 0x35, 0xc4, 0x68, 0xe0, 0x4a, 0xbc, 0x44, 0xe1, 0xd2, 0x1d,
+    0xe8, 0x01, 0x50, 0x04, 0xf0, 0xe6, 0xec, 0xad, 0x46, 0xde, 0x86, 0x5b, 0x82, 0xfd, 0x8e, 0x5d,
+    0xce, 0x49, 0x89, 0x7c, 0xbd, 0x37, 0x92, 0x00, 0x86, 0x6a, 0xc9, 0x77, 0x86, 0x0d, 0xdf, 0x01,
+    0x3f, 0x54, 0xae, 0x06, 0x37, 0x45, 0xeb, 0xef, 0x4c, 0x66, 0xfa, 0x66, 0x3a, 0xf9, 0x7a, 0xca,
+    0x66, 0x8f, 0x63, 0x50, 0xba, 0x7a, 0x3e, 0x10, 0x30, 0x43, 0xcf, 0x9d, 0x51, 0x86, 0xd4, 0xeb,
+    0x7e, 0x20, 0xd3, 0x68, 0x20, 0x21, 0xea, 0x44, 0x51, 0xbe, 0xca, 0x49, 0x96, 0xe9, 0x09, 0x17,
+    0xbe, 0x95, 0x57, 0x4f, 0x28, 0xf0, 0xad, 0xd9, 0x28, 0x9b, 0x1e, 0x36, 0xfc, 0xb9, 0xeb, 0x60,
+    0x61, 0x6a, 0x03, 0x06, 0x2c, 0xdf, 0xf1, 0x29, 0x4f, 0x89, 0x70, 0xde, 0x20, 0x42, 0xd3, 0xbf,
+    0x9f, 0x54, 0x6f, 0x25, 0x4b, 0x69, 0x83, 0x67, 0x34, 0x81, 0x6f, 0x18, 0x6b, 0x78, 0xb2, 0xab,
+    0x49, 0xf8, 0xba, 0x66, 0x6c, 0x82, 0xe9, 0xb7, 0xc9, 0xdc, 0x6d, 0x6c, 0x81, 0x85, 0x2a, 0x29,
+    0x4e, 0x65, 0x24, 0xf4, 0x49, 0xef, 0x0e, 0xa8, 0xf9, 0xc1, 0x3e, 0x74, 0xff, 0x16, 0xbf, 0xfd,
+    0x6c, 0x3d, 0xc0, 0x83, 0x25, 0xd9, 0x3d, 0x10, 0x42, 0x9c, 0x30, 0x78, 0x05, 0x27, 0xcd, 0xa1,
+    0x41, 0xe0, 0xaa, 0xa4, 0x08, 0x41, 0x76, 0xa5, 0xa0, 0x09, 0x39, 0xcf, 0x44, 0xb2, 0xa6, 0x2b,
+    0x06, 0xcc, 0x65, 0x6a, 0x07, 0x83, 0x2a, 0x5a, 0xb5, 0x34, 0xc8, 0xdd, 0xed, 0x5c, 0x78, 0x96,
+    0xf4, 0xf0, 0x91, 0x01, 0xfe, 0x7c, 0x53, 0xc1, 0x2a, 0x74, 0x56, 0x53, 0x01, 0xb9, 0x48, 0x53,
+    0x14, 0x7d, 0x18, 0xe8, 0xb3, 0x43, 0x49, 0x87, 0x66, 0x2d, 0x93, 0x46, 0xce, 0x36, 0x35, 0x1b,
+    0xb5, 0x69, 0x57, 0x49, 0x27, 0x2a, 0xe8, 0x36, 0xd1, 0xc6, 0x71, 0x40, 0x4b, 0x35, 0x5d, 0x90,
+    0x24, 0x3c, 0x7e, 0x37, 0xeb, 0xe6, 0x81, 0xab, 0x6d, 0x94, 0x8b, 0x28, 0x62, 0x37, 0x9b, 0x32,
+    0x2e, 0x5f, 0xce, 0xcc, 0x1f, 0xb3, 0xcf, 0x78, 0xf8, 0x83, 0x4f, 0x5a, 0x9f, 0xdf, 0x09, 0xdb,
+    0x69, 0x61, 0x9d, 0xb3, 0x2a, 0x05, 0x6b, 0x3f, 0xc8, 0xb4, 0xda, 0x5f, 0x0f, 0xb6, 0x41, 0xa3,
+    0xd0, 0xb0, 0xac, 0x9f, 0x8c, 0x8b, 0x62, 0x56, 0x4c, 0x4f, 0xed, 0xf4, 0xb6, 0x79, 0x55, 0x3e,
+    0xd0, 0xa1, 0xc6, 0x6b, 0xc9, 0xd2, 0x8c, 0x1c, 0x94, 0x22, 0xc6, 0xb5, 0x52, 0xd5, 0xb6, 0x5d,
+    0x81, 0xdf, 0x85, 0x1e, 0x41, 0x68, 0x28, 0x36, 0xfe, 0x7d, 0x39, 0x95, 0xb1, 0x49, 0x9f, 0x9f,
+    0xf8, 0x3d, 0x90, 0x88, 0xb4, 0x2a, 0xb3, 0x96, 0xca, 0xf9, 0xb7, 0x6f, 0x9f, 0x92, 0x7b, 0x74,
+    0x6f, 0x82, 0x18, 0x0e, 0x15, 0xff, 0xe5, 0x6a, 0x55, 0x80, 0x17, 0x3f, 0xa3, 0x78, 0x3f, 0x78,
+    0xc3, 0x1e, 0xb3, 0x44, 0x22, 0x68, 0x25, 0x2f, 0xcf, 0x66, 0xa0, 0x30, 0xb2, 0xcc, 0x8d, 0x91,
+    0xee, 0xdc, 0xab, 0x0f, 0x46, 0x9a, 0x62, 0x17, 0xf6, 0xc8, 0x6b, 0x49, 0x0a, 0x1e, 0x4b, 0x4e,
+    0x38, 0xf4, 0xd8, 0xb8, 0x3b, 0xbc, 0xd1, 0xe3, 0x15, 0xc0, 0x27, 0x20, 0x76, 0xf3, 0x2a, 0x3f,
+    0x52, 0xe0, 0xd5, 0x41, 0x08, 0xdb, 0x90, 0xf8, 0x39, 0x00, 0x8e, 0xa3, 0x3d, 0x53, 0x0f, 0x10,
+    0x9b, 0x8a, 0xa5, 0xb9, 0xf1, 0x20, 0xa7, 0x20, 0xf4, 0xa7, 0xdf, 0xac, 0x08, 0x17, 0xa9, 0x7d,
+    0x9a, 0x77, 0xb1, 0xf1, 0x3d, 0x34, 0x6c, 0x9f, 0xf0, 0xa4, 0x98, 0xf1, 0xe5, 0x61, 0x11, 0xea,
+    0x71, 0xb7, 0x1b, 0xda, 0xea, 0xd6, 0x79, 0x2d, 0x90, 0xf8, 0x6e, 0xd4, 0xb8, 0xb8, 0x62, 0x24,
+    0xe3, 0x6f, 0xc4, 0xe4, 0xef, 0xb6, 0xa0, 0x4a, 0x40, 0x30, 0xc9, 0x9f, 0xe0, 0xa0, 0x5e, 0x35,
+    0xa0, 0xea, 0x84, 0xc2, 0x30, 0x38, 0xd0, 0xa6, 0x51, 0x5a, 0xad, 0x26, 0x1d, 0x26, 0xbe, 0x10,
+    0xbc, 0xe7, 0xed, 0x75, 0x85, 0x55, 0x5b, 0x3f, 0x68, 0x78, 0x13, 0x9b, 0x04, 0x91, 0x20, 0x82,
+    0x2b, 0x5e, 0x69, 0x53, 0x02, 0x37, 0xaa, 0xae, 0x09, 0xcd, 0xd8, 0x33, 0x6b, 0x29, 0x5c, 0xd1,
+    0x6c, 0xc7, 0x09, 0x06, 0xca, 0xa7, 0x69, 0x5c, 0x76, 0xc1, 0x53, 0x71, 0xbe, 0x1f, 0xbb, 0xa7,
+    0x64, 0x9e, 0xa6, 0x15, 0xd9, 0x45, 0xb4, 0x0e, 0xe5, 0x07, 0xc9, 0x75, 0x1e, 0xc9, 0x85, 0x34,
+    0x69, 0x90, 0xc7, 0x82, 0x28, 0x30, 0xbc, 0x96, 0x85, 0xc5, 0xd3, 0xf7, 0x60, 0x5a, 0x33, 0xdf,
+    0xab, 0xe5, 0x7f, 0xec, 0xc6, 0xa6, 0x74, 0x26, 0x01, 0xca, 0x43, 0xa6, 0x35, 0xbd, 0x03, 0xf3,
+    0xea, 0x26, 0x25, 0x8e, 0x0d, 0x04, 0x6b, 0xae, 0xa6, 0x2c, 0x81, 0xcf, 0xdd, 0x48, 0xcf, 0xac,
+    0x61, 0x50, 0x56, 0x7a, 0xd8, 0x4e, 0xd1, 0x07, 0x16, 0x00, 0x94, 0xb7, 0x40, 0x4e, 0x84, 0x13,
+    0x24, 0xaf, 0x47, 0x2f, 0x66, 0xf2, 0xbe, 0x6d, 0xc2, 0x6e, 0xa2, 0x6e, 0xb4, 0x4f, 0xee, 0xbb,
+    0x74, 0xb6, 0x14, 0x57, 0xe7, 0xe9, 0x1b, 0xf5, 0xb7, 0x22, 0xf3, 0x68, 0xe1, 0x86, 0x4e, 0xe4,
+    0x5a, 0xf9, 0x9e, 0x00, 0x5a, 0x4a, 0x44, 0x4b, 0xaa, 0x31, 0xb1, 0x79, 0x5d, 0x1d, 0x42, 0x4a,
+    0x90, 0xc4, 0x77, 0x46, 0xd2, 0xb0, 0x16, 0x29, 0xb6, 0x73, 0x03, 0x93, 0xbc, 0xcd, 0x30, 0xec,
+    0xb0, 0x9c, 0x02, 0x34, 0x8d, 0x1c, 0x4d, 0x89, 0x81, 0x42, 0x9c, 0x02, 0x37, 0x90, 0x3e, 0x26,
+    0x12, 0x58, 0x1f, 0xc3, 0x31, 0x31, 0x03, 0x6f, 0xa5, 0x92, 0xf9, 0xf1, 0xfe, 0xcc, 0x23, 0x78,
+    0x23, 0x62, 0x64, 0xcf, 0x37, 0x70, 0x0c, 0xf8, 0x23, 0xa8, 0xe2, 0x4a, 0xc7, 0x21, 0xc0, 0x80,
+    0x56, 0x75, 0x76, 0x39, 0xa0, 0x86, 0x19, 0x18, 0xf6, 0xdb, 0x72, 0x1e, 0x00, 0x97, 0xe6, 0x06,
+    0xdb, 0xde, 0x30, 0x72, 0x11, 0x3d, 0x34, 0x51, 0xb7, 0xad, 0xc9, 0x9a, 0x29, 0xca, 0xae, 0xd7,
+    0xc4, 0x98, 0xa0, 0xf2, 0x45, 0xab, 0x2b, 0x3d, 0xb6, 0x15, 0xc1, 0xeb, 0xb1, 0xe7, 0x9c, 0xa3,
+    0x1f, 0xc2, 0x4b, 0x80, 0x5e, 0xca, 0x90, 0xe7, 0xfe, 0xb1, 0xde, 0xe5, 0x0d, 0xe0, 0x35, 0xf9,
+    0x58, 0x17, 0x43, 0xc2, 0x5a, 0xe4, 0x3e, 0xe6, 0xf8, 0x07, 0xd5, 0x61, 0x68, 0xdf, 0xff, 0xd6,
+    0xda, 0x5b, 0xbb, 0xf6, 0x22, 0x70, 0x77, 0xa6, 0x00, 0xe9, 0x44, 0x3e, 0x69, 0x06, 0x24, 0x2b,
+    0x0c, 0x40, 0x2e, 0xce, 0x55, 0xd2, 0xe7, 0x1e, 0x71, 0xfd, 0x4e, 0xd9, 0x9c, 0x64, 0x93, 0x7d,
+    0x6c, 0x1e, 0x79, 0x17, 0x27, 0xca, 0xb7, 0x1e, 0x0f, 0x7f, 0xc5, 0xe2, 0xfa, 0x8f, 0xf6, 0x44,
+    0x65, 0x35, 0xa7, 0x83, 0x02, 0xb4, 0xa2, 0xc6, 0x78, 0x4c, 0x60, 0xf8, 0x65, 0x99, 0xef, 0xb7,
+    0xb1, 0xd4, 0x95, 0xaa, 0xad, 0x6f, 0xd5, 0x2b, 0x80, 0xa9, 0x4b, 0xec, 0xd5, 0x9b, 0x23, 0x09,
+    0xfa, 0xbd, 0xd4, 0x57, 0x7c, 0x38, 0x17, 0x0f, 0xfd, 0x0f, 0xda, 0xfd, 0xce, 0x66, 0xea, 0x58,
+    0x9d, 0x97, 0xb5, 0x1e, 0x2c, 0xbb, 0x97, 0x7e, 0x86, 0xe3, 0xf3, 0x7f, 0xc0, 0xe5, 0x01, 0xcd,
+    0xfb, 0x06, 0xbe, 0x4c, 0x5c, 0x62, 0x81, 0xf1, 0x23, 0xb2, 0xaa, 0x44, 0x98, 0xdf, 0x5f, 0xd2,
+    0xef, 0x61, 0xb3, 0xe8, 0x4b, 0x9e, 0x2a, 0x64, 0xea, 0xb4, 0x5b, 0x18, 0x2e, 0x44, 0xec, 0x92,
+    0xaa, 0xc4, 0x24, 0xc5, 0xfc, 0x91, 0x67, 0x46, 0xce, 0x98, 0xff, 0x3f, 0xa2, 0x1f, 0x07, 0x7d,
+    0x47, 0x8d, 0xa6, 0x10, 0x53, 0xdb, 0x2b, 0x48, 0x06, 0xf0, 0x9a, 0xc7, 0xf4, 0x6d, 0xea, 0xfa,
+    0x9c, 0x52, 0xe4, 0x39, 0xe4, 0xe5, 0xd3, 0xb1, 0x13, 0x23, 0x10, 0x9e, 0x31, 0x2d, 0x6c, 0xd0,
+    0x02, 0x36, 0xf3, 0xd2, 0xce, 0x69, 0x2b, 0x00, 0x6d, 0xb2, 0x31, 0xe0, 0xde, 0x53, 0x66, 0x96,
+    0x60, 0x8c, 0x03, 0x0f, 0x65, 0xce, 0x9b, 0x0c, 0x8c, 0x57, 0x82, 0xf8, 0x35, 0xf5, 0x59, 0x64,
+    0x40, 0xcd, 0xa1, 0x81, 0x22, 0x4b, 0x65, 0xf2, 0xfd, 0x44, 0x80, 0x61, 0x2c, 0x1b, 0x06, 0xf7,
+    0x15, 0x0a, 0x85, 0x02, 0x57, 0x62, 0x09, 0xe3, 0x1d, 0x4d, 0x5d, 0x00, 0xcb, 0x37, 0xd1, 0x00,
+    0x28, 0xe6, 0xff, 0xa4, 0xe6, 0x9e, 0x65, 0x51, 0xf7, 0xb8, 0xea, 0x29, 0xbe, 0x3b, 0xdb, 0x1d,
+    0x45, 0xda, 0xbe, 0x26, 0x83, 0x60, 0x67, 0x35, 0xe0, 0x89, 0xf4, 0x54, 0x0b, 0x86, 0xf9, 0x0d,
+    0x92, 0x19, 0x29, 0x97, 0xf4, 0x06, 0xd9, 0xea, 0x00, 0x1a, 0xcd, 0xe6, 0x39, 0x73, 0xd8, 0x23,
+    0x0a, 0x11, 0xd7, 0x55, 0x60, 0x4a, 0x48, 0xf6, 0x48, 0xfe, 0xbc, 0xd5, 0x9c, 0x20, 0x17, 0x59,
+    0x13, 0xf7, 0x15, 0xae, 0x8a, 0xb9, 0xc0, 0xd2, 0x5c, 0x92, 0x03, 0x34, 0x47, 0x98, 0xf4, 0xc3,
+    0x8d, 0x59, 0x21, 0xa8, 0x22, 0x73, 0x95, 0x02, 0xc0, 0x20, 0x13, 0x5c, 0x7c, 0xff, 0x0e, 0xaf,
+    0xf7, 0x25, 0xc7, 0x05, 0x9c, 0x97, 0xb8, 0xf2, 0x8a, 0x70, 0xb8, 0xa9, 0xd6, 0x31, 0xe8, 0x0d,
+    0x75, 0x61, 0x2b, 0xdd, 0x2b, 0xb0, 0x54, 0x18, 0x27, 0x2e, 0xb0, 0x5a, 0xfd, 0xe7, 0x68, 0xa2,
+    0xd6, 0x2e, 0xfa, 0x19, 0x16, 0xd5, 0x03, 0x4c, 0x91, 0xf1, 0x93, 0x7b, 0x72, 0xd7, 0x78, 0x18,
+    0xcb, 0x9e, 0x3b, 0xc7, 0x65, 0x31, 0x0c, 0x05, 0x92, 0x9e, 0xa1, 0x0e, 0xd8, 0xfa, 0x26, 0x85,
+    0x72, 0x86, 0xdf, 0xf0, 0x9a, 0xd0, 0x9b, 0x16, 0x6d, 0xee, 0x1c, 0x4c, 0x7a, 0x42, 0x64, 0x26,
+    0x19, 0x33, 0x64, 0x72, 0xcf, 0x61, 0xde, 0x6f, 0x39, 0xb3, 0x96, 0x83, 0xad, 0xab, 0x88, 0xed,
+    0xce, 0xd5, 0xb9, 0x15, 0x88, 0xe8, 0x99, 0xc0, 0x2b, 0x61, 0x1d, 0x38, 0xbf, 0x07, 0x98, 0x62,
+    0x08, 0xbc, 0xe9, 0x12, 0xa5, 0xf9, 0x51, 0xab, 0xc1, 0x09, 0x7d, 0xe8, 0x90, 0x07, 0x55, 0x5b,
+    0xd7, 0x94, 0xaa, 0xf9, 0xa2, 0xb0, 0xee, 0xaa, 0xfe, 0xd7, 0xbe, 0x1b, 0x70, 0xdb, 0x4a, 0xba,
+    0x8b, 0x49, 0x2c, 0x1d, 0x51, 0xcc, 0xae, 0xd9, 0x9d, 0xe8, 0x3a, 0x67, 0xc6, 0x65, 0xbf, 0x26,
+    0xfb, 0xb3, 0x7a, 0x4c, 0x38, 0x95, 0x48, 0x76, 0x9c, 0x44, 0x00, 0x10, 0x79, 0x62, 0x39, 0x77,
+    0x7c, 0xa4, 0x41, 0xf5, 0x4b, 0x86, 0x5d, 0x2b, 0xe0, 0x6c, 0x10, 0x81, 0xcd, 0xdf, 0xf1, 0x53,
+    0x64, 0xea, 0x60, 0xcf, 0x92, 0xe8, 0xbd, 0x63, 0x98, 0xcb, 0x34, 0x57, 0xdc, 0xca, 0x39, 0x8c,
+    0xd0, 0xc0, 0xc5, 0xe2, 0x4e, 0x12, 0xea, 0x29, 0x9b, 0xe8, 0x1c, 0x75, 0x49, 0x46, 0xad, 0xa9,
+    0x1c, 0x70, 0xc2, 0xd9, 0xe9, 0x86, 0x82, 0xd2, 0x2c, 0xfb, 0x0b, 0x3a, 0x4c, 0x54, 0x8f, 0x70,
+    0xd2, 0xb6, 0xa1, 0xe2, 0x0e, 0x76, 0x51, 0xdd, 0xc4, 0xdb, 0xd3, 0x29, 0xf3, 0x51, 0xd9, 0xf1,
+    0x17, 0x61, 0xa6, 0x49, 0x10, 0x9f, 0xfe, 0x65, 0x1a, 0xb2, 0x87, 0x17, 0x6e, 0xc5, 0x96, 0xc3,
+    0x71, 0xc0, 0x67, 0x03, 0xcf, 0x6b, 0x81, 0xac, 0x6e, 0x5e, 0xcc, 0xe2, 0x7b, 0x1c, 0x11, 0x3d,
+    0x0e, 0x70, 0x90, 0xd5, 0x40, 0x03, 0x45, 0x5e, 0x76, 0x8c, 0x6c, 0xcf, 0x02, 0x1c, 0x94, 0xb0,
+    0xf4, 0xd0, 0x18, 0xe8, 0xb8, 0x80, 0x83, 0xa3, 0x25, 0xf2, 0x18, 0xfc, 0x57, 0x59, 0x75, 0xac,
+    0xfb, 0x4d, 0xfd, 0xae, 0xb7, 0xe7, 0x5f, 0xd1, 0x0a, 0x3d, 0x8c, 0x61, 0x48, 0x4e, 0xc8, 0x6b,
+    0x12, 0x60, 0x07, 0x29, 0xf4, 0x25, 0x23, 0x2b, 0x45, 0x5b, 0xbe, 0x00, 0x3f, 0x57, 0x22, 0x6f,
+    0xa5, 0xb5, 0x14, 0x20, 0x68, 0x3b, 0x26, 0x14, 0x27, 0xcb, 0x8c, 0x90, 0xde, 0x32, 0x34, 0x32,
+    0xf5, 0x7e, 0x13, 0xaa, 0xcc, 0x1d, 0xc4, 0xea, 0xdb, 0xd7, 0xad, 0x85, 0xb3, 0x81, 0xb2, 0x8b,
+    0x58, 0x46, 0x7d, 0x7c, 0x50, 0x76, 0xd5, 0x9d, 0x8e, 0x73, 0x51, 0x0b, 0x5e, 0x30, 0xb4, 0x88,
+    0xbe, 0x18, 0x41, 0x15, 0x22, 0xe2, 0xe0, 0x69, 0x20, 0xb2, 0x2d, 0x5d, 0x48, 0xa6, 0x6b, 0x27,
+    0x4e, 0xc8, 0x02, 0x61, 0x9c, 0xc8, 0x48, 0xbb, 0x87, 0x06, 0x97, 0x42, 0xe1, 0x18, 0xd3, 0xfe,
+    0x5f, 0x4a, 0x7c, 0x05, 0x70, 0xcc, 0x34, 0xb4, 0x5a, 0x54, 0x15, 0x13, 0x77, 0x68, 0x27, 0xbf,
+    0xa2, 0xb4, 0xeb, 0xd6, 0x28, 0xb7, 0x57, 0x7b, 0xd3, 0x54, 0x57, 0x1c, 0xb1, 0x28, 0x9c, 0x24,
+    0xb1, 0x03, 0x46, 0x19, 0x2c, 0xfa, 0xd4, 0xe3, 0x63, 0xe6, 0xdb, 0x1c, 0x42, 0x08, 0x24, 0xae,
+    0x93, 0x50, 0x6e, 0xf4, 0x40, 0x6b, 0xb5, 0xcc, 0x10, 0x1f, 0xa6, 0x5d, 0x8b, 0x9c, 0xee, 0x88,
+    0xe8, 0x02, 0x5c, 0xc1, 0x78, 0xa6, 0x2b, 0xd9, 0x9d, 0xf8, 0x9f, 0x2c, 0xac, 0x4f, 0x40, 0xa8,
+    0x1e, 0x32, 0x24, 0x8f, 0xd6, 0x69, 0x67, 0x4f, 0xa6, 0x9f, 0xcd, 0x55, 0x49, 0x16, 0x83, 0xed,
+    0xf5, 0x81, 0xd9, 0xb2, 0x7b, 0x4f, 0x7e, 0x6e, 0x9f, 0xd9, 0x53, 0x5e, 0x75, 0x78, 0x74, 0x96,
+    0x56, 0x89, 0x35, 0xba, 0x7f, 0x73, 0xd2, 0xa3, 0x6d, 0x2e, 0x7d, 0x9c, 0x97, 0xf9, 0x5d, 0x1e,
+    0xba, 0x2d, 0x00, 0xb2, 0x9e, 0xef, 0x90, 0xd4, 0xb2, 0x66, 0x4d, 0x6c, 0xff, 0xcf, 0xfd, 0x97,
+    0x07, 0xa0, 0xd4, 0xa9, 0x36, 0x43, 0x0b, 0x95, 0x2e, 0xba, 0x97, 0x59, 0x5b, 0x51, 0x6a, 0x9d,
+    0x8e, 0x27, 0x3b, 0x9a, 0x28, 0x7c, 0x42, 0x55, 0x0f, 0x30, 0xd3, 0xa4, 0xa9, 0x0a, 0xc1, 0xe1,
+    0x93, 0x06, 0xd3, 0x18, 0x05, 0x39, 0x84, 0x95, 0x90, 0x53, 0x9b, 0xa5, 0xd4, 0xe2, 0x0b, 0x7e,
+    0x2d, 0xa0, 0x30, 0x6b, 0xd1, 0x4d, 0x5e, 0x58, 0x82, 0x04, 0x7d, 0x01, 0x67, 0x2f, 0xcf, 0xa6,
+    0x56, 0xc2, 0x9a, 0x17, 0xea, 0xd0, 0x10, 0xd4, 0x0d, 0x3c, 0x7b, 0xda, 0x07, 0xd6, 0x75, 0xa2,
+    0x6b, 0xd2, 0xce, 0xa3, 0x2b, 0xf0, 0xe1, 0x76, 0x07, 0xe4, 0xd1, 0x03, 0x34, 0x55, 0x56, 0x27,
+    0xc9, 0xf3, 0x1b, 0x7b, 0xae, 0x52, 0x29, 0x7d, 0x6a, 0xc4, 0x43, 0xcf, 0xf5, 0xf3, 0x34, 0xa2,
+    0x70, 0x2e, 0x23, 0x59, 0x67, 0xc9, 0x51, 0x46, 0xb8, 0x71, 0x92, 0x39, 0xca, 0xd6, 0x05, 0x9b,
+    0x48, 0x9a, 0x00, 0x46, 0x73, 0xdb, 0xf4, 0xce, 0xa1, 0x09, 0x18, 0xaf, 0x2e, 0x44, 0x06, 0xe7,
+    0xba, 0x33, 0xa4, 0x4b, 0x2c, 0x4a, 0x79, 0xc6, 0xc9, 0x5e, 0x10, 0xf0, 0x8a, 0x29, 0x53, 0xe9,
+    0xee, 0xe1, 0x15, 0xe6, 0xa2, 0x2d, 0xea, 0xfe, 0x36, 0x55, 0x97, 0x09, 0xbc, 0xac, 0x5a, 0x40,
+    0xba, 0x74, 0xef, 0xc6, 0xbc, 0x4d, 0x96, 0x87, 0xb4, 0xbe, 0x78, 0xc1, 0x54, 0xab, 0xb8, 0x5f,
+    0xe7, 0x3c, 0xc2, 0xc0, 0xe6, 0x67, 0xd3, 0xd4, 0xf1, 0x37, 0x38, 0xf8, 0x30, 0x97, 0x18, 0x95,
+    0xca, 0x63, 0x07, 0xa5, 0xcb, 0xeb, 0xce, 0x49, 0x67, 0x79, 0x4b, 0xf4, 0x82, 0x53, 0xb3, 0x86,
+    0x6f, 0xc3, 0x60, 0x63, 0x99, 0x3b, 0xbe, 0x8f, 0x1a, 0x56, 0x59, 0xe9, 0xa9, 0x73, 0x62, 0xcf,
+    0x2a, 0x97, 0xc8, 0x74, 0x96, 0x72, 0x1b, 0xa5, 0x1a, 0x02, 0x95, 0xfc, 0x0a, 0x16, 0xb1, 0x21,
+    0xe5, 0xb3, 0x00, 0x83, 0xdb, 0x61, 0xe8, 0xc4, 0x26, 0x2a, 0x6f, 0x16, 0xaa, 0x2c, 0xb9, 0x0e,
+    0x29, 0xb2, 0x6d, 0x7f, 0xd7, 0x28, 0x3b, 0x00, 0xe1, 0x87, 0xd8, 0xc9, 0x12, 0x80, 0xaf, 0xad,
+    0xcf, 0xe9, 0x10, 0xf9, 0xff, 0xe3, 0xc4, 0xb7, 0x12, 0x84, 0x06, 0x73, 0x5a, 0x87, 0x9e, 0xd8,
+    0x8b, 0x39, 0xf5, 0x6e, 0x60, 0xab, 0xcc, 0xd1, 0xf8, 0xa9, 0x90, 0x4d, 0xe7, 0x95, 0xcb, 0x0c,
+    0xa0, 0x97, 0x7b, 0xc5, 0x02, 0xdc, 0xd0, 0xb7, 0xae, 0xe4, 0x4a, 0x06, 0xbc, 0x04, 0xd8, 0x5e,
+    0xde, 0x64, 0x0b, 0xdb, 0x2a, 0x8d, 0x48, 0x52, 0xd3, 0xeb, 0x87, 0x96, 0x34, 0x0d, 0xf2, 0xe2,
+    0x01, 0xd5, 0x0f, 0x9c, 0x33, 0x56, 0xee, 0xb5, 0xcb, 0xea, 0xc8, 0x0c, 0xe2, 0xfe, 0x3c, 0x8b,
+    0x4e, 0x4a, 0x38, 0x2b, 0x1f, 0xf4, 0xab, 0xe1, 0x9d, 0x9c, 0x9c, 0xb7, 0xe4, 0x1a, 0xf4, 0xb5,
+    0x00, 0x3e, 0x46, 0xda, 0xa9, 0x85, 0xa7, 0x94, 0xbe, 0x04, 0xa4, 0xe6, 0x60, 0x14, 0x2b, 0x07,
+    0xb6, 0x95, 0xe9, 0x8a, 0x09, 0xe9, 0xba, 0x41, 0x56, 0x58, 0x42, 0x6e, 0x7e, 0x07, 0xfa, 0xf8,
+    0x99, 0x86, 0xac, 0x8f, 0x66, 0x7c, 0x43, 0x39, 0xf6, 0x52, 0x83, 0x82, 0x56, 0x85, 0xde, 0x1f,
+    0xe9, 0x8d, 0x21, 0x10, 0xcd, 0xc9, 0xba, 0x13, 0xd0, 0xcf, 0x60, 0xa4, 0x8f, 0x9b, 0x3c, 0xb1,
+    0xf1, 0x45, 0x01, 0x5a, 0x2e, 0x2b, 0xc6, 0x72, 0x13, 0x43, 0x58, 0x05, 0xd8, 0x3c, 0x4a, 0x60,
+    0x0a, 0x26, 0x0a, 0xb6, 0xa2, 0x99, 0xfe, 0x41, 0xe7, 0xed, 0x50, 0x10, 0xc2, 0xd6, 0x74, 0xcd,
+    0xff, 0x7c, 0x09, 0x8e, 0xda, 0x95, 0x4e, 0xab, 0x79, 0xaf, 0x53, 0x6e, 0xe7, 0x95, 0x74, 0x62,
+    0x14, 0x83, 0x5a, 0x3f, 0x05, 0xc9, 0xfe, 0xbf, 0xea, 0xc0, 0xfd, 0x3a, 0x77, 0x44, 0xe7, 0x37,
+    0x22, 0xa5, 0x3b, 0x78, 0xdb, 0x23, 0x55, 0x87, 0xfb, 0xd1, 0x8b, 0x14, 0xa0, 0x75, 0x0e, 0xfd,
+    0xe4, 0x3a, 0x5f, 0xc7, 0x24, 0xc4, 0x74, 0xba, 0xe1, 0xf4, 0xbf, 0xdc, 0xa8, 0xaf, 0xd5, 0xf6,
+    0x17, 0xbc, 0xe3, 0xa3, 0xa2, 0xbe, 0x24, 0x78, 0x91, 0x99, 0x45, 0x72, 0x7f, 0xd9, 0x8a, 0xeb,
+    0xa7, 0xa6, 0x2a, 0x15, 0x9e, 0xdd, 0x71, 0xd8, 0xdc, 0x13, 0xb6, 0x7e, 0x7b, 0x6f, 0x7c, 0x2a,
+    0x11, 0xc0, 0xfe, 0xff, 0xba, 0x1d, 0x2c, 0xd6, 0xdb, 0xfc, 0x04, 0xbc, 0xa8, 0xc1, 0x22, 0x93,
+    0xf5, 0x79, 0xfb, 0xc5, 0x86, 0x43, 0xce, 0xa0, 0xb7, 0x39, 0x1b, 0xd1, 0xdc, 0x6e, 0x58, 0x3b,
+    0xf2, 0x41, 0x7b, 0x35, 0xe2, 0x3b, 0x36, 0xf7, 0xaf, 0xa3, 0xba, 0x42, 0x64, 0x6c, 0x70, 0x4e,
+    0xb7, 0xaa, 0x03, 0xad, 0x4b, 0x6a, 0xf3, 0xa1, 0x3c, 0xa1, 0xa4, 0xea, 0x2b, 0x6b, 0xb8, 0x4b,
+    0x7c, 0x89, 0x55, 0x14, 0x3f, 0x84, 0x4f, 0x4d, 0x88, 0xc5, 0x64, 0x69, 0x2e, 0xa0, 0x25, 0x40,
+    0x65, 0x2d, 0x8d, 0xca, 0x0e, 0x38, 0x25, 0x13, 0x49, 0xdc, 0x03, 0x73, 0x7a, 0xd7, 0x0b, 0xc3,
+    0xcf, 0xd1, 0x36, 0x16, 0x27, 0xac, 0xe1, 0x0a, 0xb7, 0x84, 0x48, 0x3f, 0xea, 0xa6, 0x68, 0xf4,
+    0x2e, 0x7b, 0xdf, 0x5c, 0x8e, 0xe1, 0x59, 0xe8, 0xc7, 0xc7, 0x06, 0xb7, 0xf8, 0xe3, 0x48, 0x4e,
+    0xa1, 0xfc, 0x69, 0xc5, 0x1a, 0x9e, 0xc9, 0x73, 0x78, 0x62, 0x90, 0xb7, 0xdd, 0xde, 0xaa, 0x92,
+    0x62, 0x9b, 0x09, 0xb0, 0xf9, 0xf1, 0x25, 0x1d, 0x8f, 0x65, 0xf4, 0xfa, 0x37, 0x4d, 0xf0, 0x65,
+    0x18, 0x7b, 0xdf, 0x57, 0xce, 0xec, 0x77, 0xc8, 0x60, 0xef, 0xbd, 0xb3, 0x90, 0xaf, 0xba, 0x74,
+    0x66, 0xd2, 0xd5, 0xbb, 0x14, 0xef, 0x1c, 0xc2, 0x65, 0xfc, 0x76, 0x8a, 0xdf, 0xe1, 0x67, 0x32,
+    0x09, 0x95, 0x26, 0x6f, 0x1a, 0x7b, 0xcf, 0x48, 0xe8, 0x4c, 0x18, 0x9d, 0x7e, 0xb2, 0xb5, 0xb7,
+    0x6e, 0xba, 0x2f, 0x25, 0x92, 0x4c, 0xf9, 0xc1, 0x15, 0xb4, 0xe7, 0xf1, 0x63, 0x5b, 0x90, 0xea,
+    0xe6, 0x31, 0x44, 0x3b, 0x6f, 0x9a, 0xae, 0xf5, 0x45, 0xbe, 0x41, 0x42, 0xfd, 0x15, 0x9c, 0xe2,
+    0xe2, 0xb4, 0x89, 0x6c, 0x6b, 0x98, 0x88, 0x4d, 0xba, 0xdd, 0x15, 0x24, 0x83, 0xd0, 0xb3, 0x64,
+    0x2a, 0x1b, 0x4f, 0xc9, 0xe4, 0xf4, 0x59, 0xc7, 0x17, 0xf3, 0x08, 0xfb, 0xeb, 0xff, 0x3a, 0xf0,
+    0xed, 0x6d, 0x61, 0xff, 0xa6, 0x50, 0xaf, 0xe6, 0x98, 0xfb, 0x37, 0x13, 0x7e, 0x7b, 0x6a, 0xfa,
+    0x4f, 0x0e, 0x63, 0xfa, 0xf7, 0x71, 0x15, 0x13, 0xd3, 0x57, 0xff, 0x26, 0x54, 0x70, 0x5d, 0x06,
+    0x38, 0x03, 0xd1, 0x44, 0x80, 0x59, 0xe3, 0xbf, 0x50, 0x02, 0x5f, 0x05, 0xa5, 0x57, 0x02, 0x5b,
+    0x19, 0x73, 0x6c, 0xfe, 0xba, 0x9f, 0x29, 0x4c, 0x7b, 0xc5, 0x7f, 0x4a, 0xe2, 0x28, 0x33, 0x18,
+    0x44, 0x3f, 0x50, 0xc7, 0x5e, 0xbe, 0xff, 0x2e, 0x7e, 0xce, 0xad, 0xd3, 0x1b, 0x28, 0xca, 0x16,
+    0x96, 0x94, 0xd0, 0xf9, 0xa5, 0xb3, 0xd3, 0xb4, 0x25, 0x5a, 0x70, 0x31, 0x84, 0xd6, 0x4d, 0xb4,
+    0x02, 0xd0, 0x77, 0x02, 0x59, 0x93, 0x6e, 0x4a, 0x0e, 0xc7, 0x27, 0x61, 0xc4, 0xeb, 0x9a, 0xe5,
+    0x89, 0x37, 0xfa, 0x60, 0x08, 0x5e, 0xec, 0xd6, 0x32, 0x2e, 0x88, 0x81, 0x0c, 0x24, 0xb0, 0x74,
+    0x2f, 0xf1, 0xaa, 0x92, 0x77, 0xae, 0xda, 0x83, 0x96, 0xad, 0xbf, 0x3b, 0x57, 0x5a, 0xfe, 0x8c,
+    0x9f, 0x09, 0x85, 0x0f, 0x50, 0x57, 0x71, 0x41, 0x0e, 0x92, 0x4a, 0xf5, 0x32, 0x61, 0xd9, 0xa4,
+    0xae, 0x22, 0xa9, 0xdd, 0xe3, 0xd2, 0x64, 0x71, 0x2f, 0xde, 0x68, 0x3a, 0xaa, 0xbb, 0xe0, 0x76,
+    0x66, 0x29, 0x0b, 0x2f, 0x39, 0xc9, 0x04, 0x31, 0x7d, 0x62, 0x75, 0x63, 0x79, 0x9a, 0x47, 0x50,
+    0x7f, 0xfb, 0x19, 0x33, 0xf7, 0x41, 0x70, 0x11, 0x44, 0x5d, 0xa9, 0xb6, 0x77, 0x00, 0xf5, 0x46,
+    0x70, 0xae, 0x75, 0x45, 0xc5, 0xf8, 0x8c, 0x94, 0x95, 0xe3, 0x52, 0x2f, 0x53, 0x00, 0x7e, 0x8b,
+    0x42, 0xf4, 0x55, 0x72, 0xf8, 0xbe, 0xe3, 0x4d, 0xca, 0x3f, 0x63, 0x88, 0xc4, 0xa3, 0xed, 0x3c,
+    0x7f, 0x23, 0xe3, 0x76, 0x55, 0x1b, 0x41, 0x51, 0x02, 0xdb, 0xa9, 0xb6, 0x7d, 0xb3, 0x59, 0x2d,
+    0xb7, 0x03, 0x63, 0x15, 0x7f, 0x98, 0xc2, 0x70, 0x1e, 0x3b, 0xbf, 0x81, 0x50, 0xfc, 0xc8, 0x72,
+    0x03, 0x12, 0xa3, 0xfb, 0x36, 0xb6, 0x9d, 0x44, 0x43, 0xa1, 0xb9, 0x5b, 0xef, 0xbd, 0xc1, 0xe0,
+    0x3e, 0xf8, 0x4f, 0xd5, 0xe9, 0x9e, 0x24, 0x4b, 0x0c, 0x9c, 0x8d, 0xf0, 0xfd, 0x86, 0x54, 0x4e,
+    0x0b, 0xf8, 0xb0, 0x16, 0xc9, 0x62, 0x43, 0x6d, 0x8f, 0x1b, 0x53, 0x31, 0x2c, 0x18, 0x03, 0x3c,
+    0x69, 0x35, 0xd3, 0xf6, 0x9c, 0x0c, 0xa7, 0x3d, 0xc3, 0xd5, 0x3e, 0xeb, 0x36, 0x7e, 0x81, 0x5d,
+    0xec, 0x81, 0xae, 0x0e, 0x27, 0x88, 0x3d, 0x42, 0x6b, 0x16, 0xa5, 0x0b, 0xe9, 0x8b, 0x7a, 0xe6,
+    0x49, 0xb5, 0x48, 0x81, 0xf6, 0xe8, 0xf2, 0x20, 0x66, 0xb9, 0x54, 0x49, 0x55, 0x87, 0x55, 0x8c,
+    0x39, 0xec, 0x7f, 0xa6, 0x25, 0xd7, 0xce, 0x0d, 0x00, 0x64, 0xf0, 0x97, 0xdf, 0x97, 0xfe, 0x93,
+    0x1c, 0x91, 0x25, 0xcf, 0x8c, 0x20, 0xd7, 0x5b, 0x57, 0x96, 0x1d, 0x2d, 0xed, 0x62, 0xc1, 0xd9,
+    0x29, 0x0f, 0x8a, 0xde, 0xc5, 0xad, 0x84, 0x6d, 0xca, 0xa0, 0x58, 0xbf, 0xb6, 0xfb, 0x0d, 0xf0,
+    0x76, 0x9f, 0x26, 0x7a, 0x89, 0x0c, 0x6b, 0x02, 0x7a, 0xc5, 0x8f, 0xd9, 0xc2, 0x03, 0x61, 0x74,
+    0xb6, 0x0e, 0x80, 0xe7, 0xe0, 0xb5, 0xac, 0xac, 0x63, 0xf8, 0xe6, 0x81, 0x64, 0xdc, 0xec, 0xdb,
+    0xf1, 0x4e, 0x8f, 0xc5, 0x4c, 0xce, 0xd8, 0x36, 0x32, 0xcd, 0x4b, 0x57, 0xc4, 0xaa, 0xbb, 0x2b,
+    0x53, 0x7e, 0x74, 0xe4, 0x4f, 0x0b, 0x44, 0xb0, 0x90, 0x61, 0x84, 0xa8, 0x2e, 0x9b, 0x6e, 0xc4,
+    0xde, 0xdb, 0x93, 0xe6, 0x33, 0x08, 0x1e, 0x73, 0xfb, 0x45, 0xba, 0x42, 0xa3, 0xb0, 0x45, 0x06,
+    0x49, 0x00, 0xf9, 0x4e, 0xfe, 0x71, 0xa0, 0x06, 0xe6, 0x10, 0x10, 0xa6, 0xf7, 0x71, 0xc5, 0xc2,
+    0xfe, 0xc5, 0x04, 0x36, 0xaf, 0xff, 0x72, 0xec, 0x38, 0xaf, 0x6c, 0xc3, 0xd0, 0x37, 0xf0, 0x83,
+    0x59, 0x3a, 0x7a, 0x9e, 0x5b, 0xee, 0x11, 0xec, 0x9f, 0xba, 0x18, 0xc2, 0x84, 0x4c, 0x65, 0x1e,
+    0x3b, 0xdf, 0x4a, 0xde, 0x26, 0xc9, 0x87, 0x06, 0xa7, 0x52, 0xff, 0x88, 0x4d, 0x2b, 0xe1, 0x8d,
+    0x2d, 0x17, 0x73, 0xfc, 0x26, 0x3a, 0xe0, 0x1a, 0xe7, 0xbf, 0x8a, 0xb1, 0x0d, 0xf5, 0x1b, 0x29,
+    0x06, 0xf5, 0x45, 0xa4, 0xe5, 0x52, 0x22, 0xb4, 0xd7, 0x89, 0x0d, 0x40, 0x0b, 0x0f, 0x1e, 0x49,
+    0xe3, 0xdc, 0x53, 0x08, 0x22, 0x14, 0xd4, 0x81, 0x5f, 0xe7, 0x65, 0x95, 0x30, 0x03, 0x63, 0xfb,
+    0x4b, 0x5f, 0x86, 0x95, 0x45, 0xae, 0x9f, 0xe0, 0x64, 0xed, 0x60, 0xdc, 0x33, 0x7c, 0x72, 0x20,
+    0xef, 0xef, 0x8c, 0xf6, 0x0f, 0xa4, 0x21, 0xfe, 0x02, 0x9f, 0xf3, 0xf0, 0x8a, 0x38, 0xd3, 0x4a,
+    0x55, 0xe0, 0xbc, 0x5e, 0xc5, 0x48, 0x47, 0xe2, 0x08, 0xdf, 0x3f, 0x2e, 0x0c, 0x41, 0x2c, 0xff,
+    0x47, 0xd5, 0xbd, 0x9f, 0x1c, 0x51, 0x48, 0x56, 0x17, 0xf3, 0x9f, 0xec, 0x6f, 0xff, 0xf6, 0xcb,
+    0xa4, 0xa2, 0xc4, 0xa1, 0x32, 0xac, 0x38, 0x05, 0xff, 0xc9, 0x42, 0x82, 0x57, 0xea, 0x5e, 0xe1,
+    0x98, 0xb0, 0x42, 0x39, 0xbe, 0x91, 0x81, 0x38, 0xca, 0x25, 0x2c, 0x6d, 0xba, 0x66, 0xce, 0xc1,
+    0x0e, 0x49, 0x3e, 0x91, 0x26, 0x8d, 0x37, 0x73, 0x10, 0xcb, 0xb2, 0x58, 0xeb, 0xf3, 0x2d, 0xdc,
+    0x7e, 0x58, 0xdc, 0x2e, 0x49, 0xa8, 0x13, 0x30, 0x30, 0x66, 0xd9, 0xec, 0xc7, 0x78, 0x8b, 0x1f,
+    0x48, 0x2a, 0xbc, 0xc7, 0x48, 0x33, 0xb2, 0xe1, 0xaa, 0xca, 0x73, 0x95, 0x24, 0xaf, 0xed, 0xe6,
+    0xb5, 0x54, 0x8d, 0x9b, 0x93, 0x00, 0xd7, 0x23, 0x65, 0x0e, 0x23, 0x02, 0xeb, 0xdb, 0xb8, 0xa0,
+    0xea, 0xb9, 0x9e, 0xf2, 0x1d, 0xff, 0x8a, 0x8d, 0xf8, 0x4e, 0x1c, 0xbd, 0x18, 0xdf, 0xf2, 0xc2,
+    0x43, 0x1a, 0xae, 0x44, 0x49, 0xf8, 0xe4, 0x68, 0x4b, 0xd1, 0xc7, 0x40, 0x9d, 0xc1, 0x9e, 0x70,
+    0x5f, 0x16, 0xfb, 0x66, 0xda, 0x6c, 0x94, 0x8d, 0x96, 0x44, 0x73, 0x15, 0xaf, 0xfe, 0x2b, 0x20,
+    0xa5, 0x25, 0x25, 0xdc, 0x75, 0x22, 0x86, 0x15, 0xa9, 0x5d, 0x63, 0x44, 0x19, 0x27, 0xc1, 0x53,
+    0x0f, 0x45, 0xe0, 0xe0, 0xeb, 0xff, 0x8a, 0xb8, 0x4f, 0x25, 0x16, 0xd8, 0x70, 0xc1, 0x6c, 0xec,
+    0xbd, 0x91, 0x44, 0x54, 0x96, 0xe2, 0xc4, 0x9c, 0x45, 0x0a, 0x0f, 0x55, 0xa5, 0x0d, 0xf3, 0xe4,
+    0xd5, 0x1a, 0x23, 0x09, 0xd9, 0x91, 0xeb, 0x52, 0x12, 0x55, 0x5a, 0xb0, 0x59, 0x5a, 0xcf, 0x89,
+    0x1c, 0xba, 0x63, 0x21, 0xd1, 0x30, 0x32, 0xca, 0xa9, 0xab, 0x61, 0xc0, 0x47, 0x85, 0x16, 0xc7,
+    0x34, 0x16, 0x1f, 0x6c, 0x51, 0x85, 0xb3, 0xf2, 0x57, 0xa9, 0xb6, 0x36, 0xdd, 0x22, 0x80, 0x83,
+    0xe5, 0xf6, 0xd1, 0x06, 0x7c, 0xd2, 0xea, 0xee, 0x3e, 0x29, 0x0d, 0x81, 0x6f, 0x70, 0x0d, 0x0f,
+    0xa2, 0xa7, 0xc1, 0xab, 0xd3, 0x57, 0x36, 0xf9, 0x9f, 0xb5, 0xde, 0x27, 0x25, 0xe6, 0x6d, 0xae,
+    0x6d, 0x60, 0x8b, 0xf2, 0xd9, 0x1d, 0x24, 0xab, 0xd4, 0xd6, 0x09, 0xf3, 0x28, 0xaa, 0x3e, 0xe1,
+    0x3f, 0xda, 0xcd, 0x4f, 0x02, 0xb2, 0x2a, 0x9b, 0xb3, 0xa9, 0xed, 0x23, 0xd9, 0x1c, 0x1b, 0x96,
+    0xa8, 0x04, 0x07, 0xa9, 0xe1, 0xdb, 0x12, 0xab, 0x23, 0xc2, 0x08, 0x8f, 0xa4, 0x13, 0xf6, 0x04,
+    0xa1, 0x14, 0xdb, 0x9c, 0xde, 0x92, 0x92, 0x24, 0xe7, 0x76, 0xc7, 0xe8, 0xd6, 0x10, 0x10, 0xa7,
+    0x95, 0x9b, 0x78, 0x1d, 0x08, 0x00, 0x64, 0x71, 0xe8, 0x27, 0x3d, 0x10, 0x6b, 0xe2, 0x06, 0x12,
+    0x04, 0xcc, 0xda, 0x2a, 0xb6, 0x98, 0x78, 0x4c, 0xfa, 0x92, 0x0d, 0xf8, 0xbd, 0x14, 0xca, 0x25,
+    0xd0, 0x67, 0x78, 0xa7, 0xe3, 0xdb, 0xe2, 0x57, 0xd8, 0xcf, 0xc5, 0x63, 0x90, 0xd5, 0x18, 0x25,
+    0x81, 0x7d, 0x45, 0x4f, 0x09, 0x89, 0x3e, 0x90, 0xce, 0xbb, 0x76, 0x8f, 0xac, 0x26, 0xe8, 0x14,
+    0x37, 0xe5, 0x5e, 0x20, 0xab, 0x4b, 0xcb, 0x94, 0xdb, 0x6a, 0x87, 0x9b, 0xad, 0xf7, 0xb3, 0xab,
+    0x83, 0xed, 0x49, 0x87, 0x82, 0x0c, 0x5f, 0x01, 0xb0, 0x4b, 0x09, 0xed, 0x24, 0xc4, 0x86, 0xe2,
+    0x23, 0xc1, 0x27, 0x23, 0xbc, 0xca, 0x5d, 0x88, 0x94, 0xbb, 0x11, 0x11, 0x4e, 0x47, 0xd4, 0x0f,
+    0x40, 0x0b, 0x76, 0x39, 0x7b, 0x13, 0x48, 0x10, 0x90, 0x4f, 0xe5, 0xa8, 0x1e, 0x03, 0xb0, 0x50,
+    0x32, 0x78, 0xe0, 0x0b, 0x31, 0x2f, 0xf6, 0x58, 0x0c, 0xa2, 0xe2, 0x04, 0xcf, 0xca, 0x53, 0xaf,
+    0x2a, 0x9f, 0xbf, 0x4c, 0x59, 0xd3, 0x08, 0x7f, 0xb7, 0x1b, 0x8f, 0x72, 0xb4, 0xc3, 0x35, 0xf5,
+    0x7c, 0x36, 0xec, 0x0c, 0xe2, 0x39, 0x32, 0x86, 0x26, 0xc5, 0xed, 0x9d, 0x17, 0x2e, 0x5d, 0x75,
+    0xf4, 0xef, 0x53, 0x70, 0x9b, 0xc0, 0x87, 0x4f, 0x8c, 0xb6, 0x90, 0x6b, 0x0c, 0x17, 0x25, 0x3a,
+    0x34, 0x23, 0xaf, 0x7d, 0x30, 0x70, 0x85, 0xd6, 0x0a, 0xe5, 0x3c, 0xff, 0x60, 0x19, 0x6d, 0xfe,
+    0x6b, 0x29, 0xcd, 0x5f, 0x02, 0x43, 0x0b, 0xd5, 0x86, 0x28, 0x23, 0x20, 0xd8, 0x6c, 0x94, 0xe6,
+    0x3d, 0x84, 0xd8, 0x05, 0xb4, 0xec, 0x22, 0x99, 0x0f, 0xa6, 0x40, 0x24, 0x4a, 0xa6, 0x8c, 0x13,
+    0x3b, 0xa3, 0x34, 0x1f, 0x6e, 0x14, 0x39, 0xcd, 0x03, 0x84, 0xe5, 0xbe, 0x29, 0x16, 0xf5, 0xf2,
+    0xd4, 0x1d, 0xfa, 0xf3, 0x1e, 0xa3, 0x10, 0xdc, 0x34, 0xde, 0x65, 0x64, 0xe9, 0x23, 0x22, 0x39,
+    0x28, 0x09, 0xc2, 0x10, 0x11, 0xf1, 0x68, 0xbe, 0x32, 0x8d, 0x9d, 0xff, 0x68, 0x80, 0x37, 0x86,
+    0x3a, 0xef, 0xad, 0x0b, 0x12, 0x10, 0x43, 0xfb, 0xce, 0x14, 0x44, 0x0f, 0x5c, 0x05, 0x90, 0x2c,
+    0x37, 0x71, 0x6b, 0xc3, 0xd8, 0x06, 0xee, 0x9a, 0x54, 0x11, 0x9c, 0x80, 0x61, 0x0a, 0x45, 0xfb,
+    0xd6, 0xd3, 0x43, 0xa7, 0xcc, 0x39, 0x2e, 0x19, 0x3d, 0xaf, 0xa0, 0x28, 0x9c, 0x31, 0xa3, 0x1c,
+    0xb4, 0x65, 0xdf, 0xdc, 0x36, 0xad, 0x82, 0xd7, 0x7f, 0x0b, 0x45, 0x36, 0xcc, 0x86, 0xf3, 0x89,
+    0x15, 0xd8, 0x95, 0x9f, 0xd2, 0x3c, 0xe5, 0x78, 0x9c, 0x0e, 0xba, 0x10, 0xac, 0xb7, 0x46, 0xae,
+    0x7b, 0x6a, 0xb7, 0xb9, 0xcc, 0x90, 0x69, 0x09, 0x76, 0x04, 0xbe, 0x00, 0x81, 0x0e, 0xf3, 0x0b,
+    0x2e, 0xf4, 0x8d, 0xaa, 0x53, 0xb3, 0x7e, 0x00, 0xe5, 0xaa, 0x7d, 0x55, 0x19, 0x49, 0xfa, 0x1b,
+    0xdd, 0x41, 0x2f, 0x3e, 0xd9, 0xd6, 0x64, 0x9a, 0xdd, 0xe5, 0x91, 0x1c, 0xa3, 0xc4, 0x66, 0xba,
+    0x44, 0x35, 0x6e, 0x5b, 0x66, 0xac, 0x5c, 0x30, 0xaf, 0x55, 0x01, 0x46, 0x04, 0x6f, 0x20, 0x90,
+    0x4a, 0x17, 0x62, 0x2a, 0x83, 0x06, 0x3a, 0x53, 0x9b, 0xa2, 0xe9, 0x8a, 0xa4, 0x0e, 0xde, 0x60,
+    0x27, 0x29, 0x1c, 0x08, 0x16, 0xda, 0x44, 0xd7, 0x9a, 0x78, 0xc6, 0xaa, 0xbd, 0xfd, 0x20, 0xd1,
+    0x9d, 0x76, 0x2a, 0xdc, 0xdb, 0xfb, 0x6b, 0xd7, 0xab, 0x9f, 0x3f, 0x27, 0xe9, 0x65, 0x93, 0x3b,
+    0x4a, 0xc9, 0x87, 0xa6, 0xa8, 0xe0, 0xf3, 0xe2, 0x7b, 0xf8, 0xb0, 0xc9, 0x3a, 0x28, 0x39, 0x7d,
+    0x61, 0x75, 0xda, 0xc6, 0xd2, 0x63, 0xe9, 0x2b, 0x73, 0xe8, 0xcf, 0x39, 0x8f, 0x49, 0xbe, 0x6b,
+    0xdd, 0xc3, 0x94, 0xcb, 0x16, 0x92, 0x43, 0xc3, 0x2d, 0x89, 0xa6, 0x87, 0xf7, 0xee, 0x2c, 0xcd,
+    0xad, 0xbf, 0x41, 0xdf, 0xbd, 0xbb, 0xcf, 0x1c, 0x3f, 0xed, 0x02, 0x96, 0xb5, 0x03, 0x33, 0x27,
+    0xd1, 0x91, 0x26, 0xa1, 0x7a, 0x58, 0x25, 0x07, 0xa2, 0x37, 0x32, 0x19, 0xce, 0xaf, 0xdb, 0xc4,
+    0xaf, 0xd7, 0x09, 0x92, 0xd4, 0x40, 0xc6, 0xc3, 0xc2, 0xd8, 0x80, 0xa9, 0x28, 0x3e, 0x08, 0x9e,
+    0x04, 0x06, 0xe6, 0xd5, 0x23, 0x43, 0x4b, 0x9a, 0x4c, 0xcc, 0x3c, 0xc6, 0x04, 0x08, 0x75, 0x62,
+    0x72, 0x16, 0x04, 0x7f, 0x4b, 0x7a, 0xf0, 0x8f, 0x27, 0xf5, 0x0c, 0x15, 0x0c, 0x15, 0xc0, 0xb8,
+    0xc8, 0x0a, 0x39, 0x66, 0xbb, 0x65, 0x58, 0xad, 0xa5, 0xc2, 0x97, 0xcb, 0xcc, 0x1d, 0x8d, 0xcc,
+    0x84, 0x3c, 0xb9, 0x3b, 0xfa, 0x77, 0x0c, 0x98, 0x57, 0x7c, 0x9e, 0xe5, 0xe8, 0x6c, 0xf1, 0x28,
+    0x20, 0x7b, 0xcd, 0xa3, 0x7b, 0xc3, 0x1d, 0xf7, 0x03, 0x76, 0xbb, 0x92, 0x97, 0x68, 0x76, 0x3f,
+    0x80, 0xf9, 0xa1, 0x48, 0x3a, 0x9f, 0xdf, 0xc1, 0x97, 0xcd, 0x4c, 0x1e, 0x97, 0x46, 0x2d, 0x5c,
+    0xb7, 0x1b, 0xd6, 0x36, 0x9a, 0x5d, 0xd9, 0xc0, 0xdc, 0x10, 0x97, 0xc7, 0x60, 0x7d, 0x4c, 0x8a,
+    0xdf, 0x61, 0x6c, 0xdd, 0x58, 0x42, 0x8f, 0x48, 0xe5, 0x5a, 0x1d, 0x1c, 0x49, 0x1a, 0xef, 0xbb,
+    0x72, 0x3d, 0x73, 0x73, 0xfb, 0x36, 0xdf, 0x58, 0x3e, 0xe6, 0x31, 0xcc, 0x4e, 0x12, 0xfb, 0x6c,
+    0xae, 0xef, 0xe3, 0xf4, 0x36, 0x57, 0xcd, 0xa2, 0xf7, 0xae, 0xc3, 0x68, 0x35, 0x01, 0x2a, 0x3a,
+    0x45, 0x2d, 0x3a, 0x2e, 0xae, 0x36, 0xcc, 0xb9, 0x74, 0x89, 0x7e, 0x19, 0x28, 0x34, 0x1d, 0x35,
+    0x7c, 0xb1, 0xd7, 0xe1, 0x5e, 0x63, 0x79, 0xae, 0x77, 0x05, 0x78, 0x54, 0x8f, 0xe0, 0xef, 0xf4,
+    0x92, 0xd1, 0x91, 0x74, 0x14, 0x50, 0x1c, 0x3a, 0x49, 0x1e, 0xb1, 0x6d, 0x08, 0xbe, 0xd0, 0x9c,
+    0x6b, 0xbc, 0xa1, 0x00, 0x02, 0x78, 0xf7, 0x13, 0x1b, 0xa9, 0x5e, 0xaf, 0xb7, 0xd7, 0x9d, 0xf7,
+    0xbb, 0x81, 0xfc, 0xfa, 0x94, 0xe7, 0xa2, 0x94, 0xf9, 0x27, 0xcd, 0x95, 0xa7, 0xfd, 0x6a, 0x1d,
+    0xab, 0x6a, 0x90, 0xdf, 0x82, 0x01, 0xd6, 0x1b, 0x14, 0xa7, 0x79, 0xd6, 0xbf, 0x9b, 0x54, 0x72,
+    0xef, 0x74, 0xc0, 0xda, 0x94, 0x42, 0x9c, 0xb6, 0x18, 0x7a, 0xde, 0x4e, 0xbf, 0xe0, 0x24, 0xd2,
+    0x44, 0xc5, 0xef, 0x97, 0x70, 0x5b, 0x89, 0xfc, 0xab, 0x50, 0xc9, 0x7f, 0x3a, 0xb4, 0x02, 0x65,
+    0x69, 0x50, 0xde, 0xc0, 0x07, 0x88, 0x6b, 0xb7, 0xe4, 0x2a, 0x60, 0xe2, 0x57, 0x3b, 0x64, 0xb4,
+    0x3b, 0x06, 0x91, 0xc4, 0x89, 0x93, 0xa2, 0xd9, 0xe1, 0x32, 0xf0, 0xe5, 0x38, 0xd6, 0x02, 0xb7,
+    0xb1, 0xe5, 0x40, 0xaa, 0x32, 0x1b, 0x8d, 0x78, 0x34, 0xce, 0xf2, 0x45, 0x77, 0x21, 0xd3, 0x9e,
+    0x38, 0x67, 0xb7, 0x83, 0x51, 0x11, 0x31, 0x12, 0xdc, 0xbb, 0x4f, 0x2d, 0xe7, 0x66, 0xeb, 0x50,
+    0xac, 0x8c, 0x8e, 0x7c, 0x80, 0x54, 0x33, 0xa3, 0xfb, 0x21, 0x39, 0x11, 0x4e, 0x4c, 0x93, 0x8c,
+    0xa3, 0xd3, 0x5e, 0x62, 0x94, 0x58, 0x03, 0x03, 0x20, 0x84, 0x49, 0x87, 0x36, 0x47, 0x0a, 0xf8,
+    0x82, 0xca, 0xba, 0x72, 0x35, 0xcd, 0x54, 0x4b, 0x80, 0x65, 0x58, 0x9a, 0x7b, 0x9c, 0x0d, 0x0c,
+    0x2c, 0x87, 0x24, 0xc7, 0x65, 0x30, 0x59, 0x03, 0xbf, 0x25, 0x20, 0x8f, 0xb5, 0x0e, 0xd7, 0x09,
+    0x83, 0x16, 0xc3, 0x7f, 0xe2, 0x18, 0x40, 0x12, 0x61, 0x32, 0xc3, 0x9b, 0x85, 0xb0, 0xf0, 0x91,
+    0xde, 0x28, 0x56, 0x4b, 0xee, 0x37, 0x06, 0x58, 0x73, 0x01, 0x40, 0x00, 0x11, 0xee, 0x68, 0x35,
+    0x7c, 0x4a, 0x03, 0x42, 0x97, 0xba, 0xe7, 0x6e, 0x59, 0x09, 0x86, 0xc2, 0x21, 0x84, 0xfb, 0xb3,
+    0xa2, 0xf2, 0xf5, 0xef, 0x62, 0xd5, 0x75, 0xa2, 0x30, 0x1a, 0x01, 0x1d, 0x70, 0x45, 0xcd, 0x81,
+    0x85, 0x6b, 0x47, 0x3d, 0xa7, 0xf2, 0x56, 0xae, 0xb4, 0x39, 0x85, 0xb5, 0xfa, 0x96, 0x1b, 0xed,
+    0xc5, 0x2c, 0xa6, 0xb0, 0xdb, 0x6f, 0xc2, 0x81, 0x0b, 0x81, 0x1b, 0x32, 0x7c, 0xd8, 0xba, 0x6e,
+    0x92, 0x08, 0xe8, 0x88, 0x04, 0xe5, 0xd7, 0x8f, 0xcc, 0xcf, 0x38, 0x3a, 0x8c, 0x0c, 0x71, 0x15,
+    0xdb, 0x1c, 0x34, 0xd8, 0xc6, 0x08, 0xbf, 0x74, 0xac, 0xb7, 0xdc, 0xf6, 0xdc, 0xa6, 0x8f, 0xd7,
+    0xd0, 0xec, 0x04, 0x4a, 0x04, 0xbc, 0xc5, 0x02, 0x8d, 0xe9, 0xf4, 0x79, 0x58, 0x21, 0x1c, 0xee,
+    0x91, 0x80, 0x67, 0xa9, 0xed, 0x68, 0xe7, 0xca, 0x15, 0x03, 0xd0, 0x19, 0x2b, 0x8c, 0xc1, 0xe9,
+    0xc5, 0xc9, 0xe0, 0xa1, 0x4c, 0x76, 0xe3, 0xc9, 0x51, 0x10, 0x4c, 0x8d, 0x36, 0x99, 0x38, 0xdf,
+    0xef, 0x2e, 0xd6, 0xe9, 0xed, 0x7a, 0x56, 0xa0, 0x49, 0xc4, 0x30, 0x67, 0xc3, 0x85, 0xca, 0x7c,
+    0x57, 0x82, 0x75, 0x57, 0xa7, 0x8c, 0xe7, 0x8a, 0x64, 0x2b, 0x50, 0x1d, 0x2b, 0x94, 0xb8, 0xf3,
+    0x40, 0x7b, 0x3c, 0x3b, 0xd4, 0x55, 0x4a, 0x30, 0xb5, 0x69, 0x96, 0x8d, 0x93, 0x4f, 0x97, 0x50,
+    0x2d, 0x27, 0xf7, 0x5e, 0x97, 0xf6, 0x49, 0x15, 0x73, 0x31, 0x61, 0x7b, 0xdb, 0xc1, 0x73, 0xff,
+    0x4b, 0x21, 0x6d, 0x5f, 0x4c, 0xf9, 0xa5, 0x6e, 0x68, 0xdb, 0x4a, 0xb0, 0xaf, 0x73, 0xa8, 0x73,
+    0x7f, 0xc5, 0xb4, 0xee, 0x84, 0xdf, 0xff, 0x25, 0x17, 0x2b, 0x71, 0xff, 0xa7, 0xf1, 0x1e, 0xd1,
+    0x2a, 0xf7, 0x60, 0xcc, 0x16, 0x1c, 0xb5, 0x57, 0x2c, 0xe8, 0x81, 0x18, 0xa9, 0x48, 0xff, 0x33,
+    0x35, 0x79, 0xa5, 0x31, 0x92, 0x43, 0x89, 0xa3, 0x8c, 0x66, 0x66, 0x6f, 0x8a, 0x1c, 0x55, 0x1c,
+    0x87, 0xeb, 0xd2, 0x26, 0xc8, 0xfe, 0xbe, 0x89, 0x79, 0x9b, 0xdf, 0xab, 0x7f, 0xe2, 0xdc, 0xe5,
+    0xba, 0x5b, 0x0d, 0x9c, 0x37, 0x9d, 0x36, 0x91, 0x77, 0x6d, 0x2a, 0x16, 0xe8, 0x85, 0x1c, 0xe2,
+    0xfb, 0xef, 0x70, 0xee, 0x44, 0xb5, 0x39, 0xb4, 0x65, 0xd8, 0x66, 0xe8, 0xbc, 0x2c, 0x7f, 0x58,
+    0x9f, 0xaf, 0xea, 0x9f, 0x83, 0x6b, 0x4a, 0xec, 0xcf, 0x4f, 0xdd, 0x2b, 0x98, 0xfb, 0x61, 0xa7,
+    0x0f, 0x2d, 0x1c, 0x4e, 0x36, 0xc5, 0xaf, 0xc8, 0xc9, 0xbd, 0x68, 0xfc, 0xd4, 0xb2, 0xa4, 0x20,
+    0xd0, 0x38, 0xf6, 0x24, 0x21, 0x22, 0xae, 0x46, 0xab, 0xa3, 0xf6, 0xd7, 0x0b, 0xa8, 0xe3, 0xa6,
+    0x70, 0x02, 0x0e, 0xa9, 0xfc, 0x8e, 0x37, 0x04, 0x9c, 0xe7, 0xa5, 0x26, 0xbe, 0xdd, 0x13, 0xcb,
+    0x4f, 0xbc, 0x10, 0x5d, 0x1e, 0xae, 0x8d, 0x61, 0x7e, 0x60, 0xc9, 0x9f, 0xfe, 0x95, 0x0d, 0xda,
+    0x39, 0x57, 0x46, 0x7e, 0x95, 0xc3, 0xdb, 0x03, 0x82, 0x13, 0x8a, 0xa8, 0x7a, 0x93, 0x8b, 0x40,
+    0x4c, 0x42, 0x6f, 0xde, 0xf0, 0x14, 0x4f, 0x1c, 0x24, 0x3d, 0x95, 0xaa, 0x0f, 0x48, 0x8d, 0xcc,
+    0x2d, 0xc8, 0x0b, 0xa9, 0x63, 0x11, 0x3f, 0xae, 0x5d, 0xf1, 0xad, 0x99, 0xd2, 0x08, 0xab, 0x91,
+    0x67, 0xc5, 0x4e, 0x91, 0xa3, 0x69, 0xc8, 0x1d, 0xef, 0x4c, 0xc4, 0xda, 0xb1, 0x43, 0x76, 0xfd,
+    0x09, 0xe0, 0xe3, 0xf1, 0x06, 0xa3, 0x16, 0x6c, 0x46, 0x46, 0x5b, 0x07, 0xca, 0xbb, 0xe1, 0xdf,
+    0x3f, 0x49, 0xbc, 0xf6, 0xef, 0x13, 0x11, 0x74, 0x68, 0xb4, 0x74, 0x51, 0x5e, 0x9d, 0x8e, 0x91,
+    0x98, 0x90, 0xbb, 0x79, 0x06, 0x91, 0x72, 0x4d, 0xd9, 0x51, 0xc3, 0x25, 0xca, 0xff, 0xe2, 0x7b,
+    0x40, 0x67, 0x5c, 0x46, 0xe2, 0xc7, 0x6a, 0x36, 0xcb, 0x3b, 0x94, 0xb9, 0xd3, 0x9b, 0xb6, 0x1b,
+    0x7a, 0x70, 0x5f, 0x6b, 0x4b, 0xca, 0x0d, 0x51, 0x5e, 0x58, 0x69, 0x90, 0x40, 0x41, 0x5b, 0x2f,
+    0x79, 0x1c, 0x92, 0x02, 0x49, 0xdb, 0x8d, 0xaf, 0xf1, 0xd3, 0x66, 0xbf, 0xef, 0xae, 0x77, 0x29,
+    0x45, 0x91, 0x46, 0xbc, 0x28, 0x2c, 0xa4, 0x2b, 0x70, 0x54, 0x90, 0x2a, 0xf4, 0x52, 0xfb, 0xda,
+    0x16, 0xe3, 0x3f, 0x12, 0xfc, 0xbc, 0xfa, 0xa6, 0xd0, 0x00, 0x16, 0x53, 0xb9, 0x83, 0xd0, 0xf8,
+    0x1a, 0x71, 0xe7, 0x0c, 0xf7, 0x89, 0xf9, 0x05, 0x4b, 0x68, 0x05, 0x2b, 0xf2, 0xf4, 0xe3, 0x92,
+    0x20, 0xdd, 0x59, 0xf4, 0xd4, 0x1e, 0xcd, 0xb0, 0xcd, 0x9a, 0x7f, 0xef, 0x81, 0x7a, 0xe6, 0xa9,
+    0x40, 0x69, 0x39, 0x68, 0x9f, 0x34, 0x24, 0x44, 0xf9, 0x53, 0xdd, 0x33, 0x39, 0xfc, 0xad, 0x3a,
+    0xab, 0x25, 0xf1, 0x8d, 0x7e, 0xf7, 0x4e, 0xe7, 0x5a, 0x31, 0x9c, 0x6e, 0x87, 0xd4, 0x30, 0xb9,
+    0x70, 0xda, 0xd0, 0xac, 0xf7, 0x07, 0xd0, 0xb4, 0x48, 0xb4, 0x24, 0x6f, 0x3a, 0x25, 0x08, 0x52,
+    0x0b, 0xcb, 0x57, 0xed, 0xd5, 0x4e, 0x83, 0x19, 0x34, 0xf8, 0x96, 0x9d, 0xa4, 0x30, 0x44, 0x74,
+    0xa4, 0xb1, 0xdb, 0x8b, 0x54, 0x98, 0xfd, 0x34, 0x76, 0x47, 0x37, 0x1f, 0x3d, 0x8c, 0x61, 0x4d,
+    0x6d, 0xf5, 0x65, 0xa8, 0x43, 0x87, 0xb2, 0xcc, 0xd6, 0xed, 0x0a, 0xf8, 0xf7, 0xb5, 0x8d, 0x61,
+    0xce, 0x29, 0x38, 0x0d, 0xe0, 0x42, 0x4c, 0xde, 0xc1, 0x48, 0x9f, 0x2e, 0x93, 0xaa, 0x1f, 0x16,
+    0x60, 0x47, 0x91, 0x52, 0x90, 0x9b, 0x60, 0x12, 0x20, 0x3c, 0x5e, 0xb6, 0xb8, 0xf6, 0x78, 0x23,
+    0x4c, 0xb6, 0xdb, 0x59, 0xe3, 0x81, 0x24, 0xa3, 0x71, 0x23, 0x12, 0xc2, 0x26, 0xec, 0x88, 0xb8,
+    0x31, 0xa0, 0x41, 0x2f, 0xee, 0x28, 0xb8, 0xa9, 0x50, 0x84, 0x21, 0x19, 0x7f, 0x8f, 0xb5, 0xa6,
+    0x73, 0x9e, 0x01, 0x3a, 0x9e, 0xee, 0x39, 0x7d, 0x04, 0x5e, 0x22, 0xb9, 0x06, 0xe2, 0x4f, 0xb2,
+    0xcb, 0x8f, 0xeb, 0x7b, 0x8b, 0x1c, 0xad, 0x45, 0x1e, 0x6a, 0x92, 0xb7, 0x50, 0x61, 0xd4, 0xbe,
+    0x61, 0x12, 0xfc, 0x67, 0x4e, 0xe6, 0x0e, 0xe4, 0x52, 0x9c, 0x0a, 0x7f, 0xac, 0x36, 0xe6, 0xa3,
+    0x47, 0xba, 0x14, 0xbf, 0x21, 0x78, 0xb4, 0xba, 0x41, 0x97, 0xfa, 0xe5, 0xb1, 0x77, 0x11, 0xad,
+    0xfe, 0x5e, 0xc4, 0xef, 0x79, 0xc3, 0x2b, 0x21, 0x4e, 0x18, 0xbb, 0x0d, 0xb4, 0xb1, 0x9d, 0x0e,
+    0x17, 0x13, 0x4f, 0xfd, 0x18, 0xfd, 0xd3, 0x8f, 0xaf, 0xbf, 0x26, 0xe0, 0x26, 0xd2, 0xf4, 0xa2,
+    0x1a, 0x59, 0xc7, 0x09, 0x70, 0xdc, 0x2d, 0x59, 0x11, 0xbf, 0x03, 0x27, 0x07, 0x8b, 0xd1, 0x87,
+    0x16, 0x4d, 0x92, 0x33, 0x24, 0x49, 0x28, 0x3b, 0x61, 0xeb, 0x66, 0xb9, 0x9f, 0x49, 0x2c, 0xeb,
+    0x5f, 0x76, 0xe7, 0x71, 0x89, 0xc2, 0xae, 0x6f, 0x7c, 0xd5, 0x04, 0x8d, 0xa4, 0xbf, 0x4c, 0xfc,
+    0xb9, 0xd7, 0x98, 0x20, 0x37, 0x48, 0x58, 0xc5, 0xbd, 0x2a, 0xc7, 0x85, 0x52, 0xf9, 0xfb, 0x47,
+    0x84, 0xc7, 0xba, 0x10, 0xc8, 0xd9, 0x99, 0xfe, 0xb9, 0xdb, 0x98, 0x13, 0x30, 0x55, 0xbb, 0x2a,
+    0x0b, 0x34, 0x85, 0xea, 0x7f, 0x73, 0x4b, 0x21, 0xd3, 0xc5, 0xd6, 0x36, 0x41, 0x78, 0xd2, 0xe6,
+    0x00, 0xa8, 0xa3, 0xff, 0x65, 0x4e, 0x58, 0x2f, 0x40, 0x8d, 0x54, 0x46, 0xc2, 0xbc, 0xce, 0xb1,
+    0x6e, 0x0a, 0x6b, 0x79, 0x79, 0xe3, 0x37, 0x52, 0x3f, 0x4d, 0xa3, 0x4d, 0x19, 0x2b, 0x21, 0x95,
+    0x28, 0xb3, 0x47, 0x11, 0x6b, 0x72, 0x7f, 0xac, 0x70, 0xc7, 0xfa, 0x75, 0xa0, 0xce, 0x8f, 0xc1,
+    0x5c, 0x76, 0x59, 0x63, 0xb1, 0x6b, 0x36, 0xc4, 0x58, 0x2d, 0x78, 0xd4, 0x09, 0xad, 0x59, 0x77,
+    0x48, 0xae, 0x23, 0x29, 0x89, 0xa5, 0xd9, 0xb3, 0x5e, 0x92, 0xee, 0x25, 0x5b, 0xad, 0xc5, 0x63,
+    0xe1, 0x0a, 0x5c, 0xd2, 0x6d, 0x0e, 0xd0, 0x01, 0x6a, 0x6c, 0xa0, 0x3e, 0xa4, 0x32, 0x93, 0xec,
+    0x42, 0x4c, 0xd3, 0x6e, 0x9d, 0x8d, 0x1b, 0x1d, 0x24, 0x5d, 0x0c, 0x25, 0xd4, 0x97, 0x60, 0x88,
+    0xc3, 0xb3, 0x7e, 0xb7, 0xb0, 0x23, 0xc5, 0x63, 0x84, 0x60, 0x7b, 0xd6, 0xdc, 0x50, 0x61, 0xbb,
+    0x05, 0x89, 0x20, 0x9b, 0xae, 0xf6, 0xfe, 0x3a, 0x10, 0x0c, 0x1c, 0x6e, 0x22, 0x99, 0xb3, 0x87,
+    0xd6, 0x08, 0xa7, 0x2e, 0x0e, 0x65, 0xae, 0x72, 0x6d, 0xab, 0x18, 0xb8, 0x0b, 0x34, 0x9e, 0x2e,
+    0x29, 0xb2, 0x19, 0xc0, 0xdd, 0x09, 0x24, 0xd3, 0x43, 0x32, 0x15, 0x7d, 0x5f, 0x98, 0x9c, 0xba,
+    0xdc, 0x4c, 0x0a, 0x45, 0x74, 0xcd, 0x95, 0x04, 0x2b, 0x3f, 0x1c, 0xcd, 0x5d, 0x4e, 0x32, 0xcb,
+    0xa3, 0x71, 0xda, 0xe8, 0x57, 0x40, 0xb9, 0x57, 0xff, 0x5d, 0xbf, 0x2f, 0x2c, 0x29, 0xd4, 0x97,
+    0xdb, 0xa0, 0x2f, 0x8a, 0x18, 0x7e, 0x71, 0x0e, 0x4e, 0xc7, 0x9c, 0x94, 0x46, 0x0b, 0x7e, 0x4f,
+    0x67, 0x67, 0xe2, 0x41, 0xec, 0x43, 0xeb, 0x6d, 0x76, 0x9e, 0x8f, 0xd7, 0x4f, 0xd3, 0x63, 0x9d,
+    0x37, 0xfd, 0x9d, 0xd1, 0x01, 0xd8, 0x0a, 0x35, 0x8b, 0xd6, 0xe7, 0x5b, 0x58, 0x90, 0x78, 0x4d,
+    0x84, 0xb0, 0xbe, 0x9d, 0x46, 0xa2, 0x34, 0xe2, 0x75, 0x2c, 0x92, 0x63, 0x27, 0xb4, 0xc5, 0x77,
+    0xa9, 0x15, 0xd6, 0x16, 0x78, 0x3d, 0xb1, 0x38, 0xdb, 0x15, 0xe5, 0x9b, 0x0f, 0xa5, 0x44, 0xef,
+    0xbe, 0x2a, 0xce, 0x42, 0xda, 0xc8, 0xa9, 0xcc, 0xed, 0xfe, 0x79, 0x41, 0x28, 0x76, 0xd8, 0xb2,
+    0x12, 0xae, 0x37, 0x72, 0x0a, 0x75, 0xa4, 0x41, 0x48, 0xab, 0x7f, 0xca, 0x91, 0xc6, 0x47, 0x97,
+    0x17, 0xa1, 0x36, 0xdf, 0xe3, 0x50, 0x5b, 0xbe, 0x37, 0xd7, 0xb7, 0xa1, 0x7f, 0xab, 0x0c, 0xb2,
+    0x36, 0x11, 0x8a, 0xbe, 0x0f, 0x76, 0x59, 0x12, 0x5e, 0x4d, 0x9c, 0xb4, 0xd3, 0x8f, 0x6f, 0x4b,
+    0x79, 0x38, 0x0b, 0x80, 0xe5, 0x88, 0xc6, 0xe4, 0x58, 0xb8, 0xe0, 0x6f, 0x41, 0x45, 0xcc, 0x55,
+    0xd8, 0x8d, 0xee, 0x04, 0xdd, 0xea, 0x27, 0x84, 0x18, 0xf6, 0x77, 0x74, 0x56, 0xc5, 0x80, 0x70,
+    0xce, 0x4b, 0xf9, 0x96, 0x0d, 0xc8, 0x8c, 0x0f, 0xdc, 0x8f, 0xc5, 0x13, 0xf6, 0xc8, 0x9c, 0x05,
+    0x18, 0xe6, 0xd7, 0x8c, 0x18, 0x90, 0x4e, 0xb8, 0x37, 0xd8, 0xc8, 0xc7, 0x1e, 0x8a, 0x1c, 0x8d,
+    0x61, 0x01, 0x3a, 0x97, 0xd2, 0x02, 0xaf, 0xff, 0x13, 0x55, 0x7c, 0x99, 0xc5, 0x18, 0xe8, 0x2b,
+    0x63, 0xa8, 0x50, 0xe2, 0xe3, 0x64, 0x51, 0x98, 0x17, 0x53, 0xff, 0x40, 0xd3, 0xb6, 0xbe, 0xf6,
+    0xc5, 0xae, 0xd7, 0xa6, 0xed, 0x00, 0xa5, 0x99, 0x13, 0xc5, 0xd4, 0x96, 0xdb, 0xcc, 0x1a, 0xa7,
+    0x1b, 0xc5, 0x1b, 0xd9, 0x31, 0xef, 0x94, 0x01, 0xab, 0xb7, 0x76, 0xa3, 0xe9, 0x80, 0x66, 0x1e,
+    0xc1, 0xd7, 0x1e, 0x86, 0x51, 0x9b, 0xcf, 0x15, 0x52, 0x09, 0xb8, 0x73, 0x14, 0xbb, 0xd3, 0xda,
+    0xc5, 0xf0, 0x93, 0x0c, 0x45, 0xc4, 0x2c, 0x90, 0xad, 0x47, 0xbf, 0xf7, 0x20, 0x01, 0xfd, 0x50,
+    0xe0, 0x57, 0x3b, 0x68, 0x5f, 0x9b, 0xb2, 0x01, 0xe3, 0xe9, 0xe0, 0x52, 0x10, 0x6d, 0x93, 0xf4,
+    0xc3, 0x4a, 0x61, 0x93, 0x8a, 0xa0, 0x21, 0xf0, 0x92, 0x92, 0x75, 0x2f, 0xb1, 0x16, 0x51, 0x27,
+    0x4e, 0x78, 0x6b, 0xd3, 0x51, 0xe7, 0xd6, 0xc5, 0x84, 0xb2, 0x4e, 0xea, 0xdd, 0x6a, 0xe7, 0x5e,
+    0x70, 0x7e, 0x9c, 0x82, 0x93, 0x37, 0x56, 0xd6, 0x09, 0x6b, 0x3a, 0x84, 0x44, 0x0f, 0x3c, 0x4a,
+    0x57, 0x31, 0xad, 0x73, 0xbe, 0x23, 0xfb, 0x26, 0x03, 0x66, 0x67, 0x3c, 0xd7, 0xc3, 0x1b, 0x55,
+    0x49, 0x37, 0x44, 0x72, 0xe3, 0x9d, 0xdd, 0xbf, 0xf0, 0xfd, 0x1d, 0x19, 0x62, 0x18, 0xad, 0x19,
+    0xfb, 0xf9, 0x82, 0x5d, 0xde, 0xe7, 0xb1, 0x87, 0xce, 0xeb, 0x86, 0x3d, 0xa4, 0x23, 0xf9, 0x8e,
+    0xc2, 0x20, 0xfd, 0x57, 0xcd, 0x3f, 0x86, 0x30, 0x45, 0xea, 0x53, 0x61, 0x0a, 0x05, 0xb5, 0x6f,
+    0xae, 0x6a, 0x80, 0xce, 0xf7, 0xf3, 0xc4, 0x48, 0x76, 0x65, 0x08, 0x12, 0x4f, 0x07, 0xee, 0x39,
+    0x54, 0x0c, 0x5b, 0xa3, 0xb9, 0x45, 0xa6, 0xea, 0x21, 0x87, 0xad, 0x5a, 0xeb, 0x86, 0xdb, 0x1a,
+    0xd0, 0xe5, 0xaf, 0x22, 0xaf, 0x52, 0xf5, 0x42, 0xc5, 0x8d, 0xaf, 0xf1, 0xd4, 0xe8, 0x72, 0x17,
+    0x21, 0x04, 0x7d, 0x0a, 0xb2, 0x19, 0xfe, 0xd9, 0x47, 0xa5, 0xbf, 0x4a, 0xe0, 0x49, 0x4f, 0xf7,
+    0x15, 0x1c, 0x38, 0xc9, 0x43, 0x13, 0x53, 0x9b, 0x6d, 0x6a, 0x3d, 0x59, 0xbd, 0x3f, 0xbf, 0xf4,
+    0x7f, 0x72, 0x28, 0x9e, 0x69, 0x64, 0x41, 0x1b, 0x50, 0xc5, 0xf4, 0xf4, 0xd6, 0x59, 0x5a, 0xdb,
+    0xae, 0xcb, 0xc8, 0x43, 0x5c, 0x39, 0x99, 0xbd, 0xb0, 0x28, 0xb3, 0xd3, 0x4c, 0xee, 0x77, 0x71,
+    0x5f, 0x9f, 0xeb, 0x7f, 0xca, 0xda, 0x6c, 0xf8, 0x0f, 0x6e, 0xf6, 0x03, 0x6f, 0x31, 0x3c, 0x55,
+    0x02, 0x03, 0x90, 0xd8, 0xba, 0x2b, 0xd8, 0x41, 0x09, 0xd2, 0xc6, 0x2b, 0xd1, 0x69, 0x07, 0x5a,
+    0xee, 0xc7, 0x36, 0xec, 0x2c, 0x03, 0xb0, 0xdf, 0x2e, 0xb1, 0x39, 0xa5, 0x24, 0x89, 0xd6, 0xc6,
+    0x67, 0x75, 0x37, 0x44, 0x3c, 0x0e, 0xa0, 0x52, 0x26, 0xa8, 0x43, 0x92, 0xf3, 0x81, 0xfe, 0x75,
+    0xcb, 0x61, 0x2b, 0xdd, 0x9d, 0x37, 0x6d, 0x33, 0x74, 0x69, 0xff, 0x35, 0x6c, 0x06, 0xe3, 0x50,
+    0xd9, 0xeb, 0x00, 0xd5, 0x7c, 0x9e, 0x68, 0xf9, 0x2e, 0xf2, 0xa4, 0xf8, 0xa2, 0xe9, 0x8d, 0x48,
+    0xa0, 0x7b, 0xfe, 0x6e, 0x62, 0xa1, 0xca, 0x38, 0x08, 0x74, 0x59, 0xda, 0x59, 0x01, 0x2e, 0xad,
+    0xae, 0xc7, 0x52, 0x39, 0x8e, 0x30, 0x86, 0x7d, 0x85, 0x81, 0x17, 0xb9, 0x95, 0x76, 0x20, 0x42,
+    0x8f, 0x4a, 0x39, 0x16, 0x9e, 0x0a, 0x57, 0x1e, 0xd6, 0x1e, 0xf2, 0x0b, 0x44, 0x0c, 0x96, 0x3a,
+    0x3a, 0x8c, 0x60, 0x55, 0x4b, 0x52, 0xea, 0xac, 0x09, 0x15, 0xa9, 0x5f, 0x49, 0x02, 0x51, 0xcc,
+    0xca, 0x60, 0x58, 0xf6, 0x5d, 0x7a, 0x76, 0x33, 0x22, 0x0d, 0x08, 0x6c, 0xb5, 0xca, 0xf2, 0x6b,
+    0xb1, 0x70, 0x08, 0x71, 0x5e, 0x95, 0x30, 0x96, 0x6b, 0x79, 0x30, 0x30, 0x9d, 0x0b, 0x93, 0x4a,
+    0xea, 0x03, 0xcb, 0x30, 0xc7, 0x4f, 0xe7, 0x62, 0xe9, 0x96, 0xa5, 0xae, 0x13, 0xdd, 0xf4, 0xd8,
+    0x51, 0xe2, 0x87, 0xb9, 0x2b, 0x9e, 0x79, 0xb8, 0x2d, 0x42, 0xd9, 0x74, 0x50, 0x79, 0xad, 0x63,
+    0xde, 0xbf, 0xf2, 0x89, 0xb1, 0xf0, 0xe3, 0x9b, 0xf8, 0x75, 0xb1, 0xc5, 0x71, 0x64, 0x37, 0x14,
+    0x21, 0xe7, 0x0f, 0x27, 0xf5, 0x3b, 0x69, 0x84, 0x53, 0xe6, 0xf0, 0xa9, 0xa7, 0x4d, 0x68, 0x23,
+    0x6a, 0x2f, 0x0d, 0x15, 0x2f, 0x78, 0x20, 0xc7, 0x90, 0x62, 0x0a, 0x0a, 0x5f, 0x27, 0xd2, 0x2b,
+    0x85, 0xb5, 0x15, 0x64, 0x3d, 0xdf, 0x8f, 0x56, 0xe9, 0x35, 0xf6, 0xc5, 0x3c, 0xf1, 0x92, 0x42,
+    0xf7, 0x50, 0xf8, 0x5a, 0xa9, 0x0a, 0x0f, 0xe6, 0xe5, 0x8f, 0xef, 0xab, 0x20, 0xba, 0x33, 0xd2,
+    0xbe, 0xae, 0x8e, 0x6a, 0x11, 0x17, 0x9a, 0x5b, 0x93, 0x61, 0xe1, 0x99, 0xc1, 0x50, 0x61, 0xc1,
+    0xda, 0x4d, 0x0b, 0x81, 0x3c, 0x3b, 0x2a, 0x24, 0x31, 0x93, 0x61, 0x7f, 0xa6, 0x2e, 0x34, 0x46,
+    0x25, 0xa8, 0x9b, 0xb4, 0xbd, 0x9f, 0x05, 0xda, 0xb4, 0x1c, 0x9d, 0xc5, 0x3e, 0x46, 0x15, 0xce,
+    0xb4, 0x63, 0x81, 0xce, 0xb4, 0x93, 0xc2, 0x7b, 0x4e, 0x15, 0x3e, 0xfc, 0xb0, 0xe9, 0x7d, 0x12,
+    0xec, 0x3f, 0x6d, 0xa4, 0x58, 0xe9, 0x30, 0x50, 0xf5, 0x80, 0x76, 0xe3, 0xbb, 0xd7, 0x8b, 0xc5,
+    0x4b, 0x90, 0x95, 0x1d, 0x56, 0x8d, 0x61, 0xfc, 0x15, 0xbd, 0xc2, 0x04, 0xe3, 0x25, 0x8f, 0x57,
+    0xd1, 0xa5, 0xfb, 0xc9, 0xc9, 0x3d, 0x07, 0xad, 0xce, 0xb6, 0x92, 0x95, 0xec, 0x1b, 0xf6, 0x78,
+    0x2c, 0xe9, 0x67, 0x8d, 0x6c, 0x46, 0xf3, 0xa1, 0xd3, 0x74, 0x4e, 0x19, 0x72, 0xbe, 0x4b, 0x0a,
+    0xc7, 0xfd, 0x90, 0xb6, 0x19, 0x04, 0xe8, 0xad, 0x6c, 0x0b, 0x00, 0x60, 0x5f, 0xe5, 0xe1, 0x1d,
+    0x2c, 0x18, 0x79, 0xd2, 0x9c, 0x99, 0x3c, 0x6c, 0xf1, 0x14, 0x7e, 0x9c, 0xab, 0x6e, 0xc7, 0x65,
+    0x6e, 0xf3, 0x2f, 0x27, 0x7b, 0x00, 0xc4, 0x6d, 0xf6, 0x12, 0xe0, 0x87, 0x0c, 0x2c, 0x24, 0x32,
+    0x26, 0xb6, 0x7c, 0x95, 0xc9, 0x33, 0x67, 0x27, 0x39, 0xa6, 0x62, 0xf6, 0x49, 0xfc, 0xba, 0x2b,
+    0x0b, 0x1e, 0xe1, 0x70, 0xb2, 0x42, 0x2c, 0x71, 0xa3, 0xd9, 0x1e, 0x13, 0xaf, 0x04, 0xd0, 0x48,
+    0x09, 0x9e, 0x7b, 0x8b, 0xa3, 0x84, 0xf3, 0x66, 0xbf, 0xc8, 0x43, 0xa7, 0xec, 0x68, 0xfd, 0xda,
+    0x2f, 0x14, 0xff, 0xee, 0x3e, 0x08, 0x19, 0x74, 0xd0, 0xae, 0xef, 0x29, 0xc0, 0xd4, 0x61, 0xf2,
+    0x26, 0x70, 0xed, 0xcf, 0x82, 0xf2, 0x3f, 0x48, 0x47, 0xfa, 0x52, 0x6d, 0xcc, 0x5e, 0x25, 0x41,
+    0x29, 0x36, 0x98, 0x5d, 0x1f, 0x95, 0x91, 0x05, 0xe1, 0x36, 0x20, 0xac, 0xc5, 0x66, 0xa2, 0xf9,
+    0xfe, 0xdc, 0x9b, 0xa8, 0x9d, 0x9b, 0x66, 0xa5, 0xd9, 0x4a, 0xa5, 0x54, 0x52, 0x19, 0x74, 0x7d,
+    0x3c, 0x47, 0x9a, 0xf5, 0xa1, 0x5b, 0x6c, 0x50, 0xac, 0xe6, 0xf3, 0x7c, 0x5f, 0x46, 0xb8, 0x63,
+    0x09, 0x64, 0x5e, 0x07, 0x63, 0x6a, 0x26, 0x2d, 0xa6, 0x7f, 0x98, 0x6c, 0xec, 0x4b, 0xcb, 0x23,
+    0x59, 0xf8, 0x22, 0xd2, 0xf5, 0xb1, 0x59, 0x92, 0x57, 0xc8, 0x07, 0x8a, 0x9d, 0x8c, 0x23, 0x8b,
+    0xf4, 0x46, 0x68, 0x96, 0xa5, 0xb9, 0x2d, 0x58, 0x0a, 0x04, 0xbf, 0xe3, 0x64, 0xa5, 0x7a, 0x83,
+    0xc4, 0xdd, 0xb2, 0xca, 0x42, 0xef, 0x59, 0x48, 0xde, 0x9e, 0xb0, 0x2e, 0x55, 0xe2, 0xfd, 0xc4,
+    0x2c, 0x6a, 0xee, 0xfb, 0x79, 0x49, 0xf1, 0x04, 0x0b, 0x77, 0x51, 0xf0, 0x3a, 0xdc, 0x50, 0x87,
+    0x75, 0x19, 0x3a, 0x4b, 0xc5, 0x66, 0x21, 0xd9, 0x8c, 0xac, 0xda, 0x5f, 0x34, 0xa3, 0xfc, 0xd2,
+    0xb6, 0x3e, 0x69, 0x42, 0x3b, 0x65, 0x93, 0x7b, 0x04, 0x71, 0xa9, 0x55, 0xe6, 0x12, 0xaa, 0xaa,
+    0x9d, 0x98, 0x95, 0x36, 0x6f, 0x88, 0x6b, 0x55, 0xdf, 0xca, 0xfa, 0xeb, 0xd3, 0x51, 0x44, 0xc2,
+    0x88, 0xf4, 0xd2, 0xde, 0x80, 0x12, 0x69, 0xc0, 0x51, 0x13, 0xf8, 0x1e, 0x41, 0x5f, 0xa0, 0x18,
+    0xd0, 0x8a, 0x38, 0x63, 0x31, 0x6a, 0x8c, 0x12, 0x2d, 0x13, 0x56, 0x02, 0x48, 0x63, 0x03, 0x4e,
+    0xc0, 0x88, 0x61, 0xd6, 0xb6, 0x08, 0x13, 0x8b, 0x89, 0x70, 0x11, 0x46, 0x21, 0x9e, 0x19, 0x76,
+    0x83, 0x5a, 0xaf, 0x7e, 0xda, 0x7b, 0x11, 0x25, 0xa6, 0xcf, 0x2f, 0x0e, 0x5e, 0xd8, 0xff, 0x9a,
+    0xe6, 0x86, 0x9c, 0x41, 0xce, 0x81, 0x88, 0xea, 0x96, 0x72, 0x68, 0x23, 0x09, 0x38, 0x47, 0xff,
+    0x2c, 0x36, 0x0b, 0x4e, 0xf7, 0xeb, 0xdf, 0xb4, 0xb5, 0x88, 0xc6, 0xf9, 0x92, 0x92, 0x4a, 0x5a,
+    0xcb, 0x51, 0x0a, 0xc5, 0x66, 0xcc, 0xd4, 0x5a, 0x3b, 0xf2, 0xde, 0x77, 0xce, 0x42, 0x0b, 0x4a,
+    0x5f, 0x64, 0x3c, 0x10, 0xe7, 0x62, 0x87, 0x5b, 0xf7, 0x97, 0xbb, 0x70, 0xc5, 0x7c, 0xa7, 0x14,
+    0x61, 0xee, 0x34, 0x0f, 0x08, 0x40, 0x25, 0xcc, 0x6d, 0xfd, 0x8b, 0xb3, 0x1b, 0x68, 0xae, 0xb8,
+    0x61, 0xa7, 0x9a, 0x54, 0x22, 0x40, 0x7a, 0x90, 0xe1, 0xf3, 0x93, 0xe4, 0x31, 0xb4, 0xa0, 0xd5,
+    0xa4, 0xa6, 0xf0, 0xbd, 0x9d, 0x40, 0x11, 0xab, 0x8f, 0xfc, 0xb8, 0x02, 0x75, 0x14, 0x03, 0xdf,
+    0xab, 0x54, 0x47, 0x28, 0xc1, 0x55, 0x21, 0x6d, 0x7a, 0x2a, 0x46, 0x8d, 0x0c, 0x0b, 0xb8, 0x5c,
+    0x3a, 0x1b, 0x72, 0x85, 0x17, 0xf2, 0xd9, 0xf7, 0x72, 0x07, 0x05, 0x22, 0x62, 0x2b, 0x22, 0x82,
+    0x4d, 0xd2, 0xdf, 0xde, 0xd2, 0xac, 0x31, 0x47, 0x9e, 0xcd, 0x47, 0x27, 0xbf, 0xf7, 0x0d, 0x99,
+    0xe9, 0x68, 0x6b, 0x7b, 0xb1, 0x9c, 0x33, 0x80, 0x11, 0xa6, 0x3e, 0x9d, 0x93, 0x22, 0xf7, 0x6a,
+    0x70, 0xac, 0x02, 0x20, 0xea, 0x76, 0xae, 0x71, 0xfc, 0x4b, 0xd3, 0x3a, 0x88, 0xf2, 0x19, 0xd5,
+    0xf3, 0xdc, 0x58, 0x5f, 0x91, 0x87, 0x79, 0xdc, 0x4d, 0xc9, 0x55, 0x06, 0x1f, 0xa5, 0xeb, 0xb2,
+    0x94, 0x40, 0x07, 0x99, 0x6a, 0xef, 0xee, 0x46, 0xbc, 0x55, 0x1e, 0x9c, 0x2c, 0x47, 0x16, 0x71,
+    0x41, 0x86, 0x73, 0x5f, 0x51, 0xc6, 0x7c, 0xab, 0xf2, 0x79, 0x21, 0x2a, 0x92, 0xb1, 0x36, 0x0a,
+    0x75, 0xef, 0xff, 0xa7, 0x85, 0x16, 0x0f, 0xe8, 0xaa, 0x10, 0xbe, 0x79, 0x85, 0x85, 0x07, 0x85,
+    0x5c, 0xb7, 0xe2, 0x7a, 0xd2, 0x1b, 0xe2, 0x8e, 0x1b, 0x0e, 0xb2, 0x30, 0x50, 0x6e, 0xad, 0x95,
+    0x0e, 0xd3, 0x18, 0xd9, 0x44, 0x0b, 0xdf, 0x0f, 0xc4, 0xf3, 0xbb, 0xa8, 0x75, 0x80, 0xec, 0x1e,
+    0xd5, 0x41, 0x52, 0xb4, 0x23, 0x47, 0x43, 0x6b, 0xa0, 0x42, 0xfd, 0x3d, 0xb6, 0x81, 0x7f, 0x67,
+    0x13, 0x6d, 0x18, 0xa0, 0x14, 0xef, 0x99, 0xca, 0xf4, 0xfc, 0x2a, 0x49, 0x47, 0x82, 0x32, 0xd5,
+    0xe2, 0x79, 0xb9, 0x69, 0x53, 0xc0, 0xc8, 0xa3, 0xbb, 0x97, 0x2d, 0x52, 0xdc, 0x73, 0xfa, 0xd4,
+    0xab, 0x31, 0xaf, 0x98, 0xeb, 0xc4, 0x68, 0x2d, 0x93, 0xa2, 0x5e, 0xf3, 0x86, 0xb6, 0x14, 0x61,
+    0xba, 0xf8, 0x38, 0x45, 0x8a, 0x31, 0x5e, 0xcd, 0x0a, 0xdb, 0x99, 0x8b, 0x9b, 0xf9, 0x52, 0x94,
+    0x2a, 0x01, 0xe0, 0x5e, 0x0d, 0x37, 0x3a, 0x16, 0x47, 0x1e, 0x5f, 0x4d, 0x89, 0xb0, 0x30, 0x69,
+    0x7c, 0xac, 0xda, 0xb5, 0x16, 0x91, 0x36, 0xd1, 0x40, 0xe5, 0x99, 0xda, 0x67, 0x0a, 0xa6, 0xcd,
+    0x13, 0x83, 0xef, 0x9f, 0x5e, 0x32, 0x6a, 0xfc, 0xf7, 0xb4, 0xef, 0x9e, 0x70, 0x9a, 0xb7, 0xaa,
+    0x5b, 0x4c, 0xb5, 0x56, 0x12, 0x16, 0x3e, 0xd2, 0xdc, 0xe0, 0x3f, 0xf0, 0x5b, 0xae, 0xb0, 0xc3,
+    0x7b, 0xb8, 0x2f, 0x96, 0x0e, 0xb0, 0x95, 0xbd, 0x3a, 0x2f, 0xa8, 0xe2, 0x02, 0xc6, 0x3b, 0x0a,
+    0x49, 0x8b, 0x5a, 0xd6, 0xb7, 0x5b, 0xfa, 0x7f, 0x5d, 0x3e, 0xd0, 0x7d, 0xbb, 0xe4, 0x83, 0x4d,
+    0x1b, 0x74, 0x8a, 0x5e, 0x51, 0x3e, 0xc0, 0xe6, 0xc3, 0x2c, 0xb8, 0xba, 0xeb, 0x07, 0x5a, 0x81,
+    0x8c, 0x09, 0x02, 0x27, 0xa0, 0xdb, 0x68, 0x78, 0x4e, 0x68, 0xf7, 0x77, 0x54, 0x77, 0xf9, 0xed,
+    0x7b, 0x11, 0x3a, 0xb7, 0x26, 0x98, 0x0f, 0x2c, 0x4b, 0xc3, 0x75, 0xc0, 0xbb, 0x2f, 0xab, 0x5b,
+    0xba, 0x2c, 0x7b, 0xe6, 0x9e, 0x1a, 0x7e, 0x65, 0x67, 0x52, 0x17, 0x28, 0x0a, 0xa9, 0x37, 0x2f,
+    0x72, 0xce, 0x5e, 0x60, 0xd5, 0xb2, 0x04, 0xdd, 0x19, 0x4a, 0x8f, 0xfe, 0xe8, 0x6f, 0x5e, 0xef,
+    0x19, 0x5e, 0x56, 0x89, 0x26, 0xb5, 0xc3, 0xc2, 0xfb, 0x4f, 0x9e, 0xd9, 0x0e, 0x7b, 0xcf, 0x0b,
+    0x9f, 0xe5, 0xe5, 0xa3, 0xea, 0x96, 0xa1, 0x20, 0x65, 0x37, 0xc3, 0x79, 0x89, 0xa9, 0xf8, 0xc3,
+    0x8e, 0x0d, 0x50, 0x50, 0xc0, 0xfa, 0x72, 0x70, 0xfd, 0x86, 0x92, 0xb7, 0xd6, 0x61, 0x65, 0xea,
+    0x05, 0x03, 0x12, 0x85, 0x03, 0x6c, 0xff, 0x07, 0x86, 0xde, 0xe9, 0x9d, 0xee, 0x71, 0x84, 0x52,
+    0x0e, 0x07, 0x0e, 0x00, 0x68, 0xe7, 0x0a, 0x45, 0x56, 0x90, 0x9e, 0xc7, 0x72, 0xb9, 0xab, 0x9a,
+    0x74, 0x3a, 0xc0, 0x2a, 0xfb, 0x0a, 0x16, 0x78, 0x48, 0xa8, 0x1c, 0x72, 0x98, 0x71, 0x5c, 0xae,
+    0x84, 0x3f, 0x64, 0xcf, 0x21, 0xc8, 0xe5, 0x82, 0x86, 0x21, 0x49, 0x2d, 0xee, 0x42, 0x7f, 0xc4,
+    0x45, 0xd3, 0x00, 0x49, 0x35, 0x43, 0x88, 0x8d, 0xa5, 0xd1, 0xca, 0x56, 0x3f, 0xb5, 0x48, 0x37,
+    0x17, 0xc2, 0x63, 0x05, 0x51, 0x5d, 0xdc, 0x99, 0xe8, 0x93, 0x92, 0x32, 0x2e, 0x23, 0xc9, 0x3d,
+    0xcb, 0x02, 0x6a, 0xa7, 0x4f, 0xa5, 0xce, 0x5b, 0x54, 0x90, 0x68, 0xf6, 0xbf, 0x27, 0xb4, 0x23,
+    0x89, 0xd6, 0xa8, 0xfb, 0xd9, 0x77, 0x24, 0xff, 0x20, 0x79, 0xc3, 0x01, 0x90, 0x63, 0x6a, 0x8a,
+    0x29, 0x42, 0x19, 0xa3, 0xa6, 0x84, 0x98, 0xad, 0xa5, 0x9f, 0x51, 0x79, 0x4a, 0xfb, 0x3a, 0x0a,
+    0xee, 0x49, 0x56, 0xfb, 0x48, 0x47, 0xa3, 0xf1, 0x3b, 0x41, 0x8b, 0x44, 0x49, 0xaa, 0xd0, 0x28,
+    0xf5, 0x5b, 0xc4, 0x0f, 0xce, 0xd7, 0x93, 0xa0, 0xe9, 0xf5, 0x61, 0x5c, 0x68, 0x3c, 0x2d, 0xa7,
+    0x7d, 0xaf, 0xa2, 0xaf, 0x5a, 0x5c, 0x5a, 0xa3, 0x1f, 0xa0, 0xef, 0xe6, 0x03, 0xf8, 0x92, 0x82,
+    0xbd, 0x11, 0xf3, 0x7f, 0x84, 0xfa, 0x4f, 0x52, 0xc0, 0x2c, 0x01, 0xb0, 0xdb, 0x63, 0x8d, 0x2a,
+    0x74, 0x61, 0xeb, 0x4d, 0xca, 0x23, 0xaa, 0xd5, 0xa4, 0xc7, 0x6e, 0x35, 0x6a, 0xfa, 0x65, 0x2f,
+    0x57, 0xf9, 0x4d, 0x30, 0x7f, 0x32, 0xba, 0x9e, 0x5f, 0x32, 0xb4, 0x3f, 0x56, 0x72, 0xfe, 0x9e,
+    0x9a, 0x28, 0x8d, 0x62, 0x58, 0xc1, 0xda, 0x40, 0x81, 0x35, 0x1f, 0xeb, 0x3e, 0x46, 0x63, 0xcb,
+    0xe1, 0x7b, 0xfe, 0x73, 0xb9, 0xf8, 0xeb, 0x13, 0xaa, 0x0f, 0xc3, 0x54, 0x9a, 0xd3, 0x42, 0x55,
+    0x6a, 0x7a, 0xb7, 0xff, 0x29, 0x1d, 0x4f, 0x5c, 0xb0, 0x25, 0x22, 0xd1, 0x7b, 0xa0, 0x8d, 0x79,
+    0x14, 0xa7, 0xc8, 0xbc, 0x7a, 0x9c, 0x2a, 0xe5, 0x8c, 0xa4, 0x3d, 0x3b, 0x24, 0x46, 0x52, 0x68,
+    0xc1, 0xd1, 0xf0, 0x6b, 0xa4, 0x5d, 0x60, 0x54, 0x95, 0xcb, 0xc1, 0x0c, 0x45, 0xf3, 0x93, 0x52,
+    0x13, 0xd4, 0xc9, 0x45, 0xad, 0x91, 0x58, 0x89, 0x8b, 0x15, 0xb2, 0x20, 0xb1, 0xcb, 0x0d, 0x26,
+    0xcf, 0xed, 0x06, 0x9e, 0xc4, 0xd7, 0xce, 0xc0, 0xfe, 0xb7, 0x78, 0x4c, 0x4d, 0x70, 0x51, 0xf0,
+    0x13, 0x43, 0xc3, 0xe9, 0xdc, 0xd9, 0x61, 0xa4, 0xdb, 0x53, 0x7a, 0x49, 0xd5, 0xa8, 0xbe, 0x88,
+    0x7b, 0xf8, 0xcd, 0xff, 0x72, 0xc8, 0x69, 0x75, 0x34, 0x0b, 0x08, 0xca, 0x79, 0x1c, 0x6d, 0x27,
+    0x67, 0x8f, 0x8b, 0xc8, 0xd7, 0x88, 0x0e, 0x52, 0x2d, 0x9d, 0x24, 0x88, 0xac, 0xa4, 0x50, 0x79,
+    0xc0, 0xd7, 0x10, 0xa7, 0x41, 0xb8, 0x26, 0x38, 0xb3, 0x2c, 0xbe, 0xca, 0x4c, 0xd0, 0x39, 0x97,
+    0x44, 0x28, 0x79, 0x6a, 0xd9, 0x89, 0xf1, 0x0f, 0x70, 0xae, 0x24, 0xfa, 0x62, 0x18, 0x5d, 0x3d,
+    0x0f, 0x30, 0xc1, 0x48, 0x95, 0xfc, 0xa2, 0xb6, 0x56, 0x44, 0xae, 0xa4, 0x25, 0x4d, 0x1e, 0x08,
+    0xab, 0x73, 0xf9, 0x7c, 0x96, 0x5b, 0x69, 0x7b, 0x2f, 0xce, 0xab, 0x60, 0xd6, 0x44, 0x43, 0x0f,
+    0xc4, 0xaa, 0x48, 0x53, 0x5b, 0xf4, 0x13, 0x9e, 0xbe, 0xfb, 0x26, 0x3e, 0x2a, 0x84, 0x1b, 0x55,
+    0x5e, 0xcf, 0xa9, 0x1a, 0x5e, 0x9e, 0xdc, 0x6b, 0x06, 0x04, 0xa7, 0xf2, 0x29, 0x66, 0x5f, 0xa6,
+    0xde, 0xb6, 0x34, 0x95, 0x61, 0x87, 0x90, 0x78, 0xc3, 0x2f, 0x24, 0x64, 0xbf, 0x3c, 0x0e, 0x5c,
+    0x8e, 0xac, 0xae, 0x78, 0xbd, 0xe7, 0x61, 0xd7, 0xeb, 0xe0, 0xb5, 0x71, 0x96, 0x66, 0x6d, 0x99,
+    0x13, 0xd5, 0x25, 0x00, 0xf5, 0x20, 0x31, 0x15, 0x03, 0xb8, 0xac, 0x37, 0x66, 0xd5, 0xee, 0x4d,
+    0xde, 0x85, 0x03, 0x0c, 0xf4, 0x3d, 0x8e, 0xf5, 0xe7, 0x8c, 0x3a, 0x8b, 0x25, 0xfd, 0x27, 0x21,
+    0x7a, 0xb7, 0xf4, 0x0d, 0xae, 0x2b, 0xfc, 0x52, 0xf6, 0xaa, 0x40, 0x54, 0xdf, 0xc6, 0x22, 0xd7,
+    0x11, 0x91, 0x84, 0x3b, 0x13, 0x80, 0x15, 0x32, 0x7e, 0xd2, 0xa9, 0x85, 0x5d, 0x76, 0x2a, 0x34,
+    0x64, 0x5a, 0x59, 0xa7, 0x9c, 0x57, 0xd5, 0xcd, 0xb7, 0x98, 0x76, 0xfc, 0xa1, 0x49, 0xdc, 0x29,
+    0xa7, 0xba, 0x35, 0xd3, 0x52, 0x55, 0xdf, 0xa6, 0xec, 0x7b, 0xa4, 0x17, 0x78, 0x84, 0x41, 0xe8,
+    0x87, 0x51, 0xa2, 0x83, 0xfe, 0xbc, 0xd8, 0xf5, 0x9c, 0xc0, 0xd7, 0x19, 0x89, 0xf7, 0xcb, 0x5c,
+    0x98, 0x6c, 0xf4, 0xd0, 0x9e, 0xd8, 0x6a, 0xda, 0xa1, 0x23, 0x0c, 0xde, 0x3c, 0xd8, 0xb8, 0xba,
+    0x06, 0xbf, 0xf5, 0x05, 0x10, 0x1e, 0xc1, 0x44, 0x9e, 0x9d, 0x25, 0x24, 0x01, 0xe0, 0x2e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x1f, 0x02,
+    0xe0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfa, 0x1f, 0x03, 0xe0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x1f, 0x04, 0xe0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x1f, 0x05, 0xe0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x9c, 0x50, 0xd4, 0xf1, 0x37, 0x38, 0xf8, 0x1f, 0x01, 0x00, 0x00, 0x0f, 0xe0, 0x2e, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x46, 0x1f, 0x06, 0xe0, 0x2e, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x1f, 0x07, 0xe0, 0x2e, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfa, 0x1f, 0x08,
+    0xe0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xfa, 0x1f, 0x09, 0xe0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xfa, 0x1f, 0x0a, 0xe0, 0x2e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x52, 0x50, 0xa3, 0xbb, 0x97, 0x2d, 0x52, 0x0d, 0x00, 0x00, 0x00, 0x0f, 0xe0,
+    0x2e, 0xff, 0xff, 0xff, 0x8b, 0x50, 0x44, 0x9e, 0x9d, 0x25, 0x24, 0x00, 0x00, 0x00, 0x00, 0x75,
+    0x22, 0x34, 0x0d,
+};
@@ -0,0 +1,75 @@
+// On-target test for TlsSessionClient against tools/tls_standin.py: the
+// first handshake is full and verified against the stand-in's certificate,
+// the second resumes it. Start the stand-in on the PC and generate its
+// header first (standin.h is not checked in):
+//   python3 tools/tls_standin.py --header test/test_tls_session/standin.h
+//   python3 tools/tls_standin.py
+//   pio test -e esp32s3dev -f test_tls_session
+// Uses the WiFi credentials from wifi_manager.cpp.
+#include <Arduino.h>
+#include <unity.h>
+#include <LittleFS.h>
+#include "tls_client.h"
+#include "wifi_manager.h"
+#include "standin.h"
+
+#define WIFI_WAIT_MS  20000
+
+static bool fetch_once(TlsSessionClient* client) {
+    if (!client->connect(STANDIN_HOST, STANDIN_PORT)) return false;
+    client->print("HEAD / HTTP/1.0\r\n\r\n");
+    String status = client->readStringUntil('\n');
+    client->stop();
+    return status.startsWith("HTTP/1.0 200");
+}
+
+static void test_full_then_resumed() {
+    clear_tls_sessions();
+    TlsSessionClient client;
+
+    TEST_ASSERT_TRUE(fetch_once(&client));
+    TEST_ASSERT_FALSE(client.resumed());
+
+    TEST_ASSERT_TRUE(fetch_once(&client));
+    TEST_ASSERT_TRUE(client.resumed());
+}
+
+static void test_cleared_sessions_do_full_handshake() {
+    TlsSessionClient client;
+    TEST_ASSERT_TRUE(fetch_once(&client));
+    clear_tls_sessions();
+    TEST_ASSERT_TRUE(fetch_once(&client));
+    TEST_ASSERT_FALSE(client.resumed());
+}
+
+static void test_wifi_connected() {
+    TEST_ASSERT_EQUAL_MESSAGE(WL_CONNECTED, WiFi.status(), "WiFi did not connect");
+}
+
+void setup() {
+    delay(2000);   // Lets the serial monitor attach
+
+    LittleFS.begin(true);
+    LittleFS.mkdir("/tls");
+    File ca = LittleFS.open(TLS_CA_FILE, "w");
+    ca.print(standin_ca_pem);
+    ca.close();
+    init_tls_client();
+
+    WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
+    uint32_t start = millis();
+    while (WiFi.status() != WL_CONNECTED && millis() - start < WIFI_WAIT_MS) {
+        delay(100);
+    }
+
+    UNITY_BEGIN();
+    RUN_TEST(test_wifi_connected);
+    if (WiFi.status() == WL_CONNECTED) {
+        RUN_TEST(test_full_then_resumed);
+        RUN_TEST(test_cleared_sessions_do_full_handshake);
+    }
+    UNITY_END();
+}
+
+void loop() {
+}
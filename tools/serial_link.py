@@ -0,0 +1,261 @@
+#!/usr/bin/env python3
+"""Drive a device over its USB serial link without WiFi.
+
+    serial_link.py /dev/ttyUSB0 upload build/blink.wasm [name] [--run]
+    serial_link.py /dev/ttyUSB0 cmd "l" "q"
+
+--baud sets the link speed once connected (default 2000000).
+
+Speaks the framed protocol described in lib/serial_link/serial_link.h:
+COBS frames with a CRC-32, uploads pipelined a few chunks ahead of the
+device's acknowledgements. Command output (OUTPUT frames) goes to
+stdout; log lines (LOG frames, and text from before the link started)
+go to stderr. Needs pyserial.
+"""
+import codecs
+import os
+import struct
+import sys
+import time
+import zlib
+
+VERSION = 2
+HELLO, COMMAND, BEGIN, DATA, END, CLOSE = 0x01, 0x02, 0x03, 0x04, 0x05, 0x06
+R_HELLO, R_DONE, R_ACK, R_MODULE, R_ERROR = 0x81, 0x82, 0x83, 0x85, 0xFF
+OUTPUT, LOG = 0x90, 0x91
+REPLIES = {R_HELLO, R_DONE, R_ACK, R_MODULE, R_ERROR}
+
+TEXT_BAUD = 115200
+REPLY_TIMEOUT = 3.0
+ACK_TIMEOUT = 1.0     # A chunk is on flash well within this
+
+
+def cobs_encode(data):
+    out = bytearray([0])
+    code_at, code = 0, 1
+    for b in data:
+        if b:
+            out.append(b)
+            code += 1
+        if not b or code == 0xFF:
+            out[code_at] = code
+            code_at, code = len(out), 1
+            out.append(0)
+    out[code_at] = code
+    return bytes(out)
+
+
+def cobs_decode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        code = data[i]
+        i += 1
+        if code == 0 or i + code - 1 > len(data):
+            return None
+        out += data[i:i + code - 1]
+        i += code - 1
+        if code < 0xFF and i < len(data):
+            out.append(0)
+    return bytes(out)
+
+
+def encode_frame(kind, seq, payload=b""):
+    body = bytes([kind, seq]) + payload
+    body += struct.pack("<I", zlib.crc32(body))
+    return b"\0" + cobs_encode(body) + b"\0"
+
+
+def decode_frame(data):
+    """(kind, seq, payload) from the bytes between two delimiters, or None"""
+    decoded = cobs_decode(data) if data else None
+    if (not decoded or len(decoded) < 6 or
+            zlib.crc32(decoded[:-4]) != struct.unpack("<I", decoded[-4:])[0]):
+        return None
+    return decoded[0], decoded[1], decoded[2:-4]
+
+
+class LinkError(Exception):
+    pass
+
+
+class Link:
+    def __init__(self, port):
+        import serial
+        self.port = serial.Serial(port, TEXT_BAUD, timeout=0.05)
+        self.seq = 0
+        self.segment = bytearray()
+        self.in_frame = False   # Frames are 0x00 <cobs> 0x00; text never holds 0x00
+        self.frames = []
+        # Frames may split a character, and LOG and OUTPUT interleave
+        self.text = {kind: codecs.getincrementaldecoder("utf-8")("replace") for kind in (None, OUTPUT, LOG)}
+
+    def send(self, kind, payload=b""):
+        self.seq = (self.seq + 1) & 0xFF
+        self.port.write(encode_frame(kind, self.seq, payload))
+
+    def _print(self, kind, data):
+        out = sys.stdout if kind == OUTPUT else sys.stderr
+        out.write(self.text[kind].decode(data))
+
+    def _segment_done(self):
+        data = bytes(self.segment)
+        self.segment.clear()
+        if not self.in_frame:
+            self._print(None, data)
+            self.in_frame = True
+            return
+        frame = decode_frame(data)
+        if frame and frame[0] in (OUTPUT, LOG):
+            self._print(frame[0], frame[2])
+            self.in_frame = False
+        elif frame and frame[0] in REPLIES:
+            self.frames.append(frame)
+            self.in_frame = False
+        elif data:
+            # Lost sync: that was text, and this delimiter opens a frame
+            self._print(None, data)
+
+    def poll(self):
+        for b in self.port.read(self.port.in_waiting or 1):
+            if b == 0:
+                self._segment_done()
+            else:
+                self.segment.append(b)
+        if not self.in_frame and self.segment:
+            self._print(None, bytes(self.segment))
+            self.segment.clear()
+        sys.stdout.flush()
+        sys.stderr.flush()
+
+    def reply(self, timeout=REPLY_TIMEOUT):
+        deadline = time.monotonic() + timeout
+        while not self.frames:
+            if time.monotonic() > deadline:
+                return None
+            self.poll()
+        kind, self.reply_seq, payload = self.frames.pop(0)
+        if kind == R_ERROR:
+            raise LinkError("device: %s (code %d)" % (payload[1:].decode(errors="replace"), payload[0]))
+        return kind, payload
+
+    def expect(self, kind, timeout=REPLY_TIMEOUT):
+        got = self.reply(timeout)
+        if got is None:
+            raise LinkError("no reply from the device")
+        if got[0] != kind:
+            raise LinkError("unexpected reply 0x%02x" % got[0])
+        return got[1]
+
+    def hello(self, baud):
+        self.send(HELLO, struct.pack("<I", baud))
+        payload = self.expect(R_HELLO)
+        version, self.chunk, self.window, baud = struct.unpack("<BHBI", payload[:8])
+        if version != VERSION:
+            raise LinkError("device speaks link version %d, this client %d" % (version, VERSION))
+        if baud != self.port.baudrate:
+            time.sleep(0.05)
+            self.port.baudrate = baud
+        return version, baud
+
+    def command(self, line):
+        self.send(COMMAND, line.encode())
+        self.expect(R_DONE, timeout=60)
+
+    def upload(self, data, name, run=False):
+        self.send(BEGIN, struct.pack("<I", len(data)) + name.encode())
+        if struct.unpack("<I", self.expect(R_ACK))[0] != 0:
+            raise LinkError("device did not start at offset 0")
+
+        acked = sent = 0
+        rewind_seq = None   # Last frame sent before going back
+        while acked < len(data):
+            while sent < len(data) and sent - acked < self.window * self.chunk:
+                piece = data[sent:sent + self.chunk]
+                self.send(DATA, struct.pack("<I", sent) + piece)
+                sent += len(piece)
+            got = self.reply(ACK_TIMEOUT)
+            if got is None:
+                sent, rewind_seq = acked, self.seq    # Lost on the way, either direction
+                continue
+            kind, payload = got
+            if kind != R_ACK:
+                raise LinkError("unexpected reply 0x%02x" % kind)
+            offset = struct.unpack("<I", payload[:4])[0]
+            if offset > acked:
+                acked = offset
+                continue
+            # Answers to frames that were already in flight when going
+            # back repeat the same offset; only a later frame means
+            # another one went missing
+            stale = rewind_seq is not None and not 0 < (self.reply_seq - rewind_seq) & 0xFF < 128
+            if offset < sent and not stale:
+                sent, rewind_seq = offset, self.seq
+
+        self.send(END, bytes([1 if run else 0]))
+        while True:     # Skipping answers to frames sent twice
+            got = self.reply(timeout=30)
+            if got is None:
+                raise LinkError("no reply from the device")
+            if got[0] != R_ACK:
+                break
+        if got[0] != R_MODULE:
+            raise LinkError("unexpected reply 0x%02x" % got[0])
+        payload = got[1]
+        module_id, size = struct.unpack("<HI", payload[:6])
+        sha256 = payload[6:38].hex()
+        device_ms = struct.unpack("<I", payload[38:42])[0]
+        return module_id, size, sha256, device_ms
+
+    def close(self):
+        self.send(CLOSE)
+        try:
+            self.expect(R_DONE)
+        except LinkError:
+            pass    # Falls back to text by itself after a few seconds
+        finally:
+            time.sleep(0.05)
+            self.port.baudrate = TEXT_BAUD
+            self.port.close()
+
+
+def main(argv):
+    baud = 2000000
+    if "--baud" in argv:
+        i = argv.index("--baud")
+        baud = int(argv[i + 1])
+        del argv[i:i + 2]
+    run = "--run" in argv
+    argv = [a for a in argv if a != "--run"]
+    if len(argv) < 4 or argv[2] not in ("upload", "cmd"):
+        raise SystemExit(__doc__)
+
+    link = Link(argv[1])
+    try:
+        version, baud = link.hello(baud)
+        if argv[2] == "cmd":
+            for line in argv[3:]:
+                link.command(line)
+        else:
+            path = argv[3]
+            name = argv[4] if len(argv) > 4 else os.path.basename(path).split(".wasm")[0]
+            with open(path, "rb") as f:
+                data = f.read()
+            start = time.monotonic()
+            module_id, size, sha256, device_ms = link.upload(data, name, run)
+            elapsed = time.monotonic() - start
+            print("\n%s -> module %d, %d bytes in %.2f s (%.0f KB/s at %d baud), sha256 %s" % (
+                name, module_id, size, elapsed, len(data) / 1024 / elapsed, baud, sha256))
+            if run:
+                # Let the first lines of its output through
+                deadline = time.monotonic() + 1.0
+                while time.monotonic() < deadline:
+                    link.poll()
+    except LinkError as e:
+        raise SystemExit(str(e))
+    finally:
+        link.close()
+
+
+if __name__ == "__main__":
+    main(sys.argv)
@@ -0,0 +1,143 @@
+#!/usr/bin/env python3
+"""Local HTTPS stand-in for trying TLS session resumption on the device.
+
+    tls_standin.py [dir] [--host ADDR] [--port 8443]
+    tls_standin.py --header test/test_tls_session/standin.h [--host ADDR]
+    tls_standin.py --check
+
+Serves `dir` (the current one by default) over TLS 1.2 with session IDs
+and session tickets, using a self-signed certificate for ADDR (this PC's
+LAN address by default) kept in .tls-standin/. Copy .tls-standin/cert.pem
+to /tls/ca.pem on the device (see lib/downloader/tls_client.h), or write
+it into the on-target test with --header. --check connects twice from
+Python and fails unless the second handshake resumes the first session.
+"""
+import argparse
+import http.server
+import ipaddress
+import os
+import socket
+import ssl
+import subprocess
+import sys
+import threading
+
+STATE_DIR = ".tls-standin"
+
+
+def lan_address():
+    # No packet is sent; this only picks the interface of the default route
+    probe = socket.socket(socket.AF_INET, socket.SOCK_DGRAM)
+    try:
+        probe.connect(("192.0.2.1", 9))
+        return probe.getsockname()[0]
+    except OSError:
+        return "127.0.0.1"
+    finally:
+        probe.close()
+
+
+def make_certificate(host):
+    os.makedirs(STATE_DIR, exist_ok=True)
+    cert = os.path.join(STATE_DIR, "cert.pem")
+    key = os.path.join(STATE_DIR, "key.pem")
+    stamp = os.path.join(STATE_DIR, "host")
+    if os.path.exists(cert) and os.path.exists(stamp) and open(stamp).read() == host:
+        return cert, key
+
+    # mbedtls checks the name the device connected to against the SAN
+    try:
+        ipaddress.ip_address(host)
+        san = "IP:" + host
+    except ValueError:
+        san = "DNS:" + host
+    subprocess.run(["openssl", "req", "-x509", "-newkey", "ec",
+                    "-pkeyopt", "ec_paramgen_curve:prime256v1", "-nodes",
+                    "-days", "365", "-subj", "/CN=" + host,
+                    "-addext", "subjectAltName=" + san,
+                    "-keyout", key, "-out", cert],
+                   check=True, stderr=subprocess.DEVNULL)
+    with open(stamp, "w") as f:
+        f.write(host)
+    return cert, key
+
+
+def server_context(cert, key):
+    context = ssl.SSLContext(ssl.PROTOCOL_TLS_SERVER)
+    # The device's mbedtls 2.x speaks TLS 1.2; tickets are on by default
+    context.maximum_version = ssl.TLSVersion.TLSv1_2
+    context.load_cert_chain(cert, key)
+    return context
+
+
+def start_server(directory, port, context):
+    handler = lambda *args: http.server.SimpleHTTPRequestHandler(*args, directory=directory)
+    server = http.server.ThreadingHTTPServer(("", port), handler)
+    server.socket = context.wrap_socket(server.socket, server_side=True)
+    return server
+
+
+def check(cert, key, host):
+    server = start_server(".", 0, server_context(cert, key))
+    port = server.server_address[1]
+    threading.Thread(target=server.serve_forever, daemon=True).start()
+
+    client = ssl.SSLContext(ssl.PROTOCOL_TLS_CLIENT)
+    client.maximum_version = ssl.TLSVersion.TLSv1_2
+    client.load_verify_locations(cert)
+    session = None
+    reused = []
+    for _ in range(2):
+        with socket.create_connection(("127.0.0.1", port)) as raw:
+            with client.wrap_socket(raw, server_hostname=host, session=session) as tls:
+                tls.sendall(b"HEAD / HTTP/1.0\r\n\r\n")
+                while tls.recv(4096):
+                    pass
+                reused.append(tls.session_reused)
+                session = tls.session
+    server.shutdown()
+
+    if reused != [False, True]:
+        raise SystemExit("session not resumed: %s" % reused)
+    print("ok: second handshake resumed the first session")
+
+
+def write_header(path, cert, host, port):
+    pem = open(cert).read()
+    lines = "".join('    "%s\\n"\n' % line for line in pem.splitlines())
+    with open(path, "w") as f:
+        f.write("// Generated by tools/tls_standin.py --header; not checked in\n")
+        f.write("#pragma once\n\n")
+        f.write('#define STANDIN_HOST "%s"\n' % host)
+        f.write("#define STANDIN_PORT %d\n\n" % port)
+        f.write("static const char standin_ca_pem[] =\n%s;\n" % lines.rstrip("\n"))
+    print("wrote", path)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("dir", nargs="?", default=".")
+    parser.add_argument("--host", default=None, help="address the device connects to")
+    parser.add_argument("--port", type=int, default=8443)
+    parser.add_argument("--header", help="write the certificate as a C header and exit")
+    parser.add_argument("--check", action="store_true", help="check resumption from Python and exit")
+    args = parser.parse_args()
+
+    host = args.host or (lan_address() if not args.check else "localhost")
+    cert, key = make_certificate(host)
+    if args.check:
+        return check(cert, key, host)
+    if args.header:
+        return write_header(args.header, cert, host, args.port)
+
+    server = start_server(os.path.abspath(args.dir), args.port, server_context(cert, key))
+    print("Serving %s on https://%s:%d/ (copy %s to /tls/ca.pem)" %
+          (os.path.abspath(args.dir), host, args.port, cert))
+    try:
+        server.serve_forever()
+    except KeyboardInterrupt:
+        pass
+
+
+if __name__ == "__main__":
+    sys.exit(main())
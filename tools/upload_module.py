@@ -0,0 +1,61 @@
+#!/usr/bin/env python3
+"""Push a module build to a device over WiFi.
+
+    upload_module.py 192.168.1.42 build/blink.wasm [name] [--token T]
+
+The device streams the body to flash, validates it and registers it as
+module `name` (the file name without .wasm by default), replacing the
+bytecode of a module of that name unless it is running. See
+lib/upload_server/upload_server.h. Gzip or LZ4 files are sent as they are
+and decoded on the device. Exits non-zero when the device refuses.
+"""
+import json
+import os
+import sys
+import time
+import urllib.error
+import urllib.parse
+import urllib.request
+
+
+def upload(host, path, name, token=None):
+    url = "http://%s/modules?%s" % (host, urllib.parse.urlencode({"name": name}))
+    headers = {
+        "Content-Type": "application/wasm",
+        "Content-Length": str(os.path.getsize(path)),
+    }
+    if token:
+        headers["X-Upload-Token"] = token
+
+    with open(path, "rb") as body:
+        request = urllib.request.Request(url, data=body, headers=headers, method="POST")
+        start = time.monotonic()
+        try:
+            with urllib.request.urlopen(request, timeout=60) as response:
+                reply = json.load(response)
+        except urllib.error.HTTPError as e:
+            reply = json.load(e)
+            raise SystemExit("%s: %s (HTTP %d)" % (name, reply.get("error", "refused"), e.code))
+    elapsed = time.monotonic() - start
+    return reply, elapsed
+
+
+def main(argv):
+    token = None
+    if "--token" in argv:
+        i = argv.index("--token")
+        token = argv[i + 1]
+        del argv[i:i + 2]
+    if len(argv) not in (3, 4):
+        raise SystemExit(__doc__)
+
+    host, path = argv[1], argv[2]
+    name = argv[3] if len(argv) == 4 else os.path.basename(path).split(".wasm")[0]
+    reply, elapsed = upload(host, path, name, token)
+    size = os.path.getsize(path)
+    print("%s -> module %d, %d bytes in %.2f s (%.0f KB/s), sha256 %s" % (
+        reply["name"], reply["id"], reply["size"], elapsed, size / 1024 / elapsed, reply["sha256"]))
+
+
+if __name__ == "__main__":
+    main(sys.argv)
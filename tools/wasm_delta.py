@@ -0,0 +1,121 @@
+#!/usr/bin/env python3
+"""Make a WDP1 delta patch between two module versions.
+
+    wasm_delta.py old.wasm new.wasm blink-1.1-1.2.wdp
+
+The device rebuilds the new version from the one it already has (see
+lib/downloader/delta_patch.h) and checks both SHA-256 digests, falling
+back to a full download when anything doesn't match. List the patch in
+the manifest entry of the new version:
+
+    "deltas": [ { "from": "<sha256 of old.wasm>", "url": "blink-1.1-1.2.wdp" } ]
+
+Patches may be gzipped; the device decodes them like modules.
+"""
+import hashlib
+import struct
+import sys
+
+SEED = 8            # Bytes that must match exactly to start a match
+MIN_MATCH = 16      # Shorter matches are cheaper as literals
+OP_COPY, OP_INSERT, OP_ADD = 1, 2, 3
+
+
+def varint(n):
+    out = bytearray()
+    while True:
+        b = n & 0x7F
+        n >>= 7
+        out.append(b | (0x80 if n else 0))
+        if not n:
+            return bytes(out)
+
+
+def extend(old, new, i, j):
+    """Extends a seed match bsdiff-style: keeps going while at least half
+    of the last 16 bytes match, and returns the length with the best
+    match count."""
+    length, matches, best, best_len = 0, 0, 0, 0
+    window = []
+    while i + length < len(old) and j + length < len(new):
+        hit = old[i + length] == new[j + length]
+        window.append(hit)
+        matches += hit
+        length += 1
+        if len(window) > 16 and sum(window[-16:]) < 8:
+            break
+        if 2 * matches - length > best:
+            best, best_len = 2 * matches - length, length
+    return best_len
+
+
+def segments(delta):
+    """Splits a match into exact runs (COPY) and runs with differences
+    (ADD); short exact runs stay inside the ADD around them."""
+    out, start, k = [], 0, 0
+    while k < len(delta):
+        if delta[k]:
+            k += 1
+            continue
+        run = k
+        while k < len(delta) and not delta[k]:
+            k += 1
+        if k - run >= MIN_MATCH or (run == 0 and k == len(delta)):
+            if run > start:
+                out.append((start, run, False))
+            out.append((run, k, True))
+            start = k
+    if start < len(delta):
+        out.append((start, len(delta), False))
+    return out
+
+
+def diff(old, new):
+    index = {}
+    for i in range(0, len(old) - SEED + 1):
+        index.setdefault(old[i:i + SEED], i)
+
+    ops = bytearray()
+    literal = bytearray()
+
+    def flush():
+        if literal:
+            ops.extend(bytes([OP_INSERT]) + varint(len(literal)) + literal)
+            literal.clear()
+
+    j = 0
+    while j < len(new):
+        i = index.get(new[j:j + SEED])
+        length = extend(old, new, i, j) if i is not None else 0
+        if length < MIN_MATCH:
+            literal.append(new[j])
+            j += 1
+            continue
+
+        flush()
+        delta = bytes((new[j + k] - old[i + k]) & 0xFF for k in range(length))
+        for start, end, exact in segments(delta):
+            if exact:
+                ops.extend(bytes([OP_COPY]) + varint(i + start) + varint(end - start))
+            else:
+                ops.extend(bytes([OP_ADD]) + varint(i + start) + varint(end - start) + delta[start:end])
+        j += length
+    flush()
+    return bytes(ops)
+
+
+def main():
+    if len(sys.argv) != 4:
+        sys.exit(__doc__)
+    old = open(sys.argv[1], "rb").read()
+    new = open(sys.argv[2], "rb").read()
+
+    patch = (b"WDP1" + struct.pack("<II", len(old), len(new)) +
+             hashlib.sha256(old).digest() + hashlib.sha256(new).digest() + diff(old, new))
+    open(sys.argv[3], "wb").write(patch)
+    print("%d -> %d bytes, patch %d bytes" % (len(old), len(new), len(patch)))
+    print("from: %s" % hashlib.sha256(old).hexdigest())
+
+
+if __name__ == "__main__":
+    main()